@@ -0,0 +1,552 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file audio_pipeline_bench.cpp
+ * @brief 音频接收管线逐级基准：Opus 解码 → AudioRenderer → 低频能量分析
+ *
+ * 与 AudioRecv 线程 (BridgeArDecodeAndPlaySample) 的每包处理一致：
+ *   1. MoonlightOpusDecoder::Decode（丢包时 PLC，或 FEC 前瞻：DecodeFec + Decode）
+ *   2. AudioRenderer::PlaySamples（audio_renderer.cpp 原样编译，含延迟上限丢弃）
+ *   3. BassEnergyAnalyzer::ProcessFrame（音乐模式，onset 后端每帧运行）
+ * 读端为替身 libohaudio.so（fake_ohaudio.cpp）：每 10ms 调用一次 AudioRenderer::OnWriteData，
+ * 覆盖 underrun 填静音、恢复时渐入与路由延迟档案。
+ *
+ * 包与拉取按模拟时间轴交替：包按 5ms 间隔到达并叠加网络抖动（偶发 30-60ms 的成批迟到），
+ * 因此丢弃、underrun 与渐入都会发生。单线程执行，包与拉取的先后顺序固定；但路由上限推导
+ * 用的是模拟循环中回调的真实间隔（调度抖动会被当作回调卡顿），丢弃数随机器噪声略有浮动。
+ *
+ * 输入：
+ *   - 内置合成流：低音鼓 + 音调 + 噪声，编码端开启带内 FEC，立体声 / 5.1 / 7.1，
+ *     0% / 5% 随机丢包；
+ *   - 录制的包序列（位置参数，格式见 LoadTrace），按录制的到达时间与丢包回放。
+ * 逐包计时，输出各阶段 ns 分位数、环形缓冲排队时延分位数、丢弃 / underrun / 渐入次数
+ * 以及计时循环内的堆分配次数（应为 0）。
+ */
+
+#include "bench_util.h"
+#include "fake_ohaudio.h"
+
+#include "opus_libopus.h"
+#include "audio_renderer.h"
+#include "bass_energy_analyzer.h"
+
+#include <opus_multistream.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int kSampleRate = 48000;
+constexpr int kSamplesPerFrame = 240;       // 5ms
+constexpr int kPullFrames = 480;            // OHAudio 回调周期 10ms
+constexpr int64_t kPullPeriodUs = 10000;
+constexpr int64_t kPullPhaseUs = 7500;      // 首次拉取相对首包的偏移，与包到达错开
+constexpr int kMaxPacketBytes = 1400;
+constexpr int kMaxChannels = 8;
+
+struct StreamConfig {
+    const char* name;
+    int channels;
+    int streams;
+    int coupledStreams;
+    unsigned char mapping[8];
+    int bitrate;
+};
+
+// 与 Sunshine 默认（普通音质）多流布局一致
+const StreamConfig kConfigs[] = {
+    { "stereo", 2, 1, 1, { 0, 1 }, 96000 },
+    { "5.1", 6, 4, 2, { 0, 4, 1, 5, 2, 3 }, 256000 },
+    { "7.1", 8, 5, 3, { 0, 6, 1, 7, 2, 3, 4, 5 }, 450000 },
+};
+
+enum class Conceal { None, Plc, Fec };
+
+struct LossConfig {
+    const char* name;
+    double lossRate;
+    Conceal conceal;
+};
+
+const LossConfig kLosses[] = {
+    { "0%", 0.0, Conceal::None },
+    { "5%-plc", 0.05, Conceal::Plc },
+    { "5%-fec", 0.05, Conceal::Fec },
+};
+
+// 录制的包序列自带丢包，只选择补偿方式
+const LossConfig kRecordedLosses[] = {
+    { "recorded-plc", 0.0, Conceal::Plc },
+    { "recorded-fec", 0.0, Conceal::Fec },
+};
+
+/**
+ * 一路包序列：多流布局 + 每包到达时间（相对首包，微秒）与负载，负载为空表示丢包
+ */
+struct PacketTrace {
+    std::string name;
+    bool synthetic = true;
+    int channels = 0;
+    int streams = 0;
+    int coupledStreams = 0;
+    unsigned char mapping[8] = {};
+    int samplesPerFrame = kSamplesPerFrame;
+    std::vector<uint32_t> arrivalUs;
+    std::vector<std::vector<unsigned char>> packets;
+};
+
+/**
+ * 确定性 LCG，保证每次运行的信号、丢包与到达序列一致
+ */
+struct Lcg {
+    uint32_t state;
+    explicit Lcg(uint32_t seed) : state(seed) {}
+    uint32_t Next() {
+        state = state * 1664525u + 1013904223u;
+        return state;
+    }
+    double Uniform() { return (Next() >> 8) * (1.0 / 16777216.0); }
+};
+
+/**
+ * 合成测试信号并编码为 Opus 包
+ * 每 500ms 一次 60Hz 衰减低音鼓，叠加 440Hz 音调与白噪声；各声道相位略有不同。
+ */
+std::vector<std::vector<unsigned char>> EncodePackets(const StreamConfig& cfg, int frames) {
+    int err = 0;
+    OpusMSEncoder* enc = opus_multistream_encoder_create(kSampleRate, cfg.channels, cfg.streams,
+        cfg.coupledStreams, cfg.mapping, OPUS_APPLICATION_AUDIO, &err);
+    std::vector<std::vector<unsigned char>> packets;
+    if (err != OPUS_OK || enc == nullptr) return packets;
+    opus_multistream_encoder_ctl(enc, OPUS_SET_BITRATE(cfg.bitrate));
+    opus_multistream_encoder_ctl(enc, OPUS_SET_INBAND_FEC(1));
+    opus_multistream_encoder_ctl(enc, OPUS_SET_PACKET_LOSS_PERC(5));
+
+    Lcg rng(12345);
+    std::vector<int16_t> pcm(static_cast<size_t>(kSamplesPerFrame) * cfg.channels);
+    unsigned char buffer[kMaxPacketBytes];
+    packets.reserve(frames);
+    const int kickPeriod = kSampleRate / 2;
+    for (int f = 0; f < frames; f++) {
+        for (int i = 0; i < kSamplesPerFrame; i++) {
+            int n = f * kSamplesPerFrame + i;
+            int sinceKick = n % kickPeriod;
+            double kick = std::exp(-sinceKick / (0.08 * kSampleRate))
+                * std::sin(2.0 * M_PI * 60.0 * sinceKick / kSampleRate);
+            for (int ch = 0; ch < cfg.channels; ch++) {
+                double tone = 0.2 * std::sin(2.0 * M_PI * 440.0 * n / kSampleRate + ch * 0.3);
+                double noise = 0.05 * (rng.Uniform() * 2.0 - 1.0);
+                double v = 0.6 * kick + tone + noise;
+                pcm[static_cast<size_t>(i) * cfg.channels + ch] = static_cast<int16_t>(v * 20000.0);
+            }
+        }
+        int len = opus_multistream_encode(enc, pcm.data(), kSamplesPerFrame, buffer, kMaxPacketBytes);
+        packets.emplace_back(buffer, buffer + (len > 0 ? len : 0));
+    }
+    opus_multistream_encoder_destroy(enc);
+    return packets;
+}
+
+/**
+ * 合成到达时间：按包间隔发送，90% 的包迟到 0-1ms，8% 迟到 5-15ms，2% 迟到 30-60ms；
+ * 按序交付，迟到的包会把其后已到的包一起压住，形成成批到达
+ */
+std::vector<uint32_t> MakeArrivals(int frames, int samplesPerFrame) {
+    Lcg rng(4242);
+    std::vector<uint32_t> arrivals(frames);
+    const double packetUs = samplesPerFrame * 1000000.0 / kSampleRate;
+    uint32_t last = 0;
+    for (int f = 0; f < frames; f++) {
+        double u = rng.Uniform();
+        double delayUs = (u < 0.90) ? rng.Uniform() * 1000.0
+                       : (u < 0.98) ? 5000.0 + rng.Uniform() * 10000.0
+                       : 30000.0 + rng.Uniform() * 30000.0;
+        uint32_t t = static_cast<uint32_t>(f * packetUs + delayUs);
+        last = std::max(last, t);
+        arrivals[f] = last;
+    }
+    return arrivals;
+}
+
+PacketTrace SyntheticTrace(const StreamConfig& cfg, int frames) {
+    PacketTrace trace;
+    trace.name = cfg.name;
+    trace.channels = cfg.channels;
+    trace.streams = cfg.streams;
+    trace.coupledStreams = cfg.coupledStreams;
+    memcpy(trace.mapping, cfg.mapping, sizeof(trace.mapping));
+    trace.packets = EncodePackets(cfg, frames);
+    trace.arrivalUs = MakeArrivals(frames, trace.samplesPerFrame);
+    return trace;
+}
+
+// ---- 包序列文件 ----
+// 小端：
+//   "MLOP" | u8 版本(1) | u8 声道数 | u8 流数 | u8 耦合流数 | u8[8] 映射 | u16 每包采样帧数 | u32 采样率
+//   之后每包：u32 到达时间（相对首包，微秒，单调不减）| u16 长度 | 负载；长度 0 表示丢包
+constexpr char kTraceMagic[4] = { 'M', 'L', 'O', 'P' };
+constexpr uint8_t kTraceVersion = 1;
+
+void PutLe(std::vector<unsigned char>& out, uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; i++) {
+        out.push_back(static_cast<unsigned char>(value >> (8 * i)));
+    }
+}
+
+bool GetLe(FILE* file, int bytes, uint32_t& value) {
+    unsigned char buffer[4];
+    if (fread(buffer, 1, bytes, file) != static_cast<size_t>(bytes)) return false;
+    value = 0;
+    for (int i = 0; i < bytes; i++) {
+        value |= static_cast<uint32_t>(buffer[i]) << (8 * i);
+    }
+    return true;
+}
+
+bool SaveTrace(FILE* file, const PacketTrace& trace) {
+    std::vector<unsigned char> out(kTraceMagic, kTraceMagic + 4);
+    out.push_back(kTraceVersion);
+    out.push_back(static_cast<unsigned char>(trace.channels));
+    out.push_back(static_cast<unsigned char>(trace.streams));
+    out.push_back(static_cast<unsigned char>(trace.coupledStreams));
+    out.insert(out.end(), trace.mapping, trace.mapping + 8);
+    PutLe(out, static_cast<uint32_t>(trace.samplesPerFrame), 2);
+    PutLe(out, kSampleRate, 4);
+    for (size_t i = 0; i < trace.packets.size(); i++) {
+        PutLe(out, trace.arrivalUs[i], 4);
+        PutLe(out, static_cast<uint32_t>(trace.packets[i].size()), 2);
+        out.insert(out.end(), trace.packets[i].begin(), trace.packets[i].end());
+    }
+    return fwrite(out.data(), 1, out.size(), file) == out.size();
+}
+
+bool LoadTrace(FILE* file, PacketTrace& trace, std::string& error) {
+    unsigned char head[16];
+    if (fread(head, 1, sizeof(head), file) != sizeof(head) || memcmp(head, kTraceMagic, 4) != 0) {
+        error = "not an MLOP packet trace";
+        return false;
+    }
+    if (head[4] != kTraceVersion) {
+        error = "unsupported trace version " + std::to_string(head[4]);
+        return false;
+    }
+    trace.channels = head[5];
+    trace.streams = head[6];
+    trace.coupledStreams = head[7];
+    memcpy(trace.mapping, head + 8, 8);
+    uint32_t samplesPerFrame = 0;
+    uint32_t sampleRate = 0;
+    if (!GetLe(file, 2, samplesPerFrame) || !GetLe(file, 4, sampleRate)) {
+        error = "truncated header";
+        return false;
+    }
+    trace.samplesPerFrame = static_cast<int>(samplesPerFrame);
+    if (sampleRate != kSampleRate || trace.channels < 1 || trace.channels > kMaxChannels ||
+        trace.streams < 1 || trace.coupledStreams > trace.streams ||
+        trace.samplesPerFrame <= 0 || trace.samplesPerFrame > kPullFrames * 2) {
+        error = "unsupported stream layout";
+        return false;
+    }
+    trace.arrivalUs.clear();
+    trace.packets.clear();
+    uint32_t arrival = 0;
+    while (GetLe(file, 4, arrival)) {
+        uint32_t length = 0;
+        std::vector<unsigned char> payload;
+        if (!GetLe(file, 2, length) || length > kMaxPacketBytes * kMaxChannels) {
+            error = "truncated packet header";
+            return false;
+        }
+        payload.resize(length);
+        if (length > 0 && fread(payload.data(), 1, length, file) != length) {
+            error = "truncated packet payload";
+            return false;
+        }
+        if (!trace.arrivalUs.empty() && arrival < trace.arrivalUs.back()) {
+            error = "arrival times go backwards";
+            return false;
+        }
+        trace.arrivalUs.push_back(arrival);
+        trace.packets.push_back(std::move(payload));
+    }
+    if (trace.packets.empty()) {
+        error = "no packets";
+        return false;
+    }
+    return true;
+}
+
+void RunTrace(bench::Report& report, const PacketTrace& trace, const LossConfig& loss) {
+    const int channels = trace.channels;
+    const int samplesPerFrame = trace.samplesPerFrame;
+    OPUS_MULTISTREAM_CONFIGURATION opusConfig = {};
+    opusConfig.sampleRate = kSampleRate;
+    opusConfig.channelCount = channels;
+    opusConfig.streams = trace.streams;
+    opusConfig.coupledStreams = trace.coupledStreams;
+    opusConfig.samplesPerFrame = samplesPerFrame;
+    memcpy(opusConfig.mapping, trace.mapping, sizeof(trace.mapping));
+
+    const std::string label = trace.name + " " + loss.name;
+    MoonlightOpusDecoder::SetFecLookahead(loss.conceal == Conceal::Fec);
+    if (!report.Check(MoonlightOpusDecoder::Init(&opusConfig) == 0, label + ": decoder init")) {
+        return;
+    }
+
+    // 与 AudioRendererInstance::Init 相同的配置；替身路由为扬声器（初始上限 LOCAL_LATENCY_CAP_MS）
+    FakeOHAudio_SetOutputDevice(AUDIO_DEVICE_TYPE_SPEAKER);
+    AudioRenderer renderer;
+    AudioRendererConfig rendererConfig = {};
+    rendererConfig.sampleRate = kSampleRate;
+    rendererConfig.channelCount = channels;
+    rendererConfig.samplesPerFrame = samplesPerFrame;
+    rendererConfig.bitsPerSample = 16;
+    rendererConfig.volume = 1.0f;
+    rendererConfig.enableSpatialAudio = false;
+    if (!report.Check(renderer.Init(rendererConfig) == 0 && renderer.Start() == 0, label + ": renderer init")) {
+        MoonlightOpusDecoder::Cleanup();
+        return;
+    }
+    OH_AudioRenderer* device = FakeOHAudio_LastRenderer();
+
+    BassEnergyAnalyzer analyzer;
+    analyzer.Init(kSampleRate, channels);
+    analyzer.SetEnabled(true);
+    analyzer.SetSceneMode(BassEnergyAnalyzer::SCENE_MUSIC);
+
+    const int frames = static_cast<int>(trace.packets.size());
+    const int32_t pullBytes = static_cast<int32_t>(kPullFrames * channels * sizeof(int16_t));
+    std::vector<int16_t> pcm(static_cast<size_t>(samplesPerFrame) * channels);
+    std::vector<int16_t> deviceBuffer(static_cast<size_t>(kPullFrames) * channels);
+    std::vector<uint64_t> decodeNs;
+    std::vector<uint64_t> concealNs;
+    std::vector<uint64_t> playNs;
+    std::vector<uint64_t> analyzeNs;
+    std::vector<uint64_t> packetNs;
+    std::vector<uint64_t> writeDataNs;
+    std::vector<uint64_t> fadeInNs;
+    std::vector<uint64_t> queuedUs;
+    decodeNs.reserve(frames);
+    concealNs.reserve(frames);
+    playNs.reserve(frames * 2);
+    analyzeNs.reserve(frames * 2);
+    packetNs.reserve(frames * 2);
+    queuedUs.reserve(frames * 2);
+    const size_t pulls = static_cast<size_t>(trace.arrivalUs.back() / kPullPeriodUs) + 2;
+    writeDataNs.reserve(pulls);
+    fadeInNs.reserve(pulls);
+
+    Lcg lossRng(777);
+    uint64_t lost = 0;
+    uint64_t decodeErrors = 0;
+    uint64_t capViolations = 0;     // 排队已超上限仍被接收
+    uint64_t spuriousDrops = 0;     // 未超上限却被丢弃
+    uint64_t fadeIns = 0;
+    uint64_t fadeErrors = 0;        // 恢复后的首帧不为静音（渐入增益从 0 开始）
+    bool pendingLoss = false;
+    bool recovering = false;        // 上一次回调 underrun，下一次有数据时应渐入
+
+    // 解码结果交给 AudioRenderer，再做低频分析；elapsedNs 为本包此前的解码 / 补偿耗时
+    auto play = [&](int len, uint64_t elapsedNs) {
+        if (len <= 0) {
+            decodeErrors++;
+            return;
+        }
+        double queuedMs = renderer.GetBufferLatencyMs();
+        int capMs = renderer.GetRouteLatencyCapMs();
+        uint64_t droppedBefore = renderer.GetStats().droppedSamples;
+
+        uint64_t t0 = bench::NowNs();
+        renderer.PlaySamples(pcm.data(), len);
+        uint64_t t1 = bench::NowNs();
+        HapticBandIntensity bands;
+        bench::DoNotOptimize(analyzer.ProcessFrame(pcm.data(), len, bands));
+        uint64_t t2 = bench::NowNs();
+        playNs.push_back(t1 - t0);
+        analyzeNs.push_back(t2 - t1);
+        packetNs.push_back(elapsedNs + (t2 - t0));
+
+        bool accepted = renderer.GetStats().droppedSamples == droppedBefore;
+        if (accepted) {
+            capViolations += (queuedMs > capMs) ? 1 : 0;
+            queuedUs.push_back(static_cast<uint64_t>(renderer.GetBufferLatencyMs() * 1000.0));
+        } else {
+            spuriousDrops += (queuedMs <= capMs) ? 1 : 0;
+        }
+    };
+
+    auto handlePacket = [&](int f) {
+        const std::vector<unsigned char>& pkt = trace.packets[f];
+        bool dropped = (loss.lossRate > 0 && lossRng.Uniform() < loss.lossRate) || pkt.empty();
+        if (dropped) {
+            lost++;
+            if (loss.conceal == Conceal::Fec) {
+                // FEC 前瞻：等下一包到达后再补
+                pendingLoss = true;
+            } else {
+                uint64_t t0 = bench::NowNs();
+                int len = MoonlightOpusDecoder::Decode(nullptr, 0, pcm.data(), samplesPerFrame);
+                uint64_t dt = bench::NowNs() - t0;
+                concealNs.push_back(dt);
+                play(len, dt);
+            }
+            return;
+        }
+        if (pendingLoss) {
+            pendingLoss = false;
+            uint64_t t0 = bench::NowNs();
+            int len = MoonlightOpusDecoder::DecodeFec(pkt.data(), static_cast<int>(pkt.size()),
+                                                      pcm.data(), samplesPerFrame);
+            uint64_t dt = bench::NowNs() - t0;
+            concealNs.push_back(dt);
+            play(len, dt);
+        }
+        uint64_t t0 = bench::NowNs();
+        int len = MoonlightOpusDecoder::Decode(pkt.data(), static_cast<int>(pkt.size()),
+                                               pcm.data(), samplesPerFrame);
+        uint64_t dt = bench::NowNs() - t0;
+        decodeNs.push_back(dt);
+        play(len, dt);
+    };
+
+    // 替身 OHAudio 回调线程：取 10ms，区分普通回调与 underrun 后的渐入回调
+    auto pull = [&]() {
+        AudioRendererStats before = renderer.GetStats();
+        uint64_t t0 = bench::NowNs();
+        FakeOHAudio_Pull(device, deviceBuffer.data(), pullBytes);
+        uint64_t dt = bench::NowNs() - t0;
+        AudioRendererStats after = renderer.GetStats();
+
+        bool gotData = after.playedSamples > before.playedSamples;
+        if (recovering && gotData) {
+            fadeIns++;
+            fadeInNs.push_back(dt);
+            for (int c = 0; c < channels; c++) {
+                fadeErrors += (deviceBuffer[c] != 0) ? 1 : 0;
+            }
+        } else {
+            writeDataNs.push_back(dt);
+        }
+        recovering = after.underruns > before.underruns;
+    };
+
+    uint64_t allocsBefore = bench::AllocCount();
+    int64_t nextPullUs = static_cast<int64_t>(trace.arrivalUs[0]) + kPullPhaseUs;
+    for (int f = 0; f < frames;) {
+        if (trace.arrivalUs[f] <= nextPullUs) {
+            handlePacket(f++);
+        } else {
+            pull();
+            nextPullUs += kPullPeriodUs;
+        }
+    }
+    uint64_t allocs = bench::AllocCount() - allocsBefore;
+
+    AudioRendererStats stats = renderer.GetStats();
+    OpusDecodeStats decodeStats;
+    MoonlightOpusDecoder::GetStats(&decodeStats);
+    BassEnergyAnalyzer::OnsetStats onsetStats = analyzer.GetOnsetStats();
+    renderer.Cleanup();
+    MoonlightOpusDecoder::Cleanup();
+
+    report.Check(decodeErrors == 0, label + ": decode errors");
+    report.Check(allocs == 0, label + ": heap allocations on the hot path");
+    report.Check(stats.playedSamples > 0, label + ": renderer never played");
+    report.Check(capViolations == 0, label + ": PlaySamples accepted a frame above the latency cap");
+    report.Check(spuriousDrops == 0, label + ": PlaySamples dropped a frame below the latency cap");
+    report.Check(fadeErrors == 0, label + ": underrun recovery did not start from silence");
+    if (trace.synthetic) {
+        // 合成到达序列含 30-60ms 成批迟到，两条路径都必须被走到
+        report.Check(stats.droppedSamples > 0, label + ": latency-cap drop path not exercised");
+        report.Check(fadeIns > 0, label + ": underrun fade-in path not exercised");
+    }
+
+    bench::Record& r = report.Add();
+    r.Set("config", trace.name)
+     .Set("source", trace.synthetic ? "synthetic" : "recorded")
+     .Set("channels", channels)
+     .Set("loss", loss.name)
+     .Set("frames", frames)
+     .Set("lost", lost)
+     .Set("decode_ns", bench::Summarize(decodeNs))
+     .Set("conceal_ns", bench::Summarize(concealNs))
+     .Set("play_ns", bench::Summarize(playNs))
+     .Set("analyze_ns", bench::Summarize(analyzeNs))
+     .Set("packet_ns", bench::Summarize(packetNs))
+     .Set("write_data_ns", bench::Summarize(writeDataNs))
+     .Set("fade_in_write_ns", bench::Summarize(fadeInNs))
+     .Set("queued_us", bench::Summarize(queuedUs))
+     .Set("dropped_frames", stats.droppedSamples)
+     .Set("underruns", static_cast<uint64_t>(stats.underruns))
+     .Set("fade_ins", fadeIns)
+     .Set("route_cap_ms", stats.routeCapMs)
+     .Set("device_latency_ms", stats.deviceLatencyMs)
+     .Set("plc_frames", decodeStats.plcFrames)
+     .Set("fec_recovered", decodeStats.fecRecovered)
+     .Set("onset_backend", onsetStats.backend)
+     .Set("onsets", onsetStats.onsets)
+     .Set("allocs", allocs);
+}
+
+/**
+ * 写出后读回，核对包序列文件格式
+ */
+bool RoundTrip(const PacketTrace& trace) {
+    FILE* file = tmpfile();
+    if (file == nullptr) return false;
+    PacketTrace loaded;
+    std::string error;
+    bool ok = SaveTrace(file, trace) && fseek(file, 0, SEEK_SET) == 0 && LoadTrace(file, loaded, error);
+    fclose(file);
+    return ok && loaded.channels == trace.channels && loaded.streams == trace.streams &&
+        loaded.coupledStreams == trace.coupledStreams &&
+        memcmp(loaded.mapping, trace.mapping, sizeof(trace.mapping)) == 0 &&
+        loaded.samplesPerFrame == trace.samplesPerFrame &&
+        loaded.arrivalUs == trace.arrivalUs && loaded.packets == trace.packets;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bench::Report report("audio_pipeline", argc, argv, true);
+    const int frames = report.Scale(20000, 2000);  // 100s / 10s 音频
+
+    for (const StreamConfig& cfg : kConfigs) {
+        PacketTrace trace = SyntheticTrace(cfg, frames);
+        if (!report.Check(static_cast<int>(trace.packets.size()) == frames, std::string("encode ") + cfg.name)) {
+            continue;
+        }
+        report.Check(RoundTrip(trace), std::string("trace file round trip ") + cfg.name);
+        for (const LossConfig& loss : kLosses) {
+            RunTrace(report, trace, loss);
+        }
+    }
+
+    for (const std::string& path : report.Inputs()) {
+        PacketTrace trace;
+        std::string error = "cannot open";
+        trace.name = path;
+        trace.synthetic = false;
+        FILE* file = fopen(path.c_str(), "rb");
+        bool loaded = file != nullptr && LoadTrace(file, trace, error);
+        if (file != nullptr) fclose(file);
+        if (!report.Check(loaded, path + ": " + error)) continue;
+        for (const LossConfig& loss : kRecordedLosses) {
+            RunTrace(report, trace, loss);
+        }
+    }
+    return report.Finish();
+}
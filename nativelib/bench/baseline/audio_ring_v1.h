@@ -0,0 +1,85 @@
+// Frozen baseline for nativelib/bench — do not edit.
+// The int16 PCM ring AudioRenderer used before lockfree_ring.h, lifted out of
+// PlaySamples / OnWriteData into a class so it can be timed next to SpscRing.
+
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+class AudioRingV1 {
+public:
+    ~AudioRingV1() { delete[] ringBuffer_; }
+
+    void Init(int usableSamples) {
+        // SPSC 环形缓冲区需要多留 1 个位置以区分满/空
+        ringCapacity_ = usableSamples + 1;
+        delete[] ringBuffer_;
+        ringBuffer_ = new int16_t[ringCapacity_];
+        memset(ringBuffer_, 0, ringCapacity_ * sizeof(int16_t));
+        ringHead_.store(0, std::memory_order_relaxed);
+        ringTail_.store(0, std::memory_order_relaxed);
+    }
+
+    // PlaySamples：空间不足时整块丢弃
+    bool Write(const int16_t* pcmData, int dataSize) {
+        int tail = ringTail_.load(std::memory_order_relaxed);
+        int head = ringHead_.load(std::memory_order_acquire);
+        int available;
+        if (tail >= head) {
+            available = ringCapacity_ - (tail - head) - 1;
+        } else {
+            available = head - tail - 1;
+        }
+        if (available < dataSize) {
+            return false;
+        }
+        int firstPart = std::min(dataSize, ringCapacity_ - tail);
+        memcpy(ringBuffer_ + tail, pcmData, firstPart * sizeof(int16_t));
+        if (firstPart < dataSize) {
+            memcpy(ringBuffer_, pcmData + firstPart, (dataSize - firstPart) * sizeof(int16_t));
+        }
+        ringTail_.store((tail + dataSize) % ringCapacity_, std::memory_order_release);
+        return true;
+    }
+
+    // OnWriteData：读取最多 samplesNeeded 个采样
+    int Read(int16_t* outBuffer, int samplesNeeded) {
+        int head = ringHead_.load(std::memory_order_relaxed);
+        int tail = ringTail_.load(std::memory_order_acquire);
+        int available;
+        if (tail >= head) {
+            available = tail - head;
+        } else {
+            available = ringCapacity_ - head + tail;
+        }
+        int toCopy = std::min(available, samplesNeeded);
+        if (toCopy > 0) {
+            int firstPart = std::min(toCopy, ringCapacity_ - head);
+            memcpy(outBuffer, ringBuffer_ + head, firstPart * sizeof(int16_t));
+            if (firstPart < toCopy) {
+                memcpy(outBuffer + firstPart, ringBuffer_, (toCopy - firstPart) * sizeof(int16_t));
+            }
+            ringHead_.store((head + toCopy) % ringCapacity_, std::memory_order_release);
+        }
+        return toCopy;
+    }
+
+private:
+    int ringCapacity_ = 0;
+    int16_t* ringBuffer_ = nullptr;
+    std::atomic<int> ringHead_{0};
+    std::atomic<int> ringTail_{0};
+};
@@ -0,0 +1,672 @@
+// Frozen baseline for nativelib/bench — do not edit.
+// VID/PID lookups before controller_db_generated.h: the SDL GameControllerDB strings are parsed
+// into a heap vector on first use, and every table is scanned linearly. Parser, GUID decoding and
+// scans are copied from sdl_gamecontrollerdb.cpp / gamepad_napi.cpp with the old struct layout.
+
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "sdl_gamecontrollerdb.h"       // MappingSourceType
+#include "sdl_gamecontrollerdb_data.h"
+
+// ==================== 单个映射项 ====================
+typedef struct {
+    MappingSourceType type;
+    int index;          // 按钮/轴/HAT 索引
+    int hatMask;        // HAT 方向掩码 (仅 type=MAPPING_HAT 时使用)
+    bool inverted;      // 轴是否反转 (a~# 格式)
+    int rangeMin;       // 轴范围映射 (a#+, a#- 格式)
+    int rangeMax;
+} MappingSourceV1;
+
+// ==================== 完整手柄映射 ====================
+typedef struct {
+    uint16_t vendorId;
+    uint16_t productId;
+    const char* name;
+
+    MappingSourceV1 a, b, x, y, back, guide, start, leftstick, rightstick, leftshoulder, rightshoulder;
+    MappingSourceV1 dpup, dpdown, dpleft, dpright;
+    MappingSourceV1 leftx, lefty, rightx, righty, lefttrigger, righttrigger;
+
+    int reportOffset;           // HID 报告数据偏移 (跳过 Report ID)
+    int reportLength;           // 期望的 HID 报告长度
+} GamepadMappingV1;
+
+/**
+ * 从 SDL GUID 字符串中提取 VID/PID (Linux 格式)
+ * 
+ * Linux GUID 布局 (16 bytes, 32 hex chars):
+ *   Bytes 0-1:  Bus type (LE)
+ *   Bytes 2-3:  CRC16
+ *   Bytes 4-5:  Vendor ID (LE)  → hex chars 8-11
+ *   Bytes 6-7:  Padding
+ *   Bytes 8-9:  Product ID (LE) → hex chars 16-19
+ *   Bytes 10-15: Version + padding
+ */
+static inline bool extractVidPidFromGUIDV1(const char* guid, uint16_t* outVid, uint16_t* outPid) {
+    if (!guid || strlen(guid) < 20) return false;
+    
+    auto hexDigit = [](char c) -> int {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    };
+    
+    auto hexByte = [&hexDigit](const char* s) -> int {
+        int hi = hexDigit(s[0]);
+        int lo = hexDigit(s[1]);
+        if (hi < 0 || lo < 0) return -1;
+        return (hi << 4) | lo;
+    };
+    
+    // VID: bytes 4-5 at hex offset 8-11, little-endian
+    int vidLo = hexByte(guid + 8);
+    int vidHi = hexByte(guid + 10);
+    if (vidLo < 0 || vidHi < 0) return false;
+    *outVid = (uint16_t)(vidLo | (vidHi << 8));
+    
+    // PID: bytes 8-9 at hex offset 16-19, little-endian
+    int pidLo = hexByte(guid + 16);
+    int pidHi = hexByte(guid + 18);
+    if (pidLo < 0 || pidHi < 0) return false;
+    *outPid = (uint16_t)(pidLo | (pidHi << 8));
+    
+    return (*outVid != 0 || *outPid != 0);
+}
+
+/**
+ * 解析单个映射元素 (如 "b0", "a1", "h0.1")
+ */
+static inline bool parseElementV1(const char* str, MappingSourceV1* out) {
+    if (!str || !out) return false;
+    
+    out->type = MAPPING_NONE;
+    out->index = 0;
+    out->hatMask = 0;
+    out->inverted = false;
+    out->rangeMin = 0;
+    out->rangeMax = 255;
+    
+    // 检查是否反转 (a~0 格式)
+    bool inverted = false;
+    if (str[0] == '~') {
+        inverted = true;
+        str++;
+    }
+    
+    char type = str[0];
+    const char* rest = str + 1;
+    
+    switch (type) {
+        case 'b':
+            out->type = MAPPING_BUTTON;
+            out->index = atoi(rest);
+            break;
+            
+        case 'a':
+            out->type = MAPPING_AXIS;
+            out->inverted = inverted;
+            // 检查 a0+ 或 a0- 格式
+            {
+                char* endptr;
+                out->index = strtol(rest, &endptr, 10);
+                if (*endptr == '+') {
+                    out->rangeMin = 128;
+                    out->rangeMax = 255;
+                } else if (*endptr == '-') {
+                    out->rangeMin = 0;
+                    out->rangeMax = 128;
+                }
+            }
+            break;
+            
+        case 'h':
+            out->type = MAPPING_HAT;
+            // 格式: h0.1, h0.2, h0.4, h0.8
+            {
+                const char* dotPos = strchr(rest, '.');
+                if (dotPos) {
+                    out->index = atoi(rest);
+                    out->hatMask = atoi(dotPos + 1);
+                }
+            }
+            break;
+            
+        default:
+            return false;
+    }
+    
+    return true;
+}
+
+static inline bool parseSDLMappingStringV1(const char* mappingString, GamepadMappingV1* outMapping) {
+    if (!mappingString || !outMapping) return false;
+    
+    // 初始化所有映射为 NONE
+    memset(outMapping, 0, sizeof(GamepadMappingV1));
+    
+    // 复制字符串以便修改
+    char* str = strdup(mappingString);
+    if (!str) return false;
+    
+    // 解析 GUID (跳过)
+    char* token = strtok(str, ",");
+    if (!token) { free(str); return false; }
+    
+    // 解析名称
+    token = strtok(NULL, ",");
+    if (token) {
+        outMapping->name = strdup(token);
+    }
+    
+    // 解析映射对
+    while ((token = strtok(NULL, ",")) != NULL) {
+        char* colonPos = strchr(token, ':');
+        if (!colonPos) continue;
+        
+        *colonPos = '\0';
+        const char* key = token;
+        const char* value = colonPos + 1;
+        
+        MappingSourceV1 src;
+        if (!parseElementV1(value, &src)) continue;
+        
+        // 按键名匹配
+        if (strcmp(key, "a") == 0) outMapping->a = src;
+        else if (strcmp(key, "b") == 0) outMapping->b = src;
+        else if (strcmp(key, "x") == 0) outMapping->x = src;
+        else if (strcmp(key, "y") == 0) outMapping->y = src;
+        else if (strcmp(key, "back") == 0) outMapping->back = src;
+        else if (strcmp(key, "guide") == 0) outMapping->guide = src;
+        else if (strcmp(key, "start") == 0) outMapping->start = src;
+        else if (strcmp(key, "leftstick") == 0) outMapping->leftstick = src;
+        else if (strcmp(key, "rightstick") == 0) outMapping->rightstick = src;
+        else if (strcmp(key, "leftshoulder") == 0) outMapping->leftshoulder = src;
+        else if (strcmp(key, "rightshoulder") == 0) outMapping->rightshoulder = src;
+        else if (strcmp(key, "dpup") == 0) outMapping->dpup = src;
+        else if (strcmp(key, "dpdown") == 0) outMapping->dpdown = src;
+        else if (strcmp(key, "dpleft") == 0) outMapping->dpleft = src;
+        else if (strcmp(key, "dpright") == 0) outMapping->dpright = src;
+        else if (strcmp(key, "leftx") == 0) outMapping->leftx = src;
+        else if (strcmp(key, "lefty") == 0) outMapping->lefty = src;
+        else if (strcmp(key, "rightx") == 0) outMapping->rightx = src;
+        else if (strcmp(key, "righty") == 0) outMapping->righty = src;
+        else if (strcmp(key, "lefttrigger") == 0) outMapping->lefttrigger = src;
+        else if (strcmp(key, "righttrigger") == 0) outMapping->righttrigger = src;
+    }
+    
+    free(str);
+    return true;
+}
+
+class ControllerDbV1 {
+public:
+    struct KnownGamepadV1 {
+        uint16_t vendorId;
+        uint16_t productId;
+        const char* name;
+        int32_t type;           // 0=Unknown, 1=Xbox, 2=PlayStation, 3=Switch
+        int reportLength;       // 期望的报告长度, 0=不限
+    };
+
+    struct VendorFallbackV1 {
+        uint16_t vendorId;
+        const char* vendorName;
+        int32_t defaultType;
+    };
+
+    ControllerDbV1() {
+        // 精选映射表：扫描开销只取决于键和表项步长，内容不参与查找
+        static const struct { uint16_t vendorId; uint16_t productId; const char* name; } kCurated[] = {
+            {0x045E, 0x028E, "Xbox 360 Controller"},
+            {0x045E, 0x02D1, "Xbox One Controller"},
+            {0x045E, 0x0B12, "Xbox Series X Controller"},
+            {0x054C, 0x05C4, "DualShock 4"},
+            {0x054C, 0x09CC, "DualShock 4 v2"},
+            {0x054C, 0x0CE6, "DualSense Controller"},
+            {0x057E, 0x2009, "Switch Pro Controller"},
+            {0x2DC8, 0x6006, "8BitDo Pro 2"},
+            {0x2DC8, 0x3104, "8BitDo Ultimate"},
+            {0x046D, 0xC21D, "Logitech F310"},
+            {0x046D, 0xC21F, "Logitech F710"},
+            {0x1532, 0x0A14, "Razer Wolverine Ultimate"},
+            {0x0079, 0x0006, "DragonRise Generic Controller"},
+            {0x0F0D, 0x00C1, "HORI Fighting Stick"},
+            {0x0F0D, 0x0067, "HORIPAD"},
+            {0x20D6, 0xA711, "PowerA Xbox Controller"},
+            {0x1038, 0x1430, "SteelSeries Stratus Duo"},
+            {0x3575, 0x0620, "GameSir Nova"},
+            {0x3820, 0x0009, "GuliKit KingKong 2 Pro"},
+        };
+        memset(curated_, 0, sizeof(curated_));
+        for (size_t i = 0; i < sizeof(kCurated) / sizeof(kCurated[0]); i++) {
+            curated_[i].vendorId = kCurated[i].vendorId;
+            curated_[i].productId = kCurated[i].productId;
+            curated_[i].name = kCurated[i].name;
+        }
+    }
+
+    ~ControllerDbV1() {
+        for (const GamepadMappingV1& m : sdlParsedMappings_) free(const_cast<char*>(m.name));
+    }
+
+    const GamepadMappingV1* FindGamepadMapping(uint16_t vendorId, uint16_t productId) {
+        // 1. 先搜索静态预定义数据库 (手工调优映射，优先级最高)
+        for (int i = 0; curated_[i].name != NULL; i++) {
+            if (curated_[i].vendorId == vendorId &&
+                curated_[i].productId == productId) {
+                return &curated_[i];
+            }
+        }
+
+        // 2. 搜索 SDL GameControllerDB 社区数据库
+        InitSDLGameControllerDB();
+        for (size_t i = 0; i < sdlParsedMappings_.size(); i++) {
+            if (sdlParsedMappings_[i].vendorId == vendorId &&
+                sdlParsedMappings_[i].productId == productId) {
+                return &sdlParsedMappings_[i];
+            }
+        }
+        return NULL;
+    }
+
+    // gamepad_napi.cpp findGamepad
+    static const KnownGamepadV1* FindGamepad(uint16_t vendorId, uint16_t productId) {
+        for (int i = 0; kKnownGamepads[i].name != NULL; i++) {
+            if (kKnownGamepads[i].vendorId == vendorId &&
+                kKnownGamepads[i].productId == productId) {
+                return &kKnownGamepads[i];
+            }
+        }
+        return NULL;
+    }
+
+    // gamepad_napi.cpp getGamepadType（去掉日志）
+    static int32_t GetGamepadType(uint16_t vendorId, uint16_t productId) {
+        const KnownGamepadV1* gamepad = FindGamepad(vendorId, productId);
+        if (gamepad) {
+            return gamepad->type;
+        }
+        for (int i = 0; kVendorFallbacks[i].vendorName != NULL; i++) {
+            if (kVendorFallbacks[i].vendorId == vendorId) {
+                return kVendorFallbacks[i].defaultType;
+            }
+        }
+        return 0;
+    }
+
+    // 懒加载产生的堆占用：vector 容量 + strdup 的名称
+    size_t HeapBytes() const {
+        size_t bytes = sdlParsedMappings_.capacity() * sizeof(GamepadMappingV1);
+        for (const GamepadMappingV1& m : sdlParsedMappings_) bytes += m.name ? strlen(m.name) + 1 : 0;
+        return bytes;
+    }
+
+    size_t SdlMappingCount() const { return sdlParsedMappings_.size(); }
+    const GamepadMappingV1& SdlMapping(size_t i) const { return sdlParsedMappings_[i]; }
+
+    static const KnownGamepadV1 kKnownGamepads[];
+    static const VendorFallbackV1 kVendorFallbacks[];
+
+private:
+    void InitSDLGameControllerDB() {
+        if (sdlDBInitialized_) return;
+        sdlDBInitialized_ = true;
+
+        sdlParsedMappings_.reserve(g_sdlGameControllerDBCount);
+
+        for (int i = 0; i < g_sdlGameControllerDBCount; i++) {
+            const char* entry = g_sdlGameControllerDB[i];
+            if (!entry) break;
+
+            GamepadMappingV1 mapping;
+            if (parseSDLMappingStringV1(entry, &mapping)) {
+                uint16_t vid = 0, pid = 0;
+                if (extractVidPidFromGUIDV1(entry, &vid, &pid)) {
+                    mapping.vendorId = vid;
+                    mapping.productId = pid;
+                    sdlParsedMappings_.push_back(mapping);
+                    continue;
+                }
+            }
+            free(const_cast<char*>(mapping.name));
+        }
+    }
+
+    GamepadMappingV1 curated_[20];
+    std::vector<GamepadMappingV1> sdlParsedMappings_;
+    bool sdlDBInitialized_ = false;
+};
+
+inline const ControllerDbV1::KnownGamepadV1 ControllerDbV1::kKnownGamepads[] = {
+    // ==================== Microsoft Xbox 系列 ====================
+    {0x045E, 0x0202, "Xbox Controller", 1, 0},
+    {0x045E, 0x0285, "Xbox Controller S", 1, 0},
+    {0x045E, 0x0289, "Xbox Controller S", 1, 0},
+    {0x045E, 0x028E, "Xbox 360 Controller", 1, 0},
+    {0x045E, 0x028F, "Xbox 360 Wireless Controller", 1, 0},
+    {0x045E, 0x0291, "Xbox 360 Wireless Controller", 1, 0},
+    {0x045E, 0x02D1, "Xbox One Controller", 1, 0},
+    {0x045E, 0x02DD, "Xbox One Controller", 1, 0},
+    {0x045E, 0x02E0, "Xbox One S Controller", 1, 0},
+    {0x045E, 0x02E3, "Xbox One Elite Controller", 1, 0},
+    {0x045E, 0x02EA, "Xbox One S Controller", 1, 0},
+    {0x045E, 0x02FF, "Xbox One Controller", 1, 0},
+    {0x045E, 0x0719, "Xbox 360 Wireless Receiver", 1, 0},
+    {0x045E, 0x0B00, "Xbox Elite Controller Series 2", 1, 0},
+    {0x045E, 0x0B05, "Xbox Elite Controller Series 2", 1, 0},
+    {0x045E, 0x0B0A, "Xbox Adaptive Controller", 1, 0},
+    {0x045E, 0x0B12, "Xbox Series X Controller", 1, 0},
+    {0x045E, 0x0B13, "Xbox Series X Controller", 1, 0},
+    {0x045E, 0x0B20, "Xbox Series X Controller", 1, 0},
+    {0x045E, 0x0B21, "Xbox Adaptive Controller", 1, 0},
+    {0x045E, 0x0B22, "Xbox Elite Controller Series 2", 1, 0},
+    
+    // ==================== Sony PlayStation 系列 ====================
+    {0x054C, 0x0268, "PlayStation 3 Controller", 2, 49},
+    {0x054C, 0x042F, "PlayStation Move Controller", 2, 0},
+    {0x054C, 0x05C4, "DualShock 4", 2, 64},
+    {0x054C, 0x05C5, "DualShock 4 Wireless Dongle", 2, 64},
+    {0x054C, 0x09CC, "DualShock 4 v2", 2, 64},
+    {0x054C, 0x0BA0, "DualShock 4 Wireless Dongle", 2, 64},
+    {0x054C, 0x0CE6, "DualSense Controller", 2, 78},
+    {0x054C, 0x0DF2, "DualSense Edge Controller", 2, 78},
+    {0x054C, 0x0E5F, "PS5 Access Controller", 2, 78},
+    {0x054C, 0xDA0C, "PlayStation Classic Controller", 2, 0},
+    
+    // ==================== Nintendo 系列 ====================
+    {0x057E, 0x0306, "Wii Remote", 3, 0},
+    {0x057E, 0x0330, "Wii U Pro Controller", 3, 0},
+    {0x057E, 0x0337, "Wii U GameCube Adapter", 3, 0},
+    {0x057E, 0x2006, "Joy-Con (L)", 3, 49},
+    {0x057E, 0x2007, "Joy-Con (R)", 3, 49},
+    {0x057E, 0x2009, "Switch Pro Controller", 3, 64},
+    {0x057E, 0x200E, "Joy-Con Charging Grip", 3, 49},
+    {0x057E, 0x2017, "SNES Controller", 3, 0},
+    {0x057E, 0x2019, "Nintendo 64 Controller", 3, 0},
+    {0x057E, 0x201A, "Nintendo Switch Online GameCube", 3, 0},
+    {0x057E, 0x201E, "Nintendo Switch 2 Pro Controller", 3, 0},
+    {0x057E, 0x2020, "Nintendo Switch Online Famicom", 3, 0},
+    
+    // ==================== 8BitDo ====================
+    {0x2DC8, 0x0651, "8BitDo M30", 1, 0},
+    {0x2DC8, 0x0652, "8BitDo M30 Bluetooth", 1, 0},
+    {0x2DC8, 0x1003, "8BitDo NES30 Pro", 1, 0},
+    {0x2DC8, 0x2100, "8BitDo SN30 Pro", 1, 0},
+    {0x2DC8, 0x2101, "8BitDo SN30 Pro", 1, 0},
+    {0x2DC8, 0x2180, "8BitDo Pro 2", 1, 0},
+    {0x2DC8, 0x3010, "8BitDo Ultimate 2.4G", 1, 0},
+    {0x2DC8, 0x3011, "8BitDo Ultimate 2.4G", 1, 0},
+    {0x2DC8, 0x3104, "8BitDo Ultimate", 1, 0},
+    {0x2DC8, 0x3105, "8BitDo Ultimate Wireless", 1, 0},
+    {0x2DC8, 0x3106, "8BitDo Ultimate 2C", 1, 0},
+    {0x2DC8, 0x5001, "8BitDo Zero 2", 1, 0},
+    {0x2DC8, 0x6001, "8BitDo SN30 Pro+", 1, 0},
+    {0x2DC8, 0x6002, "8BitDo SN30 Pro+ 2", 1, 0},
+    {0x2DC8, 0x6006, "8BitDo Pro 2", 1, 0},
+    {0x2DC8, 0x9015, "8BitDo Pro 2 Wired", 1, 0},
+    
+    // ==================== Logitech ====================
+    {0x046D, 0xC216, "Logitech Dual Action", 1, 0},
+    {0x046D, 0xC218, "Logitech RumblePad 2", 1, 0},
+    {0x046D, 0xC219, "Logitech F710 Wireless", 1, 0},
+    {0x046D, 0xC21A, "Logitech Precision", 1, 0},
+    {0x046D, 0xC21D, "Logitech F310", 1, 0},
+    {0x046D, 0xC21E, "Logitech F510", 1, 0},
+    {0x046D, 0xC21F, "Logitech F710", 1, 0},
+    {0x046D, 0xC242, "Logitech ChillStream", 1, 0},
+    {0x046D, 0xC248, "Logitech G Xbox Controller", 1, 0},
+    {0x046D, 0xCABB, "Logitech G Xbox Controller", 1, 0},
+    
+    // ==================== Razer ====================
+    {0x1532, 0x0037, "Razer Sabertooth", 1, 0},
+    {0x1532, 0x0705, "Razer Junglecat", 1, 0},
+    {0x1532, 0x0900, "Razer Serval", 1, 0},
+    {0x1532, 0x0A00, "Razer Raiju", 2, 64},
+    {0x1532, 0x0A03, "Razer Wildcat", 1, 0},
+    {0x1532, 0x0A14, "Razer Raiju Ultimate", 2, 64},
+    {0x1532, 0x0A15, "Razer Raiju Tournament", 2, 64},
+    {0x1532, 0x1000, "Razer Raiju Mobile", 1, 0},
+    {0x1532, 0x1004, "Razer Kishi", 1, 0},
+    {0x1532, 0x1008, "Razer Kishi V2", 1, 0},
+    {0x1532, 0x1100, "Razer Wolverine", 1, 0},
+    {0x1532, 0x1007, "Razer Wolverine V2", 1, 0},
+    {0x1532, 0x100A, "Razer Wolverine V2 Chroma", 1, 0},
+    
+    // ==================== HORI ====================
+    {0x0F0D, 0x0004, "Hori Fighting Stick 3", 2, 0},
+    {0x0F0D, 0x000A, "Hori Fighting Stick EX2", 1, 0},
+    {0x0F0D, 0x000D, "Hori Fighting Stick EX2", 1, 0},
+    {0x0F0D, 0x0011, "Hori Real Arcade Pro 3", 2, 0},
+    {0x0F0D, 0x0016, "Hori Real Arcade Pro EX", 1, 0},
+    {0x0F0D, 0x001B, "Hori Real Arcade Pro VX", 1, 0},
+    {0x0F0D, 0x0022, "Hori Real Arcade Pro V3", 2, 0},
+    {0x0F0D, 0x005B, "Hori Fight Stick Alpha", 1, 0},
+    {0x0F0D, 0x005C, "Hori Fighting Stick Mini 4", 2, 64},
+    {0x0F0D, 0x005E, "Hori Fighting Commander 4", 2, 64},
+    {0x0F0D, 0x0063, "Hori Fighting Commander", 1, 0},
+    {0x0F0D, 0x0066, "Horipad 4 FPS", 2, 64},
+    {0x0F0D, 0x0067, "Horipad One", 1, 0},
+    {0x0F0D, 0x0078, "Hori Real Arcade Pro V Kai", 1, 0},
+    {0x0F0D, 0x0084, "Hori Fighting Commander", 2, 64},
+    {0x0F0D, 0x0085, "Hori Fighting Stick V5", 1, 0},
+    {0x0F0D, 0x0087, "Hori Fighting Stick Mini", 2, 64},
+    {0x0F0D, 0x008A, "Hori Real Arcade Pro VLX", 1, 0},
+    {0x0F0D, 0x008B, "Hori Fighting Stick Mini", 1, 0},
+    {0x0F0D, 0x00A0, "Hori TAC Pro", 2, 64},
+    {0x0F0D, 0x00AA, "Hori Split Pad Pro", 3, 0},
+    {0x0F0D, 0x00C1, "Horipad for Nintendo Switch", 3, 0},
+    {0x0F0D, 0x00C6, "Hori Horipad for Steam", 1, 0},
+    {0x0F0D, 0x00DC, "Hori Fighting Commander OCTA", 2, 64},
+    {0x0F0D, 0x00EE, "Hori Split Pad Compact", 3, 0},
+    {0x0F0D, 0x00F6, "Horipad Pro for Xbox", 1, 0},
+    
+    // ==================== PowerA ====================
+    {0x20D6, 0x2001, "PowerA Xbox One Controller", 1, 0},
+    {0x20D6, 0x2002, "PowerA Nintendo Switch Controller", 3, 0},
+    {0x20D6, 0x2006, "PowerA Nano Enhanced", 3, 0},
+    {0x20D6, 0x2009, "PowerA Enhanced Wireless", 3, 0},
+    {0x20D6, 0x200D, "PowerA Spectra Infinity", 1, 0},
+    {0x20D6, 0x280D, "PowerA Nano Enhanced", 3, 0},
+    {0x20D6, 0x89E5, "PowerA Xbox One Controller", 1, 0},
+    {0x20D6, 0xA711, "PowerA Xbox Series X Controller", 1, 0},
+    {0x20D6, 0xA713, "PowerA Xbox Series X Controller", 1, 0},
+    {0x20D6, 0xA720, "PowerA Xbox Series X Controller", 1, 0},
+    
+    // ==================== PDP ====================
+    {0x0E6F, 0x0113, "PDP Afterglow AX.1", 1, 0},
+    {0x0E6F, 0x011F, "PDP Rock Candy Wired", 1, 0},
+    {0x0E6F, 0x0139, "PDP Afterglow Prismatic", 1, 0},
+    {0x0E6F, 0x013A, "PDP Xbox One Controller", 1, 0},
+    {0x0E6F, 0x0146, "PDP Xbox One Controller", 1, 0},
+    {0x0E6F, 0x0147, "PDP Xbox One Controller", 1, 0},
+    {0x0E6F, 0x0161, "PDP Xbox One Controller", 1, 0},
+    {0x0E6F, 0x0162, "PDP Xbox One Controller", 1, 0},
+    {0x0E6F, 0x0163, "PDP Xbox One Controller", 1, 0},
+    {0x0E6F, 0x0164, "PDP Battlefield One", 1, 0},
+    {0x0E6F, 0x0201, "PDP PS3 Controller", 2, 0},
+    {0x0E6F, 0x0203, "PDP Mortal Kombat X", 1, 0},
+    {0x0E6F, 0x0213, "PDP Afterglow", 1, 0},
+    {0x0E6F, 0x021F, "PDP Rock Candy", 1, 0},
+    {0x0E6F, 0x02A1, "PDP Realmz", 3, 0},
+    {0x0E6F, 0x02A4, "PDP Afterglow", 3, 0},
+    {0x0E6F, 0x02A5, "PDP Faceoff Deluxe", 3, 0},
+    {0x0E6F, 0x02AB, "PDP Faceoff Pro", 3, 0},
+    
+    // ==================== Mad Catz ====================
+    {0x0738, 0x4716, "MadCatz Xbox 360 Controller", 1, 0},
+    {0x0738, 0x4718, "MadCatz Street Fighter IV FightStick SE", 1, 0},
+    {0x0738, 0x4726, "MadCatz Xbox 360 Controller", 1, 0},
+    {0x0738, 0x4728, "MadCatz Street Fighter IV FightPad", 1, 0},
+    {0x0738, 0x4736, "MadCatz MicroCon", 1, 0},
+    {0x0738, 0x4740, "MadCatz Beat Pad", 1, 0},
+    {0x0738, 0x9871, "MadCatz PS4 Fightstick", 2, 64},
+    {0x0738, 0xB726, "MadCatz Xbox One Controller", 1, 0},
+    {0x0738, 0xCB02, "MadCatz Saitek Cyborg Rumble Pad", 1, 0},
+    {0x0738, 0xCB03, "MadCatz Saitek P3200 Rumble Pad", 1, 0},
+    
+    // ==================== SteelSeries ====================
+    {0x1038, 0x1412, "SteelSeries Free", 1, 0},
+    {0x1038, 0x1420, "SteelSeries Stratus XL", 1, 0},
+    {0x1038, 0x1430, "SteelSeries Stratus XL", 1, 0},
+    {0x1038, 0x1431, "SteelSeries Stratus XL", 1, 0},
+    {0x1038, 0x1432, "SteelSeries Stratus Duo", 1, 0},
+    {0x1038, 0x1434, "SteelSeries Nimbus", 1, 0},
+    
+    // ==================== GameSir ====================
+    {0x05AC, 0x055D, "GameSir G3s", 1, 0},
+    {0x05AC, 0x3D03, "GameSir T4", 1, 0},
+    {0x3537, 0x0411, "GameSir X4A", 1, 0},
+    
+    // ==================== Thrustmaster ====================
+    {0x044F, 0xB315, "Thrustmaster Dual Analog 3.2", 1, 0},
+    {0x044F, 0xB323, "Thrustmaster Dual Trigger 3-in-1", 1, 0},
+    {0x044F, 0xB326, "Thrustmaster Gamepad GP XID", 1, 0},
+    {0x044F, 0xD003, "Thrustmaster eSwap PRO", 2, 64},
+    {0x044F, 0xD008, "Thrustmaster eSwap X PRO", 1, 0},
+    {0x044F, 0xD00D, "Thrustmaster eSwap S", 1, 0},
+    
+    // ==================== Nacon / BigBen ====================
+    {0x11C0, 0x4001, "Nacon Revolution Pro", 2, 64},
+    {0x11C0, 0x4003, "Nacon Revolution Pro 2", 2, 64},
+    {0x11C0, 0x4006, "Nacon Daija Arcade Stick", 2, 64},
+    {0x11C0, 0x5510, "Nacon MG-X Pro", 1, 0},
+    {0x11C0, 0x5611, "Nacon RIG Pro Compact", 1, 0},
+    {0x146B, 0x0603, "BigBen Interactive PS3 Controller", 2, 0},
+    {0x146B, 0x0604, "BigBen Interactive PS3 Controller", 2, 0},
+    {0x146B, 0x0D01, "BigBen Interactive PS4 Controller", 2, 64},
+    {0x146B, 0x0D02, "BigBen Interactive Nacon Controller", 2, 64},
+    
+    // ==================== Qanba ====================
+    {0x2C22, 0x2000, "Qanba Drone", 2, 64},
+    {0x2C22, 0x2200, "Qanba Drone", 2, 64},
+    {0x2C22, 0x2300, "Qanba Obsidian", 2, 64},
+    {0x2C22, 0x2500, "Qanba Dragon", 2, 64},
+    {0x2C22, 0x2502, "Qanba Arcade Joystick", 2, 64},
+    
+    // ==================== GuliKit ====================
+    {0x3820, 0x0009, "GuliKit KingKong Pro", 3, 0},
+    {0x3820, 0x0060, "GuliKit Route Controller Pro", 3, 0},
+    {0x3820, 0x2110, "GuliKit KingKong 2 Pro", 3, 0},
+    
+    // ==================== Betop ====================
+    {0x20BC, 0x5500, "Beitong S2", 1, 0},
+    
+    // ==================== DragonRise / Generic ====================
+    {0x0079, 0x0006, "DragonRise Gamepad", 0, 0},
+    {0x0079, 0x0011, "DragonRise Gamepad", 0, 0},
+    {0x0079, 0x0018, "Mayflash GameCube Adapter", 0, 0},
+    {0x0079, 0x1843, "DragonRise Gamepad", 0, 0},
+    {0x0583, 0x2060, "Trust GXT 540", 0, 0},
+    {0x0583, 0xA009, "Trust GXT 570", 0, 0},
+    {0x0810, 0xE501, "Generic Gamepad", 0, 0},
+    {0x0E8F, 0x0003, "GreenAsia Joystick", 0, 0},
+    {0x0E8F, 0x0012, "GreenAsia Joystick", 0, 0},
+    {0x0E8F, 0x3010, "GreenAsia PS2 Adapter", 0, 0},
+    {0x0E8F, 0x3013, "GreenAsia PS2 Adapter", 0, 0},
+    {0x11C9, 0x55F0, "Nacon GC-100XF", 0, 0},
+    {0x12BD, 0xD012, "2 In 1 Joystick", 0, 0},
+    {0x1345, 0x6006, "RetroFlag Gamepad", 0, 0},
+    {0x1949, 0x0402, "AmazonBasics Controller", 1, 0},
+    {0x1BAD, 0xF016, "MadCatz Xbox 360 Controller", 1, 0},
+    {0x1BAD, 0xF018, "MadCatz Xbox 360 FightPad", 1, 0},
+    {0x1BAD, 0xF019, "MadCatz Brawlstick", 1, 0},
+    {0x1BAD, 0xF501, "MadCatz Xbox 360 Controller", 1, 0},
+    {0x1BAD, 0xF502, "MadCatz Xbox 360 Controller", 1, 0},
+    {0x24C6, 0x5000, "Razer Atrox", 1, 0},
+    {0x24C6, 0x5300, "PowerA Mini Pro EX", 1, 0},
+    {0x24C6, 0x5303, "Xbox Airflo Wired", 1, 0},
+    {0x24C6, 0x530A, "Xbox Rock Candy", 1, 0},
+    {0x24C6, 0x5500, "HORI Fighting Commander", 1, 0},
+    {0x24C6, 0x5501, "HORI Fighting Stick VX", 1, 0},
+    {0x24C6, 0x5502, "HORI Fighting Stick EX2", 1, 0},
+    {0x24C6, 0x5503, "HORI Fighting Edge", 1, 0},
+    {0x24C6, 0x550D, "HORI Fighting Commander", 1, 0},
+    {0x24C6, 0x550E, "HORI Real Arcade Pro V Kai", 1, 0},
+    {0x24C6, 0x5510, "HORI Fighting Commander ONE", 1, 0},
+    {0x24C6, 0x5B00, "Thrustmaster GPX", 1, 0},
+    {0x24C6, 0x5B02, "Thrustmaster GPX Controller", 1, 0},
+    {0x24C6, 0x5B03, "Thrustmaster Ferrari 458", 1, 0},
+    {0x24C6, 0xFAFE, "Rock Candy Xbox 360", 1, 0},
+    
+    // ==================== Backbone ====================
+    {0x358A, 0x0002, "Backbone One", 1, 0},
+    {0x358A, 0x0003, "Backbone One PlayStation", 2, 64},
+    {0x358A, 0x0004, "Backbone One", 1, 0},
+    
+    // ==================== Moga ====================
+    {0xC624, 0x2A89, "Moga XP5-X Plus", 1, 0},
+    {0xC624, 0x2B89, "Moga XP5-X Plus", 1, 0},
+    {0xC624, 0x1A89, "Moga XP5-X Plus", 1, 0},
+    {0xC624, 0x1B89, "Moga XP5-X Plus", 1, 0},
+    
+    // ==================== SCUF / Victrix ====================
+    {0x0C12, 0x0EF6, "Hitbox Arcade", 2, 64},
+    {0x0C12, 0x1CF6, "Victrix Pro FS", 2, 64},
+    {0x0C12, 0x0E1C, "SCUF Impact", 2, 64},
+    {0x0C12, 0x0E15, "SCUF Infinity4PS Pro", 2, 64},
+    
+    // ==================== AYN / Handheld ====================
+    {0x2F24, 0x0082, "AYN Odin", 1, 0},
+    {0x2F24, 0x0086, "AYN Odin 2", 1, 0},
+    {0x2F24, 0x008D, "AYN Odin2 Mini", 1, 0},
+    {0x3285, 0x0E1D, "GPD Win Controller", 1, 0},
+    {0x3285, 0x0E20, "GPD Win Controller", 1, 0},
+    
+    // ==================== Gamesir / Flydigi ====================
+    {0x3575, 0x0620, "GameSir Nova", 1, 0},
+    {0x3575, 0x0621, "GameSir Nova", 1, 0},
+    
+    // ==================== 通用 USB 手柄 ====================
+    // 注意: VID 0x413D 不在数据库中，需要用户测试后添加正确的报告格式
+    {0x045E, 0x0026, "SideWinder GamePad Pro", 0, 0},
+    {0x045E, 0x0027, "SideWinder", 0, 0},
+    {0x1A34, 0x0802, "Generic Xbox Gamepad", 1, 0},
+    {0x1A34, 0x0836, "Generic Xbox Gamepad", 1, 0},
+    {0x2563, 0x0575, "Generic Switch Controller", 3, 0},
+    {0x2563, 0x0526, "Generic Switch Controller", 3, 0},
+    {0x0001, 0x0001, "Generic USB Gamepad", 0, 0},  // 超通用回退
+    
+    // 结束标记
+    {0, 0, NULL, 0, 0}
+};
+
+inline const ControllerDbV1::VendorFallbackV1 ControllerDbV1::kVendorFallbacks[] = {
+    {0x045E, "Microsoft", 1},           // Xbox
+    {0x054C, "Sony", 2},                // PlayStation
+    {0x057E, "Nintendo", 3},            // Switch
+    {0x2DC8, "8BitDo", 1},              // Usually Xbox mode
+    {0x046D, "Logitech", 1},            // XInput mode
+    {0x1532, "Razer", 1},               // Usually Xbox
+    {0x0F0D, "HORI", 1},                // Varies
+    {0x20D6, "PowerA", 1},              // Xbox/Switch
+    {0x0E6F, "PDP", 1},                 // Xbox
+    {0x0738, "MadCatz", 1},             // Xbox
+    {0x1038, "SteelSeries", 1},         // Xbox
+    {0x044F, "Thrustmaster", 1},        // Xbox
+    {0x11C0, "Nacon", 2},               // PlayStation
+    {0x146B, "BigBen", 2},              // PlayStation
+    {0x2C22, "Qanba", 2},               // PlayStation
+    {0x3820, "GuliKit", 3},             // Switch
+    // 注意: 0x413D 不在回退表中，需要用户提供正确的 HID 报告格式
+    {0x0079, "DragonRise", 0},          // Generic
+    {0x0810, "Generic", 0},             // Generic
+    {0x0001, "Generic", 0},             // Generic
+    {0, NULL, 0}
+};
@@ -0,0 +1,616 @@
+// Frozen baseline for nativelib/bench — do not edit.
+// Earlier SpectralOnsetDetector (real-input FFT with a radix-4 first pass and radix-2 passes),
+// renamed to SpectralOnsetDetectorRadix4 so it can be linked next to the current detector.
+
+/*
+ * Moonlight for HarmonyOS / Android
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * Self-contained spectral flux onset detector — zero external dependencies.
+ *
+ * Implements the same algorithm pipeline as aubio's onset detection:
+ *   PCM → Phase Vocoder (STFT) → Adaptive Whitening → Log Compression
+ *       → Spectral Flux → Peak Picker → Silence Gate → MinIOI → onset
+ *
+ * Key algorithms (all implemented from first principles):
+ *   - Real-input FFT: N real samples packed into an N/2-point complex FFT
+ *     (radix-4 first pass + radix-2 passes, per-stage contiguous twiddles)
+ *     followed by a split/unpack step — half the work of a full complex FFT
+ *   - Hann window fused into the bit-reversal load
+ *   - Half-wave rectified spectral flux
+ *   - Per-bin exponential peak-tracking whitening
+ *   - Logarithmic magnitude compression (branch-free log1p approximation)
+ *   - Sliding-window median + mean adaptive threshold peak picker
+ *   - Minimum inter-onset interval enforcement
+ *
+ * Performance layout:
+ *   - Structure-of-arrays (separate real / imaginary / magnitude arrays),
+ *     64-byte aligned, so the per-bin loops are straight-line and
+ *     auto-vectorize to NEON / SSE without intrinsics.
+ *   - No zero-phase rotation: a circular shift by N/2 only multiplies X[k]
+ *     by (-1)^k, which the magnitude spectrum discards.
+ *   - New samples are written straight into the analysis window tail
+ *     (no separate hop accumulation buffer).
+ *
+ * Thread model: called on the audio analysis thread alongside
+ *               BassEnergyAnalyzer, no locking required.
+ *
+ * Memory: ~62KB inline state (zero heap allocation).
+ *
+ * This is a clean-room implementation referencing the published academic
+ * algorithms (spectral flux, adaptive whitening) — no aubio code is used.
+ *
+ * References:
+ *   [1] Bello et al., "A Tutorial on Onset Detection in Music Signals",
+ *       IEEE Trans. Speech and Audio Processing, 2005.
+ *   [2] Böck & Widmer, "Maximum Filter Vibrato Suppression for Onset
+ *       Detection", DAFx-13, 2013.
+ *   [3] Dixon, "Onset Detection Revisited", DAFx-06, 2006.
+ *   [4] Sorensen et al., "Real-Valued Fast Fourier Transform Algorithms",
+ *       IEEE Trans. ASSP, 1987.
+ */
+
+#ifndef BENCH_BASELINE_SPECTRAL_ONSET_DETECTOR_RADIX4_H
+#define BENCH_BASELINE_SPECTRAL_ONSET_DETECTOR_RADIX4_H
+
+#include <cstdint>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+class SpectralOnsetDetectorRadix4 {
+public:
+    // Maximum supported FFT size (2048 → supports hop sizes up to 512)
+    static constexpr int MAX_FFT_SIZE = 2048;
+    static constexpr int MAX_SPECTRUM_SIZE = MAX_FFT_SIZE / 2 + 1;
+    // Real FFT runs as a half-size complex FFT
+    static constexpr int MAX_HALF_SIZE = MAX_FFT_SIZE / 2;
+
+    // Peak picker sliding window (7 frames: 1 pre + 1 current + 5 post)
+    // Matches aubio's win_pre=1, win_post=5 for specflux
+    static constexpr int PICKER_WIN_SIZE = 7;
+    static constexpr int PICKER_WIN_PRE = 1;
+    static constexpr int PICKER_WIN_POST = 5;
+    // We need a delay buffer of PICKER_WIN_POST frames to detect local maxima
+    static constexpr int PICKER_DELAY = PICKER_WIN_POST;
+
+    SpectralOnsetDetectorRadix4() = default;
+    ~SpectralOnsetDetectorRadix4() { /* no heap alloc */ }
+
+    // Disallow copy
+    SpectralOnsetDetectorRadix4(const SpectralOnsetDetectorRadix4&) = delete;
+    SpectralOnsetDetectorRadix4& operator=(const SpectralOnsetDetectorRadix4&) = delete;
+
+    /**
+     * Initialize the onset detector.
+     *
+     * @param sampleRate  Sample rate (typically 48000)
+     * @param hopSize     Samples per hop (typically 240 for 5ms Opus frames)
+     * @param method      Detection method (kept for API compat, always specflux)
+     * @return true on success
+     */
+    bool Init(int sampleRate, int hopSize, const char* method = "specflux") {
+        (void)method; // always specflux
+
+        sampleRate_ = sampleRate;
+        hopSize_ = static_cast<unsigned int>(hopSize);
+
+        // FFT size: next power of 2 >= 4 × hopSize (standard for good resolution)
+        fftSize_ = 1;
+        while (fftSize_ < hopSize_ * 4) {
+            fftSize_ *= 2;
+        }
+        if (fftSize_ > static_cast<unsigned int>(MAX_FFT_SIZE)) {
+            fftSize_ = static_cast<unsigned int>(MAX_FFT_SIZE);
+        }
+        if (fftSize_ < 8) {
+            fftSize_ = 8;
+        }
+        if (hopSize_ > fftSize_) {
+            hopSize_ = fftSize_;
+        }
+
+        halfSize_ = fftSize_ / 2;
+        spectrumSize_ = fftSize_ / 2 + 1;
+
+        // Precompute Hann window (zero-endpoint variant, "hanningz")
+        for (unsigned int i = 0; i < fftSize_; i++) {
+            window_[i] = 0.5f * (1.0f - std::cos(2.0f * static_cast<float>(M_PI) * i / fftSize_));
+        }
+
+        // Bit-reversal permutation for the half-size complex FFT
+        unsigned int bits = 0;
+        while ((1u << bits) < halfSize_) {
+            bits++;
+        }
+        for (unsigned int i = 0; i < halfSize_; i++) {
+            unsigned int r = 0;
+            for (unsigned int b = 0; b < bits; b++) {
+                r |= ((i >> b) & 1u) << (bits - 1 - b);
+            }
+            bitRev_[i] = static_cast<uint16_t>(r);
+        }
+
+        // Per-stage contiguous twiddles for the radix-2 passes (span ≥ 8):
+        // stage with half-span h stores w_j = e^{-2πi·j/(2h)}, j < h, at offset h.
+        for (unsigned int h = 1; h < halfSize_; h <<= 1) {
+            for (unsigned int j = 0; j < h; j++) {
+                double angle = -M_PI * j / h;
+                stageTwRe_[h + j] = static_cast<float>(std::cos(angle));
+                stageTwIm_[h + j] = static_cast<float>(std::sin(angle));
+            }
+        }
+
+        // Real-FFT split twiddles: W_N^k = e^{-2πi·k/N}, k ≤ N/2
+        for (unsigned int k = 0; k <= halfSize_; k++) {
+            double angle = -2.0 * M_PI * k / fftSize_;
+            splitTwRe_[k] = static_cast<float>(std::cos(angle));
+            splitTwIm_[k] = static_cast<float>(std::sin(angle));
+        }
+
+        // Configuration defaults (matching aubio specflux tuning)
+        threshold_ = 0.3f;              // peak-picking threshold
+        silenceThresholdDb_ = -70.0f;    // silence gate (dB)
+        silenceThresholdLin_ = std::pow(10.0f, silenceThresholdDb_ / 20.0f);
+
+        // Minimum inter-onset interval: 80ms (≈12.5 onsets/sec max)
+        minIntervalSamples_ = static_cast<int>(0.08f * sampleRate);
+
+        // Adaptive whitening: exponential peak decay
+        // r_decay = 0.001^(hop/sr / relax_time)
+        // relax_time = 100s (specflux default), floor = 1.0
+        double hopDuration = static_cast<double>(hopSize_) / sampleRate_;
+        whiteningDecay_ = static_cast<float>(std::pow(0.001, hopDuration / 100.0));
+        whiteningFloor_ = 1.0f;
+        whiteningEnabled_ = true;
+
+        // Log compression: log(1 + λ·x), λ = 1.0
+        compressionLambda_ = 1.0f;
+
+        Reset();
+        initialized_ = true;
+        return true;
+    }
+
+    void Destroy() {
+        initialized_ = false;
+        Reset();
+    }
+
+    void Reset() {
+        accumPos_ = 0;
+        std::memset(analysisBuf_, 0, sizeof(float) * fftSize_);
+        std::memset(prevSpectrum_, 0, sizeof(float) * spectrumSize_);
+        std::memset(whiteningPeaks_, 0, sizeof(float) * spectrumSize_);
+
+        // Peak picker state
+        std::memset(pickerRing_, 0, sizeof(pickerRing_));
+        pickerRingPos_ = 0;
+        pickerFrameCount_ = 0;
+
+        framesSinceLastOnset_ = minIntervalSamples_; // allow first onset immediately
+        lastDescriptor_ = 0.0f;
+        lastThreshDescriptor_ = 0.0f;
+        firstFrame_ = true;
+    }
+
+    /**
+     * Process one frame of PCM data (int16, interleaved multi-channel).
+     *
+     * Internally accumulates samples until a full hop, then runs STFT +
+     * spectral flux + peak picker.
+     *
+     * @param pcmData           Interleaved int16 PCM data
+     * @param perChannelSamples Samples per channel in this frame
+     * @param channelCount      Number of channels
+     * @param outOnsetDetected  Output: true if onset detected
+     * @return true if processing succeeded
+     */
+    bool ProcessFrame(const int16_t* pcmData, int perChannelSamples,
+                      int channelCount, bool& outOnsetDetected) {
+        if (!initialized_ || !pcmData) {
+            outOnsetDetected = false;
+            return false;
+        }
+
+        outOnsetDetected = false;
+
+        // New hop samples land directly in the tail of the analysis window
+        float* tail = analysisBuf_ + (fftSize_ - hopSize_);
+        const float scale = 1.0f / (32768.0f * channelCount);
+
+        int i = 0;
+        while (i < perChannelSamples) {
+            // Convert as many samples as fit into the current hop in one run
+            int run = std::min(perChannelSamples - i, static_cast<int>(hopSize_) - accumPos_);
+            const int16_t* src = pcmData + i * channelCount;
+            float* dst = tail + accumPos_;
+            if (channelCount == 2) {
+                for (int s = 0; s < run; s++) {
+                    dst[s] = (static_cast<float>(src[2 * s]) + static_cast<float>(src[2 * s + 1])) * scale;
+                }
+            } else {
+                for (int s = 0; s < run; s++) {
+                    float mono = 0.0f;
+                    for (int ch = 0; ch < channelCount; ch++) {
+                        mono += static_cast<float>(src[s * channelCount + ch]);
+                    }
+                    dst[s] = mono * scale;
+                }
+            }
+            accumPos_ += run;
+            i += run;
+
+            // Full hop accumulated → run analysis, then slide the window
+            if (accumPos_ >= static_cast<int>(hopSize_)) {
+                bool onset = processHop();
+                if (onset) outOnsetDetected = true;
+                accumPos_ = 0;
+                if (fftSize_ > hopSize_) {
+                    std::memmove(analysisBuf_,
+                                 analysisBuf_ + hopSize_,
+                                 (fftSize_ - hopSize_) * sizeof(float));
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Get the raw spectral flux descriptor from the last hop.
+     */
+    float GetDescriptor() const { return lastDescriptor_; }
+
+    /**
+     * Get the thresholded descriptor (flux - adaptive_threshold).
+     * Positive values indicate onset candidates.
+     */
+    float GetThresholdedDescriptor() const { return lastThreshDescriptor_; }
+
+    /**
+     * Set the peak-picking threshold (default 0.3).
+     * Lower → more sensitive (more onsets), higher → fewer onsets.
+     */
+    void SetThreshold(float threshold) { threshold_ = threshold; }
+
+    /**
+     * Set minimum inter-onset interval in milliseconds (default 80ms).
+     */
+    void SetMinInterval(float ms) {
+        minIntervalSamples_ = static_cast<int>(ms / 1000.0f * sampleRate_);
+    }
+
+    bool IsInitialized() const { return initialized_; }
+
+private:
+    // ====================================================================
+    //  Core Processing: STFT → Spectral Flux → Peak Picker
+    // ====================================================================
+
+    bool processHop() {
+        // ---- 1. Windowed real FFT → SoA spectrum (re_, im_) ----
+        realFft();
+
+        // ---- 2. Magnitude spectrum + level (vectorizable) ----
+        float* __restrict mag = mag_;
+        const float* __restrict re = re_;
+        const float* __restrict im = im_;
+        float energySum = 0.0f;
+        for (unsigned int i = 0; i < spectrumSize_; i++) {
+            float m = std::sqrt(re[i] * re[i] + im[i] * im[i]);
+            mag[i] = m;
+            energySum += m;
+        }
+
+        // ---- 3. Silence gate ----
+        // Use mean magnitude as a proxy for level
+        float meanMag = energySum / spectrumSize_;
+        if (meanMag < silenceThresholdLin_) {
+            // Frame is silent — update state but don't produce onset
+            std::memcpy(prevSpectrum_, mag, sizeof(float) * spectrumSize_);
+            framesSinceLastOnset_ += hopSize_;
+            feedPicker(0.0f);
+            firstFrame_ = false;
+            return false;
+        }
+
+        // ---- 4. Adaptive Whitening ----
+        // Per-bin exponential peak tracking: norm each bin by its peak.
+        // peak[i] = max(current[i], decay * prev_peak[i], floor)
+        // whitened[i] = norm[i] / peak[i]
+        if (whiteningEnabled_) {
+            float* __restrict peaks = whiteningPeaks_;
+            const float decay = whiteningDecay_;
+            const float floorVal = whiteningFloor_;
+            for (unsigned int i = 0; i < spectrumSize_; i++) {
+                float p = std::max(mag[i], std::max(decay * peaks[i], floorVal));
+                peaks[i] = p;
+                mag[i] = mag[i] / p;
+            }
+        }
+
+        // ---- 5. Log compression: log(1 + λ·x) ----
+        if (compressionLambda_ > 0.0f) {
+            const float lambda = compressionLambda_;
+            for (unsigned int i = 0; i < spectrumSize_; i++) {
+                mag[i] = fastLog1p(lambda * mag[i]);
+            }
+        }
+
+        // ---- 6. Spectral Flux (half-wave rectified) ----
+        // Only accumulate positive differences (energy increases)
+        float flux = 0.0f;
+        if (!firstFrame_) {
+            const float* __restrict prev = prevSpectrum_;
+            for (unsigned int i = 0; i < spectrumSize_; i++) {
+                flux += std::max(mag[i] - prev[i], 0.0f);
+            }
+        }
+
+        // Save current spectrum for next frame
+        std::memcpy(prevSpectrum_, mag, sizeof(float) * spectrumSize_);
+        lastDescriptor_ = flux;
+
+        // ---- 7. Peak Picker (adaptive threshold + local max) ----
+        bool isOnset = false;
+        if (!firstFrame_) {
+            isOnset = feedPicker(flux);
+        }
+
+        firstFrame_ = false;
+        framesSinceLastOnset_ += hopSize_;
+
+        return isOnset;
+    }
+
+    // ====================================================================
+    //  Peak Picker: sliding window, median+mean adaptive threshold
+    // ====================================================================
+    //
+    //  Algorithm (following Bello et al. & Dixon):
+    //    1. Maintain a ring buffer of the last PICKER_WIN_SIZE flux values.
+    //    2. For frame at position [PICKER_WIN_PRE], check if it's a local max
+    //       within the window AND exceeds the adaptive threshold.
+    //    3. Adaptive threshold = median(window) + mean(window) × threshold_
+    //    4. Enforce minimum inter-onset interval.
+    //
+    //  This introduces PICKER_WIN_POST frames of latency (~25ms @48kHz/240hop),
+    //  acceptable for haptic feedback.
+
+    bool feedPicker(float value) {
+        // Push new value into ring buffer
+        pickerRing_[pickerRingPos_] = value;
+        pickerRingPos_ = (pickerRingPos_ + 1) % PICKER_WIN_SIZE;
+        pickerFrameCount_++;
+
+        // Need at least a full window of frames before we can pick
+        if (pickerFrameCount_ < PICKER_WIN_SIZE) {
+            return false;
+        }
+
+        // The candidate frame is PICKER_WIN_POST frames ago
+        // (so we have enough "future" frames to check local max)
+        int candidateIdx = (pickerRingPos_ - 1 - PICKER_WIN_POST + PICKER_WIN_SIZE)
+                           % PICKER_WIN_SIZE;
+        float candidateVal = pickerRing_[candidateIdx];
+
+        // ---- Local maximum check ----
+        // Candidate must be >= all values in the window
+        bool isLocalMax = true;
+        for (int i = 0; i < PICKER_WIN_SIZE; i++) {
+            if (i != candidateIdx && pickerRing_[i] > candidateVal) {
+                isLocalMax = false;
+                break;
+            }
+        }
+
+        if (!isLocalMax) {
+            lastThreshDescriptor_ = 0.0f;
+            return false;
+        }
+
+        // ---- Adaptive threshold: median + mean × threshold_ ----
+        float sorted[PICKER_WIN_SIZE];
+        float sum = 0.0f;
+        for (int i = 0; i < PICKER_WIN_SIZE; i++) {
+            sorted[i] = pickerRing_[i];
+            sum += pickerRing_[i];
+        }
+        std::nth_element(sorted, sorted + PICKER_WIN_SIZE / 2, sorted + PICKER_WIN_SIZE);
+        float median = sorted[PICKER_WIN_SIZE / 2];
+        float mean = sum / PICKER_WIN_SIZE;
+        float adaptiveThresh = median + mean * threshold_;
+
+        float thresholded = candidateVal - adaptiveThresh;
+        lastThreshDescriptor_ = thresholded;
+
+        // ---- Threshold check + MinIOI ----
+        if (thresholded > 0.0f && framesSinceLastOnset_ >= minIntervalSamples_) {
+            framesSinceLastOnset_ = 0;
+            return true;
+        }
+
+        return false;
+    }
+
+    // ====================================================================
+    //  Real-input FFT (N real → N/2+1 complex bins)
+    // ====================================================================
+    //
+    //  1. Pack windowed x[2n] + i·x[2n+1] into z[n] (bit-reversed order),
+    //     M = N/2 complex points.
+    //  2. In-place DIT complex FFT of size M: one radix-4 pass (trivial
+    //     twiddles ±1, ±i) then radix-2 passes with per-stage contiguous
+    //     twiddle tables so the inner loop is unit-stride.
+    //  3. Split: X[k] = (Z[k] + Z*[M-k])/2 − i·W_N^k·(Z[k] − Z*[M-k])/2.
+
+    void realFft() {
+        const unsigned int m = halfSize_;
+        float* __restrict zr = zRe_;
+        float* __restrict zi = zIm_;
+
+        // ---- 1. Window + pack + bit-reverse ----
+        for (unsigned int n = 0; n < m; n++) {
+            unsigned int d = bitRev_[n];
+            zr[d] = analysisBuf_[2 * n] * window_[2 * n];
+            zi[d] = analysisBuf_[2 * n + 1] * window_[2 * n + 1];
+        }
+
+        // ---- 2a. Radix-4 first pass (spans 1 and 2 fused) ----
+        for (unsigned int g = 0; g < m; g += 4) {
+            float ar = zr[g],     ai = zi[g];
+            float br = zr[g + 1], bi = zi[g + 1];
+            float cr = zr[g + 2], ci = zi[g + 2];
+            float dr = zr[g + 3], di = zi[g + 3];
+
+            // span 1 butterflies (twiddle = 1)
+            float s0r = ar + br, s0i = ai + bi;
+            float d0r = ar - br, d0i = ai - bi;
+            float s1r = cr + dr, s1i = ci + di;
+            float d1r = cr - dr, d1i = ci - di;
+
+            // span 2 butterflies (twiddles 1 and -i)
+            zr[g]     = s0r + s1r; zi[g]     = s0i + s1i;
+            zr[g + 2] = s0r - s1r; zi[g + 2] = s0i - s1i;
+            // (d1r + i·d1i)·(-i) = d1i − i·d1r
+            zr[g + 1] = d0r + d1i; zi[g + 1] = d0i - d1r;
+            zr[g + 3] = d0r - d1i; zi[g + 3] = d0i + d1r;
+        }
+
+        // ---- 2b. Radix-2 passes, half-span 4 … M/2 ----
+        for (unsigned int h = 4; h < m; h <<= 1) {
+            const float* __restrict wr = stageTwRe_ + h;
+            const float* __restrict wi = stageTwIm_ + h;
+            for (unsigned int g = 0; g < m; g += 2 * h) {
+                float* __restrict ar = zr + g;
+                float* __restrict ai = zi + g;
+                float* __restrict br = zr + g + h;
+                float* __restrict bi = zi + g + h;
+                for (unsigned int j = 0; j < h; j++) {
+                    float tr = wr[j] * br[j] - wi[j] * bi[j];
+                    float ti = wr[j] * bi[j] + wi[j] * br[j];
+                    br[j] = ar[j] - tr;
+                    bi[j] = ai[j] - ti;
+                    ar[j] = ar[j] + tr;
+                    ai[j] = ai[j] + ti;
+                }
+            }
+        }
+
+        // ---- 3. Split into the real-signal spectrum ----
+        float* __restrict xr = re_;
+        float* __restrict xi = im_;
+        xr[0] = zr[0] + zi[0];
+        xi[0] = 0.0f;
+        xr[m] = zr[0] - zi[0];
+        xi[m] = 0.0f;
+        for (unsigned int k = 1; k < m; k++) {
+            float ar = zr[k],     ai = zi[k];
+            float br = zr[m - k], bi = -zi[m - k];   // conj(Z[M-k])
+
+            float er = 0.5f * (ar + br), ei = 0.5f * (ai + bi);   // even part
+            float orr = 0.5f * (ai - bi), oi = -0.5f * (ar - br); // odd part (−i·diff/2)
+
+            float wr = splitTwRe_[k], wi = splitTwIm_[k];
+            xr[k] = er + (wr * orr - wi * oi);
+            xi[k] = ei + (wr * oi + wi * orr);
+        }
+    }
+
+    /**
+     * log(1 + x) for x ≥ 0 without libm calls or branches, so the per-bin
+     * loop vectorizes. Exponent/mantissa split + atanh series on the
+     * mantissa; absolute error < 2e-6 over the whitened range.
+     */
+    static inline float fastLog1p(float x) {
+        float y = 1.0f + x;
+        int32_t bits;
+        std::memcpy(&bits, &y, sizeof(bits));
+        float e = static_cast<float>((bits >> 23) - 127);
+        bits = (bits & 0x007FFFFF) | 0x3F800000;
+        float mant;
+        std::memcpy(&mant, &bits, sizeof(mant));
+        // log(m) = 2·atanh((m−1)/(m+1)), m ∈ [1, 2) → t ∈ [0, 1/3)
+        float t = (mant - 1.0f) / (mant + 1.0f);
+        float t2 = t * t;
+        float poly = 1.0f + t2 * (1.0f / 3.0f + t2 * (1.0f / 5.0f + t2 * (1.0f / 7.0f + t2 * (1.0f / 9.0f))));
+        return e * 0.69314718f + 2.0f * t * poly;
+    }
+
+    // ====================================================================
+    //  State
+    // ====================================================================
+
+    // Configuration
+    int sampleRate_ = 48000;
+    unsigned int hopSize_ = 240;
+    unsigned int fftSize_ = 1024;
+    unsigned int halfSize_ = 512;
+    unsigned int spectrumSize_ = 513;
+
+    // Thresholds
+    float threshold_ = 0.3f;           // Peak picker sensitivity
+    float silenceThresholdDb_ = -70.0f; // Silence gate (dB)
+    float silenceThresholdLin_ = 0.0f;  // Silence gate (linear)
+    int minIntervalSamples_ = 3840;     // Min inter-onset interval (samples)
+
+    // Whitening
+    bool whiteningEnabled_ = true;
+    float whiteningDecay_ = 0.0f;       // Per-hop exponential decay
+    float whiteningFloor_ = 1.0f;       // Minimum peak value
+
+    // Log compression
+    float compressionLambda_ = 1.0f;    // log(1 + λ·x) coefficient
+
+    // Hann window (precomputed)
+    alignas(64) float window_[MAX_FFT_SIZE] = {};
+
+    // Analysis buffer (overlap-save: holds last fftSize samples,
+    // incoming hop samples are written into its tail)
+    alignas(64) float analysisBuf_[MAX_FFT_SIZE] = {};
+    int accumPos_ = 0;
+
+    // Half-size complex FFT scratch (SoA)
+    alignas(64) float zRe_[MAX_HALF_SIZE] = {};
+    alignas(64) float zIm_[MAX_HALF_SIZE] = {};
+
+    // Real-signal spectrum (SoA) + magnitude
+    alignas(64) float re_[MAX_SPECTRUM_SIZE] = {};
+    alignas(64) float im_[MAX_SPECTRUM_SIZE] = {};
+    alignas(64) float mag_[MAX_SPECTRUM_SIZE] = {};
+
+    // Previous frame compressed magnitude (for spectral flux)
+    alignas(64) float prevSpectrum_[MAX_SPECTRUM_SIZE] = {};
+
+    // Whitening: per-bin peak tracking
+    alignas(64) float whiteningPeaks_[MAX_SPECTRUM_SIZE] = {};
+
+    // Twiddles: per-stage contiguous (radix-2 passes) and real-FFT split
+    alignas(64) float stageTwRe_[MAX_HALF_SIZE] = {};
+    alignas(64) float stageTwIm_[MAX_HALF_SIZE] = {};
+    alignas(64) float splitTwRe_[MAX_HALF_SIZE + 1] = {};
+    alignas(64) float splitTwIm_[MAX_HALF_SIZE + 1] = {};
+
+    // Bit-reversal permutation for the half-size FFT
+    uint16_t bitRev_[MAX_HALF_SIZE] = {};
+
+    // Peak picker ring buffer
+    float pickerRing_[PICKER_WIN_SIZE] = {};
+    int pickerRingPos_ = 0;
+    int pickerFrameCount_ = 0;
+
+    // Onset tracking
+    int framesSinceLastOnset_ = 0;
+    float lastDescriptor_ = 0.0f;          // Raw spectral flux
+    float lastThreshDescriptor_ = 0.0f;    // After threshold subtraction
+
+    bool firstFrame_ = true;
+    bool initialized_ = false;
+};
+
+#endif // BENCH_BASELINE_SPECTRAL_ONSET_DETECTOR_RADIX4_H
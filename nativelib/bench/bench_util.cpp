@@ -0,0 +1,249 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file bench_util.cpp
+ * @brief 基准测试公共设施实现（含全局 operator new 计数替换）
+ */
+
+#include "bench_util.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// =============================================================================
+// 堆分配计数：替换全局 operator new，所有基准目标以 OBJECT 库形式链接本文件
+// =============================================================================
+
+static std::atomic<uint64_t> g_allocCount{0};
+
+void* operator new(std::size_t size) {
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    void* p = std::malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](std::size_t size) {
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    void* p = std::malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+namespace bench {
+
+uint64_t AllocCount() {
+    return g_allocCount.load(std::memory_order_relaxed);
+}
+
+// =============================================================================
+// 统计
+// =============================================================================
+
+static double PercentileSorted(const std::vector<uint64_t>& sorted, double p) {
+    if (sorted.empty()) return 0;
+    size_t rank = static_cast<size_t>(std::ceil(p * static_cast<double>(sorted.size())));
+    if (rank < 1) rank = 1;
+    if (rank > sorted.size()) rank = sorted.size();
+    return static_cast<double>(sorted[rank - 1]);
+}
+
+Stats Summarize(std::vector<uint64_t>& samples) {
+    Stats stats;
+    if (samples.empty()) return stats;
+    std::sort(samples.begin(), samples.end());
+    double sum = 0;
+    for (uint64_t v : samples) sum += static_cast<double>(v);
+    stats.count = samples.size();
+    stats.mean = sum / static_cast<double>(samples.size());
+    stats.min = static_cast<double>(samples.front());
+    stats.p50 = PercentileSorted(samples, 0.50);
+    stats.p99 = PercentileSorted(samples, 0.99);
+    stats.p999 = PercentileSorted(samples, 0.999);
+    stats.max = static_cast<double>(samples.back());
+    return stats;
+}
+
+// =============================================================================
+// JSON
+// =============================================================================
+
+static std::string Quote(const std::string& s) {
+    std::string out = "\"";
+    for (char c : s) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buf[8];
+                    snprintf(buf, sizeof(buf), "\\u%04x", c);
+                    out += buf;
+                } else {
+                    out += c;
+                }
+        }
+    }
+    out += "\"";
+    return out;
+}
+
+static std::string Number(double value) {
+    if (!std::isfinite(value)) return "null";
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.6g", value);
+    return buf;
+}
+
+Record& Record::Set(const std::string& key, const std::string& value) {
+    fields_.emplace_back(key, Quote(value));
+    return *this;
+}
+
+Record& Record::Set(const std::string& key, const char* value) {
+    return Set(key, std::string(value));
+}
+
+Record& Record::Set(const std::string& key, double value) {
+    fields_.emplace_back(key, Number(value));
+    return *this;
+}
+
+Record& Record::Set(const std::string& key, int64_t value) {
+    fields_.emplace_back(key, std::to_string(value));
+    return *this;
+}
+
+Record& Record::Set(const std::string& key, uint64_t value) {
+    fields_.emplace_back(key, std::to_string(value));
+    return *this;
+}
+
+Record& Record::Set(const std::string& key, bool value) {
+    fields_.emplace_back(key, value ? "true" : "false");
+    return *this;
+}
+
+Record& Record::Set(const std::string& key, const Stats& stats) {
+    Record nested;
+    nested.Set("count", stats.count)
+          .Set("mean", stats.mean)
+          .Set("min", stats.min)
+          .Set("p50", stats.p50)
+          .Set("p99", stats.p99)
+          .Set("p999", stats.p999)
+          .Set("max", stats.max);
+    return Set(key, nested);
+}
+
+Record& Record::Set(const std::string& key, const Record& nested) {
+    fields_.emplace_back(key, nested.ToJson());
+    return *this;
+}
+
+std::string Record::ToJson() const {
+    std::string out = "{";
+    for (size_t i = 0; i < fields_.size(); i++) {
+        if (i > 0) out += ", ";
+        out += Quote(fields_[i].first);
+        out += ": ";
+        out += fields_[i].second;
+    }
+    out += "}";
+    return out;
+}
+
+// =============================================================================
+// Report
+// =============================================================================
+
+Report::Report(const char* benchName, int argc, char** argv, bool acceptsInputs) : name_(benchName) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--quick") == 0) {
+            quick_ = true;
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            outPath_ = argv[++i];
+        } else if (acceptsInputs && argv[i][0] != '-') {
+            inputs_.push_back(argv[i]);
+        } else {
+            fprintf(stderr, "usage: %s [--quick] [--out result.json]%s\n", argv[0],
+                    acceptsInputs ? " [input ...]" : "");
+            exit(2);
+        }
+    }
+}
+
+Record& Report::Add() {
+    records_.emplace_back();
+    return records_.back();
+}
+
+bool Report::Check(bool condition, const std::string& what) {
+    if (!condition) {
+        failures_.push_back(what);
+        fprintf(stderr, "[%s] CHECK FAILED: %s\n", name_.c_str(), what.c_str());
+    }
+    return condition;
+}
+
+int Report::Finish() {
+    std::string out = "{\n  \"bench\": " + Quote(name_) + ",\n  \"quick\": " + (quick_ ? "true" : "false")
+        + ",\n  \"results\": [";
+    for (size_t i = 0; i < records_.size(); i++) {
+        out += i > 0 ? ",\n    " : "\n    ";
+        out += records_[i].ToJson();
+    }
+    out += records_.empty() ? "],\n  \"failures\": [" : "\n  ],\n  \"failures\": [";
+    for (size_t i = 0; i < failures_.size(); i++) {
+        if (i > 0) out += ", ";
+        out += Quote(failures_[i]);
+    }
+    out += "]\n}\n";
+
+    if (outPath_.empty()) {
+        fputs(out.c_str(), stdout);
+    } else {
+        FILE* f = fopen(outPath_.c_str(), "w");
+        if (!f) {
+            fprintf(stderr, "[%s] cannot write %s\n", name_.c_str(), outPath_.c_str());
+            return 1;
+        }
+        fputs(out.c_str(), f);
+        fclose(f);
+    }
+    return failures_.empty() ? 0 : 1;
+}
+
+} // namespace bench
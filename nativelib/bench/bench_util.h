@@ -0,0 +1,161 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file bench_util.h
+ * @brief 主机基准测试公共设施：计时、分位数统计、堆分配计数、JSON 输出
+ *
+ * 每个基准程序输出一个 JSON 对象：
+ *   { "bench": 名称, "quick": bool, "results": [ {...}, ... ], "failures": [ ... ] }
+ * 结果写到 stdout，或 --out <path> 指定的文件。--quick 缩短迭代次数（ctest 使用）。
+ * 正确性检查失败时进程返回非 0，因此 ctest 同时充当回归测试。
+ */
+
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench {
+
+inline uint64_t NowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * 进程启动以来的堆分配次数（operator new / new[]，含 libstdc++ 内部分配）
+ * 在计时循环前后各取一次，差值即热路径分配数。
+ */
+uint64_t AllocCount();
+
+/**
+ * 阻止编译器把基准循环的结果优化掉
+ */
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * 样本分位数统计（单位与输入一致，通常为 ns）
+ */
+struct Stats {
+    uint64_t count = 0;
+    double mean = 0;
+    double min = 0;
+    double p50 = 0;
+    double p99 = 0;
+    double p999 = 0;
+    double max = 0;
+};
+
+/**
+ * 汇总样本（会对 samples 排序）
+ */
+Stats Summarize(std::vector<uint64_t>& samples);
+
+/**
+ * 重复运行 fn 共 rounds 轮，每轮 iterations 次，返回每次调用的 ns（按轮取平均后统计）
+ * 适合单次耗时接近计时器分辨率的微基准。
+ */
+template <typename Fn>
+Stats MeasurePerCall(int rounds, int iterations, Fn&& fn) {
+    std::vector<uint64_t> samples;
+    samples.reserve(rounds);
+    for (int r = 0; r < rounds; r++) {
+        uint64_t start = NowNs();
+        for (int i = 0; i < iterations; i++) {
+            fn(i);
+        }
+        uint64_t elapsed = NowNs() - start;
+        // 保留 1/1000 ns 精度：样本以 ps 记录，汇总后换算回 ns
+        samples.push_back(elapsed * 1000 / static_cast<uint64_t>(iterations));
+    }
+    Stats stats = Summarize(samples);
+    stats.mean /= 1000.0;
+    stats.min /= 1000.0;
+    stats.p50 /= 1000.0;
+    stats.p99 /= 1000.0;
+    stats.p999 /= 1000.0;
+    stats.max /= 1000.0;
+    return stats;
+}
+
+/**
+ * 一条 JSON 结果记录（字段按插入顺序输出）
+ */
+class Record {
+public:
+    Record& Set(const std::string& key, const std::string& value);
+    Record& Set(const std::string& key, const char* value);
+    Record& Set(const std::string& key, double value);
+    Record& Set(const std::string& key, int64_t value);
+    Record& Set(const std::string& key, uint64_t value);
+    Record& Set(const std::string& key, int value) { return Set(key, static_cast<int64_t>(value)); }
+    Record& Set(const std::string& key, bool value);
+    Record& Set(const std::string& key, const Stats& stats);
+    Record& Set(const std::string& key, const Record& nested);
+
+    std::string ToJson() const;
+
+private:
+    std::vector<std::pair<std::string, std::string>> fields_;
+};
+
+/**
+ * 命令行选项与结果汇总
+ */
+class Report {
+public:
+    /**
+     * 解析 --quick / --out <path>；未知参数打印用法并退出
+     * @param acceptsInputs 是否接受位置参数（输入文件路径），见 Inputs()
+     */
+    Report(const char* benchName, int argc, char** argv, bool acceptsInputs = false);
+
+    bool Quick() const { return quick_; }
+
+    const std::vector<std::string>& Inputs() const { return inputs_; }
+
+    /**
+     * quick 模式下返回 quickValue，否则返回 fullValue
+     */
+    int Scale(int fullValue, int quickValue) const { return quick_ ? quickValue : fullValue; }
+
+    Record& Add();
+
+    /**
+     * 正确性检查；失败记录到 failures 并使最终返回值非 0
+     */
+    bool Check(bool condition, const std::string& what);
+
+    /**
+     * 写出 JSON
+     * @return 进程退出码（有检查失败时为 1）
+     */
+    int Finish();
+
+private:
+    std::string name_;
+    std::string outPath_;
+    bool quick_ = false;
+    std::vector<std::string> inputs_;
+    std::vector<Record> records_;
+    std::vector<std::string> failures_;
+};
+
+} // namespace bench
+
+#endif // BENCH_UTIL_H
@@ -0,0 +1,130 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file bench_util.js
+ * @brief bench_util.h 的 Node.js 版本：供驱动 bridge_bench_addon 的 JS 基准使用
+ *
+ * 命令行：node <driver>.js <bridge_bench_addon.node> [--quick] [--out result.json]
+ * 输出的 JSON 结构、Stats 字段与分位数算法与 C++ 版本一致；检查失败时进程返回 1。
+ */
+
+'use strict';
+
+const fs = require('fs');
+
+function nowNs() {
+  return process.hrtime.bigint();
+}
+
+/**
+ * 样本分位数统计（会对 samples 排序），与 bench::Summarize 相同的 nearest-rank 分位数
+ */
+function summarize(samples) {
+  const stats = { count: samples.length, mean: 0, min: 0, p50: 0, p99: 0, p999: 0, max: 0 };
+  if (samples.length === 0) return stats;
+  samples.sort((a, b) => a - b);
+  const rank = (p) => samples[Math.min(samples.length, Math.max(1, Math.ceil(p * samples.length))) - 1];
+  stats.mean = samples.reduce((sum, v) => sum + v, 0) / samples.length;
+  stats.min = samples[0];
+  stats.p50 = rank(0.50);
+  stats.p99 = rank(0.99);
+  stats.p999 = rank(0.999);
+  stats.max = samples[samples.length - 1];
+  return stats;
+}
+
+/**
+ * 重复运行 fn 共 rounds 轮，每轮 iterations 次，返回每次调用的 ns（按轮取平均后统计）
+ */
+function measurePerCall(rounds, iterations, fn) {
+  const samples = [];
+  for (let r = 0; r < rounds; r++) {
+    const start = nowNs();
+    for (let i = 0; i < iterations; i++) {
+      fn(i);
+    }
+    samples.push(Number(nowNs() - start) / iterations);
+  }
+  return summarize(samples);
+}
+
+class Report {
+  /**
+   * 解析 <addon> --quick / --out <path>；未知参数打印用法并退出
+   */
+  constructor(name, argv) {
+    this.name = name;
+    this.quick = false;
+    this.outPath = '';
+    this.addonPath = '';
+    this.records = [];
+    this.failures = [];
+    for (let i = 0; i < argv.length; i++) {
+      if (argv[i] === '--quick') {
+        this.quick = true;
+      } else if (argv[i] === '--out' && i + 1 < argv.length) {
+        this.outPath = argv[++i];
+      } else if (!this.addonPath && !argv[i].startsWith('-')) {
+        this.addonPath = argv[i];
+      } else {
+        this.usage();
+      }
+    }
+    if (!this.addonPath) this.usage();
+  }
+
+  usage() {
+    process.stderr.write(`usage: node ${process.argv[1]} <bridge_bench_addon.node> [--quick] [--out result.json]\n`);
+    process.exit(2);
+  }
+
+  /** 加载被测插件 */
+  loadAddon() {
+    return require(require('path').resolve(this.addonPath));
+  }
+
+  /** quick 模式下返回 quickValue，否则返回 fullValue */
+  scale(fullValue, quickValue) {
+    return this.quick ? quickValue : fullValue;
+  }
+
+  add(record) {
+    this.records.push(record);
+    return record;
+  }
+
+  /** 正确性检查；失败记录到 failures 并使最终返回值非 0 */
+  check(condition, what) {
+    if (!condition) {
+      this.failures.push(what);
+      process.stderr.write(`[${this.name}] CHECK FAILED: ${what}\n`);
+    }
+    return condition;
+  }
+
+  finish() {
+    const roundTo = (key, value) => (typeof value === 'number' && !Number.isInteger(value)
+      ? Number(value.toPrecision(6)) : value);
+    const out = '{\n  "bench": ' + JSON.stringify(this.name) + ',\n  "quick": ' + this.quick +
+      ',\n  "results": [' +
+      this.records.map((r, i) => (i > 0 ? ',\n    ' : '\n    ') + JSON.stringify(r, roundTo)).join('') +
+      (this.records.length > 0 ? '\n  ],\n  "failures": [' : '],\n  "failures": [') +
+      this.failures.map((f) => JSON.stringify(f)).join(', ') + ']\n}\n';
+    if (this.outPath) {
+      fs.writeFileSync(this.outPath, out);
+    } else {
+      process.stdout.write(out);
+    }
+    process.exitCode = this.failures.length === 0 ? 0 : 1;
+  }
+}
+
+module.exports = { nowNs, summarize, measurePerCall, Report };
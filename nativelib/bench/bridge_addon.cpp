@@ -0,0 +1,66 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file bridge_addon.cpp
+ * @brief 把 moonlight_bridge.cpp 中的 NAPI 函数注册为 Node.js 插件（bridge_bench_addon.node）
+ *
+ * ArkTS NAPI 与 Node-API 的 C 接口一致，函数体原样编译；导出名与 napi_init.cpp 相同，
+ * JS 驱动（*_bench.js）按 ArkTS 侧的调用方式使用。
+ * 额外导出 stubStats() / stubReset(hashArguments) 读取、清零 bridge_stubs.cpp 的发送端统计。
+ */
+
+#include "bridge_stubs.h"
+#include "moonlight_bridge.h"
+
+namespace {
+
+napi_value StubStats(napi_env env, napi_callback_info info) {
+    BridgeStubStats stats = BridgeStub_GetStats();
+    napi_value result, calls, hash;
+    napi_create_object(env, &result);
+    napi_create_double(env, static_cast<double>(stats.calls), &calls);
+    napi_create_uint32(env, stats.hash, &hash);
+    napi_set_named_property(env, result, "calls", calls);
+    napi_set_named_property(env, result, "hash", hash);
+    return result;
+}
+
+napi_value StubReset(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    bool hashArguments = true;
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    if (argc >= 1) {
+        napi_get_value_bool(env, args[0], &hashArguments);
+    }
+    BridgeStub_Reset(hashArguments);
+    return nullptr;
+}
+
+} // namespace
+
+NAPI_MODULE_INIT() {
+    napi_property_descriptor desc[] = {
+        { "sendMouseMove", nullptr, MoonBridge_SendMouseMove, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "sendMultiControllerInput", nullptr, MoonBridge_SendMultiControllerInput, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "sendTouchEvent", nullptr, MoonBridge_SendTouchEvent, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "sendPenEvent", nullptr, MoonBridge_SendPenEvent, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "submitInputBatch", nullptr, MoonBridge_SubmitInputBatch, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "opusEncoderCreate", nullptr, MoonBridge_OpusEncoderCreate, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "opusEncoderEncode", nullptr, MoonBridge_OpusEncoderEncode, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "opusEncoderEncodeBatch", nullptr, MoonBridge_OpusEncoderEncodeBatch, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "opusEncoderDestroy", nullptr, MoonBridge_OpusEncoderDestroy, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "stubStats", nullptr, StubStats, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "stubReset", nullptr, StubReset, nullptr, nullptr, nullptr, napi_default, nullptr },
+    };
+    napi_define_properties(env, exports, sizeof(desc) / sizeof(desc[0]), desc);
+    return exports;
+}
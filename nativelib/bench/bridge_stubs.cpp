@@ -0,0 +1,141 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file bridge_stubs.cpp
+ * @brief bridge_bench_addon 链接所需的替身实现
+ *
+ * 1. LiSend*：moonlight_bridge.cpp 与 input_scheduler.cpp 实际引用的发送函数，
+ *    计数并哈希实参后返回 0（InputScheduler 未启动时直接调用这些函数）。
+ * 2. DeviceMotion_SendControllerState：体感助手默认关闭时的行为（不修改右摇杆，直接交给 InputScheduler）。
+ * 3. 其余被保留代码间接引用、但基准不会执行的符号。
+ */
+
+#include "bridge_stubs.h"
+
+#include "moonlight-common-c/src/Limelight.h"
+#include "device_motion.h"
+#include "input_scheduler.h"
+#include "mic_capturer.h"
+
+#include <cstring>
+
+namespace {
+
+BridgeStubStats g_stats = {0, 2166136261u};
+bool g_hashArguments = true;
+
+void Mix(const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++) {
+        g_stats.hash = (g_stats.hash ^ bytes[i]) * 16777619u;
+    }
+}
+
+// 按形参类型逐个混入，float 取位模式，与调用路径无关
+template <typename... Args>
+int Record(uint8_t function, Args... args) {
+    g_stats.calls++;
+    if (!g_hashArguments) {
+        return 0;
+    }
+    Mix(&function, sizeof(function));
+    int unused[] = {0, (Mix(&args, sizeof(args)), 0)...};
+    (void)unused;
+    return 0;
+}
+
+} // namespace
+
+BridgeStubStats BridgeStub_GetStats() {
+    return g_stats;
+}
+
+void BridgeStub_Reset(bool hashArguments) {
+    g_stats = {0, 2166136261u};
+    g_hashArguments = hashArguments;
+}
+
+// ---- moonlight-common-c 发送端 ----
+
+int LiSendMouseMoveEvent(short deltaX, short deltaY) {
+    return Record(1, deltaX, deltaY);
+}
+
+int LiSendMousePositionEvent(short x, short y, short referenceWidth, short referenceHeight) {
+    return Record(2, x, y, referenceWidth, referenceHeight);
+}
+
+int LiSendMouseMoveAsMousePositionEvent(short deltaX, short deltaY, short referenceWidth, short referenceHeight) {
+    return Record(3, deltaX, deltaY, referenceWidth, referenceHeight);
+}
+
+int LiSendMouseButtonEvent(char action, int button) {
+    return Record(4, action, button);
+}
+
+int LiSendHighResScrollEvent(short scrollAmount) {
+    return Record(5, scrollAmount);
+}
+
+int LiSendHighResHScrollEvent(short scrollAmount) {
+    return Record(6, scrollAmount);
+}
+
+int LiSendKeyboardEvent2(short keyCode, char keyAction, char modifiers, char flags) {
+    return Record(7, keyCode, keyAction, modifiers, flags);
+}
+
+int LiSendMultiControllerEvent(short controllerNumber, short activeGamepadMask, int buttonFlags,
+                               unsigned char leftTrigger, unsigned char rightTrigger,
+                               short leftStickX, short leftStickY, short rightStickX, short rightStickY) {
+    return Record(8, controllerNumber, activeGamepadMask, buttonFlags, leftTrigger, rightTrigger,
+                  leftStickX, leftStickY, rightStickX, rightStickY);
+}
+
+int LiSendControllerTouchEvent(uint8_t controllerNumber, uint8_t eventType, uint32_t pointerId,
+                               float x, float y, float pressure) {
+    return Record(9, controllerNumber, eventType, pointerId, x, y, pressure);
+}
+
+int LiSendControllerMotionEvent(uint8_t controllerNumber, uint8_t motionType, float x, float y, float z) {
+    return Record(10, controllerNumber, motionType, x, y, z);
+}
+
+int LiSendControllerBatteryEvent(uint8_t controllerNumber, uint8_t batteryState, uint8_t batteryPercentage) {
+    return Record(11, controllerNumber, batteryState, batteryPercentage);
+}
+
+int LiSendTouchEvent(uint8_t eventType, uint32_t pointerId, float x, float y, float pressureOrDistance,
+                     float contactAreaMajor, float contactAreaMinor, uint16_t rotation) {
+    return Record(12, eventType, pointerId, x, y, pressureOrDistance, contactAreaMajor, contactAreaMinor, rotation);
+}
+
+int LiSendPenEvent(uint8_t eventType, uint8_t toolType, uint8_t penButtons, float x, float y,
+                   float pressureOrDistance, float contactAreaMajor, float contactAreaMinor,
+                   uint16_t rotation, uint8_t tilt) {
+    return Record(13, eventType, toolType, penButtons, x, y, pressureOrDistance,
+                  contactAreaMajor, contactAreaMinor, rotation, tilt);
+}
+
+// ---- 体感助手：默认关闭 ----
+
+int DeviceMotion_SendControllerState(short controllerNumber, short activeGamepadMask, int buttonFlags,
+                                     unsigned char leftTrigger, unsigned char rightTrigger,
+                                     short leftStickX, short leftStickY, short *rightStickX, short *rightStickY) {
+    return InputScheduler_SendControllerState(controllerNumber, activeGamepadMask, buttonFlags,
+                                              leftTrigger, rightTrigger,
+                                              leftStickX, leftStickY, *rightStickX, *rightStickY);
+}
+
+// ---- 麦克风：g_micCapturer 的静态析构引用，基准不创建采集器 ----
+
+MicCapturer::~MicCapturer() {
+}
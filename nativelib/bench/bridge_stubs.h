@@ -0,0 +1,38 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file bridge_stubs.h
+ * @brief bridge_bench_addon 的发送端替身统计
+ *
+ * moonlight-common-c 的 LiSend* 由 bridge_stubs.cpp 替代：不联网，只累计调用次数，
+ * 并把每次调用的函数编号与实参字节滚入 FNV-1a 哈希。同一事件序列分别经逐个 send*
+ * 与 submitInputBatch 发送后哈希相同，即两条路径交给协议层的参数逐位一致。
+ * 哈希按字节计算，计时阶段应关闭，避免替身本身的开销掩盖被测差异。
+ */
+
+#ifndef BENCH_BRIDGE_STUBS_H
+#define BENCH_BRIDGE_STUBS_H
+
+#include <cstdint>
+
+struct BridgeStubStats {
+    uint64_t calls;
+    uint32_t hash;
+};
+
+BridgeStubStats BridgeStub_GetStats();
+/**
+ * 清零统计
+ * @param hashArguments 是否对后续调用的实参做哈希
+ */
+void BridgeStub_Reset(bool hashArguments);
+
+#endif // BENCH_BRIDGE_STUBS_H
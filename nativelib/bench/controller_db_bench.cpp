@@ -0,0 +1,273 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file controller_db_bench.cpp
+ * @brief 手柄 VID/PID 查找：生成的完美哈希（controller_db_generated.h）对比旧版懒解析 + 线性扫描
+ *        （baseline/controller_db_v1.h）
+ *
+ * 1. 一致性：SDL 数据库中每个 VID/PID、精选映射、已知手柄表、厂商回退表以及 3000 个随机未收录键，
+ *    两种实现的命中结果必须相同；SDL 映射逐项比较映射源（类型 / 序号 / HAT 掩码 / 反转 / 范围）与名称。
+ * 2. 首次查找（冷）：每次先刷掉缓存；旧版包含解析全部 SDL 字符串，新版只是一次哈希查找。
+ *    同时记录首次查找的堆分配次数与常驻堆字节数。
+ * 3. 热查找：SDL 映射命中、未收录、已知手柄命中、按厂商推断类型（PID 未知）。
+ */
+
+#include "bench_util.h"
+
+#include "baseline/controller_db_v1.h"
+#include "sdl_gamecontrollerdb.h"
+
+#include <cstring>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr size_t kKeyCount = 256;   // 热查找轮流使用的键数（2 的幂）
+
+struct Lcg {
+    uint32_t state;
+    explicit Lcg(uint32_t seed) : state(seed) {}
+    uint32_t Next() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    }
+};
+
+uint32_t Key(uint16_t vendorId, uint16_t productId) {
+    return (static_cast<uint32_t>(vendorId) << 16) | productId;
+}
+
+uint16_t Vid(uint32_t key) { return static_cast<uint16_t>(key >> 16); }
+uint16_t Pid(uint32_t key) { return static_cast<uint16_t>(key); }
+
+/**
+ * 读一遍远大于末级缓存的缓冲区，让下一次查找从内存取表
+ */
+void FlushCaches() {
+    static std::vector<uint8_t> buffer(64u << 20, 1);
+    uint64_t sum = 0;
+    for (size_t i = 0; i < buffer.size(); i += 64) sum += buffer[i];
+    bench::DoNotOptimize(sum);
+}
+
+// 未映射项只比较类型：旧解析器 memset 为 0，生成表用 NONE 宏（rangeMax = 255），两者都不会被读取
+bool SameSource(const MappingSourceV1& v1, const MappingSource& cur) {
+    if (v1.type == MAPPING_NONE || cur.type == MAPPING_NONE) return v1.type == cur.type;
+    return v1.type == cur.type && v1.index == cur.index && v1.hatMask == cur.hatMask
+        && v1.inverted == cur.inverted && v1.rangeMin == cur.rangeMin && v1.rangeMax == cur.rangeMax;
+}
+
+bool SameMapping(const GamepadMappingV1& v1, const GamepadMapping& cur) {
+    const MappingSourceV1* a[] = {
+        &v1.a, &v1.b, &v1.x, &v1.y, &v1.back, &v1.guide, &v1.start, &v1.leftstick, &v1.rightstick,
+        &v1.leftshoulder, &v1.rightshoulder, &v1.dpup, &v1.dpdown, &v1.dpleft, &v1.dpright,
+        &v1.leftx, &v1.lefty, &v1.rightx, &v1.righty, &v1.lefttrigger, &v1.righttrigger,
+    };
+    const MappingSource* b[] = {
+        &cur.a, &cur.b, &cur.x, &cur.y, &cur.back, &cur.guide, &cur.start, &cur.leftstick, &cur.rightstick,
+        &cur.leftshoulder, &cur.rightshoulder, &cur.dpup, &cur.dpdown, &cur.dpleft, &cur.dpright,
+        &cur.leftx, &cur.lefty, &cur.rightx, &cur.righty, &cur.lefttrigger, &cur.righttrigger,
+    };
+    for (size_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        if (!SameSource(*a[i], *b[i])) return false;
+    }
+    return v1.name && cur.name && strcmp(v1.name, cur.name) == 0
+        && v1.reportOffset == cur.reportOffset && v1.reportLength == cur.reportLength;
+}
+
+bool CurrentKnown(uint16_t vendorId, uint16_t productId, int* index) {
+    const ControllerDbEntry* e = findControllerDbDevice(vendorId, productId);
+    *index = (e && e->knownIndex >= 0) ? e->knownIndex : -1;
+    return *index >= 0;
+}
+
+// gamepad_napi.cpp getGamepadType 的查找部分：先精确匹配，再查厂商回退
+int CurrentTypeLookup(uint16_t vendorId, uint16_t productId) {
+    const ControllerDbEntry* e = findControllerDbDevice(vendorId, productId);
+    if (e && e->knownIndex >= 0) return e->knownIndex;
+    e = findControllerDbVendor(vendorId);
+    return (e && e->knownIndex >= 0) ? 1000 + e->knownIndex : -1;
+}
+
+struct KeySets {
+    std::vector<uint32_t> sdlHit;       // 只在 SDL 数据库中的键（旧版需扫完精选表再扫向量）
+    std::vector<uint32_t> miss;
+    std::vector<uint32_t> knownHit;
+    std::vector<uint32_t> vendorOnly;   // 厂商已知、PID 未收录
+};
+
+/**
+ * 一致性检查，同时收集热查找用的键
+ */
+KeySets Verify(bench::Report& report, ControllerDbV1& v1) {
+    KeySets keys;
+    std::set<uint32_t> seen;
+    uint64_t sdlKeys = 0, sdlMismatches = 0;
+    v1.FindGamepadMapping(0, 0);     // 触发懒解析
+    for (size_t i = 0; i < v1.SdlMappingCount(); i++) {
+        const GamepadMappingV1& m = v1.SdlMapping(i);
+        if (!seen.insert(Key(m.vendorId, m.productId)).second) continue;     // 重复键：首条生效
+        sdlKeys++;
+        const GamepadMappingV1* old = v1.FindGamepadMapping(m.vendorId, m.productId);
+        const GamepadMapping* cur = findGamepadMapping(m.vendorId, m.productId);
+        if (old == &m) {
+            sdlMismatches += !cur || !SameMapping(m, *cur);
+            keys.sdlHit.push_back(Key(m.vendorId, m.productId));
+        } else {
+            // 被精选映射遮蔽：两边都应返回精选条目
+            sdlMismatches += !old || !cur || strcmp(old->name, cur->name) != 0;
+        }
+    }
+
+    uint64_t knownMismatches = 0;
+    for (int i = 0; ControllerDbV1::kKnownGamepads[i].name != NULL; i++) {
+        const ControllerDbV1::KnownGamepadV1& g = ControllerDbV1::kKnownGamepads[i];
+        const ControllerDbV1::KnownGamepadV1* first = ControllerDbV1::FindGamepad(g.vendorId, g.productId);
+        int index = -1;
+        knownMismatches += !CurrentKnown(g.vendorId, g.productId, &index)
+                        || index != first - ControllerDbV1::kKnownGamepads;
+        if (first == &g) keys.knownHit.push_back(Key(g.vendorId, g.productId));
+    }
+
+    uint64_t vendorMismatches = 0;
+    Lcg rng(45);
+    for (int i = 0; ControllerDbV1::kVendorFallbacks[i].vendorName != NULL; i++) {
+        const uint16_t vendorId = ControllerDbV1::kVendorFallbacks[i].vendorId;
+        const ControllerDbEntry* e = findControllerDbVendor(vendorId);
+        int firstIndex = i;
+        for (int j = 0; j < i; j++) {
+            if (ControllerDbV1::kVendorFallbacks[j].vendorId == vendorId) {
+                firstIndex = j;
+                break;
+            }
+        }
+        vendorMismatches += !e || e->knownIndex != firstIndex;
+        for (int n = 0; n < 16; n++) {
+            uint16_t productId = static_cast<uint16_t>(rng.Next());
+            if (!ControllerDbV1::FindGamepad(vendorId, productId)) keys.vendorOnly.push_back(Key(vendorId, productId));
+        }
+    }
+
+    uint64_t missMismatches = 0;
+    for (int n = 0; n < 3000; n++) {
+        const uint32_t key = rng.Next() | (rng.Next() << 24);
+        const bool oldMapping = v1.FindGamepadMapping(Vid(key), Pid(key)) != nullptr;
+        const bool curMapping = findGamepadMapping(Vid(key), Pid(key)) != nullptr;
+        int index = -1;
+        const bool oldKnown = ControllerDbV1::FindGamepad(Vid(key), Pid(key)) != nullptr;
+        const bool curKnown = CurrentKnown(Vid(key), Pid(key), &index);
+        missMismatches += oldMapping != curMapping || oldKnown != curKnown;
+        if (!oldMapping && !oldKnown) keys.miss.push_back(key);
+    }
+
+    report.Add().Set("test", "consistency")
+          .Set("sdl_keys", sdlKeys).Set("sdl_mismatches", sdlMismatches)
+          .Set("known_gamepads", static_cast<uint64_t>(keys.knownHit.size())).Set("known_mismatches", knownMismatches)
+          .Set("vendor_mismatches", vendorMismatches)
+          .Set("random_keys", 3000).Set("random_mismatches", missMismatches);
+    report.Check(sdlKeys > 0 && sdlMismatches == 0, "SDL mappings identical to v1");
+    report.Check(knownMismatches == 0, "known gamepad lookups identical to v1");
+    report.Check(vendorMismatches == 0, "vendor fallback lookups identical to v1");
+    report.Check(missMismatches == 0, "random key lookups identical to v1");
+    return keys;
+}
+
+/**
+ * 冷查找：旧版每次新建实例（首次查找即解析全部 SDL 字符串），新版刷缓存后查一次
+ */
+void FirstLookup(bench::Report& report, const KeySets& keys) {
+    if (keys.sdlHit.empty()) return;
+    const uint32_t key = keys.sdlHit.back();
+    const int rounds = report.Scale(20, 3);
+
+    std::vector<uint64_t> v1Ns, curNs;
+    uint64_t v1Allocs = 0, curAllocs = 0;
+    size_t v1Heap = 0;
+    for (int r = 0; r < rounds; r++) {
+        FlushCaches();
+        std::unique_ptr<ControllerDbV1> v1(new ControllerDbV1());
+        uint64_t allocs = bench::AllocCount();
+        uint64_t t0 = bench::NowNs();
+        bench::DoNotOptimize(v1->FindGamepadMapping(Vid(key), Pid(key)));
+        uint64_t elapsed = bench::NowNs() - t0;
+        v1Allocs = bench::AllocCount() - allocs;
+        v1Ns.push_back(elapsed);
+        v1Heap = v1->HeapBytes();
+
+        FlushCaches();
+        allocs = bench::AllocCount();
+        t0 = bench::NowNs();
+        bench::DoNotOptimize(findGamepadMapping(Vid(key), Pid(key)));
+        elapsed = bench::NowNs() - t0;
+        curAllocs = bench::AllocCount() - allocs;
+        curNs.push_back(elapsed);
+    }
+
+    report.Add().Set("test", "first_lookup")
+          .Set("v1_ns", bench::Summarize(v1Ns)).Set("hash_ns", bench::Summarize(curNs))
+          .Set("v1_operator_new", v1Allocs).Set("v1_heap_bytes", static_cast<uint64_t>(v1Heap))
+          .Set("hash_operator_new", curAllocs)
+          .Set("v1_mapping_bytes", static_cast<uint64_t>(sizeof(GamepadMappingV1)))
+          .Set("mapping_bytes", static_cast<uint64_t>(sizeof(GamepadMapping)));
+    report.Check(curAllocs == 0, "first lookup allocates nothing");
+}
+
+template <typename Fn>
+bench::Stats MeasureKeys(bench::Report& report, const std::vector<uint32_t>& keys, Fn lookup) {
+    std::vector<uint32_t> ring(kKeyCount);
+    Lcg rng(7);
+    for (uint32_t& k : ring) k = keys[rng.Next() % keys.size()];
+    return bench::MeasurePerCall(report.Scale(100, 10), 1000, [&](int i) {
+        const uint32_t key = ring[static_cast<size_t>(i) & (kKeyCount - 1)];
+        bench::DoNotOptimize(lookup(Vid(key), Pid(key)));
+    });
+}
+
+void HotLookup(bench::Report& report, const char* name, const std::vector<uint32_t>& keys,
+               const bench::Stats& v1, const bench::Stats& hash) {
+    report.Add().Set("test", "hot_lookup").Set("case", name)
+          .Set("keys", static_cast<uint64_t>(keys.size()))
+          .Set("v1_ns", v1).Set("hash_ns", hash);
+}
+
+void Hot(bench::Report& report, ControllerDbV1& v1, const KeySets& keys) {
+    if (!report.Check(!keys.sdlHit.empty() && !keys.miss.empty() && !keys.knownHit.empty()
+                      && !keys.vendorOnly.empty(), "key sets not empty")) {
+        return;
+    }
+    auto v1Mapping = [&v1](uint16_t vid, uint16_t pid) { return v1.FindGamepadMapping(vid, pid); };
+    auto v1Known = [](uint16_t vid, uint16_t pid) { return ControllerDbV1::FindGamepad(vid, pid); };
+    auto v1Type = [](uint16_t vid, uint16_t pid) { return ControllerDbV1::GetGamepadType(vid, pid); };
+    auto hashKnown = [](uint16_t vid, uint16_t pid) { return findControllerDbDevice(vid, pid); };
+
+    HotLookup(report, "sdl_mapping_hit", keys.sdlHit,
+              MeasureKeys(report, keys.sdlHit, v1Mapping), MeasureKeys(report, keys.sdlHit, findGamepadMapping));
+    HotLookup(report, "mapping_miss", keys.miss,
+              MeasureKeys(report, keys.miss, v1Mapping), MeasureKeys(report, keys.miss, findGamepadMapping));
+    HotLookup(report, "known_gamepad_hit", keys.knownHit,
+              MeasureKeys(report, keys.knownHit, v1Known), MeasureKeys(report, keys.knownHit, hashKnown));
+    HotLookup(report, "type_via_vendor", keys.vendorOnly,
+              MeasureKeys(report, keys.vendorOnly, v1Type), MeasureKeys(report, keys.vendorOnly, CurrentTypeLookup));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bench::Report report("controller_db", argc, argv);
+    std::unique_ptr<ControllerDbV1> v1(new ControllerDbV1());
+    KeySets keys = Verify(report, *v1);
+    FirstLookup(report, keys);
+    Hot(report, *v1, keys);
+    return report.Finish();
+}
@@ -0,0 +1,287 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file fake_ohaudio.cpp
+ * @brief 替身 libohaudio.so：AudioRenderer 直接链接与 dlsym 取得的 OHAudio 函数
+ *
+ * builder 只记录参数与回调；渲染器维护状态机与已写入帧数，数据只在基准调用 FakeOHAudio_Pull 时流动。
+ * 路由查询返回单个设备，类型由 FakeOHAudio_SetOutputDevice 指定。
+ * 中断 / 错误 / 设备变更回调只保存，不会触发。
+ */
+
+#include "fake_ohaudio.h"
+
+#include <ohaudio/native_audiostreambuilder.h>
+
+#include <atomic>
+
+struct OH_AudioStreamBuilderStruct {
+    int32_t sampleRate = 0;
+    int32_t channelCount = 0;
+    int32_t frameSize = 0;
+    OH_AudioRenderer_OnWriteDataCallback writeData = nullptr;
+    void* writeDataUserData = nullptr;
+};
+
+struct OH_AudioRendererStruct {
+    int32_t sampleRate = 0;
+    int32_t channelCount = 0;
+    OH_AudioRenderer_OnWriteDataCallback writeData = nullptr;
+    void* userData = nullptr;
+    std::atomic<int> state{AUDIOSTREAM_STATE_PREPARED};
+    std::atomic<int64_t> framesWritten{0};
+};
+
+struct OH_AudioDeviceDescriptor {
+    OH_AudioDevice_Type type;
+};
+
+namespace {
+
+OH_AudioDeviceDescriptor g_device = {AUDIO_DEVICE_TYPE_SPEAKER};
+OH_AudioDeviceDescriptor* g_deviceList[1] = {&g_device};
+OH_AudioDeviceDescriptorArray g_devices = {1, g_deviceList};
+int g_routingManager = 0;  // 只作为非空句柄
+std::atomic<int64_t> g_deviceLatencyFrames{480};
+std::atomic<OH_AudioRenderer*> g_lastRenderer{nullptr};
+
+} // namespace
+
+void FakeOHAudio_SetOutputDevice(OH_AudioDevice_Type type) {
+    g_device.type = type;
+}
+
+void FakeOHAudio_SetDeviceLatencyFrames(int64_t frames) {
+    g_deviceLatencyFrames.store(frames, std::memory_order_relaxed);
+}
+
+OH_AudioRenderer* FakeOHAudio_LastRenderer() {
+    return g_lastRenderer.load(std::memory_order_acquire);
+}
+
+bool FakeOHAudio_Pull(OH_AudioRenderer* renderer, void* buffer, int32_t bufferLen) {
+    if (renderer == nullptr || renderer->writeData == nullptr ||
+        renderer->state.load(std::memory_order_acquire) != AUDIOSTREAM_STATE_RUNNING) {
+        return false;
+    }
+    renderer->writeData(renderer, renderer->userData, buffer, bufferLen);
+    int32_t frameBytes = static_cast<int32_t>(sizeof(int16_t)) * (renderer->channelCount > 0 ? renderer->channelCount : 1);
+    renderer->framesWritten.fetch_add(bufferLen / frameBytes, std::memory_order_relaxed);
+    return true;
+}
+
+extern "C" {
+
+// =============================================================================
+// OH_AudioStreamBuilder
+// =============================================================================
+
+OH_AudioStream_Result OH_AudioStreamBuilder_Create(OH_AudioStreamBuilder** builder, OH_AudioStream_Type type) {
+    if (builder == nullptr || type != AUDIOSTREAM_TYPE_RENDERER) {
+        return AUDIOSTREAM_ERROR_INVALID_PARAM;
+    }
+    *builder = new OH_AudioStreamBuilderStruct();
+    return AUDIOSTREAM_SUCCESS;
+}
+
+OH_AudioStream_Result OH_AudioStreamBuilder_Destroy(OH_AudioStreamBuilder* builder) {
+    delete builder;
+    return AUDIOSTREAM_SUCCESS;
+}
+
+OH_AudioStream_Result OH_AudioStreamBuilder_SetSamplingRate(OH_AudioStreamBuilder* builder, int32_t rate) {
+    if (builder == nullptr || rate <= 0) return AUDIOSTREAM_ERROR_INVALID_PARAM;
+    builder->sampleRate = rate;
+    return AUDIOSTREAM_SUCCESS;
+}
+
+OH_AudioStream_Result OH_AudioStreamBuilder_SetChannelCount(OH_AudioStreamBuilder* builder, int32_t channelCount) {
+    if (builder == nullptr || channelCount <= 0) return AUDIOSTREAM_ERROR_INVALID_PARAM;
+    builder->channelCount = channelCount;
+    return AUDIOSTREAM_SUCCESS;
+}
+
+OH_AudioStream_Result OH_AudioStreamBuilder_SetChannelLayout(OH_AudioStreamBuilder* builder,
+                                                             OH_AudioChannelLayout channelLayout) {
+    (void)channelLayout;
+    return builder != nullptr ? AUDIOSTREAM_SUCCESS : AUDIOSTREAM_ERROR_INVALID_PARAM;
+}
+
+OH_AudioStream_Result OH_AudioStreamBuilder_SetSampleFormat(OH_AudioStreamBuilder* builder,
+                                                            OH_AudioStream_SampleFormat format) {
+    if (builder == nullptr || format != AUDIOSTREAM_SAMPLE_S16LE) return AUDIOSTREAM_ERROR_INVALID_PARAM;
+    return AUDIOSTREAM_SUCCESS;
+}
+
+OH_AudioStream_Result OH_AudioStreamBuilder_SetEncodingType(OH_AudioStreamBuilder* builder,
+                                                            OH_AudioStream_EncodingType encodingType) {
+    (void)encodingType;
+    return builder != nullptr ? AUDIOSTREAM_SUCCESS : AUDIOSTREAM_ERROR_INVALID_PARAM;
+}
+
+OH_AudioStream_Result OH_AudioStreamBuilder_SetRendererInfo(OH_AudioStreamBuilder* builder,
+                                                            OH_AudioStream_Usage usage) {
+    (void)usage;
+    return builder != nullptr ? AUDIOSTREAM_SUCCESS : AUDIOSTREAM_ERROR_INVALID_PARAM;
+}
+
+OH_AudioStream_Result OH_AudioStreamBuilder_SetLatencyMode(OH_AudioStreamBuilder* builder,
+                                                           OH_AudioStream_LatencyMode latencyMode) {
+    (void)latencyMode;
+    return builder != nullptr ? AUDIOSTREAM_SUCCESS : AUDIOSTREAM_ERROR_INVALID_PARAM;
+}
+
+OH_AudioStream_Result OH_AudioStreamBuilder_SetFrameSizeInCallback(OH_AudioStreamBuilder* builder,
+                                                                   int32_t frameSize) {
+    if (builder == nullptr || frameSize <= 0) return AUDIOSTREAM_ERROR_INVALID_PARAM;
+    builder->frameSize = frameSize;
+    return AUDIOSTREAM_SUCCESS;
+}
+
+OH_AudioStream_Result OH_AudioStreamBuilder_SetRendererWriteDataCallback(OH_AudioStreamBuilder* builder,
+    OH_AudioRenderer_OnWriteDataCallback callback, void* userData) {
+    if (builder == nullptr) return AUDIOSTREAM_ERROR_INVALID_PARAM;
+    builder->writeData = callback;
+    builder->writeDataUserData = userData;
+    return AUDIOSTREAM_SUCCESS;
+}
+
+OH_AudioStream_Result OH_AudioStreamBuilder_SetRendererInterruptCallback(OH_AudioStreamBuilder* builder,
+    OH_AudioRenderer_OnInterruptCallback callback, void* userData) {
+    (void)callback;
+    (void)userData;
+    return builder != nullptr ? AUDIOSTREAM_SUCCESS : AUDIOSTREAM_ERROR_INVALID_PARAM;
+}
+
+OH_AudioStream_Result OH_AudioStreamBuilder_SetRendererErrorCallback(OH_AudioStreamBuilder* builder,
+    OH_AudioRenderer_OnErrorCallback callback, void* userData) {
+    (void)callback;
+    (void)userData;
+    return builder != nullptr ? AUDIOSTREAM_SUCCESS : AUDIOSTREAM_ERROR_INVALID_PARAM;
+}
+
+OH_AudioStream_Result OH_AudioStreamBuilder_SetRendererOutputDeviceChangeCallback(OH_AudioStreamBuilder* builder,
+    OH_AudioRenderer_OutputDeviceChangeCallback callback, void* userData) {
+    (void)callback;
+    (void)userData;
+    return builder != nullptr ? AUDIOSTREAM_SUCCESS : AUDIOSTREAM_ERROR_INVALID_PARAM;
+}
+
+OH_AudioStream_Result OH_AudioStreamBuilder_GenerateRenderer(OH_AudioStreamBuilder* builder,
+                                                             OH_AudioRenderer** audioRenderer) {
+    if (builder == nullptr || audioRenderer == nullptr || builder->writeData == nullptr) {
+        return AUDIOSTREAM_ERROR_INVALID_PARAM;
+    }
+    OH_AudioRenderer* renderer = new OH_AudioRendererStruct();
+    renderer->sampleRate = builder->sampleRate;
+    renderer->channelCount = builder->channelCount;
+    renderer->writeData = builder->writeData;
+    renderer->userData = builder->writeDataUserData;
+    *audioRenderer = renderer;
+    g_lastRenderer.store(renderer, std::memory_order_release);
+    return AUDIOSTREAM_SUCCESS;
+}
+
+// =============================================================================
+// OH_AudioRenderer
+// =============================================================================
+
+OH_AudioStream_Result OH_AudioRenderer_Start(OH_AudioRenderer* renderer) {
+    if (renderer == nullptr) return AUDIOSTREAM_ERROR_INVALID_PARAM;
+    renderer->state.store(AUDIOSTREAM_STATE_RUNNING, std::memory_order_release);
+    return AUDIOSTREAM_SUCCESS;
+}
+
+OH_AudioStream_Result OH_AudioRenderer_Stop(OH_AudioRenderer* renderer) {
+    if (renderer == nullptr) return AUDIOSTREAM_ERROR_INVALID_PARAM;
+    renderer->state.store(AUDIOSTREAM_STATE_STOPPED, std::memory_order_release);
+    return AUDIOSTREAM_SUCCESS;
+}
+
+OH_AudioStream_Result OH_AudioRenderer_Flush(OH_AudioRenderer* renderer) {
+    return renderer != nullptr ? AUDIOSTREAM_SUCCESS : AUDIOSTREAM_ERROR_INVALID_PARAM;
+}
+
+OH_AudioStream_Result OH_AudioRenderer_Release(OH_AudioRenderer* renderer) {
+    if (renderer == nullptr) return AUDIOSTREAM_ERROR_INVALID_PARAM;
+    OH_AudioRenderer* expected = renderer;
+    g_lastRenderer.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+    delete renderer;
+    return AUDIOSTREAM_SUCCESS;
+}
+
+OH_AudioStream_Result OH_AudioRenderer_SetVolume(OH_AudioRenderer* renderer, float volume) {
+    if (renderer == nullptr || volume < 0.0f || volume > 1.0f) return AUDIOSTREAM_ERROR_INVALID_PARAM;
+    return AUDIOSTREAM_SUCCESS;
+}
+
+OH_AudioStream_Result OH_AudioRenderer_GetCurrentState(OH_AudioRenderer* renderer, OH_AudioStream_State* state) {
+    if (renderer == nullptr || state == nullptr) return AUDIOSTREAM_ERROR_INVALID_PARAM;
+    *state = static_cast<OH_AudioStream_State>(renderer->state.load(std::memory_order_acquire));
+    return AUDIOSTREAM_SUCCESS;
+}
+
+OH_AudioStream_Result OH_AudioRenderer_GetFramesWritten(OH_AudioRenderer* renderer, int64_t* frames) {
+    if (renderer == nullptr || frames == nullptr) return AUDIOSTREAM_ERROR_INVALID_PARAM;
+    *frames = renderer->framesWritten.load(std::memory_order_relaxed);
+    return AUDIOSTREAM_SUCCESS;
+}
+
+// 播放位置固定落后已写入帧数 g_deviceLatencyFrames，时间戳取调用时刻
+OH_AudioStream_Result OH_AudioRenderer_GetTimestamp(OH_AudioRenderer* renderer, clockid_t clockId,
+                                                    int64_t* framePosition, int64_t* timestamp) {
+    if (renderer == nullptr || framePosition == nullptr || timestamp == nullptr) {
+        return AUDIOSTREAM_ERROR_INVALID_PARAM;
+    }
+    int64_t written = renderer->framesWritten.load(std::memory_order_relaxed);
+    int64_t latency = g_deviceLatencyFrames.load(std::memory_order_relaxed);
+    if (written < latency) {
+        return AUDIOSTREAM_ERROR_ILLEGAL_STATE;  // 尚未出声
+    }
+    struct timespec ts;
+    clock_gettime(clockId, &ts);
+    *framePosition = written - latency;
+    *timestamp = static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+    return AUDIOSTREAM_SUCCESS;
+}
+
+// =============================================================================
+// 路由查询
+// =============================================================================
+
+OH_AudioCommon_Result OH_AudioManager_GetAudioRoutingManager(OH_AudioRoutingManager** manager) {
+    if (manager == nullptr) return AUDIOCOMMON_RESULT_ERROR_INVALID_PARAM;
+    *manager = reinterpret_cast<OH_AudioRoutingManager*>(&g_routingManager);
+    return AUDIOCOMMON_RESULT_SUCCESS;
+}
+
+OH_AudioCommon_Result OH_AudioRoutingManager_GetPreferredOutputDevice(OH_AudioRoutingManager* manager,
+    OH_AudioStream_Usage usage, OH_AudioDeviceDescriptorArray** devices) {
+    (void)usage;
+    if (manager == nullptr || devices == nullptr) return AUDIOCOMMON_RESULT_ERROR_INVALID_PARAM;
+    *devices = &g_devices;
+    return AUDIOCOMMON_RESULT_SUCCESS;
+}
+
+OH_AudioCommon_Result OH_AudioRoutingManager_ReleaseDevices(OH_AudioRoutingManager* manager,
+                                                            OH_AudioDeviceDescriptorArray* devices) {
+    (void)devices;
+    return manager != nullptr ? AUDIOCOMMON_RESULT_SUCCESS : AUDIOCOMMON_RESULT_ERROR_INVALID_PARAM;
+}
+
+OH_AudioCommon_Result OH_AudioDeviceDescriptor_GetDeviceType(OH_AudioDeviceDescriptor* descriptor,
+                                                             OH_AudioDevice_Type* type) {
+    if (descriptor == nullptr || type == nullptr) return AUDIOCOMMON_RESULT_ERROR_INVALID_PARAM;
+    *type = descriptor->type;
+    return AUDIOCOMMON_RESULT_SUCCESS;
+}
+
+} // extern "C"
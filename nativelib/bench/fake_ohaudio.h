@@ -0,0 +1,49 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file fake_ohaudio.h
+ * @brief 替身 libohaudio.so 的基准侧控制接口
+ *
+ * fake_ohaudio.cpp 编译为名为 libohaudio.so 的共享库并由基准直接链接，因此 audio_renderer.cpp
+ * 的 dlopen("libohaudio.so") / dlsym 命中同一份实现，AudioRenderer::Init 与真机走相同分支。
+ * 渲染器不自带回调线程：基准调用 FakeOHAudio_Pull 扮演 OHAudio 回调线程，按自己的时间轴拉取数据。
+ */
+
+#ifndef BENCH_FAKE_OHAUDIO_H
+#define BENCH_FAKE_OHAUDIO_H
+
+#include <cstdint>
+#include <ohaudio/native_audiorenderer.h>
+#include <ohaudio/native_audio_routing_manager.h>
+
+/**
+ * 设置路由查询返回的首选输出设备（默认扬声器），影响之后 Init 时 DetectRoute 的结果
+ */
+void FakeOHAudio_SetOutputDevice(OH_AudioDevice_Type type);
+
+/**
+ * 设置设备内部缓冲（已写入未出声）的帧数，GetTimestamp 据此报告播放位置；默认 480（10ms @48kHz）
+ */
+void FakeOHAudio_SetDeviceLatencyFrames(int64_t frames);
+
+/**
+ * 最近一次 GenerateRenderer 创建的渲染器（已释放时为 nullptr）
+ */
+OH_AudioRenderer* FakeOHAudio_LastRenderer();
+
+/**
+ * 模拟 OHAudio 回调线程取一次数据：渲染器处于 RUNNING 时调用写数据回调并累计已写入帧数
+ * @param bufferLen 字节数
+ * @return 是否调用了回调
+ */
+bool FakeOHAudio_Pull(OH_AudioRenderer* renderer, void* buffer, int32_t bufferLen);
+
+#endif // BENCH_FAKE_OHAUDIO_H
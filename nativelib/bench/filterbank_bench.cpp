@@ -0,0 +1,224 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file filterbank_bench.cpp
+ * @brief BassEnergyAnalyzer 多频段滤波器组与单频段旧版（baseline/bass_energy_analyzer_v1.h）对比
+ *
+ * 同一合成流（240 采样/帧，立体声与 5.1）分别送入两个分析器：
+ * 1. 一致性：综合强度（HapticBandIntensity::intensity）与旧版输出逐帧比较，必须完全一致
+ *    （滤波器组 lane 0 与旧版逐位相同；音乐模式的脉冲强度也只依赖 lane 0 与全频段能量）。
+ * 2. 耗时：ns/帧（游戏模式只有滤波器组；音乐模式额外包含 onset 后端）。两个分析器逐帧交替运行、
+ *    交替先后顺序，频率漂移与其他负载对两边的影响相同。重复 5 遍，各取 p50 最低的一遍，
+ *    滤波器组 p50 超过旧版 3%（成对 pass 的测量波动）即失败。
+ * 3. 新增输出：低频 / 高频马达与左右扳机的非零帧数，以及热路径堆分配数。
+ */
+
+#include "bench_util.h"
+
+#include "bass_energy_analyzer.h"
+#include "baseline/bass_energy_analyzer_v1.h"
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int kSampleRate = 48000;
+constexpr int kFrame = 240;
+// 耗时比较的容差：lane 0 与旧版是同一条 Biquad 递推链，逐样本耗时的下限相同；
+// 成对 pass 之间的 p50 波动约 1~3%，超出这个范围才算滤波器组变慢
+constexpr double kTimingTolerance = 1.03;
+
+struct Lcg {
+    uint32_t state;
+    explicit Lcg(uint32_t seed) : state(seed) {}
+    uint32_t Next() {
+        state = state * 1664525u + 1013904223u;
+        return state;
+    }
+    double Signed() { return (Next() >> 8) * (2.0 / 16777216.0) - 1.0; }
+};
+
+/**
+ * 合成流：每 2 秒一次 40Hz 爆炸（左右声像交替）、每 0.5 秒一次 120 BPM 底鼓、
+ * 八分音符踩镲、160Hz 贝斯线和底噪；其余声道放低电平的同源信号
+ */
+std::vector<int16_t> MakeStream(int seconds, int channels) {
+    Lcg rng(11);
+    const size_t frames = static_cast<size_t>(seconds) * kSampleRate;
+    std::vector<int16_t> pcm(frames * channels);
+    for (size_t i = 0; i < frames; i++) {
+        double time = static_cast<double>(i) / kSampleRate;
+        double tk = static_cast<double>(i % (kSampleRate / 2)) / kSampleRate;
+        double th = static_cast<double>(i % (kSampleRate / 4)) / kSampleRate;
+        double te = static_cast<double>(i % (2 * kSampleRate)) / kSampleRate;
+        double kick = std::exp(-tk / 0.06) * std::sin(2.0 * M_PI * (50.0 * tk + 2.0 * (1.0 - std::exp(-tk / 0.02))));
+        double hat = std::exp(-th / 0.01) * rng.Signed();
+        double bass = 0.15 * std::sin(2.0 * M_PI * 160.0 * time) * (0.5 + 0.5 * std::sin(2.0 * M_PI * 0.25 * time));
+        double boom = std::exp(-te / 0.4) * (std::sin(2.0 * M_PI * 40.0 * te) + 0.3 * rng.Signed());
+        double noise = 0.01 * rng.Signed();
+        bool boomLeft = (i / (2 * kSampleRate)) % 2 == 0;
+        double common = 0.5 * kick + 0.15 * hat + bass + noise;
+        double left = common + (boomLeft ? 0.6 : 0.2) * boom;
+        double right = common + (boomLeft ? 0.2 : 0.6) * boom;
+        int16_t* frame = pcm.data() + i * channels;
+        frame[0] = static_cast<int16_t>(std::max(-1.0, std::min(1.0, left)) * 30000.0);
+        frame[1] = static_cast<int16_t>(std::max(-1.0, std::min(1.0, right)) * 30000.0);
+        for (int ch = 2; ch < channels; ch++) {
+            frame[ch] = static_cast<int16_t>(0.3 * (frame[0] / 2 + frame[1] / 2));
+        }
+    }
+    return pcm;
+}
+
+struct Run {
+    std::vector<int> intensity;
+    std::vector<HapticBandIntensity> bands;
+    std::vector<uint64_t> frameNs;
+    uint64_t allocs = 0;
+};
+
+void Process(BassEnergyAnalyzerV1& analyzer, const int16_t* pcm, Run& run) {
+    int intensity = 0;
+    analyzer.ProcessFrame(pcm, kFrame, intensity);
+    run.intensity.push_back(intensity);
+}
+
+void Process(BassEnergyAnalyzer& analyzer, const int16_t* pcm, Run& run) {
+    HapticBandIntensity bands;
+    analyzer.ProcessFrame(pcm, kFrame, bands);
+    run.intensity.push_back(bands.intensity);
+    run.bands.push_back(bands);
+}
+
+template <typename Analyzer>
+std::unique_ptr<Analyzer> MakeAnalyzer(int channels, int scene) {
+    std::unique_ptr<Analyzer> analyzer(new Analyzer());
+    analyzer->Init(kSampleRate, channels);
+    analyzer->SetEnabled(true);
+    analyzer->SetSceneMode(scene);
+    return analyzer;
+}
+
+template <typename Analyzer>
+void TimeFrame(Analyzer& analyzer, const int16_t* pcm, Run& run) {
+    uint64_t allocs = bench::AllocCount();
+    uint64_t t0 = bench::NowNs();
+    Process(analyzer, pcm, run);
+    run.frameNs.push_back(bench::NowNs() - t0);
+    run.allocs += bench::AllocCount() - allocs;
+}
+
+/**
+ * 两个分析器逐帧交替处理同一流（偶数帧旧版先行，奇数帧滤波器组先行）
+ */
+void RunPair(const std::vector<int16_t>& pcm, int channels, int scene, Run& v1, Run& cur) {
+    std::unique_ptr<BassEnergyAnalyzerV1> v1Analyzer = MakeAnalyzer<BassEnergyAnalyzerV1>(channels, scene);
+    std::unique_ptr<BassEnergyAnalyzer> curAnalyzer = MakeAnalyzer<BassEnergyAnalyzer>(channels, scene);
+
+    const size_t frames = pcm.size() / channels / kFrame;
+    for (Run* run : {&v1, &cur}) {
+        run->intensity.reserve(frames);
+        run->bands.reserve(frames);
+        run->frameNs.reserve(frames);
+    }
+    for (size_t f = 0; f < frames; f++) {
+        const int16_t* frame = pcm.data() + f * kFrame * channels;
+        if (f % 2 == 0) {
+            TimeFrame(*v1Analyzer, frame, v1);
+            TimeFrame(*curAnalyzer, frame, cur);
+        } else {
+            TimeFrame(*curAnalyzer, frame, cur);
+            TimeFrame(*v1Analyzer, frame, v1);
+        }
+    }
+}
+
+void Compare(bench::Report& report, int channels, int scene) {
+    const char* sceneName = scene == BassEnergyAnalyzer::SCENE_GAME ? "game" : "music";
+    const std::string tag = std::string(sceneName) + " " + std::to_string(channels) + "ch";
+    const std::vector<int16_t> pcm = MakeStream(report.Scale(60, 10), channels);
+
+    // 先跑一遍预热，再正式计时；输出逐帧确定，一致性检查用第一遍，耗时各取 p50 最低的一遍
+    {
+        Run warmV1, warmCur;
+        RunPair(pcm, channels, scene, warmV1, warmCur);
+    }
+    constexpr int kPasses = 5;
+    Run v1, cur;
+    bench::Stats v1Ns, curNs;
+    for (int pass = 0; pass < kPasses; pass++) {
+        Run passV1, passCur;
+        RunPair(pcm, channels, scene, passV1, passCur);
+        bench::Stats passV1Ns = bench::Summarize(passV1.frameNs);
+        bench::Stats passCurNs = bench::Summarize(passCur.frameNs);
+        if (pass == 0 || passV1Ns.p50 < v1Ns.p50) v1Ns = passV1Ns;
+        if (pass == 0 || passCurNs.p50 < curNs.p50) curNs = passCurNs;
+        if (pass == 0) {
+            v1 = std::move(passV1);
+            cur = std::move(passCur);
+        } else {
+            cur.allocs += passCur.allocs;
+        }
+    }
+
+    uint64_t mismatches = 0, active = 0;
+    int maxDiff = 0;
+    uint64_t lowMotor = 0, highMotor = 0, leftTrigger = 0, rightTrigger = 0;
+    for (size_t f = 0; f < v1.intensity.size(); f++) {
+        int diff = std::abs(cur.intensity[f] - v1.intensity[f]);
+        if (diff != 0) mismatches++;
+        maxDiff = std::max(maxDiff, diff);
+        if (v1.intensity[f] > 0) active++;
+        const HapticBandIntensity& b = cur.bands[f];
+        lowMotor += b.lowMotor > 0;
+        highMotor += b.highMotor > 0;
+        leftTrigger += b.leftTrigger > 0;
+        rightTrigger += b.rightTrigger > 0;
+    }
+
+    bench::Record nonZero;
+    nonZero.Set("low_motor", lowMotor).Set("high_motor", highMotor)
+           .Set("left_trigger", leftTrigger).Set("right_trigger", rightTrigger);
+    report.Add().Set("scene", sceneName).Set("channels", channels)
+          .Set("frames", static_cast<uint64_t>(v1.intensity.size()))
+          .Set("v1_active_frames", active)
+          .Set("intensity_mismatches", mismatches)
+          .Set("intensity_max_diff", maxDiff)
+          .Set("v1_frame_ns", v1Ns)
+          .Set("filterbank_frame_ns", curNs)
+          .Set("timing_passes", kPasses)
+          .Set("filterbank_v1_p50_ratio", curNs.p50 / v1Ns.p50)
+          .Set("non_zero_frames", nonZero)
+          .Set("filterbank_allocs", cur.allocs)
+          .Set("v1_state_bytes", static_cast<uint64_t>(sizeof(BassEnergyAnalyzerV1)))
+          .Set("filterbank_state_bytes", static_cast<uint64_t>(sizeof(BassEnergyAnalyzer)));
+
+    report.Check(active > 0, "stream drives v1 " + tag);
+    report.Check(cur.allocs == 0, "no heap allocation " + tag);
+    report.Check(lowMotor > 0 && highMotor > 0 && leftTrigger > 0 && rightTrigger > 0,
+                 "all motor / trigger outputs active " + tag);
+    report.Check(mismatches == 0, "combined intensity identical to v1 " + tag);
+    report.Check(curNs.p50 <= v1Ns.p50 * kTimingTolerance, "filterbank p50 not slower than v1 " + tag);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bench::Report report("filterbank", argc, argv);
+    for (int channels : {2, 6}) {
+        Compare(report, channels, BassEnergyAnalyzer::SCENE_GAME);
+        Compare(report, channels, BassEnergyAnalyzer::SCENE_MUSIC);
+    }
+    return report.Finish();
+}
@@ -0,0 +1,312 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file hid_plan_bench.cpp
+ * @brief 通用 HID 手柄解析：描述符编译计划（hid_report_plan）对比启发式与 SDL 固定偏移映射
+ *
+ * 1. 每报告耗时，DirectInput 风格 8 字节报告（X/Y/Z/Rz、HAT、12 按钮、1 字节厂商数据），
+ *    256 份随机报告轮流输入：
+ *      heuristic    GamepadNapi_ParseReport，未收录的 VID/PID → parseGenericHidReport
+ *      sdl          GamepadNapi_ParseReport，收录 SDL 映射的 VID/PID → findGamepadMapping + applyGamepadMapping
+ *      plan_usage   HidPlan_Apply，按 HID Usage 绑定
+ *      plan_sdl     HidPlan_Apply，按同一 SDL 映射绑定
+ *    两个计划的输出逐报告与按描述符手算的期望值比较。
+ * 2. 正确性：Report ID 1、16 位摇杆、10 位 Brake/Accelerator、1..8 HAT 的报告，
+ *    计划必须逐字段解码正确；同时记录启发式在该报告上的错误字段数（不作为失败条件）。
+ * 3. HidPlan_Compile 单次编译耗时与计划大小。
+ */
+
+#include "bench_util.h"
+
+#include "gamepad_napi.h"
+#include "hid_report_plan.h"
+#include "sdl_gamecontrollerdb.h"
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+// 未收录的 VID/PID（走启发式）与收录 SDL 映射的 Mayflash Magic NS（4 轴 + HAT + 12 按钮）
+constexpr uint16_t kUnknownVid = 0x1234;
+constexpr uint16_t kUnknownPid = 0x5678;
+constexpr uint16_t kSdlVid = 0x0079;
+constexpr uint16_t kSdlPid = 0x18D2;
+constexpr int kGenericType = 0;
+
+// DirectInput 风格：[0..3] X Y Z Rz (0..255)，[4] HAT 低 4 位 (0..7，其余为中立)，
+// [5..6] 按钮 1-12，[7] 厂商数据
+const uint8_t kDinputDescriptor[] = {
+    0x05, 0x01, 0x09, 0x05, 0xA1, 0x01,
+    0x15, 0x00, 0x26, 0xFF, 0x00, 0x75, 0x08, 0x95, 0x04,
+    0x09, 0x30, 0x09, 0x31, 0x09, 0x32, 0x09, 0x35, 0x81, 0x02,
+    0x15, 0x00, 0x25, 0x07, 0x35, 0x00, 0x46, 0x3B, 0x01, 0x65, 0x14,
+    0x75, 0x04, 0x95, 0x01, 0x09, 0x39, 0x81, 0x42,
+    0x65, 0x00, 0x75, 0x04, 0x95, 0x01, 0x81, 0x03,
+    0x05, 0x09, 0x19, 0x01, 0x29, 0x0C, 0x15, 0x00, 0x25, 0x01,
+    0x75, 0x01, 0x95, 0x0C, 0x81, 0x02,
+    0x75, 0x04, 0x95, 0x01, 0x81, 0x03,
+    0x06, 0x00, 0xFF, 0x09, 0x20, 0x15, 0x00, 0x26, 0xFF, 0x00,
+    0x75, 0x08, 0x95, 0x01, 0x81, 0x02,
+    0xC0,
+};
+
+// Report ID 1：[1..8] X Y Z Rz (int16)，[9..11] Brake / Accelerator (10 位) + 4 位填充，
+// [12] HAT 低 4 位 (1..8，0 为中立)，[13..14] 按钮 1-16
+const uint8_t kReportIdDescriptor[] = {
+    0x05, 0x01, 0x09, 0x05, 0xA1, 0x01,
+    0x85, 0x01,
+    0x16, 0x00, 0x80, 0x26, 0xFF, 0x7F, 0x75, 0x10, 0x95, 0x04,
+    0x09, 0x30, 0x09, 0x31, 0x09, 0x32, 0x09, 0x35, 0x81, 0x02,
+    0x05, 0x02, 0x15, 0x00, 0x26, 0xFF, 0x03, 0x75, 0x0A, 0x95, 0x02,
+    0x09, 0xC5, 0x09, 0xC4, 0x81, 0x02,
+    0x75, 0x04, 0x95, 0x01, 0x81, 0x03,
+    0x05, 0x01, 0x15, 0x01, 0x25, 0x08, 0x35, 0x00, 0x46, 0x3B, 0x01, 0x65, 0x14,
+    0x75, 0x04, 0x95, 0x01, 0x09, 0x39, 0x81, 0x42,
+    0x65, 0x00, 0x75, 0x04, 0x95, 0x01, 0x81, 0x03,
+    0x05, 0x09, 0x19, 0x01, 0x29, 0x10, 0x15, 0x00, 0x25, 0x01,
+    0x75, 0x01, 0x95, 0x10, 0x81, 0x02,
+    0xC0,
+};
+
+const uint32_t kHatFlags[8] = {
+    BTN_FLAG_UP, BTN_FLAG_UP | BTN_FLAG_RIGHT, BTN_FLAG_RIGHT, BTN_FLAG_DOWN | BTN_FLAG_RIGHT,
+    BTN_FLAG_DOWN, BTN_FLAG_DOWN | BTN_FLAG_LEFT, BTN_FLAG_LEFT, BTN_FLAG_UP | BTN_FLAG_LEFT,
+};
+
+// 按 Usage 绑定时 Button 1-12 的含义（hid_report_plan.cpp 的 DirectInput 默认顺序；7/8 为数字扳机）
+const uint32_t kUsageButtonFlags[12] = {
+    BTN_FLAG_X, BTN_FLAG_A, BTN_FLAG_B, BTN_FLAG_Y, BTN_FLAG_LB, BTN_FLAG_RB,
+    0, 0, BTN_FLAG_BACK, BTN_FLAG_START, BTN_FLAG_LS_CLK, BTN_FLAG_RS_CLK,
+};
+
+struct Lcg {
+    uint32_t state;
+    explicit Lcg(uint32_t seed) : state(seed) {}
+    uint32_t Next() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    }
+};
+
+struct Report8 {
+    uint8_t bytes[8];
+};
+
+std::vector<Report8> MakeDinputReports(int count) {
+    Lcg rng(5);
+    std::vector<Report8> reports(count);
+    for (Report8& r : reports) {
+        for (int i = 0; i < 4; i++) r.bytes[i] = static_cast<uint8_t>(rng.Next());
+        r.bytes[4] = static_cast<uint8_t>(rng.Next() & 0x0F);       // 8..15 为中立
+        uint32_t buttons = rng.Next() & 0x0FFF;
+        r.bytes[5] = static_cast<uint8_t>(buttons);
+        r.bytes[6] = static_cast<uint8_t>(buttons >> 8);
+        r.bytes[7] = static_cast<uint8_t>(rng.Next());
+    }
+    return reports;
+}
+
+int16_t Stick8(uint8_t v) {
+    return static_cast<int16_t>(v * 257 - 32768);
+}
+
+bool ButtonPressed(const Report8& r, int index) {
+    return ((r.bytes[5] | (r.bytes[6] << 8)) >> index) & 1;
+}
+
+uint32_t HatButtons(uint8_t hat) {
+    return hat < 8 ? kHatFlags[hat] : 0;
+}
+
+bool CheckUsagePlan(const Report8& r, const NapiGamepadState& s) {
+    uint32_t buttons = HatButtons(r.bytes[4] & 0x0F);
+    for (int i = 0; i < 12; i++) {
+        if (ButtonPressed(r, i)) buttons |= kUsageButtonFlags[i];
+    }
+    return s.leftStickX == Stick8(r.bytes[0]) && s.leftStickY == Stick8(r.bytes[1])
+        && s.rightStickX == Stick8(r.bytes[2]) && s.rightStickY == Stick8(r.bytes[3])
+        && s.buttons == buttons
+        && s.leftTrigger == (ButtonPressed(r, 6) ? 255 : 0)
+        && s.rightTrigger == (ButtonPressed(r, 7) ? 255 : 0);
+}
+
+// SDL 映射的 b# / a# / h# 按描述符序号解析
+bool CheckSdlPlan(const GamepadMapping& m, const Report8& r, const NapiGamepadState& s) {
+    const uint32_t hat = HatButtons(r.bytes[4] & 0x0F);
+    uint32_t buttons = 0;
+    struct {
+        const MappingSource* src;
+        uint32_t flag;
+        uint32_t hatFlag;
+    } const binds[] = {
+        {&m.a, BTN_FLAG_A, 0}, {&m.b, BTN_FLAG_B, 0}, {&m.x, BTN_FLAG_X, 0}, {&m.y, BTN_FLAG_Y, 0},
+        {&m.back, BTN_FLAG_BACK, 0}, {&m.guide, BTN_FLAG_HOME, 0}, {&m.start, BTN_FLAG_START, 0},
+        {&m.leftstick, BTN_FLAG_LS_CLK, 0}, {&m.rightstick, BTN_FLAG_RS_CLK, 0},
+        {&m.leftshoulder, BTN_FLAG_LB, 0}, {&m.rightshoulder, BTN_FLAG_RB, 0},
+        {&m.dpup, BTN_FLAG_UP, BTN_FLAG_UP}, {&m.dpdown, BTN_FLAG_DOWN, BTN_FLAG_DOWN},
+        {&m.dpleft, BTN_FLAG_LEFT, BTN_FLAG_LEFT}, {&m.dpright, BTN_FLAG_RIGHT, BTN_FLAG_RIGHT},
+    };
+    for (const auto& bind : binds) {
+        if (bind.src->type == MAPPING_BUTTON && bind.src->index < 12 && ButtonPressed(r, bind.src->index)) {
+            buttons |= bind.flag;
+        } else if (bind.src->type == MAPPING_HAT && bind.src->index == 0) {
+            buttons |= hat & bind.hatFlag;
+        }
+    }
+    auto trigger = [&](const MappingSource& src) -> int {
+        return src.type == MAPPING_BUTTON && src.index < 12 && ButtonPressed(r, src.index) ? 255 : 0;
+    };
+    return s.leftStickX == Stick8(r.bytes[m.leftx.index]) && s.leftStickY == Stick8(r.bytes[m.lefty.index])
+        && s.rightStickX == Stick8(r.bytes[m.rightx.index]) && s.rightStickY == Stick8(r.bytes[m.righty.index])
+        && s.buttons == buttons
+        && s.leftTrigger == trigger(m.lefttrigger) && s.rightTrigger == trigger(m.righttrigger);
+}
+
+template <typename Fn>
+void MeasureParser(bench::Report& report, const char* parser, const std::vector<Report8>& reports, Fn parse) {
+    NapiGamepadState state = {};
+    const size_t mask = reports.size() - 1;
+    bench::Stats stats = bench::MeasurePerCall(report.Scale(200, 20), 5000, [&](int i) {
+        parse(reports[static_cast<size_t>(i) & mask].bytes, &state);
+        bench::DoNotOptimize(state.buttons);
+    });
+    report.Add().Set("test", "dinput_8byte").Set("parser", parser).Set("ns_per_report", stats);
+}
+
+void DinputThroughput(bench::Report& report) {
+    const GamepadMapping* sdlMapping = findGamepadMapping(kSdlVid, kSdlPid);
+    report.Check(findGamepadMapping(kUnknownVid, kUnknownPid) == nullptr, "unknown VID/PID has no mapping");
+    if (!report.Check(sdlMapping != nullptr, "SDL mapping for 0079:18D2")) return;
+
+    std::unique_ptr<HidReportPlan> usagePlan(new HidReportPlan());
+    std::unique_ptr<HidReportPlan> sdlPlan(new HidReportPlan());
+    report.Check(HidPlan_Compile(kDinputDescriptor, sizeof(kDinputDescriptor), nullptr, usagePlan.get()),
+                 "compile dinput (usage)");
+    report.Check(HidPlan_Compile(kDinputDescriptor, sizeof(kDinputDescriptor), sdlMapping, sdlPlan.get()),
+                 "compile dinput (sdl)");
+
+    const std::vector<Report8> reports = MakeDinputReports(256);
+    uint64_t usageErrors = 0, sdlErrors = 0;
+    for (const Report8& r : reports) {
+        NapiGamepadState s = {};
+        usageErrors += HidPlan_Apply(usagePlan.get(), r.bytes, 8, &s) != GAMEPAD_REPORT_INPUT || !CheckUsagePlan(r, s);
+        s = {};
+        sdlErrors += HidPlan_Apply(sdlPlan.get(), r.bytes, 8, &s) != GAMEPAD_REPORT_INPUT
+                     || !CheckSdlPlan(*sdlMapping, r, s);
+    }
+    report.Add().Set("test", "dinput_decode").Set("reports", static_cast<uint64_t>(reports.size()))
+          .Set("plan_usage_errors", usageErrors).Set("plan_sdl_errors", sdlErrors);
+    report.Check(usageErrors == 0, "usage plan decodes dinput reports");
+    report.Check(sdlErrors == 0, "sdl plan decodes dinput reports");
+
+    MeasureParser(report, "heuristic", reports, [](const uint8_t* data, NapiGamepadState* state) {
+        GamepadNapi_ParseReport(kGenericType, kUnknownVid, kUnknownPid, data, 8, state);
+    });
+    MeasureParser(report, "sdl", reports, [](const uint8_t* data, NapiGamepadState* state) {
+        GamepadNapi_ParseReport(kGenericType, kSdlVid, kSdlPid, data, 8, state);
+    });
+    const HidReportPlan* usage = usagePlan.get();
+    const HidReportPlan* sdl = sdlPlan.get();
+    MeasureParser(report, "plan_usage", reports, [usage](const uint8_t* data, NapiGamepadState* state) {
+        HidPlan_Apply(usage, data, 8, state);
+    });
+    MeasureParser(report, "plan_sdl", reports, [sdl](const uint8_t* data, NapiGamepadState* state) {
+        HidPlan_Apply(sdl, data, 8, state);
+    });
+
+    std::unique_ptr<HidReportPlan> scratch(new HidReportPlan());
+    bench::Stats compile = bench::MeasurePerCall(report.Scale(50, 10), 100, [&](int) {
+        HidPlan_Compile(kDinputDescriptor, sizeof(kDinputDescriptor), nullptr, scratch.get());
+        bench::DoNotOptimize(scratch->opCount);
+    });
+    report.Add().Set("test", "compile").Set("descriptor", "dinput").Set("ns", compile)
+          .Set("plan_bytes", static_cast<uint64_t>(sizeof(HidReportPlan)))
+          .Set("ops", static_cast<int>(usagePlan->opCount))
+          .Set("button_run", static_cast<int>(usagePlan->buttonRunCount));
+}
+
+void PutLe16(uint8_t* p, int16_t v) {
+    p[0] = static_cast<uint8_t>(v);
+    p[1] = static_cast<uint8_t>(static_cast<uint16_t>(v) >> 8);
+}
+
+/**
+ * Report ID + 16 位轴 + 10 位扳机 + 1..8 HAT：启发式按固定字节布局必然读错
+ */
+void ReportIdLayout(bench::Report& report) {
+    std::unique_ptr<HidReportPlan> plan(new HidReportPlan());
+    if (!report.Check(HidPlan_Compile(kReportIdDescriptor, sizeof(kReportIdDescriptor), nullptr, plan.get()),
+                      "compile report-id layout")) {
+        return;
+    }
+    report.Check(plan->reportId == 1 && plan->minLength == 15, "report-id plan header");
+
+    const int16_t sticks[4] = {-32768, 12345, 32767, -4321};
+    const uint16_t brake = 1023, accel = 300;
+    uint64_t planErrors = 0, heuristicErrors = 0;
+    for (int hat = 0; hat <= 8; hat++) {
+        uint8_t data[15] = {0x01};
+        for (int i = 0; i < 4; i++) PutLe16(data + 1 + 2 * i, sticks[i]);
+        uint32_t triggers = brake | (static_cast<uint32_t>(accel) << 10);
+        data[9] = static_cast<uint8_t>(triggers);
+        data[10] = static_cast<uint8_t>(triggers >> 8);
+        data[11] = static_cast<uint8_t>(triggers >> 16);
+        data[12] = static_cast<uint8_t>(hat);
+        data[13] = 0x02;  // Button 2 → A
+
+        const uint32_t buttons = BTN_FLAG_A | (hat >= 1 ? kHatFlags[hat - 1] : 0);
+        const int expectLt = (brake * 255 + 1022) / 1023;
+        const int expectRt = (accel * 255) / 1023;
+
+        NapiGamepadState s = {};
+        int rc = HidPlan_Apply(plan.get(), data, sizeof(data), &s);
+        bool ok = rc == GAMEPAD_REPORT_INPUT
+               && s.leftStickX == sticks[0] && s.leftStickY == sticks[1]
+               && s.rightStickX == sticks[2] && s.rightStickY == sticks[3]
+               && s.buttons == buttons
+               && std::abs(s.leftTrigger - expectLt) <= 1 && std::abs(s.rightTrigger - expectRt) <= 1;
+        planErrors += !ok;
+
+        NapiGamepadState h = {};
+        GamepadNapi_ParseReport(kGenericType, kUnknownVid, kUnknownPid, data, sizeof(data), &h);
+        heuristicErrors += (h.leftStickX != sticks[0]) + (h.leftStickY != sticks[1])
+                         + (h.rightStickX != sticks[2]) + (h.rightStickY != sticks[3])
+                         + (h.buttons != buttons)
+                         + (std::abs(h.leftTrigger - expectLt) > 1) + (std::abs(h.rightTrigger - expectRt) > 1);
+    }
+
+    // 其他 Report ID 与短报告必须被忽略
+    uint8_t other[15] = {0x02};
+    NapiGamepadState untouched = {};
+    untouched.buttons = 0xABCD;
+    bool ignored = HidPlan_Apply(plan.get(), other, sizeof(other), &untouched) == GAMEPAD_REPORT_IGNORED
+                && HidPlan_Apply(plan.get(), other, 8, &untouched) == GAMEPAD_REPORT_IGNORED
+                && untouched.buttons == 0xABCD;
+
+    report.Add().Set("test", "report_id_layout").Set("reports", 9)
+          .Set("plan_errors", planErrors)
+          .Set("heuristic_wrong_fields", heuristicErrors)
+          .Set("foreign_report_ignored", ignored);
+    report.Check(planErrors == 0, "plan decodes report-id / 16-bit / 10-bit layout");
+    report.Check(ignored, "plan ignores other report IDs and short reports");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bench::Report report("hid_plan", argc, argv);
+    DinputThroughput(report);
+    ReportIdLayout(report);
+    return report.Finish();
+}
@@ -0,0 +1,41 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file log.h
+ * @brief 主机基准测试用 hilog 替身
+ *
+ * 只在 nativelib/bench 中使用。日志全部丢弃，避免 I/O 干扰计时；
+ * 参数不求值，与 release 构建中被关闭的日志级别行为一致。
+ */
+
+#ifndef BENCH_HOST_SHIM_HILOG_LOG_H
+#define BENCH_HOST_SHIM_HILOG_LOG_H
+
+#define LOG_APP 0
+#define LOG_CORE 3
+
+typedef enum {
+    LOG_DEBUG = 3,
+    LOG_INFO = 4,
+    LOG_WARN = 5,
+    LOG_ERROR = 6,
+    LOG_FATAL = 7,
+} LogLevel;
+
+#define OH_LOG_DEBUG(type, ...) ((void)0)
+#define OH_LOG_INFO(type, ...) ((void)0)
+#define OH_LOG_WARN(type, ...) ((void)0)
+#define OH_LOG_ERROR(type, ...) ((void)0)
+#define OH_LOG_FATAL(type, ...) ((void)0)
+
+static inline int OH_LOG_Print(int, int, unsigned int, const char*, const char*, ...) { return 0; }
+
+#endif // BENCH_HOST_SHIM_HILOG_LOG_H
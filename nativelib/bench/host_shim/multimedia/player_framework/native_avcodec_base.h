@@ -0,0 +1,28 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file native_avcodec_base.h
+ * @brief 主机基准测试用 AVCodec 替身：只提供不透明句柄类型，足以编译引用解码器的头文件
+ */
+
+#ifndef BENCH_HOST_SHIM_NATIVE_AVCODEC_BASE_H
+#define BENCH_HOST_SHIM_NATIVE_AVCODEC_BASE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct OH_AVCodec OH_AVCodec;
+typedef struct OH_AVFormat OH_AVFormat;
+typedef struct OH_AVBuffer OH_AVBuffer;
+typedef struct OH_AVCapability OH_AVCapability;
+typedef int OH_AVErrCode;
+
+#endif // BENCH_HOST_SHIM_NATIVE_AVCODEC_BASE_H
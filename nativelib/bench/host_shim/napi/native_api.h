@@ -0,0 +1,37 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file native_api.h
+ * @brief 主机基准测试用 NAPI 头文件替身
+ *
+ * ArkTS NAPI 与 Node-API 的 C 接口一致。找到 Node 头文件时直接使用
+ * node_api.h（需要编译 NAPI 函数体的基准目标依赖这一点）；否则只提供
+ * 不透明句柄类型，足以包含 gamepad_napi.h 等只含声明的头文件。
+ */
+
+#ifndef BENCH_HOST_SHIM_NAPI_NATIVE_API_H
+#define BENCH_HOST_SHIM_NAPI_NATIVE_API_H
+
+#if defined(BENCH_HAVE_NODE_API)
+#ifndef NAPI_VERSION
+#define NAPI_VERSION 8
+#endif
+#include <node_api.h>
+#else
+#include <stddef.h>     // node_api.h 同样引入，gamepad_napi.h 的声明依赖 size_t
+#include <stdint.h>
+
+typedef struct napi_env__* napi_env;
+typedef struct napi_value__* napi_value;
+typedef struct napi_callback_info__* napi_callback_info;
+#endif
+
+#endif // BENCH_HOST_SHIM_NAPI_NATIVE_API_H
@@ -0,0 +1,21 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file native_buffer.h
+ * @brief 主机基准测试用 NativeBuffer 替身（不透明句柄）
+ */
+
+#ifndef BENCH_HOST_SHIM_NATIVE_BUFFER_H
+#define BENCH_HOST_SHIM_NATIVE_BUFFER_H
+
+typedef struct OH_NativeBuffer OH_NativeBuffer;
+
+#endif // BENCH_HOST_SHIM_NATIVE_BUFFER_H
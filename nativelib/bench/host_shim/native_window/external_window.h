@@ -0,0 +1,26 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file external_window.h
+ * @brief 主机基准测试用 NativeWindow 替身（不透明句柄；函数只声明不实现）
+ */
+
+#ifndef BENCH_HOST_SHIM_EXTERNAL_WINDOW_H
+#define BENCH_HOST_SHIM_EXTERNAL_WINDOW_H
+
+#include <stdint.h>
+
+typedef struct NativeWindow OHNativeWindow;
+typedef struct NativeWindowBuffer OHNativeWindowBuffer;
+
+int32_t OH_NativeWindow_CreateNativeWindowFromSurfaceId(uint64_t surfaceId, OHNativeWindow** window);
+
+#endif // BENCH_HOST_SHIM_EXTERNAL_WINDOW_H
@@ -0,0 +1,50 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file native_audio_routing_manager.h
+ * @brief 主机基准测试用替身：AudioRenderer 路由查询所需的类型
+ *
+ * 查询函数由 audio_renderer.cpp 通过 dlsym 取得，实现见 nativelib/bench/fake_ohaudio.cpp。
+ */
+
+#ifndef BENCH_HOST_SHIM_NATIVE_AUDIO_ROUTING_MANAGER_H
+#define BENCH_HOST_SHIM_NATIVE_AUDIO_ROUTING_MANAGER_H
+
+#include <stdint.h>
+#include "native_audiostream_base.h"
+
+typedef struct OH_AudioRoutingManager OH_AudioRoutingManager;
+typedef struct OH_AudioDeviceDescriptor OH_AudioDeviceDescriptor;
+
+typedef struct OH_AudioDeviceDescriptorArray {
+    uint32_t size;
+    OH_AudioDeviceDescriptor** descriptors;
+} OH_AudioDeviceDescriptorArray;
+
+typedef enum {
+    AUDIOCOMMON_RESULT_SUCCESS = 0,
+    AUDIOCOMMON_RESULT_ERROR_INVALID_PARAM = 6800101,
+    AUDIOCOMMON_RESULT_ERROR_SYSTEM = 6800301,
+} OH_AudioCommon_Result;
+
+typedef enum {
+    AUDIO_DEVICE_TYPE_INVALID = 0,
+    AUDIO_DEVICE_TYPE_EARPIECE = 1,
+    AUDIO_DEVICE_TYPE_SPEAKER = 2,
+    AUDIO_DEVICE_TYPE_WIRED_HEADSET = 3,
+    AUDIO_DEVICE_TYPE_WIRED_HEADPHONES = 4,
+    AUDIO_DEVICE_TYPE_BLUETOOTH_SCO = 7,
+    AUDIO_DEVICE_TYPE_BLUETOOTH_A2DP = 8,
+    AUDIO_DEVICE_TYPE_USB_HEADSET = 22,
+    AUDIO_DEVICE_TYPE_DISPLAY_PORT = 23,
+} OH_AudioDevice_Type;
+
+#endif // BENCH_HOST_SHIM_NATIVE_AUDIO_ROUTING_MANAGER_H
@@ -0,0 +1,21 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file native_audiocapturer.h
+ * @brief 主机基准测试用替身，类型见 native_audiostream_base.h
+ */
+
+#ifndef BENCH_HOST_SHIM_NATIVE_AUDIOCAPTURER_H
+#define BENCH_HOST_SHIM_NATIVE_AUDIOCAPTURER_H
+
+#include "native_audiostream_base.h"
+
+#endif // BENCH_HOST_SHIM_NATIVE_AUDIOCAPTURER_H
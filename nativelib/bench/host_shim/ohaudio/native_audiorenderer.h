@@ -0,0 +1,40 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file native_audiorenderer.h
+ * @brief 主机基准测试用替身：AudioRenderer 直接链接的渲染器函数，类型见 native_audiostream_base.h
+ */
+
+#ifndef BENCH_HOST_SHIM_NATIVE_AUDIORENDERER_H
+#define BENCH_HOST_SHIM_NATIVE_AUDIORENDERER_H
+
+#include <time.h>
+#include "native_audiostream_base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+OH_AudioStream_Result OH_AudioRenderer_Start(OH_AudioRenderer* renderer);
+OH_AudioStream_Result OH_AudioRenderer_Stop(OH_AudioRenderer* renderer);
+OH_AudioStream_Result OH_AudioRenderer_Flush(OH_AudioRenderer* renderer);
+OH_AudioStream_Result OH_AudioRenderer_Release(OH_AudioRenderer* renderer);
+OH_AudioStream_Result OH_AudioRenderer_SetVolume(OH_AudioRenderer* renderer, float volume);
+OH_AudioStream_Result OH_AudioRenderer_GetCurrentState(OH_AudioRenderer* renderer, OH_AudioStream_State* state);
+OH_AudioStream_Result OH_AudioRenderer_GetFramesWritten(OH_AudioRenderer* renderer, int64_t* frames);
+OH_AudioStream_Result OH_AudioRenderer_GetTimestamp(OH_AudioRenderer* renderer, clockid_t clockId,
+                                                    int64_t* framePosition, int64_t* timestamp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BENCH_HOST_SHIM_NATIVE_AUDIORENDERER_H
@@ -0,0 +1,116 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file native_audiostream_base.h
+ * @brief 主机基准测试用 OHAudio 替身：AudioRenderer / MicCapturer 所需的句柄、枚举与回调类型
+ *
+ * 函数实现见 nativelib/bench/fake_ohaudio.cpp（编译为 libohaudio.so，供 dlopen / dlsym 命中）。
+ * 枚举值只需互不相同，不保证与 SDK 一致。
+ */
+
+#ifndef BENCH_HOST_SHIM_NATIVE_AUDIOSTREAM_BASE_H
+#define BENCH_HOST_SHIM_NATIVE_AUDIOSTREAM_BASE_H
+
+#include <stdint.h>
+
+typedef struct OH_AudioRendererStruct OH_AudioRenderer;
+typedef struct OH_AudioCapturerStruct OH_AudioCapturer;
+typedef struct OH_AudioStreamBuilderStruct OH_AudioStreamBuilder;
+
+typedef enum {
+    AUDIOSTREAM_SUCCESS = 0,
+    AUDIOSTREAM_ERROR_INVALID_PARAM = 1,
+    AUDIOSTREAM_ERROR_ILLEGAL_STATE = 2,
+    AUDIOSTREAM_ERROR_SYSTEM = 3,
+} OH_AudioStream_Result;
+
+typedef enum {
+    AUDIOSTREAM_INTERRUPT_FORCE = 0,
+    AUDIOSTREAM_INTERRUPT_SHARE = 1,
+} OH_AudioInterrupt_ForceType;
+
+typedef enum {
+    AUDIOSTREAM_INTERRUPT_HINT_NONE = 0,
+    AUDIOSTREAM_INTERRUPT_HINT_RESUME,
+    AUDIOSTREAM_INTERRUPT_HINT_PAUSE,
+    AUDIOSTREAM_INTERRUPT_HINT_STOP,
+    AUDIOSTREAM_INTERRUPT_HINT_DUCK,
+    AUDIOSTREAM_INTERRUPT_HINT_UNDUCK,
+} OH_AudioInterrupt_Hint;
+
+typedef enum {
+    REASON_UNKNOWN = 0,
+    REASON_NEW_DEVICE_AVAILABLE = 1,
+    REASON_OLD_DEVICE_UNAVAILABLE = 2,
+    REASON_OVERRODE = 3,
+} OH_AudioStream_DeviceChangeReason;
+
+typedef enum {
+    AUDIO_DATA_CALLBACK_RESULT_INVALID = -1,
+    AUDIO_DATA_CALLBACK_RESULT_VALID = 0,
+} OH_AudioData_Callback_Result;
+
+typedef enum {
+    AUDIOSTREAM_TYPE_RENDERER = 1,
+    AUDIOSTREAM_TYPE_CAPTURER = 2,
+} OH_AudioStream_Type;
+
+typedef enum {
+    AUDIOSTREAM_SAMPLE_U8 = 0,
+    AUDIOSTREAM_SAMPLE_S16LE = 1,
+    AUDIOSTREAM_SAMPLE_S24LE = 2,
+    AUDIOSTREAM_SAMPLE_S32LE = 3,
+} OH_AudioStream_SampleFormat;
+
+typedef enum {
+    AUDIOSTREAM_ENCODING_TYPE_RAW = 0,
+} OH_AudioStream_EncodingType;
+
+typedef enum {
+    AUDIOSTREAM_USAGE_UNKNOWN = 0,
+    AUDIOSTREAM_USAGE_MUSIC = 1,
+    AUDIOSTREAM_USAGE_VOICE_COMMUNICATION = 2,
+    AUDIOSTREAM_USAGE_GAME = 11,
+} OH_AudioStream_Usage;
+
+typedef enum {
+    AUDIOSTREAM_LATENCY_MODE_NORMAL = 0,
+    AUDIOSTREAM_LATENCY_MODE_FAST = 1,
+} OH_AudioStream_LatencyMode;
+
+typedef enum {
+    AUDIOSTREAM_STATE_INVALID = -1,
+    AUDIOSTREAM_STATE_NEW = 0,
+    AUDIOSTREAM_STATE_PREPARED = 1,
+    AUDIOSTREAM_STATE_RUNNING = 2,
+    AUDIOSTREAM_STATE_STOPPED = 3,
+    AUDIOSTREAM_STATE_RELEASED = 4,
+    AUDIOSTREAM_STATE_PAUSED = 5,
+} OH_AudioStream_State;
+
+typedef enum {
+    CH_LAYOUT_UNKNOWN = 0x0ULL,
+    CH_LAYOUT_MONO = 0x4ULL,
+    CH_LAYOUT_STEREO = 0x3ULL,
+    CH_LAYOUT_5POINT1 = 0x3FULL,
+    CH_LAYOUT_7POINT1 = 0x63FULL,
+} OH_AudioChannelLayout;
+
+typedef OH_AudioData_Callback_Result (*OH_AudioRenderer_OnWriteDataCallback)(
+    OH_AudioRenderer* renderer, void* userData, void* audioData, int32_t audioDataSize);
+typedef void (*OH_AudioRenderer_OnInterruptCallback)(
+    OH_AudioRenderer* renderer, void* userData, OH_AudioInterrupt_ForceType type, OH_AudioInterrupt_Hint hint);
+typedef void (*OH_AudioRenderer_OnErrorCallback)(
+    OH_AudioRenderer* renderer, void* userData, OH_AudioStream_Result error);
+typedef void (*OH_AudioRenderer_OutputDeviceChangeCallback)(
+    OH_AudioRenderer* renderer, void* userData, OH_AudioStream_DeviceChangeReason reason);
+
+#endif // BENCH_HOST_SHIM_NATIVE_AUDIOSTREAM_BASE_H
@@ -0,0 +1,50 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file native_audiostreambuilder.h
+ * @brief 主机基准测试用替身：AudioRenderer 直接链接的 builder 函数，类型见 native_audiostream_base.h
+ *
+ * 回调设置等可选 API 由 audio_renderer.cpp 通过 dlsym 取得，这里不声明。
+ */
+
+#ifndef BENCH_HOST_SHIM_NATIVE_AUDIOSTREAMBUILDER_H
+#define BENCH_HOST_SHIM_NATIVE_AUDIOSTREAMBUILDER_H
+
+#include "native_audiostream_base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+OH_AudioStream_Result OH_AudioStreamBuilder_Create(OH_AudioStreamBuilder** builder, OH_AudioStream_Type type);
+OH_AudioStream_Result OH_AudioStreamBuilder_Destroy(OH_AudioStreamBuilder* builder);
+OH_AudioStream_Result OH_AudioStreamBuilder_SetSamplingRate(OH_AudioStreamBuilder* builder, int32_t rate);
+OH_AudioStream_Result OH_AudioStreamBuilder_SetChannelCount(OH_AudioStreamBuilder* builder, int32_t channelCount);
+OH_AudioStream_Result OH_AudioStreamBuilder_SetChannelLayout(OH_AudioStreamBuilder* builder,
+                                                             OH_AudioChannelLayout channelLayout);
+OH_AudioStream_Result OH_AudioStreamBuilder_SetSampleFormat(OH_AudioStreamBuilder* builder,
+                                                            OH_AudioStream_SampleFormat format);
+OH_AudioStream_Result OH_AudioStreamBuilder_SetEncodingType(OH_AudioStreamBuilder* builder,
+                                                            OH_AudioStream_EncodingType encodingType);
+OH_AudioStream_Result OH_AudioStreamBuilder_SetRendererInfo(OH_AudioStreamBuilder* builder,
+                                                            OH_AudioStream_Usage usage);
+OH_AudioStream_Result OH_AudioStreamBuilder_SetLatencyMode(OH_AudioStreamBuilder* builder,
+                                                           OH_AudioStream_LatencyMode latencyMode);
+OH_AudioStream_Result OH_AudioStreamBuilder_SetFrameSizeInCallback(OH_AudioStreamBuilder* builder,
+                                                                   int32_t frameSize);
+OH_AudioStream_Result OH_AudioStreamBuilder_GenerateRenderer(OH_AudioStreamBuilder* builder,
+                                                             OH_AudioRenderer** audioRenderer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BENCH_HOST_SHIM_NATIVE_AUDIOSTREAMBUILDER_H
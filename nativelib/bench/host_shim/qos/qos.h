@@ -0,0 +1,37 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file qos.h
+ * @brief 主机基准测试用 QoS 头文件替身：等级枚举与空操作的设置函数
+ */
+
+#ifndef BENCH_HOST_SHIM_QOS_QOS_H
+#define BENCH_HOST_SHIM_QOS_QOS_H
+
+typedef enum QoS_Level {
+    QOS_BACKGROUND = 0,
+    QOS_UTILITY,
+    QOS_DEFAULT,
+    QOS_USER_INITIATED,
+    QOS_DEADLINE_REQUEST,
+    QOS_USER_INTERACTIVE,
+} QoS_Level;
+
+static inline int OH_QoS_SetThreadQoS(QoS_Level level) {
+    (void)level;
+    return 0;
+}
+
+static inline int OH_QoS_ResetThreadQoS(void) {
+    return 0;
+}
+
+#endif // BENCH_HOST_SHIM_QOS_QOS_H
@@ -0,0 +1,317 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file input_batch_bench.js
+ * @brief 逐个 send* 调用对比 submitInputBatch 批量提交（含 JS 侧打包）
+ *
+ * 发送端为 bridge_stubs.cpp 的计数替身，InputScheduler 未启动，鼠标 / 手柄直接到达 LiSend*。
+ * 1. 一致性：同一事件序列分别逐个发送与按 16 条一批提交，LiSend* 调用数与实参哈希必须相同。
+ * 2. 逐个调用：sendMouseMove / sendMultiControllerInput / sendTouchEvent / sendPenEvent 与四者混合的 ns/事件。
+ * 3. 批量：混合事件按 1 / 4 / 16 / 64 条一批打包并提交的 ns/事件（含打包）。
+ * 4. 笔移动：4 个历史点 + 当前点，5 次 sendPenEvent 对比一次提交的 ns/移动。
+ *
+ * 下方 InputBatch 是 InputBatch.ets 的 JS 副本；checkPackerSources 逐条核对副本与 .ets 的字段写入，
+ * 以及 .ets 的标签 / 负载字数与 moonlight_bridge.h / moonlight_bridge.cpp 一致，任一方漂移即检查失败。
+ */
+
+'use strict';
+
+const fs = require('fs');
+const path = require('path');
+const { measurePerCall, Report } = require('./bench_util');
+
+const INPUT_BATCH_ETS = path.join(__dirname, '..', '..', 'entry', 'src', 'main', 'ets', 'service', 'InputBatch.ets');
+const NATIVE_SRC = path.join(__dirname, '..', 'src', 'main', 'cpp');
+
+// 记录标签（与 moonlight_bridge.h 的 INPUT_BATCH_* 一致）
+const TAG_MOUSE_MOVE = 1;
+const TAG_CONTROLLER = 8;
+const TAG_TOUCH = 12;
+const TAG_PEN = 13;
+
+/**
+ * entry/src/main/ets/service/InputBatch.ets 的打包逻辑（基准用到的记录类型）
+ */
+class InputBatch {
+  constructor(addon, initialWords = 256) {
+    this.addon = addon;
+    const buffer = new ArrayBuffer(Math.max(16, initialWords) * 4);
+    this.words = new Int32Array(buffer);
+    this.floats = new Float32Array(buffer);
+    this.length = 0;
+    this.records = 0;
+    this.shortFlushes = 0;
+  }
+
+  mouseMove(deltaX, deltaY) {
+    const o = this.begin(TAG_MOUSE_MOVE, 2);
+    this.words[o] = deltaX;
+    this.words[o + 1] = deltaY;
+  }
+
+  multiControllerInput(controllerNumber, activeGamepadMask, buttonFlags, leftTrigger, rightTrigger,
+    leftStickX, leftStickY, rightStickX, rightStickY) {
+    const o = this.begin(TAG_CONTROLLER, 9);
+    this.words[o] = controllerNumber;
+    this.words[o + 1] = activeGamepadMask;
+    this.words[o + 2] = buttonFlags;
+    this.words[o + 3] = leftTrigger;
+    this.words[o + 4] = rightTrigger;
+    this.words[o + 5] = leftStickX;
+    this.words[o + 6] = leftStickY;
+    this.words[o + 7] = rightStickX;
+    this.words[o + 8] = rightStickY;
+  }
+
+  touchEvent(eventType, pointerId, x, y, pressureOrDistance, contactAreaMajor, contactAreaMinor, rotation) {
+    const o = this.begin(TAG_TOUCH, 8);
+    this.words[o] = eventType;
+    this.words[o + 1] = pointerId;
+    this.floats[o + 2] = x;
+    this.floats[o + 3] = y;
+    this.floats[o + 4] = pressureOrDistance;
+    this.floats[o + 5] = contactAreaMajor;
+    this.floats[o + 6] = contactAreaMinor;
+    this.words[o + 7] = rotation;
+  }
+
+  penEvent(eventType, toolType, penButtons, x, y, pressureOrDistance, contactAreaMajor, contactAreaMinor,
+    rotation, tilt) {
+    const o = this.begin(TAG_PEN, 10);
+    this.words[o] = eventType;
+    this.words[o + 1] = toolType;
+    this.words[o + 2] = penButtons;
+    this.floats[o + 3] = x;
+    this.floats[o + 4] = y;
+    this.floats[o + 5] = pressureOrDistance;
+    this.floats[o + 6] = contactAreaMajor;
+    this.floats[o + 7] = contactAreaMinor;
+    this.words[o + 8] = rotation;
+    this.words[o + 9] = tilt;
+  }
+
+  flush() {
+    if (this.records === 0) return 0;
+    const dispatched = this.addon.submitInputBatch(this.words, this.length);
+    if (dispatched !== this.records) this.shortFlushes++;
+    this.length = 0;
+    this.records = 0;
+    return dispatched;
+  }
+
+  begin(tag, payloadWords) {
+    const needed = this.length + 1 + payloadWords;
+    if (needed > this.words.length) {
+      const buffer = new ArrayBuffer(Math.max(needed, this.words.length * 2) * 4);
+      const words = new Int32Array(buffer);
+      words.set(this.words.subarray(0, this.length));
+      this.words = words;
+      this.floats = new Float32Array(buffer);
+    }
+    this.words[this.length] = (tag << 16) | payloadWords;
+    const offset = this.length + 1;
+    this.length = needed;
+    this.records++;
+    return offset;
+  }
+}
+
+/**
+ * 取出 source 中方法 name 的函数体（按花括号配对）
+ */
+function methodBody(source, name) {
+  const start = source.search(new RegExp(`^\\s*(?:private\\s+)?${name}\\(`, 'm'));
+  if (start < 0) return null;
+  let depth = 0;
+  for (let i = source.indexOf('{', source.indexOf(')', start)); i < source.length; i++) {
+    if (source[i] === '{') depth++;
+    if (source[i] === '}' && --depth === 0) return source.slice(source.indexOf('{', start), i + 1);
+  }
+  return null;
+}
+
+/**
+ * 方法体中与打包格式相关的语句：begin(标签, 负载字数) 与 words / floats 的下标写入
+ */
+function packingStatements(body) {
+  return (body.match(/this\.begin\([^)]*\)|this\.(?:words|floats)\[[^\]]*\]\s*=\s*[^;]+/g) || [])
+    .map((s) => s.replace(/\s+/g, ''));
+}
+
+/**
+ * 核对 JS 副本、InputBatch.ets 与 native 解码表三者的记录格式
+ */
+function checkPackerSources(report) {
+  const ets = fs.readFileSync(INPUT_BATCH_ETS, 'utf8');
+  const header = fs.readFileSync(path.join(NATIVE_SRC, 'moonlight_bridge.h'), 'utf8');
+  const bridge = fs.readFileSync(path.join(NATIVE_SRC, 'moonlight_bridge.cpp'), 'utf8');
+
+  // 标签：.ets 的 TAG_* 与 INPUT_BATCH_* 同名同值，JS 副本用到的标签与 .ets 相同
+  const etsTags = new Map([...ets.matchAll(/^const TAG_(\w+) = (\d+);/gm)].map((m) => [m[1], Number(m[2])]));
+  const nativeTags = new Map([...header.matchAll(/^#define INPUT_BATCH_(\w+)\s+(\d+)/gm)]
+    .filter((m) => m[1] !== 'TAG_COUNT').map((m) => [m[1], Number(m[2])]));
+  const tagMismatches = [...new Set([...etsTags.keys(), ...nativeTags.keys()])]
+    .filter((name) => etsTags.get(name) !== nativeTags.get(name));
+  const jsTags = { MOUSE_MOVE: TAG_MOUSE_MOVE, CONTROLLER: TAG_CONTROLLER, TOUCH: TAG_TOUCH, PEN: TAG_PEN };
+  for (const [name, value] of Object.entries(jsTags)) {
+    if (etsTags.get(name) !== value) tagMismatches.push(`js:${name}`);
+  }
+
+  // 负载字数：.ets 每个 begin(TAG_X, n) 的 n 与 kInputBatchPayloadWords[INPUT_BATCH_X] 相同
+  const table = bridge.slice(bridge.indexOf('kInputBatchPayloadWords['), bridge.indexOf('};', bridge.indexOf('kInputBatchPayloadWords[')));
+  const nativePayload = new Map([...table.matchAll(/(\d+),\s*\/\/\s*INPUT_BATCH_(\w+)/g)].map((m) => [m[2], Number(m[1])]));
+  const etsBegins = [...ets.matchAll(/this\.begin\(TAG_(\w+), (\d+)\)/g)];
+  const payloadMismatches = etsBegins.filter((m) => nativePayload.get(m[1]) !== Number(m[2])).map((m) => m[1]);
+
+  // 字段写入：JS 副本各方法与 .ets 同名方法的打包语句逐条相同
+  const methodMismatches = ['mouseMove', 'multiControllerInput', 'touchEvent', 'penEvent', 'begin'].filter((name) => {
+    const etsBody = methodBody(ets, name);
+    const jsStatements = packingStatements(InputBatch.prototype[name].toString());
+    return !etsBody || JSON.stringify(packingStatements(etsBody)) !== JSON.stringify(jsStatements);
+  });
+
+  report.add({ test: 'packer_sources', ets_tags: etsTags.size, native_tags: nativeTags.size,
+               ets_records: etsBegins.length, tag_mismatches: tagMismatches,
+               payload_mismatches: payloadMismatches, method_mismatches: methodMismatches });
+  report.check(etsTags.size === nativeTags.size && nativeTags.size > 0 && tagMismatches.length === 0,
+               'InputBatch.ets / JS tags match INPUT_BATCH_* in moonlight_bridge.h');
+  report.check(etsBegins.length === nativeTags.size && payloadMismatches.length === 0,
+               'InputBatch.ets payload words match kInputBatchPayloadWords');
+  report.check(methodMismatches.length === 0, 'JS packer writes the same fields as InputBatch.ets');
+}
+
+const KINDS = ['mouse_move', 'controller', 'touch', 'pen'];
+const POOL = 1024;
+
+/**
+ * 预先生成事件（计时循环内不分配对象）；混合序列按 KINDS 轮换
+ */
+function makeEvents(kind) {
+  let state = 0x2545f491;
+  const next = () => {
+    state = (Math.imul(state, 1664525) + 1013904223) >>> 0;
+    return state;
+  };
+  const unit = () => next() / 4294967296;
+  const events = [];
+  for (let i = 0; i < POOL; i++) {
+    const k = kind === 'mixed' ? KINDS[i % KINDS.length] : kind;
+    switch (k) {
+      case 'mouse_move':
+        events.push({ kind: k, args: [(next() % 41) - 20, (next() % 41) - 20] });
+        break;
+      case 'controller':
+        events.push({ kind: k, args: [0, 1, next() & 0xffff, next() & 0xff, next() & 0xff,
+          (next() & 0xffff) - 32768, (next() & 0xffff) - 32768, (next() & 0xffff) - 32768, (next() & 0xffff) - 32768] });
+        break;
+      case 'touch':
+        events.push({ kind: k, args: [1 + (next() % 3), next() % 10, unit(), unit(), unit(),
+          unit() * 0.1, unit() * 0.1, next() % 360] });
+        break;
+      case 'pen':
+        events.push({ kind: k, args: [1 + (next() % 3), 1, next() & 3, unit(), unit(), unit(),
+          unit() * 0.01, unit() * 0.01, next() % 360, next() % 90] });
+        break;
+    }
+  }
+  return events;
+}
+
+function sendEvent(addon, e) {
+  const a = e.args;
+  switch (e.kind) {
+    case 'mouse_move': addon.sendMouseMove(a[0], a[1]); break;
+    case 'controller': addon.sendMultiControllerInput(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8]); break;
+    case 'touch': addon.sendTouchEvent(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]); break;
+    case 'pen': addon.sendPenEvent(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], a[9]); break;
+  }
+}
+
+function pushEvent(batch, e) {
+  const a = e.args;
+  switch (e.kind) {
+    case 'mouse_move': batch.mouseMove(a[0], a[1]); break;
+    case 'controller': batch.multiControllerInput(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8]); break;
+    case 'touch': batch.touchEvent(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]); break;
+    case 'pen': batch.penEvent(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], a[9]); break;
+  }
+}
+
+function main() {
+  const report = new Report('input_batch', process.argv.slice(2));
+  const addon = report.loadAddon();
+  const rounds = report.scale(300, 20);
+  const batch = new InputBatch(addon);
+  checkPackerSources(report);
+  // 先丢弃若干轮让 JIT 完成优化，再正式计时
+  const timed = (iterations, fn) => {
+    measurePerCall(report.scale(50, 5), iterations, fn);
+    return measurePerCall(rounds, iterations, fn);
+  };
+
+  // ---- 一致性 ----
+  for (const kind of [...KINDS, 'mixed']) {
+    const events = makeEvents(kind);
+    addon.stubReset(true);
+    for (const e of events) sendEvent(addon, e);
+    const perCall = addon.stubStats();
+    addon.stubReset(true);
+    let dispatched = 0;
+    for (let i = 0; i < events.length; i++) {
+      pushEvent(batch, events[i]);
+      if ((i + 1) % 16 === 0) dispatched += batch.flush();
+    }
+    dispatched += batch.flush();
+    const batched = addon.stubStats();
+    report.add({ test: 'consistency', kind, events: events.length, dispatched,
+                 per_call_sends: perCall.calls, batch_sends: batched.calls,
+                 per_call_hash: perCall.hash, batch_hash: batched.hash });
+    report.check(dispatched === events.length && perCall.calls === events.length && batched.calls === events.length,
+                 `every ${kind} event reaches LiSend* once`);
+    report.check(perCall.hash === batched.hash, `batched ${kind} arguments identical to per-call`);
+  }
+
+  // ---- 逐个调用（以下计时阶段替身只计数）----
+  addon.stubReset(false);
+  for (const kind of [...KINDS, 'mixed']) {
+    const events = makeEvents(kind);
+    const stats = timed(POOL, (i) => sendEvent(addon, events[i]));
+    report.add({ test: 'per_call', kind, ns_per_event: stats });
+  }
+
+  // ---- 批量（混合事件，含打包）----
+  const mixed = makeEvents('mixed');
+  for (const perBatch of [1, 4, 16, 64]) {
+    const stats = timed(POOL, (i) => {
+      pushEvent(batch, mixed[i]);
+      if ((i + 1) % perBatch === 0) batch.flush();
+    });
+    report.add({ test: 'batch', kind: 'mixed', records_per_batch: perBatch, ns_per_event: stats });
+  }
+
+  // ---- 笔移动：4 个历史点 + 当前点 ----
+  const pen = makeEvents('pen');
+  const points = 5;
+  const moves = POOL / points | 0;
+  const perCallMove = timed(moves, (m) => {
+    for (let p = 0; p < points; p++) sendEvent(addon, pen[m * points + p]);
+  });
+  const batchMove = timed(moves, (m) => {
+    for (let p = 0; p < points; p++) pushEvent(batch, pen[m * points + p]);
+    batch.flush();
+  });
+  report.add({ test: 'pen_move', points, per_call_ns_per_move: perCallMove, batch_ns_per_move: batchMove });
+
+  report.check(batch.shortFlushes === 0, 'submitInputBatch dispatches every packed record');
+  report.finish();
+}
+
+main();
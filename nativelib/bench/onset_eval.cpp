@@ -0,0 +1,411 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file onset_eval.cpp
+ * @brief onset 后端评估：准确率（precision / recall / F1）、起音到标记的延迟、每 hop 耗时、内存占用
+ *
+ * 用于在 MOONLIGHT_ONSET_BACKEND 的各选项之间做取舍：
+ *   spectral → SpectralOnsetDetector（始终评估）
+ *   aubio    → AubioOnsetWrapper（aubio 子模块已检出时评估，见 CMakeLists.txt）
+ *
+ * 输入：
+ *   - 内置合成语料（带标注）：底鼓、鼓组、游戏爆炸、音符、稳态噪声（无 onset，只计误报）
+ *   - 可选 WAV 文件（16-bit PCM，任意声道）：标注放在同名 .onsets 文件中，
+ *     每行一个起音时间（秒），# 开头为注释
+ *
+ * 与 BassEnergyAnalyzer 的调用方式一致：每次送入 5ms 交错 PCM，后端内部按 hop 累积。
+ * 检测时间取发出标记的那一帧的结束时刻（即运行时振动能被触发的最早时刻）。
+ * 标注 t 与标记 d 匹配的条件：t - 50ms <= d <= t + 50ms + 100ms（后者为允许的分析延迟），
+ * 每个标注、每个标记最多匹配一次。延迟 = d - t，只统计匹配上的标记。
+ */
+
+#include "bench_util.h"
+
+#include "spectral_onset_detector.h"
+#if defined(BENCH_HAVE_AUBIO)
+#include "aubio_onset_wrapper.h"
+#endif
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int kSampleRate = 48000;
+constexpr double kToleranceSec = 0.050;
+constexpr double kMaxDelaySec = 0.100;
+
+// 回归门限（spectral 后端，内置合成语料）
+constexpr double kMinRecall = 0.8;
+constexpr uint64_t kSteadyMaxFalse = 2;
+
+/**
+ * 一段带标注的测试音频（交错 int16）
+ */
+struct Clip {
+    std::string name;
+    int sampleRate = kSampleRate;
+    int channels = 2;
+    std::vector<int16_t> pcm;
+    std::vector<double> onsets;     // 秒
+};
+
+struct Lcg {
+    uint32_t state;
+    explicit Lcg(uint32_t seed) : state(seed) {}
+    uint32_t Next() {
+        state = state * 1664525u + 1013904223u;
+        return state;
+    }
+    double Uniform() { return (Next() >> 8) * (1.0 / 16777216.0); }
+    double Signed() { return Uniform() * 2.0 - 1.0; }
+};
+
+// =============================================================================
+// 合成语料
+// =============================================================================
+
+/**
+ * 单声道浮点缓冲，最后转为立体声 int16
+ */
+struct Mono {
+    std::vector<float> s;
+    explicit Mono(double seconds) : s(static_cast<size_t>(seconds * kSampleRate), 0.0f) {}
+
+    void Kick(double t, float gain) {
+        size_t start = static_cast<size_t>(t * kSampleRate);
+        for (size_t i = 0; i < static_cast<size_t>(0.25 * kSampleRate) && start + i < s.size(); i++) {
+            double x = static_cast<double>(i) / kSampleRate;
+            // 瞬时频率 50 + 100·e^(-x/20ms) Hz（音高下滑），相位为其积分
+            double phase = 2.0 * M_PI * (50.0 * x + 100.0 * 0.02 * (1.0 - std::exp(-x / 0.02)));
+            s[start + i] += gain * static_cast<float>(std::exp(-x / 0.06) * std::sin(phase));
+        }
+    }
+
+    void NoiseBurst(double t, float gain, double decaySec, double lengthSec, Lcg& rng, float toneHz = 0.0f) {
+        size_t start = static_cast<size_t>(t * kSampleRate);
+        for (size_t i = 0; i < static_cast<size_t>(lengthSec * kSampleRate) && start + i < s.size(); i++) {
+            double x = static_cast<double>(i) / kSampleRate;
+            double env = std::exp(-x / decaySec);
+            double body = rng.Signed();
+            if (toneHz > 0) body = 0.5 * body + 0.5 * std::sin(2.0 * M_PI * toneHz * x);
+            s[start + i] += gain * static_cast<float>(env * body);
+        }
+    }
+
+    void Note(double t, float gain, double hz, double lengthSec) {
+        size_t start = static_cast<size_t>(t * kSampleRate);
+        for (size_t i = 0; i < static_cast<size_t>(lengthSec * kSampleRate) && start + i < s.size(); i++) {
+            double x = static_cast<double>(i) / kSampleRate;
+            double env = std::min(1.0, x / 0.003) * std::exp(-x / 0.35);
+            double v = std::sin(2.0 * M_PI * hz * x) + 0.5 * std::sin(4.0 * M_PI * hz * x)
+                + 0.25 * std::sin(6.0 * M_PI * hz * x);
+            s[start + i] += gain * static_cast<float>(env * v);
+        }
+    }
+
+    void Noise(float gain, Lcg& rng) {
+        for (float& v : s) v += gain * static_cast<float>(rng.Signed());
+    }
+
+    void Hum(float gain, double hz) {
+        for (size_t i = 0; i < s.size(); i++) {
+            double phase = std::fmod(hz * static_cast<double>(i) / kSampleRate, 1.0);
+            s[i] += gain * static_cast<float>(2.0 * phase - 1.0);   // 锯齿波（引擎声）
+        }
+    }
+
+    Clip ToClip(const std::string& name, std::vector<double> onsets) const {
+        Clip clip;
+        clip.name = name;
+        clip.onsets = std::move(onsets);
+        clip.pcm.resize(s.size() * 2);
+        for (size_t i = 0; i < s.size(); i++) {
+            float v = std::max(-1.0f, std::min(1.0f, s[i]));
+            clip.pcm[2 * i] = static_cast<int16_t>(v * 32767.0f);
+            clip.pcm[2 * i + 1] = static_cast<int16_t>(v * 0.9f * 32767.0f);
+        }
+        return clip;
+    }
+};
+
+std::vector<Clip> SyntheticCorpus(double seconds) {
+    std::vector<Clip> clips;
+    Lcg rng(20240601);
+
+    {   // 120 BPM 底鼓 + 低噪声
+        Mono m(seconds);
+        std::vector<double> onsets;
+        for (double t = 0.5; t < seconds - 0.3; t += 0.5) {
+            m.Kick(t, 0.8f);
+            onsets.push_back(t);
+        }
+        m.Noise(0.01f, rng);
+        clips.push_back(m.ToClip("kick-120bpm", onsets));
+    }
+    {   // 鼓组：底鼓 / 军鼓 / 踩镲，100 BPM 八分音符
+        Mono m(seconds);
+        std::vector<double> onsets;
+        const double eighth = 60.0 / 100.0 / 2.0;
+        int step = 0;
+        for (double t = 0.5; t < seconds - 0.3; t += eighth, step++) {
+            if (step % 4 == 0) m.Kick(t, 0.7f);
+            if (step % 4 == 2) m.NoiseBurst(t, 0.45f, 0.05, 0.2, rng, 190.0f);
+            m.NoiseBurst(t, 0.12f, 0.012, 0.05, rng);
+            onsets.push_back(t);
+        }
+        m.Noise(0.005f, rng);
+        clips.push_back(m.ToClip("drum-kit", onsets));
+    }
+    {   // 游戏：引擎轰鸣 + 随机间隔爆炸 / 枪声
+        Mono m(seconds);
+        std::vector<double> onsets;
+        m.Hum(0.08f, 82.0);
+        m.Noise(0.02f, rng);
+        for (double t = 0.6; t < seconds - 0.5; t += 0.3 + rng.Uniform() * 1.2) {
+            bool explosion = rng.Uniform() < 0.4;
+            if (explosion) {
+                m.NoiseBurst(t, 0.8f, 0.25, 0.8, rng, 45.0f);
+            } else {
+                m.NoiseBurst(t, 0.6f, 0.03, 0.12, rng);
+            }
+            onsets.push_back(t);
+        }
+        clips.push_back(m.ToClip("game-fx", onsets));
+    }
+    {   // 音符：泛音丰富的拨弦音，随机间隔与音高
+        Mono m(seconds);
+        std::vector<double> onsets;
+        static const double kScale[] = { 196.0, 220.0, 246.9, 261.6, 293.7, 329.6, 392.0 };
+        for (double t = 0.4; t < seconds - 0.5; t += 0.2 + rng.Uniform() * 0.4) {
+            m.Note(t, 0.3f, kScale[rng.Next() % 7], 0.8);
+            onsets.push_back(t);
+        }
+        clips.push_back(m.ToClip("plucked-notes", onsets));
+    }
+    {   // 稳态：持续噪声 + 音调，无起音（只统计误报）
+        Mono m(seconds);
+        m.Noise(0.1f, rng);
+        m.Hum(0.05f, 110.0);
+        clips.push_back(m.ToClip("steady-noise", {}));
+    }
+    return clips;
+}
+
+// =============================================================================
+// WAV 输入
+// =============================================================================
+
+bool LoadWav(const std::string& path, Clip& clip, std::string& error) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        error = "cannot open";
+        return false;
+    }
+    std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (data.size() < 12 || memcmp(data.data(), "RIFF", 4) != 0 || memcmp(data.data() + 8, "WAVE", 4) != 0) {
+        error = "not a RIFF/WAVE file";
+        return false;
+    }
+    auto u16 = [&](size_t o) { return static_cast<uint32_t>(static_cast<uint8_t>(data[o]) |
+                                                            (static_cast<uint8_t>(data[o + 1]) << 8)); };
+    auto u32 = [&](size_t o) { return u16(o) | (u16(o + 2) << 16); };
+
+    int format = 0;
+    int bits = 0;
+    size_t pos = 12;
+    while (pos + 8 <= data.size()) {
+        uint32_t chunkSize = u32(pos + 4);
+        size_t body = pos + 8;
+        if (body + chunkSize > data.size()) chunkSize = static_cast<uint32_t>(data.size() - body);
+        if (memcmp(data.data() + pos, "fmt ", 4) == 0 && chunkSize >= 16) {
+            format = static_cast<int>(u16(body));
+            clip.channels = static_cast<int>(u16(body + 2));
+            clip.sampleRate = static_cast<int>(u32(body + 4));
+            bits = static_cast<int>(u16(body + 14));
+            if (format == 0xFFFE && chunkSize >= 26) format = static_cast<int>(u16(body + 24));
+        } else if (memcmp(data.data() + pos, "data", 4) == 0) {
+            if (format != 1 || bits != 16 || clip.channels <= 0) {
+                error = "only 16-bit PCM is supported";
+                return false;
+            }
+            clip.pcm.resize(chunkSize / 2);
+            memcpy(clip.pcm.data(), data.data() + body, clip.pcm.size() * 2);
+            return true;
+        }
+        pos = body + chunkSize + (chunkSize & 1);
+    }
+    error = "no data chunk";
+    return false;
+}
+
+bool LoadLabels(const std::string& wavPath, std::vector<double>& onsets, std::string& labelPath) {
+    size_t dot = wavPath.find_last_of('.');
+    labelPath = (dot == std::string::npos ? wavPath : wavPath.substr(0, dot)) + ".onsets";
+    std::ifstream in(labelPath);
+    if (!in) return false;
+    std::string line;
+    while (std::getline(in, line)) {
+        size_t start = line.find_first_not_of(" \t\r");
+        if (start == std::string::npos || line[start] == '#') continue;
+        std::istringstream iss(line.substr(start));
+        double t;
+        if (iss >> t) onsets.push_back(t);
+    }
+    return true;
+}
+
+// =============================================================================
+// 评估
+// =============================================================================
+
+struct Score {
+    uint64_t labels = 0;
+    uint64_t detections = 0;
+    uint64_t matched = 0;
+    std::vector<uint64_t> latencyUs;
+};
+
+/**
+ * 按时间顺序贪心匹配：每个标注取窗口内最早的未匹配标记
+ */
+void MatchOnsets(const std::vector<double>& labels, const std::vector<double>& detections, Score& score) {
+    score.labels += labels.size();
+    score.detections += detections.size();
+    size_t next = 0;
+    for (double t : labels) {
+        while (next < detections.size() && detections[next] < t - kToleranceSec) next++;
+        if (next < detections.size() && detections[next] <= t + kToleranceSec + kMaxDelaySec) {
+            double latency = detections[next] - t;
+            score.latencyUs.push_back(static_cast<uint64_t>(std::max(0.0, latency) * 1e6));
+            score.matched++;
+            next++;
+        }
+    }
+}
+
+/**
+ * 评估一个后端并写出逐段与汇总结果
+ * @return 逐段得分（与 clips 一一对应）
+ */
+template <typename Backend>
+std::vector<Score> EvaluateBackend(bench::Report& report, const char* backendName, const std::vector<Clip>& clips) {
+    std::vector<Score> scores;
+    Score total;
+    std::vector<uint64_t> hopNsAll;
+
+    for (const Clip& clip : clips) {
+        const int hop = clip.sampleRate / 200;     // 5ms，与 Opus 帧一致
+        std::unique_ptr<Backend> detector(new Backend());
+        detector->Init(clip.sampleRate, hop, "specflux");
+
+        const int frames = static_cast<int>(clip.pcm.size() / clip.channels / hop);
+        std::vector<double> detections;
+        std::vector<uint64_t> hopNs;
+        hopNs.reserve(frames);
+        detections.reserve(frames);
+        for (int f = 0; f < frames; f++) {
+            bool onset = false;
+            const int16_t* pcm = clip.pcm.data() + static_cast<size_t>(f) * hop * clip.channels;
+            uint64_t t0 = bench::NowNs();
+            detector->ProcessFrame(pcm, hop, clip.channels, onset);
+            hopNs.push_back(bench::NowNs() - t0);
+            if (onset) {
+                detections.push_back(static_cast<double>((f + 1) * hop) / clip.sampleRate);
+            }
+        }
+
+        Score score;
+        MatchOnsets(clip.onsets, detections, score);
+        total.labels += score.labels;
+        total.detections += score.detections;
+        total.matched += score.matched;
+        total.latencyUs.insert(total.latencyUs.end(), score.latencyUs.begin(), score.latencyUs.end());
+        hopNsAll.insert(hopNsAll.end(), hopNs.begin(), hopNs.end());
+
+        double precision = score.detections ? static_cast<double>(score.matched) / score.detections : 1.0;
+        double recall = score.labels ? static_cast<double>(score.matched) / score.labels : 1.0;
+        bench::Record& r = report.Add();
+        r.Set("backend", backendName)
+         .Set("clip", clip.name)
+         .Set("labels", score.labels)
+         .Set("detections", score.detections)
+         .Set("matched", score.matched)
+         .Set("precision", precision)
+         .Set("recall", recall)
+         .Set("latency_us", bench::Summarize(score.latencyUs))
+         .Set("hop_ns", bench::Summarize(hopNs));
+        scores.push_back(std::move(score));
+    }
+
+    double precision = total.detections ? static_cast<double>(total.matched) / total.detections : 1.0;
+    double recall = total.labels ? static_cast<double>(total.matched) / total.labels : 1.0;
+    double f1 = (precision + recall) > 0 ? 2.0 * precision * recall / (precision + recall) : 0.0;
+    bench::Record& r = report.Add();
+    r.Set("backend", backendName)
+     .Set("clip", "all")
+     .Set("labels", total.labels)
+     .Set("detections", total.detections)
+     .Set("matched", total.matched)
+     .Set("precision", precision)
+     .Set("recall", recall)
+     .Set("f1", f1)
+     .Set("latency_us", bench::Summarize(total.latencyUs))
+     .Set("hop_ns", bench::Summarize(hopNsAll))
+     .Set("state_bytes", static_cast<uint64_t>(sizeof(Backend)));
+    return scores;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bench::Report report("onset_eval", argc, argv, true);
+
+    std::vector<Clip> clips = SyntheticCorpus(report.Quick() ? 8.0 : 30.0);
+    const size_t syntheticCount = clips.size();
+    for (const std::string& path : report.Inputs()) {
+        Clip clip;
+        std::string error;
+        std::string labelPath;
+        clip.name = path;
+        if (!report.Check(LoadWav(path, clip, error), path + ": " + error)) continue;
+        if (!report.Check(LoadLabels(path, clip.onsets, labelPath), labelPath + ": missing label file")) continue;
+        clips.push_back(std::move(clip));
+    }
+
+    std::vector<Score> spectral = EvaluateBackend<SpectralOnsetDetector>(report, "spectral", clips);
+#if defined(BENCH_HAVE_AUBIO)
+    EvaluateBackend<AubioOnsetWrapper>(report, "aubio", clips);
+#endif
+
+    // 回归门限（只针对内置合成语料，下标与 SyntheticCorpus 的顺序一致）
+    for (size_t i = 0; i < syntheticCount; i++) {
+        const Score& s = spectral[i];
+        const std::string& name = clips[i].name;
+        if (name == "kick-120bpm") {
+            report.Check(s.matched == s.labels, "spectral: every kick detected");
+            report.Check(s.detections <= s.labels + 1, "spectral: no spurious kick detections");
+        } else if (name == "steady-noise") {
+            report.Check(s.detections <= kSteadyMaxFalse, "spectral: false onsets on steady noise");
+        } else {
+            report.Check(s.labels > 0 && s.matched >= kMinRecall * s.labels,
+                         "spectral: recall on " + name);
+        }
+    }
+
+    return report.Finish();
+}
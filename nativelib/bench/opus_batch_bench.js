@@ -0,0 +1,179 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file opus_batch_bench.js
+ * @brief opusEncoderEncode（逐帧）对比 opusEncoderEncodeBatch（整块写入复用缓冲）
+ *
+ * 麦克风路径的模型：每次采集回调得到 8 帧 20ms 单声道 PCM（复用的 ArrayBuffer）。
+ * 1. 一致性：两个新建编码器分别走两条路径，逐包比较字节（必须完全一致）。
+ * 2. 耗时：每次迭代的 ns/帧；逐帧路径每帧 slice 一次 PCM 并得到一个新 ArrayBuffer，
+ *    批量路径只做一次调用，输出写入调用方持有的 ArrayBuffer + Int32Array。
+ * 3. GC：PerformanceObserver('gc') 统计每轮的 GC 次数与累计耗时。
+ */
+
+'use strict';
+
+const { PerformanceObserver, performance } = require('perf_hooks');
+const { nowNs, summarize, Report } = require('./bench_util');
+
+const SAMPLE_RATE = 48000;
+const CHANNELS = 1;
+const BITRATE = 64000;
+const FRAME_BYTES = SAMPLE_RATE / 50 * CHANNELS * 2;   // 20ms int16
+const FRAMES_PER_CAPTURE = 8;
+const MAX_PACKET_BYTES = 1275;                         // 与 moonlight_bridge.cpp 的 kOpusMaxPacketBytes 一致
+const POOL_FRAMES = 400;                               // 8 秒合成语音，循环使用
+
+/**
+ * 合成类语音信号：基频 120~220Hz 缓慢滑动、三个共振峰谐波、音节包络与底噪
+ */
+function makePcmPool() {
+  const samples = POOL_FRAMES * FRAME_BYTES / 2;
+  const pcm = new Int16Array(samples);
+  let state = 7;
+  const noise = () => {
+    state = (Math.imul(state, 1664525) + 1013904223) >>> 0;
+    return (state >>> 8) / 8388608 - 1;
+  };
+  let phase = 0;
+  for (let i = 0; i < samples; i++) {
+    const t = i / SAMPLE_RATE;
+    phase += 2 * Math.PI * (170 + 50 * Math.sin(2 * Math.PI * 0.7 * t)) / SAMPLE_RATE;
+    const syllable = Math.max(0, Math.sin(2 * Math.PI * 3 * t));
+    const voice = 0.5 * Math.sin(phase) + 0.25 * Math.sin(3 * phase) + 0.12 * Math.sin(7 * phase);
+    pcm[i] = Math.round(12000 * (syllable * voice + 0.02 * noise()));
+  }
+  return new Uint8Array(pcm.buffer);
+}
+
+class GcCounter {
+  constructor() {
+    this.entries = [];
+    this.observer = new PerformanceObserver((list) => {
+      for (const entry of list.getEntries()) this.entries.push(entry);
+    });
+    this.observer.observe({ entryTypes: ['gc'] });
+  }
+
+  /** [from, to] 区间内开始的 GC（entry 异步送达，调用前先 await flushGcEntries()） */
+  between(from, to) {
+    const inRange = this.entries.filter((e) => e.startTime >= from && e.startTime <= to);
+    return { count: inRange.length, ms: inRange.reduce((sum, e) => sum + e.duration, 0) };
+  }
+
+  stop() {
+    this.observer.disconnect();
+  }
+}
+
+// gc entry 在之后的某次事件循环中才送达，setImmediate 不够，等一个短定时器
+const flushGcEntries = () => new Promise((resolve) => setTimeout(resolve, 50));
+
+/**
+ * 逐帧路径：与改动前 ArkTS 麦克风代码相同，每帧 slice 出独立的 ArrayBuffer 再编码
+ */
+function encodePerFrame(addon, handle, capture, packets) {
+  for (let f = 0; f < FRAMES_PER_CAPTURE; f++) {
+    const packet = addon.opusEncoderEncode(handle, capture.slice(f * FRAME_BYTES, (f + 1) * FRAME_BYTES));
+    if (packets) packets.push(packet ? new Uint8Array(packet) : null);
+  }
+}
+
+/**
+ * 批量路径：一次调用编码整块，输出写入复用的 output / layout
+ */
+function encodeBatch(addon, handle, capture, output, layout, packets) {
+  const frames = addon.opusEncoderEncodeBatch(handle, capture, output, layout);
+  if (packets) {
+    for (let f = 0; f < frames; f++) {
+      packets.push(new Uint8Array(output, layout[f * 2], layout[f * 2 + 1]).slice());
+    }
+  }
+  return frames;
+}
+
+async function main() {
+  const report = new Report('opus_batch', process.argv.slice(2));
+  const addon = report.loadAddon();
+  const pool = makePcmPool();
+  const capture = new ArrayBuffer(FRAMES_PER_CAPTURE * FRAME_BYTES);
+  const captureBytes = new Uint8Array(capture);
+  const output = new ArrayBuffer(FRAMES_PER_CAPTURE * MAX_PACKET_BYTES);
+  const layout = new Int32Array(FRAMES_PER_CAPTURE * 2);
+  const capturesPerPool = POOL_FRAMES / FRAMES_PER_CAPTURE;
+  const fillCapture = (i) => {
+    const offset = (i % capturesPerPool) * capture.byteLength;
+    captureBytes.set(pool.subarray(offset, offset + capture.byteLength));
+  };
+
+  // ---- 一致性：各用一个新编码器跑完整个合成语料 ----
+  const perFrameHandle = addon.opusEncoderCreate(SAMPLE_RATE, CHANNELS, BITRATE);
+  const batchHandle = addon.opusEncoderCreate(SAMPLE_RATE, CHANNELS, BITRATE);
+  report.check(perFrameHandle > 0 && batchHandle > 0, 'encoder handles created');
+  const perFramePackets = [];
+  const batchPackets = [];
+  let shortBatches = 0;
+  for (let i = 0; i < capturesPerPool; i++) {
+    fillCapture(i);
+    encodePerFrame(addon, perFrameHandle, capture, perFramePackets);
+    if (encodeBatch(addon, batchHandle, capture, output, layout, batchPackets) !== FRAMES_PER_CAPTURE) {
+      shortBatches++;
+    }
+  }
+  let mismatches = 0, encodedBytes = 0;
+  for (let f = 0; f < POOL_FRAMES; f++) {
+    const a = perFramePackets[f], b = batchPackets[f];
+    if (!a || !b || a.length !== b.length || a.some((v, k) => v !== b[k])) mismatches++;
+    if (a) encodedBytes += a.length;
+  }
+  addon.opusEncoderDestroy(perFrameHandle);
+  addon.opusEncoderDestroy(batchHandle);
+  report.add({ test: 'consistency', frames: POOL_FRAMES, short_batches: shortBatches,
+               packet_mismatches: mismatches, mean_packet_bytes: encodedBytes / POOL_FRAMES });
+  report.check(shortBatches === 0, 'every batch encodes all frames');
+  report.check(batchPackets.length === POOL_FRAMES && mismatches === 0, 'batch packets byte-identical to per-frame');
+
+  // ---- 耗时与 GC：每轮新建编码器，两条路径交替运行 ----
+  const runs = report.scale(3, 1);
+  const captures = report.scale(3000, 100);
+  const gc = new GcCounter();
+  const paths = [
+    ['per_frame', (handle) => encodePerFrame(addon, handle, capture, null)],
+    ['batch', (handle) => encodeBatch(addon, handle, capture, output, layout, null)],
+  ];
+  for (let run = 0; run < runs; run++) {
+    for (const [name, encode] of paths) {
+      const handle = addon.opusEncoderCreate(SAMPLE_RATE, CHANNELS, BITRATE);
+      const samples = [];
+      const from = performance.now();
+      const start = nowNs();
+      for (let i = 0; i < captures; i++) {
+        fillCapture(i);
+        const t0 = nowNs();
+        encode(handle);
+        samples.push(Number(nowNs() - t0) / FRAMES_PER_CAPTURE);
+      }
+      const elapsed = Number(nowNs() - start);
+      const to = performance.now();
+      addon.opusEncoderDestroy(handle);
+      await flushGcEntries();
+      const gcs = gc.between(from, to);
+      report.add({ test: 'encode', path: name, run, frames: captures * FRAMES_PER_CAPTURE,
+                   ns_per_frame: summarize(samples),
+                   us_per_frame_overall: elapsed / 1000 / (captures * FRAMES_PER_CAPTURE),
+                   gc_count: gcs.count, gc_ms: gcs.ms });
+    }
+  }
+  gc.stop();
+  report.finish();
+}
+
+main();
@@ -0,0 +1,256 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file ring_bench.cpp
+ * @brief lockfree_ring.h 吞吐量与顺序正确性
+ *
+ * 1. 单线程：写一块、读一块（960 采样 = 立体声 10ms，以及 4 采样小块），
+ *    旧 AudioRenderer 环形缓冲（baseline/audio_ring_v1.h）对比 SpscRing<int16_t>。
+ * 2. 双线程 SPSC：生产者 / 消费者各一线程流式传输递增序列，逐采样校验顺序。
+ * 3. MpscRing：3 生产者 / 1 消费者，校验每个生产者的序号连续且总数不丢。
+ * 4. 伪共享：两线程各自递增一个原子计数器，相邻 vs 分处两条缓存行。
+ *
+ * 2~4 依赖多核；结果中的 hardware_threads 为 1 时线程只能轮流运行，
+ * 此时吞吐量只反映调度开销，伪共享差异不可见。
+ */
+
+#include "bench_util.h"
+
+#include "lockfree_ring.h"
+#include "baseline/audio_ring_v1.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// 立体声 48kHz 50ms，与旧 AudioRenderer 的容量一致
+constexpr int kUsableSamples = 4800;
+
+bool RingWrite(AudioRingV1& ring, const int16_t* data, int count) {
+    return ring.Write(data, count);
+}
+int RingRead(AudioRingV1& ring, int16_t* out, int count) {
+    return ring.Read(out, count);
+}
+bool RingWrite(SpscRing<int16_t>& ring, const int16_t* data, int count) {
+    return ring.TryWriteAll(data, static_cast<uint32_t>(count));
+}
+int RingRead(SpscRing<int16_t>& ring, int16_t* out, int count) {
+    return static_cast<int>(ring.Read(out, static_cast<uint32_t>(count)));
+}
+
+void InitRing(AudioRingV1& ring) { ring.Init(kUsableSamples); }
+void InitRing(SpscRing<int16_t>& ring) { ring.Init(kUsableSamples); }
+
+double SamplesPerSec(double nsPerChunk, int chunk) {
+    return nsPerChunk > 0 ? chunk * 1e9 / nsPerChunk : 0;
+}
+
+/**
+ * 单线程：每次调用写入并读出一个 chunk，写入位置随调用推进从而覆盖回绕路径
+ */
+template <typename Ring>
+void SingleThread(bench::Report& report, const char* name, int chunk) {
+    std::unique_ptr<Ring> ring(new Ring());
+    InitRing(*ring);
+    std::vector<int16_t> in(chunk), out(chunk);
+
+    // 顺序校验：跨越多次回绕
+    bool ordered = true;
+    int16_t next = 0, expect = 0;
+    for (int iter = 0; iter < 4 * kUsableSamples / chunk + 3 && ordered; iter++) {
+        for (int16_t& v : in) v = next++;
+        ordered = RingWrite(*ring, in.data(), chunk) && RingRead(*ring, out.data(), chunk) == chunk;
+        for (int i = 0; i < chunk && ordered; i++) {
+            ordered = out[i] == expect++;
+        }
+    }
+    report.Check(ordered, std::string("single-thread order ") + name + " chunk=" + std::to_string(chunk));
+
+    const int perRound = chunk >= 960 ? 200 : 5000;
+    bench::Stats stats = bench::MeasurePerCall(report.Scale(200, 20), perRound, [&](int) {
+        RingWrite(*ring, in.data(), chunk);
+        RingRead(*ring, out.data(), chunk);
+        bench::DoNotOptimize(out[0]);
+    });
+    report.Add().Set("test", "single_thread").Set("ring", name).Set("chunk", chunk)
+          .Set("ns_per_chunk", stats)
+          .Set("msamples_per_sec_p50", SamplesPerSec(stats.p50, chunk) / 1e6);
+}
+
+/**
+ * 双线程流式传输：满 / 空时让出 CPU，消费者逐采样校验递增序列
+ */
+template <typename Ring>
+void TwoThread(bench::Report& report, const char* name, int chunk) {
+    std::unique_ptr<Ring> ring(new Ring());
+    InitRing(*ring);
+    const uint64_t total = static_cast<uint64_t>(report.Scale(40000000, 2000000)) / chunk * chunk;
+    std::atomic<bool> go{false};
+
+    std::thread producer([&] {
+        std::vector<int16_t> in(chunk);
+        int16_t next = 0;
+        while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+        for (uint64_t sent = 0; sent < total; sent += chunk) {
+            for (int16_t& v : in) v = next++;
+            while (!RingWrite(*ring, in.data(), chunk)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::vector<int16_t> out(chunk);
+    int16_t expect = 0;
+    uint64_t received = 0, errors = 0;
+    uint64_t t0 = bench::NowNs();
+    go.store(true, std::memory_order_release);
+    while (received < total) {
+        int n = RingRead(*ring, out.data(), chunk);
+        if (n == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (int i = 0; i < n; i++) {
+            if (out[i] != expect) errors++;
+            expect = static_cast<int16_t>(out[i] + 1);
+        }
+        received += n;
+    }
+    uint64_t elapsed = bench::NowNs() - t0;
+    producer.join();
+
+    report.Add().Set("test", "two_thread").Set("ring", name).Set("chunk", chunk)
+          .Set("samples", received).Set("order_errors", errors)
+          .Set("msamples_per_sec", received * 1e3 / static_cast<double>(elapsed));
+    report.Check(errors == 0, std::string("two-thread order ") + name + " chunk=" + std::to_string(chunk));
+}
+
+/**
+ * MpscRing：3 生产者 / 1 消费者，元素 = 生产者编号 << 48 | 序号
+ */
+void Mpsc(bench::Report& report) {
+    constexpr int kProducers = 3;
+    const uint64_t perProducer = static_cast<uint64_t>(report.Scale(4000000, 200000));
+    std::unique_ptr<MpscRing<uint64_t>> ring(new MpscRing<uint64_t>());
+    ring->Init(1024);
+    std::atomic<bool> go{false};
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; p++) {
+        producers.emplace_back([&, p] {
+            while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+            for (uint64_t seq = 0; seq < perProducer; seq++) {
+                uint64_t value = (static_cast<uint64_t>(p) << 48) | seq;
+                while (!ring->TryPush(value)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    uint64_t expect[kProducers] = {};
+    uint64_t received = 0, errors = 0;
+    uint64_t batch[64];
+    const uint64_t total = perProducer * kProducers;
+    uint64_t t0 = bench::NowNs();
+    go.store(true, std::memory_order_release);
+    while (received < total) {
+        uint32_t n = ring->PopBatch(batch, 64);
+        if (n == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            uint64_t p = batch[i] >> 48;
+            uint64_t seq = batch[i] & ((1ull << 48) - 1);
+            if (p >= kProducers || seq != expect[p]) {
+                errors++;
+            } else {
+                expect[p]++;
+            }
+        }
+        received += n;
+    }
+    uint64_t elapsed = bench::NowNs() - t0;
+    for (std::thread& t : producers) t.join();
+
+    uint64_t tail = 0;
+    report.Check(!ring->TryPop(tail), "mpsc drained");
+    report.Add().Set("test", "mpsc").Set("producers", kProducers).Set("ops", received)
+          .Set("order_errors", errors)
+          .Set("mops_per_sec", received * 1e3 / static_cast<double>(elapsed));
+    report.Check(errors == 0, "mpsc per-producer order");
+}
+
+struct AdjacentCounters {
+    std::atomic<uint64_t> a{0};
+    std::atomic<uint64_t> b{0};
+};
+
+struct PaddedCounters {
+    alignas(RING_CACHE_LINE) std::atomic<uint64_t> a{0};
+    alignas(RING_CACHE_LINE) std::atomic<uint64_t> b{0};
+};
+
+template <typename Counters>
+double CounterNsPerOp(uint64_t iterations) {
+    std::unique_ptr<Counters> counters(new Counters());
+    std::atomic<bool> go{false};
+    std::thread other([&] {
+        while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+        for (uint64_t i = 0; i < iterations; i++) {
+            counters->b.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    uint64_t t0 = bench::NowNs();
+    go.store(true, std::memory_order_release);
+    for (uint64_t i = 0; i < iterations; i++) {
+        counters->a.fetch_add(1, std::memory_order_relaxed);
+    }
+    other.join();
+    uint64_t elapsed = bench::NowNs() - t0;
+    return static_cast<double>(elapsed) / static_cast<double>(iterations);
+}
+
+void FalseSharing(bench::Report& report) {
+    const uint64_t iterations = static_cast<uint64_t>(report.Scale(50000000, 2000000));
+    double adjacent = CounterNsPerOp<AdjacentCounters>(iterations);
+    double padded = CounterNsPerOp<PaddedCounters>(iterations);
+    report.Add().Set("test", "false_sharing").Set("iterations", iterations)
+          .Set("adjacent_ns_per_op", adjacent).Set("padded_ns_per_op", padded)
+          .Set("slowdown", padded > 0 ? adjacent / padded : 0.0);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bench::Report report("ring", argc, argv);
+    report.Add().Set("test", "environment")
+          .Set("hardware_threads", static_cast<int>(std::thread::hardware_concurrency()))
+          .Set("cache_line", static_cast<int>(RING_CACHE_LINE));
+
+    for (int chunk : {960, 4}) {
+        SingleThread<AudioRingV1>(report, "v1", chunk);
+        SingleThread<SpscRing<int16_t>>(report, "spsc", chunk);
+    }
+    for (int chunk : {960, 4}) {
+        TwoThread<AudioRingV1>(report, "v1", chunk);
+        TwoThread<SpscRing<int16_t>>(report, "spsc", chunk);
+    }
+    Mpsc(report);
+    FalseSharing(report);
+    return report.Finish();
+}
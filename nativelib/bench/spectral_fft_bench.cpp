@@ -0,0 +1,206 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file spectral_fft_bench.cpp
+ * @brief SpectralOnsetDetector 的 FFT 精度与每 hop 耗时
+ *
+ * 1. 精度：SplitRadixRealFft 与双精度直接 DFT 对比（N = 16 … 2048，随机输入 + Hann 窗），
+ *    报告最大绝对误差 / 频谱峰值。
+ * 2. 一致性：当前检测器与两个冻结基线（baseline/）在同一合成流上逐 hop 对比
+ *      v1     — 完整 N 点 radix-2 复数 FFT
+ *      radix4 — 实输入 FFT，radix-4 首轮 + radix-2
+ *    onset 判定必须完全一致，描述子相对误差应在 float 舍入量级。
+ * 3. 性能：三者的 ns/hop，以及单独的 N=1024 FFT 耗时。
+ */
+
+#include "bench_util.h"
+
+#include "spectral_onset_detector.h"
+#include "baseline/spectral_onset_detector_v1.h"
+#include "baseline/spectral_onset_detector_radix4.h"
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int kSampleRate = 48000;
+constexpr int kHop = 240;
+
+struct Lcg {
+    uint32_t state;
+    explicit Lcg(uint32_t seed) : state(seed) {}
+    uint32_t Next() {
+        state = state * 1664525u + 1013904223u;
+        return state;
+    }
+    double Signed() { return (Next() >> 8) * (2.0 / 16777216.0) - 1.0; }
+};
+
+/**
+ * 直接 DFT（双精度）作为参考
+ */
+void ReferenceDft(const std::vector<double>& x, std::vector<double>& re, std::vector<double>& im) {
+    const size_t n = x.size();
+    re.assign(n / 2 + 1, 0.0);
+    im.assign(n / 2 + 1, 0.0);
+    for (size_t k = 0; k <= n / 2; k++) {
+        double sr = 0, si = 0;
+        for (size_t t = 0; t < n; t++) {
+            double angle = -2.0 * M_PI * static_cast<double>((k * t) % n) / static_cast<double>(n);
+            sr += x[t] * std::cos(angle);
+            si += x[t] * std::sin(angle);
+        }
+        re[k] = sr;
+        im[k] = si;
+    }
+}
+
+void CheckFftAccuracy(bench::Report& report) {
+    Lcg rng(42);
+    for (unsigned int n = 16; n <= static_cast<unsigned int>(SplitRadixRealFft::MAX_SIZE); n <<= 1) {
+        std::unique_ptr<SplitRadixRealFft> fft(new SplitRadixRealFft());
+        report.Check(fft->Init(n), "fft init " + std::to_string(n));
+
+        std::vector<float> in(n), window(n), re(n / 2 + 1), im(n / 2 + 1);
+        std::vector<double> windowed(n);
+        for (unsigned int i = 0; i < n; i++) {
+            in[i] = static_cast<float>(rng.Signed());
+            window[i] = 0.5f * (1.0f - std::cos(2.0f * static_cast<float>(M_PI) * i / n));
+            windowed[i] = static_cast<double>(in[i]) * static_cast<double>(window[i]);
+        }
+        fft->Forward(in.data(), window.data(), re.data(), im.data());
+
+        std::vector<double> refRe, refIm;
+        ReferenceDft(windowed, refRe, refIm);
+        double maxErr = 0, peak = 0;
+        for (unsigned int k = 0; k <= n / 2; k++) {
+            maxErr = std::max(maxErr, std::hypot(re[k] - refRe[k], im[k] - refIm[k]));
+            peak = std::max(peak, std::hypot(refRe[k], refIm[k]));
+        }
+        double relErr = maxErr / peak;
+        report.Add().Set("test", "fft_accuracy").Set("n", static_cast<int>(n)).Set("max_rel_error", relErr);
+        // float 累积舍入约 log2(N)·2^-24 量级
+        report.Check(relErr < 1e-5, "fft accuracy n=" + std::to_string(n));
+    }
+
+    // 非法尺寸
+    SplitRadixRealFft bad;
+    report.Check(!bad.Init(4) && !bad.Init(1000) && !bad.Init(4096), "fft rejects invalid sizes");
+}
+
+/**
+ * 合成流：120 BPM 底鼓 + 八分音符踩镲 + 底噪（立体声 int16）
+ */
+std::vector<int16_t> MakeStream(int seconds) {
+    Lcg rng(7);
+    const size_t frames = static_cast<size_t>(seconds) * kSampleRate;
+    std::vector<int16_t> pcm(frames * 2);
+    for (size_t i = 0; i < frames; i++) {
+        double t = static_cast<double>(i % (kSampleRate / 2)) / kSampleRate;          // 距上次底鼓
+        double th = static_cast<double>(i % (kSampleRate / 4)) / kSampleRate;         // 距上次踩镲
+        double kick = std::exp(-t / 0.06) * std::sin(2.0 * M_PI * (50.0 * t + 2.0 * (1.0 - std::exp(-t / 0.02))));
+        double hat = std::exp(-th / 0.01) * rng.Signed();
+        double v = 0.7 * kick + 0.2 * hat + 0.01 * rng.Signed();
+        pcm[2 * i] = static_cast<int16_t>(v * 30000.0);
+        pcm[2 * i + 1] = static_cast<int16_t>(v * 27000.0);
+    }
+    return pcm;
+}
+
+template <typename Detector>
+void RunDetector(const std::vector<int16_t>& pcm, std::vector<uint8_t>& onsets,
+                 std::vector<float>& descriptors, std::vector<uint64_t>& hopNs) {
+    std::unique_ptr<Detector> detector(new Detector());
+    detector->Init(kSampleRate, kHop, "specflux");
+    const size_t hops = pcm.size() / 2 / kHop;
+    onsets.assign(hops, 0);
+    descriptors.assign(hops, 0.0f);
+    hopNs.clear();
+    hopNs.reserve(hops);
+    for (size_t h = 0; h < hops; h++) {
+        bool onset = false;
+        uint64_t t0 = bench::NowNs();
+        detector->ProcessFrame(pcm.data() + h * kHop * 2, kHop, 2, onset);
+        hopNs.push_back(bench::NowNs() - t0);
+        onsets[h] = onset ? 1 : 0;
+        descriptors[h] = detector->GetDescriptor();
+    }
+}
+
+void CompareDetectors(bench::Report& report) {
+    const std::vector<int16_t> pcm = MakeStream(report.Scale(60, 10));
+
+    std::vector<uint8_t> onsetsNew, onsetsV1, onsetsR4;
+    std::vector<float> descNew, descV1, descR4;
+    std::vector<uint64_t> nsNew, nsV1, nsR4;
+    // 先跑一遍预热（缓存、频率调节），再正式计时
+    RunDetector<SpectralOnsetDetector>(pcm, onsetsNew, descNew, nsNew);
+    RunDetector<SpectralOnsetDetectorV1>(pcm, onsetsV1, descV1, nsV1);
+    RunDetector<SpectralOnsetDetectorRadix4>(pcm, onsetsR4, descR4, nsR4);
+    RunDetector<SpectralOnsetDetector>(pcm, onsetsNew, descNew, nsNew);
+
+    auto compare = [&](const char* name, const std::vector<uint8_t>& onsets, const std::vector<float>& desc) {
+        size_t mismatches = 0;
+        uint64_t count = 0;
+        double maxRel = 0;
+        for (size_t h = 0; h < onsets.size(); h++) {
+            if (onsets[h] != onsetsNew[h]) mismatches++;
+            count += onsets[h];
+            double ref = std::fabs(desc[h]);
+            if (ref > 1e-3) {
+                maxRel = std::max(maxRel, std::fabs(descNew[h] - desc[h]) / ref);
+            }
+        }
+        report.Add().Set("test", "decision_equivalence").Set("baseline", name)
+              .Set("hops", static_cast<uint64_t>(onsets.size()))
+              .Set("baseline_onsets", count)
+              .Set("decision_mismatches", static_cast<uint64_t>(mismatches))
+              .Set("descriptor_max_rel_error", maxRel);
+        report.Check(mismatches == 0, std::string("onset decisions match ") + name);
+        report.Check(maxRel < 1e-4, std::string("descriptor close to ") + name);
+    };
+    compare("v1", onsetsV1, descV1);
+    compare("radix4", onsetsR4, descR4);
+
+    report.Add().Set("test", "hop_ns").Set("detector", "v1").Set("hop_ns", bench::Summarize(nsV1))
+          .Set("state_bytes", static_cast<uint64_t>(sizeof(SpectralOnsetDetectorV1)));
+    report.Add().Set("test", "hop_ns").Set("detector", "radix4").Set("hop_ns", bench::Summarize(nsR4))
+          .Set("state_bytes", static_cast<uint64_t>(sizeof(SpectralOnsetDetectorRadix4)));
+    report.Add().Set("test", "hop_ns").Set("detector", "split-radix").Set("hop_ns", bench::Summarize(nsNew))
+          .Set("state_bytes", static_cast<uint64_t>(sizeof(SpectralOnsetDetector)));
+}
+
+void MeasureFft(bench::Report& report) {
+    std::unique_ptr<SplitRadixRealFft> fft(new SplitRadixRealFft());
+    const unsigned int n = 1024;    // 运行时 hop=240 对应的 FFT 尺寸
+    fft->Init(n);
+    std::vector<float> in(n), window(n, 1.0f), re(n / 2 + 1), im(n / 2 + 1);
+    Lcg rng(3);
+    for (float& v : in) v = static_cast<float>(rng.Signed());
+    bench::Stats stats = bench::MeasurePerCall(report.Scale(200, 20), 200, [&](int) {
+        fft->Forward(in.data(), window.data(), re.data(), im.data());
+        bench::DoNotOptimize(re[1]);
+    });
+    report.Add().Set("test", "fft_forward").Set("n", static_cast<int>(n)).Set("ns", stats);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bench::Report report("spectral_fft", argc, argv);
+    CheckFftAccuracy(report);
+    CompareDetectors(report);
+    MeasureFft(report);
+    return report.Finish();
+}
@@ -0,0 +1,201 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file thermal_governor_test.cpp
+ * @brief ThermalGovernor::ReadSysfs / Evaluate 的主机测试
+ *
+ * 1. ReadSysfs：在临时目录按 sysfs 结构伪造 thermal zone 与 cpufreq 文件（m℃ / ℃ 混报、
+ *    越界值、不可解析的节点、多个 cluster），核对最高温度与大核限频比例。
+ * 2. Evaluate 升级：高压每 STEP_UP_SAMPLES 次升一级、临界立即升级，等级逐级递增并止于 SPIN。
+ * 3. 迟滞：高压 / 低压连续计数被中间状态打断即清零，降级需要连续 STEP_DOWN_SAMPLES 次低压。
+ * 4. 回退：sysfs 全部不可读（各项为 -1）时按低压处理，等级逐步回落。
+ */
+
+#include "bench_util.h"
+
+#include "thermal_governor.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+
+namespace fs = std::filesystem;
+
+// 与 thermal_governor.cpp 的阈值一致
+constexpr int kStepUpSamples = 3;
+constexpr int kStepDownSamples = 20;
+
+void WriteNode(const fs::path& root, const std::string& relative, const std::string& content) {
+    fs::path path = root / relative;
+    fs::create_directories(path.parent_path());
+    std::ofstream(path) << content << "\n";
+}
+
+ThermalSample MakeSample(int tempMilliC, int freqCapPermille = -1, double decodeLoad = -1.0, double audioLoad = -1.0) {
+    return { tempMilliC, freqCapPermille, -1, decodeLoad, audioLoad };
+}
+
+/**
+ * 连续送入 count 次同一采样，返回等级变化次数
+ */
+int Feed(const ThermalSample& sample, ThermalPolicyState& state, int count) {
+    int changes = 0;
+    for (int i = 0; i < count; i++) {
+        int before = state.level;
+        ThermalGovernor::Evaluate(sample, state, nullptr, 0);
+        changes += state.level != before;
+    }
+    return changes;
+}
+
+void TestReadSysfs(bench::Report& report) {
+    const fs::path root = fs::temp_directory_path() / ("thermal_governor_test." + std::to_string(bench::NowNs()));
+    WriteNode(root, "sys/class/thermal/thermal_zone0/temp", "45000");
+    WriteNode(root, "sys/class/thermal/thermal_zone1/temp", "71");        // 以 ℃ 上报
+    WriteNode(root, "sys/class/thermal/thermal_zone2/temp", "250000");    // 越界，忽略
+    WriteNode(root, "sys/class/thermal/thermal_zone3/temp", "N/A");       // 不可解析
+    WriteNode(root, "sys/class/thermal/thermal_zone5/temp", "69500");     // 编号不连续
+    for (int cpu = 0; cpu < 4; cpu++) {
+        const std::string dir = "sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cpufreq/";
+        WriteNode(root, dir + "cpuinfo_max_freq", "1800000");
+        WriteNode(root, dir + "scaling_max_freq", "900000");
+        WriteNode(root, dir + "scaling_cur_freq", "900000");
+    }
+    const std::string big = "sys/devices/system/cpu/cpu6/cpufreq/";
+    WriteNode(root, big + "cpuinfo_max_freq", "2400000");
+    WriteNode(root, big + "scaling_max_freq", "1920000");
+    WriteNode(root, big + "scaling_cur_freq", "1200000");
+
+    ThermalSample sample = ThermalGovernor::ReadSysfs(root.c_str());
+    ThermalSample missing = ThermalGovernor::ReadSysfs((root / "absent").c_str());
+    std::error_code ec;
+    fs::remove_all(root, ec);
+
+    report.Add().Set("test", "read_sysfs")
+          .Set("temp_millic", sample.tempMilliC)
+          .Set("freq_cap_permille", sample.freqCapPermille)
+          .Set("freq_cur_permille", sample.freqCurPermille)
+          .Set("missing_temp_millic", missing.tempMilliC)
+          .Set("missing_freq_cap_permille", missing.freqCapPermille);
+    report.Check(sample.tempMilliC == 71000, "hottest zone wins, Celsius nodes scaled, out-of-range ignored");
+    report.Check(sample.freqCapPermille == 800 && sample.freqCurPermille == 500,
+                 "big core (highest cpuinfo_max_freq) cap / cur ratio");
+    report.Check(missing.tempMilliC == -1 && missing.freqCapPermille == -1 && missing.freqCurPermille == -1,
+                 "unreadable sysfs reports -1");
+}
+
+void TestLevelOrdering(bench::Report& report) {
+    // 高压（温度）：每 kStepUpSamples 次升一级，逐级递增，止于 SPIN
+    ThermalPolicyState state = { THERMAL_LEVEL_NONE, 0, 0 };
+    const ThermalSample hot = MakeSample(76000);
+    bool ordered = true;
+    char reason[96] = "";
+    for (int expected = THERMAL_LEVEL_ANALYSIS; expected <= THERMAL_LEVEL_MAX; expected++) {
+        int before = state.level;
+        for (int i = 0; i < kStepUpSamples - 1; i++) {
+            ThermalGovernor::Evaluate(hot, state, nullptr, 0);
+        }
+        ordered = ordered && state.level == before;
+        reason[0] = '\0';
+        ThermalGovernor::Evaluate(hot, state, reason, sizeof(reason));
+        ordered = ordered && state.level == expected && reason[0] != '\0';
+    }
+    int saturated = Feed(hot, state, 10 * kStepUpSamples);
+
+    // 临界（解码负载 ≥ 1）：每次采样立即升一级
+    ThermalPolicyState critical = { THERMAL_LEVEL_NONE, 0, 0 };
+    bool immediate = true;
+    for (int expected = THERMAL_LEVEL_ANALYSIS; expected <= THERMAL_LEVEL_MAX; expected++) {
+        immediate = immediate && ThermalGovernor::Evaluate(MakeSample(60000, 1000, 1.2), critical, nullptr, 0) == expected;
+    }
+
+    // 各类高压指标都能触发升级
+    const ThermalSample triggers[] = {
+        MakeSample(60000, 800),             // 大核限频
+        MakeSample(60000, 1000, 0.8),       // 解码负载
+        MakeSample(60000, 1000, 0.3, 0.5),  // AudioRecv 负载
+    };
+    bool allTrigger = true;
+    for (const ThermalSample& trigger : triggers) {
+        ThermalPolicyState s = { THERMAL_LEVEL_NONE, 0, 0 };
+        allTrigger = allTrigger && Feed(trigger, s, kStepUpSamples) == 1 && s.level == THERMAL_LEVEL_ANALYSIS;
+    }
+
+    report.Add().Set("test", "level_ordering").Set("final_level", state.level)
+          .Set("changes_after_max", saturated).Set("critical_final_level", critical.level);
+    report.Check(ordered, "hot steps up one level per STEP_UP_SAMPLES, in order, with a reason");
+    report.Check(state.level == THERMAL_LEVEL_MAX && saturated == 0, "level saturates at SPIN");
+    report.Check(immediate, "critical steps up on every sample");
+    report.Check(allTrigger, "freq cap, decode load and audio load each count as hot");
+}
+
+void TestHysteresis(bench::Report& report) {
+    const ThermalSample hot = MakeSample(76000);
+    const ThermalSample cool = MakeSample(60000, 1000, 0.3, 0.1);
+    const ThermalSample between = MakeSample(70000, 1000, 0.3, 0.1);   // 低于 hot、高于 cool 阈值
+
+    // 高压计数被中间状态打断
+    ThermalPolicyState state = { THERMAL_LEVEL_NONE, 0, 0 };
+    Feed(hot, state, kStepUpSamples - 1);
+    Feed(between, state, 1);
+    int interruptedUp = Feed(hot, state, kStepUpSamples - 1);
+
+    // 中间状态保持等级
+    state = { THERMAL_LEVEL_OPUS, 0, 0 };
+    int heldBetween = Feed(between, state, 10 * kStepDownSamples);
+
+    // 低压计数被中间状态 / 高压打断
+    Feed(cool, state, kStepDownSamples - 1);
+    Feed(between, state, 1);
+    int interruptedDown = Feed(cool, state, kStepDownSamples - 1);
+    Feed(hot, state, 1);
+    interruptedDown += Feed(cool, state, kStepDownSamples - 1);
+
+    // 连续低压：每 kStepDownSamples 次降一级，降到 NONE 为止
+    state = { THERMAL_LEVEL_OPUS, 0, 0 };
+    int firstDrop = Feed(cool, state, kStepDownSamples);
+    int levelAfterFirst = state.level;
+    Feed(cool, state, 10 * kStepDownSamples);
+
+    report.Add().Set("test", "hysteresis").Set("interrupted_up_changes", interruptedUp)
+          .Set("between_changes", heldBetween).Set("interrupted_down_changes", interruptedDown)
+          .Set("level_after_first_drop", levelAfterFirst).Set("final_level", state.level);
+    report.Check(interruptedUp == 0, "in-between sample resets the hot streak");
+    report.Check(heldBetween == 0, "in-between samples hold the level");
+    report.Check(interruptedDown == 0, "in-between or hot sample resets the cool streak");
+    report.Check(firstDrop == 1 && levelAfterFirst == THERMAL_LEVEL_ANALYSIS && state.level == THERMAL_LEVEL_NONE,
+                 "cool steps down one level per STEP_DOWN_SAMPLES, down to NONE");
+}
+
+void TestUnreadableFallback(bench::Report& report) {
+    const ThermalSample unreadable = ThermalGovernor::ReadSysfs("/nonexistent/thermal_governor_test");
+    ThermalPolicyState state = { THERMAL_LEVEL_POLLING, 0, 0 };
+    int early = Feed(unreadable, state, kStepDownSamples - 1);
+    int drops = Feed(unreadable, state, 1);
+    Feed(unreadable, state, 10 * kStepDownSamples);
+
+    report.Add().Set("test", "unreadable_fallback").Set("final_level", state.level);
+    report.Check(early == 0 && drops == 1, "unreadable nodes count as cool and still need STEP_DOWN_SAMPLES");
+    report.Check(state.level == THERMAL_LEVEL_NONE, "unreadable sysfs falls back to NONE");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bench::Report report("thermal_governor", argc, argv);
+    TestReadSysfs(report);
+    TestLevelOrdering(report);
+    TestHysteresis(report);
+    TestUnreadableFallback(report);
+    return report.Finish();
+}
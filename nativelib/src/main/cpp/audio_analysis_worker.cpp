@@ -0,0 +1,192 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file audio_analysis_worker.cpp
+ * @brief 音频分析工作线程实现
+ */
+
+#include "audio_analysis_worker.h"
+#include "bass_energy_analyzer.h"
+#include <hilog/log.h>
+#include <qos/qos.h>
+#include <pthread.h>
+#include <cstring>
+#include <chrono>
+
+#define LOG_TAG "AudioAnalysis"
+
+AudioAnalysisWorker::~AudioAnalysisWorker() {
+    Stop();
+}
+
+int AudioAnalysisWorker::Start(BassEnergyAnalyzer* analyzer, int channelCount, int samplesPerFrame,
+                               IntensityCallback callback) {
+    Stop();
+
+    if (analyzer == nullptr || channelCount <= 0 || samplesPerFrame <= 0) {
+        OH_LOG_ERROR(LOG_APP, "AudioAnalysisWorker: invalid args ch=%{public}d spf=%{public}d",
+                     channelCount, samplesPerFrame);
+        return -1;
+    }
+
+    analyzer_ = analyzer;
+    callback_ = callback;
+    channelCount_ = channelCount;
+    slotStride_ = channelCount * samplesPerFrame;
+    slotData_ = new int16_t[SLOT_COUNT * slotStride_];
+    memset(slotSamples_, 0, sizeof(slotSamples_));
+    memset(slotTimeNs_, 0, sizeof(slotTimeNs_));
+
+    writeIdx_.store(0, std::memory_order_relaxed);
+    readIdx_.store(0, std::memory_order_relaxed);
+    framesPublished_.store(0, std::memory_order_relaxed);
+    framesAnalyzed_.store(0, std::memory_order_relaxed);
+    framesSkipped_.store(0, std::memory_order_relaxed);
+    framesDropped_.store(0, std::memory_order_relaxed);
+    analyzeTotalNs_.store(0, std::memory_order_relaxed);
+    analyzeMaxNs_.store(0, std::memory_order_relaxed);
+
+    if (sem_init(&wakeSem_, 0, 0) != 0) {
+        OH_LOG_ERROR(LOG_APP, "AudioAnalysisWorker: sem_init failed");
+        delete[] slotData_;
+        slotData_ = nullptr;
+        return -1;
+    }
+    semInitialized_ = true;
+
+    running_.store(true, std::memory_order_release);
+    thread_ = std::thread(&AudioAnalysisWorker::WorkerLoop, this);
+
+    OH_LOG_INFO(LOG_APP, "AudioAnalysisWorker started: %{public}u slots x %{public}d samples",
+                SLOT_COUNT, slotStride_);
+    return 0;
+}
+
+void AudioAnalysisWorker::Stop() {
+    if (running_.exchange(false, std::memory_order_acq_rel)) {
+        sem_post(&wakeSem_);
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    if (semInitialized_) {
+        sem_destroy(&wakeSem_);
+        semInitialized_ = false;
+    }
+    if (slotData_ != nullptr) {
+        OH_LOG_INFO(LOG_APP, "AudioAnalysisWorker stopped: published=%{public}llu analyzed=%{public}llu "
+                    "skipped=%{public}llu dropped=%{public}llu",
+                    (unsigned long long)framesPublished_.load(std::memory_order_relaxed),
+                    (unsigned long long)framesAnalyzed_.load(std::memory_order_relaxed),
+                    (unsigned long long)framesSkipped_.load(std::memory_order_relaxed),
+                    (unsigned long long)framesDropped_.load(std::memory_order_relaxed));
+        delete[] slotData_;
+        slotData_ = nullptr;
+    }
+    analyzer_ = nullptr;
+    callback_ = nullptr;
+}
+
+bool AudioAnalysisWorker::Publish(const int16_t* pcmData, int perChannelSamples) {
+    if (!running_.load(std::memory_order_relaxed) || pcmData == nullptr || perChannelSamples <= 0) {
+        return false;
+    }
+
+    int count = perChannelSamples * channelCount_;
+    if (count > slotStride_) {
+        // 超过槽位容量（异常帧长），截断到槽位大小
+        perChannelSamples = slotStride_ / channelCount_;
+        count = perChannelSamples * channelCount_;
+    }
+
+    uint32_t w = writeIdx_.load(std::memory_order_relaxed);
+    uint32_t r = readIdx_.load(std::memory_order_acquire);
+    if (w - r >= SLOT_COUNT) {
+        framesDropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    uint32_t slot = w & SLOT_MASK;
+    memcpy(slotData_ + slot * slotStride_, pcmData, count * sizeof(int16_t));
+    slotSamples_[slot] = perChannelSamples;
+    slotTimeNs_[slot] = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+    writeIdx_.store(w + 1, std::memory_order_release);
+
+    framesPublished_.fetch_add(1, std::memory_order_relaxed);
+    sem_post(&wakeSem_);
+    return true;
+}
+
+void AudioAnalysisWorker::WorkerLoop() {
+    pthread_setname_np(pthread_self(), "AudioAnalysis");
+
+    // 分析结果只影响振动，低于音频/视频线程的调度优先级
+    int qosRet = OH_QoS_SetThreadQoS(QOS_UTILITY);
+    if (qosRet != 0) {
+        OH_LOG_WARN(LOG_APP, "AudioAnalysis thread: failed to set QoS (ret=%{public}d)", qosRet);
+    }
+
+    while (running_.load(std::memory_order_acquire)) {
+        sem_wait(&wakeSem_);
+
+        uint32_t r = readIdx_.load(std::memory_order_relaxed);
+        uint32_t w = writeIdx_.load(std::memory_order_acquire);
+
+        // 积压过多：跳到最新一帧，保证振动与当前音频对齐
+        if (w - r > MAX_BACKLOG_SLOTS) {
+            uint32_t skip = (w - r) - 1;
+            framesSkipped_.fetch_add(skip, std::memory_order_relaxed);
+            r += skip;
+            readIdx_.store(r, std::memory_order_release);
+        }
+
+        while (r != w && running_.load(std::memory_order_relaxed)) {
+            uint32_t slot = r & SLOT_MASK;
+
+            auto t0 = std::chrono::steady_clock::now();
+            HapticBandIntensity bands;
+            bool fire = analyzer_->ProcessFrame(slotData_ + slot * slotStride_, slotSamples_[slot], bands);
+            auto t1 = std::chrono::steady_clock::now();
+            uint64_t frameNs = slotTimeNs_[slot];
+
+            r++;
+            readIdx_.store(r, std::memory_order_release);
+
+            if (fire && callback_ != nullptr) {
+                callback_(bands, frameNs);
+            }
+
+            uint64_t ns = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+            framesAnalyzed_.fetch_add(1, std::memory_order_relaxed);
+            analyzeTotalNs_.fetch_add(ns, std::memory_order_relaxed);
+            uint64_t prevMax = analyzeMaxNs_.load(std::memory_order_relaxed);
+            while (ns > prevMax &&
+                   !analyzeMaxNs_.compare_exchange_weak(prevMax, ns, std::memory_order_relaxed)) {
+            }
+        }
+    }
+}
+
+AudioAnalysisStats AudioAnalysisWorker::GetStats() const {
+    AudioAnalysisStats stats = {};
+    stats.framesPublished = framesPublished_.load(std::memory_order_relaxed);
+    stats.framesAnalyzed = framesAnalyzed_.load(std::memory_order_relaxed);
+    stats.framesSkipped = framesSkipped_.load(std::memory_order_relaxed);
+    stats.framesDropped = framesDropped_.load(std::memory_order_relaxed);
+    uint64_t totalNs = analyzeTotalNs_.load(std::memory_order_relaxed);
+    stats.avgAnalyzeUs = (stats.framesAnalyzed > 0)
+        ? (static_cast<double>(totalNs) / stats.framesAnalyzed / 1000.0)
+        : 0.0;
+    stats.maxAnalyzeUs = static_cast<double>(analyzeMaxNs_.load(std::memory_order_relaxed)) / 1000.0;
+    return stats;
+}
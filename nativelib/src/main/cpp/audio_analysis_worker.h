@@ -0,0 +1,136 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file audio_analysis_worker.h
+ * @brief 音频分析工作线程（低频能量 + onset 检测）
+ *
+ * 将 BassEnergyAnalyzer::ProcessFrame（含 onset FFT / 白化 / peak picking）
+ * 从 moonlight-common-c 的 AudioRecv 线程移出，避免分析耗时推迟下一个包的处理。
+ *
+ * 数据流：
+ *   AudioRecv 线程: Opus 解码 → AudioRenderer 环形缓冲 → Publish() (memcpy 到槽位)
+ *   分析线程 (QoS UTILITY): 取最新帧 → BassEnergyAnalyzer → 强度回调
+ *
+ * 设计要点：
+ * - 固定槽位 SPSC 环形队列，读写索引分属不同 cache line，生产端无锁、无堆分配
+ * - 生产端只做一次 memcpy + sem_post，不等待消费者
+ * - 消费者积压超过 MAX_BACKLOG_SLOTS 时直接跳到最新帧（振动允许丢帧，不允许滞后）
+ * - 队列满时生产端丢弃新帧并计数，绝不阻塞接收线程
+ */
+
+#ifndef AUDIO_ANALYSIS_WORKER_H
+#define AUDIO_ANALYSIS_WORKER_H
+
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <semaphore.h>
+
+class BassEnergyAnalyzer;
+struct HapticBandIntensity;
+
+/**
+ * 分析线程统计信息
+ */
+struct AudioAnalysisStats {
+    uint64_t framesPublished;   // AudioRecv 线程投递的帧数
+    uint64_t framesAnalyzed;    // 分析线程实际处理的帧数
+    uint64_t framesSkipped;     // 分析线程积压时跳过的帧数
+    uint64_t framesDropped;     // 队列满时丢弃的帧数
+    double avgAnalyzeUs;        // 单帧分析平均耗时（微秒）
+    double maxAnalyzeUs;        // 单帧分析最大耗时（微秒）
+};
+
+/**
+ * 音频分析工作线程
+ *
+ * 生产者: BridgeArDecodeAndPlaySample (AudioRecv 线程)
+ * 消费者: 内部分析线程
+ */
+class AudioAnalysisWorker {
+public:
+    /**
+     * 强度回调（在分析线程调用，节流后才触发）
+     * @param bands 综合强度及各马达 / 扳机强度
+     * @param frameNs 该帧投递时间 (steady_clock / CLOCK_MONOTONIC ns)，用于端到端延迟统计
+     */
+    typedef void (*IntensityCallback)(const HapticBandIntensity& bands, uint64_t frameNs);
+
+    AudioAnalysisWorker() = default;
+    ~AudioAnalysisWorker();
+
+    AudioAnalysisWorker(const AudioAnalysisWorker&) = delete;
+    AudioAnalysisWorker& operator=(const AudioAnalysisWorker&) = delete;
+
+    /**
+     * 启动分析线程
+     * @param analyzer 分析器实例（由调用方持有，生命周期需覆盖 Start/Stop）
+     * @param channelCount 声道数
+     * @param samplesPerFrame 每帧每声道最大采样数（决定槽位大小）
+     * @param callback 强度回调
+     * @return 0 成功，负数失败
+     */
+    int Start(BassEnergyAnalyzer* analyzer, int channelCount, int samplesPerFrame,
+              IntensityCallback callback);
+
+    /**
+     * 停止分析线程并释放槽位内存
+     */
+    void Stop();
+
+    /**
+     * 投递一帧解码后的 PCM（AudioRecv 线程调用，无锁、无分配）
+     * @param pcmData PCM 数据（int16 交错）
+     * @param perChannelSamples 每声道采样数
+     * @return true 已入队，false 队列满或未运行（帧被丢弃）
+     */
+    bool Publish(const int16_t* pcmData, int perChannelSamples);
+
+    bool IsRunning() const { return running_.load(std::memory_order_acquire); }
+
+    AudioAnalysisStats GetStats() const;
+
+private:
+    void WorkerLoop();
+
+    // 槽位数（2 的幂，掩码取模）: 16 × 5ms = 80ms
+    static constexpr uint32_t SLOT_COUNT = 16;
+    static constexpr uint32_t SLOT_MASK = SLOT_COUNT - 1;
+    // 积压超过 4 帧 (~20ms) 时只处理最新一帧
+    static constexpr uint32_t MAX_BACKLOG_SLOTS = 4;
+
+    BassEnergyAnalyzer* analyzer_ = nullptr;
+    IntensityCallback callback_ = nullptr;
+    int channelCount_ = 0;
+    int slotStride_ = 0;                   // 每槽位 int16 数量
+    int16_t* slotData_ = nullptr;          // SLOT_COUNT × slotStride_
+    int slotSamples_[SLOT_COUNT] = {};     // 每槽位每声道采样数
+    uint64_t slotTimeNs_[SLOT_COUNT] = {}; // 每槽位投递时间
+
+    // 读写索引分属不同 cache line，避免生产/消费端伪共享
+    alignas(64) std::atomic<uint32_t> writeIdx_{0};   // 生产者（AudioRecv）
+    alignas(64) std::atomic<uint32_t> readIdx_{0};    // 消费者（分析线程）
+
+    alignas(64) std::atomic<bool> running_{false};
+    sem_t wakeSem_;
+    bool semInitialized_ = false;
+    std::thread thread_;
+
+    // 统计
+    std::atomic<uint64_t> framesPublished_{0};
+    std::atomic<uint64_t> framesAnalyzed_{0};
+    std::atomic<uint64_t> framesSkipped_{0};
+    std::atomic<uint64_t> framesDropped_{0};
+    std::atomic<uint64_t> analyzeTotalNs_{0};
+    std::atomic<uint64_t> analyzeMaxNs_{0};
+};
+
+#endif // AUDIO_ANALYSIS_WORKER_H
@@ -22,8 +22,11 @@
 #include <hilog/log.h>
 #include <cstring>
 #include <dlfcn.h>
+#include <time.h>
 #include <qos/qos.h>
+#include <ohaudio/native_audio_routing_manager.h>
 #include <algorithm>
+#include <cmath>
 
 #define LOG_TAG "AudioRenderer"
 
@@ -51,12 +54,23 @@ typedef OH_AudioStream_Result (*PFN_SetRendererOutputDeviceChangeCb)(
 typedef OH_AudioStream_Result (*PFN_SetSpatializationEnabled)(
     OH_AudioStreamBuilder* builder, bool spatializationEnabled);
 
+// 函数指针类型定义 — 路由查询（设备切换后按路由调整延迟上限）
+typedef OH_AudioCommon_Result (*PFN_GetAudioRoutingManager)(OH_AudioRoutingManager**);
+typedef OH_AudioCommon_Result (*PFN_GetPreferredOutputDevice)(
+    OH_AudioRoutingManager*, OH_AudioStream_Usage, OH_AudioDeviceDescriptorArray**);
+typedef OH_AudioCommon_Result (*PFN_ReleaseDevices)(OH_AudioRoutingManager*, OH_AudioDeviceDescriptorArray*);
+typedef OH_AudioCommon_Result (*PFN_GetDeviceType)(OH_AudioDeviceDescriptor*, OH_AudioDevice_Type*);
+
 // 全局函数指针
 static PFN_SetRendererWriteDataCb       g_pfnSetRendererWriteDataCb = nullptr;
 static PFN_SetRendererInterruptCb       g_pfnSetRendererInterruptCb = nullptr;
 static PFN_SetRendererErrorCb           g_pfnSetRendererErrorCb = nullptr;
 static PFN_SetRendererOutputDeviceChangeCb g_pfnSetRendererDeviceChangeCb = nullptr;
 static PFN_SetSpatializationEnabled     g_pfnSetSpatializationEnabled = nullptr;
+static PFN_GetAudioRoutingManager       g_pfnGetRoutingManager = nullptr;
+static PFN_GetPreferredOutputDevice     g_pfnGetPreferredOutputDevice = nullptr;
+static PFN_ReleaseDevices               g_pfnReleaseDevices = nullptr;
+static PFN_GetDeviceType                g_pfnGetDeviceType = nullptr;
 
 static bool g_audioApisChecked = false;
 static bool g_writeDataCbAvailable = false;
@@ -87,16 +101,27 @@ static void LoadAudioApis() {
     g_pfnSetSpatializationEnabled = (PFN_SetSpatializationEnabled)
         dlsym(handle, "OH_AudioStreamBuilder_SetSpatializationEnabled");
 
+    // 路由查询 (API 12+)
+    g_pfnGetRoutingManager = (PFN_GetAudioRoutingManager)
+        dlsym(handle, "OH_AudioManager_GetAudioRoutingManager");
+    g_pfnGetPreferredOutputDevice = (PFN_GetPreferredOutputDevice)
+        dlsym(handle, "OH_AudioRoutingManager_GetPreferredOutputDevice");
+    g_pfnReleaseDevices = (PFN_ReleaseDevices)
+        dlsym(handle, "OH_AudioRoutingManager_ReleaseDevices");
+    g_pfnGetDeviceType = (PFN_GetDeviceType)
+        dlsym(handle, "OH_AudioDeviceDescriptor_GetDeviceType");
+
     g_writeDataCbAvailable = (g_pfnSetRendererWriteDataCb != nullptr);
     g_spatialAudioAvailable = (g_pfnSetSpatializationEnabled != nullptr);
 
     OH_LOG_INFO(LOG_APP, "OHAudio API probe: WriteDataCb=%{public}s InterruptCb=%{public}s "
-                "ErrorCb=%{public}s DeviceChangeCb=%{public}s SpatialAudio=%{public}s",
+                "ErrorCb=%{public}s DeviceChangeCb=%{public}s SpatialAudio=%{public}s Routing=%{public}s",
                 g_pfnSetRendererWriteDataCb ? "Y" : "N",
                 g_pfnSetRendererInterruptCb ? "Y" : "N",
                 g_pfnSetRendererErrorCb ? "Y" : "N",
                 g_pfnSetRendererDeviceChangeCb ? "Y" : "N",
-                g_pfnSetSpatializationEnabled ? "Y" : "N");
+                g_pfnSetSpatializationEnabled ? "Y" : "N",
+                (g_pfnGetRoutingManager && g_pfnGetPreferredOutputDevice && g_pfnGetDeviceType) ? "Y" : "N");
     // 不 dlclose，保持库加载
 }
 
@@ -105,7 +130,7 @@ static void LoadAudioApis() {
 // =============================================================================
 
 AudioRenderer::AudioRenderer() {
-    // ringBuffer_ 在 Init 中动态分配
+    // ring_ 在 Init 中分配
 }
 
 AudioRenderer::~AudioRenderer() {
@@ -121,28 +146,31 @@ int AudioRenderer::Init(const AudioRendererConfig& config) {
     config_ = config;
     
     // 动态分配环形缓冲区：根据实际声道数和采样率计算容量
-    // 所有声道配置统一 TARGET_BUFFER_MS 时长，避免 stereo 时缓冲区过大
-    int usableSamples = config_.sampleRate * config_.channelCount * TARGET_BUFFER_MS / 1000;
+    // 所有声道配置统一时长，避免 stereo 时缓冲区过大；
+    // 需容纳推导上限的最大值 + 一帧，路由变化时无需重新分配
+    int frameMs = (config_.sampleRate > 0)
+        ? (config_.samplesPerFrame * 1000 + config_.sampleRate - 1) / config_.sampleRate : 0;
+    int ringMs = MAX_ROUTE_CAP_MS + frameMs;
+    int usableSamples = config_.sampleRate * config_.channelCount * ringMs / 1000;
     // 对齐到帧边界（channelCount × samplesPerFrame）
     int frameSize = config_.channelCount * config_.samplesPerFrame;
     if (frameSize > 0) {
         usableSamples = ((usableSamples + frameSize - 1) / frameSize) * frameSize;
     }
-    // SPSC 环形缓冲区需要多留 1 个位置以区分满/空
-    ringCapacity_ = usableSamples + 1;
-    
-    // 释放旧缓冲区（如果有）
-    delete[] ringBuffer_;
-    ringBuffer_ = new int16_t[ringCapacity_];
-    memset(ringBuffer_, 0, ringCapacity_ * sizeof(int16_t));
+    // 重新分配（容量向上取整到 2 的幂，旧缓冲区在 Init 内释放）
+    if (usableSamples <= 0 || !ring_.Init(static_cast<uint32_t>(usableSamples))) {
+        OH_LOG_ERROR(LOG_APP, "Failed to allocate ring buffer: %{public}d samples", usableSamples);
+        return -1;
+    }
     
-    OH_LOG_INFO(LOG_APP, "Ring buffer: capacity=%{public}d samples (%{public}dms for %{public}dch @%{public}dHz), "
-                "latency cap=%{public}dms",
-                ringCapacity_ - 1,
-                TARGET_BUFFER_MS,
+    OH_LOG_INFO(LOG_APP, "Ring buffer: capacity=%{public}u samples (>=%{public}dms for %{public}dch @%{public}dHz), "
+                "route cap range=%{public}d-%{public}dms",
+                ring_.Capacity(),
+                ringMs,
                 config_.channelCount,
                 config_.sampleRate,
-                MAX_AUDIO_LATENCY_MS);
+                MIN_ROUTE_CAP_MS,
+                MAX_ROUTE_CAP_MS);
     
     OH_LOG_INFO(LOG_APP, "Initializing audio renderer: sampleRate=%{public}d, channels=%{public}d, samplesPerFrame=%{public}d",
                 config_.sampleRate, config_.channelCount, config_.samplesPerFrame);
@@ -334,6 +362,8 @@ int AudioRenderer::Init(const AudioRendererConfig& config) {
         builder_ = nullptr;
         return -1;
     }
+    activeRenderer_.store(renderer_, std::memory_order_release);
+    DetectRoute();
     
     // 设置初始音量（如果配置了）
     if (config_.volume > 0.0f && config_.volume <= 1.0f) {
@@ -347,6 +377,7 @@ int AudioRenderer::Init(const AudioRendererConfig& config) {
 }
 
 int AudioRenderer::SetVolume(float volume) {
+    std::lock_guard<std::mutex> lock(rendererMutex_);
     if (renderer_ == nullptr) {
         OH_LOG_ERROR(LOG_APP, "Renderer not initialized");
         return -1;
@@ -376,9 +407,11 @@ int AudioRenderer::Start() {
     OH_AudioRenderer_Flush(renderer_);
     
     // 清空环形缓冲区
-    ringHead_.store(0, std::memory_order_relaxed);
-    ringTail_.store(0, std::memory_order_relaxed);
+    ring_.Reset();
     wasUnderrun_.store(false, std::memory_order_relaxed);
+    deviceLatencyUs_.store(-1, std::memory_order_relaxed);
+    lastDeviceQueryNs_ = 0;
+    cadenceReset_.store(true, std::memory_order_relaxed);
     
     OH_AudioStream_Result result = OH_AudioRenderer_Start(renderer_);
     if (result != AUDIOSTREAM_SUCCESS) {
@@ -396,14 +429,14 @@ int AudioRenderer::Start() {
 
 int AudioRenderer::Stop() {
     running_ = false;
+    JoinSwitchThread();
     
     if (renderer_ != nullptr) {
         OH_AudioRenderer_Stop(renderer_);
     }
     
     // 清空环形缓冲区
-    ringHead_.store(0, std::memory_order_relaxed);
-    ringTail_.store(0, std::memory_order_relaxed);
+    ring_.Reset();
     wasUnderrun_.store(false, std::memory_order_relaxed);
     
     OH_LOG_INFO(LOG_APP, "Audio renderer stopped");
@@ -413,6 +446,7 @@ int AudioRenderer::Stop() {
 void AudioRenderer::Cleanup() {
     Stop();
     
+    activeRenderer_.store(nullptr, std::memory_order_release);
     if (renderer_ != nullptr) {
         OH_AudioRenderer_Release(renderer_);
         renderer_ = nullptr;
@@ -426,15 +460,13 @@ void AudioRenderer::Cleanup() {
     configured_ = false;
     
     // 释放动态环形缓冲区
-    delete[] ringBuffer_;
-    ringBuffer_ = nullptr;
-    ringCapacity_ = 0;
+    ring_.Release();
     
     OH_LOG_INFO(LOG_APP, "Audio renderer cleaned up");
 }
 
 int AudioRenderer::PlaySamples(const int16_t* pcmData, int sampleCount) {
-    if (renderer_ == nullptr) {
+    if (!configured_) {
         return -1;
     }
     
@@ -449,51 +481,40 @@ int AudioRenderer::PlaySamples(const int16_t* pcmData, int sampleCount) {
     
     // 写入环形缓冲区（无锁 SPSC）
     int dataSize = sampleCount * config_.channelCount;
-    int tail = ringTail_.load(std::memory_order_relaxed);
-    int head = ringHead_.load(std::memory_order_acquire);
+    if (dataSize <= 0) {
+        return 0;
+    }
     
-    // 延迟上限检查（匹配 Android 的 40ms 上限）
+    // 延迟上限检查（本地路由匹配 Android 的 40ms 上限，蓝牙更宽，音视频同步时可能更低）
     // 如果缓冲区中已有数据超过阈值，丢弃新数据以抑制延迟积累
-    int buffered = (tail >= head) ? (tail - head) : (ringCapacity_ - head + tail);
+    int buffered = static_cast<int>(ring_.Size());
     int bufferedFrames = buffered / std::max(config_.channelCount, 1);
     double latencyMs = (config_.sampleRate > 0)
         ? ((double)bufferedFrames * 1000.0 / config_.sampleRate)
         : 0.0;
-    if (latencyMs > MAX_AUDIO_LATENCY_MS) {
+    int capMs = routeCapMs_.load(std::memory_order_relaxed) - latencyTrimMs_.load(std::memory_order_relaxed);
+    if (latencyMs > capMs) {
         droppedSamples_.fetch_add(sampleCount, std::memory_order_relaxed);
         return 0;
     }
     
-    // 计算可用空间（保留1个元素的间隔以区分满/空）
-    int available;
-    if (tail >= head) {
-        available = ringCapacity_ - (tail - head) - 1;
-    } else {
-        available = head - tail - 1;
-    }
-    
-    if (available < dataSize) {
-        // 缓冲区空间不足 → 丢弃新数据
+    // 整帧写入，空间不足 → 丢弃新数据
+    if (!ring_.TryWriteAll(pcmData, static_cast<uint32_t>(dataSize))) {
         droppedSamples_.fetch_add(sampleCount, std::memory_order_relaxed);
         return 0;
     }
     
-    // 写入数据到环形缓冲区
-    int firstPart = std::min(dataSize, ringCapacity_ - tail);
-    memcpy(ringBuffer_ + tail, pcmData, firstPart * sizeof(int16_t));
-    if (firstPart < dataSize) {
-        memcpy(ringBuffer_, pcmData + firstPart, (dataSize - firstPart) * sizeof(int16_t));
-    }
-    ringTail_.store((tail + dataSize) % ringCapacity_, std::memory_order_release);
-    
     totalSamples_.fetch_add(sampleCount, std::memory_order_relaxed);
     
+    PollDeviceLatency();
+    
     return 0;
 }
 
 int AudioRenderer::TryRestart() {
     OH_LOG_INFO(LOG_APP, "Attempting audio renderer restart...");
     
+    std::lock_guard<std::mutex> lock(rendererMutex_);
     if (renderer_ == nullptr) {
         OH_LOG_ERROR(LOG_APP, "Cannot restart: renderer is null");
         return -1;
@@ -503,8 +524,7 @@ int AudioRenderer::TryRestart() {
     OH_AudioRenderer_Stop(renderer_);
     
     // 清空环形缓冲区 + OHAudio 内部缓冲，避免播放过时数据
-    ringHead_.store(0, std::memory_order_relaxed);
-    ringTail_.store(0, std::memory_order_relaxed);
+    ring_.Reset();
     wasUnderrun_.store(false, std::memory_order_relaxed);
     OH_AudioRenderer_Flush(renderer_);
     
@@ -513,29 +533,9 @@ int AudioRenderer::TryRestart() {
     if (result != AUDIOSTREAM_SUCCESS) {
         OH_LOG_ERROR(LOG_APP, "Failed to restart renderer: %{public}d", result);
         
-        // 完全重建渲染器
+        // 完全重建渲染器（新渲染器启动成功后才释放旧的）
         OH_LOG_INFO(LOG_APP, "Attempting full renderer rebuild...");
-        OH_AudioRenderer_Release(renderer_);
-        renderer_ = nullptr;
-        
-        if (builder_ != nullptr) {
-            result = OH_AudioStreamBuilder_GenerateRenderer(builder_, &renderer_);
-            if (result != AUDIOSTREAM_SUCCESS || renderer_ == nullptr) {
-                OH_LOG_ERROR(LOG_APP, "Failed to rebuild renderer: %{public}d", result);
-                return -1;
-            }
-            
-            if (config_.volume > 0.0f && config_.volume <= 1.0f) {
-                OH_AudioRenderer_SetVolume(renderer_, config_.volume);
-            }
-            
-            result = OH_AudioRenderer_Start(renderer_);
-            if (result != AUDIOSTREAM_SUCCESS) {
-                OH_LOG_ERROR(LOG_APP, "Failed to start rebuilt renderer: %{public}d", result);
-                return -1;
-            }
-        } else {
-            OH_LOG_ERROR(LOG_APP, "Cannot rebuild: builder is null");
+        if (RebuildRendererLocked() != 0) {
             return -1;
         }
     }
@@ -543,10 +543,324 @@ int AudioRenderer::TryRestart() {
     running_ = true;
     needRestart_ = false;
     consecutiveErrors_ = 0;
+    if (switchStartNs_.load(std::memory_order_relaxed) != 0) {
+        switchArmed_.store(true, std::memory_order_release);
+    }
     OH_LOG_INFO(LOG_APP, "Audio renderer restarted successfully");
     return 0;
 }
 
+int AudioRenderer::RebuildRendererLocked() {
+    if (builder_ == nullptr) {
+        OH_LOG_ERROR(LOG_APP, "Cannot rebuild: builder is null");
+        return -1;
+    }
+    
+    OH_AudioRenderer* fresh = nullptr;
+    OH_AudioStream_Result result = OH_AudioStreamBuilder_GenerateRenderer(builder_, &fresh);
+    if (result != AUDIOSTREAM_SUCCESS || fresh == nullptr) {
+        OH_LOG_ERROR(LOG_APP, "Failed to rebuild renderer: %{public}d", result);
+        return -1;
+    }
+    
+    if (config_.volume > 0.0f && config_.volume <= 1.0f) {
+        OH_AudioRenderer_SetVolume(fresh, config_.volume);
+    }
+    
+    // 新渲染器先启动：切换 activeRenderer_ 之前它的回调只输出静音；
+    // 切换后旧渲染器尚未返回的回调与新渲染器之间由 consuming_ 互斥（见 OnWriteData）
+    result = OH_AudioRenderer_Start(fresh);
+    if (result != AUDIOSTREAM_SUCCESS) {
+        OH_LOG_ERROR(LOG_APP, "Failed to start rebuilt renderer: %{public}d", result);
+        OH_AudioRenderer_Release(fresh);
+        return -1;
+    }
+    
+    OH_AudioRenderer* old = renderer_;
+    renderer_ = fresh;
+    activeRenderer_.store(fresh, std::memory_order_release);
+    if (old != nullptr) {
+        OH_AudioRenderer_Stop(old);
+        OH_AudioRenderer_Release(old);
+    }
+    switchRebuilds_.fetch_add(1, std::memory_order_relaxed);
+    return 0;
+}
+
+// =============================================================================
+// 输出设备切换
+// =============================================================================
+
+void AudioRenderer::RequestRouteSwitch() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    int64_t nowNs = static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+    
+    // 连续事件（如蓝牙连接时 NEW_DEVICE + OVERRODE）从第一次开始计时
+    int64_t expected = 0;
+    switchStartNs_.compare_exchange_strong(expected, nowNs, std::memory_order_relaxed);
+    switchArmed_.store(false, std::memory_order_relaxed);
+    switchRequested_.store(true, std::memory_order_release);
+    
+    // Stop/Cleanup 正在等待切换线程时不再启动新线程
+    std::unique_lock<std::mutex> lock(switchThreadMutex_, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return;
+    }
+    bool idle = false;
+    if (switchRunning_.compare_exchange_strong(idle, true, std::memory_order_acq_rel)) {
+        if (switchThread_.joinable()) {
+            switchThread_.join();  // 上一个切换线程已退出主循环
+        }
+        switchThread_ = std::thread(&AudioRenderer::RouteSwitchLoop, this);
+    }
+}
+
+void AudioRenderer::RouteSwitchLoop() {
+    for (;;) {
+        while (switchRequested_.exchange(false, std::memory_order_acq_rel)) {
+            deviceSwitches_.fetch_add(1, std::memory_order_relaxed);
+            if (SwitchRoute() != 0) {
+                // 快速路径失败：回退到 AudioRecv 线程上的完整重启（清空缓冲）
+                switchFailures_.fetch_add(1, std::memory_order_relaxed);
+                needRestart_ = true;
+            }
+        }
+        switchRunning_.store(false, std::memory_order_release);
+        
+        // 退出前到达的新请求由本线程继续处理
+        bool idle = false;
+        if (!switchRequested_.load(std::memory_order_acquire) ||
+            !switchRunning_.compare_exchange_strong(idle, true, std::memory_order_acq_rel)) {
+            break;
+        }
+    }
+}
+
+int AudioRenderer::SwitchRoute() {
+    std::lock_guard<std::mutex> lock(rendererMutex_);
+    if (renderer_ == nullptr || !running_) {
+        // 被中断暂停或已停止：由中断恢复 / Start 处理
+        switchStartNs_.store(0, std::memory_order_relaxed);
+        return 0;
+    }
+    
+    OH_AudioStream_State state = AUDIOSTREAM_STATE_INVALID;
+    OH_AudioRenderer_GetCurrentState(renderer_, &state);
+    
+    const char* path = "in-place";
+    if (state != AUDIOSTREAM_STATE_RUNNING) {
+        // 系统因旧设备移除暂停了流：原地恢复，不 Flush、不清空环形缓冲
+        OH_AudioStream_Result result = OH_AudioRenderer_Start(renderer_);
+        path = "resume";
+        if (result != AUDIOSTREAM_SUCCESS) {
+            OH_LOG_WARN(LOG_APP, "Route switch: resume failed (%{public}d, state=%{public}d), rebuilding",
+                        result, state);
+            if (RebuildRendererLocked() != 0) {
+                return -1;
+            }
+            path = "rebuild";
+        }
+    }
+    
+    DetectRoute();
+    
+    // 新路由首段数据渐入（复用 underrun 恢复的 fade-in）
+    wasUnderrun_.store(true, std::memory_order_relaxed);
+    switchArmed_.store(true, std::memory_order_release);
+    consecutiveErrors_ = 0;
+    
+    OH_LOG_INFO(LOG_APP, "Route switch (%{public}s): route=%{public}d cap=%{public}dms, ring kept %{public}.1fms",
+                path, route_.load(std::memory_order_relaxed), routeCapMs_.load(std::memory_order_relaxed),
+                GetBufferLatencyMs());
+    return 0;
+}
+
+void AudioRenderer::JoinSwitchThread() {
+    std::lock_guard<std::mutex> lock(switchThreadMutex_);
+    if (switchThread_.joinable()) {
+        switchThread_.join();
+    }
+    switchRequested_.store(false, std::memory_order_relaxed);
+}
+
+void AudioRenderer::DetectRoute() {
+    LoadAudioApis();
+    AudioRoute route = AudioRoute::UNKNOWN;
+    
+    OH_AudioRoutingManager* manager = nullptr;
+    OH_AudioDeviceDescriptorArray* devices = nullptr;
+    if (g_pfnGetRoutingManager && g_pfnGetPreferredOutputDevice && g_pfnGetDeviceType &&
+        g_pfnGetRoutingManager(&manager) == AUDIOCOMMON_RESULT_SUCCESS && manager != nullptr &&
+        g_pfnGetPreferredOutputDevice(manager, AUDIOSTREAM_USAGE_GAME, &devices) == AUDIOCOMMON_RESULT_SUCCESS &&
+        devices != nullptr) {
+        OH_AudioDevice_Type type = AUDIO_DEVICE_TYPE_INVALID;
+        if (devices->size > 0 && devices->descriptors[0] != nullptr &&
+            g_pfnGetDeviceType(devices->descriptors[0], &type) == AUDIOCOMMON_RESULT_SUCCESS) {
+            switch (type) {
+                case AUDIO_DEVICE_TYPE_SPEAKER:
+                case AUDIO_DEVICE_TYPE_EARPIECE:
+                    route = AudioRoute::SPEAKER;
+                    break;
+                case AUDIO_DEVICE_TYPE_WIRED_HEADSET:
+                case AUDIO_DEVICE_TYPE_WIRED_HEADPHONES:
+                    route = AudioRoute::WIRED;
+                    break;
+                case AUDIO_DEVICE_TYPE_USB_HEADSET:
+                case AUDIO_DEVICE_TYPE_DISPLAY_PORT:
+                    route = AudioRoute::USB;
+                    break;
+                case AUDIO_DEVICE_TYPE_BLUETOOTH_SCO:
+                case AUDIO_DEVICE_TYPE_BLUETOOTH_A2DP:
+                    route = AudioRoute::BLUETOOTH;
+                    break;
+                default:
+                    route = AudioRoute::OTHER;
+                    break;
+            }
+        }
+        if (g_pfnReleaseDevices) {
+            g_pfnReleaseDevices(manager, devices);
+        }
+    }
+    
+    ApplyRouteProfile(route);
+}
+
+// =============================================================================
+// 路由延迟档案
+// =============================================================================
+
+void AudioRenderer::ApplyRouteProfile(AudioRoute route) {
+    int index = static_cast<int>(route);
+    int capMs = learnedCapMs_[index].load(std::memory_order_relaxed);
+    if (capMs <= 0) {
+        switch (route) {
+            case AudioRoute::SPEAKER:
+            case AudioRoute::WIRED:
+            case AudioRoute::USB:
+                capMs = LOCAL_LATENCY_CAP_MS;
+                break;
+            case AudioRoute::BLUETOOTH:
+                capMs = BLUETOOTH_LATENCY_CAP_MS;
+                break;
+            default:
+                capMs = MAX_AUDIO_LATENCY_MS;
+                break;
+        }
+    }
+    
+    route_.store(index, std::memory_order_relaxed);
+    routeCapMs_.store(capMs, std::memory_order_relaxed);
+    // 切换期间的回调间隔不代表新路由的节奏
+    cadenceReset_.store(true, std::memory_order_release);
+    // 旧路由的设备延迟不再有效
+    deviceLatencyUs_.store(-1, std::memory_order_relaxed);
+}
+
+void AudioRenderer::UpdateRouteProfile(int framesRequested) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    int64_t nowNs = static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+    
+    if (cadenceReset_.exchange(false, std::memory_order_acq_rel)) {
+        lastCallbackNs_ = 0;
+        windowCallbacks_ = 0;
+        windowIntervalSumNs_ = 0;
+        windowMaxIntervalNs_ = 0;
+        windowMaxFrames_ = 0;
+        windowStartUnderruns_ = underruns_.load(std::memory_order_relaxed);
+    }
+    
+    if (lastCallbackNs_ != 0) {
+        int64_t interval = nowNs - lastCallbackNs_;
+        windowIntervalSumNs_ += interval;
+        windowMaxIntervalNs_ = std::max(windowMaxIntervalNs_, interval);
+        windowCallbacks_++;
+    }
+    lastCallbackNs_ = nowNs;
+    windowMaxFrames_ = std::max(windowMaxFrames_, framesRequested);
+    
+    if (windowCallbacks_ < CADENCE_WINDOW_CALLBACKS || config_.sampleRate <= 0) {
+        return;
+    }
+    
+    double avgIntervalMs = (double)windowIntervalSumNs_ / windowCallbacks_ / 1000000.0;
+    double maxIntervalMs = (double)windowMaxIntervalNs_ / 1000000.0;
+    double burstMs = (double)windowMaxFrames_ * 1000.0 / config_.sampleRate;
+    double frameMs = (double)config_.samplesPerFrame * 1000.0 / config_.sampleRate;
+    uint32_t underruns = underruns_.load(std::memory_order_relaxed);
+    bool underrun = (underruns != windowStartUnderruns_);
+    
+    cbAvgIntervalUs_.store(static_cast<uint32_t>(avgIntervalMs * 1000.0), std::memory_order_relaxed);
+    cbMaxIntervalUs_.store(static_cast<uint32_t>(maxIntervalMs * 1000.0), std::memory_order_relaxed);
+    cbBurstUs_.store(static_cast<uint32_t>(burstMs * 1000.0), std::memory_order_relaxed);
+    
+    // 环形缓冲需要扛住：一次最大取数 + 最长卡顿期间的累积 + 一个网络包 + 网络抖动余量
+    int target = static_cast<int>(std::ceil(burstMs + (maxIntervalMs - avgIntervalMs) + frameMs)) +
+                 NETWORK_MARGIN_MS;
+    int current = routeCapMs_.load(std::memory_order_relaxed);
+    if (underrun) {
+        target = std::max(target, current + static_cast<int>(std::ceil(frameMs)));
+    }
+    int next = (target >= current) ? target : std::max(target, current - CAP_DECAY_MS);
+    next = std::clamp(next, MIN_ROUTE_CAP_MS, MAX_ROUTE_CAP_MS);
+    
+    if (next != current) {
+        routeCapMs_.store(next, std::memory_order_relaxed);
+        OH_LOG_INFO(LOG_APP, "Route %{public}d cap %{public}d -> %{public}dms (interval avg=%{public}.1f "
+                    "max=%{public}.1f burst=%{public}.1f underrun=%{public}d)",
+                    route_.load(std::memory_order_relaxed), current, next,
+                    avgIntervalMs, maxIntervalMs, burstMs, underrun ? 1 : 0);
+    }
+    learnedCapMs_[route_.load(std::memory_order_relaxed)].store(next, std::memory_order_relaxed);
+    
+    windowCallbacks_ = 0;
+    windowIntervalSumNs_ = 0;
+    windowMaxIntervalNs_ = 0;
+    windowMaxFrames_ = 0;
+    windowStartUnderruns_ = underruns;
+}
+
+void AudioRenderer::PollDeviceLatency() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    int64_t nowNs = static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+    if (nowNs - lastDeviceQueryNs_ < DEVICE_LATENCY_POLL_MS * 1000000LL) {
+        return;
+    }
+    lastDeviceQueryNs_ = nowNs;
+    
+    double ms = QueryDeviceLatencyMs();
+    if (ms < 0.0) {
+        return;
+    }
+    int32_t sampleUs = static_cast<int32_t>(ms * 1000.0);
+    int32_t prevUs = deviceLatencyUs_.load(std::memory_order_relaxed);
+    // 时间戳本身按回调粒度跳变，EWMA 平滑
+    deviceLatencyUs_.store(prevUs < 0 ? sampleUs : (prevUs * 3 + sampleUs) / 4, std::memory_order_relaxed);
+}
+
+void AudioRenderer::FinishSwitchMeasurement() {
+    int64_t startNs = switchStartNs_.load(std::memory_order_relaxed);
+    if (startNs == 0 || !switchStartNs_.compare_exchange_strong(startNs, 0, std::memory_order_relaxed)) {
+        return;
+    }
+    switchArmed_.store(false, std::memory_order_relaxed);
+    
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    int64_t nowNs = static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+    uint64_t silenceUs = static_cast<uint64_t>(std::max<int64_t>(0, nowNs - startNs) / 1000);
+    
+    lastSwitchSilenceUs_.store(silenceUs, std::memory_order_relaxed);
+    totalSwitchSilenceUs_.fetch_add(silenceUs, std::memory_order_relaxed);
+    measuredSwitches_.fetch_add(1, std::memory_order_relaxed);
+    if (silenceUs > maxSwitchSilenceUs_.load(std::memory_order_relaxed)) {
+        maxSwitchSilenceUs_.store(silenceUs, std::memory_order_relaxed);
+    }
+}
+
 AudioRendererStats AudioRenderer::GetStats() const {
     AudioRendererStats stats;
     stats.totalSamples = totalSamples_.load(std::memory_order_relaxed);
@@ -555,32 +869,79 @@ AudioRendererStats AudioRenderer::GetStats() const {
     stats.underruns = underruns_.load(std::memory_order_relaxed);
     
     // 计算当前缓冲区延迟
-    int head = ringHead_.load(std::memory_order_relaxed);
-    int tail = ringTail_.load(std::memory_order_relaxed);
-    int buffered;
-    if (tail >= head) {
-        buffered = tail - head;
-    } else {
-        buffered = ringCapacity_ - head + tail;
-    }
+    int buffered = static_cast<int>(ring_.Size());
     int bufferedSamples = buffered / std::max(config_.channelCount, 1);
     stats.latencyMs = (config_.sampleRate > 0) 
         ? (bufferedSamples * 1000.0 / config_.sampleRate) 
         : 0.0;
     
+    stats.deviceLatencyMs = GetDeviceLatencyMs();
+    stats.outputLatencyMs = GetOutputLatencyMs();
+    stats.callbackIntervalMs = cbAvgIntervalUs_.load(std::memory_order_relaxed) / 1000.0;
+    stats.callbackMaxIntervalMs = cbMaxIntervalUs_.load(std::memory_order_relaxed) / 1000.0;
+    stats.callbackBurstMs = cbBurstUs_.load(std::memory_order_relaxed) / 1000.0;
+    
+    stats.route = static_cast<AudioRoute>(route_.load(std::memory_order_relaxed));
+    stats.routeCapMs = routeCapMs_.load(std::memory_order_relaxed);
+    stats.latencyCapMs = routeCapMs_.load(std::memory_order_relaxed) -
+                         latencyTrimMs_.load(std::memory_order_relaxed);
+    stats.deviceSwitches = deviceSwitches_.load(std::memory_order_relaxed);
+    stats.switchRebuilds = switchRebuilds_.load(std::memory_order_relaxed);
+    stats.switchFailures = switchFailures_.load(std::memory_order_relaxed);
+    uint32_t measured = measuredSwitches_.load(std::memory_order_relaxed);
+    stats.lastSwitchSilenceMs = lastSwitchSilenceUs_.load(std::memory_order_relaxed) / 1000.0;
+    stats.maxSwitchSilenceMs = maxSwitchSilenceUs_.load(std::memory_order_relaxed) / 1000.0;
+    stats.avgSwitchSilenceMs = (measured > 0)
+        ? (totalSwitchSilenceUs_.load(std::memory_order_relaxed) / 1000.0 / measured)
+        : 0.0;
+    
     return stats;
 }
 
 double AudioRenderer::GetBufferLatencyMs() const {
-    int head = ringHead_.load(std::memory_order_relaxed);
-    int tail = ringTail_.load(std::memory_order_relaxed);
-    int buffered = (tail >= head) ? (tail - head) : (ringCapacity_ - head + tail);
+    int buffered = static_cast<int>(ring_.Size());
     int channelCount = std::max(config_.channelCount, 1);
     return (config_.sampleRate > 0)
         ? ((double)(buffered / channelCount) * 1000.0 / config_.sampleRate)
         : 0.0;
 }
 
+double AudioRenderer::GetDeviceLatencyMs() const {
+    int32_t us = deviceLatencyUs_.load(std::memory_order_relaxed);
+    return (us < 0) ? -1.0 : us / 1000.0;
+}
+
+double AudioRenderer::GetOutputLatencyMs() const {
+    double deviceMs = GetDeviceLatencyMs();
+    return GetBufferLatencyMs() + std::max(deviceMs, 0.0);
+}
+
+double AudioRenderer::QueryDeviceLatencyMs() const {
+    // 设备切换进行中时不等待，直接视为不可用
+    std::unique_lock<std::mutex> lock(rendererMutex_, std::try_to_lock);
+    if (!lock.owns_lock() || renderer_ == nullptr || !running_ || config_.sampleRate <= 0) {
+        return -1.0;
+    }
+    
+    int64_t framesWritten = 0;
+    int64_t framePosition = 0;
+    int64_t timestampNs = 0;
+    if (OH_AudioRenderer_GetFramesWritten(renderer_, &framesWritten) != AUDIOSTREAM_SUCCESS ||
+        OH_AudioRenderer_GetTimestamp(renderer_, CLOCK_MONOTONIC, &framePosition, &timestampNs) != AUDIOSTREAM_SUCCESS ||
+        timestampNs <= 0) {
+        return -1.0;
+    }
+    
+    // framePosition 帧在 timestampNs 时刻出声，之后写入的帧还要排队 (written - position) 帧；
+    // 扣掉时间戳采样以来已经播放的时长
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    int64_t nowNs = static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+    double queuedMs = (double)(framesWritten - framePosition) * 1000.0 / config_.sampleRate;
+    double elapsedMs = (double)(nowNs - timestampNs) / 1000000.0;
+    return std::max(0.0, queuedMs - elapsedMs);
+}
+
 // =============================================================================
 // OHAudio 回调实现
 // =============================================================================
@@ -588,8 +949,18 @@ double AudioRenderer::GetBufferLatencyMs() const {
 OH_AudioData_Callback_Result AudioRenderer::OnWriteData(OH_AudioRenderer* renderer, void* userData,
                                     void* buffer, int32_t bufferLen) {
     AudioRenderer* self = static_cast<AudioRenderer*>(userData);
-    if (self == nullptr || !self->running_) {
-        // 填充静音
+    // 先建后拆切换时，旧渲染器的回调可能已通过 activeRenderer_ 检查、仍在读取环形缓冲，
+    // 新渲染器的回调同时到达。consuming_ 保证同一时刻只有一个回调作为 SPSC 消费者，
+    // 抢不到的一方输出静音而不阻塞音频线程；持有后再确认一次自己仍是当前渲染器
+    bool owner = self != nullptr && self->running_ &&
+        renderer == self->activeRenderer_.load(std::memory_order_acquire) &&
+        !self->consuming_.exchange(true, std::memory_order_acquire);
+    if (owner && renderer != self->activeRenderer_.load(std::memory_order_acquire)) {
+        self->consuming_.store(false, std::memory_order_release);
+        owner = false;
+    }
+    if (!owner) {
+        // 填充静音（含设备切换时尚未接管 / 已被替换的渲染器）
         memset(buffer, 0, bufferLen);
         return AUDIO_DATA_CALLBACK_RESULT_VALID;
     }
@@ -608,31 +979,26 @@ OH_AudioData_Callback_Result AudioRenderer::OnWriteData(OH_AudioRenderer* render
     int16_t* outBuffer = static_cast<int16_t*>(buffer);
     int samplesNeeded = bufferLen / sizeof(int16_t);
     
-    int head = self->ringHead_.load(std::memory_order_relaxed);
-    int tail = self->ringTail_.load(std::memory_order_acquire);
-    
-    // 计算可读数据量
-    int available;
-    if (tail >= head) {
-        available = tail - head;
-    } else {
-        available = self->ringCapacity_ - head + tail;
-    }
-    
-    int toCopy = std::min(available, samplesNeeded);
+    // 取最多 samplesNeeded 个采样（最多两段连续区间）
+    RingSpanPair<const int16_t> spans = self->ring_.PrepareRead(static_cast<uint32_t>(samplesNeeded));
+    int toCopy = static_cast<int>(spans.Total());
     int channelCount = std::max(self->config_.channelCount, 1);
+    self->UpdateRouteProfile(samplesNeeded / channelCount);
     // 渐变长度（按采样帧计，非采样点）：约 2ms @48kHz = 96 采样帧
     // 使用较短的渐变避免过度修改有效音频数据
     static constexpr int FADE_FRAMES = 96;
     
     if (toCopy > 0) {
-        // 从环形缓冲区读取
-        int firstPart = std::min(toCopy, self->ringCapacity_ - head);
-        memcpy(outBuffer, self->ringBuffer_ + head, firstPart * sizeof(int16_t));
-        if (firstPart < toCopy) {
-            memcpy(outBuffer + firstPart, self->ringBuffer_, (toCopy - firstPart) * sizeof(int16_t));
+        // 从环形缓冲区读取，整批提交
+        memcpy(outBuffer, spans.first.data, spans.first.size * sizeof(int16_t));
+        if (spans.second.size > 0) {
+            memcpy(outBuffer + spans.first.size, spans.second.data, spans.second.size * sizeof(int16_t));
+        }
+        self->ring_.CommitRead(static_cast<uint32_t>(toCopy));
+        
+        if (self->switchArmed_.load(std::memory_order_acquire)) {
+            self->FinishSwitchMeasurement();
         }
-        self->ringHead_.store((head + toCopy) % self->ringCapacity_, std::memory_order_release);
         
         // Underrun 后恢复：对开头数据施加渐入（fade-in），避免静音→有信号的波形跳变
         if (self->wasUnderrun_.load(std::memory_order_relaxed)) {
@@ -676,6 +1042,7 @@ OH_AudioData_Callback_Result AudioRenderer::OnWriteData(OH_AudioRenderer* render
     // 更新已播放样本数（按通道换算）
     self->playedSamples_.fetch_add(toCopy / channelCount, std::memory_order_relaxed);
     
+    self->consuming_.store(false, std::memory_order_release);
     return AUDIO_DATA_CALLBACK_RESULT_VALID;
 }
 
@@ -686,11 +1053,9 @@ void AudioRenderer::OnDeviceChange(OH_AudioRenderer* renderer, void* userData,
     AudioRenderer* self = static_cast<AudioRenderer*>(userData);
     if (self == nullptr) return;
     
-    if (reason == REASON_OLD_DEVICE_UNAVAILABLE) {
-        // 旧设备不可用（如拔出耳机），标记重启
-        OH_LOG_WARN(LOG_APP, "Audio device unavailable, scheduling restart");
-        self->needRestart_ = true;
-    }
+    // 旧设备不可用（拔出耳机）、新设备接入（蓝牙连接）、用户改选设备：
+    // 都在切换线程上走快速路径，保留环形缓冲内容，不阻塞本回调线程
+    self->RequestRouteSwitch();
 }
 
 void AudioRenderer::OnInterruptEvent(OH_AudioRenderer* renderer, void* userData,
@@ -840,4 +1205,35 @@ double GetBufferLatencyMs() {
     return 0.0;
 }
 
+double GetDeviceLatencyMs() {
+    AudioRenderer* renderer = g_audioRenderer.load(std::memory_order_acquire);
+    if (renderer != nullptr) {
+        return renderer->GetDeviceLatencyMs();
+    }
+    return -1.0;
+}
+
+double GetOutputLatencyMs() {
+    AudioRenderer* renderer = g_audioRenderer.load(std::memory_order_acquire);
+    if (renderer != nullptr) {
+        return renderer->GetOutputLatencyMs();
+    }
+    return 0.0;
+}
+
+int GetRouteLatencyCapMs() {
+    AudioRenderer* renderer = g_audioRenderer.load(std::memory_order_acquire);
+    if (renderer != nullptr) {
+        return renderer->GetRouteLatencyCapMs();
+    }
+    return AudioRenderer::MAX_AUDIO_LATENCY_MS;
+}
+
+void SetLatencyTrimMs(int trimMs) {
+    AudioRenderer* renderer = g_audioRenderer.load(std::memory_order_acquire);
+    if (renderer != nullptr) {
+        renderer->SetLatencyTrimMs(trimMs);
+    }
+}
+
 } // namespace AudioRendererInstance
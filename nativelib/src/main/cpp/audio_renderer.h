@@ -15,9 +15,13 @@
  * 使用 HarmonyOS OHAudio API 播放解码后的 PCM 音频数据
  * 
  * 性能优化：
- * - 无锁环形缓冲区替代 std::queue + new/delete，消除每帧堆分配
+ * - 无锁环形缓冲区 (SpscRing) 替代 std::queue + new/delete，消除每帧堆分配
  * - 音频工作组 (AudioWorkgroup) 集成，保障音频线程调度优先级
  * - 始终设置 QoS_USER_INTERACTIVE，降低回调延迟
+ * - 输出设备切换走快速路径：原地恢复或先建后拆新渲染器，环形缓冲内容保留，
+ *   新路由首段数据渐入
+ * - 按路由的延迟档案：观测 OHAudio 回调节奏（间隔、单次取数量、卡顿）推导
+ *   环形缓冲丢弃阈值，并通过时间戳 API 测量真实输出延迟（环形缓冲 + 设备）
  */
 
 #ifndef AUDIO_RENDERER_H
@@ -26,9 +30,11 @@
 #include <cstdint>
 #include <mutex>
 #include <atomic>
+#include <thread>
 #include <ohaudio/native_audiostream_base.h>
 #include <ohaudio/native_audiostreambuilder.h>
 #include <ohaudio/native_audiorenderer.h>
+#include "lockfree_ring.h"
 
 /**
  * 音频配置
@@ -42,6 +48,18 @@ struct AudioRendererConfig {
     bool enableSpatialAudio;  // 是否启用空间音频（HarmonyOS 5.0+）
 };
 
+/**
+ * 音频输出路由类别
+ */
+enum class AudioRoute : int {
+    UNKNOWN = 0,
+    SPEAKER = 1,      // 扬声器 / 听筒
+    WIRED = 2,        // 有线耳机
+    USB = 3,          // USB 耳机 / DisplayPort
+    BLUETOOTH = 4,    // A2DP / SCO
+    OTHER = 5,        // 投屏等
+};
+
 /**
  * 音频统计信息
  */
@@ -51,6 +69,26 @@ struct AudioRendererStats {
     uint64_t droppedSamples;
     uint32_t underruns;
     double latencyMs;         // 当前环形缓冲区中的音频延迟（毫秒）
+    
+    // 输出延迟（时间戳 API 测量）
+    double deviceLatencyMs;       // OHAudio 内部（已写入未出声），EWMA；未测得时为 -1
+    double outputLatencyMs;       // 环形缓冲 + 设备 = 解码完成到出声
+    
+    // 路由延迟档案（回调节奏推导）
+    double callbackIntervalMs;    // 回调平均间隔（最近一个观测窗口）
+    double callbackMaxIntervalMs; // 回调最大间隔
+    double callbackBurstMs;       // 单次回调最大取数量（毫秒）
+    
+    // 输出设备切换
+    AudioRoute route;             // 当前路由
+    int routeCapMs;               // 当前路由的延迟上限（回调节奏推导）
+    int latencyCapMs;             // 当前生效的延迟上限（路由上限 - 同步收紧量）
+    uint32_t deviceSwitches;      // 设备切换次数
+    uint32_t switchRebuilds;      // 其中需要重建渲染器的次数
+    uint32_t switchFailures;      // 快速路径失败、回退到完整重启的次数
+    double lastSwitchSilenceMs;   // 最近一次：设备变更 → 新路由首个有效回调
+    double maxSwitchSilenceMs;
+    double avgSwitchSilenceMs;
 };
 
 /**
@@ -58,6 +96,12 @@ struct AudioRendererStats {
  */
 class AudioRenderer {
 public:
+    static constexpr int MAX_AUDIO_LATENCY_MS = 40;    // 未知路由的延迟丢弃阈值（毫秒），匹配 Android
+    static constexpr int LOCAL_LATENCY_CAP_MS = 30;    // 扬声器 / 有线 / USB 的初始阈值（观测后下调）
+    static constexpr int BLUETOOTH_LATENCY_CAP_MS = 60; // 蓝牙初始阈值：回调成批取数，需要更多余量
+    static constexpr int MIN_ROUTE_CAP_MS = 15;        // 推导结果下限
+    static constexpr int MAX_ROUTE_CAP_MS = 80;        // 推导结果上限（决定环形缓冲容量）
+    
     AudioRenderer();
     ~AudioRenderer();
     
@@ -109,6 +153,30 @@ public:
      */
     double GetBufferLatencyMs() const;
     
+    /**
+     * 获取 OHAudio 内部（已写入但尚未出声）的延迟（毫秒）
+     * PlaySamples 中按 DEVICE_LATENCY_POLL_MS 查询时间戳并 EWMA 平滑，这里只读缓存
+     * @return 延迟毫秒数，尚未测得时返回 -1
+     */
+    double GetDeviceLatencyMs() const;
+    
+    /**
+     * 获取真实输出延迟（毫秒）：环形缓冲 + OHAudio 设备延迟
+     * 设备延迟尚未测得时只含环形缓冲部分
+     */
+    double GetOutputLatencyMs() const;
+    
+    /**
+     * 当前路由的延迟上限（毫秒），设备切换后随路由更新
+     */
+    int GetRouteLatencyCapMs() const { return routeCapMs_.load(std::memory_order_relaxed); }
+    
+    /**
+     * 设置延迟上限的收紧量（毫秒），生效上限 = 路由上限 - trim
+     * 由 AvSyncController 调整，默认 0
+     */
+    void SetLatencyTrimMs(int trimMs) { latencyTrimMs_.store(trimMs, std::memory_order_relaxed); }
+    
     /**
      * 检查是否已初始化
      */
@@ -134,6 +202,12 @@ private:
     // 音频渲染器实例
     OH_AudioRenderer* renderer_ = nullptr;
     OH_AudioStreamBuilder* builder_ = nullptr;
+    // 保护 renderer_ 替换：切换线程 / AudioRecv (TryRestart) / JS 线程 (SetVolume)
+    mutable std::mutex rendererMutex_;
+    // OnWriteData 只为当前渲染器读取环形缓冲（先建后拆期间新旧渲染器同时存在）
+    std::atomic<OH_AudioRenderer*> activeRenderer_{nullptr};
+    // 环形缓冲消费者占用标志：切换瞬间新旧渲染器的回调可能并发，只允许一个读取
+    std::atomic<bool> consuming_{false};
     
     // 配置
     AudioRendererConfig config_;
@@ -143,20 +217,50 @@ private:
     // 生产者: PlaySamples() (解码线程)
     // 消费者: OnWriteData() (OHAudio 音频回调线程)
     // =========================================================================
-    // 缓冲区容量：根据实际声道数动态计算，所有声道配置统一 TARGET_BUFFER_MS 时长
-    // 对于 stereo @48kHz: 48000×2×50/1000 = 4800 采样 = 50ms
-    // 对于 5.1   @48kHz: 48000×6×50/1000 = 14400 采样 = 50ms
-    // 对于 7.1   @48kHz: 48000×8×50/1000 = 19200 采样 = 50ms
+    // 缓冲区容量：MAX_ROUTE_CAP_MS + 一帧，SpscRing 向上取整到 2 的幂
+    // 对于 stereo @48kHz: 48000×2×85/1000 = 8160  → 8192 采样
+    // 对于 5.1   @48kHz: 48000×6×85/1000 = 24480 → 32768 采样
+    // 对于 7.1   @48kHz: 48000×8×85/1000 = 32640 → 32768 采样
+    // 容量按最宽路由一次分配，路由切换只改丢弃阈值，无需在播放中重新分配
     //
     // 延迟控制：PlaySamples 中检查缓冲区填充水平，
-    // 超过 MAX_AUDIO_LATENCY_MS (40ms) 时丢弃新数据，匹配 Android 40ms 上限
-    static constexpr int TARGET_BUFFER_MS = 50;        // 环形缓冲区容量（毫秒）
-    static constexpr int MAX_AUDIO_LATENCY_MS = 40;    // 延迟丢弃阈值（毫秒），匹配 Android
+    // 超过 routeCapMs_ - latencyTrimMs_ 时丢弃新数据：
+    // routeCapMs_ 由回调节奏推导（见 UpdateRouteProfile），音视频同步时可被收紧以追上画面
+    SpscRing<int16_t> ring_;        // 交错 PCM 采样（head/tail 分属不同 cache line）
+    std::atomic<int> routeCapMs_{MAX_AUDIO_LATENCY_MS};
+    std::atomic<int> latencyTrimMs_{0};
+    std::atomic<int> route_{static_cast<int>(AudioRoute::UNKNOWN)};
+    
+    // =========================================================================
+    // 路由延迟档案
+    // =========================================================================
+    // 每个观测窗口（CADENCE_WINDOW_CALLBACKS 次回调）统计回调间隔与单次取数量，
+    // 推导 上限 = 最大单次取数 + 最大卡顿(最大间隔 - 平均间隔) + 一帧 + 网络余量：
+    // - 推导值更高或窗口内发生 underrun → 立即上调
+    // - 推导值更低 → 每窗口最多下调 CAP_DECAY_MS，避免一次偶然的平稳窗口压得过低
+    // 结果按路由记住，切回同一路由时直接复用
+    static constexpr int CADENCE_WINDOW_CALLBACKS = 200;   // 5ms 回调下约 1 秒
+    static constexpr int NETWORK_MARGIN_MS = 10;
+    static constexpr int CAP_DECAY_MS = 4;
+    static constexpr int ROUTE_COUNT = 6;
+    static constexpr int DEVICE_LATENCY_POLL_MS = 100;
     
-    int ringCapacity_ = 0;          // 实际环形缓冲区容量（int16_t 数量，含 SPSC 保留位）
-    int16_t* ringBuffer_ = nullptr; // 动态分配的环形缓冲区
-    std::atomic<int> ringHead_{0};  // 消费者读位置（OnWriteData 更新）
-    std::atomic<int> ringTail_{0};  // 生产者写位置（PlaySamples 更新）
+    std::atomic<int> learnedCapMs_[ROUTE_COUNT] = {};      // 0 = 该路由尚未观测
+    std::atomic<bool> cadenceReset_{true};                 // 路由变化后丢弃当前窗口
+    // 观测窗口（仅 OHAudio 回调线程访问）
+    int64_t lastCallbackNs_ = 0;
+    int windowCallbacks_ = 0;
+    int64_t windowIntervalSumNs_ = 0;
+    int64_t windowMaxIntervalNs_ = 0;
+    int windowMaxFrames_ = 0;
+    uint32_t windowStartUnderruns_ = 0;
+    // 最近一个窗口的结果
+    std::atomic<uint32_t> cbAvgIntervalUs_{0};
+    std::atomic<uint32_t> cbMaxIntervalUs_{0};
+    std::atomic<uint32_t> cbBurstUs_{0};
+    // 设备延迟（AudioRecv 线程按 DEVICE_LATENCY_POLL_MS 查询）
+    std::atomic<int32_t> deviceLatencyUs_{-1};
+    int64_t lastDeviceQueryNs_ = 0;
     
     // 统计信息（原子操作避免锁）
     std::atomic<uint64_t> totalSamples_{0};
@@ -176,11 +280,86 @@ private:
     std::atomic<int> consecutiveErrors_{0};
     static constexpr int MAX_ERRORS_BEFORE_RESTART = 3;
     
+    // 设备切换（OnDeviceChange → 切换线程，不阻塞 OHAudio 回调线程与 AudioRecv 线程）
+    std::thread switchThread_;
+    std::mutex switchThreadMutex_;
+    std::atomic<bool> switchRequested_{false};
+    std::atomic<bool> switchRunning_{false};
+    std::atomic<int64_t> switchStartNs_{0};     // 非 0：本次切换的设备变更时刻
+    std::atomic<bool> switchArmed_{false};       // 切换已完成，等待新路由首个有效回调
+    std::atomic<uint32_t> deviceSwitches_{0};
+    std::atomic<uint32_t> switchRebuilds_{0};
+    std::atomic<uint32_t> switchFailures_{0};
+    std::atomic<uint32_t> measuredSwitches_{0};
+    std::atomic<uint64_t> lastSwitchSilenceUs_{0};
+    std::atomic<uint64_t> maxSwitchSilenceUs_{0};
+    std::atomic<uint64_t> totalSwitchSilenceUs_{0};
+    
     /**
      * 尝试重启音频渲染器（内部使用）
      * @return 0 成功，负数失败
      */
     int TryRestart();
+    
+    /**
+     * 请求设备切换（OHAudio 回调线程调用，合并连续事件）
+     */
+    void RequestRouteSwitch();
+    
+    /**
+     * 切换线程主循环
+     */
+    void RouteSwitchLoop();
+    
+    /**
+     * 快速切换：原地恢复 → 先建后拆重建；保留环形缓冲，新路由首段渐入
+     * @return 0 成功，负数失败（回退到 TryRestart）
+     */
+    int SwitchRoute();
+    
+    /**
+     * 先建后拆：用 builder_ 生成并启动新渲染器，再切换 activeRenderer_、释放旧渲染器
+     * 切换后旧渲染器仍可能有一次回调在执行，环形缓冲的单消费者由 OnWriteData 的 consuming_ 保证
+     * 调用方须持有 rendererMutex_
+     * @return 0 成功，负数失败（旧渲染器保持不变）
+     */
+    int RebuildRendererLocked();
+    
+    /**
+     * 等待切换线程结束
+     */
+    void JoinSwitchThread();
+    
+    /**
+     * 查询当前输出设备并更新路由与延迟上限
+     */
+    void DetectRoute();
+    
+    /**
+     * 新路由首个有效回调：记录切换静音时长（OHAudio 回调线程）
+     */
+    void FinishSwitchMeasurement();
+    
+    /**
+     * 路由变化：切到该路由已学到的上限（或初始值），并重新开始观测
+     */
+    void ApplyRouteProfile(AudioRoute route);
+    
+    /**
+     * 记录一次回调的节奏，窗口结束时推导路由上限（OHAudio 回调线程）
+     * @param framesRequested 本次回调请求的采样帧数
+     */
+    void UpdateRouteProfile(int framesRequested);
+    
+    /**
+     * 查询 OHAudio 时间戳得到设备延迟（毫秒），不可用时返回 -1
+     */
+    double QueryDeviceLatencyMs() const;
+    
+    /**
+     * 限频查询设备延迟并更新 EWMA（AudioRecv 线程）
+     */
+    void PollDeviceLatency();
 };
 
 /**
@@ -239,6 +418,26 @@ namespace AudioRendererInstance {
      * 轻量级调用，用于延迟控制决策
      */
     double GetBufferLatencyMs();
+    
+    /**
+     * 获取 OHAudio 内部延迟（毫秒），不可用时返回 -1
+     */
+    double GetDeviceLatencyMs();
+    
+    /**
+     * 获取真实输出延迟（毫秒）：环形缓冲 + OHAudio 设备延迟
+     */
+    double GetOutputLatencyMs();
+    
+    /**
+     * 当前路由的延迟上限（毫秒）
+     */
+    int GetRouteLatencyCapMs();
+    
+    /**
+     * 设置延迟上限的收紧量（毫秒）
+     */
+    void SetLatencyTrimMs(int trimMs);
 }
 
 #endif // AUDIO_RENDERER_H
@@ -0,0 +1,246 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file av_sync_controller.cpp
+ * @brief 音视频同步控制器实现
+ */
+
+#include "av_sync_controller.h"
+#include "audio_renderer.h"
+#include <hilog/log.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+
+#undef LOG_TAG
+#define LOG_TAG "AvSync"
+
+namespace {
+    constexpr int64_t UPDATE_INTERVAL_MS = 100;     // 控制周期
+    constexpr double STEP_MS = 2.0;                 // 每周期最大调整量
+    constexpr double MAX_VIDEO_DELAY_MS = 60.0;     // 视频推迟上限
+    constexpr int MIN_AUDIO_CAP_MS = 10;            // 音频上限的绝对下限
+    constexpr double EMA_ALPHA_AUDIO = 0.2;         // 每个控制周期一次采样
+    constexpr double EMA_ALPHA_VIDEO = 0.05;        // 每帧一次采样
+    constexpr int DEFAULT_WINDOW_MS = 20;
+    constexpr int MIN_WINDOW_MS = 5;
+    constexpr int MAX_WINDOW_MS = 200;
+
+    std::atomic<bool> g_enabled{false};
+    std::atomic<int> g_windowMs{DEFAULT_WINDOW_MS};
+
+    // 测量（EWMA）
+    std::atomic<double> g_audioLatencyMs{0.0};
+    std::atomic<double> g_audioDeviceLatencyMs{0.0};
+    std::atomic<double> g_videoLatencyMs{0.0};
+    std::atomic<bool> g_audioValid{false};
+    std::atomic<bool> g_videoValid{false};
+    std::atomic<bool> g_videoTimedPresent{false};
+
+    // 调整输出（音频上限 = 路由上限 - trim）
+    std::atomic<int> g_audioTrimMs{0};
+    std::atomic<double> g_videoDelayMs{0.0};
+    std::atomic<int64_t> g_videoDelayNs{0};
+
+    // 统计
+    std::atomic<double> g_skewMs{0.0};
+    std::atomic<double> g_maxAbsSkewMs{0.0};
+    std::atomic<uint64_t> g_adjustments{0};
+    std::atomic<uint64_t> g_outOfWindow{0};
+    std::atomic<uint64_t> g_updates{0};
+
+    // 仅 AudioRecv 线程访问
+    int g_audioCapFloorMs = MIN_AUDIO_CAP_MS;
+    int64_t g_lastUpdateMs = 0;
+
+    int64_t NowMs() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    double Ema(double prev, double sample, double alpha, bool valid) {
+        return valid ? (alpha * sample + (1.0 - alpha) * prev) : sample;
+    }
+
+    void ApplyAudioTrim(int trimMs) {
+        g_audioTrimMs.store(trimMs, std::memory_order_relaxed);
+        AudioRendererInstance::SetLatencyTrimMs(trimMs);
+    }
+
+    void ApplyVideoDelay(double delayMs) {
+        g_videoDelayMs.store(delayMs, std::memory_order_relaxed);
+        g_videoDelayNs.store(static_cast<int64_t>(delayMs * 1000000.0), std::memory_order_relaxed);
+    }
+
+    /**
+     * 控制律：每周期最多一个方向移动 STEP_MS，避免音频上限骤降造成连续丢帧
+     */
+    void RunControl(double skew, int windowMs) {
+        int trim = g_audioTrimMs.load(std::memory_order_relaxed);
+        double delay = g_videoDelayMs.load(std::memory_order_relaxed);
+        // 路由上限随设备切换变化（蓝牙更宽），收紧量相对它计算
+        const int maxTrim = std::max(0, AudioRendererInstance::GetRouteLatencyCapMs() - g_audioCapFloorMs);
+        bool changed = false;
+
+        if (!g_enabled.load(std::memory_order_relaxed)) {
+            if (trim != 0) {
+                ApplyAudioTrim(0);
+            }
+            if (delay != 0.0) {
+                ApplyVideoDelay(0.0);
+            }
+            return;
+        }
+
+        if (skew > windowMs) {
+            // 声音偏晚：先丢音频积压，再推迟画面
+            double excess = std::min(skew - windowMs, STEP_MS);
+            if (trim < maxTrim) {
+                ApplyAudioTrim(std::min(maxTrim, trim + static_cast<int>(std::ceil(excess))));
+                changed = true;
+            } else if (g_videoTimedPresent.load(std::memory_order_relaxed) && delay < MAX_VIDEO_DELAY_MS) {
+                ApplyVideoDelay(std::min(MAX_VIDEO_DELAY_MS, delay + excess));
+                changed = true;
+            }
+        } else if (skew < -windowMs) {
+            // 画面偏晚：先撤销画面推迟，再允许音频缓冲回升
+            double deficit = std::min(-windowMs - skew, STEP_MS);
+            if (delay > 0.0) {
+                ApplyVideoDelay(std::max(0.0, delay - deficit));
+                changed = true;
+            } else if (trim > 0) {
+                ApplyAudioTrim(std::max(0, trim - static_cast<int>(std::ceil(deficit))));
+                changed = true;
+            }
+        }
+
+        // VSync 关闭后推迟无效，直接撤销
+        if (!g_videoTimedPresent.load(std::memory_order_relaxed) && delay > 0.0) {
+            ApplyVideoDelay(0.0);
+            changed = true;
+        }
+
+        if (changed) {
+            g_adjustments.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+namespace AvSyncController {
+
+void SetConfig(bool enabled, int windowMs) {
+    windowMs = std::clamp(windowMs, MIN_WINDOW_MS, MAX_WINDOW_MS);
+    g_enabled.store(enabled, std::memory_order_relaxed);
+    g_windowMs.store(windowMs, std::memory_order_relaxed);
+    OH_LOG_INFO(LOG_APP, "AV sync: enabled=%{public}d window=%{public}dms", enabled ? 1 : 0, windowMs);
+}
+
+void Reset(double frameMs) {
+    // 上限至少容纳两个音频包，否则稳态下每个包都会被丢弃
+    g_audioCapFloorMs = std::max(MIN_AUDIO_CAP_MS, static_cast<int>(std::ceil(frameMs * 2.0)));
+    g_lastUpdateMs = 0;
+
+    g_audioValid.store(false, std::memory_order_relaxed);
+    g_videoValid.store(false, std::memory_order_relaxed);
+    g_audioLatencyMs.store(0.0, std::memory_order_relaxed);
+    g_audioDeviceLatencyMs.store(0.0, std::memory_order_relaxed);
+    g_videoLatencyMs.store(0.0, std::memory_order_relaxed);
+
+    ApplyAudioTrim(0);
+    ApplyVideoDelay(0.0);
+
+    g_skewMs.store(0.0, std::memory_order_relaxed);
+    g_maxAbsSkewMs.store(0.0, std::memory_order_relaxed);
+    g_adjustments.store(0, std::memory_order_relaxed);
+    g_outOfWindow.store(0, std::memory_order_relaxed);
+    g_updates.store(0, std::memory_order_relaxed);
+}
+
+void OnAudioFrame() {
+    int64_t now = NowMs();
+    if (now - g_lastUpdateMs < UPDATE_INTERVAL_MS) {
+        return;
+    }
+    g_lastUpdateMs = now;
+
+    // 采样音频输出延迟（设备部分由 AudioRenderer 按时间戳测量并缓存）
+    double deviceMs = AudioRendererInstance::GetDeviceLatencyMs();
+    if (deviceMs < 0.0) {
+        // 渲染器尚未开始输出
+        return;
+    }
+    bool audioValid = g_audioValid.load(std::memory_order_relaxed);
+    double audio = Ema(g_audioLatencyMs.load(std::memory_order_relaxed), AudioRendererInstance::GetOutputLatencyMs(),
+                       EMA_ALPHA_AUDIO, audioValid);
+    g_audioLatencyMs.store(audio, std::memory_order_relaxed);
+    g_audioDeviceLatencyMs.store(Ema(g_audioDeviceLatencyMs.load(std::memory_order_relaxed), deviceMs,
+                                     EMA_ALPHA_AUDIO, audioValid), std::memory_order_relaxed);
+    g_audioValid.store(true, std::memory_order_relaxed);
+
+    if (!g_videoValid.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    // 视频推迟已计入 videoLatency（呈现时间已后移），无需重复补偿
+    double skew = audio - g_videoLatencyMs.load(std::memory_order_relaxed);
+    int windowMs = g_windowMs.load(std::memory_order_relaxed);
+    g_skewMs.store(skew, std::memory_order_relaxed);
+    if (std::fabs(skew) > g_maxAbsSkewMs.load(std::memory_order_relaxed)) {
+        g_maxAbsSkewMs.store(std::fabs(skew), std::memory_order_relaxed);
+    }
+    g_updates.fetch_add(1, std::memory_order_relaxed);
+    if (std::fabs(skew) > windowMs) {
+        g_outOfWindow.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    RunControl(skew, windowMs);
+}
+
+void OnVideoFrame(int64_t enqueueTimeMs, double displayDelayMs, bool timedPresent) {
+    if (enqueueTimeMs <= 0) {
+        return;
+    }
+    double sample = static_cast<double>(NowMs() - enqueueTimeMs) + displayDelayMs;
+    if (sample < 0.0 || sample > 1000.0) {
+        return;
+    }
+    bool valid = g_videoValid.load(std::memory_order_relaxed);
+    g_videoLatencyMs.store(Ema(g_videoLatencyMs.load(std::memory_order_relaxed), sample, EMA_ALPHA_VIDEO, valid),
+                           std::memory_order_relaxed);
+    g_videoTimedPresent.store(timedPresent, std::memory_order_relaxed);
+    if (!valid) {
+        g_videoValid.store(true, std::memory_order_release);
+    }
+}
+
+int64_t GetVideoDelayNs() {
+    return g_videoDelayNs.load(std::memory_order_relaxed);
+}
+
+AvSyncStats GetStats() {
+    AvSyncStats stats;
+    stats.enabled = g_enabled.load(std::memory_order_relaxed);
+    stats.windowMs = g_windowMs.load(std::memory_order_relaxed);
+    stats.audioLatencyMs = g_audioLatencyMs.load(std::memory_order_relaxed);
+    stats.audioDeviceLatencyMs = g_audioDeviceLatencyMs.load(std::memory_order_relaxed);
+    stats.videoLatencyMs = g_videoLatencyMs.load(std::memory_order_relaxed);
+    stats.skewMs = g_skewMs.load(std::memory_order_relaxed);
+    stats.maxAbsSkewMs = g_maxAbsSkewMs.load(std::memory_order_relaxed);
+    stats.audioCapMs = AudioRendererInstance::GetRouteLatencyCapMs() - g_audioTrimMs.load(std::memory_order_relaxed);
+    stats.videoDelayMs = g_videoDelayMs.load(std::memory_order_relaxed);
+    stats.adjustments = g_adjustments.load(std::memory_order_relaxed);
+    stats.outOfWindowUpdates = g_outOfWindow.load(std::memory_order_relaxed);
+    stats.updates = g_updates.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace AvSyncController
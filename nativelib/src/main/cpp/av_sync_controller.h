@@ -0,0 +1,97 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file av_sync_controller.h
+ * @brief 音视频同步控制器
+ *
+ * 音频与视频走两条独立管线，各自的延迟互不知情：
+ *   音频：AudioRecv 解码 → AudioRenderer 环形缓冲 (≤40ms) → OHAudio 内部缓冲 → 扬声器
+ *   视频：VPU 入队 → 解码输出 → RenderOutputBuffer(AtTime) → 合成上屏
+ *
+ * 两端均以「到达本机解码器」为起点测量延迟（EWMA 平滑）：
+ *   audioLatency = 环形缓冲时长 + OHAudio 设备延迟 (GetFramesWritten - GetTimestamp 位置)
+ *   videoLatency = 呈现时刻 - 入队时刻（直接渲染时呈现时刻按下一次 VSync 估算）
+ *   skew = audioLatency - videoLatency    (> 0：声音晚于画面)
+ *
+ * 当 |skew| 超出窗口时逐步微调（每 UPDATE_INTERVAL_MS 最多 STEP_MS）：
+ *   声音偏晚：先收紧 AudioRenderer 的延迟上限（路由上限 - trim，丢弃积压），到下限后在 VSync
+ *             模式下推迟视频呈现时间
+ *   画面偏晚：先撤销视频推迟，再放宽音频延迟上限
+ * 不会主动给音频插入延迟（需要插入静音，会造成断音），画面偏晚且音频上限
+ * 已恢复默认时仅记录 skew。
+ *
+ * 线程模型：OnAudioFrame 在 AudioRecv 线程（同时负责控制计算），
+ * OnVideoFrame 在解码输出线程，配置/统计在 JS 线程；共享状态均为原子变量。
+ */
+
+#ifndef AV_SYNC_CONTROLLER_H
+#define AV_SYNC_CONTROLLER_H
+
+#include <cstdint>
+
+/**
+ * 音视频同步统计
+ */
+struct AvSyncStats {
+    bool enabled;
+    int windowMs;                 // 允许的 |skew| 窗口
+    double audioLatencyMs;        // 音频总延迟 (EWMA)
+    double audioDeviceLatencyMs;  // 其中 OHAudio 设备部分 (EWMA)
+    double videoLatencyMs;        // 视频入队 → 呈现 (EWMA)
+    double skewMs;                // audio - video
+    double maxAbsSkewMs;          // 本次串流 |skew| 最大值
+    int audioCapMs;               // 当前音频延迟上限
+    double videoDelayMs;          // 当前视频呈现推迟
+    uint64_t adjustments;         // 调整次数
+    uint64_t outOfWindowUpdates;  // 超出窗口的控制周期数
+    uint64_t updates;             // 控制周期总数
+};
+
+namespace AvSyncController {
+    /**
+     * 设置同步参数（任意时刻可调用）
+     * @param enabled 关闭时恢复默认音频上限、取消视频推迟，仍继续测量 skew
+     * @param windowMs 允许的 |skew|（毫秒）
+     */
+    void SetConfig(bool enabled, int windowMs);
+
+    /**
+     * 音频流初始化时重置测量与调整状态
+     * @param frameMs 每个音频包时长（决定音频上限的下限）
+     */
+    void Reset(double frameMs);
+
+    /**
+     * 一帧 PCM 已写入 AudioRenderer（AudioRecv 线程）
+     * 内部按 UPDATE_INTERVAL_MS 限频采样音频延迟并运行控制律
+     */
+    void OnAudioFrame();
+
+    /**
+     * 一帧视频已提交呈现（解码输出线程）
+     * @param enqueueTimeMs 入队时刻（steady_clock 毫秒），<=0 时忽略
+     * @param displayDelayMs 提交后到上屏的预计时长
+     * @param timedPresent 是否按呈现时间提交（VSync 模式，视频推迟仅在此时生效）
+     */
+    void OnVideoFrame(int64_t enqueueTimeMs, double displayDelayMs, bool timedPresent);
+
+    /**
+     * 当前视频呈现推迟（纳秒），NativeRender::CalculatePresentTime 叠加使用
+     */
+    int64_t GetVideoDelayNs();
+
+    /**
+     * 获取统计信息
+     */
+    AvSyncStats GetStats();
+}
+
+#endif // AV_SYNC_CONTROLLER_H
@@ -10,7 +10,18 @@
 
 /**
  * @file bass_energy_analyzer.h
- * @brief 低频能量分析器 v3 — 场景识别模式 + 精准低音检测
+ * @brief 低频能量分析器 v4 — 多频段滤波器组 + 场景识别模式
+ *
+ * v4 多频段滤波器组:
+ * - 4 条并行 biquad lane（4×float 向量，逐样本一次处理 4 条 lane，无分支、
+ *   无跨 lane 依赖；GCC/Clang 向量扩展直接生成一条 NEON / SSE 寄存器运算）:
+ *   lane 0 次低音      — 80Hz Butterworth 低通（单声道混合，即 v3 的单频段滤波器）
+ *   lane 1 低音        — 160Hz 带通（单声道混合）
+ *   lane 2/3 中低频瞬态 — 500Hz 带通（左 / 右声道）
+ * - 一次遍历同时得到低频马达、高频马达、左右扳机马达的强度
+ *   → 爆炸/引擎 → 低频马达；拳脚/军鼓 → 高频马达；偏左/偏右的枪声 → 对应扳机
+ * - 综合强度 (intensity) 与 v3 逐位一致（lane 0 沿用 v3 的 Direct Form I 运算顺序），
+ *   供 ArkTS 设备马达使用
  *
  * v3 新增场景模式:
  * - 游戏/电影模式 (sceneMode=0): 原有行为，持续低频能量驱动振动
@@ -22,15 +33,15 @@
  *   → 分析瞬态密度（transient density）判断内容类型
  *   → 高瞬态密度 → 音乐模式，低瞬态密度 → 游戏/电影模式
  *
- * 基础 DSP 管线 (v2 继承):
- * 1. 2 阶 Butterworth 低通滤波器（截止 80Hz，-12dB/oct）
- * 2. 攻击/释放包络跟踪器
- * 3. 自适应噪声门限
+ * 基础 DSP 管线:
+ * 1. 4 路 biquad 滤波器组（lane 0 为 2 阶 Butterworth 低通，截止 80Hz，-12dB/oct）
+ * 2. 攻击/释放包络跟踪器（逐 lane）
+ * 3. 自适应噪声门限（逐 lane）
  * 4. RMS 绝对音量权重
  *
  * 设计原则:
  * - 零堆分配，所有状态内联
- * - 每帧 PCM 解码后在同一线程调用，无锁
+ * - 在音频分析线程（AudioAnalysisWorker）逐帧调用，单线程无锁
  * - 节流控制：游戏模式 ~25次/秒，音乐模式 ~40次/秒
  */
 
@@ -42,7 +53,19 @@
 #include <cstring>
 #include <chrono>
 #include <algorithm>
-#include "aubio_onset_wrapper.h"
+#include <atomic>
+#include "onset_backend.h"
+
+/**
+ * 一帧分析输出（各项 0-100）
+ */
+struct HapticBandIntensity {
+    int intensity;      // 综合强度（场景模式映射结果，ArkTS 设备马达使用）
+    int lowMotor;       // 低频（重）马达
+    int highMotor;      // 高频（轻）马达
+    int leftTrigger;    // 左扳机马达
+    int rightTrigger;   // 右扳机马达
+};
 
 class BassEnergyAnalyzer {
 public:
@@ -51,6 +74,13 @@ public:
     static constexpr int SCENE_MUSIC  = 1;  // 音乐/节奏
     static constexpr int SCENE_AUTO   = 2;  // 自动
 
+    // 滤波器组 lane
+    static constexpr int BAND_SUB      = 0;  // 次低音（80Hz 低通，单声道）
+    static constexpr int BAND_BASS     = 1;  // 低音（160Hz 带通，单声道）
+    static constexpr int BAND_LOWMID_L = 2;  // 中低频瞬态（500Hz 带通，左声道）
+    static constexpr int BAND_LOWMID_R = 3;  // 中低频瞬态（500Hz 带通，右声道）
+    static constexpr int BAND_COUNT    = 4;
+
     /**
      * 初始化分析器
      * @param sampleRate 采样率 (通常 48000)
@@ -60,34 +90,25 @@ public:
         sampleRate_ = sampleRate;
         channelCount_ = channelCount;
 
-        // ---- 2 阶 Butterworth LPF 系数计算 ----
-        // 截止频率 80Hz，Q = 1/√2 (Butterworth 最大平坦)
-        // 参考: Audio EQ Cookbook (Robert Bristow-Johnson)
-        const double fc = 80.0;
-        const double Q = 0.7071;  // 1/√2
-        const double w0 = 2.0 * M_PI * fc / sampleRate;
-        const double sinW0 = std::sin(w0);
-        const double cosW0 = std::cos(w0);
-        const double alpha = sinW0 / (2.0 * Q);
-
-        // LPF 传递函数: H(z) = (b0 + b1*z^-1 + b2*z^-2) / (a0 + a1*z^-1 + a2*z^-2)
-        const double a0 = 1.0 + alpha;
-        bq_b0_ = static_cast<float>((1.0 - cosW0) / 2.0 / a0);
-        bq_b1_ = static_cast<float>((1.0 - cosW0) / a0);
-        bq_b2_ = bq_b0_;
-        bq_a1_ = static_cast<float>(-2.0 * cosW0 / a0);
-        bq_a2_ = static_cast<float>((1.0 - alpha) / a0);
+        // ---- 4 路 biquad 滤波器组系数 ----
+        // lane 0: 截止 80Hz，Q = 1/√2 (Butterworth 最大平坦)，与 v3 单频段一致
+        // lane 1: 160Hz 带通，覆盖 ~90-280Hz 的拳脚/军鼓/引擎泛音
+        // lane 2/3: 500Hz 带通，覆盖 ~250-1000Hz 的枪声/脚步起音
+        // lane 2/3 直接输入 int16 采样，1/32768 归一化并入前馈系数（2 的幂，结果不变）
+        designBiquad(BAND_SUB, false, 80.0, 0.7071, 1.0);
+        designBiquad(BAND_BASS, true, 160.0, 0.9, 1.0);
+        designBiquad(BAND_LOWMID_L, true, 500.0, 0.8, 1.0 / 32768.0);
+        designBiquad(BAND_LOWMID_R, true, 500.0, 0.8, 1.0 / 32768.0);
 
         // ---- 攻击/释放包络系数 ----
-        // attack ~5ms → 爆炸枪声起音锐利
-        // release ~80ms → 衰减平滑自然
-        const double attackMs = 5.0;
-        const double releaseMs = 80.0;
-        attackCoeff_ = static_cast<float>(1.0 - std::exp(-1.0 / (sampleRate * attackMs / 1000.0)));
-        releaseCoeff_ = static_cast<float>(1.0 - std::exp(-1.0 / (sampleRate * releaseMs / 1000.0)));
+        // 低频 lane: attack ~5ms → 爆炸枪声起音锐利；release ~80ms → 衰减平滑自然
+        // 瞬态 lane: attack ~1ms / release ~30ms，保留短促起音
+        setEnvelopeTimes(BAND_SUB, 5.0, 80.0);
+        setEnvelopeTimes(BAND_BASS, 5.0, 80.0);
+        setEnvelopeTimes(BAND_LOWMID_L, 1.0, 30.0);
+        setEnvelopeTimes(BAND_LOWMID_R, 1.0, 30.0);
 
         // ---- 噪声门限 ----
-        noiseFloor_ = 0.0f;
         noiseFloorAlpha_ = static_cast<float>(1.0 - std::exp(-1.0 / (sampleRate * 2.0)));
 
         // ---- 音乐模式: onset 检测 ----
@@ -111,6 +132,10 @@ public:
 
         // onset 冷却帧数: ~150ms
         onsetCooldownFrames_ = std::max(1, static_cast<int>(framesPerSec * 0.15f));
+        onsetSubShare_ = 0.5f;
+
+        // 扳机瞬态背景 (~300ms 追踪)
+        triggerBgAlpha_ = 2.0f / (framesPerSec * 0.3f + 1);
 
         // ---- 自动模式: 瞬态密度 + 周期性追踪 ----
         transientCount_ = 0;
@@ -130,21 +155,23 @@ public:
         pendingAutoModeCount_ = 0;
 
         // 重置滤波器状态
-        bq_x1_ = bq_x2_ = 0.0f;
-        bq_y1_ = bq_y2_ = 0.0f;
-        envelope_ = 0.0f;
+        resetBands();
         rmsEnvelope_ = 0.0f;
-        lastIntensity_ = 0;
+        lastOutput_ = {};
         lastCallbackTime_ = std::chrono::steady_clock::now();
         enabled_ = false;
         sensitivity_ = 1.0f;
         sceneMode_ = SCENE_GAME;
 
-        // ---- aubio onset detector ----
+        // ---- onset detector (后端由 onset_backend.h 编译期选择) ----
         // hop_size = 每帧 per-channel 样本数 (通常 240 @48kHz = 5ms Opus 帧)
         // 使用 specflux 方法：对音乐 onset 检测最佳
         int hopSize = std::max(240, 1);  // Opus 默认每帧 240 samples @48kHz
-        aubioOnset_.Init(sampleRate, hopSize, "specflux");
+        onset_.Init(sampleRate, hopSize, "specflux");
+        onsetHops_.store(0, std::memory_order_relaxed);
+        onsetCount_.store(0, std::memory_order_relaxed);
+        onsetTotalNs_.store(0, std::memory_order_relaxed);
+        onsetMaxNs_.store(0, std::memory_order_relaxed);
     }
 
     /**
@@ -153,11 +180,8 @@ public:
     void SetEnabled(bool enabled) {
         enabled_ = enabled;
         if (!enabled) {
-            bq_x1_ = bq_x2_ = 0.0f;
-            bq_y1_ = bq_y2_ = 0.0f;
-            envelope_ = 0.0f;
+            resetBands();
             rmsEnvelope_ = 0.0f;
-            noiseFloor_ = 0.0f;
             shortWindowEnergy_ = 0.0f;
             longWindowEnergy_ = 0.0f;
             prevFrameEnergy_ = 0.0f;
@@ -172,8 +196,8 @@ public:
             globalFrameCounter_ = 0;
             pendingAutoMode_ = SCENE_GAME;
             pendingAutoModeCount_ = 0;
-            lastIntensity_ = 0;
-            aubioOnset_.Reset();
+            lastOutput_ = {};
+            onset_.Reset();
         }
     }
 
@@ -212,63 +236,74 @@ public:
 
     int GetSceneMode() const { return sceneMode_; }
 
+    /**
+     * 暂停 onset 后端（温控降载，任意线程调用）
+     * 暂停期间音乐模式只用能量比率检测起音，恢复时在分析线程重置后端状态
+     */
+    void SetOnsetSuspended(bool suspended) {
+        onsetSuspended_.store(suspended, std::memory_order_relaxed);
+    }
+
+    /**
+     * onset 后端统计（用于对比各后端的 CPU 开销与触发频率）
+     */
+    struct OnsetStats {
+        const char* backend;    // 编译期选中的后端名 (ONSET_BACKEND_NAME)
+        uint64_t frames;        // 送入后端的帧数
+        uint64_t onsets;        // 检测到的 onset 数
+        double avgUs;           // 单帧平均耗时（微秒）
+        double maxUs;           // 单帧最大耗时（微秒）
+        uint32_t stateBytes;    // 后端内联状态大小（不含 aubio 堆分配）
+    };
+
+    OnsetStats GetOnsetStats() const {
+        OnsetStats stats = {};
+        stats.backend = ONSET_BACKEND_NAME;
+        stats.frames = onsetHops_.load(std::memory_order_relaxed);
+        stats.onsets = onsetCount_.load(std::memory_order_relaxed);
+        uint64_t totalNs = onsetTotalNs_.load(std::memory_order_relaxed);
+        stats.avgUs = (stats.frames > 0) ? (static_cast<double>(totalNs) / stats.frames / 1000.0) : 0.0;
+        stats.maxUs = static_cast<double>(onsetMaxNs_.load(std::memory_order_relaxed)) / 1000.0;
+        stats.stateBytes = static_cast<uint32_t>(sizeof(OnsetBackend));
+        return stats;
+    }
+
     /**
      * 处理一帧 PCM 数据，返回是否应该触发回调
      * @param pcmData PCM 数据 (int16, 交错多声道)
      * @param sampleCount 每声道采样数 (per-channel frame count)
-     * @param outIntensity 输出振动强度 (0-100)
+     * @param out 输出综合强度及各马达 / 扳机强度 (0-100)
      * @return true 如果应该触发 TSFN 回调（经过节流控制）
      */
-    bool ProcessFrame(const int16_t* pcmData, int sampleCount, int& outIntensity) {
+    bool ProcessFrame(const int16_t* pcmData, int sampleCount, HapticBandIntensity& out) {
+        out = {};
         if (!enabled_ || pcmData == nullptr || sampleCount <= 0) {
-            outIntensity = 0;
             return false;
         }
 
         const int frameCount = sampleCount;
 
-        // ---- 共用 DSP 管线: LPF + 包络 + RMS ----
-        float sumSquares = 0.0f;
-        float frameEnergy = 0.0f;     // 本帧低频能量 (LPF 后)
-        float fullBandEnergy = 0.0f;  // 本帧全频段能量 (未滤波，用于音乐模式 onset)
-
-        for (int i = 0; i < frameCount; i++) {
-            float sample = 0.0f;
-            for (int ch = 0; ch < channelCount_; ch++) {
-                sample += static_cast<float>(pcmData[i * channelCount_ + ch]);
-            }
-            sample /= (channelCount_ * 32768.0f);
-            sumSquares += sample * sample;
-
-            // 全频段能量 (含鼓点的中高频瞬态)
-            fullBandEnergy += std::fabs(sample);
-
-            // 2 阶 Biquad LPF
-            float filtered = bq_b0_ * sample + bq_b1_ * bq_x1_ + bq_b2_ * bq_x2_
-                           - bq_a1_ * bq_y1_ - bq_a2_ * bq_y2_;
-            bq_x2_ = bq_x1_;
-            bq_x1_ = sample;
-            bq_y2_ = bq_y1_;
-            bq_y1_ = filtered;
-
-            // 攻击/释放包络跟踪
-            float rectified = std::fabs(filtered);
-            if (rectified > envelope_) {
-                envelope_ += attackCoeff_ * (rectified - envelope_);
-            } else {
-                envelope_ += releaseCoeff_ * (rectified - envelope_);
-            }
-
-            // 累积本帧低频能量
-            frameEnergy += rectified;
+        // ---- 共用 DSP 管线: 滤波器组 + 包络 + RMS ----
+        // 常见声道数按编译期常量展开：混合循环完全展开、缩放方式在编译期确定
+        FilterSums sums;
+        switch (channelCount_) {
+            case 2:  filterFrame<2>(pcmData, frameCount, sums); break;
+            case 6:  filterFrame<6>(pcmData, frameCount, sums); break;
+            default: filterFrame<0>(pcmData, frameCount, sums); break;
         }
-
-        // 帧平均
-        frameEnergy = (frameCount > 0) ? (frameEnergy / frameCount) : 0.0f;
-        fullBandEnergy = (frameCount > 0) ? (fullBandEnergy / frameCount) : 0.0f;
+        const float sumSquares = sums.sumSquares;
+        float fullBandEnergy = sums.fullBandEnergy;  // 本帧全频段能量 (未滤波，用于音乐模式 onset)
+        const BandVec bandSum = sums.bandSum;
+
+        // 帧平均（除法而非乘倒数，保持与 v3 逐位一致）
+        alignas(16) float bandEnergy[BAND_COUNT];
+        for (int k = 0; k < BAND_COUNT; k++) {
+            bandEnergy[k] = bandSum[k] / frameCount;
+        }
+        fullBandEnergy /= frameCount;
 
         // RMS 计算
-        float rms = (frameCount > 0) ? std::sqrt(sumSquares / frameCount) : 0.0f;
+        float rms = std::sqrt(sumSquares / frameCount);
         if (rms > rmsEnvelope_) {
             rmsEnvelope_ += 0.3f * (rms - rmsEnvelope_);
         } else {
@@ -288,11 +323,13 @@ public:
             volumeWeight = t * t * (3.0f - 2.0f * t);
         }
 
-        // 噪声门限
-        if (envelope_ < noiseFloor_ || noiseFloor_ < 1e-8f) {
-            noiseFloor_ = envelope_;
-        } else {
-            noiseFloor_ += noiseFloorAlpha_ * (envelope_ - noiseFloor_);
+        // 噪声门限（逐 lane）
+        for (int k = 0; k < BAND_COUNT; k++) {
+            if (env_[k] < noiseFloor_[k] || noiseFloor_[k] < 1e-8f) {
+                noiseFloor_[k] = env_[k];
+            } else {
+                noiseFloor_[k] += noiseFloorAlpha_ * (env_[k] - noiseFloor_[k]);
+            }
         }
 
         // ---- 确定当前实际使用的模式 ----
@@ -301,23 +338,35 @@ public:
             activeMode = autoDetectMode(fullBandEnergy, frameCount);
         }
 
-        // ---- aubio onset 检测 (音乐模式/自动模式时运行) ----
+        // ---- onset 检测 (音乐模式/自动模式时运行) ----
         bool aubioOnsetDetected = false;
-        if (activeMode == SCENE_MUSIC && aubioOnset_.IsInitialized()) {
-            aubioOnset_.ProcessFrame(pcmData, sampleCount, channelCount_, aubioOnsetDetected);
+        bool onsetSuspended = onsetSuspended_.load(std::memory_order_relaxed);
+        if (onsetWasSuspended_ && !onsetSuspended) {
+            onset_.Reset();
+        }
+        onsetWasSuspended_ = onsetSuspended;
+        if (activeMode == SCENE_MUSIC && onset_.IsInitialized() && !onsetSuspended) {
+            auto t0 = std::chrono::steady_clock::now();
+            onset_.ProcessFrame(pcmData, sampleCount, channelCount_, aubioOnsetDetected);
+            auto t1 = std::chrono::steady_clock::now();
+            recordOnsetTiming(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()), aubioOnsetDetected);
         }
 
         // ---- 分模式处理 ----
-        int intensity;
         if (activeMode == SCENE_MUSIC) {
             // 音乐模式: aubio onset + 我们的能量分析计算强度
-            intensity = processMusicMode(fullBandEnergy, frameEnergy, volumeWeight,
-                                         aubioOnsetDetected);
+            out.intensity = processMusicMode(fullBandEnergy, bandEnergy, volumeWeight,
+                                             aubioOnsetDetected);
+            // 脉冲按起音时的频段能量分配: 底鼓 → 低频马达，军鼓/拍手 → 高频马达
+            out.lowMotor = static_cast<int>(out.intensity * (0.25f + 0.75f * onsetSubShare_));
+            out.highMotor = static_cast<int>(out.intensity * (1.0f - 0.75f * onsetSubShare_));
         } else {
-            intensity = processGameMode(volumeWeight);
+            out.intensity = processGameMode(BAND_SUB, volumeWeight);
+            out.lowMotor = out.intensity;
+            out.highMotor = processGameMode(BAND_BASS, volumeWeight);
         }
-
-        outIntensity = intensity;
+        processTriggers(bandEnergy, volumeWeight, out);
 
         // ---- 节流控制 ----
         auto now = std::chrono::steady_clock::now();
@@ -329,27 +378,89 @@ public:
             return false;
         }
 
-        int delta = std::abs(intensity - lastIntensity_);
-        bool shouldCallback = (lastIntensity_ > 0 && intensity == 0)
-                           || (intensity > 0 && lastIntensity_ == 0)
-                           || (delta >= 5);
+        bool shouldCallback = outputChanged(out.intensity, lastOutput_.intensity)
+                           || outputChanged(out.lowMotor, lastOutput_.lowMotor)
+                           || outputChanged(out.highMotor, lastOutput_.highMotor)
+                           || outputChanged(out.leftTrigger, lastOutput_.leftTrigger)
+                           || outputChanged(out.rightTrigger, lastOutput_.rightTrigger);
 
         if (!shouldCallback) {
             return false;
         }
 
-        lastIntensity_ = intensity;
+        lastOutput_ = out;
         lastCallbackTime_ = now;
         return true;
     }
 
-    int GetCurrentIntensity() const { return lastIntensity_; }
+    int GetCurrentIntensity() const { return lastOutput_.intensity; }
 
 private:
+    /**
+     * RBJ biquad 系数 (Audio EQ Cookbook)，按 a0 归一化
+     * @param bandPass false = 低通，true = 带通（峰值增益 0dB）
+     * @param inputGain 并入前馈系数 b0/b1/b2 的输入增益
+     */
+    void designBiquad(int lane, bool bandPass, double fc, double Q, double inputGain) {
+        const double w0 = 2.0 * M_PI * fc / sampleRate_;
+        const double sinW0 = std::sin(w0);
+        const double cosW0 = std::cos(w0);
+        const double alpha = sinW0 / (2.0 * Q);
+        const double a0 = 1.0 + alpha;
+        if (bandPass) {
+            b0_[lane] = static_cast<float>(alpha / a0 * inputGain);
+            b1_[lane] = 0.0f;
+            b2_[lane] = static_cast<float>(-alpha / a0 * inputGain);
+        } else {
+            b0_[lane] = static_cast<float>((1.0 - cosW0) / 2.0 / a0 * inputGain);
+            b1_[lane] = static_cast<float>((1.0 - cosW0) / a0 * inputGain);
+            b2_[lane] = b0_[lane];
+        }
+        a1_[lane] = static_cast<float>(-2.0 * cosW0 / a0);
+        a2_[lane] = static_cast<float>((1.0 - alpha) / a0);
+    }
+
+    void setEnvelopeTimes(int lane, double attackMs, double releaseMs) {
+        attackCoeff_[lane] = static_cast<float>(1.0 - std::exp(-1.0 / (sampleRate_ * attackMs / 1000.0)));
+        releaseCoeff_[lane] = static_cast<float>(1.0 - std::exp(-1.0 / (sampleRate_ * releaseMs / 1000.0)));
+    }
+
+    void resetBands() {
+        for (int k = 0; k < BAND_COUNT; k++) {
+            x1_[k] = x2_[k] = y1_[k] = y2_[k] = 0.0f;
+            env_[k] = 0.0f;
+            noiseFloor_[k] = 0.0f;
+        }
+        for (int t = 0; t < 2; t++) {
+            triggerBackground_[t] = 0.0f;
+            triggerLevel_[t] = 0.0f;
+        }
+    }
+
+    // 与 v3 单值节流规则一致：起停必报，其余变化 ≥5 才报
+    static bool outputChanged(int value, int last) {
+        return (last > 0 && value == 0) || (value > 0 && last == 0) || (std::abs(value - last) >= 5);
+    }
+
+    void recordOnsetTiming(uint64_t ns, bool detected) {
+        onsetHops_.fetch_add(1, std::memory_order_relaxed);
+        onsetTotalNs_.fetch_add(ns, std::memory_order_relaxed);
+        if (detected) {
+            onsetCount_.fetch_add(1, std::memory_order_relaxed);
+        }
+        // 仅分析线程写入，无需 CAS
+        if (ns > onsetMaxNs_.load(std::memory_order_relaxed)) {
+            onsetMaxNs_.store(ns, std::memory_order_relaxed);
+        }
+    }
+
     // ==================== 游戏/电影模式处理 ====================
-    int processGameMode(float volumeWeight) {
-        float threshold = noiseFloor_ * 8.0f + 0.005f;
-        float effectiveEnergy = std::max(0.0f, envelope_ - threshold);
+    int processGameMode(int lane, float volumeWeight) {
+        float threshold = noiseFloor_[lane] * 8.0f + 0.005f;
+        float effectiveEnergy = std::max(0.0f, env_[lane] - threshold);
+        if (effectiveEnergy <= 0.0f) {
+            return 0;   // 低于门限（多数帧）：pow(0, 2.5) = 0，省掉一次 pow
+        }
 
         float normalized = effectiveEnergy * sensitivity_ * 10.0f;
         normalized = std::min(normalized, 1.0f);
@@ -374,8 +485,9 @@ private:
      * - 学术级 peak-picking 算法
      * - 能检测所有乐器的 onset，不仅限于鼓
      */
-    int processMusicMode(float fullBandEnergy, float lowFreqEnergy, float volumeWeight,
+    int processMusicMode(float fullBandEnergy, const float* bandEnergy, float volumeWeight,
                          bool aubioOnsetDetected) {
+        const float lowFreqEnergy = bandEnergy[BAND_SUB];
         // ---- 更新窗口 (用于强度计算 + 备用检测) ----
         shortWindowEnergy_ += shortWindowAlpha_ * (fullBandEnergy - shortWindowEnergy_);
         longWindowEnergy_  += longWindowAlpha_  * (fullBandEnergy - longWindowEnergy_);
@@ -430,6 +542,10 @@ private:
             );
             onsetPulseIntensity_ = std::max(15, std::min(100, onsetPulseIntensity_));
 
+            // 马达分配比例: 次低音占 (次低音 + 低音) 的份额
+            float lowSum = bandEnergy[BAND_SUB] + bandEnergy[BAND_BASS];
+            onsetSubShare_ = (lowSum > 1e-6f) ? (bandEnergy[BAND_SUB] / lowSum) : 0.5f;
+
             // 衰减步数: 5 步 ≈ 125ms
             onsetPulseDecay_ = 5;
 
@@ -449,6 +565,30 @@ private:
         return 0;
     }
 
+    // ==================== 扳机: 左右声道中低频瞬态 ====================
+    /**
+     * 本帧中低频能量超过 ~300ms 背景 2 倍且包络高于噪声门限时触发，
+     * 输出按 TRIGGER_DECAY 逐帧衰减（~60ms），两种场景模式共用
+     */
+    void processTriggers(const float* bandEnergy, float volumeWeight, HapticBandIntensity& out) {
+        int level[2];
+        for (int t = 0; t < 2; t++) {
+            const int lane = BAND_LOWMID_L + t;
+            float background = triggerBackground_[t];
+            float ratio = (background > 1e-6f) ? (bandEnergy[lane] / background) : 0.0f;
+            triggerBackground_[t] += triggerBgAlpha_ * (bandEnergy[lane] - background);
+
+            float strength = std::min((ratio - 2.0f) / 4.0f, 1.0f);
+            if (strength > 0.0f && env_[lane] > noiseFloor_[lane] * 4.0f + 0.002f) {
+                triggerLevel_[t] = std::max(triggerLevel_[t], strength * sensitivity_ * volumeWeight);
+            }
+            level[t] = std::max(0, std::min(100, static_cast<int>(triggerLevel_[t] * 100.0f)));
+            triggerLevel_[t] *= TRIGGER_DECAY;
+        }
+        out.leftTrigger = level[0];
+        out.rightTrigger = level[1];
+    }
+
     // ==================== 自动模式: 场景检测 ====================
     /**
      * 瞬态密度 + 周期性分析 + 滞后保护:
@@ -561,26 +701,135 @@ private:
     float sensitivity_ = 1.0f;
     int sceneMode_ = SCENE_GAME;
 
-    // 2 阶 Biquad LPF 系数
-    float bq_b0_ = 0.0f, bq_b1_ = 0.0f, bq_b2_ = 0.0f;
-    float bq_a1_ = 0.0f, bq_a2_ = 0.0f;
+    // ---- 滤波器组 (每个系数/状态是一个 4×float 向量，按 lane 下标访问) ----
+    // GCC/Clang 向量扩展: 逐元素运算直接映射到 NEON / SSE，比较结果为逐 lane 全 1 / 全 0 掩码
+    typedef float BandVec __attribute__((vector_size(16)));
+    typedef int32_t BandMask __attribute__((vector_size(16)));
+    static_assert(sizeof(BandVec) == BAND_COUNT * sizeof(float), "one lane per band");
+
+    // 逐样本循环的帧内累加结果
+    struct FilterSums {
+        float sumSquares = 0.0f;
+        float fullBandEnergy = 0.0f;
+        BandVec bandSum = {};
+    };
+
+    /**
+     * 滤波器组逐样本循环：单声道混合 → 4 lane Biquad → 整流 → 攻击/释放包络
+     * @tparam kChannels 编译期声道数，0 = 运行时取 channelCount_
+     */
+    template <int kChannels>
+    void filterFrame(const int16_t* pcmData, int frameCount, FilterSums& sums) {
+        const int channels = (kChannels > 0) ? kChannels : channelCount_;
+        // 单声道时两条瞬态 lane 读同一声道
+        const int rightChannel = (channels > 1) ? 1 : 0;
+        // 单声道混合沿用 v3 的除法；声道数为 2 的幂时乘倒数结果完全相同，省掉逐样本除法。
+        // lane 2/3 乘 / 除 1.0f 不改变取值（其 1/32768 缩放已并入前馈系数）
+        const float monoDivisor = channels * 32768.0f;
+        const bool monoScaleExact = (channels & (channels - 1)) == 0;
+        const BandVec inputScale = {1.0f / monoDivisor, 1.0f / monoDivisor, 1.0f, 1.0f};
+        const BandVec inputDivisor = {monoDivisor, monoDivisor, 1.0f, 1.0f};
+        // 立体声：左右声道放在 int32 的高 16 位（即 ×2^16）再转换，缩放同样是 2 的幂，结果不变
+        const BandVec stereoScale = {0x1p-32f, 0x1p-32f, 0x1p-16f, 0x1p-16f};
+
+        float sumSquares = 0.0f;
+        float fullBandEnergy = 0.0f;
+        BandVec bandSum = {};
+        // 状态拷到局部变量，逐样本循环内保持在寄存器中
+        BandVec x1 = x1_, x2 = x2_, y1 = y1_, y2 = y2_, env = env_;
+        const BandVec b0 = b0_, b1 = b1_, b2 = b2_, a1 = a1_, a2 = a2_;
+        const BandVec release = releaseCoeff_;
+        const BandMask attackXor = (BandMask)attackCoeff_ ^ (BandMask)releaseCoeff_;
+        const BandMask absMask = BandMask{} + 0x7fffffff;
+
+        for (int i = 0; i < frameCount; i++) {
+            const int16_t* frame = pcmData + i * channels;
+            // 4 条 lane 的输入一次整数 → float 转换、一次缩放；lane 0 与 v3 的单声道样本逐位相同
+            BandVec x;
+            if constexpr (kChannels == 2) {
+                // 一次 32 位读入左右声道，与零交错成 {L·2^16, R·2^16, 0, 0}；
+                // 混合在 float 中求和（两个 17 位整数之和，无舍入），省掉逐声道标量读与插入
+                typedef int16_t PcmVec __attribute__((vector_size(16)));
+                int32_t pair;
+                memcpy(&pair, frame, sizeof(pair));
+                const PcmVec pcm = (PcmVec)BandMask{pair, 0, 0, 0};
+                const BandVec lr = __builtin_convertvector(
+                    (BandMask)__builtin_shufflevector(PcmVec{}, pcm, 0, 8, 1, 9, 2, 10, 3, 11), BandVec);
+                x = (__builtin_shufflevector(lr, lr, 0, 1, 0, 1)
+                     + __builtin_shufflevector(lr, lr, 1, 0, 2, 2)) * stereoScale;
+            } else {
+                // 整数求和再转换：部分和都小于 2^24，与逐声道 float 累加逐位相同
+                int mix = 0;
+                for (int ch = 0; ch < channels; ch++) {
+                    mix += frame[ch];
+                }
+                const BandMask xi = {mix, mix, frame[0], frame[rightChannel]};
+                const BandVec xf = __builtin_convertvector(xi, BandVec);
+                x = monoScaleExact ? xf * inputScale : xf / inputDivisor;
+            }
+            const float sample = x[0];
+            sumSquares += sample * sample;
+
+            // 全频段能量 (含鼓点的中高频瞬态)；与整流共用 absMask，少占一个常量寄存器
+            fullBandEnergy += ((BandVec)((BandMask)x & absMask))[0];
+
+            // 4 条 lane 同构: Biquad (Direct Form I) → 整流 → 攻击/释放包络
+            // 运算顺序与 v3 单频段滤波器相同，lane 0 的输出与 v3 逐位一致
+            BandVec y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            BandVec rectified = (BandVec)((BandMask)y & absMask);
+            // 逐 lane 按方向选择系数（与 v3 的分支相同）。rectified 与 env 都是非负有限值，
+            // 按位模式做整数比较与浮点比较结果相同：整数比较 1 个周期、与减法并行，
+            // env 的递推链仍是 减 → 乘 → 加，与 v3 标量路径等长（vector max 写法多一级比较）。
+            // 选择写成 release ^ (mask & (attack ^ release))：两条按位指令，不需要 attack 常量寄存器
+            const BandMask rising = (BandMask)rectified > (BandMask)env;
+            BandVec coeff = (BandVec)((BandMask)release ^ (rising & attackXor));
+            env += coeff * (rectified - env);
+            bandSum += rectified;
+        }
+        x1_ = x1;
+        x2_ = x2;
+        y1_ = y1;
+        y2_ = y2;
+        env_ = env;
+        sums.sumSquares = sumSquares;
+        sums.fullBandEnergy = fullBandEnergy;
+        sums.bandSum = bandSum;
+    }
+
+    BandVec b0_ = {};
+    BandVec b1_ = {};
+    BandVec b2_ = {};
+    BandVec a1_ = {};
+    BandVec a2_ = {};
 
     // Biquad 状态 (Direct Form I)
-    float bq_x1_ = 0.0f, bq_x2_ = 0.0f;
-    float bq_y1_ = 0.0f, bq_y2_ = 0.0f;
+    BandVec x1_ = {};
+    BandVec x2_ = {};
+    BandVec y1_ = {};
+    BandVec y2_ = {};
 
     // 攻击/释放包络
-    float attackCoeff_ = 0.0f;
-    float releaseCoeff_ = 0.0f;
-    float envelope_ = 0.0f;
+    BandVec attackCoeff_ = {};
+    BandVec releaseCoeff_ = {};
+    BandVec env_ = {};
 
     // RMS 包络
     float rmsEnvelope_ = 0.0f;
 
-    // 噪声门限
-    float noiseFloor_ = 0.0f;
+    // 噪声门限（逐 lane）
+    float noiseFloor_[BAND_COUNT] = {};
     float noiseFloorAlpha_ = 0.0f;
 
+    // ---- 扳机: 中低频瞬态 (0 = 左, 1 = 右) ----
+    static constexpr float TRIGGER_DECAY = 0.92f;  // 每帧 (~5ms) 衰减，~60ms 降到 1/3
+    float triggerBackground_[2] = {};  // 中低频背景能量 (~300ms EMA)
+    float triggerLevel_[2] = {};       // 当前扳机强度 (0-1)
+    float triggerBgAlpha_ = 0.0f;
+
     // ---- 音乐模式: Onset 检测 (双窗口 + 自适应阈值) ----
     float shortWindowAlpha_ = 0.0f;  // 短窗口 EMA 系数 (~80ms)
     float shortWindowEnergy_ = 0.0f; // 短窗口平均能量（瞬时水平）
@@ -593,6 +842,7 @@ private:
     int onsetCooldownFrames_ = 0;    // 冷却帧数 (~150ms)
     int onsetPulseIntensity_ = 0;    // 当前脉冲强度
     int onsetPulseDecay_ = 0;        // 脉冲衰减计数器
+    float onsetSubShare_ = 0.5f;     // 脉冲分配给低频马达的份额
 
     // ---- 自动模式: 瞬态密度 + 周期性分析 ----
     int transientCount_ = 0;         // 当前窗口内瞬态数
@@ -612,11 +862,19 @@ private:
     int pendingAutoModeCount_ = 0;
 
     // 节流
-    int lastIntensity_ = 0;
+    HapticBandIntensity lastOutput_ = {};
     std::chrono::steady_clock::time_point lastCallbackTime_;
 
-    // ---- aubio onset detector ----
-    AubioOnsetWrapper aubioOnset_;
+    // ---- onset detector ----
+    OnsetBackend onset_;
+    std::atomic<bool> onsetSuspended_{false};  // 温控降载（任意线程写）
+    bool onsetWasSuspended_ = false;           // 仅分析线程访问
+
+    // onset 后端耗时统计（分析线程写，JS 线程读）
+    std::atomic<uint64_t> onsetHops_{0};
+    std::atomic<uint64_t> onsetCount_{0};
+    std::atomic<uint64_t> onsetTotalNs_{0};
+    std::atomic<uint64_t> onsetMaxNs_{0};
 };
 
 #endif // BASS_ENERGY_ANALYZER_H
@@ -21,6 +21,15 @@
 #include "video_decoder.h"
 #include "audio_renderer.h"
 #include "bass_energy_analyzer.h"
+#include "audio_analysis_worker.h"
+#include "haptics_router.h"
+#include "controller_input_router.h"
+#include "input_scheduler.h"
+#include "device_motion.h"
+#include "touch_gesture.h"
+#include "av_sync_controller.h"
+#include "thermal_governor.h"
+#include "latency_histogram.h"
 #include <hilog/log.h>
 #include <cstring>
 #include <cstdarg>
@@ -30,6 +39,8 @@
 #include <unistd.h>
 #include <fstream>
 #include <vector>
+#include <atomic>
+#include <chrono>
 
 extern "C" {
 #include "moonlight-common-c/src/Limelight.h"
@@ -56,6 +67,37 @@ static short* g_decodedAudioBuffer = nullptr;
 // 低频能量分析器（extern 供 moonlight_bridge.cpp 访问）
 BassEnergyAnalyzer g_bassAnalyzer;
 
+// 音频分析线程：分析器在此线程运行，AudioRecv 线程只做解码 + 投递
+static AudioAnalysisWorker g_audioAnalysisWorker;
+
+// AudioRecv 单包耗时统计
+static std::atomic<uint64_t> g_audioRecvPackets{0};
+static std::atomic<uint64_t> g_audioRecvTotalNs{0};
+static std::atomic<uint64_t> g_audioRecvMaxNs{0};
+static std::atomic<uint64_t> g_audioDecodeTotalNs{0};
+
+// AudioRecv 各阶段耗时分布（微秒）：整包、正常解码、丢包补偿解码 (PLC/FEC)、写入渲染 + 分析投递
+// 丢包补偿比正常解码贵一个数量级，单独统计才能看清尾延迟来源
+static constexpr uint32_t kAudioStageBucketUs = 10;    // 10µs × 1000 桶 = 10ms
+static constexpr uint32_t kAudioPlayBucketUs = 1;      // 1µs × 500 桶
+static LatencyHistogram<1000> g_audioPacketHist;
+static LatencyHistogram<1000> g_audioDecodeHist;
+static LatencyHistogram<1000> g_audioConcealHist;
+static LatencyHistogram<500> g_audioPlayHist;
+
+static inline uint32_t ElapsedUs(std::chrono::steady_clock::time_point start,
+                                 std::chrono::steady_clock::time_point end) {
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+}
+
+// FEC 前瞻：丢失帧推迟到下一个包到达后用其带内 FEC 重建（仅 AudioRecv 线程访问）
+// 同一时刻最多推迟一帧，连续丢包时较早的帧立即 PLC，附加延迟不超过一帧
+static bool g_audioLossPending = false;
+static std::atomic<uint64_t> g_audioFramesLost{0};
+// 温控降载：AudioRecv 线程解除大核绑定（ThermalGovernor 写，AudioRecv 线程读）
+static std::atomic<bool> g_audioBigCoreRelease{false};
+static std::atomic<uint64_t> g_audioLookaheadHolds{0};
+
 // =============================================================================
 // 辅助函数
 // =============================================================================
@@ -205,14 +247,15 @@ static void CallJs_SetHdrMode(napi_env env, napi_value js_callback, void* contex
 static void CallJs_SetMotionEventState(napi_env env, napi_value js_callback, void* context, void* data) {
     CallbackData* cbData = (CallbackData*)data;
     if (env != nullptr && js_callback != nullptr) {
-        napi_value argv[3];
+        napi_value argv[4];
         napi_create_int32(env, cbData->intParams[0], &argv[0]); // controllerNumber
         napi_create_int32(env, cbData->intParams[1], &argv[1]); // motionType
         napi_create_int32(env, cbData->intParams[2], &argv[2]); // reportRateHz
+        napi_get_boolean(env, cbData->intParams[3] != 0, &argv[3]); // 已由 native DeviceMotion 处理
         
         napi_value undefined;
         napi_get_undefined(env, &undefined);
-        napi_call_function(env, undefined, js_callback, 3, argv, nullptr);
+        napi_call_function(env, undefined, js_callback, 4, argv, nullptr);
     }
     delete cbData;
 }
@@ -358,6 +401,22 @@ static void CallJs_BassEnergy(napi_env env, napi_value js_callback, void* contex
     delete cbData;
 }
 
+/**
+ * 分析线程强度回调 → HapticsRouter (已绑定手柄直接输出) → ArkTS (设备振动 / 未绑定手柄)
+ */
+static void PostBassEnergy(const HapticBandIntensity& bands, uint64_t frameNs) {
+    if (!HapticsRouter_OnAudioIntensity(bands.lowMotor, bands.highMotor,
+                                        bands.leftTrigger, bands.rightTrigger, frameNs)) {
+        return;
+    }
+    if (g_audioCallbacks.tsfn_bassEnergy) {
+        CallbackData* data = new CallbackData();
+        data->intParams[0] = bands.intensity;
+        napi_status st = napi_call_threadsafe_function(g_audioCallbacks.tsfn_bassEnergy, data, napi_tsfn_nonblocking);
+        if (st != napi_ok) delete data;
+    }
+}
+
 // =============================================================================
 // 回调初始化
 // =============================================================================
@@ -449,6 +508,12 @@ void Callbacks_Init(napi_env env, napi_value callbacks) {
 void Callbacks_Cleanup(void) {
     std::lock_guard<std::mutex> lock(g_mutex);
     
+    // 先停止分析线程，避免其继续调用即将释放的 tsfn
+    g_audioAnalysisWorker.Stop();
+    
+    // 会话结束：停止 native 路由的手柄马达
+    HapticsRouter_StopAll();
+    
     // 释放线程安全函数
     if (g_videoCallbacks.tsfn_setup) napi_release_threadsafe_function(g_videoCallbacks.tsfn_setup, napi_tsfn_release);
     if (g_videoCallbacks.tsfn_start) napi_release_threadsafe_function(g_videoCallbacks.tsfn_start, napi_tsfn_release);
@@ -550,6 +615,9 @@ void BridgeDrStart(void) {
         OH_LOG_INFO(LOG_APP, "BridgeDrStart: video decoder started successfully");
     }
     
+    // 温控调度器随视频流启动（未启用时为空操作）
+    ThermalGovernor::Start(g_videoFps);
+    
     if (g_videoCallbacks.tsfn_start) {
         napi_call_threadsafe_function(g_videoCallbacks.tsfn_start, nullptr, napi_tsfn_blocking);
     }
@@ -560,6 +628,9 @@ void BridgeDrStart(void) {
 void BridgeDrStop(void) {
     OH_LOG_INFO(LOG_APP, "BridgeDrStop");
     
+    // 先停温控调度器并恢复全部降载措施
+    ThermalGovernor::Stop();
+    
     // 停止视频解码器
     VideoDecoderInstance::Stop();
     
@@ -662,12 +733,31 @@ int BridgeArInit(int audioConfiguration, void* opusConfigPtr, void* context, int
         OH_LOG_ERROR(LOG_APP, "Failed to init audio renderer: %{public}d", err);
         // 继续执行，让 ArkTS 层处理音频
     }
+    AvSyncController::Reset(opusConfig->sampleRate > 0
+        ? opusConfig->samplesPerFrame * 1000.0 / opusConfig->sampleRate : 5.0);
     
     // 初始化低频能量分析器
     g_bassAnalyzer.Init(opusConfig->sampleRate, opusConfig->channelCount);
     OH_LOG_INFO(LOG_APP, "Bass energy analyzer initialized: rate=%{public}d, ch=%{public}d",
                 opusConfig->sampleRate, opusConfig->channelCount);
     
+    // 启动分析线程（失败时回退到 AudioRecv 线程内联分析）
+    g_audioRecvPackets.store(0, std::memory_order_relaxed);
+    g_audioRecvTotalNs.store(0, std::memory_order_relaxed);
+    g_audioRecvMaxNs.store(0, std::memory_order_relaxed);
+    g_audioDecodeTotalNs.store(0, std::memory_order_relaxed);
+    g_audioPacketHist.Reset();
+    g_audioDecodeHist.Reset();
+    g_audioConcealHist.Reset();
+    g_audioPlayHist.Reset();
+    g_audioLossPending = false;
+    g_audioFramesLost.store(0, std::memory_order_relaxed);
+    g_audioLookaheadHolds.store(0, std::memory_order_relaxed);
+    if (g_audioAnalysisWorker.Start(&g_bassAnalyzer, opusConfig->channelCount,
+                                    opusConfig->samplesPerFrame, PostBassEnergy) != 0) {
+        OH_LOG_WARN(LOG_APP, "Audio analysis worker unavailable, analyzing inline on AudioRecv");
+    }
+    
     if (g_audioCallbacks.tsfn_init) {
         CallbackData* data = new CallbackData();
         data->intParams[0] = audioConfiguration;
@@ -704,6 +794,12 @@ void BridgeArStop(void) {
 void BridgeArCleanup(void) {
     OH_LOG_INFO(LOG_APP, "BridgeArCleanup");
     
+    // 停止分析线程
+    g_audioAnalysisWorker.Stop();
+    
+    // 撤掉音频振动分量，避免马达停在最后一次强度
+    HapticsRouter_OnAudioIntensity(0, 0, 0, 0, 0);
+    
     // 清理音频播放器
     AudioRendererInstance::Cleanup();
     
@@ -720,10 +816,75 @@ void BridgeArCleanup(void) {
     }
 }
 
+/**
+ * 写入解码后的 PCM 并投递低频分析（AudioRecv 线程）
+ */
+static void PlayDecodedFrame(int decodeLen, std::chrono::steady_clock::time_point decodeEnd) {
+    if (decodeLen <= 0) {
+        return;
+    }
+    
+    auto playStart = std::chrono::steady_clock::now();
+    
+    // 始终写入解码后的音频，不在解码层丢帧
+    // 延迟控制由环形缓冲区内部处理：满时丢弃旧数据、写入新数据
+    // 这样波形始终连续，避免丢帧导致的电流滋啦声
+    AudioRendererInstance::PlaySamples(g_decodedAudioBuffer, decodeLen);
+    AvSyncController::OnAudioFrame();
+    
+    // 低频能量分析（音频振动）：投递到分析线程，不在接收线程做 FFT
+    if (g_bassAnalyzer.IsEnabled()) {
+        if (g_audioAnalysisWorker.IsRunning()) {
+            g_audioAnalysisWorker.Publish(g_decodedAudioBuffer, decodeLen);
+        } else {
+            HapticBandIntensity bands;
+            if (g_bassAnalyzer.ProcessFrame(g_decodedAudioBuffer, decodeLen, bands)) {
+                PostBassEnergy(bands, static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        decodeEnd.time_since_epoch()).count()));
+            }
+        }
+    }
+    
+    g_audioPlayHist.Record(ElapsedUs(playStart, std::chrono::steady_clock::now()), kAudioPlayBucketUs);
+}
+
+/**
+ * 丢包补偿解码（PLC 或下一包 FEC），单独计时
+ */
+static int DecodeConcealed(const unsigned char* nextData, int nextLength) {
+    auto start = std::chrono::steady_clock::now();
+    int len = -1;
+    if (nextData != nullptr) {
+        // 用当前包的 LBRR 重建上一帧（无 LBRR 时 libopus 内部退化为 PLC）
+        len = MoonlightOpusDecoder::DecodeFec(nextData, nextLength,
+                                              g_decodedAudioBuffer, g_opusConfig.samplesPerFrame);
+    }
+    if (len <= 0) {
+        len = MoonlightOpusDecoder::Decode(nullptr, 0, g_decodedAudioBuffer, g_opusConfig.samplesPerFrame);
+    }
+    g_audioConcealHist.Record(ElapsedUs(start, std::chrono::steady_clock::now()), kAudioStageBucketUs);
+    return len;
+}
+
+/**
+ * 丢失帧能否推迟一帧：渲染缓冲中至少还有一帧音频，推迟不会造成 underrun
+ */
+static bool CanHoldLostFrame() {
+    if (!MoonlightOpusDecoder::IsFecLookaheadEnabled() || g_opusConfig.sampleRate <= 0) {
+        return false;
+    }
+    double frameMs = g_opusConfig.samplesPerFrame * 1000.0 / g_opusConfig.sampleRate;
+    return AudioRendererInstance::GetBufferLatencyMs() >= frameMs;
+}
+
 void BridgeArDecodeAndPlaySample(char* sampleData, int sampleLength) {
     // DIRECT_SUBMIT 模式下，此函数运行在 AudioRecv 线程
     // 设置 QoS 和大核绑定以降低调度延迟（thread_local 确保每线程只执行一次）
     static thread_local bool audioThreadSetup = false;
+    static thread_local bool audioBigCorePinned = false;
+    static thread_local bool audioBigCoreReleased = false;
+    static thread_local cpu_set_t audioBigCoreSet;
     if (!audioThreadSetup) {
         audioThreadSetup = true;
         
@@ -772,6 +933,8 @@ void BridgeArDecodeAndPlaySample(char* sampleData, int sampleLength) {
                 if (bigCount > 0 && bigCount < numCpus) {
                     int ret = sched_setaffinity(0, sizeof(cpuset), &cpuset);
                     if (ret == 0) {
+                        audioBigCoreSet = cpuset;
+                        audioBigCorePinned = true;
                         OH_LOG_INFO(LOG_APP, "AudioRecv thread bound to %{public}d big cores", bigCount);
                     }
                     // 失败也不要紧，QoS 已暗示调度器优先使用大核
@@ -780,12 +943,54 @@ void BridgeArDecodeAndPlaySample(char* sampleData, int sampleLength) {
         }
     }
     
+    // 温控降载：解除 / 恢复大核绑定（affinity 只能可靠地在本线程设置）
+    bool releaseBigCores = g_audioBigCoreRelease.load(std::memory_order_relaxed);
+    if (audioBigCorePinned && releaseBigCores != audioBigCoreReleased) {
+        audioBigCoreReleased = releaseBigCores;
+        cpu_set_t cpuset = audioBigCoreSet;
+        if (releaseBigCores) {
+            CPU_ZERO(&cpuset);
+            int numCpus = sysconf(_SC_NPROCESSORS_CONF);
+            for (int i = 0; i < numCpus && i < CPU_SETSIZE; i++) {
+                CPU_SET(i, &cpuset);
+            }
+        }
+        int ret = sched_setaffinity(0, sizeof(cpuset), &cpuset);
+        OH_LOG_INFO(LOG_APP, "AudioRecv thread %{public}s big cores (ret=%{public}d)",
+                    releaseBigCores ? "released from" : "re-bound to", ret);
+    }
+    
     if (g_decodedAudioBuffer == nullptr) {
         return;
     }
     
+    auto packetStart = std::chrono::steady_clock::now();
+    
+    if (sampleData == nullptr) {
+        g_audioFramesLost.fetch_add(1, std::memory_order_relaxed);
+        
+        // FEC 前瞻：暂不补偿，等下一个包的带内 FEC
+        if (CanHoldLostFrame()) {
+            if (g_audioLossPending) {
+                // 连续丢包：只有紧邻下一包的那一帧能被 FEC 恢复，较早的一帧立即 PLC
+                int plcLen = DecodeConcealed(nullptr, 0);
+                PlayDecodedFrame(plcLen, std::chrono::steady_clock::now());
+            }
+            g_audioLossPending = true;
+            g_audioLookaheadHolds.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    
+    if (g_audioLossPending) {
+        g_audioLossPending = false;
+        int fecLen = DecodeConcealed((const unsigned char*)sampleData, sampleLength);
+        PlayDecodedFrame(fecLen, std::chrono::steady_clock::now());
+    }
+    
     // 使用 HarmonyOS AVCodec Opus 解码器
     // 注意：sampleData 可能为 NULL（丢包补偿 PLC），MoonlightOpusDecoder::Decode 内部会处理
+    auto decodeStart = std::chrono::steady_clock::now();
     int decodeLen = MoonlightOpusDecoder::Decode(
         (const unsigned char*)sampleData,
         sampleLength,
@@ -793,23 +998,84 @@ void BridgeArDecodeAndPlaySample(char* sampleData, int sampleLength) {
         g_opusConfig.samplesPerFrame
     );
     
-    if (decodeLen > 0) {
-        // 始终写入解码后的音频，不在解码层丢帧
-        // 延迟控制由环形缓冲区内部处理：满时丢弃旧数据、写入新数据
-        // 这样波形始终连续，避免丢帧导致的电流滋啦声
-        AudioRendererInstance::PlaySamples(g_decodedAudioBuffer, decodeLen);
-        
-        // 低频能量分析（音频振动）
-        int bassIntensity = 0;
-        if (g_bassAnalyzer.ProcessFrame(g_decodedAudioBuffer, decodeLen, bassIntensity)) {
-            if (g_audioCallbacks.tsfn_bassEnergy) {
-                CallbackData* data = new CallbackData();
-                data->intParams[0] = bassIntensity;
-                napi_status st = napi_call_threadsafe_function(g_audioCallbacks.tsfn_bassEnergy, data, napi_tsfn_nonblocking);
-                if (st != napi_ok) delete data;
-            }
-        }
+    auto decodeEnd = std::chrono::steady_clock::now();
+    if (sampleData != nullptr) {
+        g_audioDecodeHist.Record(ElapsedUs(decodeStart, decodeEnd), kAudioStageBucketUs);
+    } else {
+        g_audioConcealHist.Record(ElapsedUs(decodeStart, decodeEnd), kAudioStageBucketUs);
     }
+    
+    PlayDecodedFrame(decodeLen, decodeEnd);
+    
+    auto packetEnd = std::chrono::steady_clock::now();
+    uint64_t packetNs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(packetEnd - packetStart).count());
+    uint64_t decodeNs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(decodeEnd - packetStart).count());
+    g_audioRecvPackets.fetch_add(1, std::memory_order_relaxed);
+    g_audioRecvTotalNs.fetch_add(packetNs, std::memory_order_relaxed);
+    g_audioDecodeTotalNs.fetch_add(decodeNs, std::memory_order_relaxed);
+    // 仅 AudioRecv 线程写入 max，无需 CAS
+    if (packetNs > g_audioRecvMaxNs.load(std::memory_order_relaxed)) {
+        g_audioRecvMaxNs.store(packetNs, std::memory_order_relaxed);
+    }
+    g_audioPacketHist.Record(static_cast<uint32_t>(packetNs / 1000), kAudioStageBucketUs);
+}
+
+void Callbacks_SetOnsetSuspended(bool suspended) {
+    g_bassAnalyzer.SetOnsetSuspended(suspended);
+}
+
+void Callbacks_SetAudioBigCoreRelease(bool release) {
+    g_audioBigCoreRelease.store(release, std::memory_order_relaxed);
+}
+
+void Callbacks_GetAudioRecvStats(AudioRecvStats* out) {
+    if (out == nullptr) return;
+    memset(out, 0, sizeof(*out));
+    
+    out->packets = g_audioRecvPackets.load(std::memory_order_relaxed);
+    if (out->packets > 0) {
+        out->avgPacketUs = static_cast<double>(g_audioRecvTotalNs.load(std::memory_order_relaxed))
+                           / out->packets / 1000.0;
+        out->avgDecodeUs = static_cast<double>(g_audioDecodeTotalNs.load(std::memory_order_relaxed))
+                           / out->packets / 1000.0;
+    }
+    out->maxPacketUs = static_cast<double>(g_audioRecvMaxNs.load(std::memory_order_relaxed)) / 1000.0;
+    out->packetP50Us = g_audioPacketHist.Percentile(0.50, kAudioStageBucketUs);
+    out->packetP99Us = g_audioPacketHist.Percentile(0.99, kAudioStageBucketUs);
+    out->packetP999Us = g_audioPacketHist.Percentile(0.999, kAudioStageBucketUs);
+    out->decodeP50Us = g_audioDecodeHist.Percentile(0.50, kAudioStageBucketUs);
+    out->decodeP99Us = g_audioDecodeHist.Percentile(0.99, kAudioStageBucketUs);
+    out->concealP50Us = g_audioConcealHist.Percentile(0.50, kAudioStageBucketUs);
+    out->concealP99Us = g_audioConcealHist.Percentile(0.99, kAudioStageBucketUs);
+    out->concealMaxUs = g_audioConcealHist.Max();
+    out->playP50Us = g_audioPlayHist.Percentile(0.50, kAudioPlayBucketUs);
+    out->playP99Us = g_audioPlayHist.Percentile(0.99, kAudioPlayBucketUs);
+    
+    AudioAnalysisStats analysis = g_audioAnalysisWorker.GetStats();
+    out->analysisPublished = analysis.framesPublished;
+    out->analysisAnalyzed = analysis.framesAnalyzed;
+    out->analysisSkipped = analysis.framesSkipped;
+    out->analysisDropped = analysis.framesDropped;
+    out->avgAnalyzeUs = analysis.avgAnalyzeUs;
+    
+    BassEnergyAnalyzer::OnsetStats onset = g_bassAnalyzer.GetOnsetStats();
+    out->onsetBackend = onset.backend;
+    out->onsetFrames = onset.frames;
+    out->onsetCount = onset.onsets;
+    out->onsetAvgUs = onset.avgUs;
+    out->onsetMaxUs = onset.maxUs;
+    out->onsetStateBytes = onset.stateBytes;
+    
+    OpusDecodeStats decode;
+    MoonlightOpusDecoder::GetStats(&decode);
+    out->fecLookahead = MoonlightOpusDecoder::IsFecLookaheadEnabled();
+    out->framesLost = g_audioFramesLost.load(std::memory_order_relaxed);
+    out->fecRecovered = decode.fecRecovered;
+    out->plcFrames = decode.plcFrames;
+    out->fecUnavailable = decode.fecUnavailable;
+    out->lookaheadHolds = g_audioLookaheadHolds.load(std::memory_order_relaxed);
 }
 
 // 连接监听器回调
@@ -843,6 +1109,10 @@ void BridgeClStageFailed(int stage, int errorCode) {
 
 void BridgeClConnectionStarted(void) {
     OH_LOG_INFO(LOG_APP, "Connection started");
+    ControllerInputRouter_OnConnectionStarted();
+    InputScheduler_OnConnectionStarted();
+    DeviceMotion_OnConnectionStarted();
+    TouchGesture_OnConnectionStarted();
     if (g_connCallbacks.tsfn_connectionStarted) {
         napi_call_threadsafe_function(g_connCallbacks.tsfn_connectionStarted, nullptr, napi_tsfn_blocking);
     }
@@ -850,6 +1120,10 @@ void BridgeClConnectionStarted(void) {
 
 void BridgeClConnectionTerminated(int errorCode) {
     OH_LOG_INFO(LOG_APP, "Connection terminated: %{public}d", errorCode);
+    ControllerInputRouter_OnConnectionStopped();
+    InputScheduler_OnConnectionStopped();
+    DeviceMotion_OnConnectionStopped();
+    TouchGesture_OnConnectionStopped();
     if (g_connCallbacks.tsfn_connectionTerminated) {
         CallbackData* data = new CallbackData();
         data->intParams[0] = errorCode;
@@ -858,6 +1132,10 @@ void BridgeClConnectionTerminated(int errorCode) {
 }
 
 void BridgeClRumble(unsigned short controllerNumber, unsigned short lowFreqMotor, unsigned short highFreqMotor) {
+    // 已绑定 native 输出的手柄直接写马达，无需经过 JS
+    if (!HapticsRouter_OnGameRumble(controllerNumber, lowFreqMotor, highFreqMotor)) {
+        return;
+    }
     if (g_connCallbacks.tsfn_rumble) {
         CallbackData* data = new CallbackData();
         data->intParams[0] = controllerNumber;
@@ -914,11 +1192,14 @@ void BridgeClRumbleTriggers(unsigned short controllerNumber, unsigned short left
 
 void BridgeClSetMotionEventState(unsigned short controllerNumber, unsigned char motionType, unsigned short reportRateHz) {
     OH_LOG_INFO(LOG_APP, "SetMotionEventState: controller=%u, type=%u, rate=%u", controllerNumber, motionType, reportRateHz);
+    // 设备传感器直通在 native 订阅，ArkTS 只需更新 UI / 手柄自身传感器状态
+    bool handled = DeviceMotion_OnSetMotionEventState(controllerNumber, motionType, reportRateHz);
     if (g_connCallbacks.tsfn_setMotionEventState) {
         CallbackData* data = new CallbackData();
         data->intParams[0] = controllerNumber;
         data->intParams[1] = motionType;
         data->intParams[2] = reportRateHz;
+        data->intParams[3] = handled ? 1 : 0;
         napi_status st = napi_call_threadsafe_function(g_connCallbacks.tsfn_setMotionEventState, data, napi_tsfn_nonblocking);
         if (st != napi_ok) delete data;
     }
@@ -21,6 +21,7 @@
 #include <napi/native_api.h>
 #include <js_native_api.h>
 #include <js_native_api_types.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -130,6 +131,66 @@ void BridgeClSetControllerLED(unsigned short controllerNumber, unsigned char r,
 void BridgeClResolutionChanged(unsigned int width, unsigned int height);
 void BridgeClLogMessage(const char* format, ...);
 
+// =============================================================================
+// 音频接收路径统计
+// =============================================================================
+
+/**
+ * AudioRecv 线程单包处理耗时（Opus 解码 + 环形缓冲写入 + 分析投递）
+ */
+typedef struct {
+    uint64_t packets;           // 已处理包数
+    double avgPacketUs;         // 单包平均耗时（微秒）
+    double maxPacketUs;         // 单包最大耗时（微秒）
+    double avgDecodeUs;         // 其中 Opus 解码平均耗时（微秒）
+    double packetP50Us;         // 单包耗时分位数（微秒，10µs 分辨率）
+    double packetP99Us;
+    double packetP999Us;
+    double decodeP50Us;         // 正常包解码耗时分位数
+    double decodeP99Us;
+    double concealP50Us;        // 丢包补偿 (PLC/FEC) 解码耗时分位数
+    double concealP99Us;
+    double concealMaxUs;
+    double playP50Us;           // 写入渲染缓冲 + 分析投递耗时分位数（1µs 分辨率）
+    double playP99Us;
+    uint64_t analysisPublished; // 投递到分析线程的帧数
+    uint64_t analysisAnalyzed;  // 分析线程处理的帧数
+    uint64_t analysisSkipped;   // 分析线程积压跳过的帧数
+    uint64_t analysisDropped;   // 分析队列满丢弃的帧数
+    double avgAnalyzeUs;        // 分析线程单帧平均耗时（微秒）
+    const char* onsetBackend;   // 编译期选中的 onset 后端
+    uint64_t onsetFrames;       // 送入 onset 后端的帧数
+    uint64_t onsetCount;        // 检测到的 onset 数
+    double onsetAvgUs;          // onset 后端单帧平均耗时（微秒）
+    double onsetMaxUs;          // onset 后端单帧最大耗时（微秒）
+    uint32_t onsetStateBytes;   // onset 后端内联状态大小
+    bool fecLookahead;          // FEC 前瞻是否启用
+    uint64_t framesLost;        // 丢包通知次数 (decodeAndPlaySample(NULL))
+    uint64_t fecRecovered;      // 由下一包带内 FEC 重建的帧数
+    uint64_t plcFrames;         // PLC 补偿帧数
+    uint64_t fecUnavailable;    // 尝试 FEC 但下一包不含 LBRR 数据
+    uint64_t lookaheadHolds;    // 丢失帧推迟到下一包处理的次数
+} AudioRecvStats;
+
+/**
+ * 获取音频接收路径统计（任意线程可调用）
+ */
+void Callbacks_GetAudioRecvStats(AudioRecvStats* out);
+
+// =============================================================================
+// 温控降载（ThermalGovernor 调用，任意线程）
+// =============================================================================
+
+/**
+ * 暂停 / 恢复低频分析器的 onset 频谱分析
+ */
+void Callbacks_SetOnsetSuspended(bool suspended);
+
+/**
+ * AudioRecv 线程解除 / 恢复大核绑定（下一个音频包时生效）
+ */
+void Callbacks_SetAudioBigCoreRelease(bool release);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,1593 @@
+// Auto-generated by nativelib/tools/gen_controller_db.py - do not edit.
+// Sources: sdl_gamecontrollerdb_data.h, sdl_gamecontrollerdb.cpp, gamepad_napi.cpp
+// Devices: 659 | Vendors: 36 | SDL mappings: 519 | Slots: 1024 | Buckets: 256
+
+#ifndef CONTROLLER_DB_GENERATED_H
+#define CONTROLLER_DB_GENERATED_H
+
+// Table sizes the indexes below were generated against (checked with static_assert)
+#define CONTROLLER_DB_CURATED_MAPPINGS  19
+#define CONTROLLER_DB_VENDOR_DEFAULTS   38
+#define CONTROLLER_DB_KNOWN_GAMEPADS    239
+#define CONTROLLER_DB_VENDOR_FALLBACKS  19
+
+#define CONTROLLER_DB_SDL_MAPPINGS      519
+#define CONTROLLER_DB_SLOTS             1024
+#define CONTROLLER_DB_BUCKETS           256
+#define CONTROLLER_DB_VENDOR_SALT       0x5BD1E995u
+
+#endif // CONTROLLER_DB_GENERATED_H
+
+// Tables are only emitted into sdl_gamecontrollerdb.cpp
+#if defined(CONTROLLER_DB_DEFINE_TABLES) && !defined(CONTROLLER_DB_TABLES_DEFINED)
+#define CONTROLLER_DB_TABLES_DEFINED
+
+static const GamepadMapping g_sdlDbMappings[CONTROLLER_DB_SDL_MAPPINGS] = {
+    { .vendorId = 0x2DC8, .productId = 0x3019, .name = "8BitDo 64", .a = BTN(0), .b = BTN(1), .x = NONE, .y = NONE, .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x3100, .name = "8BitDo Adapter", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(2), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x3106, .name = "8BitDo Adapter 2", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x5109, .name = "8BitDo Dogbone", .a = BTN(1), .b = BTN(0), .x = NONE, .y = NONE, .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = NONE, .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1002, .productId = 0x9000, .name = "8BitDo FC30 Pro", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x9000, .name = "8BitDo FC30 Pro", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(4), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x3810, .name = "8BitDo FC30 Pro", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x286A, .name = "8BitDo GameCube", .a = BTN(0), .b = BTN(3), .x = BTN(1), .y = BTN(4), .back = NONE, .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = NONE, .rightshoulder = BTN(10), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x5112, .name = "8BitDo Lite 2", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x5111, .name = "8BitDo Lite SE", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x5101, .name = "8BitDo M30", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = NONE, .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x5006, .name = "8BitDo M30", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(2), .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x0651, .name = "8BitDo M30", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = NONE, .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(8), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(9), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x200A, .name = "8BitDo M30 Xbox", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = NONE, .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x9020, .name = "8BitDo Micro", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x5104, .name = "8BitDo N30", .a = BTN(1), .b = BTN(0), .x = NONE, .y = NONE, .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = NONE, .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x9015, .name = "8BitDo N30 Pro 2", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x2865, .name = "8BitDo N30 Pro 2", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x2869, .name = "8BitDo N64", .a = BTN(0), .b = BTN(1), .x = NONE, .y = NONE, .back = NONE, .guide = BTN(12), .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x9025, .name = "8BitDo NEOGEO", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x8000, .productId = 0x1002, .name = "8BitDo NES30", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x1003, .name = "8BitDo NES30", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(7), .rightshoulder = BTN(9), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(8), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x1080, .name = "8BitDo NES30", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(7), .rightshoulder = BTN(9), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(8), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2002, .productId = 0x9000, .name = "8BitDo NES30 Pro", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x9001, .name = "8BitDo NES30 Pro", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(4), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x3820, .name = "8BitDo NES30 Pro", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = BTN(2), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x5107, .name = "8BitDo P30", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x5108, .name = "8BitDo P30", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x3010, .name = "8BitDo Pro 2", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x2000, .name = "8BitDo Pro 2 for Xbox", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x6009, .name = "8BitDo Pro 3", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x3101, .name = "8BitDo Receiver", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = BTN(2), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x3102, .name = "8BitDo Receiver", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = BTN(2), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x3103, .name = "8BitDo Receiver", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = BTN(2), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x6728, .name = "8BitDo S30", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = NONE, .guide = NONE, .start = BTN(10), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(8), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(9), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x6000, .name = "8BitDo SF30 Pro", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x6100, .name = "8BitDo SF30 Pro", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = BTN(2), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1235, .productId = 0xAB12, .name = "8BitDo SFC30", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(6), .guide = NONE, .start = BTN(7), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1235, .productId = 0xAB21, .name = "8BitDo SFC30", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0xAB21, .name = "8BitDo SFC30", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2810, .productId = 0x0009, .name = "8BitDo SFC30", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x2830, .name = "8BitDo SFC30", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x5103, .name = "8BitDo SN30", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x6001, .name = "8BitDo SN30 Pro", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x6101, .name = "8BitDo SN30 Pro", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x9012, .name = "8BitDo SN30 Pro", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x2862, .name = "8BitDo SN30 Pro", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x6002, .name = "8BitDo SN30 Pro Plus", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x6102, .name = "8BitDo SN30 Pro Plus", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2820, .productId = 0x0009, .name = "8BitDo SNES30", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = BTN(117), .dpdown = BTN(122), .dpleft = BTN(119), .dpright = BTN(120), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x3012, .name = "8BitDo Ultimate", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x310A, .name = "8BitDo Ultimate 2C", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x301D, .name = "8BitDo Ultimate 2C", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x301B, .name = "8BitDo Ultimate 2C", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x3015, .name = "8BitDo Ultimate C", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x3016, .name = "8BitDo Ultimate C", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x3017, .name = "8BitDo Ultimate C", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x3011, .name = "8BitDo Ultimate Wired", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x6007, .name = "8BitDo Ultimate Wireless", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x3013, .name = "8BitDo Ultimate Wireless", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x2101, .name = "8BitDo Xbox One SN30 Pro", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x05A0, .productId = 0x3232, .name = "8BitDo Zero", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x9018, .name = "8BitDo Zero 2", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2DC8, .productId = 0x3230, .name = "8BitDo Zero 2", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x11C0, .productId = 0x5503, .name = "Acrux Gamepad", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0188, .name = "Afterglow Deluxe Nintendo Switch Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0139, .name = "Afterglow Prismatic Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0213, .name = "Afterglow Xbox 360 Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0010, .productId = 0x0082, .name = "Akishop Customs PS360", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(12), .guide = BTN(8), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x187C, .productId = 0x0600, .name = "Alienware Dual Compatible Game PlayStation Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1949, .productId = 0x0402, .name = "Amazon Fire Controller", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(17), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1949, .productId = 0x0419, .name = "Amazon Luna Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0171, .productId = 0x0419, .name = "Amazon Luna Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(9), .guide = BTN(10), .start = BTN(6), .leftstick = BTN(7), .rightstick = BTN(8), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1008, .productId = 0x01E5, .name = "Anbernic Handheld", .a = BTN(1), .b = BTN(0), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(4), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0502, .productId = 0x1309, .name = "Anbernic RG P01", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x3537, .productId = 0x1007, .name = "Anbernic RG P01", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x3537, .productId = 0x1046, .name = "Anbernic RG P01", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E19, .productId = 0x1001, .name = "Aquaplus Piece", .a = BTN(1), .b = BTN(0), .x = NONE, .y = NONE, .back = BTN(3), .guide = NONE, .start = BTN(2), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = NONE, .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0079, .productId = 0x1830, .name = "Arcade Fightstick F300", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0CA3, .productId = 0x0027, .name = "Astro City Mini", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = BTN(4), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0CA3, .productId = 0x0028, .name = "Astro City Mini", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = BTN(4), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0B05, .productId = 0x4500, .name = "ASUS Gamepad", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(9), .guide = BTN(6), .start = BTN(10), .leftstick = BTN(7), .rightstick = BTN(8), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0B05, .productId = 0x7905, .name = "ASUS ROG Kunai 3", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0B05, .productId = 0x7906, .name = "ASUS ROG Kunai 3", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x3250, .productId = 0x1001, .name = "Atari VCS Classic Controller", .a = BTN(0), .b = BTN(1), .x = NONE, .y = NONE, .back = BTN(2), .guide = BTN(4), .start = BTN(3), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = NONE, .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x3250, .productId = 0x1002, .name = "Atari VCS Modern Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(9), .guide = BTN(10), .start = BTN(8), .leftstick = BTN(6), .rightstick = BTN(7), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x358A, .productId = 0x0102, .name = "Backbone One", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x358A, .productId = 0x0202, .name = "Backbone One", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x358A, .productId = 0x0203, .name = "Backbone One", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x358A, .productId = 0x0204, .name = "Backbone One", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x24C6, .productId = 0x891B, .name = "BDA MOGA XP5X Plus", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20D6, .productId = 0x792A, .name = "BDA PS4 Fightpad", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x11C2, .productId = 0x9107, .name = "Be1 GC101 Controller 1.03", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x11C3, .productId = 0x9107, .name = "Be1 GC101 Controller 1.03", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20BC, .productId = 0x504D, .name = "Beitong A1T2 BFM", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20BC, .productId = 0x5500, .name = "Betop AX1 BFM", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20BC, .productId = 0x1264, .name = "Betop Controller", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = BTN(30), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x146B, .productId = 0x0902, .name = "Bigben", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0C12, .productId = 0x0E30, .name = "Brook Audio Fighting Board PS3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0C12, .productId = 0x0E31, .name = "Brook Audio Fighting Board PS4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0C12, .productId = 0x0E20, .name = "Brook Mars PS4 Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0C12, .productId = 0x0E21, .name = "Brook Mars PS4 Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0C12, .productId = 0x0EF7, .name = "Brook Universal Fighting Board", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1DD8, .productId = 0x000B, .name = "Buffalo BSGP1601", .a = BTN(5), .b = BTN(3), .x = BTN(4), .y = BTN(2), .back = BTN(12), .guide = BTN(15), .start = BTN(13), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(8), .rightshoulder = BTN(9), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20E8, .productId = 0x5860, .name = "Cideko AK08b", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1EAF, .productId = 0x0024, .name = "Clockwork Pi DevTerm", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = NONE, .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x040B, .productId = 0x6533, .name = "Competition Pro", .a = BTN(0), .b = BTN(1), .x = NONE, .y = NONE, .back = BTN(2), .guide = NONE, .start = BTN(3), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = NONE, .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2563, .productId = 0x057A, .name = "Cosmic Byte Ares Wired Controller", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0926, .productId = 0x8888, .name = "Cyber Gadget GameCube Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = NONE, .guide = NONE, .start = BTN(7), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(4), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x06A3, .productId = 0xF622, .name = "Cyborg V3 Rumble", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(4), .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1D79, .productId = 0x0301, .name = "Dual Box Wii Classic Adapter", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = BTN(10), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0130, .name = "EA Sports PS3 Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x11C1, .productId = 0x9101, .name = "EasySMX", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2F24, .productId = 0x0091, .name = "EasySMX ESM-9101", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x056E, .productId = 0x2003, .name = "Elecom U3613M", .a = BTN(2), .b = BTN(3), .x = BTN(0), .y = BTN(1), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x056E, .productId = 0x2007, .name = "Elecom W01U", .a = BTN(2), .b = BTN(3), .x = BTN(0), .y = BTN(1), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x047D, .productId = 0x4006, .name = "Eliminator AfterShock", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(9), .guide = NONE, .start = BTN(8), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(4), .righty = AXIS(2), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0B43, .productId = 0x0003, .name = "EMS Production PS2 Adapter", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = BTN(12), .dpdown = BTN(14), .dpleft = BTN(15), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(5), .righty = AXIS(2), .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0184, .name = "Faceoff Deluxe Nintendo Switch Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0181, .name = "Faceoff Deluxe Pro Nintendo Switch Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0180, .name = "Faceoff Pro Nintendo Switch Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2185, .productId = 0x0102, .name = "FF GP1", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x04B4, .productId = 0x2412, .name = "Flydigi APEX 4", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = BTN(14), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x04B4, .productId = 0x2411, .name = "Flydigi Vader 2", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(12), .rightstick = BTN(13), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1915, .productId = 0x0040, .name = "Flydigi Vader 2", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(21), .start = BTN(11), .leftstick = BTN(12), .rightstick = BTN(13), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x057E, .productId = 0x0337, .name = "GameCube Adapter", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(2), .back = NONE, .guide = NONE, .start = BTN(7), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = BTN(6), .dpup = BTN(8), .dpdown = BTN(9), .dpleft = BTN(10), .dpright = BTN(11), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0003, .productId = 0x0003, .name = "GameForce Controller", .a = BTN(1), .b = BTN(0), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = BTN(16), .start = BTN(9), .leftstick = BTN(14), .rightstick = BTN(15), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(10), .dpdown = BTN(11), .dpleft = BTN(12), .dpright = BTN(13), .leftx = AXIS(1), .lefty = AXIS(0), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x3537, .productId = 0x100B, .name = "GameSir Cyclone 2", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x05AC, .productId = 0x055B, .name = "GameSir G3w", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x8555, .productId = 0x061B, .name = "GameSir G4 Pro", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x05AC, .productId = 0x022D, .name = "GameSir G4s", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(33), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x05AC, .productId = 0x057A, .name = "GameSir G5", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(16), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x3537, .productId = 0x1097, .name = "GameSir Kaleid Flux", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x05AC, .productId = 0x061A, .name = "GameSir T3 2.02", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(15), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20BC, .productId = 0x5656, .name = "GameSir T4w", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x3537, .productId = 0x1094, .name = "GameSir Tegenaria Lite", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x5347, .productId = 0x6D61, .name = "GameStop Gamepad", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0401, .name = "Gamestop Logic3 Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E8F, .productId = 0x0008, .name = "Gasia PlayStation Gamepad", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1345, .productId = 0x1000, .name = "Genius Maxfire Grandias 12", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x25F0, .productId = 0xC121, .name = "Gioteck PS3 Controller", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x25F0, .productId = 0x83C2, .name = "Gioteck VX2 PS3 Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x484B, .productId = 0x1000, .name = "GO-Advance Controller", .a = BTN(1), .b = BTN(0), .x = BTN(2), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(15), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(6), .dpdown = BTN(7), .dpleft = BTN(8), .dpright = BTN(9), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(12), .righttrigger = BTN(13), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x484B, .productId = 0x1100, .name = "GO-Super Gamepad", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(2), .back = BTN(12), .guide = BTN(16), .start = BTN(13), .leftstick = BTN(14), .rightstick = BTN(15), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(8), .dpdown = BTN(9), .dpleft = BTN(10), .dpright = BTN(11), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x25F0, .productId = 0x83C1, .name = "Goodbetterbest Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x18D1, .productId = 0x9400, .name = "Google Stadia Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0079, .productId = 0x18D4, .name = "GPD Win 2 Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x047D, .productId = 0x4005, .name = "Gravis Eliminator Pro", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0428, .productId = 0x4001, .name = "Gravis GamePad Pro", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E8F, .productId = 0x1006, .name = "GreenAsia Electronics Controller", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(11), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E8F, .productId = 0x0012, .name = "GreenAsia Joystick", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(5), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x25F0, .productId = 0x83C3, .name = "GT VX2", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2E8A, .productId = 0x10DD, .name = "Hand Held Legend GC Ultimate", .a = BTN(0), .b = BTN(2), .x = BTN(1), .y = BTN(3), .back = BTN(17), .guide = BTN(18), .start = BTN(16), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(10), .rightshoulder = BTN(11), .dpup = BTN(4), .dpdown = BTN(5), .dpleft = BTN(6), .dpright = BTN(7), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2E8A, .productId = 0x10DF, .name = "Hand Held Legend ProGCC", .a = BTN(1), .b = BTN(0), .x = BTN(3), .y = BTN(2), .back = BTN(17), .guide = BTN(18), .start = BTN(16), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(10), .rightshoulder = BTN(11), .dpup = BTN(4), .dpdown = BTN(5), .dpleft = BTN(6), .dpright = BTN(7), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0xDEAD, .productId = 0xBEEF, .name = "Hidromancer Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x14D8, .productId = 0x6208, .name = "HitBox PS3 PC Analog Mode", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(9), .start = BTN(12), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x11C9, .productId = 0x55F0, .name = "HJC Gamepad", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x006D, .name = "Hori EDGE 301", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x0084, .name = "Hori Fighting Commander", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x005F, .name = "Hori Fighting Commander 4 PS3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x005E, .name = "Hori Fighting Commander 4 PS4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x0150, .name = "Hori Fighting Commander Octa Xbox One", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x0085, .name = "Hori Fighting Commander PS3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x0086, .name = "Hori Fighting Commander Xbox 360", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = BTN(10), .start = BTN(9), .leftstick = BTN(11), .rightstick = BTN(12), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x0137, .name = "Hori Fighting Stick Mini", .a = BTN(1), .b = BTN(0), .x = BTN(3), .y = BTN(2), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x0088, .name = "Hori Fighting Stick mini 4 PS3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x0087, .name = "Hori Fighting Stick mini 4 PS4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x0010, .name = "Hori Fightstick 3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1BAD, .productId = 0xF503, .name = "Hori Fightstick VX", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = BTN(10), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x004D, .name = "Hori Gem Pad 3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1BAD, .productId = 0xF501, .name = "Hori Pad EX Turbo 2", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x0138, .name = "Hori PC Engine Mini Controller", .a = BTN(1), .b = BTN(2), .x = NONE, .y = NONE, .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = NONE, .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x0092, .name = "Hori Pokken Tournament DX Pro", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x0011, .name = "Hori Real Arcade Pro 3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x0022, .name = "Hori Real Arcade Pro 3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x006A, .name = "Hori Real Arcade Pro 4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x006B, .name = "Hori Real Arcade Pro 4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x0016, .name = "Hori Real Arcade Pro EXSE", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = BTN(10), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x00AA, .name = "Hori Real Arcade Pro for Nintendo Switch", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x0185, .name = "Hori Split Pad Fit", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x006E, .name = "Horipad 4 PS3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x0066, .name = "Horipad 4 PS4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x00EE, .name = "Horipad Mini 4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(13), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x01AB, .name = "Horipad Steam", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x0196, .name = "Horipad Steam", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x00F6, .name = "Horipad Switch Pro Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1A34, .productId = 0xF705, .name = "HuiJia GameCube Controller Adapter", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = NONE, .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = BTN(7), .dpup = BTN(12), .dpdown = BTN(14), .dpleft = BTN(15), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(5), .righty = AXIS(2), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2E24, .productId = 0x200B, .name = "Hyperkin Admiral N64 Controller", .a = BTN(1), .b = BTN(0), .x = NONE, .y = NONE, .back = NONE, .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(14), .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2E24, .productId = 0x0BFF, .name = "Hyperkin N64 Adapter", .a = BTN(1), .b = BTN(2), .x = NONE, .y = NONE, .back = NONE, .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2E24, .productId = 0x386A, .name = "Hyperkin Trooper 2", .a = BTN(0), .b = BTN(1), .x = NONE, .y = NONE, .back = BTN(4), .guide = NONE, .start = BTN(5), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(2), .rightshoulder = BTN(3), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2E24, .productId = 0x1688, .name = "Hyperkin X91", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x03F0, .productId = 0x038D, .name = "HyperX Clutch", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x03F0, .productId = 0x048D, .name = "HyperX Clutch", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0583, .productId = 0x2060, .name = "iBuffalo Super Famicom Controller", .a = BTN(1), .b = BTN(0), .x = BTN(3), .y = BTN(2), .back = BTN(6), .guide = NONE, .start = BTN(7), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x04D8, .productId = 0xEA4A, .name = "icedragon.io STAC Dance Pad", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(4), .guide = NONE, .start = NONE, .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = NONE, .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x04D8, .productId = 0xEA4B, .name = "icedragon.io STAC Dance Pad", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(4), .guide = NONE, .start = NONE, .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = NONE, .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2E8A, .productId = 0x10D9, .name = "icedragon.io STAC2 Dance Pad", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(4), .guide = NONE, .start = NONE, .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = NONE, .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2E8A, .productId = 0x10E9, .name = "icedragon.io STAC2 Dance Pad", .a = BTN(8), .b = BTN(9), .x = BTN(10), .y = BTN(11), .back = BTN(12), .guide = NONE, .start = NONE, .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = NONE, .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E8F, .productId = 0x3013, .name = "iCode Retro Adapter", .a = NONE, .b = BTN(3), .x = BTN(2), .y = BTN(0), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(9), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(10), .righttrigger = BTN(1), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x6469, .productId = 0x6469, .name = "idroidcon Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x07B5, .productId = 0x0315, .name = "Impact", .a = BTN(2), .b = BTN(3), .x = BTN(0), .y = BTN(1), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(5), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x04D8, .productId = 0x0082, .name = "IMS PCU0", .a = BTN(1), .b = BTN(0), .x = BTN(3), .y = BTN(2), .back = BTN(4), .guide = NONE, .start = BTN(5), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = NONE, .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0C12, .productId = 0x0005, .name = "InterAct AxisPad", .a = BTN(2), .b = BTN(3), .x = BTN(0), .y = BTN(1), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x05EF, .productId = 0x0003, .name = "InterAct AxisPad", .a = BTN(2), .b = BTN(3), .x = BTN(0), .y = BTN(1), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x05FD, .productId = 0x3000, .name = "InterAct GoPad", .a = BTN(3), .b = BTN(4), .x = BTN(0), .y = BTN(1), .back = NONE, .guide = NONE, .start = NONE, .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(2), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(7), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x05FD, .productId = 0x262A, .name = "InterAct HammerHead FX", .a = BTN(3), .b = BTN(4), .x = BTN(0), .y = BTN(1), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(2), .rightstick = BTN(5), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2563, .productId = 0x0575, .name = "Ipega PG 9099", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1949, .productId = 0x0403, .name = "Ipega PG9099", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F30, .productId = 0x0111, .name = "Jess Tech Colour Rumble Pad", .a = BTN(2), .b = BTN(3), .x = BTN(0), .y = BTN(1), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(5), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F30, .productId = 0x0110, .name = "Jess Tech Dual Analog Rumble", .a = BTN(2), .b = BTN(3), .x = BTN(0), .y = BTN(1), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(5), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F30, .productId = 0x010B, .name = "Jess Tech GGE909 PC Recoil", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x22BA, .productId = 0x1020, .name = "Jess Technology Controller", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x057E, .productId = 0x2006, .name = "Joy-Con (L)", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(13), .guide = NONE, .start = BTN(8), .leftstick = BTN(10), .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x057E, .productId = 0x2007, .name = "Joy-Con (R)", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(12), .guide = NONE, .start = BTN(9), .leftstick = BTN(11), .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x12BD, .productId = 0xC003, .name = "Joypad Alpha Shock", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2F24, .productId = 0x002D, .name = "JYS Adapter", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2F24, .productId = 0x008A, .name = "JYS Adapter", .a = BTN(1), .b = BTN(4), .x = BTN(0), .y = BTN(3), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0301, .name = "Logic3 Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x046D, .productId = 0xCAD1, .name = "Logitech Chillstream", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x046D, .productId = 0xC219, .name = "Logitech Cordless RumblePad 2", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x046D, .productId = 0xC216, .name = "Logitech Dual Action", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x046D, .productId = 0xC21E, .name = "Logitech F510", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x046D, .productId = 0xC218, .name = "Logitech RumblePad 2", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x046D, .productId = 0xC211, .name = "Logitech WingMan Cordless RumblePad", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(2), .guide = BTN(5), .start = BTN(8), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = BTN(9), .righttrigger = BTN(10), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x046D, .productId = 0xC20A, .name = "Logitech WingMan RumblePad", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(8), .guide = NONE, .start = NONE, .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = BTN(7), .righttrigger = BTN(2), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0738, .productId = 0x5266, .name = "Mad Catz CTRLR", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0738, .productId = 0x3285, .name = "Mad Catz Fightpad", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(5), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0738, .productId = 0x3250, .name = "Mad Catz Fightpad Pro PS3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0738, .productId = 0x8250, .name = "Mad Catz Fightpad Pro PS4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1BAD, .productId = 0xF02E, .name = "Mad Catz Fightpad SFxT", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0738, .productId = 0x3180, .name = "Mad Catz FightStick Alpha PS3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0738, .productId = 0x8180, .name = "Mad Catz FightStick Alpha PS4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0738, .productId = 0x3480, .name = "Mad Catz Fightstick PS3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0738, .productId = 0x8480, .name = "Mad Catz Fightstick PS4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0738, .productId = 0x3384, .name = "Mad Catz Fightstick TE S PS3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0738, .productId = 0x8384, .name = "Mad Catz Fightstick TE S PS4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0738, .productId = 0x8818, .name = "Mad Catz Joystick", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0738, .productId = 0x8838, .name = "Mad Catz Joystick", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = AXIS(0), .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0738, .productId = 0x4716, .name = "Mad Catz Xbox 360 Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0738, .productId = 0x4738, .name = "Mad Catz Xbox 360 Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = BTN(10), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1BAD, .productId = 0xF016, .name = "Mad Catz Xbox 360 Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0079, .productId = 0x1843, .name = "Mayflash GameCube Adapter", .a = BTN(1), .b = BTN(0), .x = BTN(2), .y = BTN(3), .back = NONE, .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(5), .righty = AXIS(2), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0079, .productId = 0x1844, .name = "Mayflash GameCube Controller", .a = BTN(1), .b = BTN(0), .x = BTN(2), .y = BTN(3), .back = NONE, .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = BTN(7), .dpup = BTN(12), .dpdown = BTN(14), .dpleft = BTN(15), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(5), .righty = AXIS(2), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2F24, .productId = 0x0073, .name = "Mayflash Magic NS", .a = BTN(1), .b = BTN(4), .x = BTN(0), .y = BTN(3), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0079, .productId = 0x18D2, .name = "Mayflash Magic NS", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20D6, .productId = 0xA710, .name = "Mayflash Magic NS", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2F24, .productId = 0x00F7, .name = "Mayflash Magic S Pro", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E8F, .productId = 0x3010, .name = "Mayflash Saturn Adapter", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = NONE, .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(5), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(7), .righttrigger = BTN(2), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0925, .productId = 0x03E8, .name = "Mayflash Wii Classic Adapter", .a = BTN(1), .b = BTN(0), .x = BTN(3), .y = BTN(2), .back = BTN(8), .guide = BTN(10), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = AXIS(4), .rightshoulder = AXIS(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0079, .productId = 0x1803, .name = "Mayflash Wii DolphinBar", .a = BTN(2), .b = BTN(3), .x = BTN(0), .y = BTN(1), .back = BTN(8), .guide = BTN(11), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0079, .productId = 0x1800, .name = "Mayflash Wii U Pro Adapter", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x07B5, .productId = 0x0312, .name = "Mega World Logic 3 Controller", .a = BTN(2), .b = BTN(3), .x = BTN(0), .y = BTN(1), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(5), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x07B5, .productId = 0x004F, .name = "Mega World Logic 3 Controller", .a = BTN(2), .b = BTN(3), .x = BTN(0), .y = BTN(1), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(5), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0078, .productId = 0x0006, .name = "Microntek Joystick", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x0028, .name = "Microsoft Dual Strike", .a = BTN(3), .b = BTN(2), .x = BTN(1), .y = BTN(0), .back = BTN(4), .guide = NONE, .start = BTN(5), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = AXIS(0), .righty = AXIS(1), .lefttrigger = BTN(8), .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x0003, .name = "Microsoft SideWinder", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(9), .guide = NONE, .start = BTN(8), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(7), .righttrigger = BTN(2), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x0007, .name = "Microsoft SideWinder", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(7), .righttrigger = BTN(2), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x000E, .name = "Microsoft SideWinder Freestyle Pro", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(9), .guide = NONE, .start = BTN(8), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x0027, .name = "Microsoft SideWinder Plug and Play", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = NONE, .guide = NONE, .start = NONE, .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = NONE, .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x0285, .name = "Microsoft Xbox", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(6), .guide = NONE, .start = BTN(7), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(5), .rightshoulder = BTN(2), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x0289, .name = "Microsoft Xbox", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(6), .guide = NONE, .start = BTN(7), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(5), .rightshoulder = BTN(2), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x02DD, .name = "Microsoft Xbox One", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x02EA, .name = "Microsoft Xbox One", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x02E3, .name = "Microsoft Xbox One Elite", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x0B00, .name = "Microsoft Xbox One Elite 2", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x0B05, .name = "Microsoft Xbox One Elite 2", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(17), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(6), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0079, .productId = 0x181C, .name = "Mobapad Chitu HD", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x4F4D, .productId = 0x4554, .name = "Mocute 053X", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x04E8, .productId = 0x046E, .name = "Mocute 053X M59", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20D6, .productId = 0x89E5, .name = "Moga 2", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(9), .guide = NONE, .start = BTN(6), .leftstick = BTN(7), .rightstick = BTN(8), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20D6, .productId = 0x0DAD, .name = "Moga Pro", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = NONE, .guide = NONE, .start = BTN(6), .leftstick = BTN(7), .rightstick = BTN(8), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20D6, .productId = 0x6271, .name = "Moga Pro 2", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(9), .guide = NONE, .start = BTN(6), .leftstick = BTN(7), .rightstick = BTN(8), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x24C6, .productId = 0x892B, .name = "MOGA XP5A Plus", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x24C6, .productId = 0x892A, .name = "MOGA XP5A Plus", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(22), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x24C6, .productId = 0x891A, .name = "MOGA XP5X Plus", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0925, .productId = 0x8866, .name = "MP8866 Super Dual Box", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(9), .guide = NONE, .start = BTN(8), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x06F7, .productId = 0x0001, .name = "N64 Adaptoid", .a = BTN(0), .b = BTN(3), .x = NONE, .y = NONE, .back = NONE, .guide = NONE, .start = BTN(8), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = BTN(10), .dpdown = BTN(11), .dpleft = BTN(12), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(9), .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x146B, .productId = 0x0609, .name = "Nacon Asymmetric Wireless PS4 Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x3285, .productId = 0x0C03, .name = "Nacon GC100", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x3285, .productId = 0x0607, .name = "Nacon GC100", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x146B, .productId = 0x0C01, .name = "Nacon GC400ES", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x3285, .productId = 0x0305, .name = "Nacon MGX Pro", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x3285, .productId = 0x0D17, .name = "Nacon Revolution 5 Pro", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x3285, .productId = 0x0D19, .name = "Nacon Revolution 5 Pro", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F0D, .productId = 0x0009, .name = "Natec Genesis P44", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1F4F, .productId = 0x0008, .name = "NeoGeo PS3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1292, .productId = 0x4E47, .name = "NeoGeo X Arcade Stick", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(2), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = NONE, .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0079, .productId = 0x1845, .name = "Nexilux GameCube Controller Adapter", .a = BTN(1), .b = BTN(0), .x = BTN(2), .y = BTN(3), .back = NONE, .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(5), .righty = AXIS(2), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0810, .productId = 0xE501, .name = "NEXT SNES Controller", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = BTN(6), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x057E, .productId = 0x1337, .name = "Nintendo 3DS", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(2), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(10), .dpdown = BTN(11), .dpleft = BTN(12), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0079, .productId = 0x1846, .name = "Nintendo GameCube Controller Adapter", .a = BTN(1), .b = BTN(0), .x = BTN(2), .y = BTN(3), .back = NONE, .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = BTN(7), .dpup = BTN(12), .dpdown = BTN(14), .dpleft = BTN(15), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(5), .righty = AXIS(2), .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x11EC, .productId = 0xA7E1, .name = "Nintendo Switch", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x057E, .productId = 0x2069, .name = "Nintendo Switch 2 Pro Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(14), .guide = BTN(16), .start = BTN(6), .leftstick = BTN(15), .rightstick = BTN(7), .leftshoulder = BTN(12), .rightshoulder = BTN(4), .dpup = BTN(11), .dpdown = BTN(8), .dpleft = BTN(10), .dpright = BTN(9), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(13), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x694E, .productId = 0x6E65, .name = "Nintendo Switch Combined Joy-Cons", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(2), .back = BTN(9), .guide = BTN(11), .start = BTN(10), .leftstick = BTN(12), .rightstick = BTN(13), .leftshoulder = BTN(5), .rightshoulder = BTN(6), .dpup = BTN(14), .dpdown = BTN(15), .dpleft = BTN(16), .dpright = BTN(17), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(7), .righttrigger = BTN(8), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x057E, .productId = 0x2008, .name = "Nintendo Switch Combined Joy-Cons", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(2), .back = BTN(9), .guide = BTN(11), .start = BTN(10), .leftstick = BTN(12), .rightstick = BTN(13), .leftshoulder = BTN(5), .rightshoulder = BTN(6), .dpup = BTN(14), .dpdown = BTN(15), .dpleft = BTN(16), .dpright = BTN(17), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(7), .righttrigger = BTN(8), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x694C, .productId = 0x7250, .name = "Nintendo Switch Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0001, .productId = 0x0001, .name = "Nintendo Wii Remote", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = BTN(10), .start = BTN(9), .leftstick = BTN(11), .rightstick = BTN(12), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x057E, .productId = 0x0330, .name = "Nintendo Wii U Pro Controller", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(2), .back = BTN(8), .guide = BTN(10), .start = BTN(9), .leftstick = BTN(11), .rightstick = BTN(12), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(13), .dpdown = BTN(14), .dpleft = BTN(15), .dpright = BTN(16), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1D5A, .productId = 0x1802, .name = "Nokia GC 5000", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x050D, .productId = 0x0803, .name = "Nostromo n45 Dual Analog", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = BTN(9), .start = BTN(10), .leftstick = BTN(12), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(5), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x057E, .productId = 0x2073, .name = "NSO GameCube Controller", .a = BTN(1), .b = BTN(3), .x = BTN(0), .y = BTN(2), .back = NONE, .guide = BTN(16), .start = BTN(6), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(13), .rightshoulder = BTN(5), .dpup = BTN(11), .dpdown = BTN(8), .dpleft = BTN(10), .dpright = BTN(9), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(12), .righttrigger = BTN(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x057E, .productId = 0x2019, .name = "NSO N64 Controller", .a = BTN(0), .b = BTN(1), .x = NONE, .y = NONE, .back = NONE, .guide = BTN(12), .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x057E, .productId = 0x201E, .name = "NSO Sega Genesis Controller", .a = BTN(0), .b = BTN(1), .x = NONE, .y = NONE, .back = NONE, .guide = BTN(6), .start = BTN(5), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = BTN(2), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = BTN(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x057E, .productId = 0x2017, .name = "NSO SNES Controller", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(2), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0955, .productId = 0x7210, .name = "NVIDIA Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = NONE, .guide = BTN(13), .start = BTN(7), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0955, .productId = 0x7214, .name = "NVIDIA Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(14), .guide = BTN(16), .start = BTN(6), .leftstick = BTN(7), .rightstick = BTN(8), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x124B, .productId = 0x4D01, .name = "NYKO Airflo EX", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = BTN(10), .start = BTN(9), .leftstick = BTN(11), .rightstick = BTN(12), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1345, .productId = 0x3008, .name = "NYKO CORE", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0001, .productId = 0x0002, .name = "ODROID Go 2", .a = BTN(1), .b = BTN(0), .x = BTN(2), .y = BTN(3), .back = NONE, .guide = BTN(12), .start = BTN(17), .leftstick = BTN(14), .rightstick = BTN(15), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(8), .dpdown = BTN(9), .dpleft = BTN(10), .dpright = BTN(11), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(13), .righttrigger = BTN(16), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2836, .productId = 0x0001, .name = "OUYA Controller", .a = BTN(0), .b = BTN(3), .x = BTN(1), .y = BTN(2), .back = NONE, .guide = BTN(14), .start = NONE, .leftstick = BTN(6), .rightstick = BTN(7), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(8), .dpdown = BTN(9), .dpleft = BTN(10), .dpright = BTN(11), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0583, .productId = 0x2050, .name = "Padix Rockfire PlayStation Bridge", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x11FF, .productId = 0x3331, .name = "PC Controller", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x02B8, .name = "PDP Afterglow Xbox One Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0164, .name = "PDP Battlefield One", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x02D7, .name = "PDP Black Camo Wired Xbox Series Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = NONE, .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(14), .dpdown = BTN(13), .dpleft = BTN(14), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0131, .name = "PDP EA Sports Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0185, .name = "PDP Fightpad Pro Gamecube Controller", .a = BTN(1), .b = BTN(0), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x02C8, .name = "PDP Kingdom Hearts Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0128, .name = "PDP PS3 Rock Candy Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0109, .name = "PDP PS3 Versus Fighting", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x012F, .name = "PDP Wired PS3 Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1BAD, .productId = 0xF904, .name = "PDP Xbox 360 Versus Fighting", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x02F1, .name = "PDP Xbox Atomic", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x02A8, .name = "PDP Xbox One Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = BTN(10), .start = BTN(9), .leftstick = BTN(11), .rightstick = BTN(12), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x02A7, .name = "PDP Xbox One Raven Black", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x02D8, .name = "PDP Xbox Series Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x02EF, .name = "PDP Xbox Series Kinetic Wired Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x24C6, .productId = 0x5300, .name = "PowerA", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x24C6, .productId = 0x543A, .name = "PowerA 1428124-01", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20D6, .productId = 0x4005, .name = "PowerA Advantage Xbox Series Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x62DD, .productId = 0xA715, .name = "PowerA Fusion Nintendo Switch Arcade Stick", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20D6, .productId = 0xA712, .name = "PowerA Fusion Nintendo Switch Fight Pad", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20D6, .productId = 0x4001, .name = "PowerA Fusion Pro 2 Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = NONE, .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x62DD, .productId = 0xA716, .name = "PowerA Fusion Pro Nintendo Switch Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x24C6, .productId = 0x531A, .name = "PowerA Mini Pro Ex", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20D6, .productId = 0xA713, .name = "PowerA Nintendo Switch Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20D6, .productId = 0xCA6D, .name = "PowerA Pro Ex", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20D6, .productId = 0xA714, .name = "PowerA Spectra Nintendo Switch Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x24C6, .productId = 0x581A, .name = "PowerA Xbox One", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20D6, .productId = 0x2002, .name = "PowerA Xbox One Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(7), .guide = NONE, .start = BTN(6), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20D6, .productId = 0x2802, .name = "PowerA Xbox One Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x24C6, .productId = 0x541A, .name = "PowerA Xbox One Mini Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20D6, .productId = 0x4002, .name = "PowerA Xbox One Spectra Infinity", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = NONE, .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20D6, .productId = 0x2005, .name = "PowerA Xbox Series Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20D6, .productId = 0x200B, .name = "PowerA Xbox Series Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x20D6, .productId = 0x200F, .name = "PowerA Xbox Series Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(7), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x046D, .productId = 0xCAD2, .name = "Precision Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0925, .productId = 0x1700, .name = "PS/SS/N64 Adapter", .a = BTN(1), .b = BTN(2), .x = NONE, .y = NONE, .back = NONE, .guide = NONE, .start = BTN(8), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(5), .rightshoulder = BTN(7), .dpup = BTN(12), .dpdown = BTN(14), .dpleft = BTN(15), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(9), .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x11FF, .productId = 0x3341, .name = "PS2 Controller", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0C12, .productId = 0x0E16, .name = "PS3 Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1A34, .productId = 0x0836, .name = "PS3 Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x054C, .productId = 0x0268, .name = "PS3 Controller", .a = BTN(14), .b = BTN(13), .x = BTN(15), .y = BTN(12), .back = BTN(0), .guide = BTN(16), .start = BTN(3), .leftstick = BTN(1), .rightstick = BTN(2), .leftshoulder = BTN(10), .rightshoulder = BTN(11), .dpup = BTN(4), .dpdown = BTN(6), .dpleft = BTN(7), .dpright = BTN(5), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x145F, .productId = 0x0231, .name = "PS3 Controller", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0214, .name = "PS3 Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E8F, .productId = 0x0003, .name = "PS3 Controller", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x4C50, .productId = 0x5453, .name = "PS3 Controller", .a = BTN(14), .b = BTN(13), .x = BTN(15), .y = BTN(12), .back = BTN(0), .guide = BTN(16), .start = BTN(3), .leftstick = BTN(1), .rightstick = BTN(2), .leftshoulder = BTN(10), .rightshoulder = BTN(11), .dpup = BTN(4), .dpdown = BTN(6), .dpleft = BTN(7), .dpright = BTN(5), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x054C, .productId = 0x0BA0, .name = "PS4 Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x11C0, .productId = 0x4001, .name = "PS4 Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x054C, .productId = 0x0E5F, .name = "PS5 Access Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x054C, .productId = 0x0DF2, .name = "PS5 Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F30, .productId = 0x1112, .name = "Qanba Arcade Joystick", .a = BTN(2), .b = BTN(0), .x = BTN(1), .y = BTN(3), .back = BTN(10), .guide = BTN(8), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(5), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(4), .righttrigger = BTN(6), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2C22, .productId = 0x2502, .name = "Qanba Dragon Arcade Joystick PS3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2C22, .productId = 0x2500, .name = "Qanba Dragon Arcade Joystick PS4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2C22, .productId = 0x2012, .name = "Qanba Drone 2 Arcade Joystick PS4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = BTN(6), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2C22, .productId = 0x2010, .name = "Qanba Drone 2 Arcade Joystick PS5", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2C22, .productId = 0x2000, .name = "Qanba Drone Arcade PS4 Joystick", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F30, .productId = 0x1012, .name = "Qanba Joystick Plus", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(5), .rightshoulder = BTN(4), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(7), .righttrigger = BTN(6), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2C22, .productId = 0x2302, .name = "Qanba Obsidian Arcade Joystick PS3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2C22, .productId = 0x2300, .name = "Qanba Obsidian Arcade Joystick PS4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x289B, .productId = 0x0003, .name = "Raphnet 4nes4snes", .a = BTN(0), .b = BTN(4), .x = BTN(1), .y = BTN(5), .back = BTN(2), .guide = NONE, .start = BTN(3), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x289B, .productId = 0x0042, .name = "Raphnet Dual NES Adapter", .a = BTN(0), .b = BTN(1), .x = NONE, .y = NONE, .back = BTN(2), .guide = NONE, .start = BTN(3), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = NONE, .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x289B, .productId = 0x0065, .name = "Raphnet GameCube Adapter", .a = BTN(0), .b = BTN(7), .x = BTN(1), .y = BTN(8), .back = NONE, .guide = NONE, .start = BTN(3), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = BTN(2), .dpup = BTN(10), .dpdown = BTN(11), .dpleft = BTN(12), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x289B, .productId = 0x0032, .name = "Raphnet GC and N64 Adapter", .a = BTN(0), .b = BTN(7), .x = BTN(1), .y = BTN(8), .back = NONE, .guide = NONE, .start = BTN(3), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = BTN(2), .dpup = BTN(10), .dpdown = BTN(11), .dpleft = BTN(12), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x289B, .productId = 0x0060, .name = "Raphnet GC and N64 Adapter", .a = BTN(0), .b = BTN(7), .x = BTN(1), .y = BTN(8), .back = NONE, .guide = NONE, .start = BTN(3), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = BTN(2), .dpup = BTN(10), .dpdown = BTN(11), .dpleft = BTN(12), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x289B, .productId = 0x003C, .name = "Raphnet N64 Adapter", .a = BTN(0), .b = BTN(1), .x = NONE, .y = NONE, .back = NONE, .guide = NONE, .start = BTN(3), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(10), .dpdown = BTN(11), .dpleft = BTN(12), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(2), .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x289B, .productId = 0x0061, .name = "Raphnet N64 Adapter", .a = BTN(0), .b = BTN(1), .x = NONE, .y = NONE, .back = NONE, .guide = NONE, .start = BTN(3), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(10), .dpdown = BTN(11), .dpleft = BTN(12), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(2), .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x289B, .productId = 0x0063, .name = "Raphnet N64 Adapter", .a = BTN(0), .b = BTN(1), .x = NONE, .y = NONE, .back = NONE, .guide = NONE, .start = BTN(3), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(10), .dpdown = BTN(11), .dpleft = BTN(12), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(2), .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x289B, .productId = 0x0064, .name = "Raphnet N64 Adapter", .a = BTN(0), .b = BTN(1), .x = NONE, .y = NONE, .back = NONE, .guide = NONE, .start = BTN(3), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(10), .dpdown = BTN(11), .dpleft = BTN(12), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(2), .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x289B, .productId = 0x0080, .name = "Raphnet Wii Classic Adapter", .a = BTN(1), .b = BTN(4), .x = BTN(0), .y = BTN(5), .back = BTN(2), .guide = NONE, .start = BTN(3), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = BTN(12), .dpdown = BTN(13), .dpleft = BTN(14), .dpright = BTN(15), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x27F8, .productId = 0x0BBF, .name = "Razer Kishi", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1689, .productId = 0xFD01, .name = "Razer Onza Classic Edition", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(13), .dpdown = BTN(14), .dpleft = BTN(11), .dpright = BTN(12), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1532, .productId = 0x0402, .name = "Razer Panthera PS3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1532, .productId = 0x0401, .name = "Razer Panthera PS4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1532, .productId = 0x1008, .name = "Razer Panthera PS4 Evo Arcade Stick", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(13), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1532, .productId = 0x1000, .name = "Razer Raiju", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1532, .productId = 0x0705, .name = "Razer Raiju Mobile", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(21), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1532, .productId = 0x100A, .name = "Razer Raiju Tournament Edition", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(13), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1532, .productId = 0x1100, .name = "Razer Raion PS4 Fightpad", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1689, .productId = 0xFE00, .name = "Razer Sabertooth", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x24C6, .productId = 0x5D04, .name = "Razer Sabertooth", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1532, .productId = 0x0900, .name = "Razer Serval", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1532, .productId = 0x0A03, .name = "Razer Wildcat", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1532, .productId = 0x100B, .name = "Razer Wolverine PS5 Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0079, .productId = 0x0011, .name = "Retro Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(4), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(7), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0403, .productId = 0x97C1, .name = "Retrode Adapter", .a = BTN(0), .b = BTN(4), .x = BTN(1), .y = BTN(5), .back = BTN(2), .guide = NONE, .start = BTN(3), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x484B, .productId = 0x1101, .name = "RetroGame Joypad", .a = BTN(1), .b = BTN(0), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(11), .rightstick = BTN(12), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(13), .dpdown = BTN(14), .dpleft = BTN(15), .dpright = BTN(16), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1781, .productId = 0x0A99, .name = "Retronic Adapter", .a = BTN(0), .b = NONE, .x = NONE, .y = NONE, .back = NONE, .guide = NONE, .start = NONE, .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = NONE, .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0xF000, .productId = 0x0003, .name = "RetroPad", .a = BTN(1), .b = BTN(5), .x = BTN(0), .y = BTN(4), .back = BTN(2), .guide = NONE, .start = BTN(3), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x6552, .productId = 0x536F, .name = "RetroStone 2 Controller", .a = BTN(1), .b = BTN(0), .x = BTN(4), .y = BTN(3), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = BTN(14), .dpdown = BTN(15), .dpleft = BTN(16), .dpright = BTN(17), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1234, .productId = 0x0004, .name = "RetroUSB N64 RetroPort", .a = BTN(7), .b = BTN(6), .x = NONE, .y = NONE, .back = NONE, .guide = NONE, .start = BTN(4), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(13), .rightshoulder = BTN(12), .dpup = BTN(3), .dpdown = BTN(2), .dpleft = BTN(1), .dpright = BTN(0), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(5), .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x146B, .productId = 0x0D01, .name = "Revolution Pro Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x146B, .productId = 0x0D13, .name = "Revolution Pro Controller 3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x011F, .name = "Rock Candy", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0187, .name = "Rock Candy Nintendo Switch Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x011E, .name = "Rock Candy PS3 Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x24C6, .productId = 0xFAFE, .name = "Rock Candy Xbox 360 Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0146, .name = "Rock Candy Xbox One Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x1113, .name = "Saffun Controller", .a = BTN(2), .b = BTN(3), .x = BTN(1), .y = BTN(0), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x06A3, .productId = 0xF623, .name = "Saitek Cyborg PlayStation Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(4), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x06A3, .productId = 0x0510, .name = "Saitek P150", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = NONE, .guide = NONE, .start = NONE, .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(7), .rightshoulder = BTN(2), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x06A3, .productId = 0x0107, .name = "Saitek P220", .a = BTN(2), .b = BTN(3), .x = BTN(0), .y = BTN(1), .back = NONE, .guide = NONE, .start = NONE, .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(4), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(7), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x06A3, .productId = 0xFF0C, .name = "Saitek P2500 Force Rumble", .a = BTN(2), .b = BTN(3), .x = BTN(0), .y = BTN(1), .back = BTN(11), .guide = NONE, .start = BTN(10), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x06A3, .productId = 0x5F0D, .name = "Saitek P2600", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(9), .guide = BTN(11), .start = BTN(8), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x06A3, .productId = 0x040C, .name = "Saitek P2900", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(9), .start = BTN(12), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x06A3, .productId = 0xF518, .name = "Saitek P3200 Rumble", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0F30, .productId = 0x0112, .name = "Saitek P380", .a = BTN(2), .b = BTN(3), .x = BTN(0), .y = BTN(1), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(5), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x06A3, .productId = 0x0109, .name = "Saitek P880", .a = BTN(2), .b = BTN(3), .x = BTN(0), .y = BTN(1), .back = NONE, .guide = NONE, .start = NONE, .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x06A3, .productId = 0x040B, .name = "Saitek P990 Dual Analog", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(9), .guide = NONE, .start = BTN(8), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x06A3, .productId = 0xF620, .name = "Saitek PS2700 Rumble", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(4), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x04E8, .productId = 0xA000, .name = "Samsung EIGP20", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(15), .start = BTN(11), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1DD8, .productId = 0x000E, .name = "Savior", .a = BTN(0), .b = BTN(1), .x = BTN(4), .y = BTN(5), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(6), .rightshoulder = BTN(2), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(7), .righttrigger = BTN(3), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2E95, .productId = 0x434B, .name = "Scuf Envision", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(10), .start = BTN(7), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2E95, .productId = 0x434D, .name = "Scuf Envision", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(10), .start = BTN(7), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2E95, .productId = 0x434E, .name = "Scuf Envision", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(10), .start = BTN(7), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0CA3, .productId = 0x0025, .name = "Sega Genesis Mini 3B Controller", .a = BTN(2), .b = BTN(1), .x = NONE, .y = NONE, .back = NONE, .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = NONE, .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x04B4, .productId = 0x010A, .name = "Sega Saturn", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = NONE, .guide = NONE, .start = BTN(8), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(7), .righttrigger = BTN(2), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2563, .productId = 0x0523, .name = "ShanWan Gamepad", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2563, .productId = 0x0526, .name = "ShanWan Gamepad", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1A34, .productId = 0x0809, .name = "SL6566", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x294B, .productId = 0x3004, .name = "Snakebyte Xbox Series Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x6666, .productId = 0x0667, .name = "Sony PlayStation Adapter", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(11), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = BTN(12), .dpdown = BTN(14), .dpleft = BTN(15), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x054C, .productId = 0x0CDA, .name = "Sony PlayStation Controller", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x04D9, .productId = 0x0F16, .name = "Sony PlayStation Controller Adapter", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x00FF, .productId = 0x01CB, .name = "Sony PlayStation Portable", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = NONE, .start = BTN(7), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x054C, .productId = 0x1337, .name = "Sony PlayStation Vita", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(12), .dpdown = BTN(13), .dpleft = BTN(15), .dpright = BTN(14), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0925, .productId = 0x0005, .name = "Sony PS2 pad with SmartJoy Adapter", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(9), .guide = NONE, .start = BTN(8), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x28DE, .productId = 0x1201, .name = "Steam Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(12), .dpdown = BTN(14), .dpleft = BTN(15), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = AXIS(2), .righttrigger = AXIS(3), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x28DE, .productId = 0x1102, .name = "Steam Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(12), .dpdown = BTN(14), .dpleft = BTN(15), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = AXIS(2), .righttrigger = AXIS(3), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x28DE, .productId = 0x1142, .name = "Steam Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(12), .dpdown = BTN(14), .dpleft = BTN(15), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = AXIS(2), .righttrigger = AXIS(3), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x28DE, .productId = 0x11FC, .name = "Steam Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x28DE, .productId = 0x1202, .name = "Steam Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(12), .dpdown = BTN(14), .dpleft = BTN(15), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = AXIS(2), .righttrigger = AXIS(3), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x28DE, .productId = 0x1105, .name = "Steam Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(12), .dpdown = BTN(14), .dpleft = BTN(15), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = AXIS(2), .righttrigger = AXIS(3), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x28DE, .productId = 0x1106, .name = "Steam Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(12), .dpdown = BTN(14), .dpleft = BTN(15), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = AXIS(2), .righttrigger = AXIS(3), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x28DE, .productId = 0x1205, .name = "Steam Deck", .a = BTN(3), .b = BTN(4), .x = BTN(5), .y = BTN(6), .back = BTN(11), .guide = BTN(13), .start = BTN(12), .leftstick = BTN(14), .rightstick = BTN(15), .leftshoulder = BTN(7), .rightshoulder = BTN(8), .dpup = BTN(16), .dpdown = BTN(17), .dpleft = BTN(18), .dpright = BTN(19), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(9), .righttrigger = AXIS(8), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x28DE, .productId = 0x11FF, .name = "Steam Virtual Gamepad", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x694E, .productId = 0x7375, .name = "SteelSeries Nimbus Plus", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(10), .guide = BTN(11), .start = BTN(12), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1038, .productId = 0x1431, .name = "SteelSeries Stratus Duo", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0111, .productId = 0x1431, .name = "SteelSeries Stratus Duo", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(32), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0111, .productId = 0x1419, .name = "SteelSeries Stratus XL", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = NONE, .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1BAD, .productId = 0xF038, .name = "Street Fighter IV Fightstick TE", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x073B, .productId = 0xA104, .name = "Suncom SFX Plus", .a = BTN(0), .b = BTN(2), .x = BTN(1), .y = BTN(3), .back = BTN(7), .guide = NONE, .start = BTN(8), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(9), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x081F, .productId = 0xE401, .name = "Super Famicom Controller", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x6666, .productId = 0x8804, .name = "Super Joy Box 5 Pro", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(9), .guide = NONE, .start = BTN(8), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = BTN(12), .dpdown = BTN(14), .dpleft = BTN(15), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0xF000, .productId = 0x00F1, .name = "Super RetroPort", .a = BTN(1), .b = BTN(5), .x = BTN(0), .y = BTN(4), .back = BTN(2), .guide = NONE, .start = BTN(3), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E8F, .productId = 0x310D, .name = "SZMY Power 3 Turbo", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x7545, .productId = 0x0104, .name = "SZMY Power DS4 Wired Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x7545, .productId = 0x1122, .name = "SZMY Power Gamepad", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E8F, .productId = 0x3114, .name = "SZMY Power PS3", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0AE4, .productId = 0x0703, .name = "Taito Egret II Mini Control Panel", .a = BTN(4), .b = BTN(2), .x = BTN(8), .y = BTN(3), .back = BTN(6), .guide = BTN(9), .start = BTN(7), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = BTN(0), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = BTN(1), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0AE4, .productId = 0x0702, .name = "Taito Egret II Mini Controller", .a = BTN(4), .b = BTN(2), .x = BTN(8), .y = BTN(3), .back = BTN(6), .guide = BTN(9), .start = BTN(7), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = BTN(0), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = BTN(1), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x22BA, .productId = 0x0107, .name = "Technology Innovation PS2 Adapter", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(2), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(5), .righty = AXIS(2), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1C59, .productId = 0x0024, .name = "THEC64 Joystick", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = NONE, .start = BTN(7), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1C59, .productId = 0x0026, .name = "THEGamepad", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(6), .guide = NONE, .start = BTN(7), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x044F, .productId = 0xB315, .name = "Thrustmaster Dual Analog 3.2", .a = BTN(0), .b = BTN(2), .x = BTN(1), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(5), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x044F, .productId = 0xB320, .name = "Thrustmaster Dual Trigger", .a = BTN(0), .b = BTN(2), .x = BTN(1), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(5), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x044F, .productId = 0xB323, .name = "Thrustmaster Dual Trigger PlayStation Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x044F, .productId = 0xD00E, .name = "Thrustmaster eSwap Pro Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x07B5, .productId = 0x9903, .name = "Thrustmaster Firestorm Digital 2", .a = BTN(2), .b = BTN(4), .x = BTN(3), .y = BTN(5), .back = BTN(11), .guide = NONE, .start = BTN(1), .leftstick = BTN(10), .rightstick = BTN(0), .leftshoulder = BTN(6), .rightshoulder = BTN(8), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(7), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x044F, .productId = 0xB303, .name = "Thrustmaster Firestorm Dual Analog 2", .a = BTN(0), .b = BTN(2), .x = BTN(1), .y = BTN(3), .back = NONE, .guide = NONE, .start = NONE, .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(8), .righttrigger = BTN(9), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x044F, .productId = 0xB300, .name = "Thrustmaster Firestorm Dual Power", .a = BTN(0), .b = BTN(2), .x = BTN(1), .y = BTN(3), .back = BTN(9), .guide = BTN(8), .start = BTN(10), .leftstick = BTN(11), .rightstick = BTN(12), .leftshoulder = BTN(4), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(5), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x044F, .productId = 0xB304, .name = "Thrustmaster Firestorm Dual Power", .a = BTN(0), .b = BTN(2), .x = BTN(1), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(5), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x044F, .productId = 0xB326, .name = "Thrustmaster GP XID", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x24C6, .productId = 0x5B02, .name = "Thrustmaster GPX", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x044F, .productId = 0xD008, .name = "Thrustmaster Run N Drive PlayStation Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x044F, .productId = 0xD009, .name = "Thrustmaster Run N Drive PlayStation Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x044F, .productId = 0xD007, .name = "Thrustmaster T Mini", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x044F, .productId = 0xB312, .name = "Thrustmaster Vibrating Gamepad", .a = BTN(0), .b = BTN(2), .x = BTN(1), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(6), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(5), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1D57, .productId = 0x0020, .name = "Tomee SNES Adapter", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = NONE, .start = BTN(7), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x12BD, .productId = 0xD015, .name = "Tomee SNES Controller", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x14D8, .productId = 0xCD07, .name = "Toodles 2008 Chimp PC PS3", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(2), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = AXIS(0), .lefty = AXIS(1), .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x11C0, .productId = 0x9105, .name = "Torid", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0A68, .productId = 0x0003, .name = "TRBot Virtual Joypad", .a = BTN(11), .b = BTN(12), .x = BTN(13), .y = BTN(14), .back = BTN(15), .guide = NONE, .start = BTN(16), .leftstick = BTN(21), .rightstick = BTN(22), .leftshoulder = BTN(17), .rightshoulder = BTN(18), .dpup = BTN(5), .dpdown = BTN(6), .dpleft = BTN(3), .dpright = BTN(4), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(5), .righttrigger = AXIS(2), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0378, .productId = 0x0003, .name = "TRBot Virtual Joypad", .a = BTN(11), .b = BTN(12), .x = BTN(13), .y = BTN(14), .back = BTN(15), .guide = NONE, .start = BTN(16), .leftstick = BTN(21), .rightstick = BTN(22), .leftshoulder = BTN(17), .rightshoulder = BTN(18), .dpup = BTN(5), .dpdown = BTN(6), .dpleft = BTN(3), .dpright = BTN(4), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(5), .righttrigger = AXIS(2), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0DE0, .productId = 0x0003, .name = "TRBot Virtual Joypad", .a = BTN(11), .b = BTN(12), .x = BTN(13), .y = BTN(14), .back = BTN(15), .guide = NONE, .start = BTN(16), .leftstick = BTN(21), .rightstick = BTN(22), .leftshoulder = BTN(17), .rightshoulder = BTN(18), .dpup = BTN(5), .dpdown = BTN(6), .dpleft = BTN(3), .dpright = BTN(4), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(5), .righttrigger = AXIS(2), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x06F0, .productId = 0x0003, .name = "TRBot Virtual Joypad", .a = BTN(11), .b = BTN(12), .x = BTN(13), .y = BTN(14), .back = BTN(15), .guide = NONE, .start = BTN(16), .leftstick = BTN(21), .rightstick = BTN(22), .leftshoulder = BTN(17), .rightshoulder = BTN(18), .dpup = BTN(5), .dpdown = BTN(6), .dpleft = BTN(3), .dpright = BTN(4), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(5), .righttrigger = AXIS(2), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x145F, .productId = 0x01C5, .name = "Trust Gamepad", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x10F5, .productId = 0x7008, .name = "Turtle Beach Recon", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0810, .productId = 0x0001, .name = "Twin PS2 Adapter", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x16C0, .productId = 0x05E1, .name = "Ultimate Atari Fight Stick", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(9), .guide = NONE, .start = BTN(8), .leftstick = NONE, .rightstick = NONE, .leftshoulder = NONE, .rightshoulder = BTN(4), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0079, .productId = 0x0126, .name = "SNES Controller", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = NONE, .dpdown = NONE, .dpleft = NONE, .dpright = NONE, .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = NONE, .righttrigger = NONE, .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x1915, .productId = 0x7856, .name = "Uniplay U6", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = NONE, .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0810, .productId = 0x0003, .name = "USB Gamepad", .a = BTN(2), .b = BTN(1), .x = BTN(3), .y = BTN(0), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0079, .productId = 0x181A, .name = "Venom PS4 Arcade Joystick", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0079, .productId = 0x181B, .name = "Venom PS4 Arcade Joystick", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0203, .name = "Victrix Pro Fightstick PS4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = NONE, .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0207, .name = "Victrix Pro Fightstick PS4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = NONE, .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = NONE, .lefty = NONE, .rightx = NONE, .righty = NONE, .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x05AC, .productId = 0x3232, .name = "VR Box Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(2), .lefttrigger = BTN(4), .righttrigger = BTN(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x4F43, .productId = 0x4E41, .name = "VX Gaming Command Series", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x6258, .productId = 0x3320, .name = "Xbox 360 Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(14), .guide = BTN(7), .start = BTN(6), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(10), .dpdown = BTN(11), .dpleft = BTN(12), .dpright = BTN(13), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x0719, .name = "Xbox 360 Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(13), .dpdown = BTN(14), .dpleft = BTN(11), .dpright = BTN(12), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x0291, .name = "Xbox 360 Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(13), .dpdown = BTN(14), .dpleft = BTN(11), .dpright = BTN(12), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x02A1, .name = "Xbox 360 Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = BTN(13), .dpdown = BTN(14), .dpleft = BTN(11), .dpright = BTN(12), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0315, .name = "Xbox 360 Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x6258, .productId = 0x4720, .name = "Xbox Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x0202, .name = "Xbox Controller", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(6), .guide = NONE, .start = BTN(7), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(5), .rightshoulder = BTN(2), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0E6F, .productId = 0x0413, .name = "Xbox Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(8), .start = BTN(7), .leftstick = BTN(9), .rightstick = BTN(10), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0xFFFF, .productId = 0xFFFF, .name = "Xbox Controller", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(6), .guide = NONE, .start = BTN(7), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(5), .rightshoulder = BTN(2), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x0B0A, .name = "Xbox One Controller", .a = BTN(1), .b = BTN(0), .x = BTN(3), .y = BTN(2), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(11), .rightstick = BTN(12), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x02E0, .name = "Xbox One Controller", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(6), .guide = BTN(10), .start = BTN(7), .leftstick = BTN(8), .rightstick = BTN(9), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(3), .righty = AXIS(4), .lefttrigger = AXIS(2), .righttrigger = AXIS(5), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x02FD, .name = "Xbox One Controller", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(15), .guide = BTN(16), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x0B22, .name = "Xbox One Elite 2 Controller", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x0B13, .name = "Xbox Series Controller", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x045E, .productId = 0x0B20, .name = "Xbox Wireless Controller", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(12), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = AXIS(5), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0C45, .productId = 0x4320, .name = "XEOX SL6556 BK", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x2717, .productId = 0x3144, .name = "XiaoMi Controller", .a = BTN(0), .b = BTN(1), .x = BTN(3), .y = BTN(4), .back = BTN(10), .guide = BTN(20), .start = BTN(11), .leftstick = BTN(13), .rightstick = BTN(14), .leftshoulder = BTN(6), .rightshoulder = BTN(7), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(7), .righttrigger = AXIS(6), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0C12, .productId = 0x0E10, .name = "Zeroplus P4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0C12, .productId = 0x1E10, .name = "Zeroplus P4", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0C12, .productId = 0x2E18, .name = "Zeroplus PS4 Controller", .a = BTN(1), .b = BTN(2), .x = BTN(0), .y = BTN(3), .back = BTN(8), .guide = BTN(12), .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(5), .lefttrigger = AXIS(3), .righttrigger = AXIS(4), .reportOffset = 0, .reportLength = 0 },
+    { .vendorId = 0x0079, .productId = 0x0122, .name = "ZhiXu GuliKit D", .a = BTN(0), .b = BTN(1), .x = BTN(2), .y = BTN(3), .back = BTN(8), .guide = NONE, .start = BTN(9), .leftstick = BTN(10), .rightstick = BTN(11), .leftshoulder = BTN(4), .rightshoulder = BTN(5), .dpup = HAT(0, 1), .dpdown = HAT(0, 4), .dpleft = HAT(0, 8), .dpright = HAT(0, 2), .leftx = AXIS(0), .lefty = AXIS(1), .rightx = AXIS(2), .righty = AXIS(3), .lefttrigger = BTN(6), .righttrigger = BTN(7), .reportOffset = 0, .reportLength = 0 },
+};
+
+static const uint16_t g_controllerDbDisplace[CONTROLLER_DB_BUCKETS] = {
+    7, 1, 1, 2, 3, 1, 2, 2, 0, 0, 1, 1, 9, 0, 0, 1,
+    1, 3, 1, 1, 1, 1, 0, 5, 0, 2, 5, 2, 3, 1, 4, 3,
+    9, 2, 1, 2, 1, 1, 2, 1, 1, 3, 5, 1, 1, 1, 2, 4,
+    8, 1, 0, 2, 2, 8, 1, 0, 2, 12, 16, 1, 4, 1, 3, 5,
+    1, 2, 5, 12, 3, 1, 2, 1, 4, 6, 10, 2, 1, 3, 2, 11,
+    2, 1, 2, 0, 1, 2, 1, 2, 2, 1, 12, 1, 2, 3, 6, 0,
+    1, 1, 9, 2, 1, 1, 5, 2, 1, 0, 7, 1, 1, 31, 4, 3,
+    4, 1, 1, 4, 1, 10, 2, 2, 5, 6, 3, 16, 5, 2, 3, 1,
+    2, 1, 1, 2, 6, 6, 13, 5, 2, 2, 1, 1, 2, 9, 13, 3,
+    1, 2, 6, 4, 5, 1, 7, 1, 2, 3, 7, 1, 20, 1, 0, 10,
+    1, 1, 7, 12, 3, 6, 4, 3, 11, 14, 6, 6, 3, 20, 2, 4,
+    2, 1, 1, 2, 1, 3, 3, 5, 1, 2, 9, 10, 1, 2, 2, 1,
+    0, 1, 5, 1, 8, 9, 2, 4, 5, 19, 0, 2, 3, 4, 1, 10,
+    3, 1, 1, 3, 3, 1, 3, 0, 26, 3, 1, 2, 30, 9, 10, 1,
+    0, 3, 1, 1, 49, 5, 3, 5, 3, 5, 2, 1, 9, 4, 7, 1,
+    4, 0, 0, 1, 1, 0, 12, 2, 2, 2, 0, 1, 1, 2, 4, 1,
+};
+
+static const ControllerDbEntry g_controllerDb[CONTROLLER_DB_SLOTS] = {
+    { 0x2DC85107, CONTROLLER_DB_DEVICE, -1, 45 },
+    { 0x07388838, CONTROLLER_DB_DEVICE, -1, 256 },
+    { 0x05AC057A, CONTROLLER_DB_DEVICE, -1, 150 },
+    { 0x00000810, CONTROLLER_DB_VENDOR, 17, 36 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x07383384, CONTROLLER_DB_DEVICE, -1, 253 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F02EF, CONTROLLER_DB_DEVICE, -1, 345 },
+    { 0x07384726, CONTROLLER_DB_DEVICE, 138, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x057E201E, CONTROLLER_DB_DEVICE, 41, 321 },
+    { 0x2DC83810, CONTROLLER_DB_DEVICE, -1, 25 },
+    { 0x0000057E, CONTROLLER_DB_VENDOR, 2, 2 },
+    { 0x24C6891B, CONTROLLER_DB_DEVICE, -1, 109 },
+    { 0x24C65501, CONTROLLER_DB_DEVICE, 204, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x01111431, CONTROLLER_DB_DEVICE, -1, 466 },
+    { 0x054C05C4, CONTROLLER_DB_DEVICE, 23, 3 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x15320900, CONTROLLER_DB_DEVICE, 71, 409 },
+    { 0x0F0D0086, CONTROLLER_DB_DEVICE, -1, 182 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x25F0C121, CONTROLLER_DB_DEVICE, -1, 159 },
+    { 0x081FE401, CONTROLLER_DB_DEVICE, -1, 470 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x054C09CC, CONTROLLER_DB_DEVICE, 25, 4 },
+    { 0x24C65300, CONTROLLER_DB_DEVICE, 200, 346 },
+    { 0x07384736, CONTROLLER_DB_DEVICE, 140, -1 },
+    { 0x289B0060, CONTROLLER_DB_DEVICE, -1, 392 },
+    { 0x04B42412, CONTROLLER_DB_DEVICE, -1, 141 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x32501002, CONTROLLER_DB_DEVICE, -1, 104 },
+    { 0x0000045E, CONTROLLER_DB_VENDOR, 0, 0 },
+    { 0x0C120E15, CONTROLLER_DB_DEVICE, 224, -1 },
+    { 0x0E6F0184, CONTROLLER_DB_DEVICE, -1, 137 },
+    { 0x0E6F02A4, CONTROLLER_DB_DEVICE, 133, -1 },
+    { 0x046DC21E, CONTROLLER_DB_DEVICE, 64, 240 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x27173144, CONTROLLER_DB_DEVICE, -1, 533 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x28DE1205, CONTROLLER_DB_DEVICE, -1, 462 },
+    { 0x05AC055D, CONTROLLER_DB_DEVICE, 152, -1 },
+    { 0x07388180, CONTROLLER_DB_DEVICE, -1, 250 },
+    { 0x20D6792A, CONTROLLER_DB_DEVICE, -1, 110 },
+    { 0x044FB300, CONTROLLER_DB_DEVICE, -1, 488 },
+    { 0x24C65502, CONTROLLER_DB_DEVICE, 205, -1 },
+    { 0x0F301112, CONTROLLER_DB_DEVICE, -1, 379 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x10381434, CONTROLLER_DB_DEVICE, 151, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x00000079, CONTROLLER_DB_VENDOR, 16, 35 },
+    { 0x8555061B, CONTROLLER_DB_DEVICE, -1, 148 },
+    { 0x289B0003, CONTROLLER_DB_DEVICE, -1, 388 },
+    { 0x2E95434E, CONTROLLER_DB_DEVICE, -1, 442 },
+    { 0x2DC83012, CONTROLLER_DB_DEVICE, -1, 69 },
+    { 0x0E6F013A, CONTROLLER_DB_DEVICE, 121, -1 },
+    { 0x25F083C2, CONTROLLER_DB_DEVICE, -1, 160 },
+    { 0x2DC86728, CONTROLLER_DB_DEVICE, -1, 53 },
+    { 0x0E6F02F1, CONTROLLER_DB_DEVICE, -1, 341 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x046DC21D, CONTROLLER_DB_DEVICE, 63, 9 },
+    { 0x10381430, CONTROLLER_DB_DEVICE, 148, 16 },
+    { 0x75450104, CONTROLLER_DB_DEVICE, -1, 474 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x056E2007, CONTROLLER_DB_DEVICE, -1, 134 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2DC83104, CONTROLLER_DB_DEVICE, 51, 8 },
+    { 0x0E8F3114, CONTROLLER_DB_DEVICE, -1, 476 },
+    { 0x24C6891A, CONTROLLER_DB_DEVICE, -1, 293 },
+    { 0x045E0007, CONTROLLER_DB_DEVICE, -1, 275 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2DC83100, CONTROLLER_DB_DEVICE, -1, 20 },
+    { 0x0CA30027, CONTROLLER_DB_DEVICE, -1, 98 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x000010F5, CONTROLLER_DB_VENDOR, -1, 31 },
+    { 0x146B0D02, CONTROLLER_DB_DEVICE, 169, -1 },
+    { 0x1DD8000B, CONTROLLER_DB_DEVICE, -1, 122 },
+    { 0x0738CB02, CONTROLLER_DB_DEVICE, 144, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x20D6200B, CONTROLLER_DB_DEVICE, -1, 363 },
+    { 0x20BC1264, CONTROLLER_DB_DEVICE, -1, 115 },
+    { 0x057E0306, CONTROLLER_DB_DEVICE, 31, -1 },
+    { 0x62584720, CONTROLLER_DB_DEVICE, -1, 522 },
+    { 0x045E02EA, CONTROLLER_DB_DEVICE, 10, 281 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0CA30025, CONTROLLER_DB_DEVICE, -1, 443 },
+    { 0x044FB323, CONTROLLER_DB_DEVICE, 156, 484 },
+    { 0x045E0003, CONTROLLER_DB_DEVICE, -1, 274 },
+    { 0x0E6F0401, CONTROLLER_DB_DEVICE, -1, 156 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x20D62802, CONTROLLER_DB_DEVICE, -1, 359 },
+    { 0x07384728, CONTROLLER_DB_DEVICE, 139, -1 },
+    { 0x07B5004F, CONTROLLER_DB_DEVICE, -1, 271 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2DC81080, CONTROLLER_DB_DEVICE, -1, 41 },
+    { 0x75451122, CONTROLLER_DB_DEVICE, -1, 475 },
+    { 0x11C29107, CONTROLLER_DB_DEVICE, -1, 111 },
+    { 0x32850D17, CONTROLLER_DB_DEVICE, -1, 301 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0xDEADBEEF, CONTROLLER_DB_DEVICE, -1, 173 },
+    { 0x046DCAD1, CONTROLLER_DB_DEVICE, -1, 237 },
+    { 0x0E6F0180, CONTROLLER_DB_DEVICE, -1, 139 },
+    { 0x0C120EF7, CONTROLLER_DB_DEVICE, -1, 121 },
+    { 0x32850E20, CONTROLLER_DB_DEVICE, 229, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x11C955F0, CONTROLLER_DB_DEVICE, 190, 175 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F0109, CONTROLLER_DB_DEVICE, -1, 338 },
+    { 0x28DE1105, CONTROLLER_DB_DEVICE, -1, 460 },
+    { 0x2E8A10DF, CONTROLLER_DB_DEVICE, -1, 172 },
+    { 0x294B3004, CONTROLLER_DB_DEVICE, -1, 448 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x24C65000, CONTROLLER_DB_DEVICE, 199, -1 },
+    { 0x0AE40702, CONTROLLER_DB_DEVICE, -1, 478 },
+    { 0x03F0038D, CONTROLLER_DB_DEVICE, -1, 210 },
+    { 0x2DC83016, CONTROLLER_DB_DEVICE, -1, 74 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x045E02FF, CONTROLLER_DB_DEVICE, 11, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x20D6A710, CONTROLLER_DB_DEVICE, -1, 264 },
+    { 0x045E02D1, CONTROLLER_DB_DEVICE, 6, 1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2DC82100, CONTROLLER_DB_DEVICE, 46, -1 },
+    { 0x0C121CF6, CONTROLLER_DB_DEVICE, 222, -1 },
+    { 0x20D6200F, CONTROLLER_DB_DEVICE, -1, 364 },
+    { 0x0C120E16, CONTROLLER_DB_DEVICE, -1, 368 },
+    { 0x045E0B05, CONTROLLER_DB_DEVICE, 14, 284 },
+    { 0x00790126, CONTROLLER_DB_DEVICE, -1, 508 },
+    { 0x0000054C, CONTROLLER_DB_VENDOR, 1, 1 },
+    { 0x2DC83105, CONTROLLER_DB_DEVICE, 52, -1 },
+    { 0x2DC85108, CONTROLLER_DB_DEVICE, -1, 46 },
+    { 0x0F0D0067, CONTROLLER_DB_DEVICE, 94, 14 },
+    { 0x040B6533, CONTROLLER_DB_DEVICE, -1, 125 },
+    { 0xC6241B89, CONTROLLER_DB_DEVICE, 220, -1 },
+    { 0x000018D1, CONTROLLER_DB_VENDOR, -1, 25 },
+    { 0x0F0D0063, CONTROLLER_DB_DEVICE, 92, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x054C042F, CONTROLLER_DB_DEVICE, 22, -1 },
+    { 0x0F300112, CONTROLLER_DB_DEVICE, -1, 434 },
+    { 0x2DC82000, CONTROLLER_DB_DEVICE, -1, 48 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x358A0003, CONTROLLER_DB_DEVICE, 215, -1 },
+    { 0x2C222502, CONTROLLER_DB_DEVICE, 174, 380 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F0161, CONTROLLER_DB_DEVICE, 124, -1 },
+    { 0x2DC83019, CONTROLLER_DB_DEVICE, -1, 19 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x28DE11FC, CONTROLLER_DB_DEVICE, -1, 458 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x53476D61, CONTROLLER_DB_DEVICE, -1, 155 },
+    { 0x1532100B, CONTROLLER_DB_DEVICE, -1, 411 },
+    { 0x2F240082, CONTROLLER_DB_DEVICE, 225, -1 },
+    { 0x054CDA0C, CONTROLLER_DB_DEVICE, 30, -1 },
+    { 0x0E8F310D, CONTROLLER_DB_DEVICE, -1, 473 },
+    { 0x2DC86009, CONTROLLER_DB_DEVICE, -1, 49 },
+    { 0x20029000, CONTROLLER_DB_DEVICE, -1, 42 },
+    { 0x07384738, CONTROLLER_DB_DEVICE, -1, 258 },
+    { 0x11C04001, CONTROLLER_DB_DEVICE, 161, 376 },
+    { 0x32850305, CONTROLLER_DB_DEVICE, -1, 300 },
+    { 0x0000046D, CONTROLLER_DB_VENDOR, 4, 4 },
+    { 0x2DC83230, CONTROLLER_DB_DEVICE, -1, 82 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x11C39107, CONTROLLER_DB_DEVICE, -1, 112 },
+    { 0x0E6F02D8, CONTROLLER_DB_DEVICE, -1, 344 },
+    { 0x0E6F0162, CONTROLLER_DB_DEVICE, 125, -1 },
+    { 0x2DC85103, CONTROLLER_DB_DEVICE, -1, 61 },
+    { 0x2F240086, CONTROLLER_DB_DEVICE, 226, -1 },
+    { 0x045E0026, CONTROLLER_DB_DEVICE, 232, -1 },
+    { 0x11C04006, CONTROLLER_DB_DEVICE, 163, -1 },
+    { 0x28200009, CONTROLLER_DB_DEVICE, -1, 68 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x05EF0003, CONTROLLER_DB_DEVICE, -1, 222 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x00002DC8, CONTROLLER_DB_VENDOR, 3, 3 },
+    { 0x0F0D006B, CONTROLLER_DB_DEVICE, -1, 195 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x07383285, CONTROLLER_DB_DEVICE, -1, 245 },
+    { 0x0F0D005B, CONTROLLER_DB_DEVICE, 89, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x19157856, CONTROLLER_DB_DEVICE, -1, 509 },
+    { 0x0F0D004D, CONTROLLER_DB_DEVICE, -1, 188 },
+    { 0x040397C1, CONTROLLER_DB_DEVICE, -1, 413 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F011F, CONTROLLER_DB_DEVICE, 119, 421 },
+    { 0x2DC86101, CONTROLLER_DB_DEVICE, -1, 63 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2E95434B, CONTROLLER_DB_DEVICE, -1, 440 },
+    { 0x007918D2, CONTROLLER_DB_DEVICE, -1, 263 },
+    { 0x00003285, CONTROLLER_DB_VENDOR, -1, 33 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2E24386A, CONTROLLER_DB_DEVICE, -1, 208 },
+    { 0x24C6531A, CONTROLLER_DB_DEVICE, -1, 353 },
+    { 0x289B0064, CONTROLLER_DB_DEVICE, -1, 396 },
+    { 0x0E6F1113, CONTROLLER_DB_DEVICE, -1, 426 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x06A35F0D, CONTROLLER_DB_DEVICE, -1, 431 },
+    { 0x00003575, CONTROLLER_DB_VENDOR, -1, 16 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x06A3F518, CONTROLLER_DB_DEVICE, -1, 433 },
+    { 0x0E6F0187, CONTROLLER_DB_DEVICE, -1, 422 },
+    { 0x000006A3, CONTROLLER_DB_VENDOR, -1, 34 },
+    { 0x046DCABB, CONTROLLER_DB_DEVICE, 68, -1 },
+    { 0x1A340836, CONTROLLER_DB_DEVICE, 235, 369 },
+    { 0x0F0D005F, CONTROLLER_DB_DEVICE, -1, 178 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0F0D0066, CONTROLLER_DB_DEVICE, 93, 200 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x1D790301, CONTROLLER_DB_DEVICE, -1, 129 },
+    { 0x20D64005, CONTROLLER_DB_DEVICE, -1, 348 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0B054500, CONTROLLER_DB_DEVICE, -1, 100 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F0203, CONTROLLER_DB_DEVICE, 129, 513 },
+    { 0x0E6F0201, CONTROLLER_DB_DEVICE, 128, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x15320A15, CONTROLLER_DB_DEVICE, 75, -1 },
+    { 0x20E85860, CONTROLLER_DB_DEVICE, -1, 123 },
+    { 0xFFFFFFFF, CONTROLLER_DB_DEVICE, -1, 525 },
+    { 0x2E240BFF, CONTROLLER_DB_DEVICE, -1, 207 },
+    { 0x2DC8200A, CONTROLLER_DB_DEVICE, -1, 32 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F0128, CONTROLLER_DB_DEVICE, -1, 337 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x045E0B20, CONTROLLER_DB_DEVICE, 18, 531 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x00000001, CONTROLLER_DB_VENDOR, 18, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2E8A10D9, CONTROLLER_DB_DEVICE, -1, 215 },
+    { 0xF0000003, CONTROLLER_DB_DEVICE, -1, 416 },
+    { 0x20D64002, CONTROLLER_DB_DEVICE, -1, 361 },
+    { 0x0B057905, CONTROLLER_DB_DEVICE, -1, 101 },
+    { 0x00791800, CONTROLLER_DB_DEVICE, -1, 269 },
+    { 0x24C6581A, CONTROLLER_DB_DEVICE, -1, 357 },
+    { 0x25630575, CONTROLLER_DB_DEVICE, 236, 225 },
+    { 0x13451000, CONTROLLER_DB_DEVICE, -1, 158 },
+    { 0x20D62009, CONTROLLER_DB_DEVICE, 111, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x66660667, CONTROLLER_DB_DEVICE, -1, 449 },
+    { 0x06F70001, CONTROLLER_DB_DEVICE, -1, 295 },
+    { 0x045E028F, CONTROLLER_DB_DEVICE, 4, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x046DC211, CONTROLLER_DB_DEVICE, -1, 242 },
+    { 0x27F80BBF, CONTROLLER_DB_DEVICE, -1, 398 },
+    { 0x00780006, CONTROLLER_DB_DEVICE, -1, 272 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2DC89000, CONTROLLER_DB_DEVICE, -1, 24 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2C222300, CONTROLLER_DB_DEVICE, 172, 387 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x00791830, CONTROLLER_DB_DEVICE, -1, 97 },
+    { 0x2DC89012, CONTROLLER_DB_DEVICE, -1, 64 },
+    { 0x0F0D005C, CONTROLLER_DB_DEVICE, 90, -1 },
+    { 0x00000111, CONTROLLER_DB_VENDOR, -1, 29 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x07388384, CONTROLLER_DB_DEVICE, -1, 254 },
+    { 0x358A0004, CONTROLLER_DB_DEVICE, 216, -1 },
+    { 0x045E0202, CONTROLLER_DB_DEVICE, 0, 523 },
+    { 0x0F0D00AA, CONTROLLER_DB_DEVICE, 102, 197 },
+    { 0x1235AB12, CONTROLLER_DB_DEVICE, -1, 56 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0F0D005E, CONTROLLER_DB_DEVICE, 91, 179 },
+    { 0x00000738, CONTROLLER_DB_VENDOR, 9, 9 },
+    { 0x2DC83011, CONTROLLER_DB_DEVICE, 50, 76 },
+    { 0x2DC86102, CONTROLLER_DB_DEVICE, -1, 67 },
+    { 0x35750621, CONTROLLER_DB_DEVICE, 231, -1 },
+    { 0x13453008, CONTROLLER_DB_DEVICE, -1, 326 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0079181B, CONTROLLER_DB_DEVICE, -1, 512 },
+    { 0x3537100B, CONTROLLER_DB_DEVICE, -1, 146 },
+    { 0x054C0DF2, CONTROLLER_DB_DEVICE, 28, 378 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x289B0065, CONTROLLER_DB_DEVICE, -1, 390 },
+    { 0x00000B05, CONTROLLER_DB_VENDOR, -1, 27 },
+    { 0x24C65D04, CONTROLLER_DB_DEVICE, -1, 408 },
+    { 0x044FB303, CONTROLLER_DB_DEVICE, -1, 487 },
+    { 0x045E0B13, CONTROLLER_DB_DEVICE, 17, 530 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0F0D008B, CONTROLLER_DB_DEVICE, 100, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x289B0080, CONTROLLER_DB_DEVICE, -1, 397 },
+    { 0x2E24200B, CONTROLLER_DB_DEVICE, -1, 206 },
+    { 0x00791845, CONTROLLER_DB_DEVICE, -1, 306 },
+    { 0x0F0D0084, CONTROLLER_DB_DEVICE, 96, 177 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x08100001, CONTROLLER_DB_DEVICE, -1, 506 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x24C6543A, CONTROLLER_DB_DEVICE, -1, 347 },
+    { 0x0C120005, CONTROLLER_DB_DEVICE, -1, 221 },
+    { 0x2DC82830, CONTROLLER_DB_DEVICE, -1, 60 },
+    { 0x15320401, CONTROLLER_DB_DEVICE, -1, 401 },
+    { 0x045E0B0A, CONTROLLER_DB_DEVICE, 15, 526 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F0131, CONTROLLER_DB_DEVICE, -1, 334 },
+    { 0x2DC8AB21, CONTROLLER_DB_DEVICE, -1, 58 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F012F, CONTROLLER_DB_DEVICE, -1, 339 },
+    { 0x0F0D00A0, CONTROLLER_DB_DEVICE, 101, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x20D60DAD, CONTROLLER_DB_DEVICE, -1, 289 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x32850E1D, CONTROLLER_DB_DEVICE, 228, -1 },
+    { 0x20D62001, CONTROLLER_DB_DEVICE, 108, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x045E0719, CONTROLLER_DB_DEVICE, 12, 518 },
+    { 0x20D6A720, CONTROLLER_DB_DEVICE, 117, -1 },
+    { 0x1BADF038, CONTROLLER_DB_DEVICE, -1, 468 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x09557210, CONTROLLER_DB_DEVICE, -1, 323 },
+    { 0x64696469, CONTROLLER_DB_DEVICE, -1, 218 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x09557214, CONTROLLER_DB_DEVICE, -1, 324 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x044FD003, CONTROLLER_DB_DEVICE, 158, -1 },
+    { 0x0F0D006D, CONTROLLER_DB_DEVICE, -1, 176 },
+    { 0x2DC83102, CONTROLLER_DB_DEVICE, -1, 51 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2F240073, CONTROLLER_DB_DEVICE, -1, 262 },
+    { 0x00030003, CONTROLLER_DB_DEVICE, -1, 145 },
+    { 0x04284001, CONTROLLER_DB_DEVICE, -1, 167 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x15321004, CONTROLLER_DB_DEVICE, 77, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x045E0B00, CONTROLLER_DB_DEVICE, 13, 283 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2C222012, CONTROLLER_DB_DEVICE, -1, 382 },
+    { 0x00003820, CONTROLLER_DB_VENDOR, 15, 15 },
+    { 0x10381420, CONTROLLER_DB_DEVICE, 147, -1 },
+    { 0x10381412, CONTROLLER_DB_DEVICE, 146, -1 },
+    { 0x1C590024, CONTROLLER_DB_DEVICE, -1, 480 },
+    { 0x0AE40703, CONTROLLER_DB_DEVICE, -1, 477 },
+    { 0x62DDA715, CONTROLLER_DB_DEVICE, -1, 349 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x12924E47, CONTROLLER_DB_DEVICE, -1, 305 },
+    { 0x03780003, CONTROLLER_DB_DEVICE, -1, 501 },
+    { 0x15321008, CONTROLLER_DB_DEVICE, 78, 402 },
+    { 0x00000F0D, CONTROLLER_DB_VENDOR, 6, 6 },
+    { 0x289B0061, CONTROLLER_DB_DEVICE, -1, 394 },
+    { 0x0E6F02C8, CONTROLLER_DB_DEVICE, -1, 336 },
+    { 0x2DC85109, CONTROLLER_DB_DEVICE, -1, 22 },
+    { 0x07384740, CONTROLLER_DB_DEVICE, 141, -1 },
+    { 0x14D8CD07, CONTROLLER_DB_DEVICE, -1, 498 },
+    { 0x07383250, CONTROLLER_DB_DEVICE, -1, 246 },
+    { 0x11C19101, CONTROLLER_DB_DEVICE, -1, 131 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x044FD008, CONTROLLER_DB_DEVICE, 159, 492 },
+    { 0x06A30109, CONTROLLER_DB_DEVICE, -1, 435 },
+    { 0x0E6F0213, CONTROLLER_DB_DEVICE, 130, 86 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x14D86208, CONTROLLER_DB_DEVICE, -1, 174 },
+    { 0x07388250, CONTROLLER_DB_DEVICE, -1, 247 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0000044F, CONTROLLER_DB_VENDOR, 11, 11 },
+    { 0x2DC83015, CONTROLLER_DB_DEVICE, -1, 73 },
+    { 0x04E8046E, CONTROLLER_DB_DEVICE, -1, 287 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x05AC055B, CONTROLLER_DB_DEVICE, -1, 147 },
+    { 0x046DC219, CONTROLLER_DB_DEVICE, 61, 238 },
+    { 0x15320A00, CONTROLLER_DB_DEVICE, 72, -1 },
+    { 0x2DC82869, CONTROLLER_DB_DEVICE, -1, 37 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2DC81003, CONTROLLER_DB_DEVICE, 45, 40 },
+    { 0x045E0027, CONTROLLER_DB_DEVICE, 233, 277 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x057E2007, CONTROLLER_DB_DEVICE, 35, 232 },
+    { 0x2E8A10E9, CONTROLLER_DB_DEVICE, -1, 216 },
+    { 0x0000146B, CONTROLLER_DB_VENDOR, 13, 13 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x10F57008, CONTROLLER_DB_DEVICE, -1, 505 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x32850C03, CONTROLLER_DB_DEVICE, -1, 297 },
+    { 0x24C6892A, CONTROLLER_DB_DEVICE, -1, 292 },
+    { 0x045E0285, CONTROLLER_DB_DEVICE, 1, 278 },
+    { 0x10381431, CONTROLLER_DB_DEVICE, 149, 465 },
+    { 0x19490403, CONTROLLER_DB_DEVICE, -1, 226 },
+    { 0x00791844, CONTROLLER_DB_DEVICE, -1, 261 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x1BADF016, CONTROLLER_DB_DEVICE, 194, 259 },
+    { 0x2C222500, CONTROLLER_DB_DEVICE, 173, 381 },
+    { 0x0C120E10, CONTROLLER_DB_DEVICE, -1, 534 },
+    { 0x01710419, CONTROLLER_DB_DEVICE, -1, 91 },
+    { 0x07384718, CONTROLLER_DB_DEVICE, 137, -1 },
+    { 0x2DC83106, CONTROLLER_DB_DEVICE, 53, 21 },
+    { 0x0E6F02A1, CONTROLLER_DB_DEVICE, 132, -1 },
+    { 0x046DC216, CONTROLLER_DB_DEVICE, 59, 239 },
+    { 0x12BDD012, CONTROLLER_DB_DEVICE, 191, -1 },
+    { 0x0F0D006A, CONTROLLER_DB_DEVICE, -1, 194 },
+    { 0x0E6F0113, CONTROLLER_DB_DEVICE, 118, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x04D8EA4A, CONTROLLER_DB_DEVICE, -1, 213 },
+    { 0x20BC504D, CONTROLLER_DB_DEVICE, -1, 113 },
+    { 0x2DC85006, CONTROLLER_DB_DEVICE, -1, 30 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2DC8301D, CONTROLLER_DB_DEVICE, -1, 71 },
+    { 0x00002717, CONTROLLER_DB_VENDOR, -1, 26 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x03F0048D, CONTROLLER_DB_DEVICE, -1, 211 },
+    { 0x28DE1201, CONTROLLER_DB_DEVICE, -1, 455 },
+    { 0x25F083C1, CONTROLLER_DB_DEVICE, -1, 163 },
+    { 0x0079181A, CONTROLLER_DB_DEVICE, -1, 511 },
+    { 0x0F0D00DC, CONTROLLER_DB_DEVICE, 105, -1 },
+    { 0x0E8F0012, CONTROLLER_DB_DEVICE, 187, 169 },
+    { 0x00001038, CONTROLLER_DB_VENDOR, 10, 10 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x04D90F16, CONTROLLER_DB_DEVICE, -1, 451 },
+    { 0x0B430003, CONTROLLER_DB_DEVICE, -1, 136 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x054C0268, CONTROLLER_DB_DEVICE, 21, 370 },
+    { 0x0E8F3013, CONTROLLER_DB_DEVICE, 189, 217 },
+    { 0x057E2019, CONTROLLER_DB_DEVICE, 39, 320 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x289B0042, CONTROLLER_DB_DEVICE, -1, 389 },
+    { 0x12BDD015, CONTROLLER_DB_DEVICE, -1, 497 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x05AC3232, CONTROLLER_DB_DEVICE, -1, 515 },
+    { 0x08100003, CONTROLLER_DB_DEVICE, -1, 510 },
+    { 0x24C6892B, CONTROLLER_DB_DEVICE, -1, 291 },
+    { 0x046DC21A, CONTROLLER_DB_DEVICE, 62, -1 },
+    { 0x057E2008, CONTROLLER_DB_DEVICE, -1, 313 },
+    { 0x2C222200, CONTROLLER_DB_DEVICE, 171, -1 },
+    { 0x35371046, CONTROLLER_DB_DEVICE, -1, 95 },
+    { 0x045E0289, CONTROLLER_DB_DEVICE, 2, 279 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x1A340809, CONTROLLER_DB_DEVICE, -1, 447 },
+    { 0x0A680003, CONTROLLER_DB_DEVICE, -1, 500 },
+    { 0x15320A03, CONTROLLER_DB_DEVICE, 73, 410 },
+    { 0x045E0B22, CONTROLLER_DB_DEVICE, 20, 529 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x20D6200D, CONTROLLER_DB_DEVICE, 112, -1 },
+    { 0x25630523, CONTROLLER_DB_DEVICE, -1, 445 },
+    { 0x1BADF502, CONTROLLER_DB_DEVICE, 198, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x24C6550D, CONTROLLER_DB_DEVICE, 207, -1 },
+    { 0x046DC21F, CONTROLLER_DB_DEVICE, 65, 10 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0xC6241A89, CONTROLLER_DB_DEVICE, 219, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x11C04003, CONTROLLER_DB_DEVICE, 162, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x00790011, CONTROLLER_DB_DEVICE, 180, 412 },
+    { 0x044FD00D, CONTROLLER_DB_DEVICE, 160, -1 },
+    { 0x15320A14, CONTROLLER_DB_DEVICE, 74, 11 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x146B0902, CONTROLLER_DB_DEVICE, -1, 116 },
+    { 0x047D4005, CONTROLLER_DB_DEVICE, -1, 166 },
+    { 0x047D4006, CONTROLLER_DB_DEVICE, -1, 135 },
+    { 0x24C65B00, CONTROLLER_DB_DEVICE, 210, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x000020D6, CONTROLLER_DB_VENDOR, 7, 7 },
+    { 0x146B0609, CONTROLLER_DB_DEVICE, -1, 296 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x35371007, CONTROLLER_DB_DEVICE, -1, 94 },
+    { 0x20D62005, CONTROLLER_DB_DEVICE, -1, 362 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x38202110, CONTROLLER_DB_DEVICE, 177, -1 },
+    { 0x00001532, CONTROLLER_DB_VENDOR, 5, 5 },
+    { 0x2DC83010, CONTROLLER_DB_DEVICE, 49, 47 },
+    { 0x057E0330, CONTROLLER_DB_DEVICE, 32, 316 },
+    { 0x2DC86006, CONTROLLER_DB_DEVICE, 57, 7 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2E241688, CONTROLLER_DB_DEVICE, -1, 209 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x358A0202, CONTROLLER_DB_DEVICE, -1, 106 },
+    { 0x24C65510, CONTROLLER_DB_DEVICE, 209, -1 },
+    { 0x2DC89015, CONTROLLER_DB_DEVICE, 58, 35 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0810E501, CONTROLLER_DB_DEVICE, 185, 307 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x289B003C, CONTROLLER_DB_DEVICE, -1, 393 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0000358A, CONTROLLER_DB_VENDOR, -1, 30 },
+    { 0x000011C0, CONTROLLER_DB_VENDOR, 12, 12 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2DC85112, CONTROLLER_DB_DEVICE, -1, 27 },
+    { 0x0C120E30, CONTROLLER_DB_DEVICE, -1, 117 },
+    { 0x15321007, CONTROLLER_DB_DEVICE, 80, -1 },
+    { 0x0F0D0185, CONTROLLER_DB_DEVICE, -1, 198 },
+    { 0x20BC5500, CONTROLLER_DB_DEVICE, 178, 114 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x22BA0107, CONTROLLER_DB_DEVICE, -1, 479 },
+    { 0xF00000F1, CONTROLLER_DB_DEVICE, -1, 472 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x28DE1142, CONTROLLER_DB_DEVICE, -1, 457 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x06A3F620, CONTROLLER_DB_DEVICE, -1, 437 },
+    { 0x0F0D0138, CONTROLLER_DB_DEVICE, -1, 190 },
+    { 0x38200060, CONTROLLER_DB_DEVICE, 176, -1 },
+    { 0x20D6280D, CONTROLLER_DB_DEVICE, 113, -1 },
+    { 0x0F0D0150, CONTROLLER_DB_DEVICE, -1, 180 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x054C0CDA, CONTROLLER_DB_DEVICE, -1, 450 },
+    { 0x146B0604, CONTROLLER_DB_DEVICE, 167, -1 },
+    { 0x09250005, CONTROLLER_DB_DEVICE, -1, 454 },
+    { 0x045E02E0, CONTROLLER_DB_DEVICE, 8, 527 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2C222302, CONTROLLER_DB_DEVICE, -1, 386 },
+    { 0x2DC80652, CONTROLLER_DB_DEVICE, 44, -1 },
+    { 0x09268888, CONTROLLER_DB_DEVICE, -1, 127 },
+    { 0x25F083C3, CONTROLLER_DB_DEVICE, -1, 170 },
+    { 0x05AC3D03, CONTROLLER_DB_DEVICE, 153, -1 },
+    { 0x00FF01CB, CONTROLLER_DB_DEVICE, -1, 452 },
+    { 0x1689FE00, CONTROLLER_DB_DEVICE, -1, 407 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x15321000, CONTROLLER_DB_DEVICE, 76, 403 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x20D62002, CONTROLLER_DB_DEVICE, 109, 358 },
+    { 0x057E0337, CONTROLLER_DB_DEVICE, 33, 144 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F0163, CONTROLLER_DB_DEVICE, 126, -1 },
+    { 0x0E6F0207, CONTROLLER_DB_DEVICE, -1, 514 },
+    { 0x00008555, CONTROLLER_DB_VENDOR, -1, 18 },
+    { 0x694E6E65, CONTROLLER_DB_DEVICE, -1, 312 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x045E000E, CONTROLLER_DB_DEVICE, -1, 276 },
+    { 0x146B0603, CONTROLLER_DB_DEVICE, 166, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x146B0C01, CONTROLLER_DB_DEVICE, -1, 299 },
+    { 0x057E2069, CONTROLLER_DB_DEVICE, -1, 311 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x057E201A, CONTROLLER_DB_DEVICE, 40, -1 },
+    { 0x007918D4, CONTROLLER_DB_DEVICE, -1, 165 },
+    { 0x12340004, CONTROLLER_DB_DEVICE, -1, 418 },
+    { 0x66668804, CONTROLLER_DB_DEVICE, -1, 471 },
+    { 0x0F0D00C6, CONTROLLER_DB_DEVICE, 104, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x05021309, CONTROLLER_DB_DEVICE, -1, 93 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0583A009, CONTROLLER_DB_DEVICE, 184, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x00790122, CONTROLLER_DB_DEVICE, -1, 537 },
+    { 0x054C0E5F, CONTROLLER_DB_DEVICE, 29, 377 },
+    { 0x32850607, CONTROLLER_DB_DEVICE, -1, 298 },
+    { 0x38200009, CONTROLLER_DB_DEVICE, 175, 18 },
+    { 0x146B0D01, CONTROLLER_DB_DEVICE, 168, 419 },
+    { 0x2DC86001, CONTROLLER_DB_DEVICE, 55, 62 },
+    { 0x044FD009, CONTROLLER_DB_DEVICE, -1, 493 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x00000955, CONTROLLER_DB_VENDOR, -1, 24 },
+    { 0x044FB326, CONTROLLER_DB_DEVICE, 157, 490 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x1BADF02E, CONTROLLER_DB_DEVICE, -1, 248 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0F0D0022, CONTROLLER_DB_DEVICE, 88, 193 },
+    { 0x11C09105, CONTROLLER_DB_DEVICE, -1, 499 },
+    { 0x057E2009, CONTROLLER_DB_DEVICE, 36, 6 },
+    { 0x2DC8310A, CONTROLLER_DB_DEVICE, -1, 70 },
+    { 0xC6242B89, CONTROLLER_DB_DEVICE, 218, -1 },
+    { 0x20D6A711, CONTROLLER_DB_DEVICE, 115, 15 },
+    { 0x0C122E18, CONTROLLER_DB_DEVICE, -1, 536 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x00100082, CONTROLLER_DB_DEVICE, -1, 87 },
+    { 0x057E200E, CONTROLLER_DB_DEVICE, 37, -1 },
+    { 0x484B1101, CONTROLLER_DB_DEVICE, -1, 414 },
+    { 0x00010002, CONTROLLER_DB_DEVICE, -1, 327 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x24C65303, CONTROLLER_DB_DEVICE, 201, -1 },
+    { 0x045E02E3, CONTROLLER_DB_DEVICE, 9, 282 },
+    { 0x00001689, CONTROLLER_DB_VENDOR, -1, 28 },
+    { 0x0F0D0016, CONTROLLER_DB_DEVICE, 86, 196 },
+    { 0x124B4D01, CONTROLLER_DB_DEVICE, -1, 325 },
+    { 0x19490419, CONTROLLER_DB_DEVICE, -1, 90 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2F24002D, CONTROLLER_DB_DEVICE, -1, 234 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x20D6A712, CONTROLLER_DB_DEVICE, -1, 350 },
+    { 0x0C121E10, CONTROLLER_DB_DEVICE, -1, 535 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F0413, CONTROLLER_DB_DEVICE, -1, 524 },
+    { 0x0F30010B, CONTROLLER_DB_DEVICE, -1, 229 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x07383180, CONTROLLER_DB_DEVICE, -1, 249 },
+    { 0x09258866, CONTROLLER_DB_DEVICE, -1, 294 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0C454320, CONTROLLER_DB_DEVICE, -1, 532 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x07389871, CONTROLLER_DB_DEVICE, 142, -1 },
+    { 0x2F24008A, CONTROLLER_DB_DEVICE, -1, 235 },
+    { 0x18D19400, CONTROLLER_DB_DEVICE, -1, 164 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0F0D00C1, CONTROLLER_DB_DEVICE, 103, 13 },
+    { 0x28DE11FF, CONTROLLER_DB_DEVICE, -1, 463 },
+    { 0x0E6F0139, CONTROLLER_DB_DEVICE, 120, 85 },
+    { 0x00010001, CONTROLLER_DB_DEVICE, 238, 315 },
+    { 0x05AC061A, CONTROLLER_DB_DEVICE, -1, 152 },
+    { 0x045E028E, CONTROLLER_DB_DEVICE, 3, 0 },
+    { 0x358A0102, CONTROLLER_DB_DEVICE, -1, 105 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2F240091, CONTROLLER_DB_DEVICE, -1, 132 },
+    { 0x07383480, CONTROLLER_DB_DEVICE, -1, 251 },
+    { 0x044FB320, CONTROLLER_DB_DEVICE, -1, 483 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0F0D000A, CONTROLLER_DB_DEVICE, 83, -1 },
+    { 0x05832050, CONTROLLER_DB_DEVICE, -1, 329 },
+    { 0x09251700, CONTROLLER_DB_DEVICE, -1, 366 },
+    { 0x100801E5, CONTROLLER_DB_DEVICE, -1, 92 },
+    { 0x0738B726, CONTROLLER_DB_DEVICE, 143, -1 },
+    { 0x0F0D0078, CONTROLLER_DB_DEVICE, 95, -1 },
+    { 0x1BADF503, CONTROLLER_DB_DEVICE, -1, 187 },
+    { 0x187C0600, CONTROLLER_DB_DEVICE, -1, 88 },
+    { 0x20BC5656, CONTROLLER_DB_DEVICE, -1, 153 },
+    { 0x00791843, CONTROLLER_DB_DEVICE, 182, 260 },
+    { 0x11FF3331, CONTROLLER_DB_DEVICE, -1, 330 },
+    { 0x11C05510, CONTROLLER_DB_DEVICE, 164, -1 },
+    { 0x694E7375, CONTROLLER_DB_DEVICE, -1, 464 },
+    { 0x2DC80651, CONTROLLER_DB_DEVICE, 43, 31 },
+    { 0x057E2073, CONTROLLER_DB_DEVICE, -1, 319 },
+    { 0x358A0002, CONTROLLER_DB_DEVICE, 214, -1 },
+    { 0x0DE00003, CONTROLLER_DB_DEVICE, -1, 502 },
+    { 0x6552536F, CONTROLLER_DB_DEVICE, -1, 417 },
+    { 0x19490402, CONTROLLER_DB_DEVICE, 193, 89 },
+    { 0x045E02DD, CONTROLLER_DB_DEVICE, 7, 280 },
+    { 0x2563057A, CONTROLLER_DB_DEVICE, -1, 126 },
+    { 0x16C005E1, CONTROLLER_DB_DEVICE, -1, 507 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x24C6541A, CONTROLLER_DB_DEVICE, -1, 360 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2DC83017, CONTROLLER_DB_DEVICE, -1, 75 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x00002C22, CONTROLLER_DB_VENDOR, 14, 14 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x00790018, CONTROLLER_DB_DEVICE, 181, -1 },
+    { 0x2DC86000, CONTROLLER_DB_DEVICE, -1, 54 },
+    { 0x07388480, CONTROLLER_DB_DEVICE, -1, 252 },
+    { 0x0F0D008A, CONTROLLER_DB_DEVICE, 99, -1 },
+    { 0x0E6F0315, CONTROLLER_DB_DEVICE, -1, 521 },
+    { 0x2DC82180, CONTROLLER_DB_DEVICE, 48, -1 },
+    { 0x0F0D0092, CONTROLLER_DB_DEVICE, -1, 191 },
+    { 0x2E8A10DD, CONTROLLER_DB_DEVICE, -1, 171 },
+    { 0x80001002, CONTROLLER_DB_DEVICE, -1, 39 },
+    { 0x1C590026, CONTROLLER_DB_DEVICE, -1, 481 },
+    { 0x0F0D0010, CONTROLLER_DB_DEVICE, -1, 186 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x20D64001, CONTROLLER_DB_DEVICE, -1, 351 },
+    { 0x0E6F0147, CONTROLLER_DB_DEVICE, 123, -1 },
+    { 0x0C120E1C, CONTROLLER_DB_DEVICE, 223, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x12BDC003, CONTROLLER_DB_DEVICE, -1, 233 },
+    { 0x62583320, CONTROLLER_DB_DEVICE, -1, 517 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x06A3040B, CONTROLLER_DB_DEVICE, -1, 436 },
+    { 0x06A30107, CONTROLLER_DB_DEVICE, -1, 429 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x358A0203, CONTROLLER_DB_DEVICE, -1, 107 },
+    { 0x044FD007, CONTROLLER_DB_DEVICE, -1, 494 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2DC86002, CONTROLLER_DB_DEVICE, 56, 66 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E191001, CONTROLLER_DB_DEVICE, -1, 96 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x28DE1202, CONTROLLER_DB_DEVICE, -1, 459 },
+    { 0x057E2020, CONTROLLER_DB_DEVICE, 42, -1 },
+    { 0x28DE1102, CONTROLLER_DB_DEVICE, -1, 456 },
+    { 0x00003537, CONTROLLER_DB_VENDOR, -1, 17 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x06A3FF0C, CONTROLLER_DB_DEVICE, -1, 430 },
+    { 0x2DC82862, CONTROLLER_DB_DEVICE, -1, 65 },
+    { 0x24C6550E, CONTROLLER_DB_DEVICE, 208, -1 },
+    { 0x04D80082, CONTROLLER_DB_DEVICE, -1, 220 },
+    { 0x0E6F02A7, CONTROLLER_DB_DEVICE, -1, 343 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x045E0B21, CONTROLLER_DB_DEVICE, 19, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0F0D0009, CONTROLLER_DB_DEVICE, -1, 303 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0F0D01AB, CONTROLLER_DB_DEVICE, -1, 202 },
+    { 0x2DC82101, CONTROLLER_DB_DEVICE, 47, 79 },
+    { 0x0079181C, CONTROLLER_DB_DEVICE, -1, 285 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2DC83013, CONTROLLER_DB_DEVICE, -1, 78 },
+    { 0x05A03232, CONTROLLER_DB_DEVICE, -1, 80 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x046DC242, CONTROLLER_DB_DEVICE, 66, -1 },
+    { 0x24C65B03, CONTROLLER_DB_DEVICE, 212, -1 },
+    { 0x358A0204, CONTROLLER_DB_DEVICE, -1, 108 },
+    { 0x1532100A, CONTROLLER_DB_DEVICE, 81, 405 },
+    { 0x24C65B02, CONTROLLER_DB_DEVICE, 211, 491 },
+    { 0x2DC85001, CONTROLLER_DB_DEVICE, 54, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x1BADF019, CONTROLLER_DB_DEVICE, 196, -1 },
+    { 0x4F434E41, CONTROLLER_DB_DEVICE, -1, 516 },
+    { 0x146B0D13, CONTROLLER_DB_DEVICE, -1, 420 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F021F, CONTROLLER_DB_DEVICE, 131, -1 },
+    { 0x21850102, CONTROLLER_DB_DEVICE, -1, 140 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x289B0063, CONTROLLER_DB_DEVICE, -1, 395 },
+    { 0x0C120E21, CONTROLLER_DB_DEVICE, -1, 120 },
+    { 0x2DC8286A, CONTROLLER_DB_DEVICE, -1, 26 },
+    { 0x00000E6F, CONTROLLER_DB_VENDOR, 8, 8 },
+    { 0x0C120E31, CONTROLLER_DB_DEVICE, -1, 118 },
+    { 0x07B50315, CONTROLLER_DB_DEVICE, -1, 219 },
+    { 0x0E6F02B8, CONTROLLER_DB_DEVICE, -1, 331 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x1D5A1802, CONTROLLER_DB_DEVICE, -1, 317 },
+    { 0x0000413D, CONTROLLER_DB_VENDOR, -1, 37 },
+    { 0x0E6F02AB, CONTROLLER_DB_DEVICE, 135, -1 },
+    { 0x045E0291, CONTROLLER_DB_DEVICE, 5, 519 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2DC89018, CONTROLLER_DB_DEVICE, -1, 81 },
+    { 0x0E6F02A8, CONTROLLER_DB_DEVICE, -1, 342 },
+    { 0x04E8A000, CONTROLLER_DB_DEVICE, -1, 438 },
+    { 0x07B50312, CONTROLLER_DB_DEVICE, -1, 270 },
+    { 0x11FF3341, CONTROLLER_DB_DEVICE, -1, 367 },
+    { 0x24C6530A, CONTROLLER_DB_DEVICE, 202, -1 },
+    { 0x24C6FAFE, CONTROLLER_DB_DEVICE, 213, 424 },
+    { 0x05832060, CONTROLLER_DB_DEVICE, 183, 212 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x092503E8, CONTROLLER_DB_DEVICE, -1, 267 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F02D7, CONTROLLER_DB_DEVICE, -1, 333 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x046DC20A, CONTROLLER_DB_DEVICE, -1, 243 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F0181, CONTROLLER_DB_DEVICE, -1, 138 },
+    { 0x046DC248, CONTROLLER_DB_DEVICE, 67, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x1BADF904, CONTROLLER_DB_DEVICE, -1, 340 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x06A3F623, CONTROLLER_DB_DEVICE, -1, 427 },
+    { 0x20D689E5, CONTROLLER_DB_DEVICE, 114, 288 },
+    { 0x0E6F0301, CONTROLLER_DB_DEVICE, -1, 236 },
+    { 0x11C05611, CONTROLLER_DB_DEVICE, 165, -1 },
+    { 0x0F0D001B, CONTROLLER_DB_DEVICE, 87, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0C120E20, CONTROLLER_DB_DEVICE, -1, 119 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x07384716, CONTROLLER_DB_DEVICE, 136, 257 },
+    { 0x044FD00E, CONTROLLER_DB_DEVICE, -1, 485 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x06A30510, CONTROLLER_DB_DEVICE, -1, 428 },
+    { 0x054C05C5, CONTROLLER_DB_DEVICE, 24, -1 },
+    { 0x10029000, CONTROLLER_DB_DEVICE, -1, 23 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x00001949, CONTROLLER_DB_VENDOR, -1, 23 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x00791803, CONTROLLER_DB_DEVICE, -1, 268 },
+    { 0x0F0D000D, CONTROLLER_DB_DEVICE, 84, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x28360001, CONTROLLER_DB_DEVICE, -1, 328 },
+    { 0x25630526, CONTROLLER_DB_DEVICE, 237, 446 },
+    { 0x2DC83103, CONTROLLER_DB_DEVICE, -1, 52 },
+    { 0x0E6F0130, CONTROLLER_DB_DEVICE, -1, 130 },
+    { 0x32501001, CONTROLLER_DB_DEVICE, -1, 103 },
+    { 0x2DC8301B, CONTROLLER_DB_DEVICE, -1, 72 },
+    { 0x05FD262A, CONTROLLER_DB_DEVICE, -1, 224 },
+    { 0x00790006, CONTROLLER_DB_DEVICE, 179, 12 },
+    { 0x050D0803, CONTROLLER_DB_DEVICE, -1, 318 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x13456006, CONTROLLER_DB_DEVICE, 192, -1 },
+    { 0x0E8F1006, CONTROLLER_DB_DEVICE, -1, 168 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x045E02FD, CONTROLLER_DB_DEVICE, -1, 528 },
+    { 0x0F300110, CONTROLLER_DB_DEVICE, -1, 228 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x046DCAD2, CONTROLLER_DB_DEVICE, -1, 365 },
+    { 0x32850D19, CONTROLLER_DB_DEVICE, -1, 302 },
+    { 0x11ECA7E1, CONTROLLER_DB_DEVICE, -1, 310 },
+    { 0x484B1100, CONTROLLER_DB_DEVICE, -1, 162 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0000294B, CONTROLLER_DB_VENDOR, -1, 32 },
+    { 0x4F4D4554, CONTROLLER_DB_DEVICE, -1, 286 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F02A5, CONTROLLER_DB_DEVICE, 134, -1 },
+    { 0x057E2017, CONTROLLER_DB_DEVICE, 38, 322 },
+    { 0x35370411, CONTROLLER_DB_DEVICE, 154, -1 },
+    { 0x2DC86007, CONTROLLER_DB_DEVICE, -1, 77 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0F301012, CONTROLLER_DB_DEVICE, -1, 385 },
+    { 0x2DC89001, CONTROLLER_DB_DEVICE, -1, 43 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2DC86100, CONTROLLER_DB_DEVICE, -1, 55 },
+    { 0x2DC83101, CONTROLLER_DB_DEVICE, -1, 50 },
+    { 0x044FB312, CONTROLLER_DB_DEVICE, -1, 495 },
+    { 0x0F0D0137, CONTROLLER_DB_DEVICE, -1, 183 },
+    { 0x0F0D0196, CONTROLLER_DB_DEVICE, -1, 203 },
+    { 0x0F0D0011, CONTROLLER_DB_DEVICE, 85, 192 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x15320705, CONTROLLER_DB_DEVICE, 70, 404 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x000020BC, CONTROLLER_DB_VENDOR, -1, 21 },
+    { 0x2C222010, CONTROLLER_DB_DEVICE, -1, 383 },
+    { 0x145F0231, CONTROLLER_DB_DEVICE, -1, 371 },
+    { 0x0E6F0164, CONTROLLER_DB_DEVICE, 127, 332 },
+    { 0x056E2003, CONTROLLER_DB_DEVICE, -1, 133 },
+    { 0x0E6F0188, CONTROLLER_DB_DEVICE, -1, 84 },
+    { 0x1689FD01, CONTROLLER_DB_DEVICE, -1, 399 },
+    { 0x2C222000, CONTROLLER_DB_DEVICE, 170, 384 },
+    { 0x057E2006, CONTROLLER_DB_DEVICE, 34, 231 },
+    { 0x044FB304, CONTROLLER_DB_DEVICE, -1, 489 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F0185, CONTROLLER_DB_DEVICE, -1, 335 },
+    { 0x0E8F3010, CONTROLLER_DB_DEVICE, 188, 266 },
+    { 0x2DC85101, CONTROLLER_DB_DEVICE, -1, 29 },
+    { 0x2DC83820, CONTROLLER_DB_DEVICE, -1, 44 },
+    { 0x24C65503, CONTROLLER_DB_DEVICE, 206, -1 },
+    { 0x19150040, CONTROLLER_DB_DEVICE, -1, 143 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x057E1337, CONTROLLER_DB_DEVICE, -1, 308 },
+    { 0x35371094, CONTROLLER_DB_DEVICE, -1, 154 },
+    { 0x289B0032, CONTROLLER_DB_DEVICE, -1, 391 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0xC6242A89, CONTROLLER_DB_DEVICE, 217, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x07388818, CONTROLLER_DB_DEVICE, -1, 255 },
+    { 0x20D6A713, CONTROLLER_DB_DEVICE, 116, 354 },
+    { 0x04D8EA4B, CONTROLLER_DB_DEVICE, -1, 214 },
+    { 0x054C0CE6, CONTROLLER_DB_DEVICE, 27, 5 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x1F4F0008, CONTROLLER_DB_DEVICE, -1, 304 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0B057906, CONTROLLER_DB_DEVICE, -1, 102 },
+    { 0x1A34F705, CONTROLLER_DB_DEVICE, -1, 205 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x1D570020, CONTROLLER_DB_DEVICE, -1, 496 },
+    { 0x1DD8000E, CONTROLLER_DB_DEVICE, -1, 439 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x054C1337, CONTROLLER_DB_DEVICE, -1, 453 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F0214, CONTROLLER_DB_DEVICE, -1, 372 },
+    { 0x0C120EF6, CONTROLLER_DB_DEVICE, 221, -1 },
+    { 0x046DC218, CONTROLLER_DB_DEVICE, 60, 241 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x07385266, CONTROLLER_DB_DEVICE, -1, 244 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x073BA104, CONTROLLER_DB_DEVICE, -1, 469 },
+    { 0x24C65500, CONTROLLER_DB_DEVICE, 203, -1 },
+    { 0x4C505453, CONTROLLER_DB_DEVICE, -1, 374 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x1EAF0024, CONTROLLER_DB_DEVICE, -1, 124 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x07B59903, CONTROLLER_DB_DEVICE, -1, 486 },
+    { 0x0F0D00F6, CONTROLLER_DB_DEVICE, 107, 204 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x01111419, CONTROLLER_DB_DEVICE, -1, 467 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2F24008D, CONTROLLER_DB_DEVICE, 227, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0738CB03, CONTROLLER_DB_DEVICE, 145, -1 },
+    { 0x06F00003, CONTROLLER_DB_DEVICE, -1, 503 },
+    { 0x694C7250, CONTROLLER_DB_DEVICE, -1, 314 },
+    { 0x045E0028, CONTROLLER_DB_DEVICE, -1, 273 },
+    { 0x0F0D00EE, CONTROLLER_DB_DEVICE, 106, 201 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2DC82865, CONTROLLER_DB_DEVICE, -1, 36 },
+    { 0x045E0B12, CONTROLLER_DB_DEVICE, 16, 2 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x054C0BA0, CONTROLLER_DB_DEVICE, 26, 375 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2DC85104, CONTROLLER_DB_DEVICE, -1, 34 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x28DE1106, CONTROLLER_DB_DEVICE, -1, 461 },
+    { 0x1BADF501, CONTROLLER_DB_DEVICE, 197, 189 },
+    { 0x2DC89025, CONTROLLER_DB_DEVICE, -1, 38 },
+    { 0x15320037, CONTROLLER_DB_DEVICE, 69, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x044FB315, CONTROLLER_DB_DEVICE, 155, 482 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x06A3F622, CONTROLLER_DB_DEVICE, -1, 128 },
+    { 0x484B1000, CONTROLLER_DB_DEVICE, -1, 161 },
+    { 0x1A340802, CONTROLLER_DB_DEVICE, 234, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0F0D0088, CONTROLLER_DB_DEVICE, -1, 184 },
+    { 0x04B4010A, CONTROLLER_DB_DEVICE, -1, 444 },
+    { 0x35750620, CONTROLLER_DB_DEVICE, 230, 17 },
+    { 0x0F0D0087, CONTROLLER_DB_DEVICE, 98, 185 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x62DDA716, CONTROLLER_DB_DEVICE, -1, 352 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2F2400F7, CONTROLLER_DB_DEVICE, -1, 265 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F0146, CONTROLLER_DB_DEVICE, 122, 425 },
+    { 0x05FD3000, CONTROLLER_DB_DEVICE, -1, 223 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x11C05503, CONTROLLER_DB_DEVICE, -1, 83 },
+    { 0x06A3040C, CONTROLLER_DB_DEVICE, -1, 432 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x10381432, CONTROLLER_DB_DEVICE, 150, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x22BA1020, CONTROLLER_DB_DEVICE, -1, 230 },
+    { 0x35371097, CONTROLLER_DB_DEVICE, -1, 151 },
+    { 0x0F0D006E, CONTROLLER_DB_DEVICE, -1, 199 },
+    { 0x20D66271, CONTROLLER_DB_DEVICE, -1, 290 },
+    { 0x28100009, CONTROLLER_DB_DEVICE, -1, 59 },
+    { 0x0F0D0004, CONTROLLER_DB_DEVICE, 82, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2DC89020, CONTROLLER_DB_DEVICE, -1, 33 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0CA30028, CONTROLLER_DB_DEVICE, -1, 99 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E6F011E, CONTROLLER_DB_DEVICE, -1, 423 },
+    { 0x1BADF018, CONTROLLER_DB_DEVICE, 195, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x2E95434D, CONTROLLER_DB_DEVICE, -1, 441 },
+    { 0x20D6A714, CONTROLLER_DB_DEVICE, -1, 356 },
+    { 0x0F300111, CONTROLLER_DB_DEVICE, -1, 227 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x05AC022D, CONTROLLER_DB_DEVICE, -1, 149 },
+    { 0x20D62006, CONTROLLER_DB_DEVICE, 110, -1 },
+    { 0x00791846, CONTROLLER_DB_DEVICE, -1, 309 },
+    { 0x17810A99, CONTROLLER_DB_DEVICE, -1, 415 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x0E8F0008, CONTROLLER_DB_DEVICE, -1, 157 },
+    { 0x145F01C5, CONTROLLER_DB_DEVICE, -1, 504 },
+    { 0x15320402, CONTROLLER_DB_DEVICE, -1, 400 },
+    { 0x2DC85111, CONTROLLER_DB_DEVICE, -1, 28 },
+    { 0x0F0D0085, CONTROLLER_DB_DEVICE, 97, 181 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x15321100, CONTROLLER_DB_DEVICE, 79, 406 },
+    { 0x20D6CA6D, CONTROLLER_DB_DEVICE, -1, 355 },
+    { 0x0E8F0003, CONTROLLER_DB_DEVICE, 186, 373 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0x1235AB21, CONTROLLER_DB_DEVICE, -1, 57 },
+    { 0x045E02A1, CONTROLLER_DB_DEVICE, -1, 520 },
+    { 0x04B42411, CONTROLLER_DB_DEVICE, -1, 142 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+    { 0, CONTROLLER_DB_EMPTY, -1, -1 },
+};
+
+#endif // CONTROLLER_DB_DEFINE_TABLES
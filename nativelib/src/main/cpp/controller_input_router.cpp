@@ -0,0 +1,645 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file controller_input_router.cpp
+ * @brief Native 手柄输入路由实现
+ */
+
+#include "controller_input_router.h"
+#include "gamepad_napi.h"
+#include "moonlight_bridge.h"
+#include "latency_histogram.h"
+#include "input_scheduler.h"
+#include "device_motion.h"
+
+#include <math.h>
+#include <string.h>
+#include <time.h>
+#include <atomic>
+#include <mutex>
+#include <hilog/log.h>
+
+#include "moonlight-common-c/src/Limelight.h"
+
+#define LOG_TAG "InputRouter"
+
+// 与 GamepadManager 槽位数一致 (0-3)
+#define ROUTER_MAX_SLOTS 4
+
+// 到达事件失败后的重试间隔（避免每帧报告都重试）
+static const uint64_t ARRIVAL_RETRY_NS = 1000ULL * 1000000ULL;
+static const int DEFAULT_SNAPSHOT_INTERVAL_MS = 100;
+
+// 延迟直方图：1µs 桶，覆盖 0-2ms
+static const uint32_t LATENCY_BUCKET_US = 1;
+
+struct InputRouteSlot {
+    bool bound;
+    int pollerId;
+    int parserType;
+    uint16_t vendorId;
+    uint16_t productId;
+    uint8_t controllerType;
+    uint32_t supportedButtons;
+    uint16_t capabilities;
+    int deadzone;               // 径向死区 0-32767（按设备绑定，0 = 不处理，与 ArkTS 路径一致）
+
+    bool arrived;
+    uint64_t lastArrivalAttemptNs;
+
+    NapiGamepadState parsed;    // 解析器状态（跨报告保留，HID 方向）
+    NapiGamepadState sent;      // 最近发送给主机的状态（Moonlight 方向，含体感助手叠加）
+    NapiGamepadState sentPhys;  // sent 对应的物理状态（叠加前，去重依据）
+    bool sentValid;
+
+    bool snapshotPending;       // sent 有未投递给 ArkTS 的变化
+    uint64_t lastSnapshotNs;
+};
+
+struct InputSnapshotData {
+    int slot;
+    NapiGamepadState state;
+};
+
+static InputRouteSlot g_slots[ROUTER_MAX_SLOTS];
+static std::mutex g_routerMutex;
+static std::atomic<int> g_boundCount{0};
+static std::atomic<uint32_t> g_externalMask{0};       // 外部来源已绑定的槽位位图
+
+// 配置
+static std::atomic<bool> g_enabled{false};
+static std::atomic<bool> g_connected{false};
+static std::atomic<uint64_t> g_snapshotIntervalNs{(uint64_t)DEFAULT_SNAPSHOT_INTERVAL_MS * 1000000ULL};
+
+// 快照回调（g_routerMutex 保护）
+static napi_threadsafe_function g_snapshotTsfn = nullptr;
+
+// 统计
+static std::atomic<uint64_t> g_reportsParsed{0};
+static std::atomic<uint64_t> g_reportsForwarded{0};
+static std::atomic<uint64_t> g_eventsSent{0};
+static std::atomic<uint64_t> g_sendFailed{0};
+static std::atomic<uint64_t> g_deduped{0};
+static std::atomic<uint64_t> g_arrivals{0};
+static std::atomic<uint64_t> g_snapshots{0};
+static std::atomic<uint64_t> g_latencySamples{0};
+static std::atomic<uint64_t> g_latencyTotalNs{0};
+static LatencyHistogram<2000> g_latencyHist;
+
+// ============================================================
+// 内部实现 (调用方持有 g_routerMutex)
+// ============================================================
+
+static uint64_t monotonicNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int16_t clampAxis(double v) {
+    if (v > 32767.0) return 32767;
+    if (v < -32767.0) return -32767;
+    return (int16_t)lrint(v);
+}
+
+/**
+ * 径向死区：半径内归零，半径外重新缩放到满量程（避免死区边缘跳变）
+ */
+static void applyRadialDeadzone(int16_t *x, int16_t *y, int deadzone) {
+    if (deadzone <= 0) return;
+    double fx = *x;
+    double fy = *y;
+    double mag = sqrt(fx * fx + fy * fy);
+    if (mag <= (double)deadzone) {
+        *x = 0;
+        *y = 0;
+        return;
+    }
+    double scaled = (mag - deadzone) / (32767.0 - deadzone) * 32767.0;
+    double k = scaled / mag;
+    *x = clampAxis(fx * k);
+    *y = clampAxis(fy * k);
+}
+
+/**
+ * 解析器状态 → 发送给主机的状态（Y 轴取反为向上为正，与 GamepadManager 一致）
+ */
+static void toHostState(const NapiGamepadState *in, NapiGamepadState *out, int deadzone) {
+    *out = *in;
+    out->leftStickY = clampAxis(-(double)in->leftStickY);
+    out->rightStickY = clampAxis(-(double)in->rightStickY);
+    applyRadialDeadzone(&out->leftStickX, &out->leftStickY, deadzone);
+    applyRadialDeadzone(&out->rightStickX, &out->rightStickY, deadzone);
+}
+
+static bool sameState(const NapiGamepadState *a, const NapiGamepadState *b) {
+    return a->buttons == b->buttons &&
+           a->leftStickX == b->leftStickX && a->leftStickY == b->leftStickY &&
+           a->rightStickX == b->rightStickX && a->rightStickY == b->rightStickY &&
+           a->leftTrigger == b->leftTrigger && a->rightTrigger == b->rightTrigger;
+}
+
+static void maybeSnapshotLocked(int slotIndex, InputRouteSlot *slot, uint64_t now) {
+    if (!slot->snapshotPending || !g_snapshotTsfn) return;
+    if (slot->lastSnapshotNs != 0 &&
+        now - slot->lastSnapshotNs < g_snapshotIntervalNs.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    InputSnapshotData *data = new InputSnapshotData();
+    data->slot = slotIndex;
+    data->state = slot->sent;
+    if (napi_call_threadsafe_function(g_snapshotTsfn, data, napi_tsfn_nonblocking) != napi_ok) {
+        delete data;
+        return;
+    }
+    slot->snapshotPending = false;
+    slot->lastSnapshotNs = now;
+    g_snapshots.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void sendArrivalLocked(int slotIndex, InputRouteSlot *slot, uint64_t now) {
+    if (slot->arrived) return;
+    if (slot->lastArrivalAttemptNs != 0 && now - slot->lastArrivalAttemptNs < ARRIVAL_RETRY_NS) return;
+    slot->lastArrivalAttemptNs = now;
+
+    int ret = LiSendControllerArrivalEvent(
+        (char)slotIndex,
+        MoonBridge_MergeGamepadMask((short)(1 << slotIndex)),
+        (char)slot->controllerType,
+        (int)slot->supportedButtons,
+        (short)slot->capabilities
+    );
+    if (ret >= 0) {
+        slot->arrived = true;
+        g_arrivals.fetch_add(1, std::memory_order_relaxed);
+        OH_LOG_INFO(LOG_APP, "[%{public}s] slot=%{public}d arrival: type=%{public}d caps=0x%{public}x",
+                    LOG_TAG, slotIndex, slot->controllerType, slot->capabilities);
+    } else {
+        OH_LOG_WARN(LOG_APP, "[%{public}s] slot=%{public}d arrival 失败: %{public}d", LOG_TAG, slotIndex, ret);
+    }
+}
+
+static int findSlotLocked(int pollerId) {
+    for (int i = 0; i < ROUTER_MAX_SLOTS; i++) {
+        if (g_slots[i].bound && g_slots[i].pollerId == pollerId) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void unbindSlotLocked(int slotIndex) {
+    if (!g_slots[slotIndex].bound) return;
+    g_slots[slotIndex].bound = false;
+    g_boundCount.fetch_sub(1, std::memory_order_relaxed);
+    g_externalMask.fetch_and(~(1u << slotIndex), std::memory_order_relaxed);
+}
+
+/**
+ * 解析后的状态 → 死区 → 到达事件 → 去重发送 → 快照
+ * 去重比较物理状态：体感助手偏移的变化由传感器线程自行发送，
+ * 叠加与发送在 DeviceMotion_SendControllerState 内同一把锁下完成
+ */
+static void routeStateLocked(int slotIndex, InputRouteSlot *slot, uint64_t rxNs) {
+    NapiGamepadState phys;
+    toHostState(&slot->parsed, &phys, slot->deadzone);
+
+    uint64_t now = monotonicNs();
+    sendArrivalLocked(slotIndex, slot, now);
+
+    if (slot->sentValid && sameState(&phys, &slot->sentPhys)) {
+        g_deduped.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        NapiGamepadState out = phys;
+        int ret = DeviceMotion_SendControllerState(
+            (short)slotIndex,
+            MoonBridge_MergeGamepadMask((short)(1 << slotIndex)),
+            (int)out.buttons,
+            out.leftTrigger,
+            out.rightTrigger,
+            out.leftStickX,
+            out.leftStickY,
+            &out.rightStickX,
+            &out.rightStickY
+        );
+        if (ret < 0) {
+            g_sendFailed.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            slot->sent = out;
+            slot->sentPhys = phys;
+            slot->sentValid = true;
+            slot->snapshotPending = true;
+            g_eventsSent.fetch_add(1, std::memory_order_relaxed);
+
+            if (rxNs != 0) {
+                uint64_t doneNs = monotonicNs();
+                uint64_t ns = doneNs > rxNs ? doneNs - rxNs : 0;
+                g_latencySamples.fetch_add(1, std::memory_order_relaxed);
+                g_latencyTotalNs.fetch_add(ns, std::memory_order_relaxed);
+                g_latencyHist.Record((uint32_t)(ns / 1000ULL), LATENCY_BUCKET_US);
+            }
+        }
+    }
+
+    maybeSnapshotLocked(slotIndex, slot, now);
+}
+
+static void resetSessionStateLocked() {
+    for (int i = 0; i < ROUTER_MAX_SLOTS; i++) {
+        g_slots[i].arrived = false;
+        g_slots[i].lastArrivalAttemptNs = 0;
+        g_slots[i].sentValid = false;
+    }
+}
+
+// ============================================================
+// Native 接口
+// ============================================================
+
+int ControllerInputRouter_OnReport(int pollerId, const uint8_t *data, uint32_t len, uint64_t rxNs) {
+    if (g_boundCount.load(std::memory_order_relaxed) == 0 ||
+        !g_enabled.load(std::memory_order_relaxed) ||
+        !g_connected.load(std::memory_order_relaxed)) {
+        return INPUT_ROUTE_FORWARD;
+    }
+
+    std::lock_guard<std::mutex> lock(g_routerMutex);
+    int slotIndex = findSlotLocked(pollerId);
+    if (slotIndex < 0) {
+        return INPUT_ROUTE_FORWARD;
+    }
+    InputRouteSlot *slot = &g_slots[slotIndex];
+
+    int parsed = GamepadNapi_ParseReport(slot->parserType, slot->vendorId, slot->productId,
+                                         data, len, &slot->parsed);
+    if (parsed == GAMEPAD_REPORT_IGNORED) {
+        // 非输入报告（心跳 / 状态 / 应答等）：输入已由 native 接管，交给驱动做协议处理
+        g_reportsForwarded.fetch_add(1, std::memory_order_relaxed);
+        return INPUT_ROUTE_FORWARD_ROUTED;
+    }
+    g_reportsParsed.fetch_add(1, std::memory_order_relaxed);
+
+    routeStateLocked(slotIndex, slot, rxNs);
+
+    if (parsed == GAMEPAD_REPORT_PARTIAL) {
+        // 例如 Xbox One 0x07 模式报告：Guide 键已发送，ACK 仍由 ArkTS 驱动回复
+        g_reportsForwarded.fetch_add(1, std::memory_order_relaxed);
+        return INPUT_ROUTE_FORWARD_ROUTED;
+    }
+    return INPUT_ROUTE_CONSUMED;
+}
+
+void ControllerInputRouter_OnIdle(int pollerId) {
+    if (g_boundCount.load(std::memory_order_relaxed) == 0) return;
+
+    std::lock_guard<std::mutex> lock(g_routerMutex);
+    int slotIndex = findSlotLocked(pollerId);
+    if (slotIndex >= 0 && g_slots[slotIndex].snapshotPending) {
+        maybeSnapshotLocked(slotIndex, &g_slots[slotIndex], monotonicNs());
+    }
+}
+
+bool ControllerInputRouter_AcceptsState(int slot) {
+    if (slot < 0 || slot >= ROUTER_MAX_SLOTS) return false;
+    return (g_externalMask.load(std::memory_order_relaxed) & (1u << slot)) != 0 &&
+           g_enabled.load(std::memory_order_relaxed) &&
+           g_connected.load(std::memory_order_relaxed);
+}
+
+bool ControllerInputRouter_OnState(int slot, const NapiGamepadState *state, uint64_t rxNs) {
+    if (!state || !ControllerInputRouter_AcceptsState(slot)) return false;
+
+    std::lock_guard<std::mutex> lock(g_routerMutex);
+    InputRouteSlot *s = &g_slots[slot];
+    if (!s->bound || s->pollerId != INPUT_ROUTER_EXTERNAL_SOURCE) return false;
+
+    s->parsed = *state;
+    g_reportsParsed.fetch_add(1, std::memory_order_relaxed);
+    routeStateLocked(slot, s, rxNs);
+    return true;
+}
+
+void ControllerInputRouter_OnSlotIdle(int slot) {
+    if (slot < 0 || slot >= ROUTER_MAX_SLOTS) return;
+
+    std::lock_guard<std::mutex> lock(g_routerMutex);
+    if (g_slots[slot].bound && g_slots[slot].snapshotPending) {
+        maybeSnapshotLocked(slot, &g_slots[slot], monotonicNs());
+    }
+}
+
+void ControllerInputRouter_OnPollerStopped(int pollerId) {
+    if (pollerId < 0) return;
+
+    std::lock_guard<std::mutex> lock(g_routerMutex);
+    for (int i = 0; i < ROUTER_MAX_SLOTS; i++) {
+        if (g_slots[i].bound && g_slots[i].pollerId == pollerId) {
+            OH_LOG_INFO(LOG_APP, "[%{public}s] slot=%{public}d poller=%{public}d 已停止，解除绑定",
+                        LOG_TAG, i, pollerId);
+            unbindSlotLocked(i);
+        }
+    }
+}
+
+void ControllerInputRouter_OnConnectionStarted() {
+    {
+        std::lock_guard<std::mutex> lock(g_routerMutex);
+        resetSessionStateLocked();
+    }
+    g_latencySamples.store(0, std::memory_order_relaxed);
+    g_latencyTotalNs.store(0, std::memory_order_relaxed);
+    g_latencyHist.Reset();
+    g_connected.store(true, std::memory_order_release);
+}
+
+void ControllerInputRouter_OnConnectionStopped() {
+    g_connected.store(false, std::memory_order_release);
+    std::lock_guard<std::mutex> lock(g_routerMutex);
+    resetSessionStateLocked();
+}
+
+void ControllerInputRouter_GetStats(ControllerInputRouterStats *out) {
+    if (!out) return;
+    memset(out, 0, sizeof(*out));
+
+    out->enabled = g_enabled.load(std::memory_order_relaxed);
+    out->connected = g_connected.load(std::memory_order_relaxed);
+    out->boundControllers = (uint32_t)g_boundCount.load(std::memory_order_relaxed);
+    out->reportsParsed = g_reportsParsed.load(std::memory_order_relaxed);
+    out->reportsForwarded = g_reportsForwarded.load(std::memory_order_relaxed);
+    out->eventsSent = g_eventsSent.load(std::memory_order_relaxed);
+    out->sendFailed = g_sendFailed.load(std::memory_order_relaxed);
+    out->deduped = g_deduped.load(std::memory_order_relaxed);
+    out->arrivals = g_arrivals.load(std::memory_order_relaxed);
+    out->snapshots = g_snapshots.load(std::memory_order_relaxed);
+    out->latencySamples = g_latencySamples.load(std::memory_order_relaxed);
+    out->avgLatencyUs = out->latencySamples > 0
+        ? (double)g_latencyTotalNs.load(std::memory_order_relaxed) / out->latencySamples / 1000.0 : 0.0;
+    out->p50LatencyUs = g_latencyHist.Percentile(0.50, LATENCY_BUCKET_US);
+    out->p99LatencyUs = g_latencyHist.Percentile(0.99, LATENCY_BUCKET_US);
+    out->maxLatencyUs = g_latencyHist.Max();
+}
+
+// ============================================================
+// 快照回调 (JS 线程执行)
+// ============================================================
+
+static void snapshotCallbackOnJs(napi_env env, napi_value js_callback, void *context, void *rawData) {
+    InputSnapshotData *data = (InputSnapshotData *)rawData;
+    if (!env || !js_callback || !data) {
+        delete data;
+        return;
+    }
+
+    napi_value argv[8];
+    napi_create_int32(env, data->slot, &argv[0]);
+    napi_create_int32(env, (int32_t)data->state.buttons, &argv[1]);
+    napi_create_int32(env, data->state.leftStickX, &argv[2]);
+    napi_create_int32(env, data->state.leftStickY, &argv[3]);
+    napi_create_int32(env, data->state.rightStickX, &argv[4]);
+    napi_create_int32(env, data->state.rightStickY, &argv[5]);
+    napi_create_int32(env, data->state.leftTrigger, &argv[6]);
+    napi_create_int32(env, data->state.rightTrigger, &argv[7]);
+
+    napi_value undefined;
+    napi_get_undefined(env, &undefined);
+    napi_call_function(env, undefined, js_callback, 8, argv, nullptr);
+
+    delete data;
+}
+
+// ============================================================
+// NAPI: bindController(slot, pollerId, parserType, vendorId, productId,
+//                      controllerType, supportedButtons, capabilities, deadzonePercent?)
+// ============================================================
+
+static napi_value InputRouterNapi_BindController(napi_env env, napi_callback_info info) {
+    size_t argc = 9;
+    napi_value args[9];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    napi_value result;
+    napi_get_boolean(env, false, &result);
+    if (argc < 8) {
+        return result;
+    }
+
+    int32_t slotIndex = -1, pollerId = -1, parserType = 0;
+    uint32_t vendorId = 0, productId = 0;
+    int32_t controllerType = 0, supportedButtons = 0, capabilities = 0, deadzonePercent = 0;
+    napi_get_value_int32(env, args[0], &slotIndex);
+    napi_get_value_int32(env, args[1], &pollerId);
+    napi_get_value_int32(env, args[2], &parserType);
+    napi_get_value_uint32(env, args[3], &vendorId);
+    napi_get_value_uint32(env, args[4], &productId);
+    napi_get_value_int32(env, args[5], &controllerType);
+    napi_get_value_int32(env, args[6], &supportedButtons);
+    napi_get_value_int32(env, args[7], &capabilities);
+    if (argc >= 9) napi_get_value_int32(env, args[8], &deadzonePercent);
+    if (deadzonePercent < 0) deadzonePercent = 0;
+    if (deadzonePercent > 50) deadzonePercent = 50;
+
+    if (slotIndex < 0 || slotIndex >= ROUTER_MAX_SLOTS || pollerId < INPUT_ROUTER_EXTERNAL_SOURCE) {
+        OH_LOG_WARN(LOG_APP, "[%{public}s] bindController: 参数无效 slot=%{public}d poller=%{public}d",
+                    LOG_TAG, slotIndex, pollerId);
+        return result;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(g_routerMutex);
+        // 同一轮询器只能绑定一个槽位
+        for (int i = 0; pollerId >= 0 && i < ROUTER_MAX_SLOTS; i++) {
+            if (i != slotIndex && g_slots[i].bound && g_slots[i].pollerId == pollerId) {
+                unbindSlotLocked(i);
+            }
+        }
+        InputRouteSlot *slot = &g_slots[slotIndex];
+        unbindSlotLocked(slotIndex);
+        g_boundCount.fetch_add(1, std::memory_order_relaxed);
+        memset(slot, 0, sizeof(*slot));
+        slot->bound = true;
+        slot->pollerId = pollerId;
+        slot->parserType = parserType;
+        slot->vendorId = (uint16_t)vendorId;
+        slot->productId = (uint16_t)productId;
+        slot->controllerType = (uint8_t)controllerType;
+        slot->supportedButtons = (uint32_t)supportedButtons;
+        slot->capabilities = (uint16_t)capabilities;
+        slot->deadzone = deadzonePercent * 32767 / 100;
+        if (pollerId == INPUT_ROUTER_EXTERNAL_SOURCE) {
+            g_externalMask.fetch_or(1u << slotIndex, std::memory_order_relaxed);
+        }
+    }
+
+    OH_LOG_INFO(LOG_APP, "[%{public}s] slot=%{public}d 绑定 DDK poller=%{public}d parser=%{public}d "
+                "VID=0x%{public}04x PID=0x%{public}04x deadzone=%{public}d%%",
+                LOG_TAG, slotIndex, pollerId, parserType, vendorId, productId, deadzonePercent);
+    napi_get_boolean(env, true, &result);
+    return result;
+}
+
+// ============================================================
+// NAPI: unbindController(slot)
+// ============================================================
+
+static napi_value InputRouterNapi_UnbindController(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    int32_t slotIndex = -1;
+    if (argc >= 1) napi_get_value_int32(env, args[0], &slotIndex);
+
+    if (slotIndex >= 0 && slotIndex < ROUTER_MAX_SLOTS) {
+        std::lock_guard<std::mutex> lock(g_routerMutex);
+        if (g_slots[slotIndex].bound) {
+            OH_LOG_INFO(LOG_APP, "[%{public}s] slot=%{public}d 解除绑定", LOG_TAG, slotIndex);
+            unbindSlotLocked(slotIndex);
+        }
+    }
+
+    napi_value undefined;
+    napi_get_undefined(env, &undefined);
+    return undefined;
+}
+
+// ============================================================
+// NAPI: setConfig(enabled, snapshotIntervalMs)
+// ============================================================
+
+static napi_value InputRouterNapi_SetConfig(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    bool enabled = false;
+    int32_t snapshotIntervalMs = DEFAULT_SNAPSHOT_INTERVAL_MS;
+    if (argc >= 1) napi_get_value_bool(env, args[0], &enabled);
+    if (argc >= 2) napi_get_value_int32(env, args[1], &snapshotIntervalMs);
+    if (snapshotIntervalMs < 16) snapshotIntervalMs = 16;
+
+    g_enabled.store(enabled, std::memory_order_relaxed);
+    g_snapshotIntervalNs.store((uint64_t)snapshotIntervalMs * 1000000ULL, std::memory_order_relaxed);
+
+    OH_LOG_INFO(LOG_APP, "[%{public}s] setConfig: enabled=%{public}d snapshot=%{public}dms",
+                LOG_TAG, enabled ? 1 : 0, snapshotIntervalMs);
+
+    napi_value undefined;
+    napi_get_undefined(env, &undefined);
+    return undefined;
+}
+
+// ============================================================
+// NAPI: setSnapshotCallback(callback | null)
+// ============================================================
+
+static napi_value InputRouterNapi_SetSnapshotCallback(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    napi_threadsafe_function tsfn = nullptr;
+    napi_valuetype type = napi_undefined;
+    if (argc >= 1) napi_typeof(env, args[0], &type);
+    if (type == napi_function) {
+        napi_value resName;
+        napi_create_string_utf8(env, "InputRouterSnapshot", NAPI_AUTO_LENGTH, &resName);
+        if (napi_create_threadsafe_function(env, args[0], nullptr, resName,
+                                            8, 1, nullptr, nullptr, nullptr,
+                                            snapshotCallbackOnJs, &tsfn) != napi_ok) {
+            OH_LOG_ERROR(LOG_APP, "[%{public}s] 创建快照 tsfn 失败", LOG_TAG);
+            tsfn = nullptr;
+        }
+    }
+
+    napi_threadsafe_function old;
+    {
+        std::lock_guard<std::mutex> lock(g_routerMutex);
+        old = g_snapshotTsfn;
+        g_snapshotTsfn = tsfn;
+    }
+    if (old) {
+        napi_release_threadsafe_function(old, napi_tsfn_release);
+    }
+
+    napi_value undefined;
+    napi_get_undefined(env, &undefined);
+    return undefined;
+}
+
+// ============================================================
+// NAPI: getStats() → ControllerInputRouterStats
+// ============================================================
+
+static napi_value InputRouterNapi_GetStats(napi_env env, napi_callback_info info) {
+    ControllerInputRouterStats stats;
+    ControllerInputRouter_GetStats(&stats);
+
+    napi_value result;
+    napi_create_object(env, &result);
+
+    napi_value val;
+    napi_get_boolean(env, stats.enabled, &val);
+    napi_set_named_property(env, result, "enabled", val);
+    napi_get_boolean(env, stats.connected, &val);
+    napi_set_named_property(env, result, "connected", val);
+    napi_create_uint32(env, stats.boundControllers, &val);
+    napi_set_named_property(env, result, "boundControllers", val);
+    napi_create_int64(env, (int64_t)stats.reportsParsed, &val);
+    napi_set_named_property(env, result, "reportsParsed", val);
+    napi_create_int64(env, (int64_t)stats.reportsForwarded, &val);
+    napi_set_named_property(env, result, "reportsForwarded", val);
+    napi_create_int64(env, (int64_t)stats.eventsSent, &val);
+    napi_set_named_property(env, result, "eventsSent", val);
+    napi_create_int64(env, (int64_t)stats.sendFailed, &val);
+    napi_set_named_property(env, result, "sendFailed", val);
+    napi_create_int64(env, (int64_t)stats.deduped, &val);
+    napi_set_named_property(env, result, "deduped", val);
+    napi_create_int64(env, (int64_t)stats.arrivals, &val);
+    napi_set_named_property(env, result, "arrivals", val);
+    napi_create_int64(env, (int64_t)stats.snapshots, &val);
+    napi_set_named_property(env, result, "snapshots", val);
+    napi_create_int64(env, (int64_t)stats.latencySamples, &val);
+    napi_set_named_property(env, result, "latencySamples", val);
+    napi_create_double(env, stats.avgLatencyUs, &val);
+    napi_set_named_property(env, result, "avgLatencyUs", val);
+    napi_create_uint32(env, stats.p50LatencyUs, &val);
+    napi_set_named_property(env, result, "p50LatencyUs", val);
+    napi_create_uint32(env, stats.p99LatencyUs, &val);
+    napi_set_named_property(env, result, "p99LatencyUs", val);
+    napi_create_uint32(env, stats.maxLatencyUs, &val);
+    napi_set_named_property(env, result, "maxLatencyUs", val);
+
+    return result;
+}
+
+// ============================================================
+// NAPI 注册
+// ============================================================
+
+void ControllerInputRouter_Init(napi_env env, napi_value exports) {
+    napi_value obj;
+    napi_create_object(env, &obj);
+
+    napi_property_descriptor methods[] = {
+        { "bindController",      nullptr, InputRouterNapi_BindController,      nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "unbindController",    nullptr, InputRouterNapi_UnbindController,    nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setConfig",           nullptr, InputRouterNapi_SetConfig,           nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setSnapshotCallback", nullptr, InputRouterNapi_SetSnapshotCallback, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "getStats",            nullptr, InputRouterNapi_GetStats,            nullptr, nullptr, nullptr, napi_default, nullptr },
+    };
+
+    napi_define_properties(env, obj, sizeof(methods) / sizeof(methods[0]), methods);
+    napi_set_named_property(env, exports, "ControllerInputRouter", obj);
+
+    OH_LOG_INFO(LOG_APP, "[%{public}s] ControllerInputRouter NAPI 已注册", LOG_TAG);
+}
@@ -0,0 +1,146 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file controller_input_router.h
+ * @brief Native 手柄输入路由：DDK 轮询线程 → HID 解析 → LiSendMultiControllerEvent
+ *
+ * 原路径（每帧报告）：
+ *   DDK 轮询线程 → malloc + tsfn → ArkTS 驱动 handleRead → GamepadManager
+ *   → StreamingSession.sendGamepadState → sendMultiControllerInput (NAPI)
+ * 1000Hz 手柄下每帧都要排队等待 JS 事件循环，UI 繁忙时输入延迟明显抖动。
+ *
+ * 新路径（已绑定且串流已连接的手柄）：
+ *   DDK 轮询线程 → GamepadNapi_ParseReport（原地解析）→ 死区 → LiSendMultiControllerEvent
+ * ArkTS 只收到节流后的状态快照（UI 显示），以及仍需 JS 处理的非输入报告
+ * （如 Xbox One 0x07 模式报告需要 ArkTS 驱动回 ACK），这类报告带 routed 标记，
+ * 驱动只处理协议逻辑、不再上报输入。
+ *
+ * 到达事件：native 在首次发送前自行发送 LiSendControllerArrivalEvent，
+ * activeGamepadMask 与 ArkTS 路径通过 MoonBridge_MergeGamepadMask 合并。
+ *
+ * 延迟统计：IN 传输完成 → LiSendMultiControllerEvent 返回（输入包已进入发送队列）。
+ * 启用输入合并（input_scheduler）时为状态交给调度器的时间，合并等待计入调度器自身的统计。
+ *
+ * 外部来源：Game Controller Kit 手柄不经 DDK 轮询，由 game_controller_native 合并一批轴 / 按键回调后
+ * 以完整状态调用 OnState；绑定时 pollerId 传 INPUT_ROUTER_EXTERNAL_SOURCE。
+ * 外部来源不叠加径向死区，与这类手柄原先经 ArkTS 发送时的行为一致。
+ *
+ * 线程模型：Bind/Unbind/SetConfig 在 JS 线程，OnReport/OnIdle 在各 DDK 轮询线程，
+ * 连接开始/停止在 moonlight-common-c 回调线程与 JS 线程；共享状态由单个互斥锁保护。
+ * 未绑定任何手柄时 OnReport 只读一个原子计数即返回。
+ */
+
+#ifndef CONTROLLER_INPUT_ROUTER_H
+#define CONTROLLER_INPUT_ROUTER_H
+
+#include <napi/native_api.h>
+#include <stdint.h>
+
+#include "gamepad_napi.h"
+
+// bindController 的 pollerId：状态由 ControllerInputRouter_OnState 提交而非 DDK 报告
+#define INPUT_ROUTER_EXTERNAL_SOURCE (-1)
+
+/**
+ * OnReport 返回值：轮询线程据此决定是否把报告转发给 ArkTS
+ */
+enum InputRouteResult {
+    INPUT_ROUTE_FORWARD = 0,        // 未由 native 处理，照常转发
+    INPUT_ROUTE_CONSUMED = 1,       // 已由 native 发送，不再转发
+    INPUT_ROUTE_FORWARD_ROUTED = 2  // 输入已由 native 接管，转发给 ArkTS 仅做协议处理
+};
+
+/**
+ * 路由统计
+ */
+struct ControllerInputRouterStats {
+    bool enabled;
+    bool connected;
+    uint32_t boundControllers;   // 已绑定 native 输入的手柄数
+    uint64_t reportsParsed;      // 解析出输入的报告数
+    uint64_t reportsForwarded;   // 带 routed 标记转发给 ArkTS 的报告数
+    uint64_t eventsSent;         // LiSendMultiControllerEvent 调用次数
+    uint64_t sendFailed;         // 发送返回错误
+    uint64_t deduped;            // 处理后状态未变化而跳过
+    uint64_t arrivals;           // native 发送的到达事件数
+    uint64_t snapshots;          // 投递给 ArkTS 的状态快照数
+    uint64_t latencySamples;
+    double avgLatencyUs;         // IN 传输完成 → 发送入队 平均耗时
+    uint32_t p50LatencyUs;
+    uint32_t p99LatencyUs;
+    uint32_t maxLatencyUs;
+};
+
+/**
+ * 初始化 ControllerInputRouter NAPI 模块。
+ *
+ * 注册到 exports.ControllerInputRouter 命名空间：
+ *   - bindController(slot, pollerId, parserType, vendorId, productId,
+ *                    controllerType, supportedButtons, capabilities, deadzonePercent?): boolean
+ *       pollerId = -1 为外部来源（parserType 忽略）
+ *       deadzonePercent 为该设备的摇杆径向死区 (0-50)，默认 0 与 ArkTS 路径一致
+ *   - unbindController(slot): void
+ *   - setConfig(enabled, snapshotIntervalMs): void
+ *   - setSnapshotCallback(callback | null): void
+ *       callback(slot, buttons, leftStickX, leftStickY, rightStickX, rightStickY, leftTrigger, rightTrigger)
+ *       数值与发送给主机的一致（已应用死区，Y 轴向上为正）
+ *   - getStats(): obj
+ */
+void ControllerInputRouter_Init(napi_env env, napi_value exports);
+
+/**
+ * 一帧 IN 报告（DDK 轮询线程调用，已去重）
+ * @param rxNs IN 传输完成时间 (CLOCK_MONOTONIC ns)
+ * @return InputRouteResult
+ */
+int ControllerInputRouter_OnReport(int pollerId, const uint8_t *data, uint32_t len, uint64_t rxNs);
+
+/**
+ * 轮询线程空闲（超时 / 重复报告）时调用：补发节流期间积压的最后一次快照
+ */
+void ControllerInputRouter_OnIdle(int pollerId);
+
+/**
+ * 外部来源槽位当前是否由 native 发送（已绑定、已启用且串流已连接）
+ * 无锁，可在任意线程调用；返回 false 时调用方应照常把事件交给 ArkTS
+ */
+bool ControllerInputRouter_AcceptsState(int slot);
+
+/**
+ * 提交外部来源的完整状态（摇杆 Y 轴为 HID 方向，向下为正，与解析器一致）
+ * @param rxNs 本批第一个输入事件的时间 (CLOCK_MONOTONIC ns)，用于延迟统计
+ * @return 已由 native 处理返回 true
+ */
+bool ControllerInputRouter_OnState(int slot, const NapiGamepadState *state, uint64_t rxNs);
+
+/**
+ * 外部来源空闲时调用：补发节流期间积压的最后一次快照
+ */
+void ControllerInputRouter_OnSlotIdle(int slot);
+
+/**
+ * 轮询器停止：解除绑定到该轮询器的槽位（pollerId 之后可能被其他手柄复用）
+ */
+void ControllerInputRouter_OnPollerStopped(int pollerId);
+
+/**
+ * 串流连接建立（BridgeClConnectionStarted）：开始接管已绑定手柄
+ */
+void ControllerInputRouter_OnConnectionStarted();
+
+/**
+ * 串流连接停止 / 终止：停止接管，清除到达状态
+ */
+void ControllerInputRouter_OnConnectionStopped();
+
+void ControllerInputRouter_GetStats(ControllerInputRouterStats *out);
+
+#endif // CONTROLLER_INPUT_ROUTER_H
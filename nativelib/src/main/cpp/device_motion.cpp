@@ -0,0 +1,768 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file device_motion.cpp
+ * @brief Native 设备体感实现
+ */
+
+#include "device_motion.h"
+#include "input_scheduler.h"
+#include "latency_histogram.h"
+
+#include <math.h>
+#include <string.h>
+#include <time.h>
+#include <atomic>
+#include <mutex>
+#include <hilog/log.h>
+#include <sensors/oh_sensor.h>
+
+#include "moonlight-common-c/src/Limelight.h"
+
+#define LOG_TAG "DeviceMotion"
+
+static const double RAD_TO_DEG = 57.2957795;
+static const int STICK_MAX = 0x7FFE;                    // 与 GyroAssistService 一致
+static const int PHYS_EPSILON = 512;                    // 物理右摇杆去噪阈值
+static const int TRIGGER_ACTIVATE_THRESHOLD = 51;       // 扳机激活阈值 (255 * 20%)
+static const uint32_t ASSIST_RATE_HZ = 200;             // 体感助手所需的陀螺仪频率
+static const uint32_t MAX_RATE_HZ = 1000;
+static const uint64_t MAX_SAMPLE_AGE_NS = 1000000000ULL;
+
+// One Euro 滤波参数（输入为 deg/s）
+static const double FILTER_MIN_CUTOFF_HZ = 3.0;
+static const double FILTER_BETA = 0.05;
+static const double FILTER_DERIVATIVE_CUTOFF_HZ = 1.0;
+
+// 延迟直方图：10µs 桶，覆盖 0-20ms
+static const uint32_t LATENCY_BUCKET_US = 10;
+
+/**
+ * One Euro 滤波器：低速时强平滑抑制手抖，速度升高时截止频率随之升高以减少拖影
+ */
+struct OneEuroFilter {
+    bool initialized;
+    double prevValue;
+    double prevDerivative;
+    uint64_t prevNs;
+
+    static double Alpha(double cutoffHz, double dt) {
+        double tau = 1.0 / (2.0 * M_PI * cutoffHz);
+        return 1.0 / (1.0 + tau / dt);
+    }
+
+    void Reset() { initialized = false; }
+
+    double Filter(double value, uint64_t ns) {
+        if (!initialized) {
+            initialized = true;
+            prevValue = value;
+            prevDerivative = 0.0;
+            prevNs = ns;
+            return value;
+        }
+        double dt = ns > prevNs ? (double)(ns - prevNs) / 1e9 : 1.0 / ASSIST_RATE_HZ;
+        prevNs = ns;
+
+        double derivative = (value - prevValue) / dt;
+        double aD = Alpha(FILTER_DERIVATIVE_CUTOFF_HZ, dt);
+        prevDerivative = aD * derivative + (1.0 - aD) * prevDerivative;
+
+        double cutoff = FILTER_MIN_CUTOFF_HZ + FILTER_BETA * fabs(prevDerivative);
+        double a = Alpha(cutoff, dt);
+        prevValue = a * value + (1.0 - a) * prevValue;
+        return prevValue;
+    }
+};
+
+/**
+ * 单个传感器订阅
+ */
+struct SensorSubscription {
+    Sensor_SubscriptionId *id;
+    Sensor_SubscriptionAttribute *attr;
+    Sensor_Subscriber *subscriber;
+    uint32_t hz;
+};
+
+/**
+ * 体感助手叠加用的物理手柄状态（右摇杆为未叠加的原始值）
+ */
+struct PhysicalPadState {
+    bool valid;
+    bool dirty;                 // 上次助手发送后物理状态有变化
+    short controllerNumber;
+    short activeGamepadMask;
+    int buttonFlags;
+    unsigned char leftTrigger, rightTrigger;
+    short leftStickX, leftStickY, rightStickX, rightStickY;
+};
+
+// 订阅（g_subscribeMutex 保护；传感器回调不持有此锁）
+static std::mutex g_subscribeMutex;
+static SensorSubscription g_gyroSub;
+static SensorSubscription g_accelSub;
+
+// 直通配置
+static std::atomic<bool> g_passthroughEnabled{false};
+static std::atomic<int> g_passthroughController{0};
+static std::atomic<uint32_t> g_gyroRequestedHz{0};
+static std::atomic<uint32_t> g_accelRequestedHz{0};
+static std::atomic<uint32_t> g_gyroSubscribedHz{0};
+static std::atomic<uint32_t> g_accelSubscribedHz{0};
+static std::atomic<int> g_rotation{0};
+
+// 体感助手（g_motionMutex 保护，g_assistEnabled 供无锁快速判断）
+static std::mutex g_motionMutex;
+static std::atomic<bool> g_assistEnabled{false};
+static double g_sensitivity = 2.0;
+static bool g_invertX = false;
+static bool g_invertY = false;
+static int g_activationKey = DEVICE_MOTION_ACTIVATION_ALWAYS;
+static bool g_holdActive = false;
+static int g_gyroStickX = 0;
+static int g_gyroStickY = 0;
+static bool g_offsetApplied = false;      // 最近发送的右摇杆含陀螺仪偏移
+static short g_lastFusedX = 0;
+static short g_lastFusedY = 0;
+static PhysicalPadState g_phys;
+static OneEuroFilter g_yawFilter;
+static OneEuroFilter g_pitchFilter;
+
+// 去重与抽样（各传感器回调内使用）
+static float g_lastGyroRaw[3];
+static float g_lastAccelRaw[3];
+static uint64_t g_lastGyroSendNs = 0;
+static uint64_t g_lastAccelSendNs = 0;
+
+// 统计
+static std::atomic<uint64_t> g_statsStartNs{0};
+static std::atomic<uint64_t> g_gyroSamples{0};
+static std::atomic<uint64_t> g_accelSamples{0};
+static std::atomic<uint64_t> g_gyroEventsSent{0};
+static std::atomic<uint64_t> g_accelEventsSent{0};
+static std::atomic<uint64_t> g_assistStatesSent{0};
+static std::atomic<uint64_t> g_latencySamples{0};
+static std::atomic<uint64_t> g_latencyTotalNs{0};
+static LatencyHistogram<2000> g_latencyHist;
+
+// ============================================================
+// 工具
+// ============================================================
+
+static uint64_t clockNs(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t monotonicNs() {
+    return clockNs(CLOCK_MONOTONIC);
+}
+
+/**
+ * 传感器时间戳 (CLOCK_BOOTTIME) → CLOCK_MONOTONIC；时间戳不可用或不合理时退回回调到达时间
+ */
+static uint64_t sampleTimeNs(int64_t timestamp, uint64_t arrivalNs) {
+    if (timestamp <= 0) return arrivalNs;
+    uint64_t bootNow = clockNs(CLOCK_BOOTTIME);
+    uint64_t monoNow = monotonicNs();
+    uint64_t ts = (uint64_t)timestamp;
+    if (ts > bootNow || bootNow - ts > MAX_SAMPLE_AGE_NS) return arrivalNs;
+    uint64_t age = bootNow - ts;
+    return monoNow > age ? monoNow - age : arrivalNs;
+}
+
+static void recordLatency(uint64_t sampleNs) {
+    uint64_t now = monotonicNs();
+    uint64_t ns = now > sampleNs ? now - sampleNs : 0;
+    g_latencySamples.fetch_add(1, std::memory_order_relaxed);
+    g_latencyTotalNs.fetch_add(ns, std::memory_order_relaxed);
+    g_latencyHist.Record((uint32_t)(ns / 1000ULL), LATENCY_BUCKET_US);
+}
+
+static short clampShort(int v) {
+    if (v > 32767) return 32767;
+    if (v < -32767) return -32767;
+    return (short)v;
+}
+
+static int denoisePhys(int v) {
+    return (v <= PHYS_EPSILON && v >= -PHYS_EPSILON) ? 0 : v;
+}
+
+static double clampUnit(double v) {
+    if (v > 1.0) return 1.0;
+    if (v < -1.0) return -1.0;
+    return v;
+}
+
+/**
+ * 按屏幕旋转校正坐标轴（与 DeviceSensorService.correctOrientation 一致，
+ * HarmonyOS 顺时针 90° / 270° 分别对应 Android ROTATION_270 / ROTATION_90）
+ */
+static void correctOrientation(const float *raw, double scale, float *out) {
+    double rx = raw[0] * scale;
+    double ry = raw[1] * scale;
+    double rz = raw[2] * scale;
+    switch (g_rotation.load(std::memory_order_relaxed)) {
+        case 0:   out[0] = (float)rx;  out[1] = (float)rz; out[2] = (float)-ry; break;
+        case 90:  out[0] = (float)ry;  out[1] = (float)rz; out[2] = (float)rx;  break;
+        case 180: out[0] = (float)-rx; out[1] = (float)rz; out[2] = (float)ry;  break;
+        case 270: out[0] = (float)-ry; out[1] = (float)rz; out[2] = (float)-rx; break;
+        default:  out[0] = (float)rx;  out[1] = (float)ry; out[2] = (float)rz;  break;
+    }
+}
+
+/**
+ * 订阅频率高于主机请求（体感助手需要更高频率）时按请求间隔抽样
+ */
+static bool motionSendDue(uint64_t *lastNs, uint32_t requestedHz, uint32_t subscribedHz, uint64_t now) {
+    if (subscribedHz > requestedHz + requestedHz / 2) {
+        uint64_t interval = 1000000000ULL / requestedHz;
+        if (now - *lastNs < interval * 3 / 4) return false;
+    }
+    *lastNs = now;
+    return true;
+}
+
+// ============================================================
+// 体感助手 (调用方持有 g_motionMutex)
+// ============================================================
+
+static void updateActivationLocked(unsigned char leftTrigger, unsigned char rightTrigger) {
+    bool wasActive = g_holdActive;
+    if (g_activationKey == DEVICE_MOTION_ACTIVATION_LT) {
+        g_holdActive = leftTrigger >= TRIGGER_ACTIVATE_THRESHOLD;
+    } else if (g_activationKey == DEVICE_MOTION_ACTIVATION_RT) {
+        g_holdActive = rightTrigger >= TRIGGER_ACTIVATE_THRESHOLD;
+    } else {
+        g_holdActive = true;
+    }
+    if (wasActive && !g_holdActive) {
+        g_gyroStickX = 0;
+        g_gyroStickY = 0;
+    }
+}
+
+static void fuseLocked(short *rightStickX, short *rightStickY) {
+    if (g_holdActive) {
+        *rightStickX = clampShort(denoisePhys(*rightStickX) + g_gyroStickX);
+        *rightStickY = clampShort(denoisePhys(*rightStickY) + g_gyroStickY);
+    }
+    g_offsetApplied = g_holdActive && (g_gyroStickX != 0 || g_gyroStickY != 0);
+    g_lastFusedX = *rightStickX;
+    g_lastFusedY = *rightStickY;
+}
+
+/**
+ * 陀螺仪样本 → 摇杆偏移 → 与最近物理状态叠加后立即发送
+ * 发送在 g_motionMutex 内完成：物理手柄路径 (DeviceMotion_SendControllerState) 也在同一把锁内叠加并发送，
+ * 主机收到的状态顺序与叠加顺序一致，较旧的快照不会覆盖较新的物理状态
+ * @param gyro 方向校正后的角速度 (deg/s)
+ */
+static void handleAssistSample(const float *gyro, uint64_t sampleNs) {
+    {
+        std::lock_guard<std::mutex> lock(g_motionMutex);
+        if (!g_assistEnabled.load(std::memory_order_relaxed)) return;
+
+        // 偏航 (Z) → 右摇杆 X，俯仰 (X) → 右摇杆 Y（与 Android applyGyroToRightStick 一致）
+        double yaw = g_yawFilter.Filter(gyro[2], sampleNs);
+        double pitch = g_pitchFilter.Filter(gyro[0], sampleNs);
+        if (!g_holdActive) {
+            g_gyroStickX = 0;
+            g_gyroStickY = 0;
+            return;
+        }
+
+        double effectiveSensitivity = 180.0 / g_sensitivity;
+        double scaledX = -clampUnit(yaw / effectiveSensitivity);
+        double scaledY = clampUnit(pitch / effectiveSensitivity);
+        if (g_invertX) scaledX = -scaledX;
+        if (g_invertY) scaledY = -scaledY;
+        g_gyroStickX = (int)lrint(scaledX * STICK_MAX);
+        g_gyroStickY = (int)lrint(scaledY * STICK_MAX);
+
+        // 尚未收到物理手柄状态时没有可叠加的控制器
+        if (!g_phys.valid) return;
+
+        short prevX = g_lastFusedX;
+        short prevY = g_lastFusedY;
+        PhysicalPadState out = g_phys;
+        fuseLocked(&out.rightStickX, &out.rightStickY);
+        bool unchanged = !g_phys.dirty && out.rightStickX == prevX && out.rightStickY == prevY;
+        g_phys.dirty = false;
+        if (unchanged) return;
+
+        InputScheduler_SendControllerState(out.controllerNumber, out.activeGamepadMask, out.buttonFlags,
+                                           out.leftTrigger, out.rightTrigger,
+                                           out.leftStickX, out.leftStickY, out.rightStickX, out.rightStickY);
+    }
+    g_assistStatesSent.fetch_add(1, std::memory_order_relaxed);
+    recordLatency(sampleNs);
+}
+
+// ============================================================
+// 传感器回调（传感器服务线程）
+// ============================================================
+
+static void handleGyro(const float *raw, uint64_t sampleNs) {
+    g_gyroSamples.fetch_add(1, std::memory_order_relaxed);
+    if (raw[0] == g_lastGyroRaw[0] && raw[1] == g_lastGyroRaw[1] && raw[2] == g_lastGyroRaw[2]) return;
+    memcpy(g_lastGyroRaw, raw, sizeof(g_lastGyroRaw));
+
+    // 设备传感器为 rad/s，Moonlight 运动事件为 deg/s
+    float corrected[3];
+    correctOrientation(raw, RAD_TO_DEG, corrected);
+
+    uint32_t requested = g_gyroRequestedHz.load(std::memory_order_relaxed);
+    if (requested > 0 &&
+        motionSendDue(&g_lastGyroSendNs, requested, g_gyroSubscribedHz.load(std::memory_order_relaxed),
+                      monotonicNs())) {
+        LiSendControllerMotionEvent((uint8_t)g_passthroughController.load(std::memory_order_relaxed),
+                                    LI_MOTION_TYPE_GYRO, corrected[0], corrected[1], corrected[2]);
+        g_gyroEventsSent.fetch_add(1, std::memory_order_relaxed);
+        recordLatency(sampleNs);
+    }
+
+    if (g_assistEnabled.load(std::memory_order_relaxed)) {
+        handleAssistSample(corrected, sampleNs);
+    }
+}
+
+static void handleAccel(const float *raw, uint64_t sampleNs) {
+    g_accelSamples.fetch_add(1, std::memory_order_relaxed);
+    if (raw[0] == g_lastAccelRaw[0] && raw[1] == g_lastAccelRaw[1] && raw[2] == g_lastAccelRaw[2]) return;
+    memcpy(g_lastAccelRaw, raw, sizeof(g_lastAccelRaw));
+
+    uint32_t requested = g_accelRequestedHz.load(std::memory_order_relaxed);
+    if (requested == 0) return;
+    if (!motionSendDue(&g_lastAccelSendNs, requested, g_accelSubscribedHz.load(std::memory_order_relaxed),
+                       monotonicNs())) {
+        return;
+    }
+
+    // 加速度计单位已是 m/s²
+    float corrected[3];
+    correctOrientation(raw, 1.0, corrected);
+    LiSendControllerMotionEvent((uint8_t)g_passthroughController.load(std::memory_order_relaxed),
+                                LI_MOTION_TYPE_ACCEL, corrected[0], corrected[1], corrected[2]);
+    g_accelEventsSent.fetch_add(1, std::memory_order_relaxed);
+    recordLatency(sampleNs);
+}
+
+static void OnSensorEvent(Sensor_Event *event) {
+    uint64_t arrivalNs = monotonicNs();
+    Sensor_Type type;
+    float *data = nullptr;
+    uint32_t length = 0;
+    int64_t timestamp = 0;
+    if (OH_SensorEvent_GetType(event, &type) != SENSOR_SUCCESS ||
+        OH_SensorEvent_GetData(event, &data, &length) != SENSOR_SUCCESS ||
+        data == nullptr || length < 3) {
+        return;
+    }
+    OH_SensorEvent_GetTimestamp(event, &timestamp);
+    uint64_t sampleNs = sampleTimeNs(timestamp, arrivalNs);
+
+    if (type == SENSOR_TYPE_GYROSCOPE) {
+        handleGyro(data, sampleNs);
+    } else if (type == SENSOR_TYPE_ACCELEROMETER) {
+        handleAccel(data, sampleNs);
+    }
+}
+
+// ============================================================
+// 订阅管理 (调用方持有 g_subscribeMutex)
+// ============================================================
+
+static void unsubscribeLocked(SensorSubscription *sub) {
+    if (sub->id && sub->subscriber && sub->hz > 0) {
+        int32_t ret = OH_Sensor_Unsubscribe(sub->id, sub->subscriber);
+        if (ret != SENSOR_SUCCESS) {
+            OH_LOG_WARN(LOG_APP, "[%{public}s] 取消订阅失败: %{public}d", LOG_TAG, ret);
+        }
+    }
+    if (sub->id) OH_Sensor_DestroySubscriptionId(sub->id);
+    if (sub->attr) OH_Sensor_DestroySubscriptionAttribute(sub->attr);
+    if (sub->subscriber) OH_Sensor_DestroySubscriber(sub->subscriber);
+    memset(sub, 0, sizeof(*sub));
+}
+
+static bool subscribeLocked(SensorSubscription *sub, Sensor_Type type, uint32_t hz) {
+    unsubscribeLocked(sub);
+    if (hz == 0) return true;
+
+    sub->id = OH_Sensor_CreateSubscriptionId();
+    sub->attr = OH_Sensor_CreateSubscriptionAttribute();
+    sub->subscriber = OH_Sensor_CreateSubscriber();
+    if (!sub->id || !sub->attr || !sub->subscriber) {
+        OH_LOG_ERROR(LOG_APP, "[%{public}s] 创建订阅对象失败", LOG_TAG);
+        unsubscribeLocked(sub);
+        return false;
+    }
+
+    OH_SensorSubscriptionId_SetType(sub->id, type);
+    OH_SensorSubscriptionAttribute_SetSamplingInterval(sub->attr, (int64_t)(1000000000ULL / hz));
+    OH_SensorSubscriber_SetCallback(sub->subscriber, OnSensorEvent);
+
+    int32_t ret = OH_Sensor_Subscribe(sub->id, sub->attr, sub->subscriber);
+    if (ret != SENSOR_SUCCESS) {
+        OH_LOG_WARN(LOG_APP, "[%{public}s] 订阅传感器 %{public}d 失败: %{public}d", LOG_TAG, (int)type, ret);
+        unsubscribeLocked(sub);
+        return false;
+    }
+    sub->hz = hz;
+    OH_LOG_INFO(LOG_APP, "[%{public}s] 订阅传感器 %{public}d: %{public}uHz", LOG_TAG, (int)type, hz);
+    return true;
+}
+
+/**
+ * 按主机请求与体感助手需求调整订阅：陀螺仪取两者最大值，加速度计只服务于直通
+ */
+static void updateSubscriptions() {
+    std::lock_guard<std::mutex> lock(g_subscribeMutex);
+
+    uint32_t gyroHz = g_gyroRequestedHz.load(std::memory_order_relaxed);
+    if (g_assistEnabled.load(std::memory_order_relaxed) && gyroHz < ASSIST_RATE_HZ) {
+        gyroHz = ASSIST_RATE_HZ;
+    }
+    uint32_t accelHz = g_accelRequestedHz.load(std::memory_order_relaxed);
+    if (gyroHz > MAX_RATE_HZ) gyroHz = MAX_RATE_HZ;
+    if (accelHz > MAX_RATE_HZ) accelHz = MAX_RATE_HZ;
+
+    if (gyroHz != g_gyroSub.hz) {
+        subscribeLocked(&g_gyroSub, SENSOR_TYPE_GYROSCOPE, gyroHz);
+        g_gyroSubscribedHz.store(g_gyroSub.hz, std::memory_order_relaxed);
+    }
+    if (accelHz != g_accelSub.hz) {
+        subscribeLocked(&g_accelSub, SENSOR_TYPE_ACCELEROMETER, accelHz);
+        g_accelSubscribedHz.store(g_accelSub.hz, std::memory_order_relaxed);
+    }
+}
+
+// ============================================================
+// Native 接口
+// ============================================================
+
+bool DeviceMotion_OnSetMotionEventState(uint16_t controllerNumber, uint8_t motionType, uint16_t reportRateHz) {
+    if (!g_passthroughEnabled.load(std::memory_order_relaxed) ||
+        (int)controllerNumber != g_passthroughController.load(std::memory_order_relaxed)) {
+        return false;
+    }
+
+    if (motionType == LI_MOTION_TYPE_GYRO) {
+        g_gyroRequestedHz.store(reportRateHz, std::memory_order_relaxed);
+    } else if (motionType == LI_MOTION_TYPE_ACCEL) {
+        g_accelRequestedHz.store(reportRateHz, std::memory_order_relaxed);
+    } else {
+        return false;
+    }
+    updateSubscriptions();
+
+    if (motionType == LI_MOTION_TYPE_GYRO && reportRateHz == 0) {
+        // 归零，确保主机侧虚拟控制器静止
+        LiSendControllerMotionEvent((uint8_t)controllerNumber, LI_MOTION_TYPE_GYRO, 0.0f, 0.0f, 0.0f);
+    }
+    return true;
+}
+
+int DeviceMotion_SendControllerState(short controllerNumber, short activeGamepadMask, int buttonFlags,
+                                     unsigned char leftTrigger, unsigned char rightTrigger,
+                                     short leftStickX, short leftStickY, short *rightStickX, short *rightStickY) {
+    if (!g_assistEnabled.load(std::memory_order_relaxed)) {
+        return InputScheduler_SendControllerState(controllerNumber, activeGamepadMask, buttonFlags,
+                                                  leftTrigger, rightTrigger,
+                                                  leftStickX, leftStickY, *rightStickX, *rightStickY);
+    }
+
+    std::lock_guard<std::mutex> lock(g_motionMutex);
+    // 拿锁前 setGyroAssist 可能刚关闭助手（并已在锁内补发物理状态），此时按原样发送
+    if (!g_assistEnabled.load(std::memory_order_relaxed)) {
+        return InputScheduler_SendControllerState(controllerNumber, activeGamepadMask, buttonFlags,
+                                                  leftTrigger, rightTrigger,
+                                                  leftStickX, leftStickY, *rightStickX, *rightStickY);
+    }
+    g_phys.valid = true;
+    g_phys.dirty = true;
+    g_phys.controllerNumber = controllerNumber;
+    g_phys.activeGamepadMask = activeGamepadMask;
+    g_phys.buttonFlags = buttonFlags;
+    g_phys.leftTrigger = leftTrigger;
+    g_phys.rightTrigger = rightTrigger;
+    g_phys.leftStickX = leftStickX;
+    g_phys.leftStickY = leftStickY;
+    g_phys.rightStickX = *rightStickX;
+    g_phys.rightStickY = *rightStickY;
+
+    updateActivationLocked(leftTrigger, rightTrigger);
+    fuseLocked(rightStickX, rightStickY);
+    g_phys.dirty = false;
+    return InputScheduler_SendControllerState(controllerNumber, activeGamepadMask, buttonFlags,
+                                              leftTrigger, rightTrigger,
+                                              leftStickX, leftStickY, *rightStickX, *rightStickY);
+}
+
+void DeviceMotion_OnConnectionStarted() {
+    g_gyroSamples.store(0, std::memory_order_relaxed);
+    g_accelSamples.store(0, std::memory_order_relaxed);
+    g_gyroEventsSent.store(0, std::memory_order_relaxed);
+    g_accelEventsSent.store(0, std::memory_order_relaxed);
+    g_assistStatesSent.store(0, std::memory_order_relaxed);
+    g_latencySamples.store(0, std::memory_order_relaxed);
+    g_latencyTotalNs.store(0, std::memory_order_relaxed);
+    g_latencyHist.Reset();
+    g_statsStartNs.store(monotonicNs(), std::memory_order_relaxed);
+}
+
+void DeviceMotion_OnConnectionStopped() {
+    g_gyroRequestedHz.store(0, std::memory_order_relaxed);
+    g_accelRequestedHz.store(0, std::memory_order_relaxed);
+    updateSubscriptions();
+
+    std::lock_guard<std::mutex> lock(g_motionMutex);
+    g_phys.valid = false;
+    g_offsetApplied = false;
+}
+
+void DeviceMotion_GetStats(DeviceMotionStats *out) {
+    if (!out) return;
+    memset(out, 0, sizeof(*out));
+
+    out->passthroughEnabled = g_passthroughEnabled.load(std::memory_order_relaxed);
+    out->assistEnabled = g_assistEnabled.load(std::memory_order_relaxed);
+    out->gyroRequestedHz = g_gyroRequestedHz.load(std::memory_order_relaxed);
+    out->accelRequestedHz = g_accelRequestedHz.load(std::memory_order_relaxed);
+    out->gyroSubscribedHz = g_gyroSubscribedHz.load(std::memory_order_relaxed);
+    out->accelSubscribedHz = g_accelSubscribedHz.load(std::memory_order_relaxed);
+    out->gyroSamples = g_gyroSamples.load(std::memory_order_relaxed);
+    out->accelSamples = g_accelSamples.load(std::memory_order_relaxed);
+    out->gyroEventsSent = g_gyroEventsSent.load(std::memory_order_relaxed);
+    out->accelEventsSent = g_accelEventsSent.load(std::memory_order_relaxed);
+    out->assistStatesSent = g_assistStatesSent.load(std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(g_motionMutex);
+        out->assistActive = out->assistEnabled && g_holdActive;
+        out->gyroStickX = g_gyroStickX;
+        out->gyroStickY = g_gyroStickY;
+    }
+
+    uint64_t startNs = g_statsStartNs.load(std::memory_order_relaxed);
+    uint64_t now = monotonicNs();
+    if (startNs != 0 && now > startNs) {
+        double seconds = (double)(now - startNs) / 1e9;
+        out->gyroSentHz = (double)out->gyroEventsSent / seconds;
+        out->accelSentHz = (double)out->accelEventsSent / seconds;
+        out->assistSentHz = (double)out->assistStatesSent / seconds;
+    }
+
+    out->latencySamples = g_latencySamples.load(std::memory_order_relaxed);
+    out->avgLatencyUs = out->latencySamples > 0
+        ? (double)g_latencyTotalNs.load(std::memory_order_relaxed) / out->latencySamples / 1000.0 : 0.0;
+    out->p50LatencyUs = g_latencyHist.Percentile(0.50, LATENCY_BUCKET_US);
+    out->p99LatencyUs = g_latencyHist.Percentile(0.99, LATENCY_BUCKET_US);
+    out->maxLatencyUs = g_latencyHist.Max();
+}
+
+// ============================================================
+// NAPI: setPassthrough(enabled, controllerNumber)
+// ============================================================
+
+static napi_value DeviceMotionNapi_SetPassthrough(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    bool enabled = false;
+    int32_t controllerNumber = 0;
+    if (argc >= 1) napi_get_value_bool(env, args[0], &enabled);
+    if (argc >= 2) napi_get_value_int32(env, args[1], &controllerNumber);
+
+    g_passthroughController.store(controllerNumber, std::memory_order_relaxed);
+    g_passthroughEnabled.store(enabled, std::memory_order_relaxed);
+    if (!enabled) {
+        g_gyroRequestedHz.store(0, std::memory_order_relaxed);
+        g_accelRequestedHz.store(0, std::memory_order_relaxed);
+        updateSubscriptions();
+    }
+
+    OH_LOG_INFO(LOG_APP, "[%{public}s] setPassthrough: enabled=%{public}d controller=%{public}d",
+                LOG_TAG, enabled ? 1 : 0, controllerNumber);
+
+    napi_value undefined;
+    napi_get_undefined(env, &undefined);
+    return undefined;
+}
+
+// ============================================================
+// NAPI: setGyroAssist(enabled, sensitivity, invertX, invertY, activationKey)
+// ============================================================
+
+static napi_value DeviceMotionNapi_SetGyroAssist(napi_env env, napi_callback_info info) {
+    size_t argc = 5;
+    napi_value args[5];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    bool enabled = false;
+    double sensitivity = 2.0;
+    bool invertX = false, invertY = false;
+    int32_t activationKey = DEVICE_MOTION_ACTIVATION_ALWAYS;
+    if (argc >= 1) napi_get_value_bool(env, args[0], &enabled);
+    if (argc >= 2) napi_get_value_double(env, args[1], &sensitivity);
+    if (argc >= 3) napi_get_value_bool(env, args[2], &invertX);
+    if (argc >= 4) napi_get_value_bool(env, args[3], &invertY);
+    if (argc >= 5) napi_get_value_int32(env, args[4], &activationKey);
+    if (!(sensitivity >= 0.5)) sensitivity = 0.5;
+    if (sensitivity > 10.0) sensitivity = 10.0;
+
+    {
+        std::lock_guard<std::mutex> lock(g_motionMutex);
+        bool wasEnabled = g_assistEnabled.load(std::memory_order_relaxed);
+        if (enabled && (!wasEnabled || activationKey != g_activationKey)) {
+            g_holdActive = activationKey == DEVICE_MOTION_ACTIVATION_ALWAYS;
+            g_gyroStickX = 0;
+            g_gyroStickY = 0;
+            g_yawFilter.Reset();
+            g_pitchFilter.Reset();
+        }
+        // 关闭时若主机仍保持叠加后的右摇杆，补发一次物理状态。
+        // 补发在锁内、且早于 g_assistEnabled 清零：物理手柄路径要么在锁上等待补发完成，
+        // 要么在补发之后才看到关闭状态，补发的旧状态不会覆盖之后的物理状态
+        if (wasEnabled && !enabled && g_offsetApplied && g_phys.valid) {
+            InputScheduler_SendControllerState(g_phys.controllerNumber, g_phys.activeGamepadMask,
+                                               g_phys.buttonFlags, g_phys.leftTrigger, g_phys.rightTrigger,
+                                               g_phys.leftStickX, g_phys.leftStickY,
+                                               g_phys.rightStickX, g_phys.rightStickY);
+        }
+
+        g_sensitivity = sensitivity;
+        g_invertX = invertX;
+        g_invertY = invertY;
+        g_activationKey = activationKey;
+        if (!enabled) {
+            g_holdActive = false;
+            g_gyroStickX = 0;
+            g_gyroStickY = 0;
+            g_offsetApplied = false;
+            g_phys.valid = false;
+        }
+        g_assistEnabled.store(enabled, std::memory_order_relaxed);
+    }
+    updateSubscriptions();
+
+    OH_LOG_INFO(LOG_APP, "[%{public}s] setGyroAssist: enabled=%{public}d sensitivity=%{public}.2f "
+                "invert=(%{public}d,%{public}d) activation=%{public}d",
+                LOG_TAG, enabled ? 1 : 0, sensitivity, invertX ? 1 : 0, invertY ? 1 : 0, activationKey);
+
+    napi_value undefined;
+    napi_get_undefined(env, &undefined);
+    return undefined;
+}
+
+// ============================================================
+// NAPI: setRotation(degrees)
+// ============================================================
+
+static napi_value DeviceMotionNapi_SetRotation(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    int32_t degrees = 0;
+    if (argc >= 1) napi_get_value_int32(env, args[0], &degrees);
+    degrees = ((degrees % 360) + 360) % 360;
+    g_rotation.store(degrees, std::memory_order_relaxed);
+
+    napi_value undefined;
+    napi_get_undefined(env, &undefined);
+    return undefined;
+}
+
+// ============================================================
+// NAPI: getStats() → DeviceMotionStats
+// ============================================================
+
+static napi_value DeviceMotionNapi_GetStats(napi_env env, napi_callback_info info) {
+    DeviceMotionStats stats;
+    DeviceMotion_GetStats(&stats);
+
+    napi_value result;
+    napi_create_object(env, &result);
+
+    napi_value val;
+    napi_get_boolean(env, stats.passthroughEnabled, &val);
+    napi_set_named_property(env, result, "passthroughEnabled", val);
+    napi_get_boolean(env, stats.assistEnabled, &val);
+    napi_set_named_property(env, result, "assistEnabled", val);
+    napi_get_boolean(env, stats.assistActive, &val);
+    napi_set_named_property(env, result, "assistActive", val);
+    napi_create_uint32(env, stats.gyroRequestedHz, &val);
+    napi_set_named_property(env, result, "gyroRequestedHz", val);
+    napi_create_uint32(env, stats.accelRequestedHz, &val);
+    napi_set_named_property(env, result, "accelRequestedHz", val);
+    napi_create_uint32(env, stats.gyroSubscribedHz, &val);
+    napi_set_named_property(env, result, "gyroSubscribedHz", val);
+    napi_create_uint32(env, stats.accelSubscribedHz, &val);
+    napi_set_named_property(env, result, "accelSubscribedHz", val);
+    napi_create_int64(env, (int64_t)stats.gyroSamples, &val);
+    napi_set_named_property(env, result, "gyroSamples", val);
+    napi_create_int64(env, (int64_t)stats.accelSamples, &val);
+    napi_set_named_property(env, result, "accelSamples", val);
+    napi_create_int64(env, (int64_t)stats.gyroEventsSent, &val);
+    napi_set_named_property(env, result, "gyroEventsSent", val);
+    napi_create_int64(env, (int64_t)stats.accelEventsSent, &val);
+    napi_set_named_property(env, result, "accelEventsSent", val);
+    napi_create_int64(env, (int64_t)stats.assistStatesSent, &val);
+    napi_set_named_property(env, result, "assistStatesSent", val);
+    napi_create_double(env, stats.gyroSentHz, &val);
+    napi_set_named_property(env, result, "gyroSentHz", val);
+    napi_create_double(env, stats.accelSentHz, &val);
+    napi_set_named_property(env, result, "accelSentHz", val);
+    napi_create_double(env, stats.assistSentHz, &val);
+    napi_set_named_property(env, result, "assistSentHz", val);
+    napi_create_int32(env, stats.gyroStickX, &val);
+    napi_set_named_property(env, result, "gyroStickX", val);
+    napi_create_int32(env, stats.gyroStickY, &val);
+    napi_set_named_property(env, result, "gyroStickY", val);
+    napi_create_int64(env, (int64_t)stats.latencySamples, &val);
+    napi_set_named_property(env, result, "latencySamples", val);
+    napi_create_double(env, stats.avgLatencyUs, &val);
+    napi_set_named_property(env, result, "avgLatencyUs", val);
+    napi_create_uint32(env, stats.p50LatencyUs, &val);
+    napi_set_named_property(env, result, "p50LatencyUs", val);
+    napi_create_uint32(env, stats.p99LatencyUs, &val);
+    napi_set_named_property(env, result, "p99LatencyUs", val);
+    napi_create_uint32(env, stats.maxLatencyUs, &val);
+    napi_set_named_property(env, result, "maxLatencyUs", val);
+
+    return result;
+}
+
+// ============================================================
+// NAPI 注册
+// ============================================================
+
+void DeviceMotion_Init(napi_env env, napi_value exports) {
+    napi_value obj;
+    napi_create_object(env, &obj);
+
+    napi_property_descriptor methods[] = {
+        { "setPassthrough", nullptr, DeviceMotionNapi_SetPassthrough, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setGyroAssist",  nullptr, DeviceMotionNapi_SetGyroAssist,  nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setRotation",    nullptr, DeviceMotionNapi_SetRotation,    nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "getStats",       nullptr, DeviceMotionNapi_GetStats,       nullptr, nullptr, nullptr, napi_default, nullptr },
+    };
+
+    napi_define_properties(env, obj, sizeof(methods) / sizeof(methods[0]), methods);
+    napi_set_named_property(env, exports, "DeviceMotion", obj);
+
+    OH_LOG_INFO(LOG_APP, "[%{public}s] DeviceMotion NAPI 已注册", LOG_TAG);
+}
@@ -0,0 +1,113 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file device_motion.h
+ * @brief Native 设备体感：Sensor NDK → 方向校正 → 运动事件 / 体感助手
+ *
+ * 原路径：DeviceSensorService 在 ArkTS 中 sensor.on(GYROSCOPE) → 方向校正 → sendControllerMotionEvent；
+ * 体感助手 (GyroAssistService) 再把角速度映射为右摇杆、与物理摇杆叠加后经 sendGamepadState 发送。
+ * 采样率与延迟都受 JS 事件循环影响。
+ *
+ * 本模块在传感器回调线程中完成全部处理：
+ * - 运动事件直通：主机 BridgeClSetMotionEventState 请求的控制器（设备传感器回退）按请求频率订阅
+ *   陀螺仪 / 加速度计，方向校正后直接 LiSendControllerMotionEvent（陀螺仪 deg/s，加速度 m/s²）
+ * - 体感助手：陀螺仪经 One Euro 滤波后映射为右摇杆偏移。偏航 (Z) → 右摇杆 X，俯仰 (X) → 右摇杆 Y，
+ *   旋转速度达到 180° / 灵敏度倍率 时满偏。每个样本立即以最近的物理手柄状态叠加后发送；
+ *   物理手柄状态经 DeviceMotion_SendControllerState 叠加同一偏移后发送；两条路径在同一把锁内叠加并发送，
+ *   主机收到的状态顺序与叠加顺序一致
+ *
+ * 方向校正与 DeviceSensorService.correctOrientation 一致，屏幕旋转角由 ArkTS 在显示变化时下发。
+ * 统计：采样 → 发送延迟（优先用传感器时间戳，CLOCK_BOOTTIME），以及实际发送频率。
+ *
+ * 线程模型：配置在 JS 线程，运动请求在 moonlight-common-c 回调线程，样本在传感器服务线程，
+ * 物理手柄状态在各输入发送线程；订阅变更由独立互斥锁串行化，传感器回调不持有该锁。
+ */
+
+#ifndef DEVICE_MOTION_H
+#define DEVICE_MOTION_H
+
+#include <napi/native_api.h>
+#include <stdint.h>
+
+// setGyroAssist 的激活键（与 GyroAssistService 一致）
+#define DEVICE_MOTION_ACTIVATION_ALWAYS (-1)
+#define DEVICE_MOTION_ACTIVATION_LT     0
+#define DEVICE_MOTION_ACTIVATION_RT     1
+
+/**
+ * 体感统计（自串流连接建立起累计）
+ */
+struct DeviceMotionStats {
+    bool passthroughEnabled;
+    bool assistEnabled;
+    bool assistActive;              // 激活键条件满足
+    uint32_t gyroRequestedHz;       // 主机请求的陀螺仪频率
+    uint32_t accelRequestedHz;
+    uint32_t gyroSubscribedHz;      // 实际订阅频率（直通与助手取最大值）
+    uint32_t accelSubscribedHz;
+    uint64_t gyroSamples;
+    uint64_t accelSamples;
+    uint64_t gyroEventsSent;        // LiSendControllerMotionEvent (陀螺仪)
+    uint64_t accelEventsSent;
+    uint64_t assistStatesSent;      // 体感助手发送的手柄状态
+    double gyroSentHz;              // 实际发送频率
+    double accelSentHz;
+    double assistSentHz;
+    int32_t gyroStickX;             // 当前体感助手摇杆偏移（调试）
+    int32_t gyroStickY;
+    uint64_t latencySamples;
+    double avgLatencyUs;            // 采样 → 发送
+    uint32_t p50LatencyUs;
+    uint32_t p99LatencyUs;
+    uint32_t maxLatencyUs;
+};
+
+/**
+ * 初始化 DeviceMotion NAPI 模块。
+ *
+ * 注册到 exports.DeviceMotion 命名空间：
+ *   - setPassthrough(enabled, controllerNumber): void   由 native 处理该控制器的主机运动请求
+ *   - setGyroAssist(enabled, sensitivity, invertX, invertY, activationKey): void
+ *   - setRotation(degrees): void                         屏幕旋转角 (0 / 90 / 180 / 270)
+ *   - getStats(): obj
+ */
+void DeviceMotion_Init(napi_env env, napi_value exports);
+
+/**
+ * 主机运动请求（BridgeClSetMotionEventState）
+ * @return 已由 native 处理返回 true，ArkTS 不应再启用设备传感器
+ */
+bool DeviceMotion_OnSetMotionEventState(uint16_t controllerNumber, uint8_t motionType, uint16_t reportRateHz);
+
+/**
+ * 物理手柄状态发送：记录状态供体感助手即时发送，激活时把陀螺仪偏移叠加到右摇杆，
+ * 再交给 InputScheduler_SendControllerState。叠加与发送在体感助手的锁内完成，与传感器线程的发送串行。
+ * 未启用体感助手时只读一个原子变量即直接发送
+ * @param rightStickX/rightStickY 输入物理右摇杆，返回实际发送的值
+ * @return InputScheduler_SendControllerState 的返回值
+ */
+int DeviceMotion_SendControllerState(short controllerNumber, short activeGamepadMask, int buttonFlags,
+                                     unsigned char leftTrigger, unsigned char rightTrigger,
+                                     short leftStickX, short leftStickY, short *rightStickX, short *rightStickY);
+
+/**
+ * 串流连接建立：重置统计
+ */
+void DeviceMotion_OnConnectionStarted();
+
+/**
+ * 串流连接停止 / 终止：取消主机请求的订阅
+ */
+void DeviceMotion_OnConnectionStopped();
+
+void DeviceMotion_GetStats(DeviceMotionStats *out);
+
+#endif // DEVICE_MOTION_H
@@ -16,12 +16,17 @@
  */
 
 #include "game_controller_native.h"
+#include "controller_input_router.h"
 #include <hilog/log.h>
 #include <string.h>
 #include <stdlib.h>
+#include <time.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
-#include <map>
-#include <string>
+#include <thread>
+#include <vector>
 #include <dlfcn.h>
 
 // 尝试包含 Game Controller Kit 头文件 (仅用于类型定义)
@@ -370,9 +375,252 @@ static GameControllerDeviceCallback g_deviceCallback = nullptr;
 static GameControllerButtonCallback g_buttonCallback = nullptr;
 static GameControllerAxisCallback g_axisCallback = nullptr;
 
-// 设备状态缓存 (deviceId -> state)
-static std::map<std::string, GameControllerState> g_deviceStates;
-static std::map<std::string, GameControllerInfo> g_deviceInfos;
+// ==================== 设备表 ====================
+// 每个轴 / 按键回调都要按 deviceId 找设备。同时在线的手柄很少，定长表线性比较即可，
+// 命中上一次的设备只需一次 strcmp，不再为每个事件构造 std::string 查 map。
+
+#define GC_MAX_DEVICES 8
+
+struct GcDeviceSlot {
+    bool used;
+    bool dpadAxisActive;        // 已由 Axis(DPAD) 通道提供十字键，Button 通道的十字键事件忽略
+    int routeSlot;              // native 直发槽位，-1 = 事件交给 ArkTS
+    GameControllerInfo info;
+    GameControllerState state;
+};
+
+static GcDeviceSlot g_devices[GC_MAX_DEVICES];
+static int g_deviceCount = 0;
+static int g_lastDevice = -1;
+
+static GcDeviceSlot* findDeviceLocked(const char* deviceId) {
+    if (!deviceId) return nullptr;
+    if (g_lastDevice >= 0 && g_devices[g_lastDevice].used &&
+        strcmp(g_devices[g_lastDevice].info.deviceId, deviceId) == 0) {
+        return &g_devices[g_lastDevice];
+    }
+    for (int i = 0; i < GC_MAX_DEVICES; i++) {
+        if (g_devices[i].used && strcmp(g_devices[i].info.deviceId, deviceId) == 0) {
+            g_lastDevice = i;
+            return &g_devices[i];
+        }
+    }
+    return nullptr;
+}
+
+// ==================== native 直发 ====================
+// 手柄绑定到 ControllerInputRouter 且串流已连接时，回调线程只合并状态、不再逐事件投递 ArkTS；
+// 发送线程被唤醒后把这段时间内的一批轴 / 按键回调作为一次 LiSendMultiControllerEvent 发出。
+// 同一批内同一按键变化两次（快速点按）时，先把中间状态排入边沿队列，保证主机收到按下和释放。
+
+#define GC_ROUTE_SLOTS       4      // 与 ControllerInputRouter 槽位数一致
+#define GC_ROUTE_EDGE_QUEUE  4
+#define GC_ROUTE_IDLE_MS     100    // 无新事件多久后补发积压的 UI 快照
+
+struct GcRouteSlot {
+    GameControllerState state;                          // 合并状态 (Y 轴 HID 方向)，共享槽位的设备写同一份
+    GameControllerState queued[GC_ROUTE_EDGE_QUEUE];    // 本批内需要单独发送的中间状态
+    int queuedCount;
+    uint32_t changedButtons;                            // 本批（自上一个中间状态起）已变化的按键
+    uint64_t firstEventNs;                              // 本批第一个事件时间，0 = 无待发
+};
+
+static GcRouteSlot g_routeSlots[GC_ROUTE_SLOTS];
+static uint32_t g_routePendingMask = 0;     // 有待发状态的槽位
+static uint32_t g_routeIdleMask = 0;        // 已发送、等待空闲补发快照的槽位
+static std::condition_variable g_routeCv;
+static std::thread g_routeThread;
+static bool g_routeThreadRunning = false;
+
+static std::atomic<uint64_t> g_routedEvents{0};
+static std::atomic<uint64_t> g_routeBatches{0};
+static std::atomic<uint64_t> g_routeEdgeFlushes{0};
+static std::atomic<uint64_t> g_jsNotifications{0};
+
+static uint64_t monotonicNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static GcDeviceSlot* addDeviceLocked(const GameControllerInfo& info) {
+    GcDeviceSlot* dev = findDeviceLocked(info.deviceId);
+    if (!dev) {
+        for (int i = 0; i < GC_MAX_DEVICES; i++) {
+            if (!g_devices[i].used) {
+                dev = &g_devices[i];
+                g_deviceCount++;
+                break;
+            }
+        }
+        if (!dev) {
+            LOGW("设备表已满 (%d)，忽略 deviceId=%s 的状态缓存", GC_MAX_DEVICES, info.deviceId);
+            return nullptr;
+        }
+    }
+    memset(dev, 0, sizeof(*dev));
+    dev->used = true;
+    dev->routeSlot = -1;
+    dev->info = info;
+    strncpy(dev->state.deviceId, info.deviceId, sizeof(dev->state.deviceId) - 1);
+    return dev;
+}
+
+static void removeDeviceLocked(GcDeviceSlot* dev) {
+    if (!dev || !dev->used) return;
+    int routeSlot = dev->routeSlot;
+    dev->used = false;
+    g_deviceCount--;
+    if (routeSlot < 0) return;
+
+    // 槽位上已没有其他设备时清空合并状态，避免下一个手柄继承残留按键
+    for (int i = 0; i < GC_MAX_DEVICES; i++) {
+        if (g_devices[i].used && g_devices[i].routeSlot == routeSlot) return;
+    }
+    memset(&g_routeSlots[routeSlot], 0, sizeof(g_routeSlots[routeSlot]));
+    g_routePendingMask &= ~(1u << routeSlot);
+}
+
+static void clearDevicesLocked() {
+    memset(g_devices, 0, sizeof(g_devices));
+    memset(g_routeSlots, 0, sizeof(g_routeSlots));
+    g_deviceCount = 0;
+    g_lastDevice = -1;
+    g_routePendingMask = 0;
+    g_routeIdleMask = 0;
+}
+
+static void setButtons(GameControllerState* s, uint32_t mask, uint32_t value) {
+    s->buttons = (s->buttons & ~mask) | (value & mask);
+}
+
+static void markRoutePendingLocked(int routeSlot, uint64_t now) {
+    GcRouteSlot* r = &g_routeSlots[routeSlot];
+    if (r->firstEventNs == 0) r->firstEventNs = now;
+    g_routedEvents.fetch_add(1, std::memory_order_relaxed);
+    if (!(g_routePendingMask & (1u << routeSlot))) {
+        g_routePendingMask |= 1u << routeSlot;
+        g_routeCv.notify_one();
+    }
+}
+
+/**
+ * 按键变化同步到直发槽位（调用方持有 g_mutex）
+ * @return true = 已由 native 发送，不再投递 ArkTS
+ */
+static bool routeButtonsLocked(GcDeviceSlot* dev, uint32_t mask, uint32_t value) {
+    if (!dev || dev->routeSlot < 0) return false;
+    GcRouteSlot* r = &g_routeSlots[dev->routeSlot];
+    uint32_t changed = (r->state.buttons ^ value) & mask;
+    bool accepted = ControllerInputRouter_AcceptsState(dev->routeSlot);
+
+    if (accepted && r->firstEventNs != 0 && (r->changedButtons & changed)) {
+        // 本批内该键已变化过：中间状态单独排队，避免按下 + 释放被合并成"无变化"
+        if (r->queuedCount < GC_ROUTE_EDGE_QUEUE) {
+            r->queued[r->queuedCount++] = r->state;
+        } else {
+            r->queued[GC_ROUTE_EDGE_QUEUE - 1] = r->state;
+        }
+        r->changedButtons = 0;
+        g_routeEdgeFlushes.fetch_add(1, std::memory_order_relaxed);
+    }
+    setButtons(&r->state, mask, value);
+    if (!accepted) return false;
+
+    r->changedButtons |= changed;
+    markRoutePendingLocked(dev->routeSlot, monotonicNs());
+    return true;
+}
+
+static void toNapiState(const GameControllerState* in, NapiGamepadState* out) {
+    out->buttons = in->buttons;
+    out->leftStickX = in->leftStickX;
+    out->leftStickY = in->leftStickY;
+    out->rightStickX = in->rightStickX;
+    out->rightStickY = in->rightStickY;
+    out->leftTrigger = in->leftTrigger;
+    out->rightTrigger = in->rightTrigger;
+}
+
+/**
+ * 发送线程：取出各槽位本批的中间状态与最终状态，锁外交给 ControllerInputRouter
+ */
+static void RouteSenderLoop() {
+    struct RouteBatch {
+        int count;
+        GameControllerState states[GC_ROUTE_EDGE_QUEUE + 1];
+        uint64_t rxNs;
+    };
+    RouteBatch batches[GC_ROUTE_SLOTS];
+    auto ready = [] { return !g_routeThreadRunning || g_routePendingMask != 0; };
+
+    std::unique_lock<std::mutex> lock(g_mutex);
+    while (g_routeThreadRunning) {
+        if (g_routePendingMask == 0) {
+            if (g_routeIdleMask == 0) {
+                g_routeCv.wait(lock, ready);
+            } else if (!g_routeCv.wait_for(lock, std::chrono::milliseconds(GC_ROUTE_IDLE_MS), ready)) {
+                uint32_t idle = g_routeIdleMask;
+                g_routeIdleMask = 0;
+                lock.unlock();
+                for (int i = 0; i < GC_ROUTE_SLOTS; i++) {
+                    if (idle & (1u << i)) ControllerInputRouter_OnSlotIdle(i);
+                }
+                lock.lock();
+            }
+            continue;
+        }
+
+        uint32_t mask = g_routePendingMask;
+        g_routePendingMask = 0;
+        g_routeIdleMask |= mask;
+        for (int i = 0; i < GC_ROUTE_SLOTS; i++) {
+            if (!(mask & (1u << i))) continue;
+            GcRouteSlot* r = &g_routeSlots[i];
+            RouteBatch* b = &batches[i];
+            memcpy(b->states, r->queued, sizeof(r->queued[0]) * r->queuedCount);
+            b->states[r->queuedCount] = r->state;
+            b->count = r->queuedCount + 1;
+            b->rxNs = r->firstEventNs;
+            r->queuedCount = 0;
+            r->changedButtons = 0;
+            r->firstEventNs = 0;
+        }
+        lock.unlock();
+
+        for (int i = 0; i < GC_ROUTE_SLOTS; i++) {
+            if (!(mask & (1u << i))) continue;
+            for (int k = 0; k < batches[i].count; k++) {
+                NapiGamepadState state;
+                toNapiState(&batches[i].states[k], &state);
+                ControllerInputRouter_OnState(i, &state, batches[i].rxNs);
+            }
+            g_routeBatches.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        lock.lock();
+    }
+}
+
+static void StartRouteThreadLocked() {
+    if (g_routeThreadRunning) return;
+    g_routeThreadRunning = true;
+    g_routeThread = std::thread(RouteSenderLoop);
+    LOGI("native 直发线程已启动");
+}
+
+static void StopRouteThread() {
+    std::thread thread;
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        if (!g_routeThreadRunning) return;
+        g_routeThreadRunning = false;
+        g_routeCv.notify_all();
+        thread = std::move(g_routeThread);
+    }
+    if (thread.joinable()) thread.join();
+    LOGI("native 直发线程已停止");
+}
 
 // NAPI 环境和回调引用 (用于异步通知 JS 层)
 static napi_env g_napiEnv = nullptr;
@@ -383,10 +631,85 @@ static napi_threadsafe_function g_tsfnDevice = nullptr;
 static napi_threadsafe_function g_tsfnButton = nullptr;
 static napi_threadsafe_function g_tsfnAxis = nullptr;
 
+// tsfn 投递的事件数据
+struct ButtonEventData {
+    char deviceId[64];
+    int32_t buttonCode;
+    bool isPressed;
+    bool routed;            // 该设备已由 native 直发（仅用于 ArkTS 的 Start 长按检测）
+};
+
+struct AxisEventData {
+    char deviceId[64];
+    int32_t axisType;
+    double x;
+    double y;
+};
+
 #if GAME_CONTROLLER_KIT_AVAILABLE
 
 // ==================== Game Controller Kit 回调实现 ====================
 
+static int16_t toStickValue(double v) {
+    if (v > 1.0) v = 1.0;
+    if (v < -1.0) v = -1.0;
+    return (int16_t)(v * 32767);
+}
+
+static uint8_t toTriggerValue(double v) {
+    if (v > 1.0) v = 1.0;
+    if (v < 0.0) v = 0.0;
+    return (uint8_t)(v * 255);
+}
+
+static uint32_t dpadButtonsFromHat(double hatX, double hatY) {
+    uint32_t buttons = 0;
+    if (hatX < -0.5) buttons |= GC_BTN_LEFT;
+    if (hatX > 0.5) buttons |= GC_BTN_RIGHT;
+    if (hatY < -0.5) buttons |= GC_BTN_UP;
+    if (hatY > 0.5) buttons |= GC_BTN_DOWN;
+    return buttons;
+}
+
+/**
+ * 把一个轴事件写入状态（十字键只更新 hat，按键位由调用方经 setButtons 写入）
+ */
+static void applyAxis(GameControllerState* s, int32_t axisType, double x, double y) {
+    switch (axisType) {
+        case GC_AXIS_LEFT_THUMBSTICK:
+            s->leftStickX = toStickValue(x);
+            s->leftStickY = toStickValue(y);
+            break;
+        case GC_AXIS_RIGHT_THUMBSTICK:
+            s->rightStickX = toStickValue(x);
+            s->rightStickY = toStickValue(y);
+            break;
+        case GC_AXIS_DPAD:
+            s->hatX = (int16_t)x;
+            s->hatY = (int16_t)y;
+            break;
+        case GC_AXIS_LEFT_TRIGGER:
+            s->leftTrigger = toTriggerValue(x);
+            break;
+        case GC_AXIS_RIGHT_TRIGGER:
+            s->rightTrigger = toTriggerValue(x);
+            break;
+    }
+}
+
+/**
+ * 轴变化同步到直发槽位（调用方持有 g_mutex）
+ * @return true = 已由 native 发送，不再投递 ArkTS
+ */
+static bool routeAxisLocked(GcDeviceSlot* dev, int32_t axisType, double x, double y) {
+    if (!dev || dev->routeSlot < 0) return false;
+    applyAxis(&g_routeSlots[dev->routeSlot].state, axisType, x, y);
+    if (!ControllerInputRouter_AcceptsState(dev->routeSlot)) return false;
+
+    markRoutePendingLocked(dev->routeSlot, monotonicNs());
+    return true;
+}
+
 /**
  * 设备状态变化回调 (C++)
  */
@@ -445,12 +768,9 @@ static void OnDeviceChanged(const struct GameDevice_DeviceEvent* deviceEvent) {
     {
         std::lock_guard<std::mutex> lock(g_mutex);
         if (isConnected) {
-            g_deviceInfos[deviceId] = info;
-            g_deviceStates[deviceId] = GameControllerState{};
-            strncpy(g_deviceStates[deviceId].deviceId, deviceId, sizeof(g_deviceStates[deviceId].deviceId) - 1);
+            addDeviceLocked(info);
         } else {
-            g_deviceInfos.erase(deviceId);
-            g_deviceStates.erase(deviceId);
+            removeDeviceLocked(findDeviceLocked(deviceId));
         }
     }
     
@@ -501,34 +821,38 @@ static void OnButtonEvent(const struct GamePad_ButtonEvent* buttonEvent, const c
     LOGD("按键事件: deviceId=%s, button=%s, code=%d, isPressed=%d", 
          deviceId ? deviceId : "null", buttonName, buttonCode, isPressed);
     
+    uint32_t flag = 0;
+    switch (buttonCode) {
+        case GC_KEYCODE_BUTTON_A: flag = GC_BTN_A; break;
+        case GC_KEYCODE_BUTTON_B: flag = GC_BTN_B; break;
+        case GC_KEYCODE_BUTTON_C: flag = GC_BTN_BACK; break;  // ButtonC = Select/Back（鸿蒙无原生 Select 按键）
+        case GC_KEYCODE_BUTTON_X: flag = GC_BTN_X; break;
+        case GC_KEYCODE_BUTTON_Y: flag = GC_BTN_Y; break;
+        case GC_KEYCODE_LEFT_SHOULDER: flag = GC_BTN_LB; break;
+        case GC_KEYCODE_RIGHT_SHOULDER: flag = GC_BTN_RB; break;
+        case GC_KEYCODE_LEFT_THUMBSTICK: flag = GC_BTN_LS_CLK; break;
+        case GC_KEYCODE_RIGHT_THUMBSTICK: flag = GC_BTN_RS_CLK; break;
+        case GC_KEYCODE_BUTTON_HOME: flag = GC_BTN_BACK; break;  // GCK 名为 Home，实测为 Select/Back
+        case GC_KEYCODE_BUTTON_MENU: flag = GC_BTN_START; break;
+        case GC_KEYCODE_DPAD_UP: flag = GC_BTN_UP; break;
+        case GC_KEYCODE_DPAD_DOWN: flag = GC_BTN_DOWN; break;
+        case GC_KEYCODE_DPAD_LEFT: flag = GC_BTN_LEFT; break;
+        case GC_KEYCODE_DPAD_RIGHT: flag = GC_BTN_RIGHT; break;
+    }
+
     // 更新设备状态
+    bool routed = false;
     {
         std::lock_guard<std::mutex> lock(g_mutex);
-        auto it = g_deviceStates.find(deviceId ? deviceId : "");
-        if (it != g_deviceStates.end()) {
-            uint32_t flag = 0;
-            switch (buttonCode) {
-                case GC_KEYCODE_BUTTON_A: flag = GC_BTN_A; break;
-                case GC_KEYCODE_BUTTON_B: flag = GC_BTN_B; break;
-                case GC_KEYCODE_BUTTON_C: flag = GC_BTN_BACK; break;  // ButtonC = Select/Back（鸿蒙无原生 Select 按键）
-                case GC_KEYCODE_BUTTON_X: flag = GC_BTN_X; break;
-                case GC_KEYCODE_BUTTON_Y: flag = GC_BTN_Y; break;
-                case GC_KEYCODE_LEFT_SHOULDER: flag = GC_BTN_LB; break;
-                case GC_KEYCODE_RIGHT_SHOULDER: flag = GC_BTN_RB; break;
-                case GC_KEYCODE_LEFT_THUMBSTICK: flag = GC_BTN_LS_CLK; break;
-                case GC_KEYCODE_RIGHT_THUMBSTICK: flag = GC_BTN_RS_CLK; break;
-                case GC_KEYCODE_BUTTON_HOME: flag = GC_BTN_BACK; break;  // GCK 名为 Home，实测为 Select/Back
-                case GC_KEYCODE_BUTTON_MENU: flag = GC_BTN_START; break;
-                case GC_KEYCODE_DPAD_UP: flag = GC_BTN_UP; break;
-                case GC_KEYCODE_DPAD_DOWN: flag = GC_BTN_DOWN; break;
-                case GC_KEYCODE_DPAD_LEFT: flag = GC_BTN_LEFT; break;
-                case GC_KEYCODE_DPAD_RIGHT: flag = GC_BTN_RIGHT; break;
-            }
-            if (isPressed) {
-                it->second.buttons |= flag;
-            } else {
-                it->second.buttons &= ~flag;
-            }
+        GcDeviceSlot* dev = findDeviceLocked(deviceId);
+        // 十字键通道去重：Axis 通道已提供十字键时 Button 通道的十字键事件全部忽略（含释放）
+        bool dpadDup = dev && dev->dpadAxisActive &&
+            (flag & (GC_BTN_UP | GC_BTN_DOWN | GC_BTN_LEFT | GC_BTN_RIGHT)) != 0;
+        if (dev && flag != 0 && !dpadDup) {
+            setButtons(&dev->state, flag, isPressed ? flag : 0);
+            routed = routeButtonsLocked(dev, flag, isPressed ? flag : 0);
+        } else if (dpadDup) {
+            routed = dev->routeSlot >= 0 && ControllerInputRouter_AcceptsState(dev->routeSlot);
         }
     }
     
@@ -537,20 +861,20 @@ static void OnButtonEvent(const struct GamePad_ButtonEvent* buttonEvent, const c
         g_buttonCallback(deviceId, buttonCode, isPressed);
     }
     
-    // 通知 JS 层
-    if (g_tsfnButton) {
-        struct ButtonEventData {
-            char deviceId[64];
-            int32_t buttonCode;
-            bool isPressed;
-        };
+    // 通知 JS 层：native 直发时只转发 Start（ArkTS 需要长按 Start 呼出菜单）
+    if (g_tsfnButton && (!routed || buttonCode == GC_KEYCODE_BUTTON_MENU)) {
         ButtonEventData* data = new ButtonEventData();
         strncpy(data->deviceId, deviceId ? deviceId : "", sizeof(data->deviceId) - 1);
         data->buttonCode = buttonCode;
         data->isPressed = isPressed;
+        data->routed = routed;
         
         napi_status st = napi_call_threadsafe_function(g_tsfnButton, data, napi_tsfn_nonblocking);
-        if (st != napi_ok) delete data;
+        if (st != napi_ok) {
+            delete data;
+        } else {
+            g_jsNotifications.fetch_add(1, std::memory_order_relaxed);
+        }
     }
     
     if (deviceId) free(deviceId);
@@ -576,22 +900,37 @@ static void OnDpadLeft(const struct GamePad_ButtonEvent* e) { OnButtonEvent(e, "
 static void OnDpadRight(const struct GamePad_ButtonEvent* e) { OnButtonEvent(e, "DpadRight"); }
 
 /**
- * 轴事件通知 (通用)
+ * 轴事件处理 (通用)：更新设备状态，native 直发时不再投递 JS
  */
-static void NotifyAxisEvent(const char* deviceId, int32_t axisType, double x, double y) {
+static void HandleAxisEvent(const char* deviceId, int32_t axisType, double x, double y) {
+    bool routed = false;
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        GcDeviceSlot* dev = findDeviceLocked(deviceId);
+        if (dev) {
+            applyAxis(&dev->state, axisType, x, y);
+            if (axisType == GC_AXIS_DPAD) {
+                // 十字键由 hat 换算为按键位，走按键的边沿保护
+                uint32_t dpad = dpadButtonsFromHat(x, y);
+                dev->dpadAxisActive = true;
+                setButtons(&dev->state, GC_BTN_UP | GC_BTN_DOWN | GC_BTN_LEFT | GC_BTN_RIGHT, dpad);
+                if (dev->routeSlot >= 0) applyAxis(&g_routeSlots[dev->routeSlot].state, axisType, x, y);
+                routed = routeButtonsLocked(dev, GC_BTN_UP | GC_BTN_DOWN | GC_BTN_LEFT | GC_BTN_RIGHT, dpad);
+            } else {
+                routed = routeAxisLocked(dev, axisType, x, y);
+            }
+        }
+    }
+
     // 通知回调
     if (g_axisCallback) {
         g_axisCallback(deviceId, axisType, x, y);
     }
     
+    if (routed) return;
+
     // 通知 JS 层
     if (g_tsfnAxis) {
-        struct AxisEventData {
-            char deviceId[64];
-            int32_t axisType;
-            double x;
-            double y;
-        };
         AxisEventData* data = new AxisEventData();
         strncpy(data->deviceId, deviceId ? deviceId : "", sizeof(data->deviceId) - 1);
         data->axisType = axisType;
@@ -602,9 +941,11 @@ static void NotifyAxisEvent(const char* deviceId, int32_t axisType, double x, do
         if (status != napi_ok) {
             LOGE("napi_call_threadsafe_function(axis) 失败: status=%d", status);
             delete data;
+        } else {
+            g_jsNotifications.fetch_add(1, std::memory_order_relaxed);
         }
     } else {
-        LOGW("NotifyAxisEvent: g_tsfnAxis 为空，轴事件丢失 (axisType=%d)", axisType);
+        LOGW("HandleAxisEvent: g_tsfnAxis 为空，轴事件丢失 (axisType=%d)", axisType);
     }
 }
 
@@ -624,17 +965,7 @@ static void OnLeftThumbstickAxis(const struct GamePad_AxisEvent* axisEvent) {
     
     LOGD("左摇杆轴: deviceId=%s, X=%.3f, Y=%.3f", deviceId ? deviceId : "null", xValue, yValue);
     
-    // 更新设备状态
-    {
-        std::lock_guard<std::mutex> lock(g_mutex);
-        auto it = g_deviceStates.find(deviceId ? deviceId : "");
-        if (it != g_deviceStates.end()) {
-            it->second.leftStickX = (int16_t)(xValue * 32767);
-            it->second.leftStickY = (int16_t)(yValue * 32767);
-        }
-    }
-    
-    NotifyAxisEvent(deviceId, GC_AXIS_LEFT_THUMBSTICK, xValue, yValue);
+    HandleAxisEvent(deviceId, GC_AXIS_LEFT_THUMBSTICK, xValue, yValue);
     
     if (deviceId) free(deviceId);
 }
@@ -655,16 +986,7 @@ static void OnRightThumbstickAxis(const struct GamePad_AxisEvent* axisEvent) {
     
     LOGD("右摇杆轴: deviceId=%s, Z=%.3f, RZ=%.3f", deviceId ? deviceId : "null", zValue, rzValue);
     
-    {
-        std::lock_guard<std::mutex> lock(g_mutex);
-        auto it = g_deviceStates.find(deviceId ? deviceId : "");
-        if (it != g_deviceStates.end()) {
-            it->second.rightStickX = (int16_t)(zValue * 32767);
-            it->second.rightStickY = (int16_t)(rzValue * 32767);
-        }
-    }
-    
-    NotifyAxisEvent(deviceId, GC_AXIS_RIGHT_THUMBSTICK, zValue, rzValue);
+    HandleAxisEvent(deviceId, GC_AXIS_RIGHT_THUMBSTICK, zValue, rzValue);
     
     if (deviceId) free(deviceId);
 }
@@ -685,23 +1007,7 @@ static void OnDpadAxis(const struct GamePad_AxisEvent* axisEvent) {
     
     LOGD("D-Pad轴: deviceId=%s, HatX=%.3f, HatY=%.3f", deviceId ? deviceId : "null", hatX, hatY);
     
-    {
-        std::lock_guard<std::mutex> lock(g_mutex);
-        auto it = g_deviceStates.find(deviceId ? deviceId : "");
-        if (it != g_deviceStates.end()) {
-            it->second.hatX = (int16_t)hatX;
-            it->second.hatY = (int16_t)hatY;
-            
-            // 更新 D-Pad 按钮状态
-            it->second.buttons &= ~(GC_BTN_UP | GC_BTN_DOWN | GC_BTN_LEFT | GC_BTN_RIGHT);
-            if (hatX < -0.5) it->second.buttons |= GC_BTN_LEFT;
-            if (hatX > 0.5) it->second.buttons |= GC_BTN_RIGHT;
-            if (hatY < -0.5) it->second.buttons |= GC_BTN_UP;
-            if (hatY > 0.5) it->second.buttons |= GC_BTN_DOWN;
-        }
-    }
-    
-    NotifyAxisEvent(deviceId, GC_AXIS_DPAD, hatX, hatY);
+    HandleAxisEvent(deviceId, GC_AXIS_DPAD, hatX, hatY);
     
     if (deviceId) free(deviceId);
 }
@@ -720,16 +1026,7 @@ static void OnLeftTriggerAxis(const struct GamePad_AxisEvent* axisEvent) {
     
     LOGD("左扳机轴: deviceId=%s, Brake=%.3f", deviceId ? deviceId : "null", brakeValue);
     
-    {
-        std::lock_guard<std::mutex> lock(g_mutex);
-        auto it = g_deviceStates.find(deviceId ? deviceId : "");
-        if (it != g_deviceStates.end()) {
-            // 扳机值范围 0.0-1.0，转换为 0-255
-            it->second.leftTrigger = (uint8_t)(brakeValue * 255);
-        }
-    }
-    
-    NotifyAxisEvent(deviceId, GC_AXIS_LEFT_TRIGGER, brakeValue, 0.0);
+    HandleAxisEvent(deviceId, GC_AXIS_LEFT_TRIGGER, brakeValue, 0.0);
     
     if (deviceId) free(deviceId);
 }
@@ -748,15 +1045,7 @@ static void OnRightTriggerAxis(const struct GamePad_AxisEvent* axisEvent) {
     
     LOGD("右扳机轴: deviceId=%s, Gas=%.3f", deviceId ? deviceId : "null", gasValue);
     
-    {
-        std::lock_guard<std::mutex> lock(g_mutex);
-        auto it = g_deviceStates.find(deviceId ? deviceId : "");
-        if (it != g_deviceStates.end()) {
-            it->second.rightTrigger = (uint8_t)(gasValue * 255);
-        }
-    }
-    
-    NotifyAxisEvent(deviceId, GC_AXIS_RIGHT_TRIGGER, gasValue, 0.0);
+    HandleAxisEvent(deviceId, GC_AXIS_RIGHT_TRIGGER, gasValue, 0.0);
     
     if (deviceId) free(deviceId);
 }
@@ -805,6 +1094,9 @@ int GameController_Init(void) {
 }
 
 void GameController_Uninit(void) {
+    // 发送线程会取 g_mutex，必须在加锁前停止
+    StopRouteThread();
+
     std::lock_guard<std::mutex> lock(g_mutex);
     
     if (!g_initialized) return;
@@ -813,8 +1105,7 @@ void GameController_Uninit(void) {
         GameController_StopMonitor();
     }
     
-    g_deviceStates.clear();
-    g_deviceInfos.clear();
+    clearDevicesLocked();
     g_initialized = false;
     
     // 关闭动态库
@@ -923,12 +1214,7 @@ int GameController_StartMonitor(void) {
                 
                 info.isConnected = true;
                 
-                g_deviceInfos[deviceId ? deviceId : ""] = info;
-                g_deviceStates[deviceId ? deviceId : ""] = GameControllerState{};
-                if (deviceId) {
-                    strncpy(g_deviceStates[deviceId].deviceId, deviceId, 
-                            sizeof(g_deviceStates[deviceId].deviceId) - 1);
-                }
+                addDeviceLocked(info);
                 
                 if (g_deviceCallback) {
                     g_deviceCallback(deviceId, true, &info);
@@ -1021,7 +1307,7 @@ int GameController_RefreshDevices(void) {
     LOGI("RefreshDevices: 系统报告 %d 个设备", count);
 
     // 构建当前设备集合
-    std::map<std::string, GameControllerInfo> currentDevices;
+    std::vector<GameControllerInfo> currentDevices;
     for (int i = 0; i < count; i++) {
         GameDevice_DeviceInfo* deviceInfo;
         errorCode = OH_GameDevice_AllDeviceInfos_GetDeviceInfo(allDeviceInfos, i, &deviceInfo);
@@ -1063,8 +1349,7 @@ int GameController_RefreshDevices(void) {
 
         info.isConnected = true;
 
-        std::string key = deviceId ? deviceId : "";
-        currentDevices[key] = info;
+        currentDevices.push_back(info);
 
         if (deviceId) free(deviceId);
         OH_GameDevice_DestroyDeviceInfo(&deviceInfo);
@@ -1073,44 +1358,46 @@ int GameController_RefreshDevices(void) {
 
     // 差异对比：找出新上线的设备
     int newDeviceCount = 0;
-    std::vector<std::pair<std::string, GameControllerInfo>> newDevices;
-    for (auto& pair : currentDevices) {
-        if (g_deviceInfos.find(pair.first) == g_deviceInfos.end()) {
-            newDevices.push_back(pair);
+    std::vector<GameControllerInfo> newDevices;
+    for (auto& info : currentDevices) {
+        if (!findDeviceLocked(info.deviceId)) {
+            newDevices.push_back(info);
             newDeviceCount++;
         }
     }
 
     // 差异对比：找出消失的设备
-    std::vector<std::pair<std::string, GameControllerInfo>> goneDevices;
-    for (auto& pair : g_deviceInfos) {
-        if (currentDevices.find(pair.first) == currentDevices.end()) {
-            goneDevices.push_back(pair);
+    std::vector<GameControllerInfo> goneDevices;
+    for (int i = 0; i < GC_MAX_DEVICES; i++) {
+        if (!g_devices[i].used) continue;
+        bool present = false;
+        for (auto& info : currentDevices) {
+            if (strcmp(info.deviceId, g_devices[i].info.deviceId) == 0) {
+                present = true;
+                break;
+            }
+        }
+        if (!present) {
+            goneDevices.push_back(g_devices[i].info);
         }
     }
 
     // 更新缓存：添加新设备
-    for (auto& pair : newDevices) {
-        g_deviceInfos[pair.first] = pair.second;
-        g_deviceStates[pair.first] = GameControllerState{};
-        strncpy(g_deviceStates[pair.first].deviceId, pair.first.c_str(),
-                sizeof(g_deviceStates[pair.first].deviceId) - 1);
-        LOGI("RefreshDevices: 新设备上线 deviceId=%s, name=%s",
-             pair.first.c_str(), pair.second.name);
+    for (auto& info : newDevices) {
+        addDeviceLocked(info);
+        LOGI("RefreshDevices: 新设备上线 deviceId=%s, name=%s", info.deviceId, info.name);
     }
 
     // 更新缓存：移除消失的设备
-    for (auto& pair : goneDevices) {
-        g_deviceInfos.erase(pair.first);
-        g_deviceStates.erase(pair.first);
-        LOGI("RefreshDevices: 设备离线 deviceId=%s, name=%s",
-             pair.first.c_str(), pair.second.name);
+    for (auto& info : goneDevices) {
+        removeDeviceLocked(findDeviceLocked(info.deviceId));
+        LOGI("RefreshDevices: 设备离线 deviceId=%s, name=%s", info.deviceId, info.name);
     }
 
     // 发送回调（在锁内，简化处理）
-    for (auto& pair : newDevices) {
+    for (auto& info : newDevices) {
         if (g_deviceCallback) {
-            g_deviceCallback(pair.first.c_str(), true, &pair.second);
+            g_deviceCallback(info.deviceId, true, &info);
         }
         if (g_tsfnDevice) {
             struct DeviceEventData {
@@ -1119,18 +1406,18 @@ int GameController_RefreshDevices(void) {
                 GameControllerInfo info;
             };
             DeviceEventData* data = new DeviceEventData();
-            strncpy(data->deviceId, pair.first.c_str(), sizeof(data->deviceId) - 1);
+            strncpy(data->deviceId, info.deviceId, sizeof(data->deviceId) - 1);
             data->isConnected = true;
-            data->info = pair.second;
+            data->info = info;
             napi_status st = napi_call_threadsafe_function(g_tsfnDevice, data, napi_tsfn_nonblocking);
             if (st != napi_ok) delete data;
         }
     }
-    for (auto& pair : goneDevices) {
+    for (auto& gone : goneDevices) {
         if (g_deviceCallback) {
-            GameControllerInfo info = pair.second;
+            GameControllerInfo info = gone;
             info.isConnected = false;
-            g_deviceCallback(pair.first.c_str(), false, &info);
+            g_deviceCallback(gone.deviceId, false, &info);
         }
         if (g_tsfnDevice) {
             struct DeviceEventData {
@@ -1139,9 +1426,9 @@ int GameController_RefreshDevices(void) {
                 GameControllerInfo info;
             };
             DeviceEventData* data = new DeviceEventData();
-            strncpy(data->deviceId, pair.first.c_str(), sizeof(data->deviceId) - 1);
+            strncpy(data->deviceId, gone.deviceId, sizeof(data->deviceId) - 1);
             data->isConnected = false;
-            data->info = pair.second;
+            data->info = gone;
             data->info.isConnected = false;
             napi_status st = napi_call_threadsafe_function(g_tsfnDevice, data, napi_tsfn_nonblocking);
             if (st != napi_ok) delete data;
@@ -1149,7 +1436,7 @@ int GameController_RefreshDevices(void) {
     }
 
     LOGI("RefreshDevices: 新增 %d 个, 移除 %d 个, 当前共 %d 个设备",
-         (int)newDevices.size(), (int)goneDevices.size(), (int)g_deviceInfos.size());
+         (int)newDevices.size(), (int)goneDevices.size(), g_deviceCount);
     return newDeviceCount;
 #else
     return -1;
@@ -1158,7 +1445,7 @@ int GameController_RefreshDevices(void) {
 
 int GameController_GetDeviceCount(void) {
     std::lock_guard<std::mutex> lock(g_mutex);
-    return (int)g_deviceInfos.size();
+    return g_deviceCount;
 }
 
 int GameController_GetDeviceInfo(int index, GameControllerInfo* outInfo) {
@@ -1166,17 +1453,58 @@ int GameController_GetDeviceInfo(int index, GameControllerInfo* outInfo) {
     
     std::lock_guard<std::mutex> lock(g_mutex);
     
-    if (index < 0 || index >= (int)g_deviceInfos.size()) {
+    if (index < 0 || index >= g_deviceCount) {
         return -2;
     }
     
-    auto it = g_deviceInfos.begin();
-    std::advance(it, index);
-    *outInfo = it->second;
+    for (int i = 0; i < GC_MAX_DEVICES; i++) {
+        if (g_devices[i].used && index-- == 0) {
+            *outInfo = g_devices[i].info;
+            return 0;
+        }
+    }
     
+    return -2;
+}
+
+int GameController_SetRouteSlot(const char* deviceId, int slot) {
+    if (slot < -1 || slot >= GC_ROUTE_SLOTS) return -1;
+
+    std::lock_guard<std::mutex> lock(g_mutex);
+    GcDeviceSlot* dev = findDeviceLocked(deviceId);
+    if (!dev) return -2;
+    if (dev->routeSlot == slot) return 0;
+
+    if (slot >= 0) {
+        // 槽位上还没有其他设备时以本设备当前状态为起点（副本设备共享同一份合并状态）
+        bool shared = false;
+        for (int i = 0; i < GC_MAX_DEVICES; i++) {
+            if (g_devices[i].used && &g_devices[i] != dev && g_devices[i].routeSlot == slot) {
+                shared = true;
+                break;
+            }
+        }
+        if (!shared) {
+            memset(&g_routeSlots[slot], 0, sizeof(g_routeSlots[slot]));
+            g_routeSlots[slot].state = dev->state;
+            g_routePendingMask &= ~(1u << slot);
+        }
+        StartRouteThreadLocked();
+    }
+    LOGI("设备 %s 直发槽位: %d -> %d", dev->info.deviceId, dev->routeSlot, slot);
+    dev->routeSlot = slot;
     return 0;
 }
 
+bool GameController_InjectButton(const char* deviceId, uint32_t buttonFlag, bool isPressed) {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    GcDeviceSlot* dev = findDeviceLocked(deviceId);
+    if (!dev || buttonFlag == 0) return false;
+
+    setButtons(&dev->state, buttonFlag, isPressed ? buttonFlag : 0);
+    return routeButtonsLocked(dev, buttonFlag, isPressed ? buttonFlag : 0);
+}
+
 /**
  * 心跳检测 - 检查设备是否仍然连接
  * 
@@ -1204,8 +1532,8 @@ int GameController_HeartbeatCheck(void) {
         return 0;
     }
     
-    // 获取当前连接的设备 ID 集合
-    std::map<std::string, bool> currentDevices;
+    // 标记缓存中仍在系统设备列表里的设备
+    bool present[GC_MAX_DEVICES] = {};
     int count = 0;
     OH_GameDevice_AllDeviceInfos_GetCount(allDeviceInfos, &count);
     
@@ -1216,7 +1544,8 @@ int GameController_HeartbeatCheck(void) {
             char* deviceId = nullptr;
             OH_GameDevice_DeviceInfo_GetDeviceId(deviceInfo, &deviceId);
             if (deviceId) {
-                currentDevices[deviceId] = true;
+                GcDeviceSlot* dev = findDeviceLocked(deviceId);
+                if (dev) present[dev - g_devices] = true;
                 free(deviceId);
             }
             OH_GameDevice_DestroyDeviceInfo(&deviceInfo);
@@ -1224,39 +1553,26 @@ int GameController_HeartbeatCheck(void) {
     }
     OH_GameDevice_DestroyAllDeviceInfos(&allDeviceInfos);
     
-    // 检查缓存的设备是否仍然连接
-    std::vector<std::string> disconnectedIds;
-    for (auto& pair : g_deviceInfos) {
-        if (currentDevices.find(pair.first) == currentDevices.end()) {
-            // 设备不在当前连接列表中，标记为断开
-            disconnectedIds.push_back(pair.first);
-        }
-    }
-    
-    // 发送断开通知（在锁外执行以避免死锁）
-    // 注意: 这里我们释放锁后才发送回调
-    std::vector<std::pair<std::string, GameControllerInfo>> disconnectedDevices;
-    for (const auto& deviceId : disconnectedIds) {
-        auto it = g_deviceInfos.find(deviceId);
-        if (it != g_deviceInfos.end()) {
-            disconnectedDevices.push_back(*it);
-            g_deviceInfos.erase(it);
+    // 检查缓存的设备是否仍然连接：不在当前连接列表中的标记为断开
+    std::vector<GameControllerInfo> disconnectedDevices;
+    for (int i = 0; i < GC_MAX_DEVICES; i++) {
+        if (g_devices[i].used && !present[i]) {
+            disconnectedDevices.push_back(g_devices[i].info);
+            removeDeviceLocked(&g_devices[i]);
+            disconnectedCount++;
         }
-        g_deviceStates.erase(deviceId);
-        disconnectedCount++;
     }
     
     // 释放锁后发送回调
     // 注: 由于回调可能很快，这里简化处理，直接在锁内调用
     // 如果有问题可以改为在锁外调用
-    for (const auto& pair : disconnectedDevices) {
-        LOGI("心跳检测: 设备断开 deviceId=%s, name=%s", 
-             pair.first.c_str(), pair.second.name);
+    for (const auto& gone : disconnectedDevices) {
+        LOGI("心跳检测: 设备断开 deviceId=%s, name=%s", gone.deviceId, gone.name);
         
         if (g_deviceCallback) {
-            GameControllerInfo info = pair.second;
+            GameControllerInfo info = gone;
             info.isConnected = false;
-            g_deviceCallback(pair.first.c_str(), false, &info);
+            g_deviceCallback(gone.deviceId, false, &info);
         }
         
         // NAPI 异步通知
@@ -1267,9 +1583,9 @@ int GameController_HeartbeatCheck(void) {
                 GameControllerInfo info;
             };
             DeviceEventData* eventData = new DeviceEventData();
-            strncpy(eventData->deviceId, pair.first.c_str(), sizeof(eventData->deviceId) - 1);
+            strncpy(eventData->deviceId, gone.deviceId, sizeof(eventData->deviceId) - 1);
             eventData->isConnected = false;
-            eventData->info = pair.second;
+            eventData->info = gone;
             eventData->info.isConnected = false;
             napi_call_threadsafe_function(g_tsfnDevice, eventData, napi_tsfn_blocking);
         }
@@ -1337,11 +1653,6 @@ static void DeviceCallbackCallJS(napi_env env, napi_value js_callback, void* con
 static void ButtonCallbackCallJS(napi_env env, napi_value js_callback, void* context, void* data) {
     if (!data) return;
     
-    struct ButtonEventData {
-        char deviceId[64];
-        int32_t buttonCode;
-        bool isPressed;
-    };
     ButtonEventData* eventData = (ButtonEventData*)data;
     
     if (!env || !js_callback) {
@@ -1349,12 +1660,13 @@ static void ButtonCallbackCallJS(napi_env env, napi_value js_callback, void* con
         return;
     }
     
-    napi_value argv[3];
+    napi_value argv[4];
     napi_create_string_utf8(env, eventData->deviceId, NAPI_AUTO_LENGTH, &argv[0]);
     napi_create_int32(env, eventData->buttonCode, &argv[1]);
     napi_get_boolean(env, eventData->isPressed, &argv[2]);
+    napi_get_boolean(env, eventData->routed, &argv[3]);
     
-    napi_call_function(env, nullptr, js_callback, 3, argv, nullptr);
+    napi_call_function(env, nullptr, js_callback, 4, argv, nullptr);
     
     delete eventData;
 }
@@ -1362,12 +1674,6 @@ static void ButtonCallbackCallJS(napi_env env, napi_value js_callback, void* con
 static void AxisCallbackCallJS(napi_env env, napi_value js_callback, void* context, void* data) {
     if (!data) return;
     
-    struct AxisEventData {
-        char deviceId[64];
-        int32_t axisType;
-        double x;
-        double y;
-    };
     AxisEventData* eventData = (AxisEventData*)data;
     
     if (!env || !js_callback) {
@@ -1492,7 +1798,7 @@ static napi_value NapiSetDeviceCallback(napi_env env, napi_callback_info info) {
 }
 
 /**
- * setButtonCallback(callback: (deviceId: string, buttonCode: number, isPressed: boolean) => void): void
+ * setButtonCallback(callback: (deviceId: string, buttonCode: number, isPressed: boolean, routed: boolean) => void): void
  */
 static napi_value NapiSetButtonCallback(napi_env env, napi_callback_info info) {
     size_t argc = 1;
@@ -1643,6 +1949,79 @@ static napi_value NapiRefreshDevices(napi_env env, napi_callback_info info) {
     return result;
 }
 
+/**
+ * setRouteSlot(deviceId: string, slot: number): boolean
+ * 设置设备的 native 直发槽位，-1 = 交还 ArkTS
+ */
+static napi_value NapiSetRouteSlot(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    bool ok = false;
+    if (argc >= 2) {
+        char deviceId[64] = {0};
+        size_t len = 0;
+        int32_t slot = -1;
+        napi_get_value_string_utf8(env, args[0], deviceId, sizeof(deviceId), &len);
+        napi_get_value_int32(env, args[1], &slot);
+        ok = GameController_SetRouteSlot(deviceId, slot) == 0;
+    }
+
+    napi_value result;
+    napi_get_boolean(env, ok, &result);
+    return result;
+}
+
+/**
+ * injectButton(deviceId: string, buttonFlag: number, isPressed: boolean): boolean
+ * 合入不经 GCK 回调到达的按键（如 KeyEvent 2313），返回 true 表示已由 native 发送
+ */
+static napi_value NapiInjectButton(napi_env env, napi_callback_info info) {
+    size_t argc = 3;
+    napi_value args[3];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    bool routed = false;
+    if (argc >= 3) {
+        char deviceId[64] = {0};
+        size_t len = 0;
+        uint32_t buttonFlag = 0;
+        bool isPressed = false;
+        napi_get_value_string_utf8(env, args[0], deviceId, sizeof(deviceId), &len);
+        napi_get_value_uint32(env, args[1], &buttonFlag);
+        napi_get_value_bool(env, args[2], &isPressed);
+        routed = GameController_InjectButton(deviceId, buttonFlag, isPressed);
+    }
+
+    napi_value result;
+    napi_get_boolean(env, routed, &result);
+    return result;
+}
+
+/**
+ * getRouteStats(): { routedEvents, batchesSent, edgeFlushes, jsNotifications }
+ */
+static napi_value NapiGetRouteStats(napi_env env, napi_callback_info info) {
+    napi_value result;
+    napi_create_object(env, &result);
+
+    napi_value val;
+    napi_create_double(env, (double)g_routedEvents.load(std::memory_order_relaxed), &val);
+    napi_set_named_property(env, result, "routedEvents", val);
+
+    napi_create_double(env, (double)g_routeBatches.load(std::memory_order_relaxed), &val);
+    napi_set_named_property(env, result, "batchesSent", val);
+
+    napi_create_double(env, (double)g_routeEdgeFlushes.load(std::memory_order_relaxed), &val);
+    napi_set_named_property(env, result, "edgeFlushes", val);
+
+    napi_create_double(env, (double)g_jsNotifications.load(std::memory_order_relaxed), &val);
+    napi_set_named_property(env, result, "jsNotifications", val);
+
+    return result;
+}
+
 /**
  * 初始化 NAPI 模块
  */
@@ -1666,6 +2045,9 @@ napi_value GameControllerNapi_Init(napi_env env, napi_value exports) {
         { "getDeviceInfo", nullptr, NapiGetDeviceInfo, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "heartbeatCheck", nullptr, NapiHeartbeatCheck, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "refreshDevices", nullptr, NapiRefreshDevices, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setRouteSlot", nullptr, NapiSetRouteSlot, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "injectButton", nullptr, NapiInjectButton, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "getRouteStats", nullptr, NapiGetRouteStats, nullptr, nullptr, nullptr, napi_default, nullptr },
     };
     
     napi_define_properties(env, gameControllerObj, sizeof(props) / sizeof(props[0]), props);
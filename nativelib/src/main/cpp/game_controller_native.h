@@ -230,6 +230,27 @@ int GameController_RefreshDevices(void);
  */
 int GameController_HeartbeatCheck(void);
 
+/**
+ * 设置设备的 native 直发槽位
+ *
+ * 绑定后（且该槽位在 ControllerInputRouter 以外部来源绑定、串流已连接），
+ * 该设备的轴 / 按键回调合并后由发送线程直接调用 LiSendMultiControllerEvent，
+ * 不再逐事件投递 JS；JS 只收到连接变化、Start 按键（长按菜单）和节流后的快照。
+ * 同一物理手柄的多个 HID 接口可绑定同一槽位，共享一份合并状态。
+ *
+ * @param deviceId 设备 ID
+ * @param slot 手柄槽位 (0-3)，-1 = 交还 JS
+ * @return 0=成功, -1=槽位无效, -2=设备未知
+ */
+int GameController_SetRouteSlot(const char* deviceId, int slot);
+
+/**
+ * 合入不经 Game Controller Kit 回调到达的按键（如 KeyEvent 2313）
+ * @param buttonFlag GC_BTN_* 标志位
+ * @return true = 已由 native 发送，调用方不必再经 JS 发送
+ */
+bool GameController_InjectButton(const char* deviceId, uint32_t buttonFlag, bool isPressed);
+
 // ==================== NAPI 导出函数 ====================
 
 /**
@@ -17,6 +17,8 @@
 
 #include "gamepad_napi.h"
 #include "sdl_gamecontrollerdb.h"
+#include "hid_report_plan.h"
+#include "controller_db_generated.h"
 #include <hilog/log.h>
 #include <string.h>
 #include <stdlib.h>
@@ -367,19 +369,28 @@ static const VendorFallback g_vendorFallbacks[] = {
     {0, NULL, 0}
 };
 
+// 两张表的下标已编入 controller_db_generated.h 的 VID/PID 哈希表，修改后需重新运行生成器
+static_assert(sizeof(g_knownGamepads) / sizeof(g_knownGamepads[0]) - 1 == CONTROLLER_DB_KNOWN_GAMEPADS,
+              "g_knownGamepads changed: rerun nativelib/tools/gen_controller_db.py");
+static_assert(sizeof(g_vendorFallbacks) / sizeof(g_vendorFallbacks[0]) - 1 == CONTROLLER_DB_VENDOR_FALLBACKS,
+              "g_vendorFallbacks changed: rerun nativelib/tools/gen_controller_db.py");
+
 // ==================== 手柄信息查询 ====================
 
 /**
  * 查找手柄信息 (精确匹配 VID/PID)
  */
 static const KnownGamepad* findGamepad(uint16_t vendorId, uint16_t productId) {
-    for (int i = 0; g_knownGamepads[i].name != NULL; i++) {
-        if (g_knownGamepads[i].vendorId == vendorId && 
-            g_knownGamepads[i].productId == productId) {
-            return &g_knownGamepads[i];
-        }
-    }
-    return NULL;
+    const ControllerDbEntry* e = findControllerDbDevice(vendorId, productId);
+    return (e && e->knownIndex >= 0) ? &g_knownGamepads[e->knownIndex] : NULL;
+}
+
+/**
+ * 查找厂商回退信息
+ */
+static const VendorFallback* findVendorFallback(uint16_t vendorId) {
+    const ControllerDbEntry* e = findControllerDbVendor(vendorId);
+    return (e && e->knownIndex >= 0) ? &g_vendorFallbacks[e->knownIndex] : NULL;
 }
 
 /**
@@ -387,12 +398,11 @@ static const KnownGamepad* findGamepad(uint16_t vendorId, uint16_t productId) {
  * @return 类型: 0=Unknown, 1=Xbox, 2=PlayStation, 3=Switch
  */
 static int32_t inferGamepadTypeByVendor(uint16_t vendorId) {
-    for (int i = 0; g_vendorFallbacks[i].vendorName != NULL; i++) {
-        if (g_vendorFallbacks[i].vendorId == vendorId) {
-            LOGI("Using vendor fallback: VID=0x%04X -> type=%d (%s)", 
-                 vendorId, g_vendorFallbacks[i].defaultType, g_vendorFallbacks[i].vendorName);
-            return g_vendorFallbacks[i].defaultType;
-        }
+    const VendorFallback* fallback = findVendorFallback(vendorId);
+    if (fallback) {
+        LOGI("Using vendor fallback: VID=0x%04X -> type=%d (%s)", 
+             vendorId, fallback->defaultType, fallback->vendorName);
+        return fallback->defaultType;
     }
     return 0; // Generic
 }
@@ -611,12 +621,6 @@ static void parseGenericHidReport(const uint8_t* data, size_t len, NapiGamepadSt
 static void parseDS4Report(const uint8_t* data, size_t len, NapiGamepadState* state) {
     if (len < 10) return;
     
-    // 调试：打印前 16 字节的数据
-    LOGI("DS4 Report (len=%zu): %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X",
-         len,
-         data[0], data[1], data[2], data[3], data[4], data[5], data[6], data[7],
-         data[8], data[9], data[10], data[11], data[12], data[13], data[14], data[15]);
-    
     // 摇杆 (0x00-0xFF -> -32768 to 32512)
     // 使用 <<8 (*256) 避免 int16_t 溢出导致的方向反转
     // Y 轴方向由上层 GamepadManager 统一处理取反
@@ -629,9 +633,6 @@ static void parseDS4Report(const uint8_t* data, size_t len, NapiGamepadState* st
     state->leftTrigger = data[8];
     state->rightTrigger = data[9];
     
-    // 调试：打印扳机值
-    LOGI("DS4 Triggers: L2=%d R2=%d", state->leftTrigger, state->rightTrigger);
-    
     // D-Pad (low nibble of byte 5)
     state->buttons = 0;
     uint8_t dpad = data[5] & 0x0F;
@@ -727,6 +728,7 @@ static void parseDualSenseReport(const uint8_t* data, size_t len, NapiGamepadSta
     // PS/Mute/Touchpad
     if (buttons3 & 0x01) state->buttons |= BTN_FLAG_HOME;
     if (buttons3 & 0x02) state->buttons |= BTN_FLAG_TOUCHPAD;
+    if (buttons3 & 0x04) state->buttons |= BTN_FLAG_MISC;
 }
 
 /**
@@ -802,6 +804,91 @@ static void parseXboxReport(const uint8_t* data, size_t len, NapiGamepadState* s
     state->rightStickY = (int16_t)(data[16] | (data[17] << 8));
 }
 
+/**
+ * int16 取反（-32768 取反溢出，钳位到 32767）
+ */
+static int16_t negateAxis(int16_t v) {
+    return v == INT16_MIN ? INT16_MAX : (int16_t)-v;
+}
+
+/**
+ * 解析 Xbox One / Series GIP 输入报告 (0x20, ≥18 字节)
+ * [4] = Menu 0x04 / View 0x08 / A 0x10 / B 0x20 / X 0x40 / Y 0x80
+ * [5] = 上 0x01 / 下 0x02 / 左 0x04 / 右 0x08 / LB 0x10 / RB 0x20 / LS 0x40 / RS 0x80
+ * [6-9] = 扳机 (10-bit LE)，[10-17] = 摇杆 (int16 LE，Y 向上为正)
+ * Guide 键不在此报告中 (见 0x07 模式报告)，保留 state 中已有的 HOME 位。
+ */
+static void parseXboxGipReport(const uint8_t* data, NapiGamepadState* state) {
+    uint8_t b1 = data[4];
+    uint8_t b2 = data[5];
+    uint32_t buttons = state->buttons & BTN_FLAG_HOME;
+    
+    if (b1 & 0x04) buttons |= BTN_FLAG_START;
+    if (b1 & 0x08) buttons |= BTN_FLAG_BACK;
+    if (b1 & 0x10) buttons |= BTN_FLAG_A;
+    if (b1 & 0x20) buttons |= BTN_FLAG_B;
+    if (b1 & 0x40) buttons |= BTN_FLAG_X;
+    if (b1 & 0x80) buttons |= BTN_FLAG_Y;
+    
+    if (b2 & 0x01) buttons |= BTN_FLAG_UP;
+    if (b2 & 0x02) buttons |= BTN_FLAG_DOWN;
+    if (b2 & 0x04) buttons |= BTN_FLAG_LEFT;
+    if (b2 & 0x08) buttons |= BTN_FLAG_RIGHT;
+    if (b2 & 0x10) buttons |= BTN_FLAG_LB;
+    if (b2 & 0x20) buttons |= BTN_FLAG_RB;
+    if (b2 & 0x40) buttons |= BTN_FLAG_LS_CLK;
+    if (b2 & 0x80) buttons |= BTN_FLAG_RS_CLK;
+    state->buttons = buttons;
+    
+    int lt = data[6] | (data[7] << 8);
+    int rt = data[8] | (data[9] << 8);
+    state->leftTrigger = (uint8_t)((lt > 1023 ? 1023 : lt) * 255 / 1023);
+    state->rightTrigger = (uint8_t)((rt > 1023 ? 1023 : rt) * 255 / 1023);
+    
+    // 与其他解析器一致输出 HID 方向 (Y 向下为正)
+    state->leftStickX = (int16_t)(data[10] | (data[11] << 8));
+    state->leftStickY = negateAxis((int16_t)(data[12] | (data[13] << 8)));
+    state->rightStickX = (int16_t)(data[14] | (data[15] << 8));
+    state->rightStickY = negateAxis((int16_t)(data[16] | (data[17] << 8)));
+}
+
+/**
+ * 解析 Xbox 360 输入报告 ([0]=0x00, [1]=0x14, ≥14 字节)
+ * [2] = 上/下/左/右/Start/Back/LS/RS，[3] = LB 0x01 / RB 0x02 / Guide 0x04 / A/B/X/Y 0x10-0x80
+ * [4-5] = 扳机，[6-13] = 摇杆 (int16 LE，Y 向上为正)
+ */
+static void parseXbox360Report(const uint8_t* data, NapiGamepadState* state) {
+    uint8_t b1 = data[2];
+    uint8_t b2 = data[3];
+    uint32_t buttons = 0;
+    
+    if (b1 & 0x01) buttons |= BTN_FLAG_UP;
+    if (b1 & 0x02) buttons |= BTN_FLAG_DOWN;
+    if (b1 & 0x04) buttons |= BTN_FLAG_LEFT;
+    if (b1 & 0x08) buttons |= BTN_FLAG_RIGHT;
+    if (b1 & 0x10) buttons |= BTN_FLAG_START;
+    if (b1 & 0x20) buttons |= BTN_FLAG_BACK;
+    if (b1 & 0x40) buttons |= BTN_FLAG_LS_CLK;
+    if (b1 & 0x80) buttons |= BTN_FLAG_RS_CLK;
+    
+    if (b2 & 0x01) buttons |= BTN_FLAG_LB;
+    if (b2 & 0x02) buttons |= BTN_FLAG_RB;
+    if (b2 & 0x04) buttons |= BTN_FLAG_HOME;
+    if (b2 & 0x10) buttons |= BTN_FLAG_A;
+    if (b2 & 0x20) buttons |= BTN_FLAG_B;
+    if (b2 & 0x40) buttons |= BTN_FLAG_X;
+    if (b2 & 0x80) buttons |= BTN_FLAG_Y;
+    state->buttons = buttons;
+    
+    state->leftTrigger = data[4];
+    state->rightTrigger = data[5];
+    
+    state->leftStickX = (int16_t)(data[6] | (data[7] << 8));
+    state->leftStickY = negateAxis((int16_t)(data[8] | (data[9] << 8)));
+    state->rightStickX = (int16_t)(data[10] | (data[11] << 8));
+    state->rightStickY = negateAxis((int16_t)(data[12] | (data[13] << 8)));
+}
+
 /**
  * 解析 Switch Pro Controller 报告
  */
@@ -861,8 +948,111 @@ static void parseSwitchProReport(const uint8_t* data, size_t len, NapiGamepadSta
     }
 }
 
+// ==================== Native 解析接口 ====================
+
+int GamepadNapi_ParseReport(int type, uint16_t vendorId, uint16_t productId,
+                            const uint8_t* data, size_t len, NapiGamepadState* state) {
+    if (!data || !state || len == 0) {
+        return GAMEPAD_REPORT_IGNORED;
+    }
+    
+    switch (type) {
+        case 1: // Xbox (DDK 路径按报告头区分 GIP / 360)
+            if (data[0] == 0x20 && len >= 18) {
+                parseXboxGipReport(data, state);
+                return GAMEPAD_REPORT_INPUT;
+            }
+            if (data[0] == 0x07 && len >= 5) {
+                // 模式报告：只携带 Guide 键
+                if (data[4] & 0x01) {
+                    state->buttons |= BTN_FLAG_HOME;
+                } else {
+                    state->buttons &= ~BTN_FLAG_HOME;
+                }
+                return GAMEPAD_REPORT_PARTIAL;
+            }
+            if (data[0] == 0x00 && data[1] == 0x14 && len >= 14) {
+                parseXbox360Report(data, state);
+                return GAMEPAD_REPORT_INPUT;
+            }
+            return GAMEPAD_REPORT_IGNORED;
+        case 2: // PlayStation (DS4)
+            if (data[0] != 0x01 || len < 10) return GAMEPAD_REPORT_IGNORED;
+            parseDS4Report(data, len, state);
+            return GAMEPAD_REPORT_INPUT;
+        case 3: // Switch
+            if (data[0] != 0x30 || len < 13) return GAMEPAD_REPORT_IGNORED;
+            parseSwitchProReport(data, len, state);
+            return GAMEPAD_REPORT_INPUT;
+        case 5: // DualSense (PS5)
+            if (data[0] != 0x01 || len < 11) return GAMEPAD_REPORT_IGNORED;
+            parseDualSenseReport(data, len, state);
+            return GAMEPAD_REPORT_INPUT;
+        default: { // Generic (0 或 4)：优先 SDL GameControllerDB 映射
+            const GamepadMapping* sdlMapping = findGamepadMapping(vendorId, productId);
+            if (sdlMapping) {
+                applyGamepadMapping(
+                    sdlMapping,
+                    data, (int)len,
+                    &state->buttons,
+                    &state->leftStickX, &state->leftStickY,
+                    &state->rightStickX, &state->rightStickY,
+                    &state->leftTrigger, &state->rightTrigger
+                );
+            } else {
+                parseGenericHidReport(data, len, state);
+            }
+            return GAMEPAD_REPORT_INPUT;
+        }
+    }
+}
+
 // ==================== NAPI 函数实现 ====================
 
+static bool getByteArg(napi_env env, napi_value value, uint8_t** data, size_t* len) {
+    bool isArrayBuffer = false;
+    napi_is_arraybuffer(env, value, &isArrayBuffer);
+    if (isArrayBuffer) {
+        return napi_get_arraybuffer_info(env, value, (void**)data, len) == napi_ok;
+    }
+    napi_typedarray_type type;
+    napi_value arrayBuffer;
+    size_t offset;
+    return napi_get_typedarray_info(env, value, &type, len, (void**)data, &arrayBuffer, &offset) == napi_ok;
+}
+
+static napi_value createStateObject(napi_env env, const NapiGamepadState& state) {
+    napi_value result;
+    napi_create_object(env, &result);
+    
+    napi_value val;
+    napi_create_int32(env, state.deviceId, &val);
+    napi_set_named_property(env, result, "deviceId", val);
+    
+    napi_create_uint32(env, state.buttons, &val);
+    napi_set_named_property(env, result, "buttons", val);
+    
+    napi_create_int32(env, state.leftStickX, &val);
+    napi_set_named_property(env, result, "leftStickX", val);
+    
+    napi_create_int32(env, state.leftStickY, &val);
+    napi_set_named_property(env, result, "leftStickY", val);
+    
+    napi_create_int32(env, state.rightStickX, &val);
+    napi_set_named_property(env, result, "rightStickX", val);
+    
+    napi_create_int32(env, state.rightStickY, &val);
+    napi_set_named_property(env, result, "rightStickY", val);
+    
+    napi_create_uint32(env, state.leftTrigger, &val);
+    napi_set_named_property(env, result, "leftTrigger", val);
+    
+    napi_create_uint32(env, state.rightTrigger, &val);
+    napi_set_named_property(env, result, "rightTrigger", val);
+    
+    return result;
+}
+
 napi_value GamepadNapi_ParseHidReport(napi_env env, napi_callback_info info) {
     size_t argc = 4;  // 支持可选的第4个参数（强制协议类型）
     napi_value args[4];
@@ -964,35 +1154,135 @@ napi_value GamepadNapi_ParseHidReport(napi_env env, napi_callback_info info) {
         }
     }
     
-    // 创建返回对象
+    return createStateObject(env, state);
+}
+
+// ==================== 描述符编译计划 ====================
+
+#define MAX_REPORT_PLANS 8
+
+// 计划只在 ArkTS 主线程上编译 / 使用 / 释放
+static HidReportPlan g_reportPlans[MAX_REPORT_PLANS];
+static bool g_reportPlanUsed[MAX_REPORT_PLANS] = {false};
+
+napi_value GamepadNapi_CompileReportDescriptor(napi_env env, napi_callback_info info) {
+    size_t argc = 3;
+    napi_value args[3];
+    napi_get_cb_info(env, info, &argc, args, NULL, NULL);
+    
+    if (argc < 3) {
+        napi_throw_error(env, NULL, "Expected 3 arguments: vendorId, productId, descriptor");
+        return NULL;
+    }
+    
+    uint32_t vendorId = 0, productId = 0;
+    napi_get_value_uint32(env, args[0], &vendorId);
+    napi_get_value_uint32(env, args[1], &productId);
+    
+    uint8_t* desc = NULL;
+    size_t len = 0;
+    getByteArg(env, args[2], &desc, &len);
+    
+    int32_t planId = -1;
+    HidReportPlan* plan = NULL;
+    for (int i = 0; i < MAX_REPORT_PLANS; i++) {
+        if (!g_reportPlanUsed[i]) {
+            planId = i;
+            plan = &g_reportPlans[i];
+            break;
+        }
+    }
+    
+    if (plan) {
+        const GamepadMapping* sdlMapping = findGamepadMapping((uint16_t)vendorId, (uint16_t)productId);
+        if (desc && HidPlan_Compile(desc, len, sdlMapping, plan)) {
+            g_reportPlanUsed[planId] = true;
+            LOGI("Compiled HID plan %d for VID=0x%04X PID=0x%04X: reportId=%u buttons=%u axes=%u hats=%u ops=%u run=%u sdl=%d",
+                 planId, vendorId, productId, plan->reportId, plan->buttonCount, plan->axisCount,
+                 plan->hatCount, plan->opCount, plan->buttonRunCount, plan->usedSdlMapping ? 1 : 0);
+        } else {
+            LOGW("No usable gamepad fields in HID descriptor (VID=0x%04X PID=0x%04X len=%zu)",
+                 vendorId, productId, len);
+            planId = -1;
+        }
+    } else {
+        LOGW("No free HID plan slot");
+    }
+    
     napi_value result;
     napi_create_object(env, &result);
     
     napi_value val;
-    napi_create_int32(env, state.deviceId, &val);
-    napi_set_named_property(env, result, "deviceId", val);
+    napi_create_int32(env, planId, &val);
+    napi_set_named_property(env, result, "planId", val);
     
-    napi_create_uint32(env, state.buttons, &val);
+    const bool ok = planId >= 0;
+    napi_create_uint32(env, ok ? plan->reportId : 0, &val);
+    napi_set_named_property(env, result, "reportId", val);
+    
+    napi_create_uint32(env, ok ? plan->buttonCount : 0, &val);
     napi_set_named_property(env, result, "buttons", val);
     
-    napi_create_int32(env, state.leftStickX, &val);
-    napi_set_named_property(env, result, "leftStickX", val);
+    napi_create_uint32(env, ok ? plan->axisCount : 0, &val);
+    napi_set_named_property(env, result, "axes", val);
     
-    napi_create_int32(env, state.leftStickY, &val);
-    napi_set_named_property(env, result, "leftStickY", val);
+    napi_create_uint32(env, ok ? plan->hatCount : 0, &val);
+    napi_set_named_property(env, result, "hats", val);
     
-    napi_create_int32(env, state.rightStickX, &val);
-    napi_set_named_property(env, result, "rightStickX", val);
+    napi_create_uint32(env, ok ? plan->opCount + plan->buttonRunCount : 0, &val);
+    napi_set_named_property(env, result, "ops", val);
     
-    napi_create_int32(env, state.rightStickY, &val);
-    napi_set_named_property(env, result, "rightStickY", val);
+    napi_get_boolean(env, ok && plan->usedSdlMapping, &val);
+    napi_set_named_property(env, result, "usedSdlMapping", val);
     
-    napi_create_uint32(env, state.leftTrigger, &val);
-    napi_set_named_property(env, result, "leftTrigger", val);
+    return result;
+}
+
+napi_value GamepadNapi_ParseHidReportWithPlan(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, NULL, NULL);
     
-    napi_create_uint32(env, state.rightTrigger, &val);
-    napi_set_named_property(env, result, "rightTrigger", val);
+    napi_value nullValue;
+    napi_get_null(env, &nullValue);
+    if (argc < 2) {
+        return nullValue;
+    }
     
+    int32_t planId = -1;
+    napi_get_value_int32(env, args[0], &planId);
+    if (planId < 0 || planId >= MAX_REPORT_PLANS || !g_reportPlanUsed[planId]) {
+        return nullValue;
+    }
+    
+    uint8_t* data = NULL;
+    size_t len = 0;
+    if (!getByteArg(env, args[1], &data, &len) || !data) {
+        return nullValue;
+    }
+    
+    NapiGamepadState state = {0};
+    if (HidPlan_Apply(&g_reportPlans[planId], data, len, &state) != GAMEPAD_REPORT_INPUT) {
+        return nullValue;
+    }
+    return createStateObject(env, state);
+}
+
+napi_value GamepadNapi_ReleaseReportPlan(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, NULL, NULL);
+    
+    int32_t planId = -1;
+    if (argc >= 1) {
+        napi_get_value_int32(env, args[0], &planId);
+    }
+    if (planId >= 0 && planId < MAX_REPORT_PLANS) {
+        g_reportPlanUsed[planId] = false;
+    }
+    
+    napi_value result;
+    napi_get_undefined(env, &result);
     return result;
 }
 
@@ -1056,13 +1346,8 @@ napi_value GamepadNapi_GetGamepadName(napi_env env, napi_callback_info info) {
         name = gamepad->name;
     } else {
         // 尝试基于 VID 生成有意义的名称
-        const char* vendorName = "Unknown";
-        for (int i = 0; g_vendorFallbacks[i].vendorName != NULL; i++) {
-            if (g_vendorFallbacks[i].vendorId == (uint16_t)vendorId) {
-                vendorName = g_vendorFallbacks[i].vendorName;
-                break;
-            }
-        }
+        const VendorFallback* fallback = findVendorFallback((uint16_t)vendorId);
+        const char* vendorName = fallback ? fallback->vendorName : "Unknown";
         snprintf(nameBuffer, sizeof(nameBuffer), "%s Gamepad (0x%04X:0x%04X)", 
                  vendorName, vendorId, productId);
         name = nameBuffer;
@@ -1223,6 +1508,10 @@ napi_value GamepadNapi_Init(napi_env env, napi_value exports) {
         // SDL GameControllerDB 映射相关
         {"hasSDLMapping", NULL, GamepadNapi_HasSDLMapping, NULL, NULL, NULL, napi_default, NULL},
         {"getSDLMappingInfo", NULL, GamepadNapi_GetSDLMappingInfo, NULL, NULL, NULL, napi_default, NULL},
+        // HID 描述符编译计划
+        {"compileReportDescriptor", NULL, GamepadNapi_CompileReportDescriptor, NULL, NULL, NULL, napi_default, NULL},
+        {"parseHidReportWithPlan", NULL, GamepadNapi_ParseHidReportWithPlan, NULL, NULL, NULL, napi_default, NULL},
+        {"releaseReportPlan", NULL, GamepadNapi_ReleaseReportPlan, NULL, NULL, NULL, napi_default, NULL},
     };
     
     napi_value gamepadObj;
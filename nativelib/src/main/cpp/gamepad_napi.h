@@ -77,6 +77,27 @@ typedef struct {
 #define BTN_FLAG_TOUCHPAD    0x00100000
 #define BTN_FLAG_MISC        0x00200000
 
+/**
+ * GamepadNapi_ParseReport 返回值
+ */
+#define GAMEPAD_REPORT_IGNORED   0   // 非输入报告，state 未改变
+#define GAMEPAD_REPORT_INPUT     1   // 输入报告，state 已更新
+#define GAMEPAD_REPORT_PARTIAL   2   // 只更新了部分按钮 (如 Xbox One 0x07 Guide 报告)
+
+/**
+ * 按协议类型解析一帧输入报告 (供 native 输入路由在轮询线程直接调用，不分配、不写日志)
+ *
+ * 与 parseHidReport 使用相同的解析器，但按报告 ID / 长度过滤非输入报告；
+ * Xbox 类型按 GIP (0x20 / 0x07) 与 Xbox 360 (0x00 0x14) 报告头分别解析。
+ * state 在调用之间保留（Xbox One 的 Guide 键来自单独的报告）。
+ * 输出摇杆 Y 轴为 HID 方向（向下为正），与 parseHidReport 一致。
+ *
+ * @param type 1=Xbox, 2=DS4, 3=Switch Pro, 5=DualSense, 其他=Generic (SDL 映射 / 启发式)
+ * @return GAMEPAD_REPORT_*
+ */
+int GamepadNapi_ParseReport(int type, uint16_t vendorId, uint16_t productId,
+                            const uint8_t* data, size_t len, NapiGamepadState* state);
+
 /**
  * NAPI 导出函数
  */
@@ -104,6 +125,18 @@ napi_value GamepadNapi_GetGamepadName(napi_env env, napi_callback_info info);
 // createRumbleCommand(vendorId: number, productId: number, lowFreq: number, highFreq: number): Uint8Array | null
 napi_value GamepadNapi_CreateRumbleCommand(napi_env env, napi_callback_info info);
 
+// 编译 HID 报告描述符为字段提取计划 (见 hid_report_plan.h)，planId < 0 表示失败
+// compileReportDescriptor(vendorId: number, productId: number, descriptor: Uint8Array): HidReportPlanInfo
+napi_value GamepadNapi_CompileReportDescriptor(napi_env env, napi_callback_info info);
+
+// 按已编译的计划解析报告，Report ID 不匹配或报告过短时返回 null
+// parseHidReportWithPlan(planId: number, data: Uint8Array): GamepadState | null
+napi_value GamepadNapi_ParseHidReportWithPlan(napi_env env, napi_callback_info info);
+
+// 释放计划槽位
+// releaseReportPlan(planId: number): void
+napi_value GamepadNapi_ReleaseReportPlan(napi_env env, napi_callback_info info);
+
 #ifdef __cplusplus
 }
 #endif
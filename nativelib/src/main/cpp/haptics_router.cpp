@@ -0,0 +1,534 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file haptics_router.cpp
+ * @brief Native 振动路由实现
+ */
+
+#include "haptics_router.h"
+#include "usb_ddk_poller.h"
+
+#include <string.h>
+#include <time.h>
+#include <atomic>
+#include <mutex>
+#include <hilog/log.h>
+
+#define LOG_TAG "HapticsRouter"
+
+// 与 GamepadManager 槽位数一致 (0-3)
+#define HAPTICS_MAX_SLOTS 4
+#define HAPTICS_MAX_REPORT 64
+
+// 音频驱动的非零更新最短间隔（分析器本身已节流到 25/40ms，这里防止与游戏 rumble 叠加后过密）
+static const uint64_t MIN_AUDIO_SEND_INTERVAL_NS = 8ULL * 1000000ULL;
+// 低于该有效强度视为停止（与 AudioVibrationService 一致）
+static const int MIN_EFFECTIVE_INTENSITY = 5;
+
+struct HapticsSlot {
+    bool bound;
+    int pollerId;
+    uint32_t pollerGeneration;  // 绑定时的轮询器启动代号
+    uint8_t endpoint;
+    uint8_t report[HAPTICS_MAX_REPORT];
+    uint32_t reportLen;
+    int lowOffset;
+    int highOffset;
+    int seqOffset;              // -1 = 无序号字节
+    int leftTriggerOffset;      // -1 = 无扳机马达
+    int rightTriggerOffset;
+    uint8_t seq;
+
+    uint16_t gameLow;
+    uint16_t gameHigh;
+    uint16_t audioLow;
+    uint16_t audioHigh;
+    uint16_t audioLeftTrigger;
+    uint16_t audioRightTrigger;
+
+    uint8_t lastLowByte;
+    uint8_t lastHighByte;
+    uint8_t lastLeftTriggerByte;
+    uint8_t lastRightTriggerByte;
+    bool lastValid;
+    uint64_t lastSendNs;
+
+    bool pending;               // 有被限频推迟的音频更新
+    uint64_t pendingOriginNs;
+};
+
+static HapticsSlot g_slots[HAPTICS_MAX_SLOTS];
+static std::mutex g_hapticsMutex;
+static std::atomic<uint32_t> g_pendingMask{0};  // 有挂起更新的槽位位图 (tick 快速路径)
+
+// 音频配置
+static bool g_audioEnabled = false;
+static int g_audioStrength = 100;
+
+// ArkTS 仍需收到回调的场景（设备马达振动 / 有未绑定的手柄）
+static std::atomic<bool> g_forwardGameToJs{true};
+static std::atomic<bool> g_forwardAudioToJs{true};
+
+// 统计
+static std::atomic<uint64_t> g_audioEvents{0};
+static std::atomic<uint64_t> g_gameEvents{0};
+static std::atomic<uint64_t> g_commandsQueued{0};
+static std::atomic<uint64_t> g_deduped{0};
+static std::atomic<uint64_t> g_rateLimited{0};
+static std::atomic<uint64_t> g_queueFailed{0};
+
+// ============================================================
+// 内部实现 (调用方持有 g_hapticsMutex)
+// ============================================================
+
+static uint64_t monotonicNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void clearPendingLocked(HapticsSlot *slot) {
+    if (slot->pending) {
+        slot->pending = false;
+        g_pendingMask.fetch_and(~(1u << (uint32_t)(slot - g_slots)), std::memory_order_relaxed);
+    }
+}
+
+static void sendSlotLocked(HapticsSlot *slot, bool fromAudio, uint64_t originNs) {
+    uint16_t low = slot->gameLow > slot->audioLow ? slot->gameLow : slot->audioLow;
+    uint16_t high = slot->gameHigh > slot->audioHigh ? slot->gameHigh : slot->audioHigh;
+    // 驱动报告里马达都是 8 位强度 (value >> 8)
+    uint8_t lowByte = (uint8_t)(low >> 8);
+    uint8_t highByte = (uint8_t)(high >> 8);
+    // 扳机马达与 ArkTS 驱动一致取 (value >> 9)；只有音频分量
+    uint8_t leftTriggerByte = slot->leftTriggerOffset >= 0 ? (uint8_t)(slot->audioLeftTrigger >> 9) : 0;
+    uint8_t rightTriggerByte = slot->rightTriggerOffset >= 0 ? (uint8_t)(slot->audioRightTrigger >> 9) : 0;
+
+    if (slot->lastValid && lowByte == slot->lastLowByte && highByte == slot->lastHighByte &&
+        leftTriggerByte == slot->lastLeftTriggerByte && rightTriggerByte == slot->lastRightTriggerByte) {
+        clearPendingLocked(slot);
+        g_deduped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    uint64_t now = monotonicNs();
+    bool stopping = (lowByte == 0 && highByte == 0 && leftTriggerByte == 0 && rightTriggerByte == 0);
+    if (fromAudio && !stopping && slot->lastValid && now - slot->lastSendNs < MIN_AUDIO_SEND_INTERVAL_NS) {
+        // 保留为挂起，间隔到期后由轮询线程 tick 补发当时的最新值
+        if (!slot->pending) {
+            slot->pending = true;
+            g_pendingMask.fetch_or(1u << (uint32_t)(slot - g_slots), std::memory_order_relaxed);
+        }
+        slot->pendingOriginNs = originNs;
+        g_rateLimited.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    slot->report[slot->lowOffset] = lowByte;
+    slot->report[slot->highOffset] = highByte;
+    if (slot->leftTriggerOffset >= 0) {
+        slot->report[slot->leftTriggerOffset] = leftTriggerByte;
+    }
+    if (slot->rightTriggerOffset >= 0) {
+        slot->report[slot->rightTriggerOffset] = rightTriggerByte;
+    }
+    if (slot->seqOffset >= 0) {
+        slot->report[slot->seqOffset] = slot->seq++;
+    }
+
+    int ret = UsbDdkPoller_QueueOutput(slot->pollerId, slot->pollerGeneration, slot->endpoint,
+                                       slot->report, slot->reportLen, originNs);
+    if (ret < 0) {
+        g_queueFailed.fetch_add(1, std::memory_order_relaxed);
+        clearPendingLocked(slot);
+        if (UsbDdkPoller_GetGeneration(slot->pollerId) != slot->pollerGeneration) {
+            // 轮询器已停止或槽位已被其他手柄复用：绑定失效
+            OH_LOG_INFO(LOG_APP, "[%{public}s] slot=%{public}d 轮询器 %{public}d 已重启/停止，解除绑定",
+                        LOG_TAG, (int)(slot - g_slots), slot->pollerId);
+            slot->bound = false;
+        }
+        return;
+    }
+    clearPendingLocked(slot);
+
+    slot->lastLowByte = lowByte;
+    slot->lastHighByte = highByte;
+    slot->lastLeftTriggerByte = leftTriggerByte;
+    slot->lastRightTriggerByte = rightTriggerByte;
+    slot->lastValid = true;
+    slot->lastSendNs = now;
+    g_commandsQueued.fetch_add(1, std::memory_order_relaxed);
+}
+
+// ============================================================
+// Native 接口
+// ============================================================
+
+bool HapticsRouter_OnGameRumble(unsigned short controllerNumber, unsigned short lowFreqMotor,
+                                unsigned short highFreqMotor) {
+    bool handled = false;
+    if (controllerNumber < HAPTICS_MAX_SLOTS) {
+        std::lock_guard<std::mutex> lock(g_hapticsMutex);
+        HapticsSlot *slot = &g_slots[controllerNumber];
+        if (slot->bound) {
+            slot->gameLow = lowFreqMotor;
+            slot->gameHigh = highFreqMotor;
+            sendSlotLocked(slot, false, 0);
+            handled = true;
+        }
+    }
+    if (handled) {
+        g_gameEvents.fetch_add(1, std::memory_order_relaxed);
+    }
+    return !handled || g_forwardGameToJs.load(std::memory_order_relaxed);
+}
+
+/**
+ * 0-100 强度 → 16 位马达值（已叠加强度设置，低于有效阈值视为 0）
+ */
+static uint16_t scaleAudioLocked(int intensity) {
+    int effective = intensity * g_audioStrength / 100;
+    if (effective < MIN_EFFECTIVE_INTENSITY) {
+        return 0;
+    }
+    if (effective > 100) {
+        effective = 100;
+    }
+    return (uint16_t)((uint32_t)effective * 65535u / 100u);
+}
+
+bool HapticsRouter_OnAudioIntensity(int lowMotor, int highMotor, int leftTrigger, int rightTrigger,
+                                    uint64_t frameNs) {
+    bool handled = false;
+    {
+        std::lock_guard<std::mutex> lock(g_hapticsMutex);
+        if (g_audioEnabled) {
+            // 场景模式的马达分配已由分析器滤波器组完成
+            uint16_t low = scaleAudioLocked(lowMotor);
+            uint16_t high = scaleAudioLocked(highMotor);
+            uint16_t leftTrig = scaleAudioLocked(leftTrigger);
+            uint16_t rightTrig = scaleAudioLocked(rightTrigger);
+
+            for (int i = 0; i < HAPTICS_MAX_SLOTS; i++) {
+                HapticsSlot *slot = &g_slots[i];
+                if (!slot->bound) continue;
+                slot->audioLow = low;
+                slot->audioHigh = high;
+                slot->audioLeftTrigger = leftTrig;
+                slot->audioRightTrigger = rightTrig;
+                sendSlotLocked(slot, true, frameNs);
+                handled = true;
+            }
+        }
+    }
+    if (handled) {
+        g_audioEvents.fetch_add(1, std::memory_order_relaxed);
+    }
+    return !handled || g_forwardAudioToJs.load(std::memory_order_relaxed);
+}
+
+void HapticsRouter_OnPollerTick(int pollerId) {
+    if (g_pendingMask.load(std::memory_order_relaxed) == 0) return;
+    std::lock_guard<std::mutex> lock(g_hapticsMutex);
+    uint64_t now = monotonicNs();
+    for (int i = 0; i < HAPTICS_MAX_SLOTS; i++) {
+        HapticsSlot *slot = &g_slots[i];
+        if (!slot->pending || !slot->bound || slot->pollerId != pollerId) continue;
+        if (now - slot->lastSendNs < MIN_AUDIO_SEND_INTERVAL_NS) continue;
+        sendSlotLocked(slot, true, slot->pendingOriginNs);
+    }
+}
+
+void HapticsRouter_StopAll() {
+    std::lock_guard<std::mutex> lock(g_hapticsMutex);
+    for (int i = 0; i < HAPTICS_MAX_SLOTS; i++) {
+        HapticsSlot *slot = &g_slots[i];
+        slot->gameLow = slot->gameHigh = 0;
+        slot->audioLow = slot->audioHigh = 0;
+        slot->audioLeftTrigger = slot->audioRightTrigger = 0;
+        clearPendingLocked(slot);
+        if (slot->bound) {
+            sendSlotLocked(slot, false, 0);
+        }
+    }
+}
+
+void HapticsRouter_GetStats(HapticsRouterStats *out) {
+    if (!out) return;
+    memset(out, 0, sizeof(*out));
+
+    uint64_t latencyTotalNs = 0;
+    uint64_t latencyMaxNs = 0;
+    {
+        std::lock_guard<std::mutex> lock(g_hapticsMutex);
+        for (int i = 0; i < HAPTICS_MAX_SLOTS; i++) {
+            if (!g_slots[i].bound) continue;
+            out->boundControllers++;
+            UsbDdkOutputStats os;
+            if (UsbDdkPoller_GetGeneration(g_slots[i].pollerId) == g_slots[i].pollerGeneration &&
+                UsbDdkPoller_GetOutputStats(g_slots[i].pollerId, &os)) {
+                out->latencySamples += os.stampedCount;
+                latencyTotalNs += os.stampedTotalNs;
+                if (os.stampedMaxNs > latencyMaxNs) latencyMaxNs = os.stampedMaxNs;
+            }
+        }
+    }
+
+    out->audioEvents = g_audioEvents.load(std::memory_order_relaxed);
+    out->gameEvents = g_gameEvents.load(std::memory_order_relaxed);
+    out->commandsQueued = g_commandsQueued.load(std::memory_order_relaxed);
+    out->deduped = g_deduped.load(std::memory_order_relaxed);
+    out->rateLimited = g_rateLimited.load(std::memory_order_relaxed);
+    out->queueFailed = g_queueFailed.load(std::memory_order_relaxed);
+    out->avgLatencyUs = (out->latencySamples > 0)
+        ? ((double)latencyTotalNs / out->latencySamples / 1000.0) : 0.0;
+    out->maxLatencyUs = (double)latencyMaxNs / 1000.0;
+}
+
+// ============================================================
+// NAPI: bindController(slot, pollerId, endpoint, template, lowOffset, highOffset, seqOffset,
+//                      leftTriggerOffset?, rightTriggerOffset?)
+// ============================================================
+
+static napi_value HapticsNapi_BindController(napi_env env, napi_callback_info info) {
+    size_t argc = 9;
+    napi_value args[9];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    napi_value result;
+    napi_get_boolean(env, false, &result);
+    if (argc < 6) {
+        return result;
+    }
+
+    int32_t slotIndex = -1, pollerId = -1, endpoint = 0;
+    int32_t lowOffset = -1, highOffset = -1, seqOffset = -1;
+    int32_t leftTriggerOffset = -1, rightTriggerOffset = -1;
+    napi_get_value_int32(env, args[0], &slotIndex);
+    napi_get_value_int32(env, args[1], &pollerId);
+    napi_get_value_int32(env, args[2], &endpoint);
+    napi_get_value_int32(env, args[4], &lowOffset);
+    napi_get_value_int32(env, args[5], &highOffset);
+    if (argc >= 7) {
+        napi_get_value_int32(env, args[6], &seqOffset);
+    }
+    if (argc >= 9) {
+        napi_get_value_int32(env, args[7], &leftTriggerOffset);
+        napi_get_value_int32(env, args[8], &rightTriggerOffset);
+    }
+
+    bool isTypedArray = false;
+    napi_is_typedarray(env, args[3], &isTypedArray);
+    if (!isTypedArray) {
+        return result;
+    }
+    napi_typedarray_type type;
+    size_t length = 0;
+    void *data = nullptr;
+    napi_get_typedarray_info(env, args[3], &type, &length, &data, nullptr, nullptr);
+
+    if (slotIndex < 0 || slotIndex >= HAPTICS_MAX_SLOTS || !data ||
+        length == 0 || length > HAPTICS_MAX_REPORT ||
+        lowOffset < 0 || (size_t)lowOffset >= length ||
+        highOffset < 0 || (size_t)highOffset >= length ||
+        seqOffset >= (int32_t)length ||
+        leftTriggerOffset >= (int32_t)length || rightTriggerOffset >= (int32_t)length) {
+        OH_LOG_WARN(LOG_APP, "[%{public}s] bindController: 参数无效 slot=%{public}d len=%{public}zu "
+                    "low=%{public}d high=%{public}d seq=%{public}d trig=%{public}d/%{public}d",
+                    LOG_TAG, slotIndex, length, lowOffset, highOffset, seqOffset,
+                    leftTriggerOffset, rightTriggerOffset);
+        return result;
+    }
+
+    // 只绑定正在运行的轮询器，并记录其启动代号
+    uint32_t generation = UsbDdkPoller_GetGeneration(pollerId);
+    if (generation == 0) {
+        OH_LOG_WARN(LOG_APP, "[%{public}s] bindController: poller=%{public}d 未运行", LOG_TAG, pollerId);
+        return result;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(g_hapticsMutex);
+        HapticsSlot *slot = &g_slots[slotIndex];
+        clearPendingLocked(slot);
+        memset(slot, 0, sizeof(*slot));
+        slot->bound = true;
+        slot->pollerId = pollerId;
+        slot->pollerGeneration = generation;
+        slot->endpoint = (uint8_t)endpoint;
+        memcpy(slot->report, data, length);
+        slot->reportLen = (uint32_t)length;
+        slot->lowOffset = lowOffset;
+        slot->highOffset = highOffset;
+        slot->seqOffset = seqOffset;
+        slot->leftTriggerOffset = leftTriggerOffset < 0 ? -1 : leftTriggerOffset;
+        slot->rightTriggerOffset = rightTriggerOffset < 0 ? -1 : rightTriggerOffset;
+    }
+
+    OH_LOG_INFO(LOG_APP, "[%{public}s] slot=%{public}d 绑定 DDK poller=%{public}d (gen=%{public}u) ep=0x%{public}x len=%{public}zu",
+                LOG_TAG, slotIndex, pollerId, generation, endpoint, length);
+    napi_get_boolean(env, true, &result);
+    return result;
+}
+
+// ============================================================
+// NAPI: unbindController(slot)
+// ============================================================
+
+static napi_value HapticsNapi_UnbindController(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    int32_t slotIndex = -1;
+    if (argc >= 1) napi_get_value_int32(env, args[0], &slotIndex);
+
+    if (slotIndex >= 0 && slotIndex < HAPTICS_MAX_SLOTS) {
+        std::lock_guard<std::mutex> lock(g_hapticsMutex);
+        if (g_slots[slotIndex].bound) {
+            OH_LOG_INFO(LOG_APP, "[%{public}s] slot=%{public}d 解除绑定", LOG_TAG, slotIndex);
+        }
+        clearPendingLocked(&g_slots[slotIndex]);
+        g_slots[slotIndex].bound = false;
+    }
+
+    napi_value undefined;
+    napi_get_undefined(env, &undefined);
+    return undefined;
+}
+
+// ============================================================
+// NAPI: setAudioConfig(enabled, strength, sceneMode)
+// sceneMode 保留兼容：马达/扳机分配已由 BassEnergyAnalyzer 按场景完成
+// ============================================================
+
+static napi_value HapticsNapi_SetAudioConfig(napi_env env, napi_callback_info info) {
+    size_t argc = 3;
+    napi_value args[3];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    bool enabled = false;
+    int32_t strength = 100;
+    if (argc >= 1) napi_get_value_bool(env, args[0], &enabled);
+    if (argc >= 2) napi_get_value_int32(env, args[1], &strength);
+    if (strength < 0) strength = 0;
+    if (strength > 100) strength = 100;
+
+    {
+        std::lock_guard<std::mutex> lock(g_hapticsMutex);
+        bool wasEnabled = g_audioEnabled;
+        g_audioEnabled = enabled;
+        g_audioStrength = strength;
+        if (wasEnabled && !enabled) {
+            // 关闭音频振动时撤掉音频分量，保留游戏 rumble
+            for (int i = 0; i < HAPTICS_MAX_SLOTS; i++) {
+                g_slots[i].audioLow = g_slots[i].audioHigh = 0;
+                g_slots[i].audioLeftTrigger = g_slots[i].audioRightTrigger = 0;
+                if (g_slots[i].bound) sendSlotLocked(&g_slots[i], false, 0);
+            }
+        }
+    }
+
+    napi_value undefined;
+    napi_get_undefined(env, &undefined);
+    return undefined;
+}
+
+// ============================================================
+// NAPI: setJsForwarding(gameRumble, audio)
+// ============================================================
+
+static napi_value HapticsNapi_SetJsForwarding(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    bool game = true;
+    bool audio = true;
+    if (argc >= 1) napi_get_value_bool(env, args[0], &game);
+    if (argc >= 2) napi_get_value_bool(env, args[1], &audio);
+    g_forwardGameToJs.store(game, std::memory_order_relaxed);
+    g_forwardAudioToJs.store(audio, std::memory_order_relaxed);
+
+    napi_value undefined;
+    napi_get_undefined(env, &undefined);
+    return undefined;
+}
+
+// ============================================================
+// NAPI: stopAll()
+// ============================================================
+
+static napi_value HapticsNapi_StopAll(napi_env env, napi_callback_info info) {
+    HapticsRouter_StopAll();
+    napi_value undefined;
+    napi_get_undefined(env, &undefined);
+    return undefined;
+}
+
+// ============================================================
+// NAPI: getStats() → HapticsRouterStats
+// ============================================================
+
+static napi_value HapticsNapi_GetStats(napi_env env, napi_callback_info info) {
+    HapticsRouterStats stats;
+    HapticsRouter_GetStats(&stats);
+
+    napi_value result;
+    napi_create_object(env, &result);
+
+    napi_value val;
+    napi_create_uint32(env, stats.boundControllers, &val);
+    napi_set_named_property(env, result, "boundControllers", val);
+    napi_create_int64(env, (int64_t)stats.audioEvents, &val);
+    napi_set_named_property(env, result, "audioEvents", val);
+    napi_create_int64(env, (int64_t)stats.gameEvents, &val);
+    napi_set_named_property(env, result, "gameEvents", val);
+    napi_create_int64(env, (int64_t)stats.commandsQueued, &val);
+    napi_set_named_property(env, result, "commandsQueued", val);
+    napi_create_int64(env, (int64_t)stats.deduped, &val);
+    napi_set_named_property(env, result, "deduped", val);
+    napi_create_int64(env, (int64_t)stats.rateLimited, &val);
+    napi_set_named_property(env, result, "rateLimited", val);
+    napi_create_int64(env, (int64_t)stats.queueFailed, &val);
+    napi_set_named_property(env, result, "queueFailed", val);
+    napi_create_int64(env, (int64_t)stats.latencySamples, &val);
+    napi_set_named_property(env, result, "latencySamples", val);
+    napi_create_double(env, stats.avgLatencyUs, &val);
+    napi_set_named_property(env, result, "avgLatencyUs", val);
+    napi_create_double(env, stats.maxLatencyUs, &val);
+    napi_set_named_property(env, result, "maxLatencyUs", val);
+
+    return result;
+}
+
+// ============================================================
+// NAPI 注册
+// ============================================================
+
+void HapticsRouter_Init(napi_env env, napi_value exports) {
+    napi_value obj;
+    napi_create_object(env, &obj);
+
+    napi_property_descriptor methods[] = {
+        { "bindController",   nullptr, HapticsNapi_BindController,   nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "unbindController", nullptr, HapticsNapi_UnbindController, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setAudioConfig",   nullptr, HapticsNapi_SetAudioConfig,   nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setJsForwarding",  nullptr, HapticsNapi_SetJsForwarding,  nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "stopAll",          nullptr, HapticsNapi_StopAll,          nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "getStats",         nullptr, HapticsNapi_GetStats,         nullptr, nullptr, nullptr, napi_default, nullptr },
+    };
+
+    napi_define_properties(env, obj, sizeof(methods) / sizeof(methods[0]), methods);
+    napi_set_named_property(env, exports, "HapticsRouter", obj);
+
+    OH_LOG_INFO(LOG_APP, "[%{public}s] HapticsRouter NAPI 已注册", LOG_TAG);
+}
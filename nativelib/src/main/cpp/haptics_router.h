@@ -0,0 +1,112 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file haptics_router.h
+ * @brief Native 振动路由：音频低频分析 + 游戏 rumble → USB 手柄马达
+ *
+ * 原路径：
+ *   BassEnergyAnalyzer → tsfn_bassEnergy → ArkTS → GamepadManager → 驱动 → sendOutput (NAPI)
+ *   BridgeClRumble     → tsfn_rumble     → ArkTS → ...
+ * 每次都要经过 JS 事件循环，振动明显滞后于声音。
+ *
+ * 新路径（已绑定的手柄）：
+ *   分析线程 / 控制流线程 → HapticsRouter (混合 + 限频) → UsbDdkPoller_QueueOutput
+ *
+ * 绑定方式：ArkTS 驱动层给出该手柄的 rumble 报告模板和马达字节偏移
+ * (Xbox 360 / Xbox One / DS4 / DualSense 都是「模板 + 两个马达字节」格式)，
+ * native 侧只改写马达字节（及可选的序号字节）后投递给 DDK 轮询线程。
+ * 需要编码的格式（如 Switch Pro HD rumble）不绑定，继续走 ArkTS 路径。
+ *
+ * 音频振动由 BassEnergyAnalyzer 滤波器组按频段分别给出低频/高频马达与左右扳机强度；
+ * 模板可选给出扳机马达字节偏移（Xbox One），未给出时忽略扳机分量。
+ *
+ * 混合规则：每个马达取 max(游戏 rumble, 音频振动)。
+ * 限频：相同输出去重；音频驱动的非零更新最短间隔 MIN_AUDIO_SEND_INTERVAL_MS，
+ *       游戏 rumble 变化与停止命令始终立即发送。被限频的更新保留为挂起，
+ *       由轮询线程 tick（HapticsRouter_OnPollerTick）在间隔到期后补发最新值。
+ *
+ * 绑定时记录轮询器启动代号，投递时由 UsbDdkPoller_QueueOutput 校验；
+ * 手柄重插后旧绑定的投递被拒绝并自动解除，不会写入被复用的 pollerId 槽位。
+ *
+ * 线程模型：Bind/Unbind/SetAudioConfig 在 JS 线程，OnGameRumble 在
+ * moonlight-common-c 控制流线程，OnAudioIntensity 在音频分析线程，OnPollerTick 在 DDK IN 线程；
+ * 共享状态由单个互斥锁保护。持锁投递以保证命令顺序，锁顺序固定为 HapticsRouter → 轮询器 outMutex。
+ */
+
+#ifndef HAPTICS_ROUTER_H
+#define HAPTICS_ROUTER_H
+
+#include <napi/native_api.h>
+#include <stdint.h>
+
+/**
+ * 路由统计
+ */
+struct HapticsRouterStats {
+    uint32_t boundControllers;   // 已绑定 native 输出的手柄数
+    uint64_t audioEvents;        // 音频强度事件数
+    uint64_t gameEvents;         // 已由 native 处理的游戏 rumble 事件数
+    uint64_t commandsQueued;     // 投递到 DDK 的马达命令数
+    uint64_t deduped;            // 输出未变化而跳过
+    uint64_t rateLimited;        // 限频跳过
+    uint64_t queueFailed;        // 投递失败（轮询器已停止）
+    uint64_t latencySamples;     // 带时间戳的已发送命令数
+    double avgLatencyUs;         // PCM 帧解码完成 → USB 发送完成 平均耗时
+    double maxLatencyUs;         // 同上最大耗时
+};
+
+/**
+ * 初始化 HapticsRouter NAPI 模块。
+ *
+ * 注册到 exports.HapticsRouter 命名空间：
+ *   - bindController(slot, pollerId, endpoint, template, lowOffset, highOffset, seqOffset,
+ *                    leftTriggerOffset?, rightTriggerOffset?): boolean
+ *   - unbindController(slot): void
+ *   - setAudioConfig(enabled, strength, sceneMode): void
+ *   - setJsForwarding(gameRumble, audio): void
+ *   - stopAll(): void
+ *   - getStats(): obj
+ */
+void HapticsRouter_Init(napi_env env, napi_value exports);
+
+/**
+ * 游戏 rumble（BridgeClRumble 调用）
+ * @return true 表示应继续转发给 ArkTS（未绑定该手柄，或 ArkTS 仍需设备振动）
+ */
+bool HapticsRouter_OnGameRumble(unsigned short controllerNumber, unsigned short lowFreqMotor,
+                                unsigned short highFreqMotor);
+
+/**
+ * 音频振动强度（分析线程调用，各项 0-100）
+ * @param lowMotor     低频马达（次低音）
+ * @param highMotor    高频马达（低音 / 音乐模式按起音频段分配）
+ * @param leftTrigger  左扳机马达（左声道中低频瞬态）
+ * @param rightTrigger 右扳机马达（右声道中低频瞬态）
+ * @param frameNs      对应 PCM 帧解码完成时间 (CLOCK_MONOTONIC ns)，0 表示不统计延迟
+ * @return true 表示应继续转发给 ArkTS
+ */
+bool HapticsRouter_OnAudioIntensity(int lowMotor, int highMotor, int leftTrigger, int rightTrigger,
+                                    uint64_t frameNs);
+
+/**
+ * 轮询线程 tick（DDK IN 线程每次请求完成或超时后调用，不持有轮询器锁）
+ * 补发该轮询器上被限频推迟的音频振动更新；无挂起更新时只读一个原子变量
+ */
+void HapticsRouter_OnPollerTick(int pollerId);
+
+/**
+ * 停止所有已绑定手柄的马达并清空游戏/音频状态（会话结束时调用）
+ */
+void HapticsRouter_StopAll();
+
+void HapticsRouter_GetStats(HapticsRouterStats *out);
+
+#endif // HAPTICS_ROUTER_H
@@ -0,0 +1,709 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file hid_report_plan.cpp
+ * @brief HID 报告描述符编译器实现
+ */
+
+#include "hid_report_plan.h"
+
+#include <string.h>
+
+// ==================== 描述符解析限制 ====================
+
+#define MAX_RAW_FIELDS      96
+#define MAX_REPORT_IDS      16
+#define MAX_LOCAL_USAGES    32
+#define MAX_GLOBAL_STACK    4
+
+// HID Usage Page / Usage
+#define PAGE_GENERIC_DESKTOP  0x01
+#define PAGE_SIMULATION       0x02
+#define PAGE_BUTTON           0x09
+#define PAGE_CONSUMER         0x0C
+
+#define GD_JOYSTICK       0x04
+#define GD_GAMEPAD        0x05
+#define GD_MULTI_AXIS     0x08
+#define GD_X              0x30
+#define GD_Y              0x31
+#define GD_Z              0x32
+#define GD_RX             0x33
+#define GD_RY             0x34
+#define GD_RZ             0x35
+#define GD_SLIDER         0x36
+#define GD_DIAL           0x37
+#define GD_WHEEL          0x38
+#define GD_HAT_SWITCH     0x39
+#define GD_SYSTEM_MENU    0x85
+#define GD_DPAD_UP        0x90
+#define GD_DPAD_DOWN      0x91
+#define GD_DPAD_RIGHT     0x92
+#define GD_DPAD_LEFT      0x93
+#define SIM_ACCELERATOR   0xC4
+#define SIM_BRAKE         0xC5
+#define CONSUMER_AC_HOME  0x223
+#define CONSUMER_AC_BACK  0x224
+
+namespace {
+
+struct RawField {
+    uint16_t usagePage;
+    uint16_t usage;
+    uint16_t bitOffset;
+    uint8_t bitSize;
+    uint8_t reportId;
+    int32_t logicalMin;
+    int32_t logicalMax;
+};
+
+struct GlobalItems {
+    uint16_t usagePage;
+    int32_t logicalMin;
+    int32_t logicalMaxSigned;
+    uint32_t logicalMaxUnsigned;
+    uint32_t reportSize;
+    uint32_t reportCount;
+    uint8_t reportId;
+};
+
+struct ReportOffset {
+    uint8_t reportId;
+    uint32_t bits;
+};
+
+// 8 方向 HAT → 十字键 (0=上，顺时针)
+const uint32_t kHatFlags[8] = {
+    BTN_FLAG_UP,
+    BTN_FLAG_UP | BTN_FLAG_RIGHT,
+    BTN_FLAG_RIGHT,
+    BTN_FLAG_DOWN | BTN_FLAG_RIGHT,
+    BTN_FLAG_DOWN,
+    BTN_FLAG_DOWN | BTN_FLAG_LEFT,
+    BTN_FLAG_LEFT,
+    BTN_FLAG_UP | BTN_FLAG_LEFT
+};
+
+// 无 SDL 映射时 Button N 的默认含义 (DirectInput 常见顺序，与 parseGenericHidReport 一致)
+// 0 表示由扳机 / 其他规则处理
+const uint32_t kDefaultButtonFlags[] = {
+    BTN_FLAG_X,         // 1
+    BTN_FLAG_A,         // 2
+    BTN_FLAG_B,         // 3
+    BTN_FLAG_Y,         // 4
+    BTN_FLAG_LB,        // 5
+    BTN_FLAG_RB,        // 6
+    0,                  // 7: LT (数字)
+    0,                  // 8: RT (数字)
+    BTN_FLAG_BACK,      // 9
+    BTN_FLAG_START,     // 10
+    BTN_FLAG_LS_CLK,    // 11
+    BTN_FLAG_RS_CLK,    // 12
+    BTN_FLAG_HOME,      // 13
+    BTN_FLAG_TOUCHPAD,  // 14
+};
+const int kDefaultButtonCount = sizeof(kDefaultButtonFlags) / sizeof(kDefaultButtonFlags[0]);
+
+bool isAxisUsage(uint16_t page, uint16_t usage) {
+    if (page == PAGE_GENERIC_DESKTOP) return usage >= GD_X && usage <= GD_WHEEL;
+    if (page == PAGE_SIMULATION) return usage == SIM_ACCELERATOR || usage == SIM_BRAKE;
+    return false;
+}
+
+// SDL 在 Linux/Android 上按 ABS 代码顺序编号轴：X Y Z RX RY RZ THROTTLE RUDDER WHEEL GAS BRAKE
+int axisOrder(uint16_t page, uint16_t usage) {
+    if (page == PAGE_GENERIC_DESKTOP) return usage - GD_X;
+    return usage == SIM_ACCELERATOR ? 9 : 10;
+}
+
+bool isGamepadField(const RawField &f) {
+    if (f.usagePage == PAGE_BUTTON) return f.usage >= 1;
+    if (isAxisUsage(f.usagePage, f.usage)) return true;
+    if (f.usagePage == PAGE_GENERIC_DESKTOP) {
+        return f.usage == GD_HAT_SWITCH || f.usage == GD_SYSTEM_MENU ||
+               (f.usage >= GD_DPAD_UP && f.usage <= GD_DPAD_LEFT);
+    }
+    return f.usagePage == PAGE_CONSUMER && (f.usage == CONSUMER_AC_HOME || f.usage == CONSUMER_AC_BACK);
+}
+
+int32_t signExtend(uint32_t value, size_t size) {
+    switch (size) {
+        case 1: return (int8_t)value;
+        case 2: return (int16_t)value;
+        default: return (int32_t)value;
+    }
+}
+
+class PlanBuilder {
+public:
+    explicit PlanBuilder(HidReportPlan *plan) : plan_(plan) {}
+
+    bool Add(const RawField &f, uint8_t target, uint32_t buttonFlag, bool invert) {
+        if (plan_->opCount >= HID_PLAN_MAX_OPS) return false;
+        HidPlanOp &op = plan_->ops[plan_->opCount++];
+        memset(&op, 0, sizeof(op));
+        op.bitOffset = f.bitOffset;
+        op.bitSize = f.bitSize;
+        op.target = target;
+        op.isSigned = f.logicalMin < 0 ? 1 : 0;
+        op.invert = invert ? 1 : 0;
+        op.logicalMin = f.logicalMin;
+        op.logicalMax = f.logicalMax;
+        op.buttonFlag = buttonFlag;
+
+        uint32_t range = (uint32_t)((int64_t)f.logicalMax - (int64_t)f.logicalMin);
+        if (range == 0) range = 1;
+        switch (target) {
+            case HID_TARGET_LEFT_X:
+            case HID_TARGET_LEFT_Y:
+            case HID_TARGET_RIGHT_X:
+            case HID_TARGET_RIGHT_Y:
+                op.scale = (uint32_t)(((65535ULL << 16) + range - 1) / range);  // 向上取整，逻辑最大值映射到满量程
+                break;
+            case HID_TARGET_LEFT_TRIGGER:
+            case HID_TARGET_RIGHT_TRIGGER:
+                op.scale = (uint32_t)(((255ULL << 16) + range - 1) / range);
+                break;
+            case HID_TARGET_TRIGGER_PAIR: {
+                uint32_t half = range / 2 ? range / 2 : 1;
+                op.scale = (uint32_t)(((255ULL << 16) + half - 1) / half);
+                break;
+            }
+            case HID_TARGET_HAT:
+                op.hatScale = (range == 3) ? 2 : 1;  // 4 方向 HAT 每步 90°
+                break;
+            default:
+                break;
+        }
+        return true;
+    }
+
+private:
+    HidReportPlan *plan_;
+};
+
+// 按描述符顺序分类的手柄字段
+struct FieldSet {
+    const RawField *buttons[HID_PLAN_MAX_BUTTONS];  // 按 Button N 排序
+    int buttonCount;
+    const RawField *axes[16];                       // 按 SDL 轴顺序排序
+    int axisCount;
+    const RawField *hats[4];
+    int hatCount;
+    const RawField *extras[8];                      // 十字键 / Home / Back 等专用 Usage
+    int extraCount;
+};
+
+const RawField *findAxis(const FieldSet &fs, uint16_t page, uint16_t usage) {
+    for (int i = 0; i < fs.axisCount; i++) {
+        if (fs.axes[i]->usagePage == page && fs.axes[i]->usage == usage) return fs.axes[i];
+    }
+    return nullptr;
+}
+
+void bindByUsage(const FieldSet &fs, PlanBuilder &b) {
+    const RawField *x = findAxis(fs, PAGE_GENERIC_DESKTOP, GD_X);
+    const RawField *y = findAxis(fs, PAGE_GENERIC_DESKTOP, GD_Y);
+    const RawField *z = findAxis(fs, PAGE_GENERIC_DESKTOP, GD_Z);
+    const RawField *rx = findAxis(fs, PAGE_GENERIC_DESKTOP, GD_RX);
+    const RawField *ry = findAxis(fs, PAGE_GENERIC_DESKTOP, GD_RY);
+    const RawField *rz = findAxis(fs, PAGE_GENERIC_DESKTOP, GD_RZ);
+    const RawField *brake = findAxis(fs, PAGE_SIMULATION, SIM_BRAKE);
+    const RawField *gas = findAxis(fs, PAGE_SIMULATION, SIM_ACCELERATOR);
+
+    if (x) b.Add(*x, HID_TARGET_LEFT_X, 0, false);
+    if (y) b.Add(*y, HID_TARGET_LEFT_Y, 0, false);
+
+    const RawField *lt = brake;
+    const RawField *rt = gas;
+    if (z && rz) {
+        // DirectInput / PS 布局：Z/Rz 为右摇杆，Rx/Ry 为模拟扳机
+        b.Add(*z, HID_TARGET_RIGHT_X, 0, false);
+        b.Add(*rz, HID_TARGET_RIGHT_Y, 0, false);
+        if (!lt) lt = rx;
+        if (!rt) rt = ry;
+    } else if (rx && ry) {
+        // XInput 风格 HID：Rx/Ry 为右摇杆，Z 为组合扳机（或 Brake/Accelerator 独立扳机）
+        b.Add(*rx, HID_TARGET_RIGHT_X, 0, false);
+        b.Add(*ry, HID_TARGET_RIGHT_Y, 0, false);
+        if (z && !lt && !rt) b.Add(*z, HID_TARGET_TRIGGER_PAIR, 0, false);
+    } else if (z && !lt && !rt) {
+        b.Add(*z, HID_TARGET_TRIGGER_PAIR, 0, false);
+    }
+    if (lt) b.Add(*lt, HID_TARGET_LEFT_TRIGGER, 0, false);
+    if (rt) b.Add(*rt, HID_TARGET_RIGHT_TRIGGER, 0, false);
+    bool analogTriggers = lt || rt || (z && !rz);
+
+    for (int i = 0; i < fs.hatCount && i < 1; i++) {
+        b.Add(*fs.hats[i], HID_TARGET_HAT, 0, false);
+    }
+
+    for (int i = 0; i < fs.buttonCount; i++) {
+        const RawField &f = *fs.buttons[i];
+        int n = f.usage - 1;
+        if (n >= kDefaultButtonCount) continue;
+        if (kDefaultButtonFlags[n] != 0) {
+            b.Add(f, HID_TARGET_BUTTON, kDefaultButtonFlags[n], false);
+        } else if (!analogTriggers) {
+            b.Add(f, n == 6 ? HID_TARGET_LEFT_TRIGGER : HID_TARGET_RIGHT_TRIGGER, 0, false);
+        }
+    }
+}
+
+void bindSource(const FieldSet &fs, PlanBuilder &b, const MappingSource &src,
+                uint8_t target, uint32_t buttonFlag, const RawField **boundHat) {
+    switch (src.type) {
+        case MAPPING_BUTTON:
+            if (src.index < fs.buttonCount) {
+                // 扳机映射到按钮时按 1 位轴处理 (0 / 255)
+                b.Add(*fs.buttons[src.index], target, buttonFlag, false);
+            }
+            break;
+        case MAPPING_AXIS:
+            if (target != HID_TARGET_BUTTON && src.index < fs.axisCount) {
+                b.Add(*fs.axes[src.index], target, 0, src.inverted);
+            }
+            break;
+        case MAPPING_HAT:
+            // 十字键四个方向共用一个 HAT 操作
+            if (src.index < fs.hatCount && *boundHat != fs.hats[src.index]) {
+                *boundHat = fs.hats[src.index];
+                b.Add(**boundHat, HID_TARGET_HAT, 0, false);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void bindBySdlMapping(const FieldSet &fs, const GamepadMapping &m, PlanBuilder &b) {
+    const RawField *boundHat = nullptr;
+    bindSource(fs, b, m.leftx, HID_TARGET_LEFT_X, 0, &boundHat);
+    bindSource(fs, b, m.lefty, HID_TARGET_LEFT_Y, 0, &boundHat);
+    bindSource(fs, b, m.rightx, HID_TARGET_RIGHT_X, 0, &boundHat);
+    bindSource(fs, b, m.righty, HID_TARGET_RIGHT_Y, 0, &boundHat);
+    bindSource(fs, b, m.lefttrigger, HID_TARGET_LEFT_TRIGGER, 0, &boundHat);
+    bindSource(fs, b, m.righttrigger, HID_TARGET_RIGHT_TRIGGER, 0, &boundHat);
+    bindSource(fs, b, m.a, HID_TARGET_BUTTON, BTN_FLAG_A, &boundHat);
+    bindSource(fs, b, m.b, HID_TARGET_BUTTON, BTN_FLAG_B, &boundHat);
+    bindSource(fs, b, m.x, HID_TARGET_BUTTON, BTN_FLAG_X, &boundHat);
+    bindSource(fs, b, m.y, HID_TARGET_BUTTON, BTN_FLAG_Y, &boundHat);
+    bindSource(fs, b, m.back, HID_TARGET_BUTTON, BTN_FLAG_BACK, &boundHat);
+    bindSource(fs, b, m.guide, HID_TARGET_BUTTON, BTN_FLAG_HOME, &boundHat);
+    bindSource(fs, b, m.start, HID_TARGET_BUTTON, BTN_FLAG_START, &boundHat);
+    bindSource(fs, b, m.leftstick, HID_TARGET_BUTTON, BTN_FLAG_LS_CLK, &boundHat);
+    bindSource(fs, b, m.rightstick, HID_TARGET_BUTTON, BTN_FLAG_RS_CLK, &boundHat);
+    bindSource(fs, b, m.leftshoulder, HID_TARGET_BUTTON, BTN_FLAG_LB, &boundHat);
+    bindSource(fs, b, m.rightshoulder, HID_TARGET_BUTTON, BTN_FLAG_RB, &boundHat);
+    bindSource(fs, b, m.dpup, HID_TARGET_BUTTON, BTN_FLAG_UP, &boundHat);
+    bindSource(fs, b, m.dpdown, HID_TARGET_BUTTON, BTN_FLAG_DOWN, &boundHat);
+    bindSource(fs, b, m.dpleft, HID_TARGET_BUTTON, BTN_FLAG_LEFT, &boundHat);
+    bindSource(fs, b, m.dpright, HID_TARGET_BUTTON, BTN_FLAG_RIGHT, &boundHat);
+}
+
+void bindExtras(const FieldSet &fs, PlanBuilder &b) {
+    for (int i = 0; i < fs.extraCount; i++) {
+        const RawField &f = *fs.extras[i];
+        uint32_t flag = 0;
+        if (f.usagePage == PAGE_GENERIC_DESKTOP) {
+            switch (f.usage) {
+                case GD_DPAD_UP:     flag = BTN_FLAG_UP; break;
+                case GD_DPAD_DOWN:   flag = BTN_FLAG_DOWN; break;
+                case GD_DPAD_RIGHT:  flag = BTN_FLAG_RIGHT; break;
+                case GD_DPAD_LEFT:   flag = BTN_FLAG_LEFT; break;
+                case GD_SYSTEM_MENU: flag = BTN_FLAG_HOME; break;
+                default: break;
+            }
+        } else if (f.usage == CONSUMER_AC_HOME) {
+            flag = BTN_FLAG_HOME;
+        } else if (f.usage == CONSUMER_AC_BACK) {
+            flag = BTN_FLAG_BACK;
+        }
+        if (flag) b.Add(f, HID_TARGET_BUTTON, flag, false);
+    }
+}
+
+// 1 位按钮集中在 32 位窗口内时改走快速路径
+void buildButtonRun(HidReportPlan *plan) {
+    uint32_t minBit = UINT32_MAX;
+    uint32_t maxBit = 0;
+    int count = 0;
+    for (int i = 0; i < plan->opCount; i++) {
+        const HidPlanOp &op = plan->ops[i];
+        if (op.target != HID_TARGET_BUTTON || op.bitSize != 1) continue;
+        if (op.bitOffset < minBit) minBit = op.bitOffset;
+        if (op.bitOffset > maxBit) maxBit = op.bitOffset;
+        count++;
+    }
+    if (count < 2 || maxBit - minBit >= HID_PLAN_MAX_BUTTONS) return;
+
+    plan->buttonRunBitOffset = (uint16_t)minBit;
+    plan->buttonRunCount = (uint8_t)(maxBit - minBit + 1);
+    int kept = 0;
+    for (int i = 0; i < plan->opCount; i++) {
+        const HidPlanOp &op = plan->ops[i];
+        if (op.target == HID_TARGET_BUTTON && op.bitSize == 1) {
+            // 展开为 4 位一组的查找表：每组 16 种组合直接对应 BTN_FLAG_* 的并集
+            uint32_t bit = op.bitOffset - minBit;
+            for (uint32_t nibble = 0; nibble < 16; nibble++) {
+                if (nibble & (1u << (bit & 3))) plan->buttonRunLut[bit >> 2][nibble] |= op.buttonFlag;
+            }
+        } else {
+            plan->ops[kept++] = op;
+        }
+    }
+    plan->opCount = (uint8_t)kept;
+}
+
+// 按 target 稳定分组，记录每组起点
+void groupOps(HidReportPlan *plan) {
+    HidPlanOp sorted[HID_PLAN_MAX_OPS];
+    int n = 0;
+    for (int t = 0; t < HID_TARGET_COUNT; t++) {
+        plan->opStart[t] = (uint8_t)n;
+        for (int i = 0; i < plan->opCount; i++) {
+            if (plan->ops[i].target == t) sorted[n++] = plan->ops[i];
+        }
+    }
+    plan->opStart[HID_TARGET_COUNT] = (uint8_t)n;
+    memcpy(plan->ops, sorted, sizeof(HidPlanOp) * n);
+    plan->opCount = (uint8_t)n;
+}
+
+// 字段所在的 8 字节窗口不越过报告末尾：靠近末尾的字段从 (报告长度 - 8) 装入并多移几字节
+void computeLoad(uint32_t bitOffset, uint32_t reportBytes, uint16_t *loadOffset, uint8_t *loadShift) {
+    uint32_t byte = bitOffset >> 3;
+    uint32_t base = byte + 8 <= reportBytes ? byte : reportBytes - 8;
+    *loadOffset = (uint16_t)base;
+    *loadShift = (uint8_t)((byte - base) * 8 + (bitOffset & 7));
+}
+
+inline uint32_t extractBits(const uint8_t *data, uint16_t loadOffset, uint8_t loadShift, uint8_t bitSize) {
+    uint64_t acc;
+    memcpy(&acc, data + loadOffset, sizeof(acc));
+    return (uint32_t)((acc >> loadShift) & ((1ULL << bitSize) - 1));
+}
+
+// 取值 → 符号扩展 → 钳位到逻辑范围 → 相对最小值的偏移（已处理反转），全程无分支
+inline uint32_t readRelative(const uint8_t *data, const HidPlanOp &op) {
+    uint32_t raw = extractBits(data, op.loadOffset, op.loadShift, op.bitSize);
+    uint32_t signBit = (uint32_t)op.isSigned << (op.bitSize - 1);
+    int32_t v = (int32_t)((raw ^ signBit) - signBit);
+    v = v < op.logicalMin ? op.logicalMin : v;
+    v = v > op.logicalMax ? op.logicalMax : v;
+    uint32_t rel = (uint32_t)v - (uint32_t)op.logicalMin;
+    uint32_t range = (uint32_t)op.logicalMax - (uint32_t)op.logicalMin;
+    return op.invert ? range - rel : rel;
+}
+
+} // namespace
+
+// ==================== 编译 ====================
+
+bool HidPlan_Compile(const uint8_t *desc, size_t len, const GamepadMapping *sdlMapping, HidReportPlan *out) {
+    if (!desc || len == 0 || !out) return false;
+    memset(out, 0, sizeof(*out));
+
+    RawField fields[MAX_RAW_FIELDS];
+    int fieldCount = 0;
+    ReportOffset offsets[MAX_REPORT_IDS];
+    int offsetCount = 0;
+
+    GlobalItems g;
+    memset(&g, 0, sizeof(g));
+    GlobalItems stack[MAX_GLOBAL_STACK];
+    int stackDepth = 0;
+
+    // 局部项：高 16 位为 Usage Page（0 表示使用当前全局 Usage Page）
+    uint32_t usages[MAX_LOCAL_USAGES];
+    int usageCount = 0;
+    uint32_t usageMin = 0;
+    uint32_t usageMax = 0;
+    bool hasUsageRange = false;
+
+    int collectionDepth = 0;
+    int gamepadDepth = 0;  // 手柄应用集合所在深度，0 = 不在手柄集合内
+
+    size_t i = 0;
+    while (i < len) {
+        uint8_t prefix = desc[i++];
+        if (prefix == 0xFE) {  // 长项：跳过
+            if (i + 1 >= len) break;
+            i += 2 + desc[i];
+            continue;
+        }
+        size_t size = (prefix & 0x03) == 3 ? 4 : (prefix & 0x03);
+        if (i + size > len) break;
+        uint32_t uval = 0;
+        for (size_t k = 0; k < size; k++) uval |= (uint32_t)desc[i + k] << (8 * k);
+        int32_t sval = signExtend(uval, size);
+        i += size;
+
+        uint8_t type = (prefix >> 2) & 0x03;
+        uint8_t tag = prefix >> 4;
+
+        if (type == 1) {  // Global
+            switch (tag) {
+                case 0: g.usagePage = (uint16_t)uval; break;
+                case 1: g.logicalMin = sval; break;
+                case 2: g.logicalMaxSigned = sval; g.logicalMaxUnsigned = uval; break;
+                case 7: g.reportSize = uval; break;
+                case 8: g.reportId = (uint8_t)uval; break;
+                case 9: g.reportCount = uval; break;
+                case 10: if (stackDepth < MAX_GLOBAL_STACK) stack[stackDepth++] = g; break;
+                case 11: if (stackDepth > 0) g = stack[--stackDepth]; break;
+                default: break;
+            }
+            continue;
+        }
+
+        if (type == 2) {  // Local
+            uint32_t full = size == 4 ? uval : uval & 0xFFFF;
+            switch (tag) {
+                case 0: if (usageCount < MAX_LOCAL_USAGES) usages[usageCount++] = full; break;
+                case 1: usageMin = full; hasUsageRange = true; break;
+                case 2: usageMax = full; hasUsageRange = true; break;
+                default: break;
+            }
+            continue;
+        }
+
+        if (type != 0) continue;  // Reserved
+
+        // Main
+        if (tag == 10) {  // Collection
+            collectionDepth++;
+            uint32_t usage = usageCount > 0 ? usages[usageCount - 1] : 0;
+            uint16_t page = (usage >> 16) ? (uint16_t)(usage >> 16) : g.usagePage;
+            uint16_t u = (uint16_t)(usage & 0xFFFF);
+            if (uval == 0x01 && gamepadDepth == 0 && page == PAGE_GENERIC_DESKTOP &&
+                (u == GD_JOYSTICK || u == GD_GAMEPAD || u == GD_MULTI_AXIS)) {
+                gamepadDepth = collectionDepth;
+            }
+        } else if (tag == 12) {  // End Collection
+            if (collectionDepth == gamepadDepth) gamepadDepth = 0;
+            if (collectionDepth > 0) collectionDepth--;
+        } else if (tag == 8) {  // Input
+            int slot = -1;
+            for (int k = 0; k < offsetCount; k++) {
+                if (offsets[k].reportId == g.reportId) { slot = k; break; }
+            }
+            if (slot < 0 && offsetCount < MAX_REPORT_IDS) {
+                slot = offsetCount++;
+                offsets[slot].reportId = g.reportId;
+                offsets[slot].bits = g.reportId ? 8 : 0;  // 报告首字节为 Report ID
+            }
+            if (slot < 0) break;
+
+            bool constant = (uval & 0x01) != 0;
+            bool variable = (uval & 0x02) != 0;
+            // 逻辑最小值非负时最大值按无符号解释 (如 1 字节 0xFF 表示 255)
+            int32_t logicalMax = g.logicalMaxSigned;
+            if (g.logicalMin >= 0 && logicalMax < g.logicalMin) logicalMax = (int32_t)g.logicalMaxUnsigned;
+
+            for (uint32_t c = 0; c < g.reportCount && c < 256; c++) {
+                uint32_t bit = offsets[slot].bits;
+                offsets[slot].bits += g.reportSize;
+                if (constant || !variable || gamepadDepth == 0) continue;
+                if (g.reportSize == 0 || g.reportSize > 32 || bit + g.reportSize > HID_PLAN_MAX_REPORT * 8) continue;
+
+                uint32_t usage;
+                if (usageCount > 0) {
+                    usage = usages[c < (uint32_t)usageCount ? c : (uint32_t)usageCount - 1];
+                } else if (hasUsageRange) {
+                    uint32_t u = usageMin + c;
+                    if (u > usageMax) continue;
+                    usage = u;
+                } else {
+                    continue;
+                }
+                if (fieldCount >= MAX_RAW_FIELDS) continue;
+
+                RawField &f = fields[fieldCount];
+                f.usagePage = (usage >> 16) ? (uint16_t)(usage >> 16) : g.usagePage;
+                f.usage = (uint16_t)(usage & 0xFFFF);
+                f.bitOffset = (uint16_t)bit;
+                f.bitSize = (uint8_t)g.reportSize;
+                f.reportId = g.reportId;
+                f.logicalMin = g.logicalMin;
+                f.logicalMax = logicalMax;
+                if (isGamepadField(f)) fieldCount++;
+            }
+        }
+
+        // 每个主项之后清空局部项
+        usageCount = 0;
+        usageMin = usageMax = 0;
+        hasUsageRange = false;
+    }
+
+    if (fieldCount == 0) return false;
+
+    // 多个 Report ID 时选手柄字段最多的报告
+    int bestCount = 0;
+    uint8_t bestId = 0;
+    for (int k = 0; k < offsetCount; k++) {
+        int n = 0;
+        for (int f = 0; f < fieldCount; f++) {
+            if (fields[f].reportId == offsets[k].reportId) n++;
+        }
+        if (n > bestCount) {
+            bestCount = n;
+            bestId = offsets[k].reportId;
+        }
+    }
+
+    FieldSet fs;
+    memset(&fs, 0, sizeof(fs));
+    for (int f = 0; f < fieldCount; f++) {
+        const RawField *rf = &fields[f];
+        if (rf->reportId != bestId) continue;
+        if (rf->usagePage == PAGE_BUTTON) {
+            if (fs.buttonCount >= HID_PLAN_MAX_BUTTONS) continue;
+            int pos = fs.buttonCount++;
+            while (pos > 0 && fs.buttons[pos - 1]->usage > rf->usage) {
+                fs.buttons[pos] = fs.buttons[pos - 1];
+                pos--;
+            }
+            fs.buttons[pos] = rf;
+        } else if (isAxisUsage(rf->usagePage, rf->usage)) {
+            if (fs.axisCount >= 16) continue;
+            int pos = fs.axisCount++;
+            while (pos > 0 && axisOrder(fs.axes[pos - 1]->usagePage, fs.axes[pos - 1]->usage) >
+                              axisOrder(rf->usagePage, rf->usage)) {
+                fs.axes[pos] = fs.axes[pos - 1];
+                pos--;
+            }
+            fs.axes[pos] = rf;
+        } else if (rf->usagePage == PAGE_GENERIC_DESKTOP && rf->usage == GD_HAT_SWITCH) {
+            if (fs.hatCount < 4) fs.hats[fs.hatCount++] = rf;
+        } else if (fs.extraCount < 8) {
+            fs.extras[fs.extraCount++] = rf;
+        }
+    }
+    if (fs.buttonCount == 0 && fs.axisCount == 0) return false;
+
+    out->reportId = bestId;
+    out->buttonCount = (uint8_t)fs.buttonCount;
+    out->axisCount = (uint8_t)fs.axisCount;
+    out->hatCount = (uint8_t)fs.hatCount;
+
+    PlanBuilder builder(out);
+    if (sdlMapping) {
+        bindBySdlMapping(fs, *sdlMapping, builder);
+        out->usedSdlMapping = true;
+    } else {
+        bindByUsage(fs, builder);
+    }
+    bindExtras(fs, builder);
+    buildButtonRun(out);
+    groupOps(out);
+
+    uint32_t endBit = out->buttonRunCount ? out->buttonRunBitOffset + out->buttonRunCount : 0;
+    for (int k = 0; k < out->opCount; k++) {
+        uint32_t e = out->ops[k].bitOffset + out->ops[k].bitSize;
+        if (e > endBit) endBit = e;
+    }
+    out->minLength = (uint16_t)((endBit + 7) / 8);
+
+    uint32_t loadBytes = out->minLength < 8 ? 8 : out->minLength;
+    for (int k = 0; k < out->opCount; k++) {
+        computeLoad(out->ops[k].bitOffset, loadBytes, &out->ops[k].loadOffset, &out->ops[k].loadShift);
+    }
+    if (out->buttonRunCount) {
+        computeLoad(out->buttonRunBitOffset, loadBytes, &out->buttonRunLoadOffset, &out->buttonRunLoadShift);
+    }
+    return out->opCount > 0 || out->buttonRunCount > 0;
+}
+
+// ==================== 执行 ====================
+
+int HidPlan_Apply(const HidReportPlan *plan, const uint8_t *data, size_t len, NapiGamepadState *state) {
+    if (!plan || !data || !state) return GAMEPAD_REPORT_IGNORED;
+    if (plan->reportId != 0 && (len == 0 || data[0] != plan->reportId)) return GAMEPAD_REPORT_IGNORED;
+    if (len < plan->minLength) return GAMEPAD_REPORT_IGNORED;
+
+    // 每个字段都是无边界检查的单次 64 位装入；不足 8 字节的报告先补零
+    uint8_t padded[8] = {0};
+    const uint8_t *buf = data;
+    if (len < 8) {
+        memcpy(padded, data, len);
+        buf = padded;
+    }
+
+    uint32_t buttons = 0;
+    int16_t axes[4] = {0, 0, 0, 0};
+    uint8_t leftTrigger = 0;
+    uint8_t rightTrigger = 0;
+
+    if (plan->buttonRunCount) {
+        uint32_t bits = extractBits(buf, plan->buttonRunLoadOffset, plan->buttonRunLoadShift, plan->buttonRunCount);
+        for (int k = 0; k < (plan->buttonRunCount + 3) / 4; k++) {
+            buttons |= plan->buttonRunLut[k][(bits >> (k * 4)) & 0x0F];
+        }
+    }
+
+    const HidPlanOp *ops = plan->ops;
+    const uint8_t *start = plan->opStart;
+
+    for (int k = start[HID_TARGET_BUTTON]; k < start[HID_TARGET_BUTTON + 1]; k++) {
+        uint32_t raw = extractBits(buf, ops[k].loadOffset, ops[k].loadShift, ops[k].bitSize);
+        buttons |= raw ? ops[k].buttonFlag : 0;
+    }
+
+    for (int k = start[HID_TARGET_LEFT_X]; k < start[HID_TARGET_RIGHT_Y + 1]; k++) {
+        uint32_t scaled = (uint32_t)(((uint64_t)readRelative(buf, ops[k]) * ops[k].scale) >> 16);
+        scaled = scaled > 65535 ? 65535 : scaled;
+        axes[ops[k].target - HID_TARGET_LEFT_X] = (int16_t)((int32_t)scaled - 32768);
+    }
+
+    // 同一扳机有多个来源（轴 + 数字键）时取较大值
+    uint32_t lt = 0;
+    uint32_t rt = 0;
+    for (int k = start[HID_TARGET_LEFT_TRIGGER]; k < start[HID_TARGET_LEFT_TRIGGER + 1]; k++) {
+        uint32_t scaled = (uint32_t)(((uint64_t)readRelative(buf, ops[k]) * ops[k].scale) >> 16);
+        lt = scaled > lt ? scaled : lt;
+    }
+    for (int k = start[HID_TARGET_RIGHT_TRIGGER]; k < start[HID_TARGET_RIGHT_TRIGGER + 1]; k++) {
+        uint32_t scaled = (uint32_t)(((uint64_t)readRelative(buf, ops[k]) * ops[k].scale) >> 16);
+        rt = scaled > rt ? scaled : rt;
+    }
+
+    for (int k = start[HID_TARGET_TRIGGER_PAIR]; k < start[HID_TARGET_TRIGGER_PAIR + 1]; k++) {
+        uint32_t rel = readRelative(buf, ops[k]);
+        uint32_t half = ((uint32_t)ops[k].logicalMax - (uint32_t)ops[k].logicalMin) / 2;
+        bool left = rel < half;
+        uint32_t scaled = (uint32_t)(((uint64_t)(left ? half - rel : rel - half) * ops[k].scale) >> 16);
+        lt = left ? scaled : lt;
+        rt = left ? rt : scaled;
+    }
+    leftTrigger = (uint8_t)(lt > 255 ? 255 : lt);
+    rightTrigger = (uint8_t)(rt > 255 ? 255 : rt);
+
+    for (int k = start[HID_TARGET_HAT]; k < start[HID_TARGET_HAT + 1]; k++) {
+        const HidPlanOp &op = ops[k];
+        uint32_t raw = extractBits(buf, op.loadOffset, op.loadShift, op.bitSize);
+        uint32_t signBit = (uint32_t)op.isSigned << (op.bitSize - 1);
+        int32_t v = (int32_t)((raw ^ signBit) - signBit);
+        // 超出逻辑范围 = 中立
+        uint32_t dir = (uint32_t)(v - op.logicalMin) * op.hatScale;
+        if (v >= op.logicalMin && dir < 8) buttons |= kHatFlags[dir];
+    }
+
+    state->buttons = buttons;
+    state->leftStickX = axes[0];
+    state->leftStickY = axes[1];
+    state->rightStickX = axes[2];
+    state->rightStickY = axes[3];
+    state->leftTrigger = leftTrigger;
+    state->rightTrigger = rightTrigger;
+    return GAMEPAD_REPORT_INPUT;
+}
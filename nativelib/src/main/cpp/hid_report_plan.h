@@ -0,0 +1,122 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file hid_report_plan.h
+ * @brief HID 报告描述符编译器：描述符 → 字段提取计划
+ *
+ * 通用 HID 手柄原先每帧都按启发式猜测摇杆 / 按钮位置（parseGenericHidReport），
+ * 或按 SDL 映射逐项遍历固定字节偏移（applyGamepadMapping）。未知手柄布局一变就解析错位。
+ *
+ * 本模块在连接时读取一次设备的 HID 报告描述符，编译为紧凑的提取计划：
+ *   每个字段的位偏移 / 位宽 / 逻辑范围（预计算定点缩放系数）/ 目标 Moonlight 字段
+ * 每帧只需按计划顺序取位并缩放，不再做任何格式判断。
+ *
+ * 字段绑定：
+ * - 有 SDL GameControllerDB 映射时，b# / a# / h# 按描述符中的按钮 / 轴 / HAT 序号解析为实际位偏移
+ * - 否则按 HID Usage 绑定：X/Y → 左摇杆；Z/Rz → 右摇杆 (此时 Rx/Ry → 扳机)，
+ *   或 Rx/Ry → 右摇杆 (此时 Z 为组合扳机)；Brake/Accelerator → 扳机；Hat Switch → 十字键；
+ *   Button N 按 DirectInput 常见顺序
+ *
+ * 输出与其他解析器一致：摇杆 -32768..32767（Y 轴为 HID 方向，向下为正），扳机 0..255。
+ */
+
+#ifndef HID_REPORT_PLAN_H
+#define HID_REPORT_PLAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gamepad_napi.h"
+#include "sdl_gamecontrollerdb.h"
+
+#define HID_PLAN_MAX_OPS      48
+#define HID_PLAN_MAX_BUTTONS  32
+#define HID_PLAN_MAX_REPORT   64    // 只编译前 64 字节内的字段（全速 USB 中断包上限）
+
+/**
+ * 计划操作目标
+ */
+enum HidPlanTarget {
+    HID_TARGET_BUTTON = 0,      // 非零置位 buttonFlag
+    HID_TARGET_LEFT_X,
+    HID_TARGET_LEFT_Y,
+    HID_TARGET_RIGHT_X,
+    HID_TARGET_RIGHT_Y,
+    HID_TARGET_LEFT_TRIGGER,    // 轴或 1 位按钮 → 0..255
+    HID_TARGET_RIGHT_TRIGGER,
+    HID_TARGET_TRIGGER_PAIR,    // 单轴组合扳机：中心以下为 LT，以上为 RT
+    HID_TARGET_HAT,             // 8 / 4 方向 HAT → 十字键
+    HID_TARGET_COUNT
+};
+
+/**
+ * 单个字段的提取操作
+ */
+struct HidPlanOp {
+    uint16_t bitOffset;     // 相对报告首字节（含 Report ID）
+    uint8_t bitSize;        // 1-32
+    uint8_t loadShift;      // 从 loadOffset 处 64 位小端装入后的右移位数
+    uint16_t loadOffset;    // 装入起点：保证 loadOffset + 8 <= max(minLength, 8)
+    uint8_t target;         // HidPlanTarget
+    uint8_t isSigned;       // 逻辑最小值 < 0 时按有符号取值
+    uint8_t invert;         // 轴反转 (SDL a~#)
+    uint8_t hatScale;       // HAT：1 = 8 方向，2 = 4 方向
+    int32_t logicalMin;
+    int32_t logicalMax;
+    uint32_t scale;         // 定点 16.16：(输出范围 << 16) / (max - min)
+    uint32_t buttonFlag;    // BUTTON 目标的 BTN_FLAG_*
+};
+
+/**
+ * 编译结果
+ */
+struct HidReportPlan {
+    uint8_t reportId;           // 0 = 报告不带 Report ID
+    uint16_t minLength;         // 报告最小字节数（短报告直接忽略）
+    uint8_t opCount;
+    HidPlanOp ops[HID_PLAN_MAX_OPS];            // 按 target 分组，执行时每组一个无分派的循环
+    uint8_t opStart[HID_TARGET_COUNT + 1];      // 第 t 组为 ops[opStart[t], opStart[t + 1])
+
+    // 快速路径：1 位按钮集中在 32 位窗口内时一次取出，按 4 位一组查表合成 BTN_FLAG_*
+    uint16_t buttonRunBitOffset;
+    uint16_t buttonRunLoadOffset;
+    uint8_t buttonRunLoadShift;
+    uint8_t buttonRunCount;     // 0 = 无按钮段（按钮走 ops）
+    uint32_t buttonRunLut[HID_PLAN_MAX_BUTTONS / 4][16];
+
+    // 描述符统计 (调试 / UI)
+    uint8_t buttonCount;
+    uint8_t axisCount;
+    uint8_t hatCount;
+    bool usedSdlMapping;
+};
+
+/**
+ * 编译 HID 报告描述符
+ *
+ * 只考虑 Generic Desktop Joystick / Gamepad / Multi-axis 应用集合中的 Input 项；
+ * 描述符含多个 Report ID 时选择手柄字段最多的报告。
+ *
+ * @param desc        报告描述符
+ * @param len         描述符长度
+ * @param sdlMapping  SDL 映射（可为 NULL，则按 Usage 绑定）
+ * @param out         输出计划
+ * @return 找到至少一个摇杆轴或按钮时返回 true
+ */
+bool HidPlan_Compile(const uint8_t *desc, size_t len, const GamepadMapping *sdlMapping, HidReportPlan *out);
+
+/**
+ * 按计划解析一帧报告（不分配、不写日志，可在任意线程调用）
+ * @return GAMEPAD_REPORT_INPUT；Report ID 不匹配或报告过短时返回 GAMEPAD_REPORT_IGNORED（state 不变）
+ */
+int HidPlan_Apply(const HidReportPlan *plan, const uint8_t *data, size_t len, NapiGamepadState *state);
+
+#endif // HID_REPORT_PLAN_H
@@ -0,0 +1,596 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file input_scheduler.cpp
+ * @brief 输入合并调度实现
+ */
+
+#include "input_scheduler.h"
+#include "latency_histogram.h"
+
+#include <string.h>
+#include <time.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <hilog/log.h>
+
+#include "moonlight-common-c/src/Limelight.h"
+
+#define LOG_TAG "InputScheduler"
+
+// 与 moonlight-common-c 支持的手柄数一致
+#define SCHED_MAX_CONTROLLERS 16
+
+static const int MIN_RATE_HZ = 30;
+static const int MAX_RATE_HZ = 1000;
+static const int DEFAULT_STREAM_FPS = 60;
+
+// 额外延迟直方图：20µs 桶，覆盖 0-40ms（30Hz 周期内）
+static const uint32_t LATENCY_BUCKET_US = 20;
+
+enum FlushReason {
+    FLUSH_IMMEDIATE = 0,    // 周期已过，调用线程直接发送
+    FLUSH_EDGE,             // 按键边沿
+    FLUSH_TIMER             // 发送线程周期补发
+};
+
+/**
+ * 通道公共状态：pendingSinceNs != 0 表示有待发输入
+ */
+struct SchedChannel {
+    uint64_t lastSendNs;
+    uint64_t pendingSinceNs;
+};
+
+struct MouseChannel {
+    SchedChannel ch;
+    int32_t deltaX;             // 累计相对增量（超出 short 时分多包发送）
+    int32_t deltaY;
+    bool positionPending;       // 绝对位置取最新值
+    short x, y, refWidth, refHeight;
+    int32_t scroll;             // 累计高精度滚轮
+    int32_t hscroll;
+};
+
+struct ControllerChannel {
+    SchedChannel ch;
+    bool valid;                 // state 为最近一次提交的状态
+    short activeGamepadMask;
+    int buttonFlags;
+    unsigned char leftTrigger, rightTrigger;
+    short leftStickX, leftStickY, rightStickX, rightStickY;
+};
+
+static std::mutex g_schedMutex;
+static MouseChannel g_mouse;
+static ControllerChannel g_controllers[SCHED_MAX_CONTROLLERS];
+static uint32_t g_pendingControllerMask = 0;    // 有待发状态的手柄位图 (g_schedMutex)
+
+// 配置
+static std::atomic<int> g_rateHz{INPUT_SCHEDULER_RATE_OFF};
+static std::atomic<int> g_streamFps{DEFAULT_STREAM_FPS};
+static std::atomic<bool> g_connected{false};
+
+// 发送线程 (g_schedMutex 保护)
+static std::condition_variable g_schedCv;
+static std::thread g_schedThread;
+static bool g_schedThreadRunning = false;
+
+// 统计
+static std::atomic<uint64_t> g_sessionStartNs{0};
+static std::atomic<uint64_t> g_eventsIn{0};
+static std::atomic<uint64_t> g_packetsOut{0};
+static std::atomic<uint64_t> g_immediateSends{0};
+static std::atomic<uint64_t> g_edgeSends{0};
+static std::atomic<uint64_t> g_timerFlushes{0};
+static std::atomic<uint64_t> g_latencySamples{0};
+static std::atomic<uint64_t> g_latencyTotalNs{0};
+static LatencyHistogram<2000> g_latencyHist;
+
+// ============================================================
+// 内部实现 (调用方持有 g_schedMutex)
+// ============================================================
+
+static uint64_t monotonicNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int effectiveRateHz() {
+    int rate = g_rateHz.load(std::memory_order_relaxed);
+    if (rate == INPUT_SCHEDULER_RATE_FRAME) {
+        rate = g_streamFps.load(std::memory_order_relaxed);
+    }
+    if (rate < MIN_RATE_HZ) rate = MIN_RATE_HZ;
+    if (rate > MAX_RATE_HZ) rate = MAX_RATE_HZ;
+    return rate;
+}
+
+static uint64_t periodNs() {
+    return 1000000000ULL / (uint64_t)effectiveRateHz();
+}
+
+static bool schedulerActive() {
+    return g_rateHz.load(std::memory_order_relaxed) != INPUT_SCHEDULER_RATE_OFF &&
+           g_connected.load(std::memory_order_relaxed);
+}
+
+static short takeShort(int32_t *acc) {
+    int32_t v = *acc;
+    if (v > 32767) v = 32767;
+    if (v < -32768) v = -32768;
+    *acc -= v;
+    return (short)v;
+}
+
+static void recordFlush(SchedChannel *ch, uint64_t now, int reason) {
+    uint64_t waitNs = (ch->pendingSinceNs == 0 || now < ch->pendingSinceNs) ? 0 : now - ch->pendingSinceNs;
+    g_latencySamples.fetch_add(1, std::memory_order_relaxed);
+    g_latencyTotalNs.fetch_add(waitNs, std::memory_order_relaxed);
+    g_latencyHist.Record((uint32_t)(waitNs / 1000ULL), LATENCY_BUCKET_US);
+
+    switch (reason) {
+        case FLUSH_IMMEDIATE: g_immediateSends.fetch_add(1, std::memory_order_relaxed); break;
+        case FLUSH_EDGE:      g_edgeSends.fetch_add(1, std::memory_order_relaxed); break;
+        default:              g_timerFlushes.fetch_add(1, std::memory_order_relaxed); break;
+    }
+    ch->lastSendNs = now;
+    ch->pendingSinceNs = 0;
+}
+
+/**
+ * 发送积压的鼠标输入：位置 → 相对增量 → 滚轮，返回第一个错误（无错误返回最后一次结果）
+ */
+static int flushMouseLocked(uint64_t now, int reason) {
+    MouseChannel *m = &g_mouse;
+    int ret = 0;
+    int packets = 0;
+
+    if (m->positionPending) {
+        int r = LiSendMousePositionEvent(m->x, m->y, m->refWidth, m->refHeight);
+        if (ret >= 0) ret = r;
+        m->positionPending = false;
+        packets++;
+    }
+    while (m->deltaX != 0 || m->deltaY != 0) {
+        short dx = takeShort(&m->deltaX);
+        short dy = takeShort(&m->deltaY);
+        int r = LiSendMouseMoveEvent(dx, dy);
+        if (ret >= 0) ret = r;
+        packets++;
+    }
+    while (m->scroll != 0) {
+        int r = LiSendHighResScrollEvent(takeShort(&m->scroll));
+        if (ret >= 0) ret = r;
+        packets++;
+    }
+    while (m->hscroll != 0) {
+        int r = LiSendHighResHScrollEvent(takeShort(&m->hscroll));
+        if (ret >= 0) ret = r;
+        packets++;
+    }
+
+    if (packets > 0) {
+        g_packetsOut.fetch_add((uint64_t)packets, std::memory_order_relaxed);
+        recordFlush(&m->ch, now, reason);
+    } else {
+        m->ch.pendingSinceNs = 0;
+    }
+    return ret;
+}
+
+static int flushControllerLocked(int index, uint64_t now, int reason) {
+    ControllerChannel *c = &g_controllers[index];
+    g_pendingControllerMask &= ~(1u << index);
+    int ret = LiSendMultiControllerEvent(
+        (short)index, c->activeGamepadMask, c->buttonFlags,
+        c->leftTrigger, c->rightTrigger,
+        c->leftStickX, c->leftStickY, c->rightStickX, c->rightStickY
+    );
+    g_packetsOut.fetch_add(1, std::memory_order_relaxed);
+    recordFlush(&c->ch, now, reason);
+    return ret;
+}
+
+static void schedulerThreadLoop();
+
+static void ensureThreadLocked() {
+    if (g_schedThreadRunning) return;
+    g_schedThreadRunning = true;
+    g_schedThread = std::thread(schedulerThreadLoop);
+}
+
+/**
+ * 通道有新输入：周期已过则立即发送，否则标记待发并唤醒发送线程
+ * @return 立即发送时为发送结果，合并待发时为 0
+ */
+static int commitMouseLocked(uint64_t now) {
+    SchedChannel *ch = &g_mouse.ch;
+    if (now - ch->lastSendNs >= periodNs()) {
+        if (ch->pendingSinceNs == 0) ch->pendingSinceNs = now;
+        return flushMouseLocked(now, FLUSH_IMMEDIATE);
+    }
+    if (ch->pendingSinceNs == 0) {
+        ch->pendingSinceNs = now;
+        ensureThreadLocked();
+        g_schedCv.notify_one();
+    }
+    return 0;
+}
+
+static int commitControllerLocked(int index, uint64_t now) {
+    SchedChannel *ch = &g_controllers[index].ch;
+    if (now - ch->lastSendNs >= periodNs()) {
+        if (ch->pendingSinceNs == 0) ch->pendingSinceNs = now;
+        return flushControllerLocked(index, now, FLUSH_IMMEDIATE);
+    }
+    if (ch->pendingSinceNs == 0) {
+        ch->pendingSinceNs = now;
+        g_pendingControllerMask |= 1u << index;
+        ensureThreadLocked();
+        g_schedCv.notify_one();
+    }
+    return 0;
+}
+
+static void flushAllLocked(uint64_t now) {
+    if (g_mouse.ch.pendingSinceNs != 0) {
+        flushMouseLocked(now, FLUSH_TIMER);
+    }
+    while (g_pendingControllerMask != 0) {
+        flushControllerLocked(__builtin_ctz(g_pendingControllerMask), now, FLUSH_TIMER);
+    }
+}
+
+static void resetChannelsLocked() {
+    memset(&g_mouse, 0, sizeof(g_mouse));
+    memset(g_controllers, 0, sizeof(g_controllers));
+    g_pendingControllerMask = 0;
+}
+
+/**
+ * 发送线程：等待最早到期的待发通道，到期后补发
+ */
+static void schedulerThreadLoop() {
+    std::unique_lock<std::mutex> lock(g_schedMutex);
+    while (g_schedThreadRunning) {
+        uint64_t period = periodNs();
+        uint64_t deadline = UINT64_MAX;
+        if (g_mouse.ch.pendingSinceNs != 0) {
+            deadline = g_mouse.ch.lastSendNs + period;
+        }
+        for (uint32_t mask = g_pendingControllerMask; mask != 0; mask &= mask - 1) {
+            uint64_t d = g_controllers[__builtin_ctz(mask)].ch.lastSendNs + period;
+            if (d < deadline) deadline = d;
+        }
+
+        if (deadline == UINT64_MAX) {
+            g_schedCv.wait(lock);
+            continue;
+        }
+
+        uint64_t now = monotonicNs();
+        if (now < deadline) {
+            g_schedCv.wait_for(lock, std::chrono::nanoseconds(deadline - now));
+            continue;
+        }
+
+        if (g_mouse.ch.pendingSinceNs != 0 && now - g_mouse.ch.lastSendNs >= period) {
+            flushMouseLocked(now, FLUSH_TIMER);
+        }
+        for (uint32_t mask = g_pendingControllerMask; mask != 0; mask &= mask - 1) {
+            int index = __builtin_ctz(mask);
+            if (now - g_controllers[index].ch.lastSendNs >= period) {
+                flushControllerLocked(index, now, FLUSH_TIMER);
+            }
+        }
+    }
+}
+
+static void stopThread() {
+    std::thread thread;
+    {
+        std::lock_guard<std::mutex> lock(g_schedMutex);
+        if (!g_schedThreadRunning && !g_schedThread.joinable()) return;
+        g_schedThreadRunning = false;
+        thread = std::move(g_schedThread);
+    }
+    g_schedCv.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+// ============================================================
+// 提交接口
+// ============================================================
+
+int InputScheduler_SendMouseMove(short deltaX, short deltaY) {
+    if (!schedulerActive()) {
+        return LiSendMouseMoveEvent(deltaX, deltaY);
+    }
+
+    std::lock_guard<std::mutex> lock(g_schedMutex);
+    g_eventsIn.fetch_add(1, std::memory_order_relaxed);
+    uint64_t now = monotonicNs();
+    if (g_mouse.positionPending) {
+        // 绝对 / 相对切换：先发出积压的绝对位置，保持先后顺序
+        flushMouseLocked(now, FLUSH_EDGE);
+    }
+    g_mouse.deltaX += deltaX;
+    g_mouse.deltaY += deltaY;
+    return commitMouseLocked(now);
+}
+
+int InputScheduler_SendMousePosition(short x, short y, short referenceWidth, short referenceHeight) {
+    if (!schedulerActive()) {
+        return LiSendMousePositionEvent(x, y, referenceWidth, referenceHeight);
+    }
+
+    std::lock_guard<std::mutex> lock(g_schedMutex);
+    g_eventsIn.fetch_add(1, std::memory_order_relaxed);
+    uint64_t now = monotonicNs();
+    if (g_mouse.deltaX != 0 || g_mouse.deltaY != 0) {
+        flushMouseLocked(now, FLUSH_EDGE);
+    }
+    g_mouse.positionPending = true;
+    g_mouse.x = x;
+    g_mouse.y = y;
+    g_mouse.refWidth = referenceWidth;
+    g_mouse.refHeight = referenceHeight;
+    return commitMouseLocked(now);
+}
+
+int InputScheduler_SendMouseButton(char action, int button) {
+    if (!schedulerActive()) {
+        return LiSendMouseButtonEvent(action, button);
+    }
+
+    std::lock_guard<std::mutex> lock(g_schedMutex);
+    g_eventsIn.fetch_add(1, std::memory_order_relaxed);
+    uint64_t now = monotonicNs();
+    if (g_mouse.ch.pendingSinceNs != 0) {
+        // 点击必须落在积压移动之后的位置
+        flushMouseLocked(now, FLUSH_EDGE);
+    }
+    // 按键包本身不参与节拍（不更新 lastSendNs），点击后的移动不会因此被推迟
+    int ret = LiSendMouseButtonEvent(action, button);
+    g_packetsOut.fetch_add(1, std::memory_order_relaxed);
+    g_edgeSends.fetch_add(1, std::memory_order_relaxed);
+    return ret;
+}
+
+int InputScheduler_SendHighResScroll(short scrollAmount) {
+    if (!schedulerActive()) {
+        return LiSendHighResScrollEvent(scrollAmount);
+    }
+
+    std::lock_guard<std::mutex> lock(g_schedMutex);
+    g_eventsIn.fetch_add(1, std::memory_order_relaxed);
+    g_mouse.scroll += scrollAmount;
+    return commitMouseLocked(monotonicNs());
+}
+
+int InputScheduler_SendHighResHScroll(short scrollAmount) {
+    if (!schedulerActive()) {
+        return LiSendHighResHScrollEvent(scrollAmount);
+    }
+
+    std::lock_guard<std::mutex> lock(g_schedMutex);
+    g_eventsIn.fetch_add(1, std::memory_order_relaxed);
+    g_mouse.hscroll += scrollAmount;
+    return commitMouseLocked(monotonicNs());
+}
+
+int InputScheduler_SendControllerState(short controllerNumber, short activeGamepadMask, int buttonFlags,
+                                       unsigned char leftTrigger, unsigned char rightTrigger,
+                                       short leftStickX, short leftStickY, short rightStickX, short rightStickY) {
+    if (!schedulerActive() || controllerNumber < 0 || controllerNumber >= SCHED_MAX_CONTROLLERS) {
+        return LiSendMultiControllerEvent(controllerNumber, activeGamepadMask, buttonFlags,
+                                          leftTrigger, rightTrigger,
+                                          leftStickX, leftStickY, rightStickX, rightStickY);
+    }
+
+    std::lock_guard<std::mutex> lock(g_schedMutex);
+    g_eventsIn.fetch_add(1, std::memory_order_relaxed);
+    ControllerChannel *c = &g_controllers[controllerNumber];
+    bool edge = !c->valid || c->buttonFlags != buttonFlags || c->activeGamepadMask != activeGamepadMask;
+
+    c->valid = true;
+    c->activeGamepadMask = activeGamepadMask;
+    c->buttonFlags = buttonFlags;
+    c->leftTrigger = leftTrigger;
+    c->rightTrigger = rightTrigger;
+    c->leftStickX = leftStickX;
+    c->leftStickY = leftStickY;
+    c->rightStickX = rightStickX;
+    c->rightStickY = rightStickY;
+
+    uint64_t now = monotonicNs();
+    if (edge) {
+        // 完整状态包：同时带出本通道积压的模拟量
+        return flushControllerLocked(controllerNumber, now, FLUSH_EDGE);
+    }
+    return commitControllerLocked(controllerNumber, now);
+}
+
+// ============================================================
+// 生命周期
+// ============================================================
+
+void InputScheduler_SetStreamFps(int fps) {
+    g_streamFps.store(fps > 0 ? fps : DEFAULT_STREAM_FPS, std::memory_order_relaxed);
+}
+
+void InputScheduler_OnConnectionStarted() {
+    {
+        std::lock_guard<std::mutex> lock(g_schedMutex);
+        resetChannelsLocked();
+    }
+    g_eventsIn.store(0, std::memory_order_relaxed);
+    g_packetsOut.store(0, std::memory_order_relaxed);
+    g_immediateSends.store(0, std::memory_order_relaxed);
+    g_edgeSends.store(0, std::memory_order_relaxed);
+    g_timerFlushes.store(0, std::memory_order_relaxed);
+    g_latencySamples.store(0, std::memory_order_relaxed);
+    g_latencyTotalNs.store(0, std::memory_order_relaxed);
+    g_latencyHist.Reset();
+    g_sessionStartNs.store(monotonicNs(), std::memory_order_relaxed);
+    g_connected.store(true, std::memory_order_release);
+
+    int rate = g_rateHz.load(std::memory_order_relaxed);
+    if (rate != INPUT_SCHEDULER_RATE_OFF) {
+        OH_LOG_INFO(LOG_APP, "[%{public}s] 输入合并已启用: %{public}dHz%{public}s", LOG_TAG,
+                    effectiveRateHz(), rate == INPUT_SCHEDULER_RATE_FRAME ? " (跟随视频帧率)" : "");
+    }
+}
+
+void InputScheduler_OnConnectionStopped() {
+    g_connected.store(false, std::memory_order_release);
+    stopThread();
+    std::lock_guard<std::mutex> lock(g_schedMutex);
+    resetChannelsLocked();
+}
+
+void InputScheduler_GetStats(InputSchedulerStats *out) {
+    if (!out) return;
+    memset(out, 0, sizeof(*out));
+
+    out->rateHz = g_rateHz.load(std::memory_order_relaxed);
+    out->enabled = out->rateHz != INPUT_SCHEDULER_RATE_OFF;
+    out->connected = g_connected.load(std::memory_order_relaxed);
+    out->periodUs = out->enabled ? (uint32_t)(periodNs() / 1000ULL) : 0;
+    out->eventsIn = g_eventsIn.load(std::memory_order_relaxed);
+    out->packetsOut = g_packetsOut.load(std::memory_order_relaxed);
+    out->immediateSends = g_immediateSends.load(std::memory_order_relaxed);
+    out->edgeSends = g_edgeSends.load(std::memory_order_relaxed);
+    out->timerFlushes = g_timerFlushes.load(std::memory_order_relaxed);
+
+    uint64_t startNs = g_sessionStartNs.load(std::memory_order_relaxed);
+    uint64_t now = monotonicNs();
+    if (out->connected && startNs != 0 && now > startNs) {
+        double seconds = (double)(now - startNs) / 1e9;
+        out->eventRateHz = (double)out->eventsIn / seconds;
+        out->packetRateHz = (double)out->packetsOut / seconds;
+    }
+
+    out->latencySamples = g_latencySamples.load(std::memory_order_relaxed);
+    out->avgAddedLatencyUs = out->latencySamples > 0
+        ? (double)g_latencyTotalNs.load(std::memory_order_relaxed) / out->latencySamples / 1000.0 : 0.0;
+    out->p50AddedLatencyUs = g_latencyHist.Percentile(0.50, LATENCY_BUCKET_US);
+    out->p99AddedLatencyUs = g_latencyHist.Percentile(0.99, LATENCY_BUCKET_US);
+    out->maxAddedLatencyUs = g_latencyHist.Max();
+}
+
+// ============================================================
+// NAPI: setConfig(rateHz)
+// ============================================================
+
+static napi_value InputSchedulerNapi_SetConfig(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    int32_t rateHz = INPUT_SCHEDULER_RATE_OFF;
+    if (argc >= 1) napi_get_value_int32(env, args[0], &rateHz);
+    if (rateHz < INPUT_SCHEDULER_RATE_FRAME) rateHz = INPUT_SCHEDULER_RATE_OFF;
+    if (rateHz > 0 && rateHz < MIN_RATE_HZ) rateHz = MIN_RATE_HZ;
+    if (rateHz > MAX_RATE_HZ) rateHz = MAX_RATE_HZ;
+
+    {
+        std::lock_guard<std::mutex> lock(g_schedMutex);
+        if (rateHz == INPUT_SCHEDULER_RATE_OFF && g_connected.load(std::memory_order_relaxed)) {
+            // 运行中关闭：积压输入立即发出，之后各接口直接发送
+            flushAllLocked(monotonicNs());
+        }
+        g_rateHz.store(rateHz, std::memory_order_relaxed);
+    }
+    // 周期可能变短，唤醒发送线程重新计算到期时间
+    g_schedCv.notify_all();
+
+    OH_LOG_INFO(LOG_APP, "[%{public}s] setConfig: rate=%{public}d (0=关闭, -1=跟随帧率 %{public}dfps)",
+                LOG_TAG, rateHz, g_streamFps.load(std::memory_order_relaxed));
+
+    napi_value undefined;
+    napi_get_undefined(env, &undefined);
+    return undefined;
+}
+
+// ============================================================
+// NAPI: getStats() → InputSchedulerStats
+// ============================================================
+
+static napi_value InputSchedulerNapi_GetStats(napi_env env, napi_callback_info info) {
+    InputSchedulerStats stats;
+    InputScheduler_GetStats(&stats);
+
+    napi_value result;
+    napi_create_object(env, &result);
+
+    napi_value val;
+    napi_get_boolean(env, stats.enabled, &val);
+    napi_set_named_property(env, result, "enabled", val);
+    napi_get_boolean(env, stats.connected, &val);
+    napi_set_named_property(env, result, "connected", val);
+    napi_create_int32(env, stats.rateHz, &val);
+    napi_set_named_property(env, result, "rateHz", val);
+    napi_create_uint32(env, stats.periodUs, &val);
+    napi_set_named_property(env, result, "periodUs", val);
+    napi_create_int64(env, (int64_t)stats.eventsIn, &val);
+    napi_set_named_property(env, result, "eventsIn", val);
+    napi_create_int64(env, (int64_t)stats.packetsOut, &val);
+    napi_set_named_property(env, result, "packetsOut", val);
+    napi_create_int64(env, (int64_t)stats.immediateSends, &val);
+    napi_set_named_property(env, result, "immediateSends", val);
+    napi_create_int64(env, (int64_t)stats.edgeSends, &val);
+    napi_set_named_property(env, result, "edgeSends", val);
+    napi_create_int64(env, (int64_t)stats.timerFlushes, &val);
+    napi_set_named_property(env, result, "timerFlushes", val);
+    napi_create_double(env, stats.eventRateHz, &val);
+    napi_set_named_property(env, result, "eventRateHz", val);
+    napi_create_double(env, stats.packetRateHz, &val);
+    napi_set_named_property(env, result, "packetRateHz", val);
+    napi_create_int64(env, (int64_t)stats.latencySamples, &val);
+    napi_set_named_property(env, result, "latencySamples", val);
+    napi_create_double(env, stats.avgAddedLatencyUs, &val);
+    napi_set_named_property(env, result, "avgAddedLatencyUs", val);
+    napi_create_uint32(env, stats.p50AddedLatencyUs, &val);
+    napi_set_named_property(env, result, "p50AddedLatencyUs", val);
+    napi_create_uint32(env, stats.p99AddedLatencyUs, &val);
+    napi_set_named_property(env, result, "p99AddedLatencyUs", val);
+    napi_create_uint32(env, stats.maxAddedLatencyUs, &val);
+    napi_set_named_property(env, result, "maxAddedLatencyUs", val);
+
+    return result;
+}
+
+// ============================================================
+// NAPI 注册
+// ============================================================
+
+void InputScheduler_Init(napi_env env, napi_value exports) {
+    napi_value obj;
+    napi_create_object(env, &obj);
+
+    napi_property_descriptor methods[] = {
+        { "setConfig", nullptr, InputSchedulerNapi_SetConfig, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "getStats",  nullptr, InputSchedulerNapi_GetStats,  nullptr, nullptr, nullptr, napi_default, nullptr },
+    };
+
+    napi_define_properties(env, obj, sizeof(methods) / sizeof(methods[0]), methods);
+    napi_set_named_property(env, exports, "InputScheduler", obj);
+
+    OH_LOG_INFO(LOG_APP, "[%{public}s] InputScheduler NAPI 已注册", LOG_TAG);
+}
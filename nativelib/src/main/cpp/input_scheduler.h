@@ -0,0 +1,101 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file input_scheduler.h
+ * @brief 输入合并调度：鼠标增量 / 高精度滚轮 / 手柄状态按节拍合并发送
+ *
+ * 原路径每个事件一个输入包：1000Hz 鼠标每次移动都调用 LiSendMouseMoveEvent，
+ * 手柄每次轴变化都发送完整状态包。主机按帧消费输入，超出帧率的包只增加控制流与加密开销，不降低延迟。
+ *
+ * 调度规则（鼠标与手柄槽位 0-3 各为独立通道）：
+ * - 距该通道上次发送已超过一个周期：在调用线程立即发送（稀疏输入没有额外延迟）
+ * - 否则合并：相对增量 / 滚轮累加，绝对位置与手柄状态取最新值，到周期边界由发送线程补发
+ * - 按键边沿总是立即发送：鼠标按键先补发积压的移动 / 滚轮（保证点击落点正确），
+ *   手柄 buttonFlags 变化时直接发送最新完整状态（同时带出积压的模拟量）
+ *
+ * 周期：固定频率 (Hz) 或跟随视频帧率（串流配置的 fps）。
+ * 统计：输入事件数 / 输入包数（发送频率），以及合并带来的额外延迟（通道首个待发事件 → 实际发送）。
+ *
+ * 线程模型：提交接口可在任意线程调用（鼠标监听线程、JS 线程、DDK 轮询线程、GCK 发送线程）；
+ * 所有发送在单个互斥锁内完成，同一通道的包序与提交顺序一致。
+ * 未启用或未连接时各接口直接调用对应的 Li* 发送函数。
+ */
+
+#ifndef INPUT_SCHEDULER_H
+#define INPUT_SCHEDULER_H
+
+#include <napi/native_api.h>
+#include <stdint.h>
+
+// setConfig 的 rateHz：0 = 关闭合并，-1 = 跟随视频帧率
+#define INPUT_SCHEDULER_RATE_OFF    0
+#define INPUT_SCHEDULER_RATE_FRAME  (-1)
+
+/**
+ * 调度统计（自串流连接建立起累计）
+ */
+struct InputSchedulerStats {
+    bool enabled;
+    bool connected;
+    int32_t rateHz;             // 配置值（0 / -1 / Hz）
+    uint32_t periodUs;          // 当前生效的合并周期
+    uint64_t eventsIn;          // 提交的输入事件数
+    uint64_t packetsOut;        // Li* 发送调用数
+    uint64_t immediateSends;    // 周期已过，在调用线程直接发送
+    uint64_t edgeSends;         // 按键边沿触发的立即发送
+    uint64_t timerFlushes;      // 发送线程在周期边界补发
+    double eventRateHz;         // 平均输入事件频率
+    double packetRateHz;        // 平均输入包频率
+    uint64_t latencySamples;
+    double avgAddedLatencyUs;   // 合并带来的额外延迟（立即发送计 0）
+    uint32_t p50AddedLatencyUs;
+    uint32_t p99AddedLatencyUs;
+    uint32_t maxAddedLatencyUs;
+};
+
+/**
+ * 初始化 InputScheduler NAPI 模块。
+ *
+ * 注册到 exports.InputScheduler 命名空间：
+ *   - setConfig(rateHz): void     0 = 关闭，-1 = 跟随视频帧率，其余为固定频率（30-1000）
+ *   - getStats(): obj
+ */
+void InputScheduler_Init(napi_env env, napi_value exports);
+
+/**
+ * 串流配置的视频帧率（LiStartConnection 前调用），供 INPUT_SCHEDULER_RATE_FRAME 使用
+ */
+void InputScheduler_SetStreamFps(int fps);
+
+/**
+ * 串流连接建立：开始合并，重置统计
+ */
+void InputScheduler_OnConnectionStarted();
+
+/**
+ * 串流连接停止 / 终止：丢弃积压输入并停止发送线程
+ */
+void InputScheduler_OnConnectionStopped();
+
+// ---- 提交接口：参数与对应 Li* 函数一致；立即发送时返回其返回值，合并待发时返回 0 ----
+
+int InputScheduler_SendMouseMove(short deltaX, short deltaY);
+int InputScheduler_SendMousePosition(short x, short y, short referenceWidth, short referenceHeight);
+int InputScheduler_SendMouseButton(char action, int button);
+int InputScheduler_SendHighResScroll(short scrollAmount);
+int InputScheduler_SendHighResHScroll(short scrollAmount);
+int InputScheduler_SendControllerState(short controllerNumber, short activeGamepadMask, int buttonFlags,
+                                       unsigned char leftTrigger, unsigned char rightTrigger,
+                                       short leftStickX, short leftStickY, short rightStickX, short rightStickY);
+
+void InputScheduler_GetStats(InputSchedulerStats *out);
+
+#endif // INPUT_SCHEDULER_H
@@ -0,0 +1,79 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file latency_histogram.h
+ * @brief 固定桶耗时直方图（header-only）
+ *
+ * 实时线程每次记录只做一次 relaxed fetch_add（外加偶尔的 max CAS），无锁、无分配；
+ * 统计线程读取时估算分位数。桶宽由调用方按量级选择，超出范围的样本落在最后一桶。
+ */
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * 固定桶直方图，记录端无锁（relaxed 原子计数），读取端按桶估算分位数
+ */
+template <int BucketCount>
+class LatencyHistogram {
+public:
+    void Reset() {
+        for (auto& b : buckets_) b.store(0, std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+    }
+
+    void Record(uint32_t value, uint32_t bucketWidth) {
+        uint32_t idx = value / bucketWidth;
+        if (idx >= static_cast<uint32_t>(BucketCount)) idx = BucketCount - 1;
+        buckets_[idx].fetch_add(1, std::memory_order_relaxed);
+        uint32_t prev = max_.load(std::memory_order_relaxed);
+        while (value > prev && !max_.compare_exchange_weak(prev, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * 分位数所在桶的上沿（不超过实测最大值），无样本时返回 0
+     */
+    uint32_t Percentile(double p, uint32_t bucketWidth) const {
+        uint64_t counts[BucketCount];
+        uint64_t total = 0;
+        for (int i = 0; i < BucketCount; i++) {
+            counts[i] = buckets_[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+        if (total == 0) return 0;
+        uint64_t rank = static_cast<uint64_t>(p * static_cast<double>(total) + 0.5);
+        if (rank < 1) rank = 1;
+        uint64_t acc = 0;
+        uint32_t maxValue = Max();
+        for (int i = 0; i < BucketCount; i++) {
+            acc += counts[i];
+            if (acc >= rank) {
+                uint32_t upper = static_cast<uint32_t>(i + 1) * bucketWidth - 1;
+                return upper < maxValue ? upper : maxValue;
+            }
+        }
+        return maxValue;
+    }
+
+    uint32_t Max() const { return max_.load(std::memory_order_relaxed); }
+
+    uint64_t Bucket(int index) const { return buckets_[index].load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> buckets_[BucketCount] = {};
+    std::atomic<uint32_t> max_{0};
+};
+
+#endif // LATENCY_HISTOGRAM_H
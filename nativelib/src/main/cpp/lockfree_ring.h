@@ -0,0 +1,436 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file lockfree_ring.h
+ * @brief 无锁环形队列模板（header-only）
+ *
+ * SpscRing<T>  单生产者单消费者，面向批量数据（PCM 采样等）：
+ *   - 容量向上取整到 2 的幂，索引用掩码回绕（无 % 除法）
+ *   - head / tail 为单调递增的 uint32_t，满/空由差值判断，不浪费保留位
+ *   - head、tail 各占独立 cache line，并各自缓存对端索引，
+ *     只有缓存值不够用时才读取对端 cache line，避免伪共享和 cache line 乒乓
+ *   - PrepareWrite / PrepareRead 返回最多两段连续区间，调用方可直接
+ *     memcpy 或原地处理，再用 CommitWrite / CommitRead 一次提交整批
+ *
+ * MpscRing<T>  多生产者单消费者，面向小对象（事件、命令）：
+ *   - 有界队列，每个槽位带序号 (Vyukov)，生产端一次 CAS，无锁无堆分配
+ *   - 队列满时 TryPush 返回 false，由调用方决定丢弃策略
+ *
+ * 两者都要求 T 可平凡复制；Init / Release / Reset 不是线程安全的，
+ * 只能在生产者和消费者都静止时调用。
+ */
+
+#ifndef LOCKFREE_RING_H
+#define LOCKFREE_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+// 统一按 64 字节对齐（ARM64 / x86_64 主流 cache line）
+#define RING_CACHE_LINE 64
+
+/**
+ * 向上取整到 2 的幂（n ≤ 2^31）
+ */
+inline uint32_t RingRoundUpPow2(uint32_t n) {
+    if (n <= 1) return 1;
+    n--;
+    n |= n >> 1;
+    n |= n >> 2;
+    n |= n >> 4;
+    n |= n >> 8;
+    n |= n >> 16;
+    return n + 1;
+}
+
+/**
+ * 一段连续区间
+ */
+template <typename T>
+struct RingSpan {
+    T* data;
+    uint32_t size;
+};
+
+/**
+ * 环形区间最多分成两段：[first] 到缓冲区末尾，[second] 从缓冲区开头
+ */
+template <typename T>
+struct RingSpanPair {
+    RingSpan<T> first;
+    RingSpan<T> second;
+
+    uint32_t Total() const { return first.size + second.size; }
+};
+
+// =============================================================================
+// SpscRing
+// =============================================================================
+
+template <typename T>
+class SpscRing {
+    static_assert(std::is_trivially_copyable<T>::value, "SpscRing requires trivially copyable T");
+
+public:
+    SpscRing() = default;
+    ~SpscRing() { Release(); }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    /**
+     * 分配缓冲区
+     * @param minCapacity 最少可容纳元素数（向上取整到 2 的幂）
+     * @return false 表示容量非法或分配失败
+     */
+    bool Init(uint32_t minCapacity) {
+        Release();
+        if (minCapacity == 0 || minCapacity > (1u << 31)) return false;
+        uint32_t capacity = RingRoundUpPow2(minCapacity);
+        buffer_ = new (std::nothrow) T[capacity];
+        if (buffer_ == nullptr) return false;
+        memset(static_cast<void*>(buffer_), 0, capacity * sizeof(T));
+        capacity_ = capacity;
+        mask_ = capacity - 1;
+        Reset();
+        return true;
+    }
+
+    void Release() {
+        delete[] buffer_;
+        buffer_ = nullptr;
+        capacity_ = 0;
+        mask_ = 0;
+        Reset();
+    }
+
+    /**
+     * 清空队列（仅在两端都静止时调用）
+     */
+    void Reset() {
+        head_.store(0, std::memory_order_relaxed);
+        tail_.store(0, std::memory_order_relaxed);
+        cachedHead_ = 0;
+        cachedTail_ = 0;
+    }
+
+    bool IsInitialized() const { return buffer_ != nullptr; }
+    uint32_t Capacity() const { return capacity_; }
+
+    /**
+     * 当前元素数（任意线程调用，结果为近似值）
+     */
+    uint32_t Size() const {
+        // 先读 head 再读 tail，保证 tail ≥ head
+        uint32_t head = head_.load(std::memory_order_acquire);
+        uint32_t tail = tail_.load(std::memory_order_acquire);
+        uint32_t size = tail - head;
+        return size > capacity_ ? capacity_ : size;
+    }
+
+    // ---------------- 生产者 ----------------
+
+    /**
+     * 生产端可写元素数
+     */
+    uint32_t WritableCount() {
+        cachedHead_ = head_.load(std::memory_order_acquire);
+        return capacity_ - (tail_.load(std::memory_order_relaxed) - cachedHead_);
+    }
+
+    /**
+     * 获取最多 maxCount 个可写槽位（不提交）
+     */
+    RingSpanPair<T> PrepareWrite(uint32_t maxCount) {
+        uint32_t tail = tail_.load(std::memory_order_relaxed);
+        uint32_t free = capacity_ - (tail - cachedHead_);
+        if (free < maxCount) {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            free = capacity_ - (tail - cachedHead_);
+        }
+        return MakeSpans(tail, free < maxCount ? free : maxCount);
+    }
+
+    /**
+     * 提交 count 个已写入的元素（count 不得超过 PrepareWrite 返回的总数）
+     */
+    void CommitWrite(uint32_t count) {
+        tail_.store(tail_.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    /**
+     * 整批写入：空间不足时不写入任何数据
+     * @return true 写入成功
+     */
+    bool TryWriteAll(const T* src, uint32_t count) {
+        RingSpanPair<T> spans = PrepareWrite(count);
+        if (spans.Total() < count) return false;
+        CopyIn(spans, src);
+        CommitWrite(count);
+        return true;
+    }
+
+    /**
+     * 尽量写入
+     * @return 实际写入数
+     */
+    uint32_t Write(const T* src, uint32_t count) {
+        RingSpanPair<T> spans = PrepareWrite(count);
+        CopyIn(spans, src);
+        uint32_t written = spans.Total();
+        CommitWrite(written);
+        return written;
+    }
+
+    // ---------------- 消费者 ----------------
+
+    /**
+     * 消费端可读元素数
+     */
+    uint32_t ReadableCount() {
+        cachedTail_ = tail_.load(std::memory_order_acquire);
+        return cachedTail_ - head_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * 获取最多 maxCount 个可读元素（不提交）
+     */
+    RingSpanPair<const T> PrepareRead(uint32_t maxCount) {
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        uint32_t avail = cachedTail_ - head;
+        if (avail < maxCount) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            avail = cachedTail_ - head;
+        }
+        RingSpanPair<T> spans = MakeSpans(head, avail < maxCount ? avail : maxCount);
+        RingSpanPair<const T> result;
+        result.first.data = spans.first.data;
+        result.first.size = spans.first.size;
+        result.second.data = spans.second.data;
+        result.second.size = spans.second.size;
+        return result;
+    }
+
+    /**
+     * 释放 count 个已读元素
+     */
+    void CommitRead(uint32_t count) {
+        head_.store(head_.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    /**
+     * 读取最多 maxCount 个元素
+     * @return 实际读取数
+     */
+    uint32_t Read(T* dst, uint32_t maxCount) {
+        RingSpanPair<const T> spans = PrepareRead(maxCount);
+        if (spans.first.size > 0) {
+            memcpy(dst, spans.first.data, spans.first.size * sizeof(T));
+        }
+        if (spans.second.size > 0) {
+            memcpy(dst + spans.first.size, spans.second.data, spans.second.size * sizeof(T));
+        }
+        uint32_t count = spans.Total();
+        CommitRead(count);
+        return count;
+    }
+
+    /**
+     * 丢弃最多 count 个最旧元素（消费端）
+     * @return 实际丢弃数
+     */
+    uint32_t Skip(uint32_t count) {
+        uint32_t avail = ReadableCount();
+        if (count > avail) count = avail;
+        CommitRead(count);
+        return count;
+    }
+
+private:
+    RingSpanPair<T> MakeSpans(uint32_t pos, uint32_t count) const {
+        RingSpanPair<T> spans;
+        uint32_t offset = pos & mask_;
+        uint32_t firstLen = capacity_ - offset;
+        if (firstLen > count) firstLen = count;
+        spans.first.data = buffer_ + offset;
+        spans.first.size = firstLen;
+        spans.second.data = buffer_;
+        spans.second.size = count - firstLen;
+        return spans;
+    }
+
+    static void CopyIn(const RingSpanPair<T>& spans, const T* src) {
+        if (spans.first.size > 0) {
+            memcpy(spans.first.data, src, spans.first.size * sizeof(T));
+        }
+        if (spans.second.size > 0) {
+            memcpy(spans.second.data, src + spans.first.size, spans.second.size * sizeof(T));
+        }
+    }
+
+    // 只读区：初始化后不再修改，双方共享不会产生写失效
+    alignas(RING_CACHE_LINE) T* buffer_ = nullptr;
+    uint32_t capacity_ = 0;
+    uint32_t mask_ = 0;
+
+    // 消费者独占 cache line：读位置 + 缓存的写位置
+    alignas(RING_CACHE_LINE) std::atomic<uint32_t> head_{0};
+    uint32_t cachedTail_ = 0;
+
+    // 生产者独占 cache line：写位置 + 缓存的读位置
+    alignas(RING_CACHE_LINE) std::atomic<uint32_t> tail_{0};
+    uint32_t cachedHead_ = 0;
+
+    char pad_[RING_CACHE_LINE - sizeof(std::atomic<uint32_t>) - sizeof(uint32_t)];
+};
+
+// =============================================================================
+// MpscRing
+// =============================================================================
+
+template <typename T>
+class MpscRing {
+    static_assert(std::is_trivially_copyable<T>::value, "MpscRing requires trivially copyable T");
+
+public:
+    MpscRing() = default;
+    ~MpscRing() { Release(); }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    /**
+     * 分配槽位
+     * @param minCapacity 最少槽位数（向上取整到 2 的幂，至少 2）
+     */
+    bool Init(uint32_t minCapacity) {
+        Release();
+        if (minCapacity == 0 || minCapacity > (1u << 30)) return false;
+        uint32_t capacity = RingRoundUpPow2(minCapacity < 2 ? 2 : minCapacity);
+        cells_ = new (std::nothrow) Cell[capacity];
+        if (cells_ == nullptr) return false;
+        capacity_ = capacity;
+        mask_ = capacity - 1;
+        Reset();
+        return true;
+    }
+
+    void Release() {
+        delete[] cells_;
+        cells_ = nullptr;
+        capacity_ = 0;
+        mask_ = 0;
+        enqueuePos_.store(0, std::memory_order_relaxed);
+        dequeuePos_.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * 清空队列（仅在所有生产者和消费者都静止时调用）
+     */
+    void Reset() {
+        for (uint32_t i = 0; i < capacity_; i++) {
+            cells_[i].seq.store(i, std::memory_order_relaxed);
+        }
+        enqueuePos_.store(0, std::memory_order_relaxed);
+        dequeuePos_.store(0, std::memory_order_relaxed);
+    }
+
+    bool IsInitialized() const { return cells_ != nullptr; }
+    uint32_t Capacity() const { return capacity_; }
+
+    /**
+     * 当前元素数（近似值）
+     */
+    uint32_t Size() const {
+        uint32_t deq = dequeuePos_.load(std::memory_order_acquire);
+        uint32_t enq = enqueuePos_.load(std::memory_order_acquire);
+        uint32_t size = enq - deq;
+        return size > capacity_ ? capacity_ : size;
+    }
+
+    /**
+     * 生产端（任意线程）
+     * @return false 表示队列已满
+     */
+    bool TryPush(const T& value) {
+        if (cells_ == nullptr) return false;
+        uint32_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & mask_];
+            uint32_t seq = cell.seq.load(std::memory_order_acquire);
+            int32_t diff = static_cast<int32_t>(seq - pos);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = value;
+                    cell.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+                // CAS 失败时 pos 已被更新，重试
+            } else if (diff < 0) {
+                return false;  // 满
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * 消费端（单线程）
+     * @return false 表示队列为空（或生产者尚未写完该槽位）
+     */
+    bool TryPop(T& out) {
+        if (cells_ == nullptr) return false;
+        uint32_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        Cell& cell = cells_[pos & mask_];
+        uint32_t seq = cell.seq.load(std::memory_order_acquire);
+        if (static_cast<int32_t>(seq - (pos + 1)) < 0) return false;
+        out = cell.value;
+        cell.seq.store(pos + capacity_, std::memory_order_release);
+        dequeuePos_.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * 批量出队（单线程），遇到空槽位即停止
+     * @return 实际出队数
+     */
+    uint32_t PopBatch(T* out, uint32_t maxCount) {
+        uint32_t n = 0;
+        while (n < maxCount && TryPop(out[n])) {
+            n++;
+        }
+        return n;
+    }
+
+private:
+    struct Cell {
+        std::atomic<uint32_t> seq{0};
+        T value;
+    };
+
+    alignas(RING_CACHE_LINE) Cell* cells_ = nullptr;
+    uint32_t capacity_ = 0;
+    uint32_t mask_ = 0;
+
+    // 生产者之间竞争的写位置
+    alignas(RING_CACHE_LINE) std::atomic<uint32_t> enqueuePos_{0};
+
+    // 消费者独占的读位置
+    alignas(RING_CACHE_LINE) std::atomic<uint32_t> dequeuePos_{0};
+
+    char pad_[RING_CACHE_LINE - sizeof(std::atomic<uint32_t>)];
+};
+
+#endif // LOCKFREE_RING_H
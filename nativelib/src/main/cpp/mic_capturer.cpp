@@ -13,12 +13,16 @@
  * @brief HarmonyOS OHAudio 低时延麦克风采集器实现
  *
  * 使用 OHAudio native API + AUDIOSTREAM_LATENCY_MODE_FAST，在音频回调线程中
- * 直接完成 PCM → Opus 编码 → 网络发送，消除 ArkTS 层跨线程和 GC 开销。
+ * 完成 PCM → Opus 编码并入队，由 MicSend 线程发送，消除 ArkTS 层跨线程和 GC 开销。
  */
 
 #include "mic_capturer.h"
+#include "moonlight-common-c/src/Limelight.h"
 #include <hilog/log.h>
+#include <qos/qos.h>
+#include <pthread.h>
 #include <cstring>
+#include <chrono>
 #include <dlfcn.h>
 
 #define LOG_TAG "MicCapturer"
@@ -71,6 +75,11 @@ extern "C" {
     int sendMicrophoneOpusData(const unsigned char* data, int length);
 }
 
+static inline uint64_t MicNowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
 // =============================================================================
 // 构造 / 析构
 // =============================================================================
@@ -92,18 +101,28 @@ int MicCapturer::Init(const MicCapturerConfig& config) {
     }
 
     config_ = config;
+    if (config_.frameSizeMs != 5 && config_.frameSizeMs != 10 && config_.frameSizeMs != 20) {
+        OH_LOG_WARN(LOG_APP, "Unsupported mic frame size %{public}d ms, using 20 ms", config_.frameSizeMs);
+        config_.frameSizeMs = 20;
+    }
 
     // 计算目标帧字节数：samplesPerFrame * channels * sizeof(int16_t)
     int samplesPerFrame = config_.sampleRate * config_.frameSizeMs / 1000;
     frameSizeBytes_ = samplesPerFrame * config_.channels * 2; // 16-bit
+    bytesPerMs_ = config_.sampleRate / 1000 * config_.channels * 2;
     frameBufferPos_ = 0;
+    if (frameSizeBytes_ > kMaxFrameBytes) {
+        OH_LOG_ERROR(LOG_APP, "Mic frame too large: %{public}d bytes", frameSizeBytes_);
+        return -1;
+    }
 
-    OH_LOG_INFO(LOG_APP, "MicCapturer Init: rate=%{public}d ch=%{public}d bitrate=%{public}d frameMs=%{public}d frameBytes=%{public}d",
+    OH_LOG_INFO(LOG_APP, "MicCapturer Init: rate=%{public}d ch=%{public}d bitrate=%{public}d frameMs=%{public}d "
+                "frameBytes=%{public}d adaptive=%{public}d",
                 config_.sampleRate, config_.channels, config_.opusBitrate,
-                config_.frameSizeMs, frameSizeBytes_);
+                config_.frameSizeMs, frameSizeBytes_, config_.adaptive ? 1 : 0);
 
     // --- 初始化 Opus 编码器 ---
-    int ret = encoder_.Init(config_.sampleRate, config_.channels, config_.opusBitrate);
+    int ret = encoder_.Init(config_.sampleRate, config_.channels, config_.opusBitrate, config_.frameSizeMs);
     if (ret != 0) {
         OH_LOG_ERROR(LOG_APP, "Failed to init Opus encoder: %{public}d", ret);
         return -1;
@@ -137,7 +156,7 @@ int MicCapturer::Init(const MicCapturerConfig& config) {
         OH_LOG_INFO(LOG_APP, "Mic latency mode set to FAST");
     }
 
-    // 回调帧大小（尽量匹配 Opus 帧）
+    // 回调帧大小（尽量匹配 Opus 帧，匹配时每个回调整帧零拷贝编码）
     result = OH_AudioStreamBuilder_SetFrameSizeInCallback(builder_, samplesPerFrame);
     if (result == AUDIOSTREAM_SUCCESS) {
         OH_LOG_INFO(LOG_APP, "Mic callback frame size: %{public}d samples", samplesPerFrame);
@@ -210,11 +229,46 @@ int MicCapturer::Start() {
     framesEncoded_.store(0);
     framesSent_.store(0);
     framesDropped_.store(0);
+    queueOverflows_.store(0);
+    sendCount_.store(0);
+    sendTotalNs_.store(0);
+    sendMaxNs_.store(0);
+    zeroCopyFrames_.store(0);
+    copiedFrames_.store(0);
+    bitrateChanges_.store(0);
+    frameSizeChanges_.store(0);
+    rttMs_.store(-1);
+    rttVarianceMs_.store(0);
+    callbackHist_.Reset();
+    depthHist_.Reset();
+    mouthToWireHist_.Reset();
     frameBufferPos_ = 0;
 
+    // 从配置值起步（上次会话自适应后的码率/帧长不延续）
+    encoder_.SetBitrate(config_.opusBitrate);
+    if (encoder_.SetFrameSizeMs(config_.frameSizeMs) == 0) {
+        frameSizeBytes_ = encoder_.GetFrameSamples() * config_.channels * 2;
+    }
+    targetBitrate_.store(config_.opusBitrate);
+    targetFrameMs_.store(config_.frameSizeMs);
+    currentBitrate_.store(config_.opusBitrate);
+    currentFrameMs_.store(config_.frameSizeMs);
+    lastControlNs_ = 0;
+    windowSent_ = 0;
+    windowFailed_ = 0;
+    lastOverflows_ = 0;
+    minRttMs_ = 0;
+    cleanWindows_ = 0;
+
+    // 发送线程先于采集启动，保证第一个包就有消费者
+    if (StartSender() != 0) {
+        return -1;
+    }
+
     OH_AudioStream_Result result = OH_AudioCapturer_Start(capturer_);
     if (result != AUDIOSTREAM_SUCCESS) {
         OH_LOG_ERROR(LOG_APP, "Failed to start capturer: %{public}d", result);
+        StopSender();
         return -1;
     }
 
@@ -227,18 +281,32 @@ int MicCapturer::Start() {
 int MicCapturer::Stop() {
     running_.store(false, std::memory_order_release);
 
-    if (capturer_ == nullptr) return 0;
+    if (capturer_ == nullptr) {
+        StopSender();
+        return 0;
+    }
 
     OH_AudioStream_Result result = OH_AudioCapturer_Stop(capturer_);
     if (result != AUDIOSTREAM_SUCCESS) {
         OH_LOG_WARN(LOG_APP, "Failed to stop capturer: %{public}d", result);
     }
 
-    OH_LOG_INFO(LOG_APP, "MicCapturer stopped: captured=%{public}llu encoded=%{public}llu sent=%{public}llu dropped=%{public}llu",
+    // 采集回调已停止，再停发送线程（队列中剩余的包随之丢弃）
+    StopSender();
+
+    OH_LOG_INFO(LOG_APP, "MicCapturer stopped: captured=%{public}llu encoded=%{public}llu sent=%{public}llu "
+                "dropped=%{public}llu overflows=%{public}llu cbP99=%{public}uus depthMax=%{public}u "
+                "zeroCopy=%{public}llu copied=%{public}llu m2wP95=%{public}uus",
                 (unsigned long long)framesCaptured_.load(),
                 (unsigned long long)framesEncoded_.load(),
                 (unsigned long long)framesSent_.load(),
-                (unsigned long long)framesDropped_.load());
+                (unsigned long long)framesDropped_.load(),
+                (unsigned long long)queueOverflows_.load(),
+                callbackHist_.Percentile(0.99, kCallbackBucketUs),
+                depthHist_.Max(),
+                (unsigned long long)zeroCopyFrames_.load(),
+                (unsigned long long)copiedFrames_.load(),
+                mouthToWireHist_.Percentile(0.95, kMouthToWireBucketUs));
     return 0;
 }
 
@@ -271,13 +339,248 @@ void MicCapturer::Cleanup() {
 }
 
 MicCapturerStats MicCapturer::GetStats() const {
-    return {
-        framesCaptured_.load(std::memory_order_relaxed),
-        framesEncoded_.load(std::memory_order_relaxed),
-        framesSent_.load(std::memory_order_relaxed),
-        framesDropped_.load(std::memory_order_relaxed),
-        false // TODO: query OH_AudioCapturer_GetFastStatus when API 20+ available
-    };
+    MicCapturerStats stats = {};
+    stats.framesCapture = framesCaptured_.load(std::memory_order_relaxed);
+    stats.framesEncoded = framesEncoded_.load(std::memory_order_relaxed);
+    stats.framesSent = framesSent_.load(std::memory_order_relaxed);
+    stats.framesDropped = framesDropped_.load(std::memory_order_relaxed);
+    stats.queueOverflows = queueOverflows_.load(std::memory_order_relaxed);
+    stats.isFastMode = false; // TODO: query OH_AudioCapturer_GetFastStatus when API 20+ available
+
+    stats.callbackP50Us = callbackHist_.Percentile(0.50, kCallbackBucketUs);
+    stats.callbackP95Us = callbackHist_.Percentile(0.95, kCallbackBucketUs);
+    stats.callbackP99Us = callbackHist_.Percentile(0.99, kCallbackBucketUs);
+    stats.callbackMaxUs = callbackHist_.Max();
+
+    stats.queueDepthP50 = static_cast<int>(depthHist_.Percentile(0.50, 1));
+    stats.queueDepthP95 = static_cast<int>(depthHist_.Percentile(0.95, 1));
+    stats.queueDepthP99 = static_cast<int>(depthHist_.Percentile(0.99, 1));
+    stats.queueDepthMax = static_cast<int>(depthHist_.Max());
+
+    uint64_t attempts = sendCount_.load(std::memory_order_relaxed);
+    uint64_t totalNs = sendTotalNs_.load(std::memory_order_relaxed);
+    stats.avgSendUs = attempts > 0 ? static_cast<double>(totalNs) / attempts / 1000.0 : 0.0;
+    stats.maxSendUs = static_cast<double>(sendMaxNs_.load(std::memory_order_relaxed)) / 1000.0;
+
+    stats.frameSizeMs = currentFrameMs_.load(std::memory_order_relaxed);
+    stats.bitrate = currentBitrate_.load(std::memory_order_relaxed);
+    stats.zeroCopyFrames = zeroCopyFrames_.load(std::memory_order_relaxed);
+    stats.copiedFrames = copiedFrames_.load(std::memory_order_relaxed);
+    stats.bitrateChanges = bitrateChanges_.load(std::memory_order_relaxed);
+    stats.frameSizeChanges = frameSizeChanges_.load(std::memory_order_relaxed);
+    stats.rttMs = rttMs_.load(std::memory_order_relaxed);
+    stats.rttVarianceMs = rttVarianceMs_.load(std::memory_order_relaxed);
+
+    stats.mouthToWireP50Ms = mouthToWireHist_.Percentile(0.50, kMouthToWireBucketUs) / 1000.0;
+    stats.mouthToWireP95Ms = mouthToWireHist_.Percentile(0.95, kMouthToWireBucketUs) / 1000.0;
+    stats.mouthToWireMaxMs = mouthToWireHist_.Max() / 1000.0;
+    return stats;
+}
+
+// =============================================================================
+// 发送线程
+// =============================================================================
+
+int MicCapturer::StartSender() {
+    StopSender();
+
+    writeIdx_.store(0, std::memory_order_relaxed);
+    readIdx_.store(0, std::memory_order_relaxed);
+
+    if (sem_init(&senderSem_, 0, 0) != 0) {
+        OH_LOG_ERROR(LOG_APP, "MicCapturer: sem_init failed");
+        return -1;
+    }
+    senderSemInitialized_ = true;
+
+    senderRunning_.store(true, std::memory_order_release);
+    senderThread_ = std::thread(&MicCapturer::SenderLoop, this);
+    return 0;
+}
+
+void MicCapturer::StopSender() {
+    if (senderRunning_.exchange(false, std::memory_order_acq_rel)) {
+        sem_post(&senderSem_);
+    }
+    if (senderThread_.joinable()) {
+        senderThread_.join();
+    }
+    if (senderSemInitialized_) {
+        sem_destroy(&senderSem_);
+        senderSemInitialized_ = false;
+    }
+}
+
+void MicCapturer::EnqueuePacket(const uint8_t* data, int length, uint64_t captureNs) {
+    if (length > kMaxPacketBytes) {
+        framesDropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    uint32_t w = writeIdx_.load(std::memory_order_relaxed);
+    uint32_t r = readIdx_.load(std::memory_order_acquire);
+    if (w - r >= MAX_QUEUE_DEPTH) {
+        // 丢弃最旧的包；CAS 失败说明发送线程刚好取走了它，同样腾出了位置
+        if (readIdx_.compare_exchange_strong(r, r + 1, std::memory_order_acq_rel)) {
+            queueOverflows_.fetch_add(1, std::memory_order_relaxed);
+            framesDropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    PacketSlot& slot = queue_[w & kQueueMask];
+    memcpy(slot.data, data, length);
+    slot.length = length;
+    slot.captureNs = captureNs;
+    writeIdx_.store(w + 1, std::memory_order_release);
+
+    depthHist_.Record(w + 1 - readIdx_.load(std::memory_order_relaxed), 1);
+    sem_post(&senderSem_);
+}
+
+void MicCapturer::SenderLoop() {
+    pthread_setname_np(pthread_self(), "MicSend");
+
+    // 语音上行与采集同级，避免被 UI 线程抢占积压
+    int qosRet = OH_QoS_SetThreadQoS(QOS_USER_INTERACTIVE);
+    if (qosRet != 0) {
+        OH_LOG_WARN(LOG_APP, "MicSend thread: failed to set QoS (ret=%{public}d)", qosRet);
+    }
+
+    uint8_t packet[kMaxPacketBytes];
+
+    while (senderRunning_.load(std::memory_order_acquire)) {
+        sem_wait(&senderSem_);
+
+        while (senderRunning_.load(std::memory_order_relaxed)) {
+            uint32_t r = readIdx_.load(std::memory_order_acquire);
+            uint32_t w = writeIdx_.load(std::memory_order_acquire);
+            if (r == w) {
+                break;
+            }
+
+            // 先拷出再用 CAS 认领：若期间回调线程丢弃了该包，CAS 失败，拷出的数据作废
+            const PacketSlot& slot = queue_[r & kQueueMask];
+            int length = slot.length;
+            uint64_t captureNs = slot.captureNs;
+            memcpy(packet, slot.data, length);
+            if (!readIdx_.compare_exchange_strong(r, r + 1, std::memory_order_acq_rel)) {
+                continue;
+            }
+
+            uint64_t t0 = MicNowNs();
+            int ret = sendMicrophoneOpusData(packet, length);
+            uint64_t t1 = MicNowNs();
+            uint64_t ns = t1 - t0;
+
+            if (ret >= 0) {
+                framesSent_.fetch_add(1, std::memory_order_relaxed);
+                windowSent_++;
+                if (t1 > captureNs) {
+                    uint64_t us = (t1 - captureNs) / 1000;
+                    mouthToWireHist_.Record(static_cast<uint32_t>(us > UINT32_MAX ? UINT32_MAX : us),
+                                            kMouthToWireBucketUs);
+                }
+            } else {
+                framesDropped_.fetch_add(1, std::memory_order_relaxed);
+                windowFailed_++;
+            }
+            sendCount_.fetch_add(1, std::memory_order_relaxed);
+            sendTotalNs_.fetch_add(ns, std::memory_order_relaxed);
+            uint64_t prevMax = sendMaxNs_.load(std::memory_order_relaxed);
+            while (ns > prevMax &&
+                   !sendMaxNs_.compare_exchange_weak(prevMax, ns, std::memory_order_relaxed)) {
+            }
+
+            if (config_.adaptive) {
+                RunRateControl(t1);
+            }
+        }
+    }
+}
+
+// =============================================================================
+// 码率 / 帧长自适应
+// =============================================================================
+
+void MicCapturer::RunRateControl(uint64_t nowNs) {
+    if (lastControlNs_ == 0) {
+        lastControlNs_ = nowNs;
+        return;
+    }
+    if (nowNs - lastControlNs_ < CONTROL_INTERVAL_MS * 1000000ULL) {
+        return;
+    }
+    lastControlNs_ = nowNs;
+
+    uint64_t overflows = queueOverflows_.load(std::memory_order_relaxed);
+    uint64_t windowOverflows = overflows - lastOverflows_;
+    lastOverflows_ = overflows;
+    uint64_t attempts = windowSent_ + windowFailed_;
+    double failRatio = attempts > 0 ? static_cast<double>(windowFailed_) / attempts : 0.0;
+    windowSent_ = 0;
+    windowFailed_ = 0;
+
+    // RTT 以会话内最小值为基线，排队引起的增量才视为拥塞
+    bool rttCongested = false;
+    uint32_t rtt = 0;
+    uint32_t variance = 0;
+    if (LiGetEstimatedRttInfo(&rtt, &variance)) {
+        rttMs_.store(static_cast<int>(rtt), std::memory_order_relaxed);
+        rttVarianceMs_.store(static_cast<int>(variance), std::memory_order_relaxed);
+        if (minRttMs_ == 0 || rtt < minRttMs_) {
+            minRttMs_ = rtt;
+        }
+        rttCongested = (rtt > minRttMs_ + 40) || (variance > 30);
+    }
+
+    bool congested = failRatio > 0.02 || windowOverflows > 0 || rttCongested;
+
+    int bitrate = targetBitrate_.load(std::memory_order_relaxed);
+    int frameMs = targetFrameMs_.load(std::memory_order_relaxed);
+    int minBitrate = config_.opusBitrate < MIN_ADAPTIVE_BITRATE ? config_.opusBitrate : MIN_ADAPTIVE_BITRATE;
+
+    if (congested) {
+        // 拥塞：码率降 1/4，帧长加倍（5ms 帧每秒 200 包，包头与加密开销可观）
+        cleanWindows_ = 0;
+        int newBitrate = bitrate * 3 / 4;
+        bitrate = newBitrate < minBitrate ? minBitrate : newBitrate;
+        if (frameMs < 20) {
+            frameMs *= 2;
+        }
+    } else if (++cleanWindows_ >= 3) {
+        // 连续 3 个稳定周期后向配置值回升一步
+        cleanWindows_ = 0;
+        if (frameMs > config_.frameSizeMs) {
+            frameMs /= 2;
+        } else if (bitrate < config_.opusBitrate) {
+            int newBitrate = bitrate + config_.opusBitrate / 8;
+            bitrate = newBitrate > config_.opusBitrate ? config_.opusBitrate : newBitrate;
+        }
+    }
+
+    if (bitrate != targetBitrate_.load(std::memory_order_relaxed) ||
+        frameMs != targetFrameMs_.load(std::memory_order_relaxed)) {
+        OH_LOG_INFO(LOG_APP, "Mic rate control: bitrate=%{public}d frameMs=%{public}d "
+                    "(fail=%{public}.3f overflow=%{public}llu rtt=%{public}u/%{public}u base=%{public}u)",
+                    bitrate, frameMs, failRatio, (unsigned long long)windowOverflows, rtt, variance, minRttMs_);
+        targetBitrate_.store(bitrate, std::memory_order_relaxed);
+        targetFrameMs_.store(frameMs, std::memory_order_relaxed);
+    }
+}
+
+void MicCapturer::ApplyRateTargets() {
+    int bitrate = targetBitrate_.load(std::memory_order_relaxed);
+    if (bitrate != encoder_.GetBitrate() && encoder_.SetBitrate(bitrate) == 0) {
+        currentBitrate_.store(bitrate, std::memory_order_relaxed);
+        bitrateChanges_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    int frameMs = targetFrameMs_.load(std::memory_order_relaxed);
+    if (frameMs != encoder_.GetFrameSizeMs() && encoder_.SetFrameSizeMs(frameMs) == 0) {
+        frameSizeBytes_ = encoder_.GetFrameSamples() * config_.channels * 2;
+        currentFrameMs_.store(frameMs, std::memory_order_relaxed);
+        frameSizeChanges_.fetch_add(1, std::memory_order_relaxed);
+    }
 }
 
 // =============================================================================
@@ -298,7 +601,10 @@ OH_AudioData_Callback_Result MicCapturer::OnReadData(
         return AUDIO_DATA_CALLBACK_RESULT_VALID;
     }
 
-    self->ProcessPcmFrame(static_cast<const uint8_t*>(buffer), length);
+    uint64_t t0 = MicNowNs();
+    self->ProcessPcmFrame(static_cast<const uint8_t*>(buffer), length, t0);
+    uint64_t us = (MicNowNs() - t0) / 1000;
+    self->callbackHist_.Record(static_cast<uint32_t>(us > UINT32_MAX ? UINT32_MAX : us), kCallbackBucketUs);
     return AUDIO_DATA_CALLBACK_RESULT_VALID;
 }
 
@@ -327,15 +633,37 @@ void MicCapturer::OnInterruptEvent(
 }
 
 // =============================================================================
-// PCM 帧处理（在音频回调线程中执行）
+// PCM 帧处理（在音频回调线程中执行，只编码不发送）
 // =============================================================================
 
-void MicCapturer::ProcessPcmFrame(const uint8_t* data, int32_t length) {
+void MicCapturer::ProcessPcmFrame(const uint8_t* data, int32_t length, uint64_t callbackNs) {
     framesCaptured_.fetch_add(1, std::memory_order_relaxed);
 
+    // 偏移 offset 处采样的估算采集时刻：回调到达时刻减去其后剩余数据的时长
+    auto sampleTimeNs = [&](int offset) -> uint64_t {
+        uint64_t behindNs = static_cast<uint64_t>(length - offset) * 1000000ULL / bytesPerMs_;
+        return callbackNs > behindNs ? callbackNs - behindNs : callbackNs;
+    };
+
     int offset = 0;
     while (offset < length) {
-        // 填充帧累积缓冲区
+        if (frameBufferPos_ == 0) {
+            // 帧边界：应用自适应目标，然后尽量直接从回调缓冲编码整帧
+            if (config_.adaptive) {
+                ApplyRateTargets();
+            }
+            while (length - offset >= frameSizeBytes_) {
+                EncodeFrame(data + offset, sampleTimeNs(offset));
+                zeroCopyFrames_.fetch_add(1, std::memory_order_relaxed);
+                offset += frameSizeBytes_;
+            }
+            if (offset >= length) {
+                break;
+            }
+            frameStartNs_ = sampleTimeNs(offset);
+        }
+
+        // 残帧：填充帧累积缓冲区
         int needed = frameSizeBytes_ - frameBufferPos_;
         int available = length - offset;
         int toCopy = (available < needed) ? available : needed;
@@ -344,27 +672,23 @@ void MicCapturer::ProcessPcmFrame(const uint8_t* data, int32_t length) {
         frameBufferPos_ += toCopy;
         offset += toCopy;
 
-        // 帧累积满了，编码 + 发送
+        // 帧累积满了，编码 + 入队
         if (frameBufferPos_ >= frameSizeBytes_) {
-            int opusLen = encoder_.Encode(
-                frameBuffer_, frameSizeBytes_,
-                opusOutput_, kOpusMaxOutputBytes);
-
-            if (opusLen > 0) {
-                framesEncoded_.fetch_add(1, std::memory_order_relaxed);
-
-                int ret = sendMicrophoneOpusData(opusOutput_, opusLen);
-                if (ret >= 0) {
-                    framesSent_.fetch_add(1, std::memory_order_relaxed);
-                } else {
-                    framesDropped_.fetch_add(1, std::memory_order_relaxed);
-                }
-            } else if (opusLen < 0) {
-                framesDropped_.fetch_add(1, std::memory_order_relaxed);
-            }
-            // opusLen == 0: 编码器暂无输出（异步模式下正常）
-
+            EncodeFrame(frameBuffer_, frameStartNs_);
+            copiedFrames_.fetch_add(1, std::memory_order_relaxed);
             frameBufferPos_ = 0;
         }
     }
 }
+
+void MicCapturer::EncodeFrame(const uint8_t* pcm, uint64_t captureNs) {
+    int opusLen = encoder_.Encode(pcm, frameSizeBytes_, opusOutput_, kOpusMaxOutputBytes);
+
+    if (opusLen > 0) {
+        framesEncoded_.fetch_add(1, std::memory_order_relaxed);
+        EnqueuePacket(opusOutput_, opusLen, captureNs);
+    } else if (opusLen < 0) {
+        framesDropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+    // opusLen == 0: 编码器暂无输出（异步模式下正常）
+}
@@ -13,10 +13,24 @@
  * @brief HarmonyOS OHAudio 低时延麦克风采集器
  *
  * 使用 OHAudio C API + AUDIOSTREAM_LATENCY_MODE_FAST 实现低时延麦克风采集。
- * 在 native 回调线程中直接完成 Opus 编码 + 网络发送，消除 ArkTS 跨线程开销。
+ * 在 native 回调线程中完成 Opus 编码，消除 ArkTS 跨线程开销；加密与网络发送
+ * 交给独立发送线程，网络抖动不会阻塞采集回调（否则 OHAudio 采集端溢出丢音）。
  *
  * 数据流：
- *   OH_AudioCapturer (FAST) → native callback → Opus encode → sendMicrophoneOpusData()
+ *   OH_AudioCapturer (FAST) → native callback → Opus encode → 包队列
+ *   MicSend 线程 → sendMicrophoneOpusData()
+ *
+ * 包队列为固定槽位的单生产者单消费者环形队列（无锁、无堆分配），深度上限
+ * MAX_QUEUE_DEPTH，满时丢弃最旧的包：语音宁可丢旧包也不要累积延迟。
+ *
+ * 低延迟帧与自适应：
+ * - 支持 5/10/20ms Opus 帧；回调缓冲中对齐到整帧的部分直接从回调缓冲编码（零拷贝），
+ *   只有跨回调的残帧才经过 frameBuffer_ 累积
+ * - 发送线程每 CONTROL_INTERVAL_MS 根据发送失败、队列溢出和 LiGetEstimatedRttInfo
+ *   的 RTT 调整目标码率与帧长：拥塞时降码率、加大帧长（减少包头开销），
+ *   连续稳定后逐步回到配置值；回调线程在帧边界应用
+ * - mouth-to-wire：帧首采样到达回调的估算时刻 → sendMicrophoneOpusData 返回，
+ *   不含回调之前的硬件采集缓冲
  */
 
 #ifndef MIC_CAPTURER_H
@@ -24,10 +38,13 @@
 
 #include <cstdint>
 #include <atomic>
+#include <thread>
+#include <semaphore.h>
 #include <ohaudio/native_audiostream_base.h>
 #include <ohaudio/native_audiostreambuilder.h>
 #include <ohaudio/native_audiocapturer.h>
 #include "opus_encoder.h"
+#include "latency_histogram.h"
 
 /**
  * 麦克风采集器配置
@@ -35,8 +52,9 @@
 struct MicCapturerConfig {
     int sampleRate = 48000;      // 采样率
     int channels = 1;            // 声道数（单声道）
-    int opusBitrate = 64000;     // Opus 编码比特率 (bps)
-    int frameSizeMs = 20;        // 帧大小 (ms)
+    int opusBitrate = 64000;     // Opus 编码比特率 (bps)，自适应时为上限
+    int frameSizeMs = 20;        // 帧大小 (5/10/20 ms)，自适应时为下限
+    bool adaptive = false;       // 按发送结果与 RTT 自适应码率/帧长
 };
 
 /**
@@ -46,8 +64,35 @@ struct MicCapturerStats {
     uint64_t framesCapture;     // 采集帧数
     uint64_t framesEncoded;     // 编码帧数
     uint64_t framesSent;        // 发送帧数
-    uint64_t framesDropped;     // 丢弃帧数
+    uint64_t framesDropped;     // 丢弃帧数（编码失败 + 发送失败 + 队列溢出）
+    uint64_t queueOverflows;    // 其中队列满时丢弃的最旧包数
     bool isFastMode;            // 是否工作在低时延模式
+    // 采集回调执行耗时分布（微秒）
+    double callbackP50Us;
+    double callbackP95Us;
+    double callbackP99Us;
+    double callbackMaxUs;
+    // 入队后的队列深度分布（包数）
+    int queueDepthP50;
+    int queueDepthP95;
+    int queueDepthP99;
+    int queueDepthMax;
+    // 单包发送耗时（加密 + socket，微秒）
+    double avgSendUs;
+    double maxSendUs;
+    // 帧长 / 码率（当前值，自适应时会变化）
+    int frameSizeMs;
+    int bitrate;
+    uint64_t zeroCopyFrames;    // 直接从回调缓冲编码的帧数
+    uint64_t copiedFrames;      // 经累积缓冲编码的帧数
+    uint64_t bitrateChanges;    // 自适应调整码率次数
+    uint64_t frameSizeChanges;  // 自适应调整帧长次数
+    int rttMs;                  // 最近一次 RTT 采样（-1 表示无）
+    int rttVarianceMs;
+    // mouth-to-wire 延迟（毫秒）
+    double mouthToWireP50Ms;
+    double mouthToWireP95Ms;
+    double mouthToWireMaxMs;
 };
 
 /**
@@ -57,7 +102,7 @@ struct MicCapturerStats {
  *   MicCapturer capturer;
  *   capturer.Init(config);
  *   capturer.Start();
- *   // ... 流式传输期间自动在 native 回调中编码发送 ...
+ *   // ... 流式传输期间自动在 native 回调中编码，MicSend 线程发送 ...
  *   capturer.Stop();
  *   capturer.Cleanup();
  */
@@ -117,7 +162,24 @@ private:
         OH_AudioInterrupt_ForceType type, OH_AudioInterrupt_Hint hint);
 
     // 处理一帧 PCM 数据 (在回调线程中调用)
-    void ProcessPcmFrame(const uint8_t* data, int32_t length);
+    void ProcessPcmFrame(const uint8_t* data, int32_t length, uint64_t callbackNs);
+
+    // 编码一整帧并入队（回调线程）
+    void EncodeFrame(const uint8_t* pcm, uint64_t captureNs);
+
+    // 在帧边界应用发送线程给出的目标码率/帧长（回调线程）
+    void ApplyRateTargets();
+
+    // 编码结果入队（回调线程），满时丢弃最旧的包
+    void EnqueuePacket(const uint8_t* data, int length, uint64_t captureNs);
+
+    // 码率/帧长控制（发送线程，按 CONTROL_INTERVAL_MS 限频）
+    void RunRateControl(uint64_t nowNs);
+
+    // 发送线程
+    int StartSender();
+    void StopSender();
+    void SenderLoop();
 
     // OHAudio 对象
     OH_AudioCapturer*      capturer_ = nullptr;
@@ -131,11 +193,53 @@ private:
     uint8_t frameBuffer_[kMaxFrameBytes] = {};
     int frameBufferPos_ = 0;
     int frameSizeBytes_ = 0; // 目标帧字节数
+    uint64_t frameStartNs_ = 0; // 累积中残帧首采样的估算采集时刻
+    int bytesPerMs_ = 0;
 
     // Opus 编码输出缓冲
     static constexpr int kOpusMaxOutputBytes = 4096;
     uint8_t opusOutput_[kOpusMaxOutputBytes] = {};
 
+    // 包队列：槽位数（2 的幂）大于深度上限，丢弃最旧包后生产端写入的槽位
+    // 不会是消费端正在拷贝的那个（除非消费端停在一次 memcpy 中超过 8 个包周期）
+    static constexpr uint32_t kQueueSlots = 16;
+    static constexpr uint32_t kQueueMask = kQueueSlots - 1;
+    static constexpr uint32_t MAX_QUEUE_DEPTH = 8;  // 20ms 帧 160ms，5ms 帧 40ms
+    static constexpr int kMaxPacketBytes = 1400;    // 64kbps/20ms 约 160 字节，留足余量
+
+    struct PacketSlot {
+        int length;
+        uint64_t captureNs;
+        uint8_t data[kMaxPacketBytes];
+    };
+    PacketSlot queue_[kQueueSlots] = {};
+
+    // 写索引只由回调线程修改；读索引由发送线程推进，队列满时回调线程用 CAS 推进（丢最旧）
+    alignas(64) std::atomic<uint32_t> writeIdx_{0};
+    alignas(64) std::atomic<uint32_t> readIdx_{0};
+
+    // 发送线程
+    std::thread senderThread_;
+    std::atomic<bool> senderRunning_{false};
+    sem_t senderSem_;
+    bool senderSemInitialized_ = false;
+
+    // 自适应目标（发送线程写，回调线程在帧边界读取并应用）
+    std::atomic<int> targetBitrate_{64000};
+    std::atomic<int> targetFrameMs_{20};
+    std::atomic<int> currentBitrate_{64000};
+    std::atomic<int> currentFrameMs_{20};
+
+    // 控制器状态（仅发送线程）
+    static constexpr uint64_t CONTROL_INTERVAL_MS = 1000;
+    static constexpr int MIN_ADAPTIVE_BITRATE = 16000;
+    uint64_t lastControlNs_ = 0;
+    uint64_t windowSent_ = 0;
+    uint64_t windowFailed_ = 0;
+    uint64_t lastOverflows_ = 0;
+    uint32_t minRttMs_ = 0;
+    int cleanWindows_ = 0;
+
     // 配置
     MicCapturerConfig config_;
 
@@ -148,6 +252,25 @@ private:
     std::atomic<uint64_t> framesEncoded_{0};
     std::atomic<uint64_t> framesSent_{0};
     std::atomic<uint64_t> framesDropped_{0};
+    std::atomic<uint64_t> queueOverflows_{0};
+    std::atomic<uint64_t> sendCount_{0};
+    std::atomic<uint64_t> sendTotalNs_{0};
+    std::atomic<uint64_t> sendMaxNs_{0};
+    std::atomic<uint64_t> zeroCopyFrames_{0};
+    std::atomic<uint64_t> copiedFrames_{0};
+    std::atomic<uint64_t> bitrateChanges_{0};
+    std::atomic<uint64_t> frameSizeChanges_{0};
+    std::atomic<int> rttMs_{-1};
+    std::atomic<int> rttVarianceMs_{0};
+
+    // 回调耗时：20µs 一桶，覆盖 0~10ms，更长的落在最后一桶
+    static constexpr uint32_t kCallbackBucketUs = 20;
+    LatencyHistogram<500> callbackHist_;
+    // 队列深度：每个深度一桶
+    LatencyHistogram<kQueueSlots + 1> depthHist_;
+    // mouth-to-wire：250µs 一桶，覆盖 0~100ms
+    static constexpr uint32_t kMouthToWireBucketUs = 250;
+    LatencyHistogram<400> mouthToWireHist_;
 };
 
 #endif // MIC_CAPTURER_H
@@ -29,16 +29,23 @@ bool isMicrophoneEncryptionEnabled(void);
 #include "callbacks.h"
 #include "video_decoder.h"
 #include "audio_renderer.h"
+#include "av_sync_controller.h"
+#include "thermal_governor.h"
+#include "controller_input_router.h"
+#include "input_scheduler.h"
+#include "device_motion.h"
+#include "touch_gesture.h"
 #include "bass_energy_analyzer.h"
 #include "native_render.h"
 #include "opus_encoder.h"
 #include "mic_capturer.h"
+#include "opus_libopus.h"
 #include <hilog/log.h>
 #include <cstring>
 #include <arpa/inet.h>
 #include <native_window/external_window.h>
-#include <unordered_map>
 #include <memory>
+#include <atomic>
 #include <dlfcn.h>
 
 #define LOG_TAG "MoonlightBridge"
@@ -52,11 +59,34 @@ static STREAM_CONFIGURATION g_streamConfig;
 static SERVER_INFORMATION g_serverInfo;
 static int g_videoCapabilities = 0;
 static bool g_performanceMode = false;  // 性能模式
+static std::atomic<int> g_activeGamepadMask{0};  // ArkTS + native 输入路由已到达的手柄
 
-// Opus 编码器管理
-static std::mutex g_opusEncoderMutex;
-static std::unordered_map<int64_t, std::unique_ptr<OhosOpusEncoder>> g_opusEncoders;
-static int64_t g_opusEncoderNextHandle = 1;
+// Opus 编码器管理：固定槽位表，句柄 = (generation << 8) | (slot + 1)
+// 查找只做两次原子读，不加锁；销毁时先递增 generation 使旧句柄失效，再摘下指针。
+// 与之前的 map + mutex 方案一致，同一句柄的 Encode 与 Destroy 不得并发。
+static constexpr int kMaxOpusEncoders = 16;
+static constexpr int64_t kOpusHandleSlotMask = 0xFF;
+
+struct OpusEncoderSlot {
+    std::atomic<OhosOpusEncoder*> encoder{nullptr};
+    std::atomic<uint32_t> generation{1};
+};
+static OpusEncoderSlot g_opusEncoderSlots[kMaxOpusEncoders];
+
+static OhosOpusEncoder* ResolveOpusEncoder(int64_t handle) {
+    int64_t index = (handle & kOpusHandleSlotMask) - 1;
+    if (handle <= 0 || index < 0 || index >= kMaxOpusEncoders) {
+        return nullptr;
+    }
+    OpusEncoderSlot& slot = g_opusEncoderSlots[index];
+    if (slot.generation.load(std::memory_order_acquire) != static_cast<uint32_t>(handle >> 8)) {
+        return nullptr;
+    }
+    return slot.encoder.load(std::memory_order_acquire);
+}
+
+// 单帧 Opus 包上限（RFC 6716）
+static constexpr int kOpusMaxPacketBytes = 1275;
 
 // Native 麦克风采集器 (低时延)
 static std::unique_ptr<MicCapturer> g_micCapturer;
@@ -290,6 +320,7 @@ napi_value MoonBridge_StartConnection(napi_env env, napi_callback_info info) {
     g_streamConfig.width = width;
     g_streamConfig.height = height;
     g_streamConfig.fps = fps;
+    InputScheduler_SetStreamFps(fps);
     g_streamConfig.bitrate = bitrate;
     g_streamConfig.packetSize = packetSize;
     g_streamConfig.streamingRemotely = streamingRemotely;
@@ -370,7 +401,12 @@ napi_value MoonBridge_StartConnection(napi_env env, napi_callback_info info) {
 napi_value MoonBridge_StopConnection(napi_env env, napi_callback_info info) {
     OH_LOG_INFO(LOG_APP, "MoonBridge_StopConnection");
     
+    ControllerInputRouter_OnConnectionStopped();
+    InputScheduler_OnConnectionStopped();
+    DeviceMotion_OnConnectionStopped();
+    TouchGesture_OnConnectionStopped();
     LiStopConnection();
+    g_activeGamepadMask.store(0, std::memory_order_relaxed);
     
     // 重置 HDR 配置 - 在会话完全结束时重置
     VideoDecoderInstance::ResetHdrConfig();
@@ -424,7 +460,7 @@ napi_value MoonBridge_SendMouseMove(napi_env env, napi_callback_info info) {
     GetInt32(env, args[0], &deltaX);
     GetInt32(env, args[1], &deltaY);
     
-    LiSendMouseMoveEvent((short)deltaX, (short)deltaY);
+    InputScheduler_SendMouseMove((short)deltaX, (short)deltaY);
     
     return GetUndefined(env);
 }
@@ -440,7 +476,7 @@ napi_value MoonBridge_SendMousePosition(napi_env env, napi_callback_info info) {
     GetInt32(env, args[2], &refWidth);
     GetInt32(env, args[3], &refHeight);
     
-    LiSendMousePositionEvent((short)x, (short)y, (short)refWidth, (short)refHeight);
+    InputScheduler_SendMousePosition((short)x, (short)y, (short)refWidth, (short)refHeight);
     
     return GetUndefined(env);
 }
@@ -470,7 +506,7 @@ napi_value MoonBridge_SendMouseButton(napi_env env, napi_callback_info info) {
     GetInt32(env, args[0], &buttonEvent);
     GetInt32(env, args[1], &mouseButton);
     
-    LiSendMouseButtonEvent((char)buttonEvent, (char)mouseButton);
+    InputScheduler_SendMouseButton((char)buttonEvent, (char)mouseButton);
     
     return GetUndefined(env);
 }
@@ -483,7 +519,7 @@ napi_value MoonBridge_SendMouseHighResScroll(napi_env env, napi_callback_info in
     int32_t scrollAmount;
     GetInt32(env, args[0], &scrollAmount);
     
-    LiSendHighResScrollEvent((short)scrollAmount);
+    InputScheduler_SendHighResScroll((short)scrollAmount);
     
     return GetUndefined(env);
 }
@@ -496,7 +532,7 @@ napi_value MoonBridge_SendMouseHighResHScroll(napi_env env, napi_callback_info i
     int32_t scrollAmount;
     GetInt32(env, args[0], &scrollAmount);
     
-    LiSendHighResHScrollEvent((short)scrollAmount);
+    InputScheduler_SendHighResHScroll((short)scrollAmount);
     
     return GetUndefined(env);
 }
@@ -539,6 +575,19 @@ napi_value MoonBridge_SendUtf8Text(napi_env env, napi_callback_info info) {
 // 输入处理 - 手柄
 // =============================================================================
 
+/**
+ * 手柄状态发送：合并 activeGamepadMask、叠加体感助手后交给 InputScheduler
+ * （sendMultiControllerInput 与批量提交共用）
+ */
+static void SendControllerState(short controllerNumber, short activeGamepadMask, int buttonFlags,
+                                unsigned char leftTrigger, unsigned char rightTrigger,
+                                short leftStickX, short leftStickY, short rightStickX, short rightStickY) {
+    short mergedMask = MoonBridge_MergeGamepadMask(activeGamepadMask);
+    DeviceMotion_SendControllerState(controllerNumber, mergedMask, buttonFlags,
+                                     leftTrigger, rightTrigger,
+                                     leftStickX, leftStickY, &rightStickX, &rightStickY);
+}
+
 napi_value MoonBridge_SendMultiControllerInput(napi_env env, napi_callback_info info) {
     size_t argc = 9;
     napi_value args[9];
@@ -558,7 +607,7 @@ napi_value MoonBridge_SendMultiControllerInput(napi_env env, napi_callback_info
     GetInt32(env, args[7], &rightStickX);
     GetInt32(env, args[8], &rightStickY);
     
-    LiSendMultiControllerEvent(
+    SendControllerState(
         (short)controllerNumber,
         (short)activeGamepadMask,
         buttonFlags,
@@ -589,7 +638,7 @@ napi_value MoonBridge_SendControllerArrivalEvent(napi_env env, napi_callback_inf
     
     int ret = LiSendControllerArrivalEvent(
         (char)controllerNumber,
-        (short)activeGamepadMask,
+        MoonBridge_MergeGamepadMask((short)activeGamepadMask),
         (char)type,
         supportedButtonFlags,
         (short)capabilities
@@ -600,6 +649,11 @@ napi_value MoonBridge_SendControllerArrivalEvent(napi_env env, napi_callback_inf
     return result;
 }
 
+short MoonBridge_MergeGamepadMask(short mask) {
+    int merged = g_activeGamepadMask.fetch_or(mask & 0xFFFF, std::memory_order_relaxed) | (mask & 0xFFFF);
+    return (short)merged;
+}
+
 napi_value MoonBridge_SendControllerTouchEvent(napi_env env, napi_callback_info info) {
     size_t argc = 6;
     napi_value args[6];
@@ -752,6 +806,177 @@ napi_value MoonBridge_SendPenEvent(napi_env env, napi_callback_info info) {
     return result;
 }
 
+// =============================================================================
+// 输入处理 - 批量
+// =============================================================================
+
+// 各标签所需的最少负载字数（0 = 未知标签）
+static const uint8_t kInputBatchPayloadWords[INPUT_BATCH_TAG_COUNT] = {
+    0,      // 保留
+    2,      // INPUT_BATCH_MOUSE_MOVE
+    4,      // INPUT_BATCH_MOUSE_POSITION
+    4,      // INPUT_BATCH_MOUSE_MOVE_AS_POSITION
+    2,      // INPUT_BATCH_MOUSE_BUTTON
+    1,      // INPUT_BATCH_SCROLL
+    1,      // INPUT_BATCH_HSCROLL
+    4,      // INPUT_BATCH_KEYBOARD
+    9,      // INPUT_BATCH_CONTROLLER
+    6,      // INPUT_BATCH_CONTROLLER_TOUCH
+    5,      // INPUT_BATCH_CONTROLLER_MOTION
+    3,      // INPUT_BATCH_CONTROLLER_BATTERY
+    8,      // INPUT_BATCH_TOUCH
+    10,     // INPUT_BATCH_PEN
+};
+
+static std::atomic<int> g_inputBatchErrorLogs{0};
+
+static inline float BatchFloat(int32_t word) {
+    float value;
+    memcpy(&value, &word, sizeof(value));
+    return value;
+}
+
+static void LogInputBatchError(const char* reason, size_t offset, uint32_t header) {
+    // 只记录前几次，避免异常调用方刷屏
+    if (g_inputBatchErrorLogs.fetch_add(1, std::memory_order_relaxed) < 8) {
+        OH_LOG_WARN(LOG_APP, "submitInputBatch: %{public}s (offset=%{public}zu, header=0x%{public}08x)",
+                    reason, offset, header);
+    }
+}
+
+/**
+ * 解码并分发一批输入记录
+ * @return 已分发的记录数（未知标签跳过，不计入）
+ */
+static int DispatchInputBatch(const int32_t* words, size_t count) {
+    int dispatched = 0;
+    size_t pos = 0;
+    
+    while (pos < count) {
+        uint32_t header = (uint32_t)words[pos];
+        uint32_t tag = header >> 16;
+        size_t len = header & 0xFFFF;
+        const int32_t* p = words + pos + 1;
+        
+        if (len > count - pos - 1) {
+            LogInputBatchError("记录超出缓冲区", pos, header);
+            break;
+        }
+        if (tag >= INPUT_BATCH_TAG_COUNT || kInputBatchPayloadWords[tag] == 0) {
+            LogInputBatchError("未知标签，已跳过", pos, header);
+            pos += 1 + len;
+            continue;
+        }
+        if (len < kInputBatchPayloadWords[tag]) {
+            LogInputBatchError("负载字数不足", pos, header);
+            break;
+        }
+        
+        switch (tag) {
+            case INPUT_BATCH_MOUSE_MOVE:
+                InputScheduler_SendMouseMove((short)p[0], (short)p[1]);
+                break;
+            case INPUT_BATCH_MOUSE_POSITION:
+                InputScheduler_SendMousePosition((short)p[0], (short)p[1], (short)p[2], (short)p[3]);
+                break;
+            case INPUT_BATCH_MOUSE_MOVE_AS_POSITION:
+                LiSendMouseMoveAsMousePositionEvent((short)p[0], (short)p[1], (short)p[2], (short)p[3]);
+                break;
+            case INPUT_BATCH_MOUSE_BUTTON:
+                InputScheduler_SendMouseButton((char)p[0], (char)p[1]);
+                break;
+            case INPUT_BATCH_SCROLL:
+                InputScheduler_SendHighResScroll((short)p[0]);
+                break;
+            case INPUT_BATCH_HSCROLL:
+                InputScheduler_SendHighResHScroll((short)p[0]);
+                break;
+            case INPUT_BATCH_KEYBOARD:
+                LiSendKeyboardEvent2((short)p[0], (char)p[1], (char)p[2], (char)p[3]);
+                break;
+            case INPUT_BATCH_CONTROLLER:
+                SendControllerState((short)p[0], (short)p[1], p[2],
+                                    (unsigned char)p[3], (unsigned char)p[4],
+                                    (short)p[5], (short)p[6], (short)p[7], (short)p[8]);
+                break;
+            case INPUT_BATCH_CONTROLLER_TOUCH:
+                LiSendControllerTouchEvent((char)p[0], (char)p[1], p[2],
+                                           BatchFloat(p[3]), BatchFloat(p[4]), BatchFloat(p[5]));
+                break;
+            case INPUT_BATCH_CONTROLLER_MOTION:
+                LiSendControllerMotionEvent((char)p[0], (char)p[1],
+                                            BatchFloat(p[2]), BatchFloat(p[3]), BatchFloat(p[4]));
+                break;
+            case INPUT_BATCH_CONTROLLER_BATTERY:
+                LiSendControllerBatteryEvent((char)p[0], (char)p[1], (char)p[2]);
+                break;
+            case INPUT_BATCH_TOUCH:
+                LiSendTouchEvent((char)p[0], p[1], BatchFloat(p[2]), BatchFloat(p[3]),
+                                 BatchFloat(p[4]), BatchFloat(p[5]), BatchFloat(p[6]), (short)p[7]);
+                break;
+            case INPUT_BATCH_PEN:
+                LiSendPenEvent((char)p[0], (char)p[1], (char)p[2], BatchFloat(p[3]), BatchFloat(p[4]),
+                               BatchFloat(p[5]), BatchFloat(p[6]), BatchFloat(p[7]),
+                               (short)p[8], (char)p[9]);
+                break;
+        }
+        
+        dispatched++;
+        pos += 1 + len;
+    }
+    
+    return dispatched;
+}
+
+napi_value MoonBridge_SubmitInputBatch(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    const int32_t* words = nullptr;
+    size_t count = 0;
+    bool valid = false;
+    
+    if (argc >= 1) {
+        bool isTypedArray = false;
+        bool isArrayBuffer = false;
+        napi_is_typedarray(env, args[0], &isTypedArray);
+        if (isTypedArray) {
+            napi_typedarray_type type;
+            size_t length = 0;
+            void* data = nullptr;
+            if (napi_get_typedarray_info(env, args[0], &type, &length, &data, nullptr, nullptr) == napi_ok &&
+                (type == napi_int32_array || type == napi_uint32_array)) {
+                words = static_cast<const int32_t*>(data);
+                count = length;
+                valid = true;
+            }
+        } else if (napi_is_arraybuffer(env, args[0], &isArrayBuffer) == napi_ok && isArrayBuffer) {
+            void* data = nullptr;
+            size_t byteLength = 0;
+            if (napi_get_arraybuffer_info(env, args[0], &data, &byteLength) == napi_ok) {
+                words = static_cast<const int32_t*>(data);
+                count = byteLength / sizeof(int32_t);
+                valid = true;
+            }
+        }
+    }
+    
+    napi_value result;
+    if (!valid) {
+        napi_create_int32(env, -1, &result);
+        return result;
+    }
+    
+    int32_t wordCount;
+    if (argc >= 2 && GetInt32(env, args[1], &wordCount) && wordCount >= 0 && (size_t)wordCount < count) {
+        count = (size_t)wordCount;
+    }
+    
+    napi_create_int32(env, count > 0 ? DispatchInputBatch(words, count) : 0, &result);
+    return result;
+}
+
 // =============================================================================
 // 麦克风支持
 // =============================================================================
@@ -836,9 +1061,22 @@ napi_value MoonBridge_OpusEncoderCreate(napi_env env, napi_callback_info info) {
         return result;
     }
     
-    std::lock_guard<std::mutex> lock(g_opusEncoderMutex);
-    int64_t handle = g_opusEncoderNextHandle++;
-    g_opusEncoders[handle] = std::move(encoder);
+    int64_t handle = 0;
+    for (int i = 0; i < kMaxOpusEncoders; i++) {
+        OhosOpusEncoder* expected = nullptr;
+        if (g_opusEncoderSlots[i].encoder.compare_exchange_strong(expected, encoder.get(),
+                                                                  std::memory_order_acq_rel)) {
+            uint32_t gen = g_opusEncoderSlots[i].generation.load(std::memory_order_acquire);
+            handle = (static_cast<int64_t>(gen) << 8) | (i + 1);
+            encoder.release();
+            break;
+        }
+    }
+    if (handle == 0) {
+        OH_LOG_ERROR(LOG_APP, "Too many Opus encoders (max %{public}d)", kMaxOpusEncoders);
+        napi_create_int64(env, 0, &result);
+        return result;
+    }
     
     OH_LOG_INFO(LOG_APP, "Opus encoder created with handle: %{public}lld", (long long)handle);
     napi_create_int64(env, handle, &result);
@@ -867,15 +1105,10 @@ napi_value MoonBridge_OpusEncoderEncode(napi_env env, napi_callback_info info) {
         return GetUndefined(env);
     }
     
-    OhosOpusEncoder* encoder = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(g_opusEncoderMutex);
-        auto it = g_opusEncoders.find(handle);
-        if (it == g_opusEncoders.end()) {
-            OH_LOG_WARN(LOG_APP, "Invalid opus encoder handle: %{public}lld", (long long)handle);
-            return GetUndefined(env);
-        }
-        encoder = it->second.get();
+    OhosOpusEncoder* encoder = ResolveOpusEncoder(handle);
+    if (encoder == nullptr) {
+        OH_LOG_WARN(LOG_APP, "Invalid opus encoder handle: %{public}lld", (long long)handle);
+        return GetUndefined(env);
     }
     
     // 输出缓冲区 (Opus 帧最大约 4000 字节)
@@ -902,6 +1135,78 @@ napi_value MoonBridge_OpusEncoderEncode(napi_env env, napi_callback_info info) {
     return result;
 }
 
+/**
+ * 批量编码：一次调用编码 PCM 中的全部整帧，输出写入调用方持有的缓冲区（不分配 ArrayBuffer）
+ * @param handle 编码器句柄
+ * @param pcmData PCM 数据 (ArrayBuffer)，长度为帧字节数的整数倍，尾部不足一帧的部分忽略
+ * @param output 调用方持有的输出缓冲 (ArrayBuffer)，按 帧数 × 1275 字节分配可保证不截断
+ * @param layout Int32Array，写入 [offset0, length0, offset1, length1, ...]，长度 ≥ 2 × 帧数
+ * @return 已编码帧数（输出或 layout 空间不足时提前停止），-1 参数/句柄无效，-2 编码失败
+ */
+napi_value MoonBridge_OpusEncoderEncodeBatch(napi_env env, napi_callback_info info) {
+    size_t argc = 4;
+    napi_value args[4];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    napi_value result;
+    if (argc < 4) {
+        napi_create_int32(env, -1, &result);
+        return result;
+    }
+
+    int64_t handle = 0;
+    napi_get_value_int64(env, args[0], &handle);
+    OhosOpusEncoder* encoder = ResolveOpusEncoder(handle);
+
+    void* pcmData = nullptr;
+    size_t pcmLength = 0;
+    void* outData = nullptr;
+    size_t outLength = 0;
+    napi_typedarray_type layoutType = napi_int8_array;
+    size_t layoutCount = 0;
+    void* layoutData = nullptr;
+    if (encoder == nullptr ||
+        napi_get_arraybuffer_info(env, args[1], &pcmData, &pcmLength) != napi_ok ||
+        napi_get_arraybuffer_info(env, args[2], &outData, &outLength) != napi_ok ||
+        napi_get_typedarray_info(env, args[3], &layoutType, &layoutCount, &layoutData, nullptr, nullptr) != napi_ok ||
+        layoutType != napi_int32_array || pcmData == nullptr || outData == nullptr) {
+        napi_create_int32(env, -1, &result);
+        return result;
+    }
+
+    const int frameBytes = encoder->GetFrameBytes();
+    const uint8_t* pcm = static_cast<const uint8_t*>(pcmData);
+    uint8_t* out = static_cast<uint8_t*>(outData);
+    int32_t* layout = static_cast<int32_t*>(layoutData);
+    size_t frames = frameBytes > 0 ? pcmLength / frameBytes : 0;
+    if (frames > layoutCount / 2) {
+        frames = layoutCount / 2;
+    }
+
+    int32_t encoded = 0;
+    size_t outPos = 0;
+    for (size_t i = 0; i < frames; i++) {
+        // 剩余空间不足一个最大包时停止，避免 libopus 为适配缓冲而压低该帧码率
+        if (outLength - outPos < static_cast<size_t>(kOpusMaxPacketBytes)) {
+            break;
+        }
+        int len = encoder->Encode(pcm + i * frameBytes, frameBytes, out + outPos, kOpusMaxPacketBytes);
+        if (len < 0) {
+            if (encoded == 0) {
+                encoded = -2;
+            }
+            break;
+        }
+        layout[i * 2] = static_cast<int32_t>(outPos);
+        layout[i * 2 + 1] = len;
+        outPos += len;
+        encoded++;
+    }
+
+    napi_create_int32(env, encoded, &result);
+    return result;
+}
+
 /**
  * 销毁 Opus 编码器实例
  * @param handle 编码器句柄
@@ -920,11 +1225,19 @@ napi_value MoonBridge_OpusEncoderDestroy(napi_env env, napi_callback_info info)
     
     OH_LOG_INFO(LOG_APP, "OpusEncoderDestroy: handle=%{public}lld", (long long)handle);
     
-    std::lock_guard<std::mutex> lock(g_opusEncoderMutex);
-    auto it = g_opusEncoders.find(handle);
-    if (it != g_opusEncoders.end()) {
-        it->second->Cleanup();
-        g_opusEncoders.erase(it);
+    int64_t index = (handle & kOpusHandleSlotMask) - 1;
+    if (index < 0 || index >= kMaxOpusEncoders) {
+        return GetUndefined(env);
+    }
+    OpusEncoderSlot& slot = g_opusEncoderSlots[index];
+    uint32_t gen = static_cast<uint32_t>(handle >> 8);
+    // generation 从 gen 推进到 gen + 1 成功者负责释放，重复销毁同一句柄时无操作
+    if (slot.generation.compare_exchange_strong(gen, gen + 1, std::memory_order_acq_rel)) {
+        OhosOpusEncoder* encoder = slot.encoder.exchange(nullptr, std::memory_order_acq_rel);
+        if (encoder != nullptr) {
+            encoder->Cleanup();
+            delete encoder;
+        }
     }
     
     return GetUndefined(env);
@@ -939,20 +1252,24 @@ napi_value MoonBridge_OpusEncoderDestroy(napi_env env, napi_callback_info info)
  * @param sampleRate 采样率 (默认 48000)
  * @param channels 声道数 (默认 1)
  * @param bitrate Opus 比特率 bps (默认 64000)
+ * @param frameSizeMs Opus 帧长 5/10/20 ms (默认 20)
+ * @param adaptive 是否按发送结果与 RTT 自适应码率/帧长 (默认 false)
  * @return 0 成功，负数失败
  */
 napi_value MoonBridge_NativeMicStart(napi_env env, napi_callback_info info) {
-    size_t argc = 3;
-    napi_value args[3];
+    size_t argc = 5;
+    napi_value args[5];
     napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
 
     MicCapturerConfig cfg;
     if (argc >= 1) napi_get_value_int32(env, args[0], &cfg.sampleRate);
     if (argc >= 2) napi_get_value_int32(env, args[1], &cfg.channels);
     if (argc >= 3) napi_get_value_int32(env, args[2], &cfg.opusBitrate);
+    if (argc >= 4) napi_get_value_int32(env, args[3], &cfg.frameSizeMs);
+    if (argc >= 5) GetBool(env, args[4], &cfg.adaptive);
 
-    OH_LOG_INFO(LOG_APP, "NativeMicStart: rate=%{public}d ch=%{public}d bitrate=%{public}d",
-                cfg.sampleRate, cfg.channels, cfg.opusBitrate);
+    OH_LOG_INFO(LOG_APP, "NativeMicStart: rate=%{public}d ch=%{public}d bitrate=%{public}d frameMs=%{public}d adaptive=%{public}d",
+                cfg.sampleRate, cfg.channels, cfg.opusBitrate, cfg.frameSizeMs, cfg.adaptive ? 1 : 0);
 
     // 先清理旧的
     if (g_micCapturer) {
@@ -1016,7 +1333,10 @@ napi_value MoonBridge_NativeMicResume(napi_env env, napi_callback_info info) {
 
 /**
  * 获取 native 麦克风状态
- * @return {running: boolean, paused: boolean, captured: number, encoded: number, sent: number, dropped: number}
+ * @return {running, paused, captured, encoded, sent, dropped, queueOverflows,
+ *          callbackP50Us/P95Us/P99Us/MaxUs, queueDepthP50/P95/P99/Max, avgSendUs, maxSendUs,
+ *          frameSizeMs, bitrate, zeroCopyFrames, copiedFrames, bitrateChanges, frameSizeChanges,
+ *          rttMs, rttVarianceMs, mouthToWireP50Ms/P95Ms/MaxMs}
  */
 napi_value MoonBridge_NativeMicGetStats(napi_env env, napi_callback_info info) {
     napi_value result;
@@ -1051,6 +1371,72 @@ napi_value MoonBridge_NativeMicGetStats(napi_env env, napi_callback_info info) {
     napi_create_int64(env, (int64_t)stats.framesDropped, &val);
     napi_set_named_property(env, result, "dropped", val);
 
+    napi_create_int64(env, (int64_t)stats.queueOverflows, &val);
+    napi_set_named_property(env, result, "queueOverflows", val);
+
+    napi_create_double(env, stats.callbackP50Us, &val);
+    napi_set_named_property(env, result, "callbackP50Us", val);
+
+    napi_create_double(env, stats.callbackP95Us, &val);
+    napi_set_named_property(env, result, "callbackP95Us", val);
+
+    napi_create_double(env, stats.callbackP99Us, &val);
+    napi_set_named_property(env, result, "callbackP99Us", val);
+
+    napi_create_double(env, stats.callbackMaxUs, &val);
+    napi_set_named_property(env, result, "callbackMaxUs", val);
+
+    napi_create_int32(env, stats.queueDepthP50, &val);
+    napi_set_named_property(env, result, "queueDepthP50", val);
+
+    napi_create_int32(env, stats.queueDepthP95, &val);
+    napi_set_named_property(env, result, "queueDepthP95", val);
+
+    napi_create_int32(env, stats.queueDepthP99, &val);
+    napi_set_named_property(env, result, "queueDepthP99", val);
+
+    napi_create_int32(env, stats.queueDepthMax, &val);
+    napi_set_named_property(env, result, "queueDepthMax", val);
+
+    napi_create_double(env, stats.avgSendUs, &val);
+    napi_set_named_property(env, result, "avgSendUs", val);
+
+    napi_create_double(env, stats.maxSendUs, &val);
+    napi_set_named_property(env, result, "maxSendUs", val);
+
+    napi_create_int32(env, stats.frameSizeMs, &val);
+    napi_set_named_property(env, result, "frameSizeMs", val);
+
+    napi_create_int32(env, stats.bitrate, &val);
+    napi_set_named_property(env, result, "bitrate", val);
+
+    napi_create_int64(env, (int64_t)stats.zeroCopyFrames, &val);
+    napi_set_named_property(env, result, "zeroCopyFrames", val);
+
+    napi_create_int64(env, (int64_t)stats.copiedFrames, &val);
+    napi_set_named_property(env, result, "copiedFrames", val);
+
+    napi_create_int64(env, (int64_t)stats.bitrateChanges, &val);
+    napi_set_named_property(env, result, "bitrateChanges", val);
+
+    napi_create_int64(env, (int64_t)stats.frameSizeChanges, &val);
+    napi_set_named_property(env, result, "frameSizeChanges", val);
+
+    napi_create_int32(env, stats.rttMs, &val);
+    napi_set_named_property(env, result, "rttMs", val);
+
+    napi_create_int32(env, stats.rttVarianceMs, &val);
+    napi_set_named_property(env, result, "rttVarianceMs", val);
+
+    napi_create_double(env, stats.mouthToWireP50Ms, &val);
+    napi_set_named_property(env, result, "mouthToWireP50Ms", val);
+
+    napi_create_double(env, stats.mouthToWireP95Ms, &val);
+    napi_set_named_property(env, result, "mouthToWireP95Ms", val);
+
+    napi_create_double(env, stats.mouthToWireMaxMs, &val);
+    napi_set_named_property(env, result, "mouthToWireMaxMs", val);
+
     return result;
 }
 
@@ -1554,6 +1940,21 @@ napi_value MoonBridge_IsSpatialAudioEnabled(napi_env env, napi_callback_info inf
     return result;
 }
 
+napi_value MoonBridge_SetAudioFecLookahead(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    bool enabled = false;
+    if (argc >= 1) {
+        napi_get_value_bool(env, args[0], &enabled);
+    }
+    
+    MoonlightOpusDecoder::SetFecLookahead(enabled);
+    
+    return GetUndefined(env);
+}
+
 napi_value MoonBridge_SetAudioVolume(napi_env env, napi_callback_info info) {
     size_t argc = 1;
     napi_value args[1];
@@ -1572,6 +1973,243 @@ napi_value MoonBridge_SetAudioVolume(napi_env env, napi_callback_info info) {
     return result;
 }
 
+napi_value MoonBridge_GetAudioStats(napi_env env, napi_callback_info info) {
+    napi_value result;
+    napi_create_object(env, &result);
+    
+    AudioRendererStats rs = AudioRendererInstance::GetStats();
+    AudioRecvStats recv;
+    Callbacks_GetAudioRecvStats(&recv);
+    
+    napi_value val;
+    napi_create_int64(env, (int64_t)rs.totalSamples, &val);
+    napi_set_named_property(env, result, "totalSamples", val);
+    napi_create_int64(env, (int64_t)rs.playedSamples, &val);
+    napi_set_named_property(env, result, "playedSamples", val);
+    napi_create_int64(env, (int64_t)rs.droppedSamples, &val);
+    napi_set_named_property(env, result, "droppedSamples", val);
+    napi_create_uint32(env, rs.underruns, &val);
+    napi_set_named_property(env, result, "underruns", val);
+    napi_create_double(env, rs.latencyMs, &val);
+    napi_set_named_property(env, result, "bufferLatencyMs", val);
+    
+    // 输出延迟与路由延迟档案
+    napi_create_double(env, rs.deviceLatencyMs, &val);
+    napi_set_named_property(env, result, "deviceLatencyMs", val);
+    napi_create_double(env, rs.outputLatencyMs, &val);
+    napi_set_named_property(env, result, "outputLatencyMs", val);
+    napi_create_double(env, rs.callbackIntervalMs, &val);
+    napi_set_named_property(env, result, "callbackIntervalMs", val);
+    napi_create_double(env, rs.callbackMaxIntervalMs, &val);
+    napi_set_named_property(env, result, "callbackMaxIntervalMs", val);
+    napi_create_double(env, rs.callbackBurstMs, &val);
+    napi_set_named_property(env, result, "callbackBurstMs", val);
+    napi_create_int32(env, rs.routeCapMs, &val);
+    napi_set_named_property(env, result, "routeCapMs", val);
+    
+    // 输出设备切换
+    napi_create_int32(env, static_cast<int32_t>(rs.route), &val);
+    napi_set_named_property(env, result, "route", val);
+    napi_create_int32(env, rs.latencyCapMs, &val);
+    napi_set_named_property(env, result, "latencyCapMs", val);
+    napi_create_uint32(env, rs.deviceSwitches, &val);
+    napi_set_named_property(env, result, "deviceSwitches", val);
+    napi_create_uint32(env, rs.switchRebuilds, &val);
+    napi_set_named_property(env, result, "switchRebuilds", val);
+    napi_create_uint32(env, rs.switchFailures, &val);
+    napi_set_named_property(env, result, "switchFailures", val);
+    napi_create_double(env, rs.lastSwitchSilenceMs, &val);
+    napi_set_named_property(env, result, "lastSwitchSilenceMs", val);
+    napi_create_double(env, rs.maxSwitchSilenceMs, &val);
+    napi_set_named_property(env, result, "maxSwitchSilenceMs", val);
+    napi_create_double(env, rs.avgSwitchSilenceMs, &val);
+    napi_set_named_property(env, result, "avgSwitchSilenceMs", val);
+    
+    // AudioRecv 线程单包耗时
+    napi_create_int64(env, (int64_t)recv.packets, &val);
+    napi_set_named_property(env, result, "recvPackets", val);
+    napi_create_double(env, recv.avgPacketUs, &val);
+    napi_set_named_property(env, result, "recvAvgPacketUs", val);
+    napi_create_double(env, recv.maxPacketUs, &val);
+    napi_set_named_property(env, result, "recvMaxPacketUs", val);
+    napi_create_double(env, recv.avgDecodeUs, &val);
+    napi_set_named_property(env, result, "recvAvgDecodeUs", val);
+    
+    // AudioRecv 各阶段尾延迟
+    napi_create_double(env, recv.packetP50Us, &val);
+    napi_set_named_property(env, result, "recvPacketP50Us", val);
+    napi_create_double(env, recv.packetP99Us, &val);
+    napi_set_named_property(env, result, "recvPacketP99Us", val);
+    napi_create_double(env, recv.packetP999Us, &val);
+    napi_set_named_property(env, result, "recvPacketP999Us", val);
+    napi_create_double(env, recv.decodeP50Us, &val);
+    napi_set_named_property(env, result, "recvDecodeP50Us", val);
+    napi_create_double(env, recv.decodeP99Us, &val);
+    napi_set_named_property(env, result, "recvDecodeP99Us", val);
+    napi_create_double(env, recv.concealP50Us, &val);
+    napi_set_named_property(env, result, "recvConcealP50Us", val);
+    napi_create_double(env, recv.concealP99Us, &val);
+    napi_set_named_property(env, result, "recvConcealP99Us", val);
+    napi_create_double(env, recv.concealMaxUs, &val);
+    napi_set_named_property(env, result, "recvConcealMaxUs", val);
+    napi_create_double(env, recv.playP50Us, &val);
+    napi_set_named_property(env, result, "recvPlayP50Us", val);
+    napi_create_double(env, recv.playP99Us, &val);
+    napi_set_named_property(env, result, "recvPlayP99Us", val);
+    
+    // 分析线程
+    napi_create_int64(env, (int64_t)recv.analysisAnalyzed, &val);
+    napi_set_named_property(env, result, "analysisFrames", val);
+    napi_create_int64(env, (int64_t)recv.analysisSkipped, &val);
+    napi_set_named_property(env, result, "analysisSkipped", val);
+    napi_create_int64(env, (int64_t)recv.analysisDropped, &val);
+    napi_set_named_property(env, result, "analysisDropped", val);
+    napi_create_double(env, recv.avgAnalyzeUs, &val);
+    napi_set_named_property(env, result, "analysisAvgUs", val);
+    
+    // onset 后端
+    napi_create_string_utf8(env, recv.onsetBackend ? recv.onsetBackend : "", NAPI_AUTO_LENGTH, &val);
+    napi_set_named_property(env, result, "onsetBackend", val);
+    napi_create_int64(env, (int64_t)recv.onsetFrames, &val);
+    napi_set_named_property(env, result, "onsetFrames", val);
+    napi_create_int64(env, (int64_t)recv.onsetCount, &val);
+    napi_set_named_property(env, result, "onsetCount", val);
+    napi_create_double(env, recv.onsetAvgUs, &val);
+    napi_set_named_property(env, result, "onsetAvgUs", val);
+    napi_create_double(env, recv.onsetMaxUs, &val);
+    napi_set_named_property(env, result, "onsetMaxUs", val);
+    napi_create_uint32(env, recv.onsetStateBytes, &val);
+    napi_set_named_property(env, result, "onsetStateBytes", val);
+    
+    // 丢包恢复：FEC vs PLC
+    napi_get_boolean(env, recv.fecLookahead, &val);
+    napi_set_named_property(env, result, "fecLookahead", val);
+    napi_create_int64(env, (int64_t)recv.framesLost, &val);
+    napi_set_named_property(env, result, "framesLost", val);
+    napi_create_int64(env, (int64_t)recv.fecRecovered, &val);
+    napi_set_named_property(env, result, "fecRecovered", val);
+    napi_create_int64(env, (int64_t)recv.plcFrames, &val);
+    napi_set_named_property(env, result, "plcFrames", val);
+    napi_create_int64(env, (int64_t)recv.fecUnavailable, &val);
+    napi_set_named_property(env, result, "fecUnavailable", val);
+    napi_create_int64(env, (int64_t)recv.lookaheadHolds, &val);
+    napi_set_named_property(env, result, "lookaheadHolds", val);
+    
+    return result;
+}
+
+napi_value MoonBridge_SetAvSyncConfig(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    bool enabled = false;
+    int32_t windowMs = 20;
+    if (argc >= 1) {
+        napi_get_value_bool(env, args[0], &enabled);
+    }
+    if (argc >= 2) {
+        napi_get_value_int32(env, args[1], &windowMs);
+    }
+    
+    AvSyncController::SetConfig(enabled, windowMs);
+    
+    return GetUndefined(env);
+}
+
+napi_value MoonBridge_GetAvSyncStats(napi_env env, napi_callback_info info) {
+    napi_value result;
+    napi_create_object(env, &result);
+    
+    AvSyncStats stats = AvSyncController::GetStats();
+    
+    napi_value val;
+    napi_get_boolean(env, stats.enabled, &val);
+    napi_set_named_property(env, result, "enabled", val);
+    napi_create_int32(env, stats.windowMs, &val);
+    napi_set_named_property(env, result, "windowMs", val);
+    napi_create_double(env, stats.audioLatencyMs, &val);
+    napi_set_named_property(env, result, "audioLatencyMs", val);
+    napi_create_double(env, stats.audioDeviceLatencyMs, &val);
+    napi_set_named_property(env, result, "audioDeviceLatencyMs", val);
+    napi_create_double(env, stats.videoLatencyMs, &val);
+    napi_set_named_property(env, result, "videoLatencyMs", val);
+    napi_create_double(env, stats.skewMs, &val);
+    napi_set_named_property(env, result, "skewMs", val);
+    napi_create_double(env, stats.maxAbsSkewMs, &val);
+    napi_set_named_property(env, result, "maxAbsSkewMs", val);
+    napi_create_int32(env, stats.audioCapMs, &val);
+    napi_set_named_property(env, result, "audioCapMs", val);
+    napi_create_double(env, stats.videoDelayMs, &val);
+    napi_set_named_property(env, result, "videoDelayMs", val);
+    napi_create_int64(env, (int64_t)stats.adjustments, &val);
+    napi_set_named_property(env, result, "adjustments", val);
+    napi_create_int64(env, (int64_t)stats.outOfWindowUpdates, &val);
+    napi_set_named_property(env, result, "outOfWindowUpdates", val);
+    napi_create_int64(env, (int64_t)stats.updates, &val);
+    napi_set_named_property(env, result, "updates", val);
+    
+    return result;
+}
+
+napi_value MoonBridge_SetThermalGovernorConfig(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    bool enabled = true;
+    char sysfsRoot[256] = {0};
+    if (argc >= 1) {
+        GetBool(env, args[0], &enabled);
+    }
+    if (argc >= 2) {
+        GetString(env, args[1], sysfsRoot, sizeof(sysfsRoot));
+    }
+    
+    ThermalGovernor::SetConfig(enabled, sysfsRoot);
+    
+    return GetUndefined(env);
+}
+
+napi_value MoonBridge_GetThermalGovernorStats(napi_env env, napi_callback_info info) {
+    napi_value result;
+    napi_create_object(env, &result);
+    
+    ThermalGovernorStats stats = ThermalGovernor::GetStats();
+    
+    napi_value val;
+    napi_get_boolean(env, stats.enabled, &val);
+    napi_set_named_property(env, result, "enabled", val);
+    napi_get_boolean(env, stats.running, &val);
+    napi_set_named_property(env, result, "running", val);
+    napi_create_int32(env, stats.level, &val);
+    napi_set_named_property(env, result, "level", val);
+    napi_create_string_utf8(env, ThermalGovernor::LevelName(stats.level), NAPI_AUTO_LENGTH, &val);
+    napi_set_named_property(env, result, "levelName", val);
+    napi_create_int32(env, stats.maxLevel, &val);
+    napi_set_named_property(env, result, "maxLevel", val);
+    napi_create_int32(env, stats.lastSample.tempMilliC, &val);
+    napi_set_named_property(env, result, "tempMilliC", val);
+    napi_create_int32(env, stats.lastSample.freqCapPermille, &val);
+    napi_set_named_property(env, result, "freqCapPermille", val);
+    napi_create_int32(env, stats.lastSample.freqCurPermille, &val);
+    napi_set_named_property(env, result, "freqCurPermille", val);
+    napi_create_double(env, stats.lastSample.decodeLoad, &val);
+    napi_set_named_property(env, result, "decodeLoad", val);
+    napi_create_double(env, stats.lastSample.audioLoad, &val);
+    napi_set_named_property(env, result, "audioLoad", val);
+    napi_create_int64(env, (int64_t)stats.samples, &val);
+    napi_set_named_property(env, result, "samples", val);
+    napi_create_int64(env, (int64_t)stats.stepUps, &val);
+    napi_set_named_property(env, result, "stepUps", val);
+    napi_create_int64(env, (int64_t)stats.stepDowns, &val);
+    napi_set_named_property(env, result, "stepDowns", val);
+    napi_create_string_utf8(env, stats.lastReason, NAPI_AUTO_LENGTH, &val);
+    napi_set_named_property(env, result, "lastReason", val);
+    
+    return result;
+}
+
 // =============================================================================
 // 性能模式
 // =============================================================================
@@ -85,6 +85,14 @@ napi_value MoonBridge_SendUtf8Text(napi_env env, napi_callback_info info);
 
 napi_value MoonBridge_SendMultiControllerInput(napi_env env, napi_callback_info info);
 napi_value MoonBridge_SendControllerArrivalEvent(napi_env env, napi_callback_info info);
+
+/**
+ * 合并 activeGamepadMask（供 C++ 内部使用）
+ * ArkTS 与 native 输入路由各自只知道自己发送的手柄，发送前与对方已到达的手柄位合并，
+ * 避免主机把另一方的手柄当作已断开。连接停止时清零。
+ * @return 合并后的掩码
+ */
+short MoonBridge_MergeGamepadMask(short mask);
 napi_value MoonBridge_SendControllerTouchEvent(napi_env env, napi_callback_info info);
 napi_value MoonBridge_SendControllerMotionEvent(napi_env env, napi_callback_info info);
 napi_value MoonBridge_SendControllerBatteryEvent(napi_env env, napi_callback_info info);
@@ -96,6 +104,42 @@ napi_value MoonBridge_SendControllerBatteryEvent(napi_env env, napi_callback_inf
 napi_value MoonBridge_SendTouchEvent(napi_env env, napi_callback_info info);
 napi_value MoonBridge_SendPenEvent(napi_env env, napi_callback_info info);
 
+// =============================================================================
+// 输入处理 - 批量
+// =============================================================================
+
+/*
+ * submitInputBatch 记录格式（32 位字流）：
+ *   记录头 = (标签 << 16) | 负载字数，负载紧随其后
+ *   (f) 表示该字为 float32 的位模式（ArkTS 侧用同一 ArrayBuffer 上的 Float32Array 写入）
+ * 负载字数大于标签所需时多余字被忽略，未知标签按字数跳过，便于后续扩展。
+ */
+#define INPUT_BATCH_MOUSE_MOVE              1   // deltaX, deltaY
+#define INPUT_BATCH_MOUSE_POSITION          2   // x, y, refWidth, refHeight
+#define INPUT_BATCH_MOUSE_MOVE_AS_POSITION  3   // deltaX, deltaY, refWidth, refHeight
+#define INPUT_BATCH_MOUSE_BUTTON            4   // buttonEvent, mouseButton
+#define INPUT_BATCH_SCROLL                  5   // scrollAmount
+#define INPUT_BATCH_HSCROLL                 6   // scrollAmount
+#define INPUT_BATCH_KEYBOARD                7   // keyCode, keyAction, modifiers, flags
+#define INPUT_BATCH_CONTROLLER              8   // controllerNumber, activeGamepadMask, buttonFlags,
+                                                // leftTrigger, rightTrigger, LSX, LSY, RSX, RSY
+#define INPUT_BATCH_CONTROLLER_TOUCH        9   // controllerNumber, eventType, pointerId, x(f), y(f), pressure(f)
+#define INPUT_BATCH_CONTROLLER_MOTION       10  // controllerNumber, motionType, x(f), y(f), z(f)
+#define INPUT_BATCH_CONTROLLER_BATTERY      11  // controllerNumber, batteryState, batteryPercentage
+#define INPUT_BATCH_TOUCH                   12  // eventType, pointerId, x(f), y(f), pressureOrDistance(f),
+                                                // contactAreaMajor(f), contactAreaMinor(f), rotation
+#define INPUT_BATCH_PEN                     13  // eventType, toolType, penButtons, x(f), y(f), pressureOrDistance(f),
+                                                // contactAreaMajor(f), contactAreaMinor(f), rotation, tilt
+#define INPUT_BATCH_TAG_COUNT               14
+
+/**
+ * 一次提交一帧内产生的全部输入：submitInputBatch(data: Int32Array | ArrayBuffer, wordCount?: number)
+ * 按记录顺序解码并分发到与 send* 相同的发送路径（鼠标 / 手柄经 InputScheduler）。
+ * wordCount 省略时使用整个缓冲区。
+ * @return 已分发的记录数；参数无效返回 -1。遇到截断的记录时停止，之后的记录不发送
+ */
+napi_value MoonBridge_SubmitInputBatch(napi_env env, napi_callback_info info);
+
 // =============================================================================
 // 麦克风支持
 // =============================================================================
@@ -111,6 +155,7 @@ napi_value MoonBridge_IsMicrophoneEncryptionEnabled(napi_env env, napi_callback_
 
 napi_value MoonBridge_OpusEncoderCreate(napi_env env, napi_callback_info info);
 napi_value MoonBridge_OpusEncoderEncode(napi_env env, napi_callback_info info);
+napi_value MoonBridge_OpusEncoderEncodeBatch(napi_env env, napi_callback_info info);
 napi_value MoonBridge_OpusEncoderDestroy(napi_env env, napi_callback_info info);
 
 // =============================================================================
@@ -240,12 +285,50 @@ napi_value MoonBridge_SetSpatialAudioEnabled(napi_env env, napi_callback_info in
  */
 napi_value MoonBridge_IsSpatialAudioEnabled(napi_env env, napi_callback_info info);
 
+/**
+ * 设置是否启用 Opus 带内 FEC 前瞻（丢包时推迟一帧，用下一包的 FEC 重建）
+ * @param enabled boolean
+ */
+napi_value MoonBridge_SetAudioFecLookahead(napi_env env, napi_callback_info info);
+
 /**
  * 设置音量
  * @param volume 音量 (0.0 - 1.0)
  */
 napi_value MoonBridge_SetAudioVolume(napi_env env, napi_callback_info info);
 
+/**
+ * 获取音频管线统计（渲染器缓冲 + AudioRecv 单包耗时 + 分析线程）
+ * @return object
+ */
+napi_value MoonBridge_GetAudioStats(napi_env env, napi_callback_info info);
+
+/**
+ * 设置音视频同步（音频延迟 vs 视频入队→呈现延迟，超出窗口时微调）
+ * @param enabled boolean
+ * @param windowMs 允许的 |skew|（毫秒）
+ */
+napi_value MoonBridge_SetAvSyncConfig(napi_env env, napi_callback_info info);
+
+/**
+ * 获取音视频同步统计（skewMs = 音频延迟 - 视频延迟）
+ * @return object
+ */
+napi_value MoonBridge_GetAvSyncStats(napi_env env, napi_callback_info info);
+
+/**
+ * 设置温控调度器（下次串流开始时生效）
+ * @param enabled boolean
+ * @param sysfsRoot string? sysfs 路径前缀（测试用伪造目录，空串为真实 sysfs）
+ */
+napi_value MoonBridge_SetThermalGovernorConfig(napi_env env, napi_callback_info info);
+
+/**
+ * 获取温控调度器统计（当前等级、最近采样、变更原因）
+ * @return object
+ */
+napi_value MoonBridge_GetThermalGovernorStats(napi_env env, napi_callback_info info);
+
 // =============================================================================
 // 性能模式
 // =============================================================================
@@ -15,6 +15,7 @@
  * 无触摸时系统节流至 ~30Hz。本模块使用 OH_Input_AddMouseEventMonitor
  * 在系统输入管线层级监听鼠标事件（不消费事件，触摸/滚轮不受影响），
  * 以硬件轮询率直接转发给 moonlight-common-c，实现全速鼠标回报。
+ * 发送经 input_scheduler：启用输入合并时移动按节拍合并，按键总是立即发送。
  *
  * 绝对模式（默认，适合远程桌面）：
  *   窗口坐标 → 比例映射到远端全屏。精确定位，无加速。
@@ -30,6 +31,7 @@
  */
 
 #include "mouse_interceptor.h"
+#include "input_scheduler.h"
 #include <multimodalinput/oh_input_manager.h>
 #include <hilog/log.h>
 #include <atomic>
@@ -210,7 +212,7 @@ static void OnMouseEvent(const Input_MouseEvent *event)
                     int32_t dx = x - g_lastX;
                     int32_t dy = y - g_lastY;
                     if (dx != 0 || dy != 0) {
-                        LiSendMouseMoveEvent((short)dx, (short)dy);
+                        InputScheduler_SendMouseMove((short)dx, (short)dy);
                     }
                 }
                 g_lastX = x;
@@ -231,7 +233,7 @@ static void OnMouseEvent(const Input_MouseEvent *event)
                 int32_t relY = y - wy;
                 if (relX < 0) relX = 0; else if (relX > ww) relX = ww;
                 if (relY < 0) relY = 0; else if (relY > wh) relY = wh;
-                LiSendMousePositionEvent((short)relX, (short)relY, (short)ww, (short)wh);
+                InputScheduler_SendMousePosition((short)relX, (short)relY, (short)ww, (short)wh);
             }
             break;
         }
@@ -243,7 +245,7 @@ static void OnMouseEvent(const Input_MouseEvent *event)
             if (moonBtn > 0) {
                 char moonAction = (action == MOUSE_ACTION_BUTTON_DOWN)
                     ? BUTTON_ACTION_PRESS : BUTTON_ACTION_RELEASE;
-                LiSendMouseButtonEvent(moonAction, moonBtn);
+                InputScheduler_SendMouseButton(moonAction, moonBtn);
             }
             break;
         }
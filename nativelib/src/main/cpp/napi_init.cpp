@@ -26,6 +26,11 @@
 #include "mouse_interceptor.h"
 #include "usb_helper.h"
 #include "usb_ddk_poller.h"
+#include "haptics_router.h"
+#include "controller_input_router.h"
+#include "input_scheduler.h"
+#include "device_motion.h"
+#include "touch_gesture.h"
 // SDL3 库尚未移植到 HarmonyOS，暂时禁用
 // #include "sdl3/sdl3_gamepad_napi.h"
 
@@ -80,6 +85,9 @@ static napi_value Init(napi_env env, napi_value exports) {
         { "sendTouchEvent", nullptr, MoonBridge_SendTouchEvent, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "sendPenEvent", nullptr, MoonBridge_SendPenEvent, nullptr, nullptr, nullptr, napi_default, nullptr },
         
+        // 批量输入（一帧内的输入一次提交）
+        { "submitInputBatch", nullptr, MoonBridge_SubmitInputBatch, nullptr, nullptr, nullptr, napi_default, nullptr },
+        
         // 麦克风
         { "getMicPortNumber", nullptr, MoonBridge_GetMicPortNumber, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "isMicrophoneRequested", nullptr, MoonBridge_IsMicrophoneRequested, nullptr, nullptr, nullptr, napi_default, nullptr },
@@ -89,6 +97,7 @@ static napi_value Init(napi_env env, napi_value exports) {
         // Opus 编码器
         { "opusEncoderCreate", nullptr, MoonBridge_OpusEncoderCreate, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "opusEncoderEncode", nullptr, MoonBridge_OpusEncoderEncode, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "opusEncoderEncodeBatch", nullptr, MoonBridge_OpusEncoderEncodeBatch, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "opusEncoderDestroy", nullptr, MoonBridge_OpusEncoderDestroy, nullptr, nullptr, nullptr, napi_default, nullptr },
         
         // Native 低时延麦克风
@@ -131,7 +140,13 @@ static napi_value Init(napi_env env, napi_value exports) {
         // 音频设置
         { "setSpatialAudioEnabled", nullptr, MoonBridge_SetSpatialAudioEnabled, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "isSpatialAudioEnabled", nullptr, MoonBridge_IsSpatialAudioEnabled, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setAudioFecLookahead", nullptr, MoonBridge_SetAudioFecLookahead, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "setAudioVolume", nullptr, MoonBridge_SetAudioVolume, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "getAudioStats", nullptr, MoonBridge_GetAudioStats, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setAvSyncConfig", nullptr, MoonBridge_SetAvSyncConfig, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "getAvSyncStats", nullptr, MoonBridge_GetAvSyncStats, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setThermalGovernorConfig", nullptr, MoonBridge_SetThermalGovernorConfig, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "getThermalGovernorStats", nullptr, MoonBridge_GetThermalGovernorStats, nullptr, nullptr, nullptr, napi_default, nullptr },
         
         // 性能模式
         { "setPerformanceModeEnabled", nullptr, MoonBridge_SetPerformanceModeEnabled, nullptr, nullptr, nullptr, napi_default, nullptr },
@@ -164,6 +179,21 @@ static napi_value Init(napi_env env, napi_value exports) {
     // 初始化 USB DDK Poller NAPI (DDK 高速轮询)
     UsbDdkPoller_Init(env, exports);
     
+    // 初始化振动路由 NAPI (音频/游戏 rumble → USB 手柄马达，绕过 JS)
+    HapticsRouter_Init(env, exports);
+    
+    // 初始化手柄输入路由 NAPI (DDK 报告 → 解析 → 直接发送给主机，绕过 JS)
+    ControllerInputRouter_Init(env, exports);
+    
+    // 初始化输入合并调度 NAPI (鼠标增量 / 滚轮 / 手柄状态按节拍合并发送)
+    InputScheduler_Init(env, exports);
+    
+    // 初始化设备体感 NAPI (Sensor NDK 运动事件直通 / 体感助手)
+    DeviceMotion_Init(env, exports);
+    
+    // 初始化触摸手势引擎 NAPI (整个 TouchEvent 一次提交，手势识别与发送在 native 完成)
+    TouchGesture_Init(env, exports);
+    
     // SDL3 库尚未移植到 HarmonyOS，SDL3 NAPI 暂时禁用
     // 当前使用内置的 SDL GameControllerDB 映射数据替代
     // Sdl3GamepadNapi_Init(env, exports);
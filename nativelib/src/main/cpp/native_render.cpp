@@ -23,6 +23,8 @@
  */
 
 #include "native_render.h"
+#include "av_sync_controller.h"
+#include <algorithm>
 #include <cstring>
 #include <dlfcn.h>
 #include <time.h>
@@ -346,7 +348,20 @@ int64_t NativeRender::CalculatePresentTime(int64_t pts) const {
         baseSystemTimeNs_ = targetPresentTimeNs - ptsDeltaNs;
     }
     
-    return targetPresentTimeNs;
+    // 音视频同步：声音偏晚且音频已无积压可丢时推迟画面（不参与时间基准重同步）
+    return targetPresentTimeNs + AvSyncController::GetVideoDelayNs();
+}
+
+void NativeRender::NotifyFramePresented(int64_t enqueueTimeMs, int64_t presentTimeNs) const {
+    if (presentTimeNs > 0) {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        int64_t nowNs = static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+        AvSyncController::OnVideoFrame(enqueueTimeMs, (presentTimeNs - nowNs) / 1000000.0, true);
+    } else {
+        // 直接渲染：下一次 VSync 锁存，约一个刷新周期后上屏
+        AvSyncController::OnVideoFrame(enqueueTimeMs, 1000.0 / std::max(configuredFps_, 1), false);
+    }
 }
 
 // =============================================================================
@@ -366,12 +381,16 @@ void NativeRender::SubmitFrame(OH_AVCodec* codec, uint32_t bufferIndex, int64_t
             if (renderResult != 0) {
                 OH_LOG_WARN(LOG_APP, "RenderOutputBufferAtTime failed: %{public}d, pts=%{public}lld, presentNs=%{public}lld",
                             renderResult, static_cast<long long>(pts), static_cast<long long>(presentTimeNs));
+            } else {
+                NotifyFramePresented(enqueueTimeMs, presentTimeNs);
             }
         } else {
             // RenderOutputBufferAtTime 不可用，回退到直接渲染
             renderResult = OH_VideoDecoder_RenderOutputBuffer(codec, bufferIndex);
             if (renderResult != 0) {
                 OH_LOG_WARN(LOG_APP, "RenderOutputBuffer (vsync fallback) failed: %{public}d", renderResult);
+            } else {
+                NotifyFramePresented(enqueueTimeMs, 0);
             }
         }
     } else {
@@ -380,6 +399,8 @@ void NativeRender::SubmitFrame(OH_AVCodec* codec, uint32_t bufferIndex, int64_t
         
         if (renderResult != 0) {
             OH_LOG_WARN(LOG_APP, "RenderOutputBuffer failed: %{public}d", renderResult);
+        } else {
+            NotifyFramePresented(enqueueTimeMs, 0);
         }
     }
     
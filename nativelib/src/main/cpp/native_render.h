@@ -99,8 +99,15 @@ public:
     // 检查 Surface 是否就绪
     bool IsSurfaceReady() const { return surfaceReady_; }
     
-    // 计算 VSync 呈现时间（供 VideoDecoder 同步模式使用）
+    // 计算 VSync 呈现时间（供 VideoDecoder 同步模式使用），已叠加音视频同步的推迟量
     int64_t CalculatePresentTime(int64_t pts) const;
+    
+    /**
+     * 上报一帧已提交呈现，供音视频同步测量视频延迟
+     * @param enqueueTimeMs 入队时间（毫秒）
+     * @param presentTimeNs RenderOutputBufferAtTime 的呈现时间，0 表示直接渲染（按一个刷新周期估算）
+     */
+    void NotifyFramePresented(int64_t enqueueTimeMs, int64_t presentTimeNs) const;
 
 private:
     NativeRender();
@@ -0,0 +1,37 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file onset_backend.h
+ * @brief 编译期选择 BassEnergyAnalyzer 使用的 onset 检测后端
+ *
+ * 由 CMake 选项 MOONLIGHT_ONSET_BACKEND 控制：
+ *   aubio    (默认) → AubioOnsetWrapper，链接 aubio_static
+ *   spectral        → SpectralOnsetDetector，零依赖，不编译 aubio
+ *
+ * 两个后端接口一致（Init / Reset / ProcessFrame / IsInitialized /
+ * GetDescriptor / SetThreshold / SetMinInterval），切换只需重新配置 CMake：
+ *   -DMOONLIGHT_ONSET_BACKEND=spectral
+ */
+
+#ifndef ONSET_BACKEND_H
+#define ONSET_BACKEND_H
+
+#if defined(MOONLIGHT_ONSET_BACKEND_SPECTRAL)
+#include "spectral_onset_detector.h"
+typedef SpectralOnsetDetector OnsetBackend;
+#define ONSET_BACKEND_NAME "spectral"
+#else
+#include "aubio_onset_wrapper.h"
+typedef AubioOnsetWrapper OnsetBackend;
+#define ONSET_BACKEND_NAME "aubio"
+#endif
+
+#endif // ONSET_BACKEND_H
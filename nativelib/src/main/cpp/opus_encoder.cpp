@@ -45,9 +45,24 @@ OhosOpusEncoder::~OhosOpusEncoder() {
     Cleanup();
 }
 
-int OhosOpusEncoder::Init(int sampleRate, int channels, int bitrate) {
-    OH_LOG_INFO(LOG_APP, "Init (libopus): sampleRate=%{public}d, channels=%{public}d, bitrate=%{public}d",
-                sampleRate, channels, bitrate);
+// 帧长 (ms) → OPUS_SET_EXPERT_FRAME_DURATION 参数，0 表示不支持
+static int FrameDurationArg(int frameSizeMs) {
+    switch (frameSizeMs) {
+        case 5:  return OPUS_FRAMESIZE_5_MS;
+        case 10: return OPUS_FRAMESIZE_10_MS;
+        case 20: return OPUS_FRAMESIZE_20_MS;
+        default: return 0;
+    }
+}
+
+int OhosOpusEncoder::Init(int sampleRate, int channels, int bitrate, int frameSizeMs) {
+    OH_LOG_INFO(LOG_APP, "Init (libopus): sampleRate=%{public}d, channels=%{public}d, bitrate=%{public}d, frameMs=%{public}d",
+                sampleRate, channels, bitrate, frameSizeMs);
+
+    if (FrameDurationArg(frameSizeMs) == 0) {
+        OH_LOG_WARN(LOG_APP, "Unsupported frame size %{public}d ms, using 20 ms", frameSizeMs);
+        frameSizeMs = 20;
+    }
 
     if (initialized_.load(std::memory_order_acquire)) {
         OH_LOG_WARN(LOG_APP, "Opus encoder already initialized, cleaning up first");
@@ -57,7 +72,8 @@ int OhosOpusEncoder::Init(int sampleRate, int channels, int bitrate) {
     sampleRate_ = sampleRate;
     channels_ = channels;
     bitrate_ = bitrate;
-    frameSize_ = sampleRate / 50; // 20ms 帧 (48000/50 = 960)
+    frameSizeMs_ = frameSizeMs;
+    frameSize_ = sampleRate * frameSizeMs / 1000; // 20ms 帧 (48000/50 = 960)
 
     // 创建 libopus 编码器 — VOIP 模式专门优化语音
     int error = 0;
@@ -83,8 +99,8 @@ int OhosOpusEncoder::Init(int sampleRate, int channels, int bitrate) {
     // DTX：静音时不发送帧，节省带宽
     opus_encoder_ctl(encoder_, OPUS_SET_DTX(1));
 
-    // 帧大小：20ms
-    opus_encoder_ctl(encoder_, OPUS_SET_EXPERT_FRAME_DURATION(OPUS_FRAMESIZE_20_MS));
+    // 帧大小：默认 20ms，低延迟模式 5/10ms
+    opus_encoder_ctl(encoder_, OPUS_SET_EXPERT_FRAME_DURATION(FrameDurationArg(frameSizeMs_)));
 
     // FEC：前向纠错，丢包时可从后续包恢复
     opus_encoder_ctl(encoder_, OPUS_SET_INBAND_FEC(1));
@@ -108,6 +124,40 @@ int OhosOpusEncoder::Init(int sampleRate, int channels, int bitrate) {
     return 0;
 }
 
+int OhosOpusEncoder::SetFrameSizeMs(int frameSizeMs) {
+    int arg = FrameDurationArg(frameSizeMs);
+    if (arg == 0 || encoder_ == nullptr) {
+        return -1;
+    }
+    if (frameSizeMs == frameSizeMs_) {
+        return 0;
+    }
+    int ret = opus_encoder_ctl(encoder_, OPUS_SET_EXPERT_FRAME_DURATION(arg));
+    if (ret != OPUS_OK) {
+        OH_LOG_WARN(LOG_APP, "Set frame duration %{public}d ms failed: %{public}d", frameSizeMs, ret);
+        return -1;
+    }
+    frameSizeMs_ = frameSizeMs;
+    frameSize_ = sampleRate_ * frameSizeMs / 1000;
+    return 0;
+}
+
+int OhosOpusEncoder::SetBitrate(int bitrate) {
+    if (encoder_ == nullptr) {
+        return -1;
+    }
+    if (bitrate == bitrate_) {
+        return 0;
+    }
+    int ret = opus_encoder_ctl(encoder_, OPUS_SET_BITRATE(bitrate));
+    if (ret != OPUS_OK) {
+        OH_LOG_WARN(LOG_APP, "Set bitrate %{public}d failed: %{public}d", bitrate, ret);
+        return -1;
+    }
+    bitrate_ = bitrate;
+    return 0;
+}
+
 int OhosOpusEncoder::Encode(const uint8_t* pcmData, int pcmLength, uint8_t* opusOutput, int maxOutputLen) {
     if (pcmData == nullptr || pcmLength <= 0 || opusOutput == nullptr || maxOutputLen <= 0) {
         return -1;
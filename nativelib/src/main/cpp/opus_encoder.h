@@ -46,9 +46,28 @@ public:
      * @param sampleRate 采样率 (8000, 12000, 16000, 24000, 48000)
      * @param channels 通道数 (1 或 2)
      * @param bitrate 比特率 (6000-510000 bps)
+     * @param frameSizeMs 帧长 (5, 10, 20 ms)
      * @return 0 成功, 负数失败
      */
-    int Init(int sampleRate, int channels, int bitrate);
+    int Init(int sampleRate, int channels, int bitrate, int frameSizeMs = 20);
+
+    /**
+     * 切换帧长（与 Encode 同线程调用，下一帧生效）
+     * @param frameSizeMs 5, 10 或 20
+     * @return 0 成功, 负数失败（不支持的帧长时保持原值）
+     */
+    int SetFrameSizeMs(int frameSizeMs);
+
+    /**
+     * 调整比特率（与 Encode 同线程调用，下一帧生效）
+     * @return 0 成功, 负数失败
+     */
+    int SetBitrate(int bitrate);
+
+    int GetFrameSizeMs() const { return frameSizeMs_; }
+    int GetFrameSamples() const { return frameSize_; }
+    int GetFrameBytes() const { return frameSize_ * channels_ * 2; }
+    int GetBitrate() const { return bitrate_; }
 
     /**
      * 编码 PCM 数据（同步调用）
@@ -81,6 +100,7 @@ private:
     int channels_ = 1;
     int bitrate_ = 64000;
     int frameSize_ = 960; // samples per channel per frame (20ms @ 48kHz)
+    int frameSizeMs_ = 20;
 
     std::atomic<bool> initialized_{false};
     std::atomic<bool> hasError_{false};
@@ -18,6 +18,8 @@
  *   - LACE (complexity == 6): 低码率语音增强，轻量级 DNN 后处理
  *   - NoLACE (complexity >= 7): 更强力的非线性语音增强
  *   - DRED 解码: 当编码端支持 DRED 时可解码深度冗余数据（未来 Sunshine 支持时自动生效）
+ *   - 带内 FEC: 丢包后用下一个包的 LBRR 数据重建丢失帧（DecodeFec），
+ *     比 Deep PLC 更准确、更省算力；需编码端启用 OPUS_SET_INBAND_FEC
  */
 
 #include "opus_libopus.h"
@@ -25,6 +27,7 @@
 #include <opus_defines.h>
 #include <hilog/log.h>
 #include <mutex>
+#include <atomic>
 #include <cstring>
 
 // Deep PLC 解码器复杂度等级
@@ -32,6 +35,8 @@
 // 6 = Deep PLC + LACE (低复杂度语音增强)
 // 7+ = Deep PLC + NoLACE (高质量语音增强)
 static constexpr int DECODER_COMPLEXITY = 7;
+// 温控降载时的复杂度：保留 Deep PLC，关闭 LACE/NoLACE 增强
+static constexpr int DECODER_COMPLEXITY_REDUCED = 5;
 
 // =============================================================================
 // 全局解码器实例
@@ -43,6 +48,19 @@ namespace {
     static int g_channelCount = 0;
     static int g_samplesPerFrame = 0;
     static OPUS_MULTISTREAM_CONFIGURATION g_savedConfig;
+    
+    // FEC 前瞻开关（JS 线程写，AudioRecv 线程读）
+    static std::atomic<bool> g_fecLookahead{false};
+    
+    // 目标复杂度（ThermalGovernor 写，AudioRecv 线程在解码前应用）
+    static std::atomic<int> g_targetComplexity{DECODER_COMPLEXITY};
+    static int g_appliedComplexity = DECODER_COMPLEXITY;
+    
+    // 统计（AudioRecv 线程写，JS 线程读）
+    static std::atomic<uint64_t> g_framesDecoded{0};
+    static std::atomic<uint64_t> g_plcFrames{0};
+    static std::atomic<uint64_t> g_fecRecovered{0};
+    static std::atomic<uint64_t> g_fecUnavailable{0};
 }
 
 namespace MoonlightOpusDecoder {
@@ -61,6 +79,11 @@ int Init(POPUS_MULTISTREAM_CONFIGURATION opusConfig) {
     g_channelCount = opusConfig->channelCount;
     g_samplesPerFrame = opusConfig->samplesPerFrame;
     
+    g_framesDecoded.store(0, std::memory_order_relaxed);
+    g_plcFrames.store(0, std::memory_order_relaxed);
+    g_fecRecovered.store(0, std::memory_order_relaxed);
+    g_fecUnavailable.store(0, std::memory_order_relaxed);
+    
     OH_LOG_INFO(LOG_APP,
         "Initializing libopus decoder: sampleRate=%{public}d, channels=%{public}d, "
         "streams=%{public}d, coupledStreams=%{public}d, samplesPerFrame=%{public}d",
@@ -89,26 +112,49 @@ int Init(POPUS_MULTISTREAM_CONFIGURATION opusConfig) {
     // complexity 5 = Deep PLC (神经网络丢包补偿)
     // complexity 6 = Deep PLC + LACE (低复杂度语音增强)
     // complexity 7+ = Deep PLC + NoLACE (高质量非线性语音增强)
-    int ctlErr = opus_multistream_decoder_ctl(g_decoder, OPUS_SET_COMPLEXITY(DECODER_COMPLEXITY));
+    g_appliedComplexity = g_targetComplexity.load(std::memory_order_relaxed);
+    int ctlErr = opus_multistream_decoder_ctl(g_decoder, OPUS_SET_COMPLEXITY(g_appliedComplexity));
     if (ctlErr != OPUS_OK) {
         OH_LOG_WARN(LOG_APP, "Failed to set decoder complexity to %{public}d: %{public}d (%{public}s). "
                     "ML features (Deep PLC/NoLACE) may not be available.",
-                    DECODER_COMPLEXITY, ctlErr, opus_strerror(ctlErr));
+                    g_appliedComplexity, ctlErr, opus_strerror(ctlErr));
     } else {
         OH_LOG_INFO(LOG_APP, "Decoder complexity set to %{public}d "
-                    "(Deep PLC + NoLACE enabled)",
-                    DECODER_COMPLEXITY);
+                    "(Deep PLC%{public}s enabled)",
+                    g_appliedComplexity, g_appliedComplexity >= 7 ? " + NoLACE" : "");
     }
     
-    OH_LOG_INFO(LOG_APP, "libopus 1.6 decoder initialized successfully with ML enhancements");
+    OH_LOG_INFO(LOG_APP, "libopus 1.6 decoder initialized successfully with ML enhancements "
+                "(FEC lookahead %{public}s)", g_fecLookahead.load() ? "on" : "off");
     return 0;
 }
 
+/**
+ * 在解码线程上应用目标复杂度（CTL 与解码不能并发）
+ */
+static void ApplyPendingComplexity() {
+    int target = g_targetComplexity.load(std::memory_order_relaxed);
+    if (target == g_appliedComplexity) {
+        return;
+    }
+    int ctlErr = opus_multistream_decoder_ctl(g_decoder, OPUS_SET_COMPLEXITY(target));
+    if (ctlErr != OPUS_OK) {
+        OH_LOG_WARN(LOG_APP, "Failed to change decoder complexity to %{public}d: %{public}d (%{public}s)",
+                    target, ctlErr, opus_strerror(ctlErr));
+    } else {
+        OH_LOG_INFO(LOG_APP, "Decoder complexity %{public}d -> %{public}d",
+                    g_appliedComplexity, target);
+    }
+    // 失败也记为已应用，避免每包重试
+    g_appliedComplexity = target;
+}
+
 int Decode(const unsigned char* opusData, int opusLength,
            short* pcmOut, int maxSamples) {
     if (g_decoder == nullptr) {
         return -1;
     }
+    ApplyPendingComplexity();
     
     // libopus 1.6 Neural PLC：传入 NULL 数据时，libopus 使用深度神经网络
     // (FARGAN vocoder) 预测并生成高质量的替代帧。
@@ -129,9 +175,76 @@ int Decode(const unsigned char* opusData, int opusLength,
         return -1;
     }
     
+    if (opusData == nullptr) {
+        g_plcFrames.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        g_framesDecoded.fetch_add(1, std::memory_order_relaxed);
+    }
     return decodeLen;
 }
 
+int DecodeFec(const unsigned char* nextData, int nextLength,
+              short* pcmOut, int maxSamples) {
+    if (g_decoder == nullptr || nextData == nullptr || nextLength <= 0) {
+        return -1;
+    }
+    ApplyPendingComplexity();
+    
+    // 单流（单声道/立体声）包可直接检查 LBRR；多流包首个流为自定界格式，
+    // 无法用 opus_packet_has_lbrr 判断，直接尝试 FEC 解码
+    bool hasLbrr = true;
+    if (g_savedConfig.streams == 1) {
+        hasLbrr = opus_packet_has_lbrr(nextData, nextLength) > 0;
+    }
+    
+    // decode_fec=1 时 frame_size 必须等于丢失帧长度；
+    // 包内没有 LBRR 数据时 libopus 对该帧执行 PLC
+    int decodeLen = opus_multistream_decode(
+        g_decoder,
+        nextData,
+        nextLength,
+        pcmOut,
+        maxSamples,
+        1               // decode_fec: 1 = 用该包的带内 FEC 重建上一帧
+    );
+    
+    if (decodeLen < 0) {
+        OH_LOG_WARN(LOG_APP, "opus_multistream_decode (FEC) error: %{public}d (%{public}s)",
+                    decodeLen, opus_strerror(decodeLen));
+        return -1;
+    }
+    
+    if (hasLbrr) {
+        g_fecRecovered.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        g_fecUnavailable.fetch_add(1, std::memory_order_relaxed);
+        g_plcFrames.fetch_add(1, std::memory_order_relaxed);
+    }
+    return decodeLen;
+}
+
+void SetFecLookahead(bool enabled) {
+    g_fecLookahead.store(enabled, std::memory_order_relaxed);
+    OH_LOG_INFO(LOG_APP, "Opus FEC lookahead: %{public}s", enabled ? "enabled" : "disabled");
+}
+
+void SetReducedComplexity(bool reduced) {
+    g_targetComplexity.store(reduced ? DECODER_COMPLEXITY_REDUCED : DECODER_COMPLEXITY,
+                             std::memory_order_relaxed);
+}
+
+bool IsFecLookaheadEnabled() {
+    return g_fecLookahead.load(std::memory_order_relaxed);
+}
+
+void GetStats(OpusDecodeStats* out) {
+    if (out == nullptr) return;
+    out->framesDecoded = g_framesDecoded.load(std::memory_order_relaxed);
+    out->plcFrames = g_plcFrames.load(std::memory_order_relaxed);
+    out->fecRecovered = g_fecRecovered.load(std::memory_order_relaxed);
+    out->fecUnavailable = g_fecUnavailable.load(std::memory_order_relaxed);
+}
+
 void Cleanup() {
     std::lock_guard<std::mutex> lock(g_mutex);
     
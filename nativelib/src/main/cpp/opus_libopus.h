@@ -14,6 +14,9 @@
  * 
  * 使用 libopus 原生 API 进行 Opus 解码
  * 优势：原生 PLC（丢包补偿）、同步调用零延迟、代码简洁
+ *
+ * 可选 FEC 前瞻：丢包时先不做 PLC，等下一个包到达后用其带内 FEC (LBRR)
+ * 重建丢失帧（DecodeFec），由调用方 (BridgeArDecodeAndPlaySample) 控制时序。
  */
 
 #ifndef OPUS_LIBOPUS_H
@@ -23,6 +26,18 @@ extern "C" {
 #include "moonlight-common-c/src/Limelight.h"
 }
 
+#include <cstdint>
+
+/**
+ * 解码统计（丢包恢复方式）
+ */
+struct OpusDecodeStats {
+    uint64_t framesDecoded;     // 正常解码帧数
+    uint64_t plcFrames;         // PLC 补偿帧数（含下一包无 FEC 数据时的回退）
+    uint64_t fecRecovered;      // 由下一包带内 FEC 重建的帧数
+    uint64_t fecUnavailable;    // 尝试 FEC 但下一包不含 LBRR 数据
+};
+
 /**
  * 全局 Opus 解码器实例
  */
@@ -45,6 +60,37 @@ namespace MoonlightOpusDecoder {
     int Decode(const unsigned char* opusData, int opusLength,
                short* pcmOut, int maxSamples);
     
+    /**
+     * 用下一个包的带内 FEC 重建上一帧（丢失帧）
+     * 下一包不含 LBRR 数据时 libopus 自动退化为 PLC。
+     * 调用后仍需用 Decode() 正常解码该包本身。
+     * @param nextData 丢失帧之后到达的 Opus 包
+     * @param nextLength 数据长度
+     * @param pcmOut 输出 PCM 缓冲区
+     * @param maxSamples 丢失帧的采样数（per channel，必须等于帧长）
+     * @return 解码的采样数（per channel），负数表示失败
+     */
+    int DecodeFec(const unsigned char* nextData, int nextLength,
+                  short* pcmOut, int maxSamples);
+    
+    /**
+     * 启用/禁用 FEC 前瞻（跨会话保持，默认关闭）
+     */
+    void SetFecLookahead(bool enabled);
+    
+    bool IsFecLookaheadEnabled();
+    
+    /**
+     * 降低解码复杂度（温控降载：7 → 5，保留 Deep PLC）
+     * 任意线程调用，下一次 Decode / DecodeFec 时在解码线程生效；跨会话保持。
+     */
+    void SetReducedComplexity(bool reduced);
+    
+    /**
+     * 获取解码统计（任意线程）
+     */
+    void GetStats(OpusDecodeStats* out);
+    
     /**
      * 清理解码器
      */
@@ -16,12 +16,10 @@
  */
 
 #include "sdl_gamecontrollerdb.h"
-#include "sdl_gamecontrollerdb_data.h"
 #include "gamepad_napi.h"  // 使用其中定义的 BTN_FLAG_* 常量
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
-#include <vector>
 
 // ==================== 辅助宏：快速创建映射 ====================
 #define BTN(idx) { MAPPING_BUTTON, idx, 0, false, 0, 255 }
@@ -468,109 +466,57 @@ static const VendorDefaultEntry g_vendorDefaults[] = {
     { 0, NULL }
 };
 
-// ==================== SDL GameControllerDB 社区数据库 ====================
+// ==================== SDL GameControllerDB 社区数据库 + VID/PID 索引 ====================
+// SDL 映射字符串 (sdl_gamecontrollerdb_data.h) 已在生成时解析为 g_sdlDbMappings，
+// 与上面两张表及 gamepad_napi.cpp 的已知手柄 / 厂商回退表共用一张完美哈希表。
+// 修改任何一张表后需重新运行 nativelib/tools/gen_controller_db.py。
 
-static std::vector<GamepadMapping> g_sdlParsedMappings;
-static bool g_sdlDBInitialized = false;
+#define CONTROLLER_DB_DEFINE_TABLES
+#include "controller_db_generated.h"
 
-/**
- * 从 SDL GUID 字符串中提取 VID/PID (Linux 格式)
- * 
- * Linux GUID 布局 (16 bytes, 32 hex chars):
- *   Bytes 0-1:  Bus type (LE)
- *   Bytes 2-3:  CRC16
- *   Bytes 4-5:  Vendor ID (LE)  → hex chars 8-11
- *   Bytes 6-7:  Padding
- *   Bytes 8-9:  Product ID (LE) → hex chars 16-19
- *   Bytes 10-15: Version + padding
- */
-static bool extractVidPidFromGUID(const char* guid, uint16_t* outVid, uint16_t* outPid) {
-    if (!guid || strlen(guid) < 20) return false;
-    
-    auto hexDigit = [](char c) -> int {
-        if (c >= '0' && c <= '9') return c - '0';
-        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
-        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
-        return -1;
-    };
-    
-    auto hexByte = [&hexDigit](const char* s) -> int {
-        int hi = hexDigit(s[0]);
-        int lo = hexDigit(s[1]);
-        if (hi < 0 || lo < 0) return -1;
-        return (hi << 4) | lo;
-    };
-    
-    // VID: bytes 4-5 at hex offset 8-11, little-endian
-    int vidLo = hexByte(guid + 8);
-    int vidHi = hexByte(guid + 10);
-    if (vidLo < 0 || vidHi < 0) return false;
-    *outVid = (uint16_t)(vidLo | (vidHi << 8));
-    
-    // PID: bytes 8-9 at hex offset 16-19, little-endian
-    int pidLo = hexByte(guid + 16);
-    int pidHi = hexByte(guid + 18);
-    if (pidLo < 0 || pidHi < 0) return false;
-    *outPid = (uint16_t)(pidLo | (pidHi << 8));
-    
-    return (*outVid != 0 || *outPid != 0);
+static_assert(sizeof(g_mappingDatabase) / sizeof(g_mappingDatabase[0]) - 1 == CONTROLLER_DB_CURATED_MAPPINGS,
+              "g_mappingDatabase changed: rerun nativelib/tools/gen_controller_db.py");
+static_assert(sizeof(g_vendorDefaults) / sizeof(g_vendorDefaults[0]) - 1 == CONTROLLER_DB_VENDOR_DEFAULTS,
+              "g_vendorDefaults changed: rerun nativelib/tools/gen_controller_db.py");
+
+// 与生成器 mix() 一致
+static inline uint32_t controllerDbMix(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
 }
 
-/**
- * 懒加载 SDL GameControllerDB 社区数据库
- * 解析所有条目并提取 VID/PID 存入动态数组
- */
-static void initSDLGameControllerDB() {
-    if (g_sdlDBInitialized) return;
-    g_sdlDBInitialized = true;
-    
-    g_sdlParsedMappings.reserve(g_sdlGameControllerDBCount);
-    
-    for (int i = 0; i < g_sdlGameControllerDBCount; i++) {
-        const char* entry = g_sdlGameControllerDB[i];
-        if (!entry) break;
-        
-        GamepadMapping mapping;
-        if (parseSDLMappingString(entry, &mapping)) {
-            uint16_t vid = 0, pid = 0;
-            if (extractVidPidFromGUID(entry, &vid, &pid)) {
-                mapping.vendorId = vid;
-                mapping.productId = pid;
-                g_sdlParsedMappings.push_back(mapping);
-            }
-        }
-    }
+static const ControllerDbEntry* controllerDbLookup(uint32_t key, uint8_t kind) {
+    uint32_t h = controllerDbMix(key ^ (kind == CONTROLLER_DB_VENDOR ? CONTROLLER_DB_VENDOR_SALT : 0));
+    uint32_t d = g_controllerDbDisplace[h & (CONTROLLER_DB_BUCKETS - 1)];
+    const ControllerDbEntry* e = &g_controllerDb[controllerDbMix(h + d * 0x9E3779B9u) & (CONTROLLER_DB_SLOTS - 1)];
+    return (e->key == key && e->kind == kind) ? e : NULL;
 }
 
 // ==================== API 实现 ====================
 
+const ControllerDbEntry* findControllerDbDevice(uint16_t vendorId, uint16_t productId) {
+    return controllerDbLookup(((uint32_t)vendorId << 16) | productId, CONTROLLER_DB_DEVICE);
+}
+
+const ControllerDbEntry* findControllerDbVendor(uint16_t vendorId) {
+    return controllerDbLookup(vendorId, CONTROLLER_DB_VENDOR);
+}
+
 const GamepadMapping* findGamepadMapping(uint16_t vendorId, uint16_t productId) {
-    // 1. 先搜索静态预定义数据库 (手工调优映射，优先级最高)
-    for (int i = 0; g_mappingDatabase[i].name != NULL; i++) {
-        if (g_mappingDatabase[i].vendorId == vendorId && 
-            g_mappingDatabase[i].productId == productId) {
-            return &g_mappingDatabase[i];
-        }
-    }
-    
-    // 2. 搜索 SDL GameControllerDB 社区数据库 (707 个 Linux 平台映射)
-    initSDLGameControllerDB();
-    for (size_t i = 0; i < g_sdlParsedMappings.size(); i++) {
-        if (g_sdlParsedMappings[i].vendorId == vendorId &&
-            g_sdlParsedMappings[i].productId == productId) {
-            return &g_sdlParsedMappings[i];
-        }
-    }
-    
-    return NULL;
+    // 精选映射 (手工调优) 优先于 SDL 社区映射，生成器已按此顺序决定 mappingIndex
+    const ControllerDbEntry* e = findControllerDbDevice(vendorId, productId);
+    if (!e || e->mappingIndex < 0) return NULL;
+    if (e->mappingIndex < CONTROLLER_DB_CURATED_MAPPINGS) return &g_mappingDatabase[e->mappingIndex];
+    return &g_sdlDbMappings[e->mappingIndex - CONTROLLER_DB_CURATED_MAPPINGS];
 }
 
 const GamepadMapping* getDefaultMappingByVendor(uint16_t vendorId) {
-    for (int i = 0; g_vendorDefaults[i].defaultMapping != NULL; i++) {
-        if (g_vendorDefaults[i].vendorId == vendorId) {
-            return g_vendorDefaults[i].defaultMapping;
-        }
-    }
+    const ControllerDbEntry* e = findControllerDbVendor(vendorId);
+    if (e && e->mappingIndex >= 0) return g_vendorDefaults[e->mappingIndex].defaultMapping;
     return &g_genericDefaultMapping;
 }
 
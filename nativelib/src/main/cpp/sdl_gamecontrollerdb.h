@@ -49,13 +49,14 @@ typedef enum {
 #define HAT_LEFT    0x08
 
 // ==================== 单个映射项 ====================
+// 全部字段按字节存储：数据库约 700 条映射 × 21 项，编译期展开后体积主要由此决定
 typedef struct {
-    MappingSourceType type;
-    int index;          // 按钮/轴/HAT 索引
-    int hatMask;        // HAT 方向掩码 (仅 type=MAPPING_HAT 时使用)
+    uint8_t type;       // MappingSourceType
+    uint8_t index;      // 按钮/轴/HAT 索引
+    uint8_t hatMask;    // HAT 方向掩码 (仅 type=MAPPING_HAT 时使用)
     bool inverted;      // 轴是否反转 (a~# 格式)
-    int rangeMin;       // 轴范围映射 (a#+, a#- 格式)
-    int rangeMax;
+    uint8_t rangeMin;   // 轴范围映射 (a#+, a#- 格式)
+    uint8_t rangeMax;
 } MappingSource;
 
 // ==================== 完整手柄映射 ====================
@@ -97,6 +98,34 @@ typedef struct {
 // ==================== 预定义映射数据库 ====================
 // 基于 SDL GameControllerDB 数据，针对常见手柄预定义
 
+// ==================== 编译期 VID/PID 索引 ====================
+// 由 nativelib/tools/gen_controller_db.py 生成 (controller_db_generated.h)：
+// 精选映射、SDL 映射、已知手柄表、厂商回退表合并为一张完美哈希表，查找 O(1)，无启动解析
+typedef enum {
+    CONTROLLER_DB_EMPTY = 0,
+    CONTROLLER_DB_DEVICE,       // key = (VID << 16) | PID
+    CONTROLLER_DB_VENDOR,       // key = VID
+} ControllerDbKind;
+
+typedef struct {
+    uint32_t key;
+    uint8_t kind;               // ControllerDbKind
+    int16_t knownIndex;         // DEVICE: g_knownGamepads 下标；VENDOR: g_vendorFallbacks 下标；-1 = 无
+    int16_t mappingIndex;       // DEVICE: 映射下标 (精选在前，SDL 在后)；VENDOR: g_vendorDefaults 下标；-1 = 无
+} ControllerDbEntry;
+
+/**
+ * 按 VID/PID 查找设备条目
+ * @return 条目指针，未收录返回 NULL
+ */
+const ControllerDbEntry* findControllerDbDevice(uint16_t vendorId, uint16_t productId);
+
+/**
+ * 按 VID 查找厂商条目
+ * @return 条目指针，未收录返回 NULL
+ */
+const ControllerDbEntry* findControllerDbVendor(uint16_t vendorId);
+
 /**
  * 查找手柄映射
  * @param vendorId USB Vendor ID
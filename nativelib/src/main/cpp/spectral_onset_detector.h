@@ -9,18 +9,29 @@
  *       → Spectral Flux → Peak Picker → Silence Gate → MinIOI → onset
  *
  * Key algorithms (all implemented from first principles):
- *   - Radix-2 Cooley-Tukey FFT (in-place, precomputed twiddles)
- *   - Hann window with overlap-save buffering
+ *   - Real-input FFT: N real samples packed into an N/2-point complex FFT
+ *     (split-radix DIF with a precomputed block schedule) followed by a
+ *     split/unpack step — half the work of a full complex FFT
+ *   - Hann window fused into the packing load
  *   - Half-wave rectified spectral flux
  *   - Per-bin exponential peak-tracking whitening
- *   - Logarithmic magnitude compression
+ *   - Logarithmic magnitude compression (branch-free log1p approximation)
  *   - Sliding-window median + mean adaptive threshold peak picker
  *   - Minimum inter-onset interval enforcement
  *
- * Thread model: called on the same audio decode thread as BassEnergyAnalyzer,
- *               no locking required.
+ * Performance layout:
+ *   - Structure-of-arrays (separate real / imaginary / magnitude arrays),
+ *     64-byte aligned, so the per-bin loops are straight-line and
+ *     auto-vectorize to NEON / SSE without intrinsics.
+ *   - No zero-phase rotation: a circular shift by N/2 only multiplies X[k]
+ *     by (-1)^k, which the magnitude spectrum discards.
+ *   - New samples are written straight into the analysis window tail
+ *     (no separate hop accumulation buffer).
  *
- * Memory: ~60KB inline state (zero heap allocation).
+ * Thread model: called on the audio analysis thread alongside
+ *               BassEnergyAnalyzer, no locking required.
+ *
+ * Memory: ~65KB inline state (zero heap allocation).
  *
  * This is a clean-room implementation referencing the published academic
  * algorithms (spectral flux, adaptive whitening) — no aubio code is used.
@@ -31,6 +42,10 @@
  *   [2] Böck & Widmer, "Maximum Filter Vibrato Suppression for Onset
  *       Detection", DAFx-13, 2013.
  *   [3] Dixon, "Onset Detection Revisited", DAFx-06, 2006.
+ *   [4] Sorensen et al., "Real-Valued Fast Fourier Transform Algorithms",
+ *       IEEE Trans. ASSP, 1987.
+ *   [5] Sorensen, Heideman & Burrus, "On Computing the Split-Radix FFT",
+ *       IEEE Trans. ASSP, 1986.
  */
 
 #ifndef SPECTRAL_ONSET_DETECTOR_H
@@ -45,10 +60,238 @@
 #define M_PI 3.14159265358979323846
 #endif
 
+/**
+ * Windowed real-input FFT: N real samples → N/2+1 complex bins (SoA).
+ *
+ *  1. Window and pack x[2n] + i·x[2n+1] into z[n], M = N/2 complex points
+ *     (natural order, unit-stride de-interleave).
+ *  2. In-place split-radix decimation-in-frequency FFT of size M [5]. A block
+ *     of size L runs one L-shaped butterfly (L/4 unit-stride iterations with
+ *     twiddles W_L^j and W_L^3j), then recurses into one L/2 block and two
+ *     L/4 blocks; 4- and 2-point blocks are closed-form leaves. The block
+ *     schedule is flattened once in Init, so Forward is a single loop over
+ *     a precomputed plan. Output is in bit-reversed order.
+ *  3. Split: X[k] = (Z[k] + Z*[M-k])/2 − i·W_N^k·(Z[k] − Z*[M-k])/2, reading
+ *     Z through the bit-reversal table.
+ *
+ * Split-radix needs ~4/3·M·log2(M) real multiplies, fewer than radix-2 or
+ * radix-4 [5]. Zero heap allocation; all tables are inline.
+ */
+class SplitRadixRealFft {
+public:
+    static constexpr int MAX_SIZE = 2048;
+    static constexpr int MAX_HALF = MAX_SIZE / 2;
+
+    /**
+     * @param n  Transform size, power of two in [8, MAX_SIZE]
+     * @return false if n is out of range or not a power of two
+     */
+    bool Init(unsigned int n) {
+        if (n < 8 || n > static_cast<unsigned int>(MAX_SIZE) || (n & (n - 1)) != 0) {
+            return false;
+        }
+        size_ = n;
+        half_ = n / 2;
+
+        // Bit-reversal permutation of the M-point DIF output
+        unsigned int bits = 0;
+        while ((1u << bits) < half_) {
+            bits++;
+        }
+        for (unsigned int i = 0; i < half_; i++) {
+            unsigned int r = 0;
+            for (unsigned int b = 0; b < bits; b++) {
+                r |= ((i >> b) & 1u) << (bits - 1 - b);
+            }
+            bitRev_[i] = static_cast<uint16_t>(r);
+        }
+
+        // L-butterfly twiddles for block size L ≥ 8, quarter q = L/4, stored
+        // contiguously at offset q: W_L^j and W_L^3j, j < q
+        for (unsigned int q = 2; q <= half_ / 4; q <<= 1) {
+            for (unsigned int j = 0; j < q; j++) {
+                double angle = -2.0 * M_PI * j / (4.0 * q);
+                tw1Re_[q + j] = static_cast<float>(std::cos(angle));
+                tw1Im_[q + j] = static_cast<float>(std::sin(angle));
+                tw3Re_[q + j] = static_cast<float>(std::cos(3.0 * angle));
+                tw3Im_[q + j] = static_cast<float>(std::sin(3.0 * angle));
+            }
+        }
+
+        // Real-FFT split twiddles: W_N^k = e^{-2πi·k/N}, k ≤ N/2
+        for (unsigned int k = 0; k <= half_; k++) {
+            double angle = -2.0 * M_PI * k / size_;
+            splitTwRe_[k] = static_cast<float>(std::cos(angle));
+            splitTwIm_[k] = static_cast<float>(std::sin(angle));
+        }
+
+        // Group blocks by size, largest first: each size runs as one tight
+        // loop, and every parent still precedes its sub-blocks
+        planLength_ = 0;
+        for (unsigned int len = half_; len >= 2; len >>= 1) {
+            buildPlan(0, half_, len);
+        }
+        return true;
+    }
+
+    unsigned int Size() const { return size_; }
+
+    /**
+     * Forward transform of in[0..N) · window[0..N).
+     * Writes bins 0..N/2 to re / im (N/2+1 entries each).
+     */
+    void Forward(const float* in, const float* window, float* re, float* im) {
+        const unsigned int m = half_;
+        float* __restrict zr = zRe_;
+        float* __restrict zi = zIm_;
+
+        // ---- 1. Window + pack ----
+        for (unsigned int n = 0; n < m; n++) {
+            zr[n] = in[2 * n] * window[2 * n];
+            zi[n] = in[2 * n + 1] * window[2 * n + 1];
+        }
+
+        // ---- 2. Split-radix DIF, flattened block schedule ----
+        for (unsigned int p = 0; p < planLength_; p++) {
+            const unsigned int off = plan_[p].offset;
+            const unsigned int len = plan_[p].length;
+            if (len >= 8) {
+                const unsigned int q = len / 4;
+                lButterfly(zr + off, zi + off, zr + off + q, zi + off + q,
+                           zr + off + 2 * q, zi + off + 2 * q, zr + off + 3 * q, zi + off + 3 * q,
+                           tw1Re_ + q, tw1Im_ + q, tw3Re_ + q, tw3Im_ + q, q);
+            } else if (len == 4) {
+                dft4(zr + off, zi + off);
+            } else {
+                dft2(zr + off, zi + off);
+            }
+        }
+
+        // ---- 3. Split into the real-signal spectrum ----
+        const uint16_t* __restrict rev = bitRev_;
+        re[0] = zr[0] + zi[0];
+        im[0] = 0.0f;
+        re[m] = zr[0] - zi[0];
+        im[m] = 0.0f;
+        for (unsigned int k = 1; k < m; k++) {
+            unsigned int a = rev[k];
+            unsigned int b = rev[m - k];
+            float ar = zr[a], ai = zi[a];
+            float br = zr[b], bi = -zi[b];   // conj(Z[M-k])
+
+            float er = 0.5f * (ar + br), ei = 0.5f * (ai + bi);   // even part
+            float orr = 0.5f * (ai - bi), oi = -0.5f * (ar - br); // odd part (−i·diff/2)
+
+            float wr = splitTwRe_[k], wi = splitTwIm_[k];
+            re[k] = er + (wr * orr - wi * oi);
+            im[k] = ei + (wr * oi + wi * orr);
+        }
+    }
+
+private:
+    struct Block {
+        uint16_t offset;
+        uint16_t length;
+    };
+
+    /**
+     * Append the split-radix sub-blocks of (offset, length) whose size is
+     * target. A block of M points decomposes into at most M/2 blocks.
+     */
+    void buildPlan(unsigned int offset, unsigned int length, unsigned int target) {
+        if (length < target) {
+            return;
+        }
+        if (length == target) {
+            plan_[planLength_].offset = static_cast<uint16_t>(offset);
+            plan_[planLength_].length = static_cast<uint16_t>(length);
+            planLength_++;
+            return;
+        }
+        if (length <= 4) {
+            return;  // closed-form leaf, no sub-blocks
+        }
+        buildPlan(offset, length / 2, target);
+        buildPlan(offset + length / 2, length / 4, target);
+        buildPlan(offset + 3 * length / 4, length / 4, target);
+    }
+
+    /**
+     * L-shaped butterfly on one block of 4q points (quarters a, b, c, d):
+     *   a ← a + c            b ← b + d           (L/2 sub-DFT: even bins)
+     *   c ← (a−c − i(b−d))·W^j    d ← (a−c + i(b−d))·W^3j   (bins 4k+1, 4k+3)
+     * The quarters arrive as separate restrict parameters so the compiler can
+     * prove they do not overlap and vectorize the loop.
+     */
+    static inline void lButterfly(float* __restrict ar, float* __restrict ai,
+                                  float* __restrict br, float* __restrict bi,
+                                  float* __restrict cr, float* __restrict ci,
+                                  float* __restrict dr, float* __restrict di,
+                                  const float* __restrict w1r, const float* __restrict w1i,
+                                  const float* __restrict w3r, const float* __restrict w3i,
+                                  unsigned int q) {
+        for (unsigned int j = 0; j < q; j++) {
+            float t1r = ar[j] - cr[j], t1i = ai[j] - ci[j];
+            float t2r = br[j] - dr[j], t2i = bi[j] - di[j];
+            ar[j] += cr[j];
+            ai[j] += ci[j];
+            br[j] += dr[j];
+            bi[j] += di[j];
+            // u = t1 − i·t2, v = t1 + i·t2
+            float ur = t1r + t2i, ui = t1i - t2r;
+            float vr = t1r - t2i, vi = t1i + t2r;
+            cr[j] = ur * w1r[j] - ui * w1i[j];
+            ci[j] = ur * w1i[j] + ui * w1r[j];
+            dr[j] = vr * w3r[j] - vi * w3i[j];
+            di[j] = vr * w3i[j] + vi * w3r[j];
+        }
+    }
+
+    /** 4-point DFT, output in bit-reversed order (X0, X2, X1, X3) */
+    static inline void dft4(float* xr, float* xi) {
+        float s0r = xr[0] + xr[2], s0i = xi[0] + xi[2];
+        float d0r = xr[0] - xr[2], d0i = xi[0] - xi[2];
+        float s1r = xr[1] + xr[3], s1i = xi[1] + xi[3];
+        float d1r = xr[1] - xr[3], d1i = xi[1] - xi[3];
+        xr[0] = s0r + s1r; xi[0] = s0i + s1i;
+        xr[1] = s0r - s1r; xi[1] = s0i - s1i;
+        // (d0 ∓ i·d1)
+        xr[2] = d0r + d1i; xi[2] = d0i - d1r;
+        xr[3] = d0r - d1i; xi[3] = d0i + d1r;
+    }
+
+    static inline void dft2(float* xr, float* xi) {
+        float r = xr[1], i = xi[1];
+        xr[1] = xr[0] - r; xi[1] = xi[0] - i;
+        xr[0] += r;        xi[0] += i;
+    }
+
+    unsigned int size_ = 0;
+    unsigned int half_ = 0;
+    unsigned int planLength_ = 0;
+
+    // Complex scratch (SoA)
+    alignas(64) float zRe_[MAX_HALF] = {};
+    alignas(64) float zIm_[MAX_HALF] = {};
+
+    // L-butterfly twiddles, indexed [q + j]
+    alignas(64) float tw1Re_[MAX_HALF / 2] = {};
+    alignas(64) float tw1Im_[MAX_HALF / 2] = {};
+    alignas(64) float tw3Re_[MAX_HALF / 2] = {};
+    alignas(64) float tw3Im_[MAX_HALF / 2] = {};
+
+    // Real-FFT split twiddles
+    alignas(64) float splitTwRe_[MAX_HALF + 1] = {};
+    alignas(64) float splitTwIm_[MAX_HALF + 1] = {};
+
+    uint16_t bitRev_[MAX_HALF] = {};
+    Block plan_[MAX_HALF / 2] = {};
+};
+
 class SpectralOnsetDetector {
 public:
     // Maximum supported FFT size (2048 → supports hop sizes up to 512)
-    static constexpr int MAX_FFT_SIZE = 2048;
+    static constexpr int MAX_FFT_SIZE = SplitRadixRealFft::MAX_SIZE;
     static constexpr int MAX_SPECTRUM_SIZE = MAX_FFT_SIZE / 2 + 1;
 
     // Peak picker sliding window (7 frames: 1 pre + 1 current + 5 post)
@@ -88,6 +331,12 @@ public:
         if (fftSize_ > static_cast<unsigned int>(MAX_FFT_SIZE)) {
             fftSize_ = static_cast<unsigned int>(MAX_FFT_SIZE);
         }
+        if (fftSize_ < 8) {
+            fftSize_ = 8;
+        }
+        if (hopSize_ > fftSize_) {
+            hopSize_ = fftSize_;
+        }
 
         spectrumSize_ = fftSize_ / 2 + 1;
 
@@ -96,12 +345,7 @@ public:
             window_[i] = 0.5f * (1.0f - std::cos(2.0f * static_cast<float>(M_PI) * i / fftSize_));
         }
 
-        // Precompute twiddle factors for radix-2 FFT
-        for (unsigned int i = 0; i < fftSize_ / 2; i++) {
-            double angle = -2.0 * M_PI * i / fftSize_;
-            twiddleReal_[i] = static_cast<float>(std::cos(angle));
-            twiddleImag_[i] = static_cast<float>(std::sin(angle));
-        }
+        fft_.Init(fftSize_);
 
         // Configuration defaults (matching aubio specflux tuning)
         threshold_ = 0.3f;              // peak-picking threshold
@@ -134,7 +378,6 @@ public:
 
     void Reset() {
         accumPos_ = 0;
-        std::memset(accumBuf_, 0, sizeof(float) * hopSize_);
         std::memset(analysisBuf_, 0, sizeof(float) * fftSize_);
         std::memset(prevSpectrum_, 0, sizeof(float) * spectrumSize_);
         std::memset(whiteningPeaks_, 0, sizeof(float) * spectrumSize_);
@@ -171,22 +414,42 @@ public:
 
         outOnsetDetected = false;
 
-        // Convert interleaved int16 multichannel → mono float, accumulate
-        for (int i = 0; i < perChannelSamples; i++) {
-            float mono = 0.0f;
-            for (int ch = 0; ch < channelCount; ch++) {
-                mono += static_cast<float>(pcmData[i * channelCount + ch]);
+        // New hop samples land directly in the tail of the analysis window
+        float* tail = analysisBuf_ + (fftSize_ - hopSize_);
+        const float scale = 1.0f / (32768.0f * channelCount);
+
+        int i = 0;
+        while (i < perChannelSamples) {
+            // Convert as many samples as fit into the current hop in one run
+            int run = std::min(perChannelSamples - i, static_cast<int>(hopSize_) - accumPos_);
+            const int16_t* src = pcmData + i * channelCount;
+            float* dst = tail + accumPos_;
+            if (channelCount == 2) {
+                for (int s = 0; s < run; s++) {
+                    dst[s] = (static_cast<float>(src[2 * s]) + static_cast<float>(src[2 * s + 1])) * scale;
+                }
+            } else {
+                for (int s = 0; s < run; s++) {
+                    float mono = 0.0f;
+                    for (int ch = 0; ch < channelCount; ch++) {
+                        mono += static_cast<float>(src[s * channelCount + ch]);
+                    }
+                    dst[s] = mono * scale;
+                }
             }
-            mono /= (32768.0f * channelCount);
+            accumPos_ += run;
+            i += run;
 
-            accumBuf_[accumPos_] = mono;
-            accumPos_++;
-
-            // Full hop accumulated → run analysis
+            // Full hop accumulated → run analysis, then slide the window
             if (accumPos_ >= static_cast<int>(hopSize_)) {
                 bool onset = processHop();
                 if (onset) outOnsetDetected = true;
                 accumPos_ = 0;
+                if (fftSize_ > hopSize_) {
+                    std::memmove(analysisBuf_,
+                                 analysisBuf_ + hopSize_,
+                                 (fftSize_ - hopSize_) * sizeof(float));
+                }
             }
         }
 
@@ -225,98 +488,70 @@ private:
     // ====================================================================
 
     bool processHop() {
-        // ---- 1. Phase Vocoder: overlap-save STFT ----
-
-        // Slide the analysis buffer: keep (fftSize - hopSize) old samples,
-        // append hopSize new samples at the end
-        if (fftSize_ > hopSize_) {
-            std::memmove(analysisBuf_,
-                         analysisBuf_ + hopSize_,
-                         (fftSize_ - hopSize_) * sizeof(float));
-        }
-        std::memcpy(analysisBuf_ + (fftSize_ - hopSize_),
-                     accumBuf_,
-                     hopSize_ * sizeof(float));
+        // ---- 1. Windowed real FFT → SoA spectrum (re_, im_) ----
+        fft_.Forward(analysisBuf_, window_, re_, im_);
 
-        // Apply Hann window → fftReal; zero imaginary part
-        for (unsigned int i = 0; i < fftSize_; i++) {
-            fftReal_[i] = analysisBuf_[i] * window_[i];
-            fftImag_[i] = 0.0f;
-        }
-
-        // Zero-phase shift: rotate buffer by fftSize/2 so the window center
-        // is at index 0 (avoids phase discontinuity, matches aubio's fvec_shift)
-        {
-            unsigned int half = fftSize_ / 2;
-            for (unsigned int i = 0; i < half; i++) {
-                float tmp = fftReal_[i];
-                fftReal_[i] = fftReal_[i + half];
-                fftReal_[i + half] = tmp;
-            }
-        }
-
-        // ---- 2. FFT (Radix-2 Cooley-Tukey) ----
-        fft(fftReal_, fftImag_, fftSize_);
-
-        // ---- 3. Compute magnitude spectrum ----
-        float spectrum[MAX_SPECTRUM_SIZE];
+        // ---- 2. Magnitude spectrum + level (vectorizable) ----
+        float* __restrict mag = mag_;
+        const float* __restrict re = re_;
+        const float* __restrict im = im_;
         float energySum = 0.0f;
-
         for (unsigned int i = 0; i < spectrumSize_; i++) {
-            spectrum[i] = std::sqrt(fftReal_[i] * fftReal_[i] +
-                                    fftImag_[i] * fftImag_[i]);
-            energySum += spectrum[i];
+            float m = std::sqrt(re[i] * re[i] + im[i] * im[i]);
+            mag[i] = m;
+            energySum += m;
         }
 
-        // ---- 4. Silence gate ----
+        // ---- 3. Silence gate ----
         // Use mean magnitude as a proxy for level
         float meanMag = energySum / spectrumSize_;
         if (meanMag < silenceThresholdLin_) {
             // Frame is silent — update state but don't produce onset
-            std::memcpy(prevSpectrum_, spectrum, sizeof(float) * spectrumSize_);
+            std::memcpy(prevSpectrum_, mag, sizeof(float) * spectrumSize_);
             framesSinceLastOnset_ += hopSize_;
             feedPicker(0.0f);
             firstFrame_ = false;
             return false;
         }
 
-        // ---- 5. Adaptive Whitening ----
+        // ---- 4. Adaptive Whitening ----
         // Per-bin exponential peak tracking: norm each bin by its peak.
-        // peak[i] = max(current[i], decay * prev_peak[i])
+        // peak[i] = max(current[i], decay * prev_peak[i], floor)
         // whitened[i] = norm[i] / peak[i]
         if (whiteningEnabled_) {
+            float* __restrict peaks = whiteningPeaks_;
+            const float decay = whiteningDecay_;
+            const float floorVal = whiteningFloor_;
             for (unsigned int i = 0; i < spectrumSize_; i++) {
-                float decayed = std::max(whiteningDecay_ * whiteningPeaks_[i],
-                                         whiteningFloor_);
-                whiteningPeaks_[i] = std::max(spectrum[i], decayed);
-                spectrum[i] /= whiteningPeaks_[i];
+                float p = std::max(mag[i], std::max(decay * peaks[i], floorVal));
+                peaks[i] = p;
+                mag[i] = mag[i] / p;
             }
         }
 
-        // ---- 6. Log compression: log(1 + λ·x) ----
+        // ---- 5. Log compression: log(1 + λ·x) ----
         if (compressionLambda_ > 0.0f) {
+            const float lambda = compressionLambda_;
             for (unsigned int i = 0; i < spectrumSize_; i++) {
-                spectrum[i] = std::log1p(compressionLambda_ * spectrum[i]);
+                mag[i] = fastLog1p(lambda * mag[i]);
             }
         }
 
-        // ---- 7. Spectral Flux (half-wave rectified) ----
+        // ---- 6. Spectral Flux (half-wave rectified) ----
         // Only accumulate positive differences (energy increases)
         float flux = 0.0f;
         if (!firstFrame_) {
+            const float* __restrict prev = prevSpectrum_;
             for (unsigned int i = 0; i < spectrumSize_; i++) {
-                float diff = spectrum[i] - prevSpectrum_[i];
-                if (diff > 0.0f) {
-                    flux += diff;
-                }
+                flux += std::max(mag[i] - prev[i], 0.0f);
             }
         }
 
         // Save current spectrum for next frame
-        std::memcpy(prevSpectrum_, spectrum, sizeof(float) * spectrumSize_);
+        std::memcpy(prevSpectrum_, mag, sizeof(float) * spectrumSize_);
         lastDescriptor_ = flux;
 
-        // ---- 8. Peak Picker (adaptive threshold + local max) ----
+        // ---- 7. Peak Picker (adaptive threshold + local max) ----
         bool isOnset = false;
         if (!firstFrame_) {
             isOnset = feedPicker(flux);
@@ -381,7 +616,7 @@ private:
             sorted[i] = pickerRing_[i];
             sum += pickerRing_[i];
         }
-        std::sort(sorted, sorted + PICKER_WIN_SIZE);
+        std::nth_element(sorted, sorted + PICKER_WIN_SIZE / 2, sorted + PICKER_WIN_SIZE);
         float median = sorted[PICKER_WIN_SIZE / 2];
         float mean = sum / PICKER_WIN_SIZE;
         float adaptiveThresh = median + mean * threshold_;
@@ -398,52 +633,24 @@ private:
         return false;
     }
 
-    // ====================================================================
-    //  Radix-2 Cooley-Tukey FFT (in-place, Decimation-In-Time)
-    // ====================================================================
-    //
-    //  Standard DIT FFT with precomputed twiddle factors.
-    //  Complexity: O(N log N), N ≤ 2048.
-    //  Uses pre-stored cos/sin tables to avoid recomputation.
-
-    void fft(float* real, float* imag, unsigned int n) {
-        // ---- Bit-reversal permutation ----
-        unsigned int j = 0;
-        for (unsigned int i = 0; i < n - 1; i++) {
-            if (i < j) {
-                std::swap(real[i], real[j]);
-                std::swap(imag[i], imag[j]);
-            }
-            unsigned int m = n >> 1;
-            while (m >= 1 && j >= m) {
-                j -= m;
-                m >>= 1;
-            }
-            j += m;
-        }
-
-        // ---- Butterfly stages ----
-        for (unsigned int stage = 1; stage < n; stage <<= 1) {
-            unsigned int twiddleStep = n / (stage << 1);
-            for (unsigned int group = 0; group < n; group += stage << 1) {
-                for (unsigned int pair = 0; pair < stage; pair++) {
-                    unsigned int twiddleIdx = pair * twiddleStep;
-                    float wr = twiddleReal_[twiddleIdx];
-                    float wi = twiddleImag_[twiddleIdx];
-
-                    unsigned int idx0 = group + pair;
-                    unsigned int idx1 = idx0 + stage;
-
-                    float tr = wr * real[idx1] - wi * imag[idx1];
-                    float ti = wr * imag[idx1] + wi * real[idx1];
-
-                    real[idx1] = real[idx0] - tr;
-                    imag[idx1] = imag[idx0] - ti;
-                    real[idx0] = real[idx0] + tr;
-                    imag[idx0] = imag[idx0] + ti;
-                }
-            }
-        }
+    /**
+     * log(1 + x) for x ≥ 0 without libm calls or branches, so the per-bin
+     * loop vectorizes. Exponent/mantissa split + atanh series on the
+     * mantissa; absolute error < 2e-6 over the whitened range.
+     */
+    static inline float fastLog1p(float x) {
+        float y = 1.0f + x;
+        int32_t bits;
+        std::memcpy(&bits, &y, sizeof(bits));
+        float e = static_cast<float>((bits >> 23) - 127);
+        bits = (bits & 0x007FFFFF) | 0x3F800000;
+        float mant;
+        std::memcpy(&mant, &bits, sizeof(mant));
+        // log(m) = 2·atanh((m−1)/(m+1)), m ∈ [1, 2) → t ∈ [0, 1/3)
+        float t = (mant - 1.0f) / (mant + 1.0f);
+        float t2 = t * t;
+        float poly = 1.0f + t2 * (1.0f / 3.0f + t2 * (1.0f / 5.0f + t2 * (1.0f / 7.0f + t2 * (1.0f / 9.0f))));
+        return e * 0.69314718f + 2.0f * t * poly;
     }
 
     // ====================================================================
@@ -471,28 +678,26 @@ private:
     float compressionLambda_ = 1.0f;    // log(1 + λ·x) coefficient
 
     // Hann window (precomputed)
-    float window_[MAX_FFT_SIZE] = {};
-
-    // Twiddle factors for FFT (precomputed cos/sin)
-    float twiddleReal_[MAX_FFT_SIZE / 2] = {};
-    float twiddleImag_[MAX_FFT_SIZE / 2] = {};
+    alignas(64) float window_[MAX_FFT_SIZE] = {};
 
-    // Analysis buffer (overlap-save: holds last fftSize samples)
-    float analysisBuf_[MAX_FFT_SIZE] = {};
-
-    // Accumulation buffer (incoming hop samples before full hop)
-    float accumBuf_[MAX_FFT_SIZE] = {};  // Only hopSize_ elements used
+    // Analysis buffer (overlap-save: holds last fftSize samples,
+    // incoming hop samples are written into its tail)
+    alignas(64) float analysisBuf_[MAX_FFT_SIZE] = {};
     int accumPos_ = 0;
 
-    // FFT scratch buffers (reused each hop, avoids stack allocation)
-    float fftReal_[MAX_FFT_SIZE] = {};
-    float fftImag_[MAX_FFT_SIZE] = {};
+    // Windowed real FFT (split-radix core + twiddle tables)
+    SplitRadixRealFft fft_;
+
+    // Real-signal spectrum (SoA) + magnitude
+    alignas(64) float re_[MAX_SPECTRUM_SIZE] = {};
+    alignas(64) float im_[MAX_SPECTRUM_SIZE] = {};
+    alignas(64) float mag_[MAX_SPECTRUM_SIZE] = {};
 
-    // Previous frame magnitude spectrum (for spectral flux)
-    float prevSpectrum_[MAX_SPECTRUM_SIZE] = {};
+    // Previous frame compressed magnitude (for spectral flux)
+    alignas(64) float prevSpectrum_[MAX_SPECTRUM_SIZE] = {};
 
     // Whitening: per-bin peak tracking
-    float whiteningPeaks_[MAX_SPECTRUM_SIZE] = {};
+    alignas(64) float whiteningPeaks_[MAX_SPECTRUM_SIZE] = {};
 
     // Peak picker ring buffer
     float pickerRing_[PICKER_WIN_SIZE] = {};
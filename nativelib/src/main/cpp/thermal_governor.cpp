@@ -0,0 +1,371 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file thermal_governor.cpp
+ * @brief 温控 / 功耗预算调度器实现
+ */
+
+#include "thermal_governor.h"
+#include "callbacks.h"
+#include "opus_libopus.h"
+#include "video_decoder.h"
+#include "usb_ddk_poller.h"
+#include <hilog/log.h>
+#include <qos/qos.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#undef LOG_TAG
+#define LOG_TAG "ThermalGov"
+
+namespace {
+    constexpr int SAMPLE_INTERVAL_MS = 1000;
+    constexpr int STEP_UP_SAMPLES = 3;          // 高压持续 3s 升一级（给上一级措施生效时间）
+    constexpr int STEP_DOWN_SAMPLES = 20;       // 低压持续 20s 降一级（避免来回震荡）
+
+    // 温度（所有 thermal zone 最高值，毫摄氏度）
+    constexpr int TEMP_HOT_MILLIC = 75000;
+    constexpr int TEMP_CRITICAL_MILLIC = 88000;
+    constexpr int TEMP_COOL_MILLIC = 68000;
+    // 大核限频比例（‰）
+    constexpr int FREQ_CAP_HOT_PERMILLE = 850;
+    constexpr int FREQ_CAP_COOL_PERMILLE = 950;
+    // 视频解码耗时 / 帧间隔
+    constexpr double DECODE_LOAD_HOT = 0.75;
+    constexpr double DECODE_LOAD_CRITICAL = 1.0;
+    constexpr double DECODE_LOAD_COOL = 0.5;
+    // AudioRecv 单包耗时 / 音频帧长
+    constexpr double AUDIO_LOAD_HOT = 0.4;
+    constexpr double AUDIO_LOAD_COOL = 0.2;
+
+    constexpr int MAX_THERMAL_ZONES = 32;
+    constexpr int MAX_CPUS = 16;
+    // Opus 解码始终输出 48kHz
+    constexpr int OPUS_SAMPLE_RATE = 48000;
+    // POLLING 等级下 DDK 轮询间隔下限（250Hz）
+    constexpr uint32_t POLLING_MIN_INTERVAL_US = 4000;
+    // SPIN 等级下同步解码循环空转等待倍数
+    constexpr int SPIN_IDLE_BACKOFF = 2;
+
+    // 配置（JS 线程写，Start 时读取）
+    std::mutex g_configMutex;
+    bool g_enabled = true;
+    std::string g_sysfsRoot;
+
+    // 采样线程
+    std::thread g_thread;
+    std::mutex g_wakeMutex;
+    std::condition_variable g_wakeCond;
+    std::atomic<bool> g_running{false};
+    int g_fps = 60;
+
+    // 统计（采样线程写，JS 线程读）
+    std::mutex g_statsMutex;
+    ThermalGovernorStats g_stats = {};
+
+    const char* const LEVEL_NAMES[] = { "none", "analysis", "opus", "polling", "spin" };
+
+    long ReadLong(const std::string& path) {
+        std::ifstream ifs(path);
+        long value = -1;
+        if (!(ifs >> value)) {
+            return -1;
+        }
+        return value;
+    }
+
+    /**
+     * 把各等级对应的措施交给所属子系统（全部幂等）
+     */
+    void ApplyLevel(int level) {
+        Callbacks_SetOnsetSuspended(level >= THERMAL_LEVEL_ANALYSIS);
+        MoonlightOpusDecoder::SetReducedComplexity(level >= THERMAL_LEVEL_OPUS);
+        UsbDdkPoller_SetMinPollIntervalUs(level >= THERMAL_LEVEL_POLLING ? POLLING_MIN_INTERVAL_US : 0);
+        VideoDecoderInstance::SetSyncIdleBackoff(level >= THERMAL_LEVEL_SPIN ? SPIN_IDLE_BACKOFF : 1);
+        Callbacks_SetAudioBigCoreRelease(level >= THERMAL_LEVEL_SPIN);
+    }
+
+    double SampleDecodeLoad() {
+        if (g_fps <= 0) {
+            return -1.0;
+        }
+        VideoDecoderStats video = VideoDecoderInstance::GetStats();
+        if (video.decodedFrames == 0) {
+            return -1.0;
+        }
+        return video.averageDecodeTimeMs / (1000.0 / g_fps);
+    }
+
+    /**
+     * 采样窗口内 AudioRecv 单包平均耗时 / 帧长（累计统计做差分）
+     */
+    double SampleAudioLoad(uint64_t& prevPackets, double& prevTotalUs) {
+        AudioRecvStats audio;
+        Callbacks_GetAudioRecvStats(&audio);
+        double totalUs = audio.avgPacketUs * audio.packets;
+        uint64_t packets = audio.packets;
+        double load = -1.0;
+        int samplesPerFrame = MoonlightOpusDecoder::GetSamplesPerFrame();
+        if (packets > prevPackets && packets - prevPackets >= 10 && samplesPerFrame > 0) {
+            double avgUs = (totalUs - prevTotalUs) / static_cast<double>(packets - prevPackets);
+            double frameUs = samplesPerFrame * 1000000.0 / OPUS_SAMPLE_RATE;
+            load = avgUs / frameUs;
+        }
+        prevPackets = packets;
+        prevTotalUs = totalUs;
+        return load;
+    }
+
+    void GovernorLoop(std::string root) {
+        pthread_setname_np(pthread_self(), "ThermalGov");
+        OH_QoS_SetThreadQoS(QOS_BACKGROUND);
+
+        ThermalPolicyState state = { THERMAL_LEVEL_NONE, 0, 0 };
+        uint64_t prevPackets = 0;
+        double prevTotalUs = 0.0;
+        char reason[96];
+
+        while (g_running.load(std::memory_order_acquire)) {
+            {
+                std::unique_lock<std::mutex> lock(g_wakeMutex);
+                g_wakeCond.wait_for(lock, std::chrono::milliseconds(SAMPLE_INTERVAL_MS),
+                                    [] { return !g_running.load(std::memory_order_acquire); });
+            }
+            if (!g_running.load(std::memory_order_acquire)) {
+                break;
+            }
+
+            ThermalSample sample = ThermalGovernor::ReadSysfs(root.c_str());
+            sample.decodeLoad = SampleDecodeLoad();
+            sample.audioLoad = SampleAudioLoad(prevPackets, prevTotalUs);
+
+            int prevLevel = state.level;
+            reason[0] = '\0';
+            int level = ThermalGovernor::Evaluate(sample, state, reason, sizeof(reason));
+            if (level != prevLevel) {
+                ApplyLevel(level);
+                OH_LOG_INFO(LOG_APP, "Thermal governor: %{public}s -> %{public}s (%{public}s) "
+                            "temp=%{public}d mC cap=%{public}d%% cur=%{public}d%% decode=%{public}.2f audio=%{public}.2f",
+                            ThermalGovernor::LevelName(prevLevel), ThermalGovernor::LevelName(level), reason,
+                            sample.tempMilliC, sample.freqCapPermille / 10, sample.freqCurPermille / 10,
+                            sample.decodeLoad, sample.audioLoad);
+            }
+
+            std::lock_guard<std::mutex> lock(g_statsMutex);
+            g_stats.level = level;
+            g_stats.lastSample = sample;
+            g_stats.samples++;
+            if (level > prevLevel) {
+                g_stats.stepUps++;
+            } else if (level < prevLevel) {
+                g_stats.stepDowns++;
+            }
+            if (level > g_stats.maxLevel) {
+                g_stats.maxLevel = level;
+            }
+            if (level != prevLevel) {
+                snprintf(g_stats.lastReason, sizeof(g_stats.lastReason), "%s", reason);
+            }
+        }
+    }
+}
+
+namespace ThermalGovernor {
+
+void SetConfig(bool enabled, const char* sysfsRoot) {
+    std::lock_guard<std::mutex> lock(g_configMutex);
+    g_enabled = enabled;
+    g_sysfsRoot = (sysfsRoot != nullptr) ? sysfsRoot : "";
+    OH_LOG_INFO(LOG_APP, "Thermal governor: enabled=%{public}d sysfsRoot='%{public}s'",
+                enabled ? 1 : 0, g_sysfsRoot.c_str());
+}
+
+void Start(int fps) {
+    Stop();
+
+    std::string root;
+    {
+        std::lock_guard<std::mutex> lock(g_configMutex);
+        if (!g_enabled) {
+            return;
+        }
+        root = g_sysfsRoot;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(g_statsMutex);
+        g_stats = {};
+        g_stats.enabled = true;
+        g_stats.running = true;
+        g_stats.lastSample = { -1, -1, -1, -1.0, -1.0 };
+    }
+
+    g_fps = fps;
+    g_running.store(true, std::memory_order_release);
+    g_thread = std::thread(GovernorLoop, root);
+    OH_LOG_INFO(LOG_APP, "Thermal governor started (fps=%{public}d)", fps);
+}
+
+void Stop() {
+    if (!g_thread.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_wakeMutex);
+        g_running.store(false, std::memory_order_release);
+    }
+    g_wakeCond.notify_all();
+    g_thread.join();
+
+    // 恢复全速，下次串流从 NONE 开始
+    ApplyLevel(THERMAL_LEVEL_NONE);
+    std::lock_guard<std::mutex> lock(g_statsMutex);
+    g_stats.running = false;
+    OH_LOG_INFO(LOG_APP, "Thermal governor stopped (maxLevel=%{public}s, up=%{public}llu, down=%{public}llu)",
+                LevelName(g_stats.maxLevel), static_cast<unsigned long long>(g_stats.stepUps),
+                static_cast<unsigned long long>(g_stats.stepDowns));
+}
+
+ThermalSample ReadSysfs(const char* sysfsRoot) {
+    const std::string root = (sysfsRoot != nullptr) ? sysfsRoot : "";
+    ThermalSample sample = { -1, -1, -1, -1.0, -1.0 };
+    char path[128];
+
+    // 各 thermal zone 最高温度；部分设备以 ℃ 而非 m℃ 上报
+    for (int zone = 0; zone < MAX_THERMAL_ZONES; zone++) {
+        snprintf(path, sizeof(path), "/sys/class/thermal/thermal_zone%d/temp", zone);
+        long temp = ReadLong(root + path);
+        if (temp <= 0) {
+            continue;
+        }
+        if (temp <= 200) {
+            temp *= 1000;
+        }
+        if (temp < 200000 && temp > sample.tempMilliC) {
+            sample.tempMilliC = static_cast<int>(temp);
+        }
+    }
+
+    // 大核 = cpuinfo_max_freq 最高的核心
+    int bigCpu = -1;
+    long bigMaxFreq = 0;
+    for (int cpu = 0; cpu < MAX_CPUS; cpu++) {
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cpufreq/cpuinfo_max_freq", cpu);
+        long freq = ReadLong(root + path);
+        if (freq > bigMaxFreq) {
+            bigMaxFreq = freq;
+            bigCpu = cpu;
+        }
+    }
+    if (bigCpu >= 0) {
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_max_freq", bigCpu);
+        long capFreq = ReadLong(root + path);
+        if (capFreq > 0) {
+            sample.freqCapPermille = static_cast<int>(capFreq * 1000 / bigMaxFreq);
+        }
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_cur_freq", bigCpu);
+        long curFreq = ReadLong(root + path);
+        if (curFreq > 0) {
+            sample.freqCurPermille = static_cast<int>(curFreq * 1000 / bigMaxFreq);
+        }
+    }
+    return sample;
+}
+
+int Evaluate(const ThermalSample& sample, ThermalPolicyState& state, char* reason, int reasonSize) {
+    char why[64] = "";
+    bool critical = false;
+    bool hot = false;
+
+    // 依优先级记录第一条触发原因
+    if (sample.tempMilliC >= TEMP_CRITICAL_MILLIC) {
+        critical = true;
+        snprintf(why, sizeof(why), "temp %.1fC critical", sample.tempMilliC / 1000.0);
+    } else if (sample.decodeLoad >= DECODE_LOAD_CRITICAL) {
+        critical = true;
+        snprintf(why, sizeof(why), "decode load %.2f critical", sample.decodeLoad);
+    } else if (sample.tempMilliC >= TEMP_HOT_MILLIC) {
+        hot = true;
+        snprintf(why, sizeof(why), "temp %.1fC", sample.tempMilliC / 1000.0);
+    } else if (sample.freqCapPermille >= 0 && sample.freqCapPermille <= FREQ_CAP_HOT_PERMILLE) {
+        hot = true;
+        snprintf(why, sizeof(why), "big core capped at %d%%", sample.freqCapPermille / 10);
+    } else if (sample.decodeLoad >= DECODE_LOAD_HOT) {
+        hot = true;
+        snprintf(why, sizeof(why), "decode load %.2f", sample.decodeLoad);
+    } else if (sample.audioLoad >= AUDIO_LOAD_HOT) {
+        hot = true;
+        snprintf(why, sizeof(why), "audio load %.2f", sample.audioLoad);
+    }
+
+    // 低压：所有可读指标都低于回落阈值
+    bool cool = !critical && !hot
+        && sample.tempMilliC < TEMP_COOL_MILLIC
+        && (sample.freqCapPermille < 0 || sample.freqCapPermille >= FREQ_CAP_COOL_PERMILLE)
+        && sample.decodeLoad < DECODE_LOAD_COOL
+        && sample.audioLoad < AUDIO_LOAD_COOL;
+
+    if (critical || hot) {
+        state.coolSamples = 0;
+        state.hotSamples++;
+        if (state.level < THERMAL_LEVEL_MAX && (critical || state.hotSamples >= STEP_UP_SAMPLES)) {
+            state.level++;
+            state.hotSamples = 0;
+            if (reason != nullptr && reasonSize > 0) {
+                snprintf(reason, reasonSize, "%s", why);
+            }
+        }
+    } else if (cool) {
+        state.hotSamples = 0;
+        state.coolSamples++;
+        if (state.level > THERMAL_LEVEL_NONE && state.coolSamples >= STEP_DOWN_SAMPLES) {
+            state.level--;
+            state.coolSamples = 0;
+            if (reason != nullptr && reasonSize > 0) {
+                snprintf(reason, reasonSize, "cool for %ds", STEP_DOWN_SAMPLES * SAMPLE_INTERVAL_MS / 1000);
+            }
+        }
+    } else {
+        // 介于两者之间：保持当前等级
+        state.hotSamples = 0;
+        state.coolSamples = 0;
+    }
+    return state.level;
+}
+
+const char* LevelName(int level) {
+    if (level < THERMAL_LEVEL_NONE || level > THERMAL_LEVEL_MAX) {
+        return "unknown";
+    }
+    return LEVEL_NAMES[level];
+}
+
+ThermalGovernorStats GetStats() {
+    ThermalGovernorStats stats;
+    {
+        std::lock_guard<std::mutex> lock(g_statsMutex);
+        stats = g_stats;
+    }
+    std::lock_guard<std::mutex> lock(g_configMutex);
+    stats.enabled = g_enabled;
+    return stats;
+}
+
+} // namespace ThermalGovernor
@@ -0,0 +1,130 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file thermal_governor.h
+ * @brief 温控 / 功耗预算调度器
+ *
+ * 长时间高帧率串流时设备会温控降频，视频解码耗时随之上升。各 native 子系统
+ * 默认全速运行，这里统一按预算逐级关闭可选负载，保证视频解码最后才受影响。
+ *
+ * 输入（每 SAMPLE_INTERVAL_MS 采样一次）：
+ *   - /sys/class/thermal/thermal_zone*\/temp 中的最高温度
+ *   - 大核 cpufreq：scaling_max_freq / cpuinfo_max_freq（温控限频比例）
+ *   - 视频平均解码耗时 / 帧间隔
+ *   - AudioRecv 单包平均耗时 / 音频帧长（采样窗口内）
+ *
+ * 降载等级（累进，高等级包含低等级的全部措施）：
+ *   1 ANALYSIS  关闭 onset 频谱分析（音乐模式退回能量检测）
+ *   2 OPUS      Opus 解码复杂度 7 → 5（保留 Deep PLC，关闭 NoLACE 增强）
+ *   3 POLLING   USB DDK 轮询限速到 POLLING_MIN_INTERVAL_US
+ *   4 SPIN      同步解码循环空转等待加倍，AudioRecv 线程解除大核绑定
+ * 视频解码本身（QoS、大核绑定、超时）不在调度范围内。
+ *
+ * 决策：高压持续 STEP_UP_SAMPLES 次升一级（临界时立即升级），
+ * 低压持续 STEP_DOWN_SAMPLES 次降一级，介于两者之间保持不变；每次变更写日志。
+ *
+ * 测试：SetConfig 的 sysfsRoot 为所有 sysfs 路径加前缀，可指向应用沙箱内
+ * 按相同目录结构伪造的文件（如 <root>/sys/class/thermal/thermal_zone0/temp）。
+ * 决策逻辑 Evaluate() 为纯函数，不依赖采样线程。
+ *
+ * 线程模型：采样与决策在独立的后台线程（QoS BACKGROUND），各措施通过原子量
+ * 交给所属线程在下一次循环时生效；配置/统计在 JS 线程。
+ */
+
+#ifndef THERMAL_GOVERNOR_H
+#define THERMAL_GOVERNOR_H
+
+#include <cstdint>
+
+/**
+ * 降载等级
+ */
+enum ThermalLevel {
+    THERMAL_LEVEL_NONE = 0,
+    THERMAL_LEVEL_ANALYSIS = 1,
+    THERMAL_LEVEL_OPUS = 2,
+    THERMAL_LEVEL_POLLING = 3,
+    THERMAL_LEVEL_SPIN = 4,
+    THERMAL_LEVEL_MAX = THERMAL_LEVEL_SPIN
+};
+
+/**
+ * 一次采样（不可读的项为 -1）
+ */
+struct ThermalSample {
+    int tempMilliC;         // 最高温度（毫摄氏度）
+    int freqCapPermille;    // 大核 scaling_max_freq / cpuinfo_max_freq（‰）
+    int freqCurPermille;    // 大核 scaling_cur_freq / cpuinfo_max_freq（‰）
+    double decodeLoad;      // 视频平均解码耗时 / 帧间隔
+    double audioLoad;       // AudioRecv 单包平均耗时 / 音频帧长
+};
+
+/**
+ * 调度器状态（Evaluate 的输入/输出，不含统计）
+ */
+struct ThermalPolicyState {
+    int level;
+    int hotSamples;         // 连续高压采样数
+    int coolSamples;        // 连续低压采样数
+};
+
+/**
+ * 调度器统计
+ */
+struct ThermalGovernorStats {
+    bool enabled;
+    bool running;
+    int level;
+    int maxLevel;               // 本次串流达到的最高等级
+    ThermalSample lastSample;
+    uint64_t samples;
+    uint64_t stepUps;
+    uint64_t stepDowns;
+    char lastReason[96];        // 最近一次变更原因
+};
+
+namespace ThermalGovernor {
+    /**
+     * 设置调度参数（串流开始前调用，下次 Start 生效）
+     * @param enabled 关闭时不启动采样线程，各子系统保持全速
+     * @param sysfsRoot sysfs 路径前缀，nullptr / 空串表示真实 sysfs
+     */
+    void SetConfig(bool enabled, const char* sysfsRoot);
+
+    /**
+     * 串流开始（BridgeDrStart）：启动采样线程
+     * @param fps 视频帧率（决定帧间隔）
+     */
+    void Start(int fps);
+
+    /**
+     * 串流结束（BridgeDrStop）：停止线程并恢复全部措施
+     */
+    void Stop();
+
+    /**
+     * 读取一次 sysfs（decodeLoad / audioLoad 由调用方填写）
+     */
+    ThermalSample ReadSysfs(const char* sysfsRoot);
+
+    /**
+     * 决策：根据采样更新状态
+     * @param reason 变更时写入原因（可为 nullptr）
+     * @return 新等级
+     */
+    int Evaluate(const ThermalSample& sample, ThermalPolicyState& state, char* reason, int reasonSize);
+
+    const char* LevelName(int level);
+
+    ThermalGovernorStats GetStats();
+}
+
+#endif // THERMAL_GOVERNOR_H
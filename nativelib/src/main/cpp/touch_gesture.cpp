@@ -0,0 +1,1019 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file touch_gesture.cpp
+ * @brief Native 触摸手势引擎实现（状态机与 TouchInputHandler.ets 一一对应）
+ */
+
+#include "touch_gesture.h"
+#include "input_scheduler.h"
+#include "latency_histogram.h"
+
+#include <math.h>
+#include <string.h>
+#include <time.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <hilog/log.h>
+
+#include "moonlight-common-c/src/Limelight.h"
+
+#define LOG_TAG "TouchGesture"
+
+#define GESTURE_MAX_POINTERS 10
+#define GESTURE_MAX_TOUCHES 32
+#define GESTURE_MAX_HISTORY 1024
+
+static const uint64_t NS_PER_MS = 1000000ULL;
+
+// 触控板双指手势
+static const uint64_t TWO_FINGER_TAP_THRESHOLD_NS = 250 * NS_PER_MS;
+static const float TWO_FINGER_MOVE_THRESHOLD = 30.0f;
+static const float SCROLL_SPEED_FACTOR = 5.0f;
+static const uint64_t CLICK_HOLD_NS = 50 * NS_PER_MS;
+
+// 鼠标模式（与 Android AbsoluteTouchContext 一致）
+static const uint64_t MOUSE_LONG_PRESS_TIME_NS = 650 * NS_PER_MS;
+static const float MOUSE_LONG_PRESS_DISTANCE = 30.0f;
+static const uint64_t MOUSE_DEADZONE_TIME_NS = 100 * NS_PER_MS;
+static const float MOUSE_DEADZONE_DISTANCE = 20.0f;
+static const uint64_t MOUSE_DOUBLE_TAP_TIME_NS = 250 * NS_PER_MS;
+static const float MOUSE_DOUBLE_TAP_DISTANCE = 60.0f;
+static const float MOUSE_SCROLL_SPEED_FACTOR = 3.0f;
+static const uint64_t MOUSE_QUICK_TAP_HOLD_NS = 100 * NS_PER_MS;
+
+// 直接触摸
+static const float FORCE_MAX = 65535.0f;
+static const float DEFAULT_FORCE = 1.0f;
+static const float DEFAULT_CONTACT_SIZE = 0.05f;
+static const uint64_t HISTORY_MAX_AGE_NS = 100 * NS_PER_MS;
+
+// 事件时间戳合理范围（超出视为时钟不一致，不计入延迟）
+static const uint64_t MAX_EVENT_AGE_NS = 1000 * NS_PER_MS;
+
+// 识别延迟直方图：50µs 桶，覆盖 0-100ms
+static const uint32_t LATENCY_BUCKET_US = 50;
+
+/**
+ * 定时器（0 = 未启动）
+ */
+enum GestureTimer {
+    TIMER_MOUSE_TAP_DOWN = 0,   // 死区到期确认点击
+    TIMER_MOUSE_LONG_PRESS,     // 长按切换为右键
+    TIMER_RELEASE_LEFT,         // 轻触后延迟释放左键
+    TIMER_RELEASE_RIGHT,        // 轻触后延迟释放右键
+    TIMER_COUNT
+};
+
+struct TouchPointState {
+    bool used;
+    int32_t id;
+    float startX, startY;
+    float lastX, lastY;
+    uint64_t startNs;
+    float force;            // 历史采样点追踪的最后压力（DIRECT）
+    float size;             // 历史采样点追踪的最后接触面积（DIRECT）
+};
+
+/**
+ * 解码后的 TouchEvent（指向 submit 的 Float64Array，不复制）
+ */
+struct TouchEventView {
+    int type;
+    float areaWidth, areaHeight;
+    uint64_t timestampNs;
+    uint32_t touchCount, changedCount, historyCount;
+    const double *touches;
+    const double *changed;
+    const double *history;
+};
+
+struct TouchSample {
+    int32_t id;
+    float x, y;
+};
+
+static std::mutex g_gestureMutex;
+static std::condition_variable g_timerCv;
+static std::thread g_timerThread;
+static uint64_t g_timerGeneration = 0;    // 每次停止递增，定时线程只在启动时的代次内运行
+static uint64_t g_timers[TIMER_COUNT];
+
+// 配置（g_gestureMutex 保护）
+static int g_mode = TOUCH_GESTURE_MODE_TRACKPAD;
+static float g_sensitivity = 1.5f;
+static float g_clickThreshold = 20.0f;
+static uint64_t g_clickTimeThresholdNs = 300 * NS_PER_MS;
+
+static TouchPointState g_points[GESTURE_MAX_POINTERS];
+
+// 触控板状态
+static int g_activePointerCount = 0;
+static int g_maxPointerCountInGesture = 0;
+static uint64_t g_twoFingerDownNs = 0;
+static uint64_t g_firstFingerUpNs = 0;
+static bool g_twoFingerTapPending = false;
+static bool g_twoFingerMoved = false;
+static float g_twoFingerStartX = 0, g_twoFingerStartY = 0;
+static bool g_confirmedScroll = false;
+static float g_moveResidualX = 0, g_moveResidualY = 0;   // 灵敏度缩放后不足 1px 的余量
+
+// 鼠标模式状态
+static float g_mouseDownX = 0, g_mouseDownY = 0;
+static uint64_t g_mouseDownNs = 0;
+static float g_mouseLastUpX = 0, g_mouseLastUpY = 0;
+static uint64_t g_mouseLastUpNs = 0;
+static bool g_mouseCancelled = false;
+static bool g_mouseConfirmedTap = false;
+static bool g_mouseConfirmedLongPress = false;
+static int32_t g_mousePrimaryId = -1;
+static int32_t g_mouseSecondId = -1;
+static float g_mouseSecondLastY = 0;
+static float g_mouseAreaWidth = 0, g_mouseAreaHeight = 0;
+
+// 本次 submit 的事件时间戳（首个输出时计入延迟后清零）
+static uint64_t g_pendingEventTsNs = 0;
+static int g_submitOutputs = 0;
+
+// 统计
+static std::atomic<uint64_t> g_eventsIn{0};
+static std::atomic<uint64_t> g_pointsIn{0};
+static std::atomic<uint64_t> g_touchEventsSent{0};
+static std::atomic<uint64_t> g_mouseMovesSent{0};
+static std::atomic<uint64_t> g_buttonsSent{0};
+static std::atomic<uint64_t> g_scrollsSent{0};
+static std::atomic<uint64_t> g_taps{0};
+static std::atomic<uint64_t> g_rightTaps{0};
+static std::atomic<uint64_t> g_latencySamples{0};
+static std::atomic<uint64_t> g_latencyTotalNs{0};
+static std::atomic<uint64_t> g_processTotalNs{0};
+static LatencyHistogram<2000> g_latencyHist;
+
+// ============================================================
+// 工具
+// ============================================================
+
+static uint64_t clockNs(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t monotonicNs() {
+    return clockNs(CLOCK_MONOTONIC);
+}
+
+/**
+ * TouchEvent.timestamp 的时钟域因版本而异：依次按 MONOTONIC / BOOTTIME 解释，取落在合理范围内的一个
+ * @return 事件年龄 (ns)，无法判定时返回 UINT64_MAX
+ */
+static uint64_t eventAgeNs(uint64_t timestampNs, uint64_t nowMonoNs) {
+    if (timestampNs == 0) return UINT64_MAX;
+    if (nowMonoNs >= timestampNs && nowMonoNs - timestampNs <= MAX_EVENT_AGE_NS) {
+        return nowMonoNs - timestampNs;
+    }
+    uint64_t nowBoot = clockNs(CLOCK_BOOTTIME);
+    if (nowBoot >= timestampNs && nowBoot - timestampNs <= MAX_EVENT_AGE_NS) {
+        return nowBoot - timestampNs;
+    }
+    return UINT64_MAX;
+}
+
+static short clampShort(int v) {
+    if (v > 32767) return 32767;
+    if (v < -32768) return -32768;
+    return (short)v;
+}
+
+static float clampUnit(float v) {
+    if (!(v > 0.0f)) return 0.0f;
+    return v > 1.0f ? 1.0f : v;
+}
+
+static bool distanceExceeds(float dx, float dy, float limit) {
+    return sqrtf(dx * dx + dy * dy) > limit;
+}
+
+static float normalizeForce(float force) {
+    if (force <= 0.0f) return 0.0f;
+    if (force > 1.0f) {
+        // 原始传感器值 [0, 65535)
+        return fminf(1.0f, force / FORCE_MAX);
+    }
+    return force;
+}
+
+static TouchPointState *findPointLocked(int32_t id) {
+    for (int i = 0; i < GESTURE_MAX_POINTERS; i++) {
+        if (g_points[i].used && g_points[i].id == id) return &g_points[i];
+    }
+    return nullptr;
+}
+
+static TouchPointState *addPointLocked(int32_t id, float x, float y, uint64_t now) {
+    TouchPointState *p = findPointLocked(id);
+    for (int i = 0; p == nullptr && i < GESTURE_MAX_POINTERS; i++) {
+        if (!g_points[i].used) p = &g_points[i];
+    }
+    if (p == nullptr) return nullptr;
+    p->used = true;
+    p->id = id;
+    p->startX = p->lastX = x;
+    p->startY = p->lastY = y;
+    p->startNs = now;
+    p->force = DEFAULT_FORCE;
+    p->size = DEFAULT_CONTACT_SIZE;
+    return p;
+}
+
+static void removePointLocked(int32_t id) {
+    TouchPointState *p = findPointLocked(id);
+    if (p) p->used = false;
+}
+
+static TouchSample sampleAt(const double *base, uint32_t index) {
+    const double *r = base + (size_t)index * TOUCH_GESTURE_POINT_STRIDE;
+    TouchSample s = { (int32_t)r[0], (float)r[1], (float)r[2] };
+    return s;
+}
+
+// ============================================================
+// 输出（调用方持有 g_gestureMutex）
+// ============================================================
+
+static void noteOutputLocked() {
+    g_submitOutputs++;
+    if (g_pendingEventTsNs == 0) return;
+    uint64_t age = eventAgeNs(g_pendingEventTsNs, monotonicNs());
+    g_pendingEventTsNs = 0;
+    if (age == UINT64_MAX) return;
+    g_latencySamples.fetch_add(1, std::memory_order_relaxed);
+    g_latencyTotalNs.fetch_add(age, std::memory_order_relaxed);
+    g_latencyHist.Record((uint32_t)(age / 1000ULL), LATENCY_BUCKET_US);
+}
+
+static void sendTouchLocked(uint8_t eventType, int32_t pointerId, float x, float y, float pressure, float size) {
+    LiSendTouchEvent(eventType, (uint32_t)pointerId, x, y, pressure, size, size, 0);
+    g_touchEventsSent.fetch_add(1, std::memory_order_relaxed);
+    noteOutputLocked();
+}
+
+static void sendMouseMoveLocked(int dx, int dy) {
+    InputScheduler_SendMouseMove(clampShort(dx), clampShort(dy));
+    g_mouseMovesSent.fetch_add(1, std::memory_order_relaxed);
+    noteOutputLocked();
+}
+
+static void sendScrollLocked(int amount) {
+    InputScheduler_SendHighResScroll(clampShort(amount));
+    g_scrollsSent.fetch_add(1, std::memory_order_relaxed);
+    noteOutputLocked();
+}
+
+static void sendButtonLocked(char action, int button) {
+    InputScheduler_SendMouseButton(action, button);
+    g_buttonsSent.fetch_add(1, std::memory_order_relaxed);
+    noteOutputLocked();
+}
+
+static void timerThreadLoop(uint64_t generation);
+
+static void armTimerLocked(int timer, uint64_t deadlineNs) {
+    g_timers[timer] = deadlineNs;
+    if (!g_timerThread.joinable()) {
+        g_timerThread = std::thread(timerThreadLoop, g_timerGeneration);
+    }
+    g_timerCv.notify_one();
+}
+
+static void cancelTimerLocked(int timer) {
+    g_timers[timer] = 0;
+}
+
+static int releaseTimerFor(int button) {
+    return button == BUTTON_RIGHT ? TIMER_RELEASE_RIGHT : TIMER_RELEASE_LEFT;
+}
+
+/**
+ * 按下前先补发尚未到期的延迟释放，避免连续轻触时按下 / 释放次序错乱
+ */
+static void pressButtonLocked(int button) {
+    int timer = releaseTimerFor(button);
+    if (g_timers[timer] != 0) {
+        cancelTimerLocked(timer);
+        sendButtonLocked(BUTTON_ACTION_RELEASE, button);
+    }
+    sendButtonLocked(BUTTON_ACTION_PRESS, button);
+}
+
+static void releaseButtonLocked(int button) {
+    cancelTimerLocked(releaseTimerFor(button));
+    sendButtonLocked(BUTTON_ACTION_RELEASE, button);
+}
+
+static void clickButtonLocked(int button, uint64_t holdNs, uint64_t now) {
+    pressButtonLocked(button);
+    armTimerLocked(releaseTimerFor(button), now + holdNs);
+}
+
+// ============================================================
+// DIRECT 模式：多点触控协议
+// ============================================================
+
+static float normalizedX(float x, float areaWidth) {
+    return areaWidth > 0.0f ? clampUnit(x / areaWidth) : 0.0f;
+}
+
+static float normalizedY(float y, float areaHeight) {
+    return areaHeight > 0.0f ? clampUnit(y / areaHeight) : 0.0f;
+}
+
+static void handleDirectLocked(const TouchEventView *ev, uint64_t now) {
+    switch (ev->type) {
+        case TOUCH_GESTURE_EVENT_DOWN:
+            for (uint32_t i = 0; i < ev->changedCount; i++) {
+                TouchSample t = sampleAt(ev->changed, i);
+                // DOWN 时尚无历史压力数据，使用默认值
+                if (!addPointLocked(t.id, t.x, t.y, now)) continue;
+                sendTouchLocked(LI_TOUCH_EVENT_DOWN, t.id, normalizedX(t.x, ev->areaWidth),
+                                normalizedY(t.y, ev->areaHeight), DEFAULT_FORCE, DEFAULT_CONTACT_SIZE);
+            }
+            break;
+
+        case TOUCH_GESTURE_EVENT_MOVE:
+            // 先发历史采样点（更高采样率，且带真实压力）
+            for (uint32_t i = 0; i < ev->historyCount; i++) {
+                const double *h = ev->history + (size_t)i * TOUCH_GESTURE_HISTORY_STRIDE;
+                uint64_t histTs = h[5] > 0 ? (uint64_t)h[5] : 0;
+                if (histTs != 0 && ev->timestampNs > histTs && ev->timestampNs - histTs > HISTORY_MAX_AGE_NS) {
+                    continue;
+                }
+                TouchPointState *p = findPointLocked((int32_t)h[0]);
+                if (!p) continue;
+                float force = (float)h[3];
+                float size = (float)h[4];
+                p->force = force > 0.0f ? normalizeForce(force) : p->force;
+                p->size = size > 0.0f ? size : p->size;
+                sendTouchLocked(LI_TOUCH_EVENT_MOVE, p->id, normalizedX((float)h[1], ev->areaWidth),
+                                normalizedY((float)h[2], ev->areaHeight), p->force, p->size);
+            }
+            // 再发当前触点（使用追踪的压力值）
+            for (uint32_t i = 0; i < ev->touchCount; i++) {
+                TouchSample t = sampleAt(ev->touches, i);
+                TouchPointState *p = findPointLocked(t.id);
+                if (!p) continue;
+                p->lastX = t.x;
+                p->lastY = t.y;
+                sendTouchLocked(LI_TOUCH_EVENT_MOVE, t.id, normalizedX(t.x, ev->areaWidth),
+                                normalizedY(t.y, ev->areaHeight), p->force, p->size);
+            }
+            break;
+
+        case TOUCH_GESTURE_EVENT_UP:
+        case TOUCH_GESTURE_EVENT_CANCEL:
+            for (uint32_t i = 0; i < ev->changedCount; i++) {
+                TouchSample t = sampleAt(ev->changed, i);
+                sendTouchLocked(LI_TOUCH_EVENT_UP, t.id, normalizedX(t.x, ev->areaWidth),
+                                normalizedY(t.y, ev->areaHeight), 0.0f, 0.0f);
+                removePointLocked(t.id);
+            }
+            break;
+    }
+}
+
+// ============================================================
+// TRACKPAD 模式：单指移动 / 轻触左键，双指轻触右键 / 滑动滚轮
+// ============================================================
+
+static void trackpadDownLocked(const TouchEventView *ev, uint64_t now) {
+    g_activePointerCount = (int)ev->touchCount;
+    if (g_activePointerCount > g_maxPointerCountInGesture) {
+        g_maxPointerCountInGesture = g_activePointerCount;
+    }
+
+    for (uint32_t i = 0; i < ev->changedCount; i++) {
+        TouchSample t = sampleAt(ev->changed, i);
+        addPointLocked(t.id, t.x, t.y, now);
+    }
+    if (g_maxPointerCountInGesture == 1) {
+        g_moveResidualX = 0;
+        g_moveResidualY = 0;
+    }
+
+    // 双指按下：记录起始信息，抬起时区分右键轻触与滚轮
+    if (ev->touchCount == 2) {
+        TouchSample first = sampleAt(ev->touches, 0);
+        g_twoFingerDownNs = now;
+        g_twoFingerStartX = first.x;
+        g_twoFingerStartY = first.y;
+        g_twoFingerMoved = false;
+        g_twoFingerTapPending = false;
+        g_confirmedScroll = false;
+    }
+}
+
+static void trackpadMoveLocked(const TouchEventView *ev) {
+    if (ev->touchCount == 1 && g_maxPointerCountInGesture == 1) {
+        TouchSample t = sampleAt(ev->touches, 0);
+        TouchPointState *p = findPointLocked(t.id);
+        if (!p) return;
+
+        float dx = (t.x - p->lastX) * g_sensitivity + g_moveResidualX;
+        float dy = (t.y - p->lastY) * g_sensitivity + g_moveResidualY;
+        p->lastX = t.x;
+        p->lastY = t.y;
+
+        int moveX = (int)floorf(dx);
+        int moveY = (int)floorf(dy);
+        g_moveResidualX = dx - (float)moveX;
+        g_moveResidualY = dy - (float)moveY;
+        if (moveX != 0 || moveY != 0) {
+            sendMouseMoveLocked(moveX, moveY);
+        }
+    } else if (ev->touchCount == 2) {
+        TouchSample first = sampleAt(ev->touches, 0);
+        TouchSample second = sampleAt(ev->touches, 1);
+        if (!g_twoFingerMoved &&
+            distanceExceeds(first.x - g_twoFingerStartX, first.y - g_twoFingerStartY, TWO_FINGER_MOVE_THRESHOLD)) {
+            g_twoFingerMoved = true;
+            g_confirmedScroll = true;
+        }
+
+        // 已确认滚轮：第一根手指的 Y 增量作为滚轮值
+        if (g_confirmedScroll) {
+            TouchPointState *p = findPointLocked(first.id);
+            if (p) {
+                float deltaY = first.y - p->lastY;
+                p->lastX = first.x;
+                p->lastY = first.y;
+                if (deltaY != 0.0f) {
+                    // 手指下滑 → 页面向下滚 → 负值
+                    sendScrollLocked((int)lrintf(-deltaY * SCROLL_SPEED_FACTOR));
+                }
+            }
+            TouchPointState *q = findPointLocked(second.id);
+            if (q) {
+                q->lastX = second.x;
+                q->lastY = second.y;
+            }
+        }
+    }
+}
+
+static void checkForClickLocked(const TouchSample *t, const TouchPointState *p, uint64_t now) {
+    float moveDistance = fabsf(t->x - p->startX) + fabsf(t->y - p->startY);
+    uint64_t duration = now - p->startNs;
+    if (moveDistance < g_clickThreshold && duration < g_clickTimeThresholdNs) {
+        g_taps.fetch_add(1, std::memory_order_relaxed);
+        clickButtonLocked(BUTTON_LEFT, CLICK_HOLD_NS, now);
+    }
+}
+
+static void removeChangedLocked(const TouchEventView *ev) {
+    for (uint32_t i = 0; i < ev->changedCount; i++) {
+        removePointLocked(sampleAt(ev->changed, i).id);
+    }
+}
+
+static void trackpadUpLocked(const TouchEventView *ev, uint64_t now) {
+    // Up 事件的 touches 不含正在抬起的手指，用已追踪的数量减去抬起数量
+    int remaining = g_activePointerCount - (int)ev->changedCount;
+    if (remaining < 0) remaining = 0;
+
+    // 情况A：2 指 → 1 指
+    if (g_activePointerCount == 2 && remaining == 1 && !g_twoFingerMoved) {
+        if (now - g_twoFingerDownNs < TWO_FINGER_TAP_THRESHOLD_NS) {
+            g_rightTaps.fetch_add(1, std::memory_order_relaxed);
+            clickButtonLocked(BUTTON_RIGHT, CLICK_HOLD_NS, now);
+            g_twoFingerTapPending = false;
+            g_twoFingerMoved = true;    // 防止重复触发
+            removeChangedLocked(ev);
+            g_activePointerCount = remaining;
+            return;
+        }
+        // 非快速轻触：等待最后一根手指抬起
+        g_firstFingerUpNs = now;
+        g_twoFingerTapPending = true;
+    }
+
+    // 情况B：最后一根手指抬起
+    if (remaining == 0) {
+        if (g_twoFingerTapPending && !g_twoFingerMoved && now - g_firstFingerUpNs < TWO_FINGER_TAP_THRESHOLD_NS) {
+            g_rightTaps.fetch_add(1, std::memory_order_relaxed);
+            clickButtonLocked(BUTTON_RIGHT, CLICK_HOLD_NS, now);
+            g_twoFingerTapPending = false;
+            removeChangedLocked(ev);
+            g_activePointerCount = 0;
+            g_maxPointerCountInGesture = 0;
+            return;
+        }
+        g_twoFingerTapPending = false;
+
+        if (g_maxPointerCountInGesture == 1) {
+            for (uint32_t i = 0; i < ev->changedCount; i++) {
+                TouchSample t = sampleAt(ev->changed, i);
+                TouchPointState *p = findPointLocked(t.id);
+                if (p) checkForClickLocked(&t, p, now);
+            }
+        }
+        g_maxPointerCountInGesture = 0;
+    }
+
+    removeChangedLocked(ev);
+    g_activePointerCount = remaining;
+}
+
+static void handleTrackpadLocked(const TouchEventView *ev, uint64_t now) {
+    switch (ev->type) {
+        case TOUCH_GESTURE_EVENT_DOWN:   trackpadDownLocked(ev, now); break;
+        case TOUCH_GESTURE_EVENT_MOVE:   trackpadMoveLocked(ev); break;
+        case TOUCH_GESTURE_EVENT_UP:
+        case TOUCH_GESTURE_EVENT_CANCEL: trackpadUpLocked(ev, now); break;
+    }
+}
+
+// ============================================================
+// MOUSE 模式：绝对定位 + 死区 + 长按右键 + 第二指滚轮
+// ============================================================
+
+static void mouseUpdatePositionLocked(float x, float y) {
+    float cx = fminf(fmaxf(x, 0.0f), g_mouseAreaWidth);
+    float cy = fminf(fmaxf(y, 0.0f), g_mouseAreaHeight);
+    InputScheduler_SendMousePosition((short)floorf(cx), (short)floorf(cy),
+                                     (short)floorf(g_mouseAreaWidth), (short)floorf(g_mouseAreaHeight));
+    g_mouseMovesSent.fetch_add(1, std::memory_order_relaxed);
+    noteOutputLocked();
+}
+
+/**
+ * 确认点击（死区时间 / 距离超过后）：定位 + 左键按下
+ */
+static void mouseTapConfirmedLocked() {
+    if (g_mouseConfirmedTap || g_mouseConfirmedLongPress) return;
+    g_mouseConfirmedTap = true;
+    cancelTimerLocked(TIMER_MOUSE_TAP_DOWN);
+
+    // 双击：本次按下离上次抬起很近时不重定位
+    if (g_mouseDownNs - g_mouseLastUpNs > MOUSE_DOUBLE_TAP_TIME_NS ||
+        distanceExceeds(g_mouseDownX - g_mouseLastUpX, g_mouseDownY - g_mouseLastUpY, MOUSE_DOUBLE_TAP_DISTANCE)) {
+        mouseUpdatePositionLocked(g_mouseDownX, g_mouseDownY);
+    }
+    g_taps.fetch_add(1, std::memory_order_relaxed);
+    pressButtonLocked(BUTTON_LEFT);
+}
+
+static void mouseLongPressLocked() {
+    cancelTimerLocked(TIMER_MOUSE_TAP_DOWN);
+    g_mouseConfirmedLongPress = true;
+    if (g_mouseConfirmedTap) {
+        releaseButtonLocked(BUTTON_LEFT);
+    }
+    g_rightTaps.fetch_add(1, std::memory_order_relaxed);
+    pressButtonLocked(BUTTON_RIGHT);
+}
+
+/**
+ * 第二根手指出现：取消主手指手势
+ */
+static void mouseCancelTouchLocked() {
+    g_mouseCancelled = true;
+    cancelTimerLocked(TIMER_MOUSE_LONG_PRESS);
+    cancelTimerLocked(TIMER_MOUSE_TAP_DOWN);
+    if (g_mouseConfirmedLongPress) {
+        releaseButtonLocked(BUTTON_RIGHT);
+    } else if (g_mouseConfirmedTap) {
+        releaseButtonLocked(BUTTON_LEFT);
+    }
+}
+
+static void handleMouseLocked(const TouchEventView *ev, uint64_t now) {
+    g_mouseAreaWidth = ev->areaWidth;
+    g_mouseAreaHeight = ev->areaHeight;
+
+    switch (ev->type) {
+        case TOUCH_GESTURE_EVENT_DOWN:
+            for (uint32_t i = 0; i < ev->changedCount; i++) {
+                TouchSample t = sampleAt(ev->changed, i);
+                if (g_mousePrimaryId == -1) {
+                    g_mousePrimaryId = t.id;
+                    g_mouseDownX = t.x;
+                    g_mouseDownY = t.y;
+                    g_mouseDownNs = now;
+                    g_mouseCancelled = false;
+                    g_mouseConfirmedTap = false;
+                    g_mouseConfirmedLongPress = false;
+                    armTimerLocked(TIMER_MOUSE_TAP_DOWN, now + MOUSE_DEADZONE_TIME_NS);
+                    armTimerLocked(TIMER_MOUSE_LONG_PRESS, now + MOUSE_LONG_PRESS_TIME_NS);
+                } else if (g_mouseSecondId == -1) {
+                    g_mouseSecondId = t.id;
+                    g_mouseSecondLastY = t.y;
+                    mouseCancelTouchLocked();
+                }
+            }
+            break;
+
+        case TOUCH_GESTURE_EVENT_MOVE:
+            for (uint32_t i = 0; i < ev->changedCount; i++) {
+                TouchSample t = sampleAt(ev->changed, i);
+                if (t.id == g_mousePrimaryId && !g_mouseCancelled) {
+                    float dx = t.x - g_mouseDownX;
+                    float dy = t.y - g_mouseDownY;
+                    if (distanceExceeds(dx, dy, MOUSE_LONG_PRESS_DISTANCE)) {
+                        cancelTimerLocked(TIMER_MOUSE_LONG_PRESS);
+                    }
+                    // 死区内忽略移动，死区外确认点击并更新位置
+                    if (g_mouseConfirmedTap || distanceExceeds(dx, dy, MOUSE_DEADZONE_DISTANCE)) {
+                        mouseTapConfirmedLocked();
+                        mouseUpdatePositionLocked(t.x, t.y);
+                    }
+                } else if (t.id == g_mouseSecondId) {
+                    float deltaY = t.y - g_mouseSecondLastY;
+                    g_mouseSecondLastY = t.y;
+                    sendScrollLocked((int)floorf(deltaY * MOUSE_SCROLL_SPEED_FACTOR));
+                }
+            }
+            break;
+
+        case TOUCH_GESTURE_EVENT_UP:
+        case TOUCH_GESTURE_EVENT_CANCEL:
+            for (uint32_t i = 0; i < ev->changedCount; i++) {
+                TouchSample t = sampleAt(ev->changed, i);
+                if (t.id == g_mousePrimaryId) {
+                    g_mousePrimaryId = -1;
+                    if (!g_mouseCancelled) {
+                        cancelTimerLocked(TIMER_MOUSE_LONG_PRESS);
+                        cancelTimerLocked(TIMER_MOUSE_TAP_DOWN);
+                        if (g_mouseConfirmedLongPress) {
+                            releaseButtonLocked(BUTTON_RIGHT);
+                        } else if (g_mouseConfirmedTap) {
+                            releaseButtonLocked(BUTTON_LEFT);
+                        } else {
+                            // 死区时间内完成的快速点击：立即按下，延迟释放
+                            mouseTapConfirmedLocked();
+                            armTimerLocked(TIMER_RELEASE_LEFT, now + MOUSE_QUICK_TAP_HOLD_NS);
+                        }
+                    }
+                    g_mouseLastUpX = t.x;
+                    g_mouseLastUpY = t.y;
+                    g_mouseLastUpNs = now;
+                } else if (t.id == g_mouseSecondId) {
+                    g_mouseSecondId = -1;
+                }
+            }
+            break;
+    }
+}
+
+// ============================================================
+// 定时器线程
+// ============================================================
+
+static void fireTimerLocked(int timer) {
+    switch (timer) {
+        case TIMER_MOUSE_TAP_DOWN:   mouseTapConfirmedLocked(); break;
+        case TIMER_MOUSE_LONG_PRESS: mouseLongPressLocked(); break;
+        case TIMER_RELEASE_LEFT:     sendButtonLocked(BUTTON_ACTION_RELEASE, BUTTON_LEFT); break;
+        case TIMER_RELEASE_RIGHT:    sendButtonLocked(BUTTON_ACTION_RELEASE, BUTTON_RIGHT); break;
+    }
+}
+
+static void timerThreadLoop(uint64_t generation) {
+    std::unique_lock<std::mutex> lock(g_gestureMutex);
+    while (g_timerGeneration == generation) {
+        uint64_t deadline = UINT64_MAX;
+        for (int i = 0; i < TIMER_COUNT; i++) {
+            if (g_timers[i] != 0 && g_timers[i] < deadline) deadline = g_timers[i];
+        }
+        if (deadline == UINT64_MAX) {
+            g_timerCv.wait(lock);
+            continue;
+        }
+
+        uint64_t now = monotonicNs();
+        if (now < deadline) {
+            g_timerCv.wait_for(lock, std::chrono::nanoseconds(deadline - now));
+            continue;
+        }
+
+        for (int i = 0; i < TIMER_COUNT; i++) {
+            if (g_timers[i] != 0 && g_timers[i] <= now) {
+                g_timers[i] = 0;
+                fireTimerLocked(i);
+            }
+        }
+    }
+}
+
+/**
+ * 停止定时线程（可在非 UI 线程调用，如连接终止回调）
+ * join 期间不持锁，UI 线程的 submit 可能在此窗口内 armTimerLocked 启动新线程：
+ * 旧线程按代次退出，新线程由下一轮循环一并停止
+ */
+static void stopTimerThread() {
+    for (;;) {
+        std::thread thread;
+        {
+            std::lock_guard<std::mutex> lock(g_gestureMutex);
+            if (!g_timerThread.joinable()) return;
+            g_timerGeneration++;
+            thread = std::move(g_timerThread);
+        }
+        g_timerCv.notify_all();
+        thread.join();
+    }
+}
+
+/**
+ * 清空手势状态
+ * @param releaseButtons 释放仍按住的按键（连接已断开时无需发送）
+ */
+static void resetStateLocked(bool releaseButtons) {
+    if (releaseButtons) {
+        bool leftHeld = g_timers[TIMER_RELEASE_LEFT] != 0 ||
+            (g_mousePrimaryId != -1 && !g_mouseCancelled && g_mouseConfirmedTap && !g_mouseConfirmedLongPress);
+        bool rightHeld = g_timers[TIMER_RELEASE_RIGHT] != 0 ||
+            (g_mousePrimaryId != -1 && !g_mouseCancelled && g_mouseConfirmedLongPress);
+        if (leftHeld) sendButtonLocked(BUTTON_ACTION_RELEASE, BUTTON_LEFT);
+        if (rightHeld) sendButtonLocked(BUTTON_ACTION_RELEASE, BUTTON_RIGHT);
+    }
+    memset(g_timers, 0, sizeof(g_timers));
+    memset(g_points, 0, sizeof(g_points));
+    g_activePointerCount = 0;
+    g_maxPointerCountInGesture = 0;
+    g_twoFingerTapPending = false;
+    g_twoFingerMoved = false;
+    g_confirmedScroll = false;
+    g_moveResidualX = g_moveResidualY = 0;
+    g_mousePrimaryId = -1;
+    g_mouseSecondId = -1;
+    g_mouseCancelled = false;
+    g_mouseConfirmedTap = false;
+    g_mouseConfirmedLongPress = false;
+}
+
+// ============================================================
+// 解码
+// ============================================================
+
+static bool decodeEvent(const double *data, size_t length, TouchEventView *ev) {
+    if (length < TOUCH_GESTURE_HEADER_SIZE) return false;
+    ev->type = (int)data[0];
+    ev->areaWidth = (float)data[1];
+    ev->areaHeight = (float)data[2];
+    ev->timestampNs = data[3] > 0 ? (uint64_t)data[3] : 0;
+    if (!(data[4] >= 0 && data[4] <= GESTURE_MAX_TOUCHES) ||
+        !(data[5] >= 0 && data[5] <= GESTURE_MAX_TOUCHES) ||
+        !(data[6] >= 0 && data[6] <= GESTURE_MAX_HISTORY)) {
+        return false;
+    }
+    ev->touchCount = (uint32_t)data[4];
+    ev->changedCount = (uint32_t)data[5];
+    ev->historyCount = (uint32_t)data[6];
+
+    size_t needed = TOUCH_GESTURE_HEADER_SIZE +
+        (size_t)(ev->touchCount + ev->changedCount) * TOUCH_GESTURE_POINT_STRIDE +
+        (size_t)ev->historyCount * TOUCH_GESTURE_HISTORY_STRIDE;
+    if (length < needed) return false;
+
+    ev->touches = data + TOUCH_GESTURE_HEADER_SIZE;
+    ev->changed = ev->touches + (size_t)ev->touchCount * TOUCH_GESTURE_POINT_STRIDE;
+    ev->history = ev->changed + (size_t)ev->changedCount * TOUCH_GESTURE_POINT_STRIDE;
+    return true;
+}
+
+/**
+ * 处理一个编码后的 TouchEvent
+ * @return 产生的输出调用数，编码无效返回 -1
+ */
+static int submitEvent(const double *data, size_t length) {
+    uint64_t startNs = monotonicNs();
+    TouchEventView ev;
+    if (!decodeEvent(data, length, &ev)) return -1;
+
+    int outputs;
+    {
+        std::lock_guard<std::mutex> lock(g_gestureMutex);
+        g_pendingEventTsNs = ev.timestampNs;
+        g_submitOutputs = 0;
+        switch (g_mode) {
+            case TOUCH_GESTURE_MODE_DIRECT: handleDirectLocked(&ev, startNs); break;
+            case TOUCH_GESTURE_MODE_MOUSE:  handleMouseLocked(&ev, startNs); break;
+            default:                        handleTrackpadLocked(&ev, startNs); break;
+        }
+        g_pendingEventTsNs = 0;
+        outputs = g_submitOutputs;
+    }
+
+    g_eventsIn.fetch_add(1, std::memory_order_relaxed);
+    g_pointsIn.fetch_add(ev.touchCount + ev.historyCount, std::memory_order_relaxed);
+    g_processTotalNs.fetch_add(monotonicNs() - startNs, std::memory_order_relaxed);
+    return outputs;
+}
+
+// ============================================================
+// Native 接口
+// ============================================================
+
+void TouchGesture_OnConnectionStarted() {
+    g_eventsIn.store(0, std::memory_order_relaxed);
+    g_pointsIn.store(0, std::memory_order_relaxed);
+    g_touchEventsSent.store(0, std::memory_order_relaxed);
+    g_mouseMovesSent.store(0, std::memory_order_relaxed);
+    g_buttonsSent.store(0, std::memory_order_relaxed);
+    g_scrollsSent.store(0, std::memory_order_relaxed);
+    g_taps.store(0, std::memory_order_relaxed);
+    g_rightTaps.store(0, std::memory_order_relaxed);
+    g_latencySamples.store(0, std::memory_order_relaxed);
+    g_latencyTotalNs.store(0, std::memory_order_relaxed);
+    g_processTotalNs.store(0, std::memory_order_relaxed);
+    g_latencyHist.Reset();
+}
+
+void TouchGesture_OnConnectionStopped() {
+    stopTimerThread();
+    std::lock_guard<std::mutex> lock(g_gestureMutex);
+    resetStateLocked(false);
+}
+
+void TouchGesture_GetStats(TouchGestureStats *out) {
+    if (!out) return;
+    memset(out, 0, sizeof(*out));
+    {
+        std::lock_guard<std::mutex> lock(g_gestureMutex);
+        out->mode = g_mode;
+    }
+    out->eventsIn = g_eventsIn.load(std::memory_order_relaxed);
+    out->pointsIn = g_pointsIn.load(std::memory_order_relaxed);
+    out->touchEventsSent = g_touchEventsSent.load(std::memory_order_relaxed);
+    out->mouseMovesSent = g_mouseMovesSent.load(std::memory_order_relaxed);
+    out->buttonsSent = g_buttonsSent.load(std::memory_order_relaxed);
+    out->scrollsSent = g_scrollsSent.load(std::memory_order_relaxed);
+    out->taps = g_taps.load(std::memory_order_relaxed);
+    out->rightTaps = g_rightTaps.load(std::memory_order_relaxed);
+    out->latencySamples = g_latencySamples.load(std::memory_order_relaxed);
+    out->avgLatencyUs = out->latencySamples > 0
+        ? (double)g_latencyTotalNs.load(std::memory_order_relaxed) / out->latencySamples / 1000.0 : 0.0;
+    out->p50LatencyUs = g_latencyHist.Percentile(0.50, LATENCY_BUCKET_US);
+    out->p99LatencyUs = g_latencyHist.Percentile(0.99, LATENCY_BUCKET_US);
+    out->maxLatencyUs = g_latencyHist.Max();
+    out->avgProcessUs = out->eventsIn > 0
+        ? (double)g_processTotalNs.load(std::memory_order_relaxed) / out->eventsIn / 1000.0 : 0.0;
+}
+
+// ============================================================
+// NAPI: setConfig(mode, sensitivity, clickThreshold, clickTimeThresholdMs)
+// ============================================================
+
+static napi_value TouchGestureNapi_SetConfig(napi_env env, napi_callback_info info) {
+    size_t argc = 4;
+    napi_value args[4];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    int32_t mode = TOUCH_GESTURE_MODE_TRACKPAD;
+    double sensitivity = 1.5, clickThreshold = 20.0, clickTimeMs = 300.0;
+    if (argc >= 1) napi_get_value_int32(env, args[0], &mode);
+    if (argc >= 2) napi_get_value_double(env, args[1], &sensitivity);
+    if (argc >= 3) napi_get_value_double(env, args[2], &clickThreshold);
+    if (argc >= 4) napi_get_value_double(env, args[3], &clickTimeMs);
+    if (mode < TOUCH_GESTURE_MODE_TRACKPAD || mode > TOUCH_GESTURE_MODE_MOUSE) {
+        mode = TOUCH_GESTURE_MODE_TRACKPAD;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(g_gestureMutex);
+        if (mode != g_mode) {
+            // 切换模式时结束进行中的手势
+            resetStateLocked(true);
+            g_mode = mode;
+        }
+        g_sensitivity = (float)sensitivity;
+        g_clickThreshold = (float)clickThreshold;
+        g_clickTimeThresholdNs = clickTimeMs > 0 ? (uint64_t)(clickTimeMs * NS_PER_MS) : 0;
+    }
+
+    OH_LOG_INFO(LOG_APP, "[%{public}s] setConfig: mode=%{public}d sensitivity=%{public}.2f "
+                "click=%{public}.0fpx/%{public}.0fms", LOG_TAG, mode, sensitivity, clickThreshold, clickTimeMs);
+
+    napi_value undefined;
+    napi_get_undefined(env, &undefined);
+    return undefined;
+}
+
+// ============================================================
+// NAPI: submit(data: Float64Array) → number
+// ============================================================
+
+static napi_value TouchGestureNapi_Submit(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    int32_t outputs = -1;
+    bool isTypedArray = false;
+    if (argc >= 1 && napi_is_typedarray(env, args[0], &isTypedArray) == napi_ok && isTypedArray) {
+        napi_typedarray_type type;
+        size_t length = 0;
+        void *data = nullptr;
+        if (napi_get_typedarray_info(env, args[0], &type, &length, &data, nullptr, nullptr) == napi_ok &&
+            type == napi_float64_array && data != nullptr) {
+            outputs = submitEvent(static_cast<const double *>(data), length);
+        }
+    }
+
+    napi_value result;
+    napi_create_int32(env, outputs, &result);
+    return result;
+}
+
+// ============================================================
+// NAPI: reset()
+// ============================================================
+
+static napi_value TouchGestureNapi_Reset(napi_env env, napi_callback_info info) {
+    {
+        std::lock_guard<std::mutex> lock(g_gestureMutex);
+        resetStateLocked(true);
+    }
+
+    napi_value undefined;
+    napi_get_undefined(env, &undefined);
+    return undefined;
+}
+
+// ============================================================
+// NAPI: getStats() → TouchGestureStats
+// ============================================================
+
+static napi_value TouchGestureNapi_GetStats(napi_env env, napi_callback_info info) {
+    TouchGestureStats stats;
+    TouchGesture_GetStats(&stats);
+
+    napi_value result;
+    napi_create_object(env, &result);
+
+    napi_value val;
+    napi_create_int32(env, stats.mode, &val);
+    napi_set_named_property(env, result, "mode", val);
+    napi_create_int64(env, (int64_t)stats.eventsIn, &val);
+    napi_set_named_property(env, result, "eventsIn", val);
+    napi_create_int64(env, (int64_t)stats.pointsIn, &val);
+    napi_set_named_property(env, result, "pointsIn", val);
+    napi_create_int64(env, (int64_t)stats.touchEventsSent, &val);
+    napi_set_named_property(env, result, "touchEventsSent", val);
+    napi_create_int64(env, (int64_t)stats.mouseMovesSent, &val);
+    napi_set_named_property(env, result, "mouseMovesSent", val);
+    napi_create_int64(env, (int64_t)stats.buttonsSent, &val);
+    napi_set_named_property(env, result, "buttonsSent", val);
+    napi_create_int64(env, (int64_t)stats.scrollsSent, &val);
+    napi_set_named_property(env, result, "scrollsSent", val);
+    napi_create_int64(env, (int64_t)stats.taps, &val);
+    napi_set_named_property(env, result, "taps", val);
+    napi_create_int64(env, (int64_t)stats.rightTaps, &val);
+    napi_set_named_property(env, result, "rightTaps", val);
+    napi_create_int64(env, (int64_t)stats.latencySamples, &val);
+    napi_set_named_property(env, result, "latencySamples", val);
+    napi_create_double(env, stats.avgLatencyUs, &val);
+    napi_set_named_property(env, result, "avgLatencyUs", val);
+    napi_create_uint32(env, stats.p50LatencyUs, &val);
+    napi_set_named_property(env, result, "p50LatencyUs", val);
+    napi_create_uint32(env, stats.p99LatencyUs, &val);
+    napi_set_named_property(env, result, "p99LatencyUs", val);
+    napi_create_uint32(env, stats.maxLatencyUs, &val);
+    napi_set_named_property(env, result, "maxLatencyUs", val);
+    napi_create_double(env, stats.avgProcessUs, &val);
+    napi_set_named_property(env, result, "avgProcessUs", val);
+
+    return result;
+}
+
+// ============================================================
+// NAPI 注册
+// ============================================================
+
+void TouchGesture_Init(napi_env env, napi_value exports) {
+    napi_value obj;
+    napi_create_object(env, &obj);
+
+    napi_property_descriptor methods[] = {
+        { "setConfig", nullptr, TouchGestureNapi_SetConfig, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "submit",    nullptr, TouchGestureNapi_Submit,    nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "reset",     nullptr, TouchGestureNapi_Reset,     nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "getStats",  nullptr, TouchGestureNapi_GetStats,  nullptr, nullptr, nullptr, napi_default, nullptr },
+    };
+
+    napi_define_properties(env, obj, sizeof(methods) / sizeof(methods[0]), methods);
+    napi_set_named_property(env, exports, "TouchGesture", obj);
+
+    OH_LOG_INFO(LOG_APP, "[%{public}s] TouchGesture NAPI 已注册", LOG_TAG);
+}
@@ -0,0 +1,106 @@
+/*
+ * Moonlight for HarmonyOS
+ * Copyright (C) 2024-2025 Moonlight/AlkaidLab
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file touch_gesture.h
+ * @brief Native 触摸手势引擎：整个 TouchEvent 一次 NAPI 调用，手势识别与发送在 C++ 完成
+ *
+ * 原路径 TouchInputHandler 在 ArkTS 中维护多点状态、触控板手势、点击 / 长按定时器与滚轮合成，
+ * 每个输出（触摸点、鼠标移动、按键、滚轮）各跨一次 NAPI，120-240Hz 采样时会排在 UI 任务之后。
+ *
+ * 本模块：
+ * - submit(Float64Array) 接收编码后的完整 TouchEvent（当前触点 / 变化触点 / 历史采样点），
+ *   按模式运行状态机后直接调用 LiSendTouchEvent 或经 InputScheduler 发送鼠标输入
+ * - 三种模式与 TouchInputHandler 逐一对应：
+ *   TRACKPAD  单指相对移动 / 单指轻触左键 / 双指轻触右键 / 双指滑动滚轮
+ *   DIRECT    多点触控协议，含历史采样点与压力 / 接触面积追踪
+ *   MOUSE     绝对定位 + 死区 + 长按右键 + 第二指滚轮（对齐 Android AbsoluteTouchContext）
+ * - 死区、长按与延迟释放定时器由内部线程驱动，不依赖 JS setTimeout
+ *
+ * 统计：手势识别延迟（TouchEvent.timestamp → 该事件的首个输出调用）与 native 处理耗时。
+ * 手写笔（Pen 协议）仍由 ArkTS 处理。
+ *
+ * 线程模型：submit / setConfig 在 JS 线程，定时器在内部线程，状态由单个互斥锁保护。
+ */
+
+#ifndef TOUCH_GESTURE_H
+#define TOUCH_GESTURE_H
+
+#include <napi/native_api.h>
+#include <stdint.h>
+
+// setConfig 的 mode（与 TouchInputMode 对应）
+#define TOUCH_GESTURE_MODE_TRACKPAD 0
+#define TOUCH_GESTURE_MODE_DIRECT   1
+#define TOUCH_GESTURE_MODE_MOUSE    2
+
+// 编码中的事件类型（与 ArkUI TouchType 数值一致）
+#define TOUCH_GESTURE_EVENT_DOWN    0
+#define TOUCH_GESTURE_EVENT_UP      1
+#define TOUCH_GESTURE_EVENT_MOVE    2
+#define TOUCH_GESTURE_EVENT_CANCEL  3
+
+/*
+ * submit 的 Float64Array 编码：
+ *   [0] 事件类型  [1] 区域宽度  [2] 区域高度  [3] 事件时间戳 (ns，0 = 未知)
+ *   [4] touches 数  [5] changedTouches 数  [6] 历史采样点数
+ *   touches:        id, x, y                          × touches 数
+ *   changedTouches: id, x, y                          × changedTouches 数
+ *   历史采样点:      id, x, y, force, size, 时间戳(ns)  × 历史采样点数
+ */
+#define TOUCH_GESTURE_HEADER_SIZE       7
+#define TOUCH_GESTURE_POINT_STRIDE      3
+#define TOUCH_GESTURE_HISTORY_STRIDE    6
+
+/**
+ * 手势统计（自串流连接建立起累计）
+ */
+struct TouchGestureStats {
+    int32_t mode;
+    uint64_t eventsIn;              // submit 调用数
+    uint64_t pointsIn;              // 触点数（含历史采样点）
+    uint64_t touchEventsSent;       // LiSendTouchEvent
+    uint64_t mouseMovesSent;        // 相对移动 / 绝对位置
+    uint64_t buttonsSent;
+    uint64_t scrollsSent;
+    uint64_t taps;                  // 识别出的左键轻触
+    uint64_t rightTaps;             // 双指轻触 / 长按右键
+    uint64_t latencySamples;
+    double avgLatencyUs;            // TouchEvent.timestamp → 首个输出
+    uint32_t p50LatencyUs;
+    uint32_t p99LatencyUs;
+    uint32_t maxLatencyUs;
+    double avgProcessUs;            // submit 内 native 处理耗时
+};
+
+/**
+ * 初始化 TouchGesture NAPI 模块。
+ *
+ * 注册到 exports.TouchGesture 命名空间：
+ *   - setConfig(mode, sensitivity, clickThreshold, clickTimeThresholdMs): void
+ *   - submit(data: Float64Array): number     返回本次产生的输出调用数
+ *   - reset(): void                           释放按住的按键并清空手势状态
+ *   - getStats(): obj
+ */
+void TouchGesture_Init(napi_env env, napi_value exports);
+
+/**
+ * 串流连接建立：重置统计
+ */
+void TouchGesture_OnConnectionStarted();
+
+/**
+ * 串流连接停止 / 终止：停止定时器线程并清空手势状态
+ */
+void TouchGesture_OnConnectionStopped();
+
+void TouchGesture_GetStats(TouchGestureStats *out);
+
+#endif // TOUCH_GESTURE_H
@@ -8,24 +8,30 @@
  *   1. dlopen("libusb_ndk.z.so") 动态加载 DDK (避免硬依赖)
  *   2. OH_Usb_Init() → OH_Usb_GetDevices() → 匹配 VID/PID
  *   3. OH_Usb_ClaimInterface() → OH_Usb_CreateDeviceMemMap()
- *   4. pthread 循环调用 OH_Usb_SendPipeRequest() 阻塞读取 IN 端点
- *   5. 数据通过 napi_threadsafe_function 回调到 JS 线程
- *   6. 输出(init/rumble) 由轮询线程在 IN 请求间隙发送 (非阻塞 JS)
+ *   4. 多个 IN 工作线程各持一块 memmap 同时挂起 OH_Usb_SendPipeRequest()，按完成顺序处理结果
+ *   5. 数据写入每个 poller 预分配的报告环，JS 线程经 napi_threadsafe_function 批量取走
+ *   6. 输出(init/rumble) 由独立的 OUT 工作线程发送 (不阻塞 JS，也不阻塞输入读取)
  *
  * 性能优势：
  *   - SendPipeRequest 是纯同步内核调用，无 IPC 开销
  *   - pthread 直接等待内核事件，响应延迟 < 0.1ms
  *   - 理论轮询率可达 USB High Speed 上限 (1000Hz)
  *   - 输出 (rumble) 不阻塞 JS 主线程
+ *   - 报告投递零分配：环形缓冲 + 复用的外部 ArrayBuffer，一次 tsfn 调用投递多帧
  */
 
 #include "usb_ddk_poller.h"
+#include "controller_input_router.h"
+#include "haptics_router.h"
+#include "latency_histogram.h"
 
 #include <pthread.h>
 #include <unistd.h>
+#include <stdio.h>
 #include <string.h>
 #include <dlfcn.h>
 #include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <hilog/log.h>
 
@@ -117,6 +123,28 @@ static Fn_OH_Usb_SendPipeRequest   fn_SendPipeRequest = nullptr;
 
 #define DDK_MAX_POLLERS 4
 
+// IN 流水线：同时挂起的请求数 (每个请求一块 memmap + 一个工作线程)
+#define DDK_MAX_IN_FLIGHT      3
+#define DDK_DEFAULT_IN_FLIGHT  2
+
+// 统计直方图桶宽
+#define DDK_INTERVAL_BUCKET_US   50   // 报告间隔 0-5ms
+#define DDK_JITTER_BUCKET_US     10   // 相邻间隔差 0-1ms
+#define DDK_POLL_RATE_BUCKET_HZ  50   // 每秒轮询率 0-2000Hz
+
+// 报告环：轮询线程写入，JS 线程批量取走
+#define DDK_REPORT_RING_SIZE  32    // 1000Hz 下约 32ms 积压
+#define DDK_REPORT_MAX_LEN    256   // 单帧上限 (与去重缓存一致)
+#define DDK_BATCH_HEADER_LEN  4     // 批量缓冲区每帧头: [len lo][len hi][flags][0]
+#define DDK_BATCH_BYTES       (DDK_REPORT_RING_SIZE * (DDK_BATCH_HEADER_LEN + DDK_REPORT_MAX_LEN))
+#define DDK_BATCH_FLAG_ROUTED 0x01  // 输入已由 ControllerInputRouter 发送，JS 只做协议处理
+
+struct DdkReportSlot {
+    uint16_t length;
+    bool routed;
+    uint8_t data[DDK_REPORT_MAX_LEN];
+};
+
 struct DdkPollerContext {
     // DDK 资源
     uint64_t deviceId;
@@ -126,15 +154,39 @@ struct DdkPollerContext {
     uint32_t maxPacketSize;
     uint32_t timeoutMs;
 
-    UsbDeviceMemMap *inMemMap;   // 输入 (轮询线程专用)
-    UsbDeviceMemMap *outMemMap;  // 输出 (轮询线程发送)
+    UsbDeviceMemMap *inMemMaps[DDK_MAX_IN_FLIGHT];  // 输入 (每个 IN 工作线程一块)
+    uint32_t inFlight;                              // 实际创建的 IN memmap 数
+    UsbDeviceMemMap *outMemMap;  // 输出 (OUT 工作线程专用)
 
     // 线程控制
     std::atomic<bool> running;
-    pthread_t thread;
+    pthread_t inThreads[DDK_MAX_IN_FLIGHT];
+    uint32_t inThreadCount;
+    pthread_t outThread;
+    bool outThreadCreated;
     bool threadCreated;
     bool interfaceClaimed;
 
+    // IN 流水线排序：提交时刻在 inSubmitMutex 下预留；请求返回时领取完成序号，按完成序号进入有序段
+    std::mutex inSubmitMutex;
+    std::atomic<uint64_t> inCompleteSeq;
+    uint64_t lastInRequestNs;            // 最近一次预留的提交时刻 (可能在未来)
+    uint64_t inBackoffUntilNs;           // 错误退避截止时刻，有序段内记录，提交前在锁外等待
+    std::mutex inPublishMutex;
+    std::condition_variable inPublishCv;
+    uint64_t inPublishTurn;
+
+    // 有序段状态 (仅持有当前轮次的 IN 线程访问)
+    int consecutiveErrors;
+    uint64_t queueFullCount;
+    uint64_t lastRxNs;
+    uint64_t lastIntervalUs;
+    uint64_t rateWindowStartMs;
+    uint64_t rateWindowCount;
+    uint64_t statStartMs;
+    uint64_t statPollCount;
+    uint64_t lastLoggedCoalesced;
+
     // JS 回调
     napi_threadsafe_function tsfn;      // 数据回调
     napi_threadsafe_function errorTsfn; // 错误回调
@@ -147,9 +199,23 @@ struct DdkPollerContext {
     uint8_t pendingOutData[64];
     uint32_t pendingOutLen;
     uint8_t pendingOutEndpoint;
+    uint64_t pendingOutOriginNs;        // 0 = 不统计延迟
     std::atomic<bool> hasPendingOutput{false};
+    std::condition_variable outCv;      // 唤醒 OUT 工作线程 (配合 outMutex)
+
+    // 报告环 (IN 有序段写入; 满时合并到最新一帧：保留较早的状态变化，只覆盖尚未投递的最新状态)
+    std::mutex ringMutex;
+    DdkReportSlot ring[DDK_REPORT_RING_SIZE];
+    uint32_t ringHead;                   // 下一个写入位置
+    uint32_t ringCount;                  // 未取走的帧数
+    std::atomic<bool> drainScheduled;    // 已有未执行的 tsfn 调用
+    uint32_t generation;                 // 启动代号：丢弃上一次启动遗留的 tsfn 调用，校验 native 输出绑定 (JS 线程写，持 outMutex)
 
-    // 输入去重 (避免无变化数据淹没 tsfn 队列)
+    // JS 批量缓冲区：外部 ArrayBuffer 直接引用，仅在 JS 线程回调期间写入
+    uint8_t jsBatch[DDK_BATCH_BYTES];
+    napi_ref jsBatchViewRef;             // 覆盖 jsBatch 的 Uint8Array
+
+    // 输入去重 (避免无变化数据占满报告环)
     uint8_t lastInputData[256];
     uint32_t lastInputLen;
     bool lastInputValid;
@@ -158,22 +224,33 @@ struct DdkPollerContext {
     std::atomic<uint64_t> totalReads;
     std::atomic<uint64_t> totalBytes;
     std::atomic<uint64_t> totalSkippedDups;  // 去重跳过的帧数
+    std::atomic<uint64_t> reportsQueued;     // 写入报告环
+    std::atomic<uint64_t> reportsCoalesced;  // 环满时覆盖最新帧
+    std::atomic<uint64_t> reportsDelivered;  // 投递给 JS
+    std::atomic<uint64_t> jsBatches;         // JS 回调次数
+    std::atomic<uint64_t> outSent;
+    std::atomic<uint64_t> outFailed;
+    std::atomic<uint64_t> outStampedCount;
+    std::atomic<uint64_t> outStampedTotalNs;
+    std::atomic<uint64_t> outStampedMaxNs;
+
+    LatencyHistogram<100> intervalHist;  // 相邻两次成功读取的间隔 (us)
+    LatencyHistogram<100> jitterHist;    // 相邻间隔之差 (us)
+    LatencyHistogram<40> pollRateHist;   // 每秒轮询率 (Hz)
 };
 
 static DdkPollerContext g_ddkPollers[DDK_MAX_POLLERS];
 static pthread_mutex_t g_ddkMutex = PTHREAD_MUTEX_INITIALIZER;
 static bool g_ddkPoolInited = false;
+static uint32_t g_ddkGeneration = 0;  // JS 线程递增
+
+// 温控降载：IN 请求最小间隔（0 = 不限速，ThermalGovernor 写，轮询线程读）
+static std::atomic<uint32_t> g_minPollIntervalUs{0};
 
 // ============================================================
 // 回调数据
 // ============================================================
 
-struct DdkCallbackData {
-    uint8_t *data;
-    int length;
-    int pollerId;
-};
-
 struct DdkErrorData {
     int errorCode;
     int pollerId;
@@ -196,22 +273,173 @@ static const char *ddkErrStr(int32_t code) {
     }
 }
 
+static uint64_t monotonicNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// 记录 IN 错误退避 (有序段内调用)：只写截止时刻，等待由各 IN 线程在下一次提交前于有序段外进行
+static void deferInRequests(DdkPollerContext *ctx, uint32_t delayMs) {
+    uint64_t untilNs = monotonicNs() + (uint64_t)delayMs * 1000000ULL;
+    std::lock_guard<std::mutex> lock(ctx->inSubmitMutex);
+    if (untilNs > ctx->inBackoffUntilNs) ctx->inBackoffUntilNs = untilNs;
+}
+
+// 存入挂起输出槽 (latest-wins)，由 OUT 工作线程发送
+// generation 非 0 时须与当前启动代号一致；代号与槽位复位 / 启停都在 outMutex 下变更，
+// 检查与写入之间槽位不会被换成另一个设备
+static bool queuePendingOutput(DdkPollerContext *ctx, uint32_t generation, uint8_t endpoint,
+                               const uint8_t *data, uint32_t len, uint64_t originNs) {
+    {
+        std::lock_guard<std::mutex> lock(ctx->outMutex);
+        // 仅在轮询线程运行时投递，同步发送路径只留给 JS 的 init 命令
+        if (!ctx->running.load() || !ctx->outMemMap || (generation != 0 && ctx->generation != generation)) {
+            return false;
+        }
+        memcpy(ctx->pendingOutData, data, len);
+        ctx->pendingOutLen = len;
+        ctx->pendingOutEndpoint = endpoint;
+        ctx->pendingOutOriginNs = originNs;
+        ctx->hasPendingOutput.store(true, std::memory_order_release);
+    }
+    ctx->outCv.notify_one();
+    return true;
+}
+
+// 写入报告环 (仅 IN 有序段内调用，同一时刻只有一个写入者)
+static void ringPush(DdkPollerContext *ctx, const uint8_t *data, uint32_t len, bool routed) {
+    if (len > DDK_REPORT_MAX_LEN) len = DDK_REPORT_MAX_LEN;
+    std::lock_guard<std::mutex> lock(ctx->ringMutex);
+    DdkReportSlot *slot;
+    if (ctx->ringCount == DDK_REPORT_RING_SIZE) {
+        // JS 线程积压：最新一帧尚未投递，直接以新状态覆盖
+        slot = &ctx->ring[(ctx->ringHead + DDK_REPORT_RING_SIZE - 1) % DDK_REPORT_RING_SIZE];
+        ctx->reportsCoalesced.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        slot = &ctx->ring[ctx->ringHead];
+        ctx->ringHead = (ctx->ringHead + 1) % DDK_REPORT_RING_SIZE;
+        ctx->ringCount++;
+    }
+    memcpy(slot->data, data, len);
+    slot->length = (uint16_t)len;
+    slot->routed = routed;
+    ctx->reportsQueued.fetch_add(1, std::memory_order_relaxed);
+}
+
+// 取走报告环中的全部帧到 jsBatch (仅 JS 线程调用)
+static uint32_t ringDrain(DdkPollerContext *ctx, uint32_t *outBytes) {
+    uint32_t count = 0;
+    uint32_t off = 0;
+    std::lock_guard<std::mutex> lock(ctx->ringMutex);
+    uint32_t idx = (ctx->ringHead + DDK_REPORT_RING_SIZE - ctx->ringCount) % DDK_REPORT_RING_SIZE;
+    while (ctx->ringCount > 0) {
+        const DdkReportSlot *slot = &ctx->ring[idx];
+        uint8_t *dst = ctx->jsBatch + off;
+        dst[0] = (uint8_t)(slot->length & 0xFF);
+        dst[1] = (uint8_t)(slot->length >> 8);
+        dst[2] = slot->routed ? DDK_BATCH_FLAG_ROUTED : 0;
+        dst[3] = 0;
+        memcpy(dst + DDK_BATCH_HEADER_LEN, slot->data, slot->length);
+        off += DDK_BATCH_HEADER_LEN + slot->length;
+        idx = (idx + 1) % DDK_REPORT_RING_SIZE;
+        ctx->ringCount--;
+        count++;
+    }
+    *outBytes = off;
+    return count;
+}
+
+static void releaseBatchView(napi_env env, DdkPollerContext *ctx) {
+    if (ctx->jsBatchViewRef) {
+        napi_delete_reference(env, ctx->jsBatchViewRef);
+        ctx->jsBatchViewRef = nullptr;
+    }
+}
+
+/**
+ * 槽位复位 (持有 g_ddkMutex，工作线程已退出)
+ *
+ * 上下文含 mutex / condition_variable，不能整体 memset；逐字段复位。
+ * 持有 outMutex / ringMutex：其他线程 (HapticsRouter) 可能正在对同一槽位投递输出。
+ */
+static void resetPollerLocked(DdkPollerContext *ctx) {
+    std::lock_guard<std::mutex> outLock(ctx->outMutex);
+    std::lock_guard<std::mutex> ringLock(ctx->ringMutex);
+
+    ctx->deviceId = 0;
+    ctx->interfaceHandle = 0;
+    ctx->inEndpoint = 0;
+    ctx->outEndpoint = 0;
+    ctx->maxPacketSize = 0;
+    ctx->timeoutMs = 0;
+    for (int i = 0; i < DDK_MAX_IN_FLIGHT; i++) ctx->inMemMaps[i] = nullptr;
+    ctx->inFlight = 0;
+    ctx->outMemMap = nullptr;
+
+    ctx->running.store(false);
+    ctx->inThreadCount = 0;
+    ctx->outThreadCreated = false;
+    ctx->threadCreated = false;
+    ctx->interfaceClaimed = false;
+
+    ctx->inCompleteSeq.store(0);
+    ctx->lastInRequestNs = 0;
+    ctx->inBackoffUntilNs = 0;
+    ctx->inPublishTurn = 0;
+
+    ctx->consecutiveErrors = 0;
+    ctx->queueFullCount = 0;
+    ctx->lastRxNs = 0;
+    ctx->lastIntervalUs = 0;
+    ctx->rateWindowStartMs = 0;
+    ctx->rateWindowCount = 0;
+    ctx->statStartMs = 0;
+    ctx->statPollCount = 0;
+    ctx->lastLoggedCoalesced = 0;
+
+    ctx->tsfn = nullptr;
+    ctx->errorTsfn = nullptr;
+    ctx->ignoreDisconnect.store(false);
+
+    ctx->pendingOutLen = 0;
+    ctx->pendingOutEndpoint = 0;
+    ctx->pendingOutOriginNs = 0;
+    ctx->hasPendingOutput.store(false);
+
+    ctx->ringHead = 0;
+    ctx->ringCount = 0;
+    ctx->drainScheduled.store(false);
+    ctx->generation = 0;
+    ctx->jsBatchViewRef = nullptr;
+
+    ctx->lastInputLen = 0;
+    ctx->lastInputValid = false;
+
+    ctx->totalReads.store(0);
+    ctx->totalBytes.store(0);
+    ctx->totalSkippedDups.store(0);
+    ctx->reportsQueued.store(0);
+    ctx->reportsCoalesced.store(0);
+    ctx->reportsDelivered.store(0);
+    ctx->jsBatches.store(0);
+    ctx->outSent.store(0);
+    ctx->outFailed.store(0);
+    ctx->outStampedCount.store(0);
+    ctx->outStampedTotalNs.store(0);
+    ctx->outStampedMaxNs.store(0);
+    ctx->intervalHist.Reset();
+    ctx->jitterHist.Reset();
+    ctx->pollRateHist.Reset();
+}
+
 static void initPollerPool() {
     if (g_ddkPoolInited) return;
-    memset(g_ddkPollers, 0, sizeof(g_ddkPollers));
+    pthread_mutex_lock(&g_ddkMutex);
     for (int i = 0; i < DDK_MAX_POLLERS; i++) {
-        g_ddkPollers[i].running.store(false);
-        g_ddkPollers[i].threadCreated = false;
-        g_ddkPollers[i].interfaceClaimed = false;
-        g_ddkPollers[i].inMemMap = nullptr;
-        g_ddkPollers[i].outMemMap = nullptr;
-        g_ddkPollers[i].tsfn = nullptr;
-        g_ddkPollers[i].errorTsfn = nullptr;
-        g_ddkPollers[i].ignoreDisconnect.store(false);
-        g_ddkPollers[i].lastInputLen = 0;
-        g_ddkPollers[i].lastInputValid = false;
-        g_ddkPollers[i].totalSkippedDups.store(0);
+        resetPollerLocked(&g_ddkPollers[i]);
     }
+    pthread_mutex_unlock(&g_ddkMutex);
     g_ddkPoolInited = true;
 }
 
@@ -277,46 +505,37 @@ static bool loadDdkLibrary() {
 // 线程安全回调 (JS 线程执行)
 // ============================================================
 
+// rawData 编码 (generation * DDK_MAX_POLLERS + pollerId)，不携带堆内存
 static void ddkDataCallbackOnJs(napi_env env, napi_value js_callback, void *context, void *rawData) {
-    if (!env || !js_callback || !rawData) {
-        if (rawData) {
-            DdkCallbackData *cbd = (DdkCallbackData *)rawData;
-            free(cbd->data);
-            free(cbd);
-        }
-        return;
-    }
+    if (!env || !js_callback || !rawData) return;
 
-    DdkCallbackData *cbd = (DdkCallbackData *)rawData;
+    uintptr_t token = (uintptr_t)rawData;
+    int pollerId = (int)(token % DDK_MAX_POLLERS);
+    uint32_t generation = (uint32_t)(token / DDK_MAX_POLLERS);
+    DdkPollerContext *ctx = &g_ddkPollers[pollerId];
+    if (ctx->generation != generation || !ctx->jsBatchViewRef) return;  // 已停止或已重启
 
-    // 创建 ArrayBuffer + Uint8Array
-    void *bufferData = nullptr;
-    napi_value arrayBuffer;
-    if (napi_create_arraybuffer(env, cbd->length, &bufferData, &arrayBuffer) != napi_ok || !bufferData) {
-        free(cbd->data);
-        free(cbd);
-        return;
-    }
-    memcpy(bufferData, cbd->data, cbd->length);
+    // 先清标记再取数据：取数据期间写入的新帧会再调度一次
+    ctx->drainScheduled.store(false, std::memory_order_release);
 
-    napi_value uint8Array;
-    if (napi_create_typedarray(env, napi_uint8_array, cbd->length, arrayBuffer, 0, &uint8Array) != napi_ok) {
-        free(cbd->data);
-        free(cbd);
-        return;
-    }
+    uint32_t bytes = 0;
+    uint32_t count = ringDrain(ctx, &bytes);
+    if (count == 0) return;
+    ctx->reportsDelivered.fetch_add(count, std::memory_order_relaxed);
+    ctx->jsBatches.fetch_add(1, std::memory_order_relaxed);
+
+    napi_value batchView = nullptr;
+    if (napi_get_reference_value(env, ctx->jsBatchViewRef, &batchView) != napi_ok || !batchView) return;
 
-    napi_value pollerIdVal, lengthVal;
-    napi_create_int32(env, cbd->pollerId, &pollerIdVal);
-    napi_create_int32(env, cbd->length, &lengthVal);
+    napi_value pollerIdVal, countVal, bytesVal;
+    napi_create_int32(env, pollerId, &pollerIdVal);
+    napi_create_uint32(env, count, &countVal);
+    napi_create_uint32(env, bytes, &bytesVal);
 
     napi_value undefined;
     napi_get_undefined(env, &undefined);
-    napi_value argv[3] = { pollerIdVal, uint8Array, lengthVal };
-    napi_call_function(env, undefined, js_callback, 3, argv, nullptr);
-
-    free(cbd->data);
-    free(cbd);
+    napi_value argv[4] = { pollerIdVal, batchView, countVal, bytesVal };
+    napi_call_function(env, undefined, js_callback, 4, argv, nullptr);
 }
 
 static void ddkErrorCallbackOnJs(napi_env env, napi_value js_callback, void *context, void *rawData) {
@@ -340,203 +559,334 @@ static void ddkErrorCallbackOnJs(napi_env env, napi_value js_callback, void *con
 }
 
 // ============================================================
-// 轮询线程
+// 传输引擎
+//
+// IN 端点：inFlight 个工作线程各持一块 memmap 同时挂起请求 (双/三缓冲)，
+//   上一帧完成到下一次提交之间主机控制器仍有请求可用，轮询率不再受单次往返限制。
+//   请求返回时立即领取完成序号，按完成序号轮流进入有序段 (去重 / 路由 / 入环 / 统计)，
+//   有序段同一时刻只有一个线程，后续状态不会先于前序状态投递。
+//   不用提交序号：SendPipeRequest 是同步调用，领取序号与请求真正进入内核队列之间
+//   没有原子性，两个线程的提交可能互换，按提交序号发布会把较旧的报告排在较新的之后；
+//   同一中断端点上主机控制器按排队顺序填充请求，返回顺序才与数据先后一致。
+// OUT 端点：独立工作线程等待挂起输出，rumble/init 不再阻塞输入读取。
 // ============================================================
 
-static void *ddkPollThread(void *arg) {
-    int pollerId = (int)(intptr_t)arg;
-    DdkPollerContext *ctx = &g_ddkPollers[pollerId];
-
-    OH_LOG_INFO(LOG_APP, "[%{public}s] 轮询线程启动: id=%{public}d, inEp=0x%{public}x, maxPkt=%{public}u, timeout=%{public}ums",
-                LOG_TAG, pollerId, ctx->inEndpoint, ctx->maxPacketSize, ctx->timeoutMs);
-
-    // 轮询率统计
-    uint64_t statPollCount = 0;
-    uint64_t statStartTime = 0;
-    struct timespec ts;
-    clock_gettime(CLOCK_MONOTONIC, &ts);
-    statStartTime = ts.tv_sec * 1000ULL + ts.tv_nsec / 1000000ULL;
-
-    UsbRequestPipe pipe;
-    memset(&pipe, 0, sizeof(pipe));
-    pipe.interfaceHandle = ctx->interfaceHandle;
-    pipe.endpoint = ctx->inEndpoint;
-    pipe.timeout = ctx->timeoutMs;
-
-    // IO 错误重试计数
-    int consecutiveErrors = 0;
-    const int MAX_CONSECUTIVE_ERRORS = 10;  // 允许连续 10 次瞬态错误
-    uint64_t queueFullCount = 0;
-
-    while (ctx->running.load()) {
-        // ---- 优先处理挂起的输出数据 (rumble/init) ----
-        if (ctx->outMemMap && ctx->hasPendingOutput.load(std::memory_order_acquire)) {
-            UsbRequestPipe outPipe;
-            memset(&outPipe, 0, sizeof(outPipe));
-            outPipe.interfaceHandle = ctx->interfaceHandle;
-            outPipe.timeout = 100;  // 100ms 足够发送小数据包
-
-            uint32_t outLen;
-            {
-                std::lock_guard<std::mutex> lock(ctx->outMutex);
-                outLen = ctx->pendingOutLen;
-                outPipe.endpoint = ctx->pendingOutEndpoint;
-                memcpy(ctx->outMemMap->address, ctx->pendingOutData, outLen);
-                ctx->outMemMap->offset = 0;
-                ctx->outMemMap->bufferLength = outLen;
-                ctx->hasPendingOutput.store(false, std::memory_order_release);
-            }
+static uint32_t histRecordValue(uint64_t v) {
+    return v > UINT32_MAX ? UINT32_MAX : (uint32_t)v;
+}
 
-            int32_t outRet = fn_SendPipeRequest(&outPipe, ctx->outMemMap);
-            if (outRet != USB_DDK_SUCCESS) {
-                OH_LOG_WARN(LOG_APP, "[%{public}s] id=%{public}d 轮询线程 sendOutput 失败: ep=0x%{public}x len=%{public}u ret=%{public}d (%{public}s)",
-                            LOG_TAG, pollerId, outPipe.endpoint, outLen, outRet, ddkErrStr(outRet));
-            }
+// 轮询率 / 间隔统计 (有序段内调用)
+static void recordInterval(DdkPollerContext *ctx, uint64_t rxNs) {
+    if (ctx->lastRxNs != 0 && rxNs > ctx->lastRxNs) {
+        uint64_t intervalUs = (rxNs - ctx->lastRxNs) / 1000ULL;
+        ctx->intervalHist.Record(histRecordValue(intervalUs), DDK_INTERVAL_BUCKET_US);
+        if (ctx->lastIntervalUs != 0) {
+            uint64_t jitterUs = intervalUs > ctx->lastIntervalUs ? intervalUs - ctx->lastIntervalUs
+                                                                 : ctx->lastIntervalUs - intervalUs;
+            ctx->jitterHist.Record(histRecordValue(jitterUs), DDK_JITTER_BUCKET_US);
         }
+        ctx->lastIntervalUs = intervalUs;
+    }
+    ctx->lastRxNs = rxNs;
+}
 
-        // ---- 输入轮询 ----
-        ctx->inMemMap->offset = 0;
-        ctx->inMemMap->bufferLength = ctx->maxPacketSize;
-
-        int32_t ret = fn_SendPipeRequest(&pipe, ctx->inMemMap);
-
-        if (!ctx->running.load()) break;
+static void notifyPollerError(DdkPollerContext *ctx, int pollerId, int32_t ret) {
+    DdkErrorData *ped = (DdkErrorData *)malloc(sizeof(DdkErrorData));
+    if (ped) {
+        ped->errorCode = ret;
+        ped->pollerId = pollerId;
+        napi_status st = napi_call_threadsafe_function(ctx->errorTsfn, ped, napi_tsfn_nonblocking);
+        if (st != napi_ok) free(ped);
+    }
+}
 
-        if (ret == USB_DDK_SUCCESS) {
-            uint32_t len = ctx->inMemMap->transferedLength;
-            if (len == 0) continue;  // 零长度 - 跳过
-
-            statPollCount++;
-            ctx->totalReads.fetch_add(1);
-            ctx->totalBytes.fetch_add(len);
-
-            // 输入去重：只有数据变化时才入队，避免无限队列内存增长
-            // 同时保证按键释放等状态变化一定会被传递
-            if (ctx->lastInputValid && len == ctx->lastInputLen &&
-                len <= sizeof(ctx->lastInputData) &&
-                memcmp(ctx->inMemMap->address, ctx->lastInputData, len) == 0) {
-                ctx->totalSkippedDups.fetch_add(1);
-                // 数据未变化，跳过入队
-                goto skip_enqueue;
-            }
+/**
+ * 处理一次 IN 请求结果 (有序段内调用)
+ * @return true 表示轮询应停止
+ */
+static bool handleInResult(DdkPollerContext *ctx, int pollerId, int32_t ret, UsbDeviceMemMap *memMap) {
+    if (!ctx->running.load()) return true;
 
+    if (ret == USB_DDK_SUCCESS) {
+        uint32_t len = memMap->transferedLength;
+        if (len == 0) return false;  // 零长度 - 跳过
+        uint64_t rxNs = monotonicNs();
+        const uint8_t *data = memMap->address;
+
+        ctx->statPollCount++;
+        ctx->totalReads.fetch_add(1);
+        ctx->totalBytes.fetch_add(len);
+        recordInterval(ctx, rxNs);
+        // 成功读取 - 重置错误计数
+        ctx->consecutiveErrors = 0;
+
+        // 输入去重：只有数据变化时才入环，避免重复帧挤掉状态变化
+        if (ctx->lastInputValid && len == ctx->lastInputLen &&
+            len <= sizeof(ctx->lastInputData) &&
+            memcmp(data, ctx->lastInputData, len) == 0) {
+            ctx->totalSkippedDups.fetch_add(1);
+            ControllerInputRouter_OnIdle(pollerId);
+        } else {
             // 更新最后输入缓存
             if (len <= sizeof(ctx->lastInputData)) {
-                memcpy(ctx->lastInputData, ctx->inMemMap->address, len);
+                memcpy(ctx->lastInputData, data, len);
                 ctx->lastInputLen = len;
                 ctx->lastInputValid = true;
             }
 
-            // 分配回调数据
-            {
-                DdkCallbackData *cbd = (DdkCallbackData *)malloc(sizeof(DdkCallbackData));
-                if (cbd) {
-                    cbd->data = (uint8_t *)malloc(len);
-                    if (cbd->data) {
-                        memcpy(cbd->data, ctx->inMemMap->address, len);
-                        cbd->length = (int)len;
-                        cbd->pollerId = pollerId;
-
-                        napi_status st = napi_call_threadsafe_function(ctx->tsfn, cbd, napi_tsfn_nonblocking);
-                        if (st != napi_ok) {
-                            free(cbd->data);
-                            free(cbd);
-                            if (st == napi_closing) {
-                                OH_LOG_WARN(LOG_APP, "[%{public}s] id=%{public}d tsfn 已关闭，退出轮询", LOG_TAG, pollerId);
-                                goto exit_loop;
-                            }
-                            // 队列满 - 记录但不退出
-                            queueFullCount++;
-                            if (queueFullCount % 100 == 1) {
-                                OH_LOG_WARN(LOG_APP, "[%{public}s] id=%{public}d tsfn 队列满 (累计 %{public}llu 次)，JS 线程可能繁忙",
-                                            LOG_TAG, pollerId, (unsigned long long)queueFullCount);
-                            }
+            // native 输入路由：已绑定的手柄在本线程解析并直接发送给主机
+            int route = ControllerInputRouter_OnReport(pollerId, data, len, rxNs);
+            if (route != INPUT_ROUTE_CONSUMED) {
+                // 写入报告环；JS 线程尚无待执行的取数据调用时才调度 tsfn
+                ringPush(ctx, data, len, route == INPUT_ROUTE_FORWARD_ROUTED);
+                if (!ctx->drainScheduled.exchange(true, std::memory_order_acq_rel)) {
+                    uintptr_t drainToken = (uintptr_t)ctx->generation * DDK_MAX_POLLERS + (uintptr_t)pollerId;
+                    napi_status st = napi_call_threadsafe_function(ctx->tsfn, (void *)drainToken,
+                                                                   napi_tsfn_nonblocking);
+                    if (st != napi_ok) {
+                        // 帧留在环内，下一帧再尝试调度
+                        ctx->drainScheduled.store(false, std::memory_order_release);
+                        if (st == napi_closing) {
+                            OH_LOG_WARN(LOG_APP, "[%{public}s] id=%{public}d tsfn 已关闭，退出轮询", LOG_TAG, pollerId);
+                            ctx->running.store(false);
+                            return true;
+                        }
+                        ctx->queueFullCount++;
+                        if (ctx->queueFullCount % 100 == 1) {
+                            OH_LOG_WARN(LOG_APP, "[%{public}s] id=%{public}d tsfn 调度失败 (累计 %{public}llu 次)，JS 线程可能繁忙",
+                                        LOG_TAG, pollerId, (unsigned long long)ctx->queueFullCount);
                         }
-                    } else {
-                        free(cbd);
                     }
                 }
             }
+        }
 
-skip_enqueue:
-            // 成功读取 - 重置错误计数
-            consecutiveErrors = 0;
-
-            // 统计日志 (每5秒)
-            clock_gettime(CLOCK_MONOTONIC, &ts);
-            uint64_t now = ts.tv_sec * 1000ULL + ts.tv_nsec / 1000000ULL;
-            if (now - statStartTime >= 5000) {
-                double rate = (double)statPollCount * 1000.0 / (double)(now - statStartTime);
-                uint64_t dups = ctx->totalSkippedDups.load();
-                OH_LOG_INFO(LOG_APP, "[%{public}s] id=%{public}d 轮询率: %{public}.1f Hz (%{public}llu 次/%{public}.1f秒, 去重跳过=%{public}llu)%{public}s",
-                            LOG_TAG, pollerId, rate,
-                            (unsigned long long)statPollCount,
-                            (double)(now - statStartTime) / 1000.0,
-                            (unsigned long long)dups,
-                            queueFullCount > 0 ? " [有队列满]" : "");
-                statPollCount = 0;
-                statStartTime = now;
-                queueFullCount = 0;
-            }
-        } else if (ret == USB_DDK_TIMEOUT) {
-            // 超时 - 正常，重置错误计数
-            consecutiveErrors = 0;
-            continue;
-        } else {
-            // 错误
-            consecutiveErrors++;
-            OH_LOG_ERROR(LOG_APP, "[%{public}s] id=%{public}d SendPipeRequest 失败: %{public}d (%{public}s), 连续错误=%{public}d/%{public}d",
-                         LOG_TAG, pollerId, ret, ddkErrStr(ret), consecutiveErrors, MAX_CONSECUTIVE_ERRORS);
-
-            // IO 错误处理 - 允许一定次数的瞬态错误重试
-            if (ret == USB_DDK_IO_FAILED || ret == USB_DDK_INVALID_OP) {
-                if (ctx->ignoreDisconnect.load()) {
-                    OH_LOG_WARN(LOG_APP, "[%{public}s] id=%{public}d 错误(%{public}s)但忽略断开信号已启用，50ms 后继续轮询",
-                                LOG_TAG, pollerId, ddkErrStr(ret));
-                    usleep(50 * 1000);  // 50ms
-                    continue;
-                }
+        // 轮询率统计：每秒一个样本进直方图，每 5 秒打印一次
+        uint64_t nowMs = rxNs / 1000000ULL;
+        if (ctx->rateWindowStartMs == 0) ctx->rateWindowStartMs = nowMs;
+        ctx->rateWindowCount++;
+        if (nowMs - ctx->rateWindowStartMs >= 1000) {
+            uint64_t hz = ctx->rateWindowCount * 1000ULL / (nowMs - ctx->rateWindowStartMs);
+            ctx->pollRateHist.Record(histRecordValue(hz), DDK_POLL_RATE_BUCKET_HZ);
+            ctx->rateWindowStartMs = nowMs;
+            ctx->rateWindowCount = 0;
+        }
+        if (ctx->statStartMs == 0) ctx->statStartMs = nowMs;
+        if (nowMs - ctx->statStartMs >= 5000) {
+            double rate = (double)ctx->statPollCount * 1000.0 / (double)(nowMs - ctx->statStartMs);
+            uint64_t dups = ctx->totalSkippedDups.load();
+            uint64_t coalesced = ctx->reportsCoalesced.load(std::memory_order_relaxed);
+            OH_LOG_INFO(LOG_APP, "[%{public}s] id=%{public}d 轮询率: %{public}.1f Hz (%{public}llu 次/%{public}.1f秒, 去重跳过=%{public}llu, 环满合并=%{public}llu, 间隔 p99=%{public}uus)%{public}s",
+                        LOG_TAG, pollerId, rate,
+                        (unsigned long long)ctx->statPollCount,
+                        (double)(nowMs - ctx->statStartMs) / 1000.0,
+                        (unsigned long long)dups,
+                        (unsigned long long)(coalesced - ctx->lastLoggedCoalesced),
+                        ctx->intervalHist.Percentile(0.99, DDK_INTERVAL_BUCKET_US),
+                        ctx->queueFullCount > 0 ? " [tsfn 调度失败]" : "");
+            ctx->statPollCount = 0;
+            ctx->statStartMs = nowMs;
+            ctx->queueFullCount = 0;
+            ctx->lastLoggedCoalesced = coalesced;
+        }
+        return false;
+    }
 
-                // 非忽略模式：允许少量瞬态错误，连续达到阈值才退出
-                if (consecutiveErrors < MAX_CONSECUTIVE_ERRORS) {
-                    OH_LOG_WARN(LOG_APP, "[%{public}s] id=%{public}d 瞬态IO错误，%{public}dms 后重试 (%{public}d/%{public}d)",
-                                LOG_TAG, pollerId, 20 * consecutiveErrors, consecutiveErrors, MAX_CONSECUTIVE_ERRORS);
-                    usleep(20 * 1000 * consecutiveErrors);  // 递增退避: 20ms, 40ms, ...
-                    continue;
-                }
+    if (ret == USB_DDK_TIMEOUT) {
+        // 超时 - 正常，重置错误计数
+        ctx->consecutiveErrors = 0;
+        ControllerInputRouter_OnIdle(pollerId);
+        return false;
+    }
 
-                // 连续错误达到阈值 - 通知 JS 并退出
-                OH_LOG_ERROR(LOG_APP, "[%{public}s] id=%{public}d 连续 %{public}d 次IO错误，停止轮询",
-                             LOG_TAG, pollerId, consecutiveErrors);
+    // 错误
+    const int MAX_CONSECUTIVE_ERRORS = 10;  // 允许连续 10 次瞬态错误
+    ctx->consecutiveErrors++;
+    OH_LOG_ERROR(LOG_APP, "[%{public}s] id=%{public}d SendPipeRequest 失败: %{public}d (%{public}s), 连续错误=%{public}d/%{public}d",
+                 LOG_TAG, pollerId, ret, ddkErrStr(ret), ctx->consecutiveErrors, MAX_CONSECUTIVE_ERRORS);
+
+    // IO 错误处理 - 允许一定次数的瞬态错误重试
+    if (ret == USB_DDK_IO_FAILED || ret == USB_DDK_INVALID_OP) {
+        if (ctx->ignoreDisconnect.load()) {
+            OH_LOG_WARN(LOG_APP, "[%{public}s] id=%{public}d 错误(%{public}s)但忽略断开信号已启用，50ms 后继续轮询",
+                        LOG_TAG, pollerId, ddkErrStr(ret));
+            deferInRequests(ctx, 50);
+            return false;
+        }
 
-                DdkErrorData *ped = (DdkErrorData *)malloc(sizeof(DdkErrorData));
-                if (ped) {
-                    ped->errorCode = ret;
-                    ped->pollerId = pollerId;
-                    napi_status st = napi_call_threadsafe_function(ctx->errorTsfn, ped, napi_tsfn_nonblocking);
-                    if (st != napi_ok) free(ped);
-                }
-                break;
+        // 非忽略模式：允许少量瞬态错误，连续达到阈值才退出
+        if (ctx->consecutiveErrors < MAX_CONSECUTIVE_ERRORS) {
+            OH_LOG_WARN(LOG_APP, "[%{public}s] id=%{public}d 瞬态IO错误，%{public}dms 后重试 (%{public}d/%{public}d)",
+                        LOG_TAG, pollerId, 20 * ctx->consecutiveErrors, ctx->consecutiveErrors, MAX_CONSECUTIVE_ERRORS);
+            deferInRequests(ctx, 20 * (uint32_t)ctx->consecutiveErrors);  // 递增退避: 20ms, 40ms, ...
+            return false;
+        }
+
+        // 连续错误达到阈值 - 通知 JS 并退出
+        OH_LOG_ERROR(LOG_APP, "[%{public}s] id=%{public}d 连续 %{public}d 次IO错误，停止轮询",
+                     LOG_TAG, pollerId, ctx->consecutiveErrors);
+        notifyPollerError(ctx, pollerId, ret);
+        ctx->running.store(false);
+        return true;
+    }
+
+    // 其他非 IO 错误 - 通知 JS
+    notifyPollerError(ctx, pollerId, ret);
+    return false;
+}
+
+// IN 工作线程：arg = pollerId * DDK_MAX_IN_FLIGHT + memmap 下标
+static void *ddkInWorker(void *arg) {
+    int token = (int)(intptr_t)arg;
+    int pollerId = token / DDK_MAX_IN_FLIGHT;
+    int index = token % DDK_MAX_IN_FLIGHT;
+    DdkPollerContext *ctx = &g_ddkPollers[pollerId];
+    UsbDeviceMemMap *memMap = ctx->inMemMaps[index];
+
+    OH_LOG_INFO(LOG_APP, "[%{public}s] IN 线程启动: id=%{public}d/%{public}d, inEp=0x%{public}x, maxPkt=%{public}u, timeout=%{public}ums",
+                LOG_TAG, pollerId, index, ctx->inEndpoint, ctx->maxPacketSize, ctx->timeoutMs);
+
+    UsbRequestPipe pipe;
+    memset(&pipe, 0, sizeof(pipe));
+    pipe.interfaceHandle = ctx->interfaceHandle;
+    pipe.endpoint = ctx->inEndpoint;
+    pipe.timeout = ctx->timeoutMs;
+
+    while (ctx->running.load()) {
+        // 预留提交时刻：错误退避与温控限速 (两次 IN 请求之间至少间隔 minPollIntervalUs)
+        // 锁内只计算并预留，等待在锁外进行，不阻塞其他线程领取时刻
+        uint64_t startNs;
+        {
+            std::lock_guard<std::mutex> lock(ctx->inSubmitMutex);
+            if (!ctx->running.load()) break;
+            startNs = monotonicNs();
+            if (ctx->inBackoffUntilNs > startNs) startNs = ctx->inBackoffUntilNs;
+            uint32_t minIntervalUs = g_minPollIntervalUs.load(std::memory_order_relaxed);
+            if (minIntervalUs > 0 && ctx->lastInRequestNs != 0) {
+                uint64_t nextNs = ctx->lastInRequestNs + (uint64_t)minIntervalUs * 1000ULL;
+                if (nextNs > startNs) startNs = nextNs;
             }
+            ctx->lastInRequestNs = startNs;
+        }
+        uint64_t nowNs = monotonicNs();
+        if (nowNs < startNs) {
+            usleep((useconds_t)((startNs - nowNs) / 1000ULL));
+            if (!ctx->running.load()) break;
+        }
+
+        memMap->offset = 0;
+        memMap->bufferLength = ctx->maxPacketSize;
+        int32_t ret = fn_SendPipeRequest(&pipe, memMap);
+        // 返回后第一件事领取完成序号：两次中断传输至少相隔一个 bInterval (≥125us)，
+        // 远大于返回到这里的几条指令，序号顺序即数据先后
+        uint64_t seq = ctx->inCompleteSeq.fetch_add(1, std::memory_order_relaxed);
+
+        // 按完成顺序进入有序段；每个已领取的序号都必须放行，否则后续线程永远等待
+        {
+            std::unique_lock<std::mutex> lock(ctx->inPublishMutex);
+            ctx->inPublishCv.wait(lock, [ctx, seq] { return ctx->inPublishTurn == seq; });
+        }
+        bool stop = handleInResult(ctx, pollerId, ret, memMap);
+        {
+            std::lock_guard<std::mutex> lock(ctx->inPublishMutex);
+            ctx->inPublishTurn++;
+        }
+        ctx->inPublishCv.notify_all();
+        if (stop) break;
+        // 有序段外：补发被限频推迟的振动更新
+        HapticsRouter_OnPollerTick(pollerId);
+    }
+
+    OH_LOG_INFO(LOG_APP, "[%{public}s] IN 线程退出: id=%{public}d/%{public}d, reads=%{public}llu",
+                LOG_TAG, pollerId, index, (unsigned long long)ctx->totalReads.load());
+    ctx->running.store(false);
+    ctx->outCv.notify_all();
+    return nullptr;
+}
+
+// OUT 工作线程：等待挂起输出 (latest-wins) 并发送
+static void *ddkOutWorker(void *arg) {
+    int pollerId = (int)(intptr_t)arg;
+    DdkPollerContext *ctx = &g_ddkPollers[pollerId];
 
-            // 其他非 IO 错误 - 通知 JS
-            DdkErrorData *ped = (DdkErrorData *)malloc(sizeof(DdkErrorData));
-            if (ped) {
-                ped->errorCode = ret;
-                ped->pollerId = pollerId;
-                napi_status st = napi_call_threadsafe_function(ctx->errorTsfn, ped, napi_tsfn_nonblocking);
-                if (st != napi_ok) free(ped);
+    UsbRequestPipe outPipe;
+    memset(&outPipe, 0, sizeof(outPipe));
+    outPipe.interfaceHandle = ctx->interfaceHandle;
+    outPipe.timeout = 100;  // 100ms 足够发送小数据包
+
+    while (true) {
+        uint32_t outLen;
+        uint64_t originNs;
+        {
+            std::unique_lock<std::mutex> lock(ctx->outMutex);
+            ctx->outCv.wait(lock, [ctx] {
+                return !ctx->running.load() || ctx->hasPendingOutput.load(std::memory_order_acquire);
+            });
+            // 停止时残留的输出由 stopPoller 统一 flush
+            if (!ctx->running.load()) break;
+            outLen = ctx->pendingOutLen;
+            outPipe.endpoint = ctx->pendingOutEndpoint;
+            originNs = ctx->pendingOutOriginNs;
+            memcpy(ctx->outMemMap->address, ctx->pendingOutData, outLen);
+            ctx->outMemMap->offset = 0;
+            ctx->outMemMap->bufferLength = outLen;
+            ctx->hasPendingOutput.store(false, std::memory_order_release);
+        }
+
+        int32_t outRet = fn_SendPipeRequest(&outPipe, ctx->outMemMap);
+        if (outRet == USB_DDK_SUCCESS) {
+            ctx->outSent.fetch_add(1, std::memory_order_relaxed);
+            if (originNs != 0) {
+                uint64_t doneNs = monotonicNs();
+                uint64_t ns = doneNs > originNs ? doneNs - originNs : 0;
+                ctx->outStampedCount.fetch_add(1, std::memory_order_relaxed);
+                ctx->outStampedTotalNs.fetch_add(ns, std::memory_order_relaxed);
+                if (ns > ctx->outStampedMaxNs.load(std::memory_order_relaxed)) {
+                    ctx->outStampedMaxNs.store(ns, std::memory_order_relaxed);
+                }
             }
+        } else {
+            ctx->outFailed.fetch_add(1, std::memory_order_relaxed);
+            OH_LOG_WARN(LOG_APP, "[%{public}s] id=%{public}d OUT 线程 sendOutput 失败: ep=0x%{public}x len=%{public}u ret=%{public}d (%{public}s)",
+                        LOG_TAG, pollerId, outPipe.endpoint, outLen, outRet, ddkErrStr(outRet));
         }
     }
 
-exit_loop:
-    OH_LOG_INFO(LOG_APP, "[%{public}s] 轮询线程退出: id=%{public}d, reads=%{public}llu",
-                LOG_TAG, pollerId,
-                (unsigned long long)ctx->totalReads.load());
+    OH_LOG_INFO(LOG_APP, "[%{public}s] OUT 线程退出: id=%{public}d, sent=%{public}llu",
+                LOG_TAG, pollerId, (unsigned long long)ctx->outSent.load());
+    return nullptr;
+}
 
+// 停止并等待全部工作线程 (调用方不持有 g_ddkMutex)
+static void joinWorkers(DdkPollerContext *ctx) {
     ctx->running.store(false);
-    return nullptr;
+    {
+        // 持锁后再通知，避免 OUT 线程在检查条件与进入等待之间错过唤醒
+        std::lock_guard<std::mutex> lock(ctx->outMutex);
+    }
+    ctx->outCv.notify_all();
+    for (uint32_t i = 0; i < ctx->inThreadCount; i++) {
+        pthread_join(ctx->inThreads[i], nullptr);
+    }
+    ctx->inThreadCount = 0;
+    if (ctx->outThreadCreated) {
+        pthread_join(ctx->outThread, nullptr);
+        ctx->outThreadCreated = false;
+    }
+}
+
+static void destroyMemMaps(DdkPollerContext *ctx) {
+    for (int i = 0; i < DDK_MAX_IN_FLIGHT; i++) {
+        if (ctx->inMemMaps[i]) {
+            fn_DestroyDeviceMemMap(ctx->inMemMaps[i]);
+            ctx->inMemMaps[i] = nullptr;
+        }
+    }
+    ctx->inFlight = 0;
+    if (ctx->outMemMap) {
+        fn_DestroyDeviceMemMap(ctx->outMemMap);
+        ctx->outMemMap = nullptr;
+    }
 }
 
 // ============================================================
@@ -703,8 +1053,8 @@ static napi_value DdkPoller_FindDevice(napi_env env, napi_callback_info info) {
 // ============================================================
 
 static napi_value DdkPoller_StartPoller(napi_env env, napi_callback_info info) {
-    size_t argc = 8;
-    napi_value args[8];
+    size_t argc = 9;
+    napi_value args[9];
     napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
 
     if (argc < 7) {
@@ -717,6 +1067,7 @@ static napi_value DdkPoller_StartPoller(napi_env env, napi_callback_info info) {
     // 解析参数
     int64_t deviceId64 = 0;
     int32_t ifaceIndex = 0, inEp = 0, outEp = 0, maxPkt = 64, timeoutMs = 100;
+    int32_t inFlight = DDK_DEFAULT_IN_FLIGHT;
     napi_get_value_int64(env, args[0], &deviceId64);
     napi_get_value_int32(env, args[1], &ifaceIndex);
     napi_get_value_int32(env, args[2], &inEp);
@@ -727,11 +1078,16 @@ static napi_value DdkPoller_StartPoller(napi_env env, napi_callback_info info) {
     if (argc >= 8) {
         napi_get_value_int32(env, args[7], &timeoutMs);
     }
+    if (argc >= 9) {
+        napi_get_value_int32(env, args[8], &inFlight);
+    }
+    if (inFlight < 1) inFlight = 1;
+    if (inFlight > DDK_MAX_IN_FLIGHT) inFlight = DDK_MAX_IN_FLIGHT;
 
     uint64_t deviceId = (uint64_t)deviceId64;
 
-    OH_LOG_INFO(LOG_APP, "[%{public}s] startPoller: deviceId=%{public}llu iface=%{public}d inEp=0x%{public}x outEp=0x%{public}x maxPkt=%{public}d timeout=%{public}dms",
-                LOG_TAG, (unsigned long long)deviceId, ifaceIndex, inEp, outEp, maxPkt, timeoutMs);
+    OH_LOG_INFO(LOG_APP, "[%{public}s] startPoller: deviceId=%{public}llu iface=%{public}d inEp=0x%{public}x outEp=0x%{public}x maxPkt=%{public}d timeout=%{public}dms inFlight=%{public}d",
+                LOG_TAG, (unsigned long long)deviceId, ifaceIndex, inEp, outEp, maxPkt, timeoutMs, inFlight);
 
     if (!g_ddkInited) {
         OH_LOG_ERROR(LOG_APP, "[%{public}s] DDK 未初始化", LOG_TAG);
@@ -752,10 +1108,7 @@ static napi_value DdkPoller_StartPoller(napi_env env, napi_callback_info info) {
     }
 
     DdkPollerContext *ctx = &g_ddkPollers[pollerId];
-    memset(ctx, 0, sizeof(DdkPollerContext));
-    ctx->running.store(false);
-    ctx->totalSkippedDups.store(0);
-    ctx->lastInputValid = false;
+    resetPollerLocked(ctx);
 
     // Step 1: 声明接口 (带重试，等待 usbManager 释放设备)
     int32_t ret = -1;
@@ -788,9 +1141,20 @@ static napi_value DdkPoller_StartPoller(napi_env env, napi_callback_info info) {
     OH_LOG_INFO(LOG_APP, "[%{public}s] 接口已声明: handle=%{public}llu",
                 LOG_TAG, (unsigned long long)ctx->interfaceHandle);
 
-    // Step 2: 创建输入内存映射
-    ret = fn_CreateDeviceMemMap(deviceId, (size_t)maxPkt, &ctx->inMemMap);
-    if (ret != USB_DDK_SUCCESS || !ctx->inMemMap) {
+    // Step 2: 创建输入内存映射 (每个挂起请求一块；第一块失败才算失败，其余失败则降低并发)
+    for (int i = 0; i < inFlight; i++) {
+        ret = fn_CreateDeviceMemMap(deviceId, (size_t)maxPkt, &ctx->inMemMaps[i]);
+        if (ret != USB_DDK_SUCCESS || !ctx->inMemMaps[i]) {
+            ctx->inMemMaps[i] = nullptr;
+            if (i > 0) {
+                OH_LOG_WARN(LOG_APP, "[%{public}s] CreateDeviceMemMap(IN #%{public}d) 失败: %{public}d, 并发降为 %{public}d",
+                            LOG_TAG, i, ret, i);
+            }
+            break;
+        }
+        ctx->inFlight = (uint32_t)(i + 1);
+    }
+    if (ctx->inFlight == 0) {
         fn_ReleaseInterface(ctx->interfaceHandle);
         ctx->interfaceClaimed = false;
         pthread_mutex_unlock(&g_ddkMutex);
@@ -809,10 +1173,9 @@ static napi_value DdkPoller_StartPoller(napi_env env, napi_callback_info info) {
                         LOG_TAG, ret, ddkErrStr(ret));
             ctx->outMemMap = nullptr;
             // 输出不可用 → 回退到 usbManager，保障振动等输出功能
-            fn_DestroyDeviceMemMap(ctx->inMemMap);
+            destroyMemMaps(ctx);
             fn_ReleaseInterface(ctx->interfaceHandle);
             ctx->interfaceClaimed = false;
-            ctx->inMemMap = nullptr;
             pthread_mutex_unlock(&g_ddkMutex);
             napi_value r;
             napi_create_int32(env, -1, &r);
@@ -831,26 +1194,49 @@ static napi_value DdkPoller_StartPoller(napi_env env, napi_callback_info info) {
     ctx->outEndpoint = (uint8_t)outEp;
     ctx->maxPacketSize = (uint32_t)maxPkt;
     ctx->timeoutMs = (uint32_t)timeoutMs;
-    ctx->totalReads.store(0);
-    ctx->totalBytes.store(0);
-    ctx->ignoreDisconnect.store(false);
+    if (++g_ddkGeneration == 0) ++g_ddkGeneration;
+    {
+        std::lock_guard<std::mutex> lock(ctx->outMutex);
+        ctx->generation = g_ddkGeneration;
+    }
 
-    // Step 4: 创建 threadsafe functions
+    // Step 4: 创建批量缓冲区视图 (外部 ArrayBuffer 直接引用 ctx->jsBatch，整个轮询期间复用)
+    napi_value batchBuffer = nullptr;
+    napi_value batchView = nullptr;
+    napi_status status = napi_create_external_arraybuffer(env, ctx->jsBatch, sizeof(ctx->jsBatch),
+                                                          nullptr, nullptr, &batchBuffer);
+    if (status == napi_ok) {
+        status = napi_create_typedarray(env, napi_uint8_array, sizeof(ctx->jsBatch), batchBuffer, 0, &batchView);
+    }
+    if (status == napi_ok) {
+        status = napi_create_reference(env, batchView, 1, &ctx->jsBatchViewRef);
+    }
+    if (status != napi_ok) {
+        ctx->jsBatchViewRef = nullptr;
+        destroyMemMaps(ctx);
+        fn_ReleaseInterface(ctx->interfaceHandle);
+        ctx->interfaceClaimed = false;
+        pthread_mutex_unlock(&g_ddkMutex);
+        OH_LOG_ERROR(LOG_APP, "[%{public}s] 创建批量缓冲区失败: %{public}d", LOG_TAG, status);
+        napi_value r;
+        napi_create_int32(env, -1, &r);
+        return r;
+    }
+
+    // Step 5: 创建 threadsafe functions
     napi_value dataResName;
     napi_create_string_utf8(env, "DdkPollerData", NAPI_AUTO_LENGTH, &dataResName);
-    napi_status status = napi_create_threadsafe_function(
+    status = napi_create_threadsafe_function(
         env, args[5], nullptr, dataResName,
-        0,    // max queue size (0 = unlimited, 确保按键释放事件不因队列满而丢失)
+        0,    // max queue size (0 = unlimited; drainScheduled 保证每个 poller 最多一个待执行调用)
         1, nullptr, nullptr, nullptr,
         ddkDataCallbackOnJs, &ctx->tsfn
     );
     if (status != napi_ok) {
-        if (ctx->outMemMap) fn_DestroyDeviceMemMap(ctx->outMemMap);
-        fn_DestroyDeviceMemMap(ctx->inMemMap);
+        releaseBatchView(env, ctx);
+        destroyMemMaps(ctx);
         fn_ReleaseInterface(ctx->interfaceHandle);
         ctx->interfaceClaimed = false;
-        ctx->inMemMap = nullptr;
-        ctx->outMemMap = nullptr;
         pthread_mutex_unlock(&g_ddkMutex);
         OH_LOG_ERROR(LOG_APP, "[%{public}s] 创建 data tsfn 失败", LOG_TAG);
         napi_value r;
@@ -868,12 +1254,10 @@ static napi_value DdkPoller_StartPoller(napi_env env, napi_callback_info info) {
     if (status != napi_ok) {
         napi_release_threadsafe_function(ctx->tsfn, napi_tsfn_abort);
         ctx->tsfn = nullptr;
-        if (ctx->outMemMap) fn_DestroyDeviceMemMap(ctx->outMemMap);
-        fn_DestroyDeviceMemMap(ctx->inMemMap);
+        releaseBatchView(env, ctx);
+        destroyMemMaps(ctx);
         fn_ReleaseInterface(ctx->interfaceHandle);
         ctx->interfaceClaimed = false;
-        ctx->inMemMap = nullptr;
-        ctx->outMemMap = nullptr;
         pthread_mutex_unlock(&g_ddkMutex);
         OH_LOG_ERROR(LOG_APP, "[%{public}s] 创建 error tsfn 失败", LOG_TAG);
         napi_value r;
@@ -881,21 +1265,28 @@ static napi_value DdkPoller_StartPoller(napi_env env, napi_callback_info info) {
         return r;
     }
 
-    // Step 5: 启动轮询线程
+    // Step 6: 启动工作线程 (OUT 一个，IN 每块 memmap 一个)
     ctx->running.store(true);
-    int pret = pthread_create(&ctx->thread, nullptr, ddkPollThread, (void *)(intptr_t)pollerId);
+    int pret = 0;
+    if (ctx->outMemMap) {
+        pret = pthread_create(&ctx->outThread, nullptr, ddkOutWorker, (void *)(intptr_t)pollerId);
+        ctx->outThreadCreated = (pret == 0);
+    }
+    for (uint32_t i = 0; pret == 0 && i < ctx->inFlight; i++) {
+        pret = pthread_create(&ctx->inThreads[i], nullptr, ddkInWorker,
+                              (void *)(intptr_t)(pollerId * DDK_MAX_IN_FLIGHT + (int)i));
+        if (pret == 0) ctx->inThreadCount++;
+    }
     if (pret != 0) {
-        ctx->running.store(false);
+        joinWorkers(ctx);
         napi_release_threadsafe_function(ctx->tsfn, napi_tsfn_abort);
         napi_release_threadsafe_function(ctx->errorTsfn, napi_tsfn_abort);
         ctx->tsfn = nullptr;
         ctx->errorTsfn = nullptr;
-        if (ctx->outMemMap) fn_DestroyDeviceMemMap(ctx->outMemMap);
-        fn_DestroyDeviceMemMap(ctx->inMemMap);
+        releaseBatchView(env, ctx);
+        destroyMemMaps(ctx);
         fn_ReleaseInterface(ctx->interfaceHandle);
         ctx->interfaceClaimed = false;
-        ctx->inMemMap = nullptr;
-        ctx->outMemMap = nullptr;
         pthread_mutex_unlock(&g_ddkMutex);
         OH_LOG_ERROR(LOG_APP, "[%{public}s] pthread_create 失败: %{public}d", LOG_TAG, pret);
         napi_value r;
@@ -906,10 +1297,10 @@ static napi_value DdkPoller_StartPoller(napi_env env, napi_callback_info info) {
     ctx->threadCreated = true;
     pthread_mutex_unlock(&g_ddkMutex);
 
-    OH_LOG_INFO(LOG_APP, "[%{public}s] Poller 启动成功: id=%{public}d, deviceId=%{public}llu, handle=%{public}llu",
+    OH_LOG_INFO(LOG_APP, "[%{public}s] Poller 启动成功: id=%{public}d, deviceId=%{public}llu, handle=%{public}llu, inFlight=%{public}u",
                 LOG_TAG, pollerId,
                 (unsigned long long)deviceId,
-                (unsigned long long)ctx->interfaceHandle);
+                (unsigned long long)ctx->interfaceHandle, ctx->inFlight);
 
     napi_value r;
     napi_create_int32(env, pollerId, &r);
@@ -949,8 +1340,9 @@ static napi_value DdkPoller_StopPoller(napi_env env, napi_callback_info info) {
     ctx->running.store(false);
     pthread_mutex_unlock(&g_ddkMutex);
 
-    // 等待线程退出
-    pthread_join(ctx->thread, nullptr);
+    // 等待 IN / OUT 工作线程退出
+    joinWorkers(ctx);
+    ControllerInputRouter_OnPollerStopped(pollerId);
 
     // 发送残留的挂起输出 (例如 stop() 前的 rumble(0,0))
     if (ctx->hasPendingOutput.load() && ctx->outMemMap && ctx->interfaceClaimed) {
@@ -984,16 +1376,15 @@ static napi_value DdkPoller_StopPoller(napi_env env, napi_callback_info info) {
         napi_release_threadsafe_function(ctx->errorTsfn, napi_tsfn_release);
         ctx->errorTsfn = nullptr;
     }
+    // 之后执行的遗留 tsfn 调用按 generation 丢弃
+    releaseBatchView(env, ctx);
+    {
+        std::lock_guard<std::mutex> lock(ctx->outMutex);
+        ctx->generation = 0;
+    }
 
     // 释放内存映射
-    if (ctx->outMemMap) {
-        fn_DestroyDeviceMemMap(ctx->outMemMap);
-        ctx->outMemMap = nullptr;
-    }
-    if (ctx->inMemMap) {
-        fn_DestroyDeviceMemMap(ctx->inMemMap);
-        ctx->inMemMap = nullptr;
-    }
+    destroyMemMaps(ctx);
 
     // 释放接口
     if (ctx->interfaceClaimed) {
@@ -1074,14 +1465,8 @@ static napi_value DdkPoller_SendOutput(napi_env env, napi_callback_info info) {
 
     // 轮询线程运行中 → 非阻塞: 存入 pending buffer, 由轮询线程发送
     if (ctx->running.load()) {
-        {
-            std::lock_guard<std::mutex> lock(ctx->outMutex);
-            memcpy(ctx->pendingOutData, inputData, inputLen);
-            ctx->pendingOutLen = (uint32_t)inputLen;
-            ctx->pendingOutEndpoint = (uint8_t)endpoint;
-        }
-        ctx->hasPendingOutput.store(true, std::memory_order_release);
-        napi_create_int32(env, (int32_t)inputLen, &result);
+        bool queued = queuePendingOutput(ctx, 0, (uint8_t)endpoint, inputData, (uint32_t)inputLen, 0);
+        napi_create_int32(env, queued ? (int32_t)inputLen : -1, &result);
         return result;
     }
 
@@ -1109,9 +1494,85 @@ static napi_value DdkPoller_SendOutput(napi_env env, napi_callback_info info) {
 }
 
 // ============================================================
-// NAPI: getStats(pollerId) → { totalReads, totalBytes }
+// Native 输出接口
 // ============================================================
 
+uint32_t UsbDdkPoller_GetGeneration(int pollerId) {
+    if (pollerId < 0 || pollerId >= DDK_MAX_POLLERS) {
+        return 0;
+    }
+    DdkPollerContext *ctx = &g_ddkPollers[pollerId];
+    std::lock_guard<std::mutex> lock(ctx->outMutex);
+    return ctx->generation;
+}
+
+int UsbDdkPoller_QueueOutput(int pollerId, uint32_t generation, uint8_t endpoint, const uint8_t *data,
+                             uint32_t len, uint64_t originNs) {
+    if (pollerId < 0 || pollerId >= DDK_MAX_POLLERS || generation == 0 || !data || len == 0 || len > 64) {
+        return -1;
+    }
+    if (!queuePendingOutput(&g_ddkPollers[pollerId], generation, endpoint, data, len, originNs)) {
+        return -1;
+    }
+    return (int)len;
+}
+
+void UsbDdkPoller_SetMinPollIntervalUs(uint32_t intervalUs) {
+    uint32_t prev = g_minPollIntervalUs.exchange(intervalUs, std::memory_order_relaxed);
+    if (prev != intervalUs) {
+        OH_LOG_INFO(LOG_APP, "[%{public}s] 最小轮询间隔: %{public}uus", LOG_TAG, intervalUs);
+    }
+}
+
+bool UsbDdkPoller_GetOutputStats(int pollerId, UsbDdkOutputStats *out) {
+    if (pollerId < 0 || pollerId >= DDK_MAX_POLLERS || !out) {
+        return false;
+    }
+    DdkPollerContext *ctx = &g_ddkPollers[pollerId];
+    out->sent = ctx->outSent.load(std::memory_order_relaxed);
+    out->failed = ctx->outFailed.load(std::memory_order_relaxed);
+    out->stampedCount = ctx->outStampedCount.load(std::memory_order_relaxed);
+    out->stampedTotalNs = ctx->outStampedTotalNs.load(std::memory_order_relaxed);
+    out->stampedMaxNs = ctx->outStampedMaxNs.load(std::memory_order_relaxed);
+    return true;
+}
+
+// ============================================================
+// NAPI: getStats(pollerId) → { totalReads, totalBytes, reportsQueued, reportsCoalesced,
+//                               reportsDelivered, jsBatches, inFlight,
+//                               interval / jitter / pollRate 直方图与分位数 }
+// ============================================================
+
+// 写入 <name>Histogram (桶计数数组) / <name>Bucket<unit> / <name>P50<unit> / P99 / P999 / Max
+template <int BucketCount>
+static void setHistogramStats(napi_env env, napi_value obj, const char *name, const char *unit,
+                              const LatencyHistogram<BucketCount> &hist, uint32_t bucketWidth) {
+    char key[48];
+    napi_value arr;
+    napi_create_array_with_length(env, BucketCount, &arr);
+    for (int i = 0; i < BucketCount; i++) {
+        napi_value v;
+        napi_create_int64(env, (int64_t)hist.Bucket(i), &v);
+        napi_set_element(env, arr, (uint32_t)i, v);
+    }
+    snprintf(key, sizeof(key), "%sHistogram", name);
+    napi_set_named_property(env, obj, key, arr);
+
+    struct { const char *suffix; uint32_t value; } fields[] = {
+        { "Bucket", bucketWidth },
+        { "P50", hist.Percentile(0.50, bucketWidth) },
+        { "P99", hist.Percentile(0.99, bucketWidth) },
+        { "P999", hist.Percentile(0.999, bucketWidth) },
+        { "Max", hist.Max() },
+    };
+    for (const auto &f : fields) {
+        napi_value v;
+        napi_create_uint32(env, f.value, &v);
+        snprintf(key, sizeof(key), "%s%s%s", name, f.suffix, unit);
+        napi_set_named_property(env, obj, key, v);
+    }
+}
+
 static napi_value DdkPoller_GetStats(napi_env env, napi_callback_info info) {
     size_t argc = 1;
     napi_value args[1];
@@ -1130,6 +1591,23 @@ static napi_value DdkPoller_GetStats(napi_env env, napi_callback_info info) {
         napi_create_int64(env, (int64_t)ctx->totalBytes.load(), &bytes);
         napi_set_named_property(env, result, "totalReads", reads);
         napi_set_named_property(env, result, "totalBytes", bytes);
+
+        napi_value queued, coalesced, delivered, batches;
+        napi_create_int64(env, (int64_t)ctx->reportsQueued.load(std::memory_order_relaxed), &queued);
+        napi_create_int64(env, (int64_t)ctx->reportsCoalesced.load(std::memory_order_relaxed), &coalesced);
+        napi_create_int64(env, (int64_t)ctx->reportsDelivered.load(std::memory_order_relaxed), &delivered);
+        napi_create_int64(env, (int64_t)ctx->jsBatches.load(std::memory_order_relaxed), &batches);
+        napi_set_named_property(env, result, "reportsQueued", queued);
+        napi_set_named_property(env, result, "reportsCoalesced", coalesced);
+        napi_set_named_property(env, result, "reportsDelivered", delivered);
+        napi_set_named_property(env, result, "jsBatches", batches);
+
+        napi_value inFlight;
+        napi_create_uint32(env, ctx->inFlight, &inFlight);
+        napi_set_named_property(env, result, "inFlight", inFlight);
+        setHistogramStats(env, result, "interval", "Us", ctx->intervalHist, DDK_INTERVAL_BUCKET_US);
+        setHistogramStats(env, result, "jitter", "Us", ctx->jitterHist, DDK_JITTER_BUCKET_US);
+        setHistogramStats(env, result, "pollRate", "Hz", ctx->pollRateHist, DDK_POLL_RATE_BUCKET_HZ);
     }
 
     return result;
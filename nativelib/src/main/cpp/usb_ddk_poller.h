@@ -6,6 +6,7 @@
  *
  * 使用 OH_Usb_SendPipeRequest() 同步 API 在独立 pthread 中轮询 USB 设备，
  * 绕过 ArkTS 事件循环和 usbManager IPC 瓶颈，实现接近硬件上限的轮询率。
+ * IN 端点由多个工作线程同时挂起请求 (默认 2 个)，OUT 端点由独立线程发送。
  *
  * 替代路径：
  *   ioctl(USBDEVFS_BULK) → 被 HarmonyOS 安全沙箱阻止 (EACCES)
@@ -17,6 +18,7 @@
 #define USB_DDK_POLLER_H
 
 #include <napi/native_api.h>
+#include <stdint.h>
 
 /**
  * 初始化 DDK Poller NAPI 模块。
@@ -24,7 +26,7 @@
  * 注册到 exports.UsbDdkPoller 命名空间：
  *   - init(): number              — 初始化 DDK (dlopen + OH_Usb_Init)
  *   - findDevice(vid, pid): obj   — 查找匹配设备，返回 deviceId
- *   - startPoller(...)：number    — 声明接口 + 启动轮询线程，返回 pollerId
+ *   - startPoller(..., timeoutMs?, inFlight?)：number — 声明接口 + 启动工作线程，返回 pollerId
  *   - stopPoller(pollerId): void  — 停止轮询 + 释放资源
  *   - sendOutput(pollerId, endpoint, data): number — 发送输出数据
  *   - getStats(pollerId): obj     — 获取统计信息
@@ -32,4 +34,54 @@
  */
 void UsbDdkPoller_Init(napi_env env, napi_value exports);
 
+// ============================================================
+// Native 输出接口 (供 HapticsRouter 等 native 模块直接调用，绕过 JS)
+// ============================================================
+
+/**
+ * 输出统计 (轮询线程实际发送)
+ */
+struct UsbDdkOutputStats {
+    uint64_t sent;              // 发送成功次数
+    uint64_t failed;            // 发送失败次数
+    uint64_t stampedCount;      // 带起始时间戳的输出数
+    uint64_t stampedTotalNs;    // 起始时间戳 → 发送完成 总耗时
+    uint64_t stampedMaxNs;      // 起始时间戳 → 发送完成 最大耗时
+};
+
+/**
+ * 获取轮询器当前的启动代号 (任意线程)
+ *
+ * 每次 startPoller 分配新代号，stopPoller 后为 0。native 模块绑定时记录代号，
+ * 投递时带回，避免手柄重插后旧绑定写入被复用的 pollerId 槽位。
+ * @return 代号；0 表示轮询器未运行或 pollerId 无效
+ */
+uint32_t UsbDdkPoller_GetGeneration(int pollerId);
+
+/**
+ * 将输出数据交给轮询线程发送 (latest-wins，与 JS sendOutput 共用挂起槽)
+ *
+ * @param pollerId  轮询器 ID
+ * @param generation 绑定时由 UsbDdkPoller_GetGeneration 取得的代号，与当前代号不符时拒绝投递
+ * @param endpoint  输出端点地址
+ * @param data      数据 (≤64 字节)
+ * @param len       数据长度
+ * @param originNs  起始时间戳 (CLOCK_MONOTONIC ns)，用于统计端到端延迟；0 表示不统计
+ * @return 数据长度；-1 表示轮询器未运行、代号已失效或参数错误
+ */
+int UsbDdkPoller_QueueOutput(int pollerId, uint32_t generation, uint8_t endpoint, const uint8_t *data,
+                             uint32_t len, uint64_t originNs);
+
+/**
+ * 获取轮询器输出统计 (任意线程)
+ * @return false 表示 pollerId 无效
+ */
+bool UsbDdkPoller_GetOutputStats(int pollerId, UsbDdkOutputStats *out);
+
+/**
+ * 限制所有轮询线程的 IN 请求频率（温控降载）
+ * @param intervalUs 两次 IN 请求的最小间隔，0 表示不限速（默认）
+ */
+void UsbDdkPoller_SetMinPollIntervalUs(uint32_t intervalUs);
+
 #endif // USB_DDK_POLLER_H
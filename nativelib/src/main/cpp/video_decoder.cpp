@@ -335,6 +335,8 @@ static constexpr double kEmaAlphaNormal = 0.1;     // 普通帧权重
 static constexpr int64_t kSyncDirectSubmitTimeoutUs = 0;
 // SyncDecodeLoop 中输入/输出查询超时：同样为 0，由循环自身控制节奏
 static constexpr int64_t kSyncLoopQueryTimeoutUs = 0;
+// SyncDecodeLoop 空闲等待倍率（温控降载时 >1，减少空转唤醒；不影响有帧时的 notify 路径）
+static std::atomic<int> g_syncIdleBackoff{1};
 
 // 延迟恢复常量
 // L1: 同步模式 drain-to-latest（始终丢弃堆积帧，仅渲染最新帧）
@@ -1398,10 +1400,14 @@ void VideoDecoder::OnOutputBufferAvailable(OH_AVCodec* codec, uint32_t index,
     if (render != nullptr && render->IsVsyncEnabled() && pfn_RenderOutputBufferAtTime != nullptr) {
         // VSync 模式：使用 RenderOutputBufferAtTime 计算呈现时间
         int64_t presentTimeNs = render->CalculatePresentTime(pts);
-        pfn_RenderOutputBufferAtTime(codec, index, presentTimeNs);
+        if (pfn_RenderOutputBufferAtTime(codec, index, presentTimeNs) == AV_ERR_OK) {
+            render->NotifyFramePresented(enqueueTimeMs, presentTimeNs);
+        }
     } else {
         // 低延迟模式：直接渲染
-        OH_VideoDecoder_RenderOutputBuffer(codec, index);
+        if (OH_VideoDecoder_RenderOutputBuffer(codec, index) == AV_ERR_OK && render != nullptr) {
+            render->NotifyFramePresented(enqueueTimeMs, 0);
+        }
     }
 }
 
@@ -1692,15 +1698,16 @@ void VideoDecoder::SyncDecodeLoop() {
             // 短暂让出 CPU
             // 主路径：直接提交成功后 pendingFrameCond_ 会被 notify，立即唤醒
             // 超时只是兜底，不影响正常延迟
+            int idleBackoff = g_syncIdleBackoff.load(std::memory_order_relaxed);
             std::unique_lock<std::mutex> lock(pendingFrameMutex_);
             if (pendingFrameQueue_.empty() && syncDecodeRunning_) {
                 // 队列空：等待 notify 或超时（2ms 兜底轮询，确保输出不被遗漏）
-                pendingFrameCond_.wait_for(lock, std::chrono::milliseconds(2));
+                pendingFrameCond_.wait_for(lock, std::chrono::milliseconds(2 * idleBackoff));
             } else if (syncDecodeRunning_) {
                 // 队列非空但解码器还没输出：短暂休眠避免空轮询烧 CPU
                 // 1ms 足够让解码器推进，远短于帧间隔
                 lock.unlock();
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                std::this_thread::sleep_for(std::chrono::milliseconds(1 * idleBackoff));
             }
         }
         
@@ -1969,6 +1976,7 @@ int VideoDecoder::SyncProcessOutput(int64_t timeoutUs) {
         OH_VideoDecoder_FreeOutputBuffer(decoder_, latestFrame.index);
         return 0;
     }
+    NativeRender::GetInstance()->NotifyFramePresented(enqueueTimeMs, 0);
     
     return 1;  // 成功渲染一帧
 }
@@ -2341,6 +2349,14 @@ bool IsSyncMode() {
     return g_syncMode;
 }
 
+void SetSyncIdleBackoff(int multiplier) {
+    if (multiplier < 1) multiplier = 1;
+    int prev = g_syncIdleBackoff.exchange(multiplier, std::memory_order_relaxed);
+    if (prev != multiplier) {
+        OH_LOG_INFO(LOG_APP, "SetSyncIdleBackoff: x%{public}d", multiplier);
+    }
+}
+
 VideoDecoderStats GetStats() {
     if (g_videoDecoder != nullptr) {
         return g_videoDecoder->GetStats();
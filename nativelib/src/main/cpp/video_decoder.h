@@ -513,6 +513,12 @@ namespace VideoDecoderInstance {
      */
     VideoDecoderStats GetStats();
     
+    /**
+     * 设置同步解码循环空闲等待倍率（温控降载）
+     * @param multiplier 1 = 默认（2ms 兜底等待 / 1ms 休眠），任意线程调用，下一轮循环生效
+     */
+    void SetSyncIdleBackoff(int multiplier);
+    
     /**
      * 从后台恢复解码器
      * 当应用从后台切回前台时调用
@@ -0,0 +1,351 @@
+#!/usr/bin/env python3
+# Generate controller_db_generated.h: pre-parsed SDL mappings plus a perfect
+# hash over every VID/PID the native gamepad code knows about.
+#
+# Inputs (all under nativelib/src/main/cpp):
+#   sdl_gamecontrollerdb_data.h  SDL GameControllerDB strings (Linux)
+#   sdl_gamecontrollerdb.cpp     g_mappingDatabase (curated) and g_vendorDefaults
+#   gamepad_napi.cpp             g_knownGamepads and g_vendorFallbacks
+#
+# The C tables stay the source of truth; the generated header only stores
+# their indexes. Rerun after editing any of them:
+#   python3 nativelib/tools/gen_controller_db.py          # rewrite the header
+#   python3 nativelib/tools/gen_controller_db.py --check  # exit 1 if stale
+#
+# Lookup priority matches the old linear scans: first match wins inside each
+# table, curated mappings shadow SDL mappings for the same VID/PID.
+import argparse
+import os
+import re
+import sys
+
+CPP_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src', 'main', 'cpp')
+OUTPUT = 'controller_db_generated.h'
+
+MAPPING_FIELDS = [
+    'a', 'b', 'x', 'y', 'back', 'guide', 'start', 'leftstick', 'rightstick',
+    'leftshoulder', 'rightshoulder', 'dpup', 'dpdown', 'dpleft', 'dpright',
+    'leftx', 'lefty', 'rightx', 'righty', 'lefttrigger', 'righttrigger',
+]
+
+KIND_DEVICE = 0
+KIND_VENDOR = 1
+VENDOR_SALT = 0x5BD1E995   # keeps VID-only keys apart from (VID << 16) | PID keys
+
+
+def read(name):
+    with open(os.path.join(CPP_DIR, name), encoding='utf-8') as f:
+        return f.read()
+
+
+def table_body(src, decl):
+    start = src.index(decl)
+    end = src.index('};', start)
+    return src[start:end]
+
+
+# ---------------------------------------------------------------------------
+# SDL string parsing: mirrors parseElement / parseSDLMappingString /
+# extractVidPidFromGUID in sdl_gamecontrollerdb.cpp so results are identical.
+# ---------------------------------------------------------------------------
+
+def c_atoi(s):
+    m = re.match(r'\s*([+-]?\d+)', s)
+    return int(m.group(1)) if m else 0
+
+
+def parse_element(value):
+    src = {'type': 'MAPPING_NONE', 'index': 0, 'hatMask': 0, 'inverted': False, 'rangeMin': 0, 'rangeMax': 255}
+    inverted = False
+    if value.startswith('~'):
+        inverted = True
+        value = value[1:]
+    kind, rest = value[:1], value[1:]
+    if kind == 'b':
+        src['type'] = 'MAPPING_BUTTON'
+        src['index'] = c_atoi(rest)
+    elif kind == 'a':
+        src['type'] = 'MAPPING_AXIS'
+        src['inverted'] = inverted
+        m = re.match(r'\s*([+-]?\d*)(.?)', rest)
+        src['index'] = int(m.group(1)) if m.group(1) not in ('', '+', '-') else 0
+        if m.group(2) == '+':
+            src['rangeMin'], src['rangeMax'] = 128, 255
+        elif m.group(2) == '-':
+            src['rangeMin'], src['rangeMax'] = 0, 128
+    elif kind == 'h':
+        src['type'] = 'MAPPING_HAT'
+        if '.' in rest:
+            src['index'] = c_atoi(rest)
+            src['hatMask'] = c_atoi(rest[rest.index('.') + 1:])
+    else:
+        return None
+    # MappingSource stores index and hatMask as uint8_t; an out-of-range value
+    # would silently truncate to a different index in the generated table.
+    for field in ('index', 'hatMask'):
+        if not 0 <= src[field] <= 255:
+            raise SystemExit('mapping element %r: %s %d out of range 0..255' % (value, field, src[field]))
+    return src
+
+
+def parse_mapping_string(entry):
+    tokens = [t for t in entry.split(',') if t]   # strtok skips empty tokens
+    if not tokens:
+        return None
+    mapping = {'name': tokens[1] if len(tokens) > 1 else None}
+    for token in tokens[2:]:
+        if ':' not in token:
+            continue
+        key, value = token.split(':', 1)
+        src = parse_element(value)
+        if src is not None and key in MAPPING_FIELDS:
+            mapping[key] = src
+    return mapping
+
+
+def vid_pid_from_guid(guid):
+    if len(guid) < 20:
+        return None
+    try:
+        vid = int(guid[8:10], 16) | (int(guid[10:12], 16) << 8)
+        pid = int(guid[16:18], 16) | (int(guid[18:20], 16) << 8)
+    except ValueError:
+        return None
+    if vid == 0 and pid == 0:
+        return None
+    return vid, pid
+
+
+def load_sdl_mappings():
+    src = read('sdl_gamecontrollerdb_data.h')
+    entries = []
+    for m in re.finditer(r'^\s*"((?:[^"\\]|\\.)*)",\s*$', src, re.M):
+        entry = m.group(1)
+        mapping = parse_mapping_string(entry)
+        ids = vid_pid_from_guid(entry)
+        if mapping is None or ids is None:
+            continue
+        mapping['vendorId'], mapping['productId'] = ids
+        entries.append(mapping)
+    return entries
+
+
+# ---------------------------------------------------------------------------
+# Hand-written C tables (only keys and indexes are needed)
+# ---------------------------------------------------------------------------
+
+def load_c_tables():
+    sdl_cpp = read('sdl_gamecontrollerdb.cpp')
+    napi_cpp = read('gamepad_napi.cpp')
+
+    curated = [(int(v, 16), int(p, 16)) for v, p in re.findall(
+        r'\.vendorId\s*=\s*0x([0-9A-Fa-f]+),\s*\.productId\s*=\s*0x([0-9A-Fa-f]+)',
+        table_body(sdl_cpp, 'g_mappingDatabase[] = {'))]
+    vendor_defaults = [int(v, 16) for v in re.findall(
+        r'\{\s*0x([0-9A-Fa-f]+),\s*&g_\w+\s*\}', table_body(sdl_cpp, 'g_vendorDefaults[] = {'))]
+    known = [(int(v, 16), int(p, 16)) for v, p in re.findall(
+        r'\{\s*0x([0-9A-Fa-f]+),\s*0x([0-9A-Fa-f]+),\s*"[^"]*",\s*\d+,\s*\d+\s*\}',
+        table_body(napi_cpp, 'g_knownGamepads[] = {'))]
+    fallbacks = [int(v, 16) for v in re.findall(
+        r'\{\s*0x([0-9A-Fa-f]+),\s*"[^"]*",\s*\d+\s*\}', table_body(napi_cpp, 'g_vendorFallbacks[] = {'))]
+    return curated, vendor_defaults, known, fallbacks
+
+
+# ---------------------------------------------------------------------------
+# Perfect hash (hash-and-displace). Must match controllerDbMix / lookup in
+# sdl_gamecontrollerdb.cpp.
+# ---------------------------------------------------------------------------
+
+MASK32 = 0xFFFFFFFF
+
+
+def mix(x):
+    x &= MASK32
+    x ^= x >> 16
+    x = (x * 0x7FEB352D) & MASK32
+    x ^= x >> 15
+    x = (x * 0x846CA68B) & MASK32
+    x ^= x >> 16
+    return x
+
+
+def next_pow2(n):
+    p = 1
+    while p < n:
+        p <<= 1
+    return p
+
+
+def build_perfect_hash(keys):
+    """keys: list of (key, kind). Returns (bucket_count, slot_count, displace[], slot_of[key])."""
+    slot_count = next_pow2(int(len(keys) * 1.25) + 1)
+    bucket_count = next_pow2(max(1, len(keys) // 4))
+    buckets = [[] for _ in range(bucket_count)]
+    hashes = {}
+    for k in keys:
+        h = mix(k[0] ^ (VENDOR_SALT if k[1] == KIND_VENDOR else 0))
+        hashes[k] = h
+        buckets[h & (bucket_count - 1)].append(k)
+
+    displace = [0] * bucket_count
+    used = [False] * slot_count
+    slot_of = {}
+    for b in sorted(range(bucket_count), key=lambda i: -len(buckets[i])):
+        if not buckets[b]:
+            continue
+        for d in range(1, 1 << 16):
+            slots = [mix(hashes[k] + d * 0x9E3779B9) & (slot_count - 1) for k in buckets[b]]
+            if len(set(slots)) == len(slots) and not any(used[s] for s in slots):
+                break
+        else:
+            raise SystemExit('perfect hash construction failed')
+        displace[b] = d
+        for k, s in zip(buckets[b], slots):
+            used[s] = True
+            slot_of[k] = s
+    return bucket_count, slot_count, displace, slot_of
+
+
+# ---------------------------------------------------------------------------
+# Output
+# ---------------------------------------------------------------------------
+
+def c_string(s):
+    return '"' + s.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+
+def c_source(src):
+    if src is None:
+        return 'NONE'
+    if src['type'] == 'MAPPING_BUTTON':
+        return 'BTN(%d)' % src['index']
+    if src['type'] == 'MAPPING_HAT':
+        return 'HAT(%d, %d)' % (src['index'], src['hatMask'])
+    if src['type'] == 'MAPPING_AXIS' and (src['rangeMin'], src['rangeMax']) == (0, 255):
+        return ('AXIS_INV(%d)' if src['inverted'] else 'AXIS(%d)') % src['index']
+    return '{ %s, %d, %d, %s, %d, %d }' % (src['type'], src['index'], src['hatMask'],
+                                           'true' if src['inverted'] else 'false',
+                                           src['rangeMin'], src['rangeMax'])
+
+
+def generate():
+    sdl = load_sdl_mappings()
+    curated, vendor_defaults, known, fallbacks = load_c_tables()
+
+    devices = {}   # (vid, pid) -> [knownIndex, mappingIndex]
+    vendors = {}   # vid -> [fallbackIndex, vendorDefaultIndex]
+
+    def device(vid, pid):
+        return devices.setdefault((vid, pid), [-1, -1])
+
+    def vendor(vid):
+        return vendors.setdefault(vid, [-1, -1])
+
+    for i, (vid, pid) in enumerate(known):
+        e = device(vid, pid)
+        if e[0] < 0:
+            e[0] = i
+    for i, (vid, pid) in enumerate(curated):
+        e = device(vid, pid)
+        if e[1] < 0:
+            e[1] = i
+    for i, m in enumerate(sdl):
+        e = device(m['vendorId'], m['productId'])
+        if e[1] < 0:
+            e[1] = len(curated) + i
+    for i, vid in enumerate(fallbacks):
+        e = vendor(vid)
+        if e[0] < 0:
+            e[0] = i
+    for i, vid in enumerate(vendor_defaults):
+        e = vendor(vid)
+        if e[1] < 0:
+            e[1] = i
+
+    # Only SDL mappings reachable through the hash are emitted
+    reachable = sorted(e[1] - len(curated) for e in devices.values() if e[1] >= len(curated))
+    remap = {old: new for new, old in enumerate(reachable)}
+    for e in devices.values():
+        if e[1] >= len(curated):
+            e[1] = len(curated) + remap[e[1] - len(curated)]
+
+    keys = [((vid << 16) | pid, KIND_DEVICE) for vid, pid in devices]
+    keys += [(vid, KIND_VENDOR) for vid in vendors]
+    bucket_count, slot_count, displace, slot_of = build_perfect_hash(keys)
+
+    slots = ['    { 0, CONTROLLER_DB_EMPTY, -1, -1 },'] * slot_count
+    for (vid, pid), (known_idx, mapping_idx) in devices.items():
+        slots[slot_of[((vid << 16) | pid, KIND_DEVICE)]] = \
+            '    { 0x%04X%04X, CONTROLLER_DB_DEVICE, %d, %d },' % (vid, pid, known_idx, mapping_idx)
+    for vid, (fallback_idx, default_idx) in vendors.items():
+        slots[slot_of[(vid, KIND_VENDOR)]] = \
+            '    { 0x%08X, CONTROLLER_DB_VENDOR, %d, %d },' % (vid, fallback_idx, default_idx)
+
+    out = []
+    out.append('// Auto-generated by nativelib/tools/gen_controller_db.py - do not edit.')
+    out.append('// Sources: sdl_gamecontrollerdb_data.h, sdl_gamecontrollerdb.cpp, gamepad_napi.cpp')
+    out.append('// Devices: %d | Vendors: %d | SDL mappings: %d | Slots: %d | Buckets: %d'
+               % (len(devices), len(vendors), len(reachable), slot_count, bucket_count))
+    out.append('')
+    out.append('#ifndef CONTROLLER_DB_GENERATED_H')
+    out.append('#define CONTROLLER_DB_GENERATED_H')
+    out.append('')
+    out.append('// Table sizes the indexes below were generated against (checked with static_assert)')
+    out.append('#define CONTROLLER_DB_CURATED_MAPPINGS  %d' % len(curated))
+    out.append('#define CONTROLLER_DB_VENDOR_DEFAULTS   %d' % len(vendor_defaults))
+    out.append('#define CONTROLLER_DB_KNOWN_GAMEPADS    %d' % len(known))
+    out.append('#define CONTROLLER_DB_VENDOR_FALLBACKS  %d' % len(fallbacks))
+    out.append('')
+    out.append('#define CONTROLLER_DB_SDL_MAPPINGS      %d' % len(reachable))
+    out.append('#define CONTROLLER_DB_SLOTS             %d' % slot_count)
+    out.append('#define CONTROLLER_DB_BUCKETS           %d' % bucket_count)
+    out.append('#define CONTROLLER_DB_VENDOR_SALT       0x%08Xu' % VENDOR_SALT)
+    out.append('')
+    out.append('#endif // CONTROLLER_DB_GENERATED_H')
+    out.append('')
+    out.append('// Tables are only emitted into sdl_gamecontrollerdb.cpp')
+    out.append('#if defined(CONTROLLER_DB_DEFINE_TABLES) && !defined(CONTROLLER_DB_TABLES_DEFINED)')
+    out.append('#define CONTROLLER_DB_TABLES_DEFINED')
+    out.append('')
+    out.append('static const GamepadMapping g_sdlDbMappings[CONTROLLER_DB_SDL_MAPPINGS] = {')
+    for i in reachable:
+        m = sdl[i]
+        fields = ', '.join('.%s = %s' % (f, c_source(m.get(f))) for f in MAPPING_FIELDS)
+        out.append('    { .vendorId = 0x%04X, .productId = 0x%04X, .name = %s, %s, .reportOffset = 0, .reportLength = 0 },'
+                   % (m['vendorId'], m['productId'], c_string(m['name']) if m['name'] else 'NULL', fields))
+    out.append('};')
+    out.append('')
+    out.append('static const uint16_t g_controllerDbDisplace[CONTROLLER_DB_BUCKETS] = {')
+    for i in range(0, bucket_count, 16):
+        out.append('    ' + ', '.join('%d' % d for d in displace[i:i + 16]) + ',')
+    out.append('};')
+    out.append('')
+    out.append('static const ControllerDbEntry g_controllerDb[CONTROLLER_DB_SLOTS] = {')
+    out.extend(slots)
+    out.append('};')
+    out.append('')
+    out.append('#endif // CONTROLLER_DB_DEFINE_TABLES')
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--check', action='store_true', help='fail if the checked-in header is stale')
+    args = parser.parse_args()
+
+    text = generate()
+    path = os.path.join(CPP_DIR, OUTPUT)
+    if args.check:
+        with open(path, encoding='utf-8') as f:
+            if f.read() != text:
+                print('%s is stale; run nativelib/tools/gen_controller_db.py' % OUTPUT, file=sys.stderr)
+                return 1
+        return 0
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(text)
+    print('wrote %s' % os.path.normpath(path))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())